@@ -0,0 +1,20 @@
+#ifndef NUOSTL_BENCH_ADDITIONAL_MATH_BENCH_NUO_BIGINTEGER_HPP_
+#define NUOSTL_BENCH_ADDITIONAL_MATH_BENCH_NUO_BIGINTEGER_HPP_
+
+namespace bench {
+
+class Bench_Nuo_BigInteger {
+private:
+    static void bench_small();
+    static void bench_mul_kernels();
+    static void bench_mul();
+    static void bench_div();
+    static void bench_gcd();
+    static void bench_to_string();
+public:
+    static void bench_nuo_biginteger();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef NUOSTL_BENCH_ADDITIONAL_MATH_BENCH_NUO_COMPLEX_HPP_
+#define NUOSTL_BENCH_ADDITIONAL_MATH_BENCH_NUO_COMPLEX_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Complex {
+private:
+    static void bench_mul();
+    static void bench_conj_mul();
+    static void bench_abs();
+public:
+    static void bench_nuo_complex();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef NUOSTL_BENCH_ADDITIONAL_MATH_BENCH_NUO_FRACTION_HPP_
+#define NUOSTL_BENCH_ADDITIONAL_MATH_BENCH_NUO_FRACTION_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Fraction {
+private:
+    static void bench_gcd();
+    static void bench_sum();
+    static void bench_product();
+    static void bench_harmonic();
+public:
+    static void bench_nuo_fraction();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef NUOSTL_BENCH_ADDITIONAL_MATH_BENCH_NUO_MATRIX_HPP_
+#define NUOSTL_BENCH_ADDITIONAL_MATH_BENCH_NUO_MATRIX_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Matrix {
+private:
+    static void bench_peak();
+    static void bench_gemm();
+    static void bench_expression();
+public:
+    static void bench_nuo_matrix();
+};
+
+}   /* namespace bench */
+
+#endif
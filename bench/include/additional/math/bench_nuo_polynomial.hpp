@@ -0,0 +1,18 @@
+#ifndef NUOSTL_BENCH_ADDITIONAL_MATH_BENCH_NUO_POLYNOMIAL_HPP_
+#define NUOSTL_BENCH_ADDITIONAL_MATH_BENCH_NUO_POLYNOMIAL_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Polynomial {
+private:
+    static void bench_mul_kernels();
+    static void bench_mul();
+    static void bench_div();
+    static void bench_evaluate();
+public:
+    static void bench_nuo_polynomial();
+};
+
+}   /* namespace bench */
+
+#endif
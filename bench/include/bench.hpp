@@ -0,0 +1,50 @@
+#ifndef NUOSTL_BENCH_HPP_
+#define NUOSTL_BENCH_HPP_
+
+/* 1. C++ STL Core Components */
+
+/* Dispatch */
+#include "./core/dispatch/bench_nuo_cpu_dispatch.hpp"
+
+/* Data Types */
+#include "./core/data_types/bench_nuo_any.hpp"
+#include "./core/data_types/bench_nuo_optional.hpp"
+#include "./core/data_types/bench_nuo_pair.hpp"
+#include "./core/data_types/bench_nuo_string.hpp"
+#include "./core/data_types/bench_nuo_tuple.hpp"
+#include "./core/data_types/bench_nuo_variant.hpp"
+
+/* Sequence Containers */
+#include "./core/sequence_containers/bench_nuo_list.hpp"
+#include "./core/sequence_containers/bench_nuo_mapped_array.hpp"
+#include "./core/sequence_containers/bench_nuo_priority_queue.hpp"
+#include "./core/sequence_containers/bench_nuo_string_view.hpp"
+
+/* Associative Containers */
+#include "./core/associative_containers/bench_nuo_concurrent_unordered_map.hpp"
+#include "./core/associative_containers/bench_nuo_flat_map.hpp"
+
+/* Function Objects */
+#include "./core/function_objects/bench_nuo_hash.hpp"
+
+/* Algorithms */
+#include "./core/algorithms/bench_nuo_accumulate.hpp"
+#include "./core/algorithms/bench_nuo_copy.hpp"
+#include "./core/algorithms/bench_nuo_max.hpp"
+#include "./core/algorithms/bench_nuo_min.hpp"
+#include "./core/algorithms/bench_nuo_select.hpp"
+#include "./core/algorithms/bench_nuo_sliding_window.hpp"
+
+/* Execution */
+#include "./core/execution/bench_nuo_scheduler.hpp"
+
+/* 2. Additional Components */
+
+/* Math */
+#include "./additional/math/bench_nuo_biginteger.hpp"
+#include "./additional/math/bench_nuo_complex.hpp"
+#include "./additional/math/bench_nuo_fraction.hpp"
+#include "./additional/math/bench_nuo_matrix.hpp"
+#include "./additional/math/bench_nuo_polynomial.hpp"
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef NUOSTL_BENCH_BENCH_HARNESS_HPP_
+#define NUOSTL_BENCH_BENCH_HARNESS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace bench {
+
+/* Substring filter given on the command line, nullptr runs everything. */
+inline const char* filter = nullptr;
+
+/* Keep the compiler from discarding a computed value. */
+template<typename T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/* Force pending memory writes to be considered observable. */
+inline void clobber() {
+    asm volatile("" : : : "memory");
+}
+
+/* Problem sizes are multiplied by NUOSTL_BENCH_SCALE (default 1). */
+inline size_t scale() {
+    static const size_t s = [] {
+        const char* env = getenv("NUOSTL_BENCH_SCALE");
+        long v = env ? atol(env) : 1;
+        return static_cast<size_t>(v > 0 ? v : 1);
+    }();
+    return s;
+}
+
+inline bool enabled(const char* name) {
+    return filter == nullptr || strstr(name, filter) != nullptr;
+}
+
+/*
+ * Best-of-5 nanoseconds per call of f, each sample repeats f until at
+ * least min_seconds have elapsed. Calls are batched so that reading the
+ * clock does not dominate very short functions.
+ */
+template<typename F>
+double measure_ns(F&& f, double min_seconds = 0.02) {
+    using clock = std::chrono::steady_clock;
+    f();    /* warm up */
+    double best = 1e300;
+    for (int rep = 0; rep < 5; rep++) {
+        size_t calls = 0;
+        size_t batch = 1;
+        auto start = clock::now();
+        double elapsed = 0;
+        do {
+            for (size_t b = 0; b < batch; b++)
+                f();
+            calls += batch;
+            elapsed = std::chrono::duration<double>(clock::now() - start)
+                .count();
+            if (elapsed < min_seconds / 64)
+                batch *= 2;
+        } while (elapsed < min_seconds);
+        double ns = elapsed * 1e9 / static_cast<double>(calls);
+        if (ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+/*
+ * One result line: n is the problem size, per_call the amount of work per
+ * call (elements, bytes, flops, ...) reported as a rate in unit/s.
+ */
+inline void report(const char* name, size_t n, double ns,
+                   double per_call, const char* unit = "M/s") {
+    double rate = per_call / ns * 1e3;  /* per_call / (ns * 1e-9) / 1e6 */
+    if (unit[0] == 'G')
+        rate /= 1e3;
+    printf("%-44s %12zu %14.1f ns %12.2f %s\n", name, n, ns, rate, unit);
+    fflush(stdout);
+}
+
+template<typename T>
+std::vector<T> random_vector(size_t n, uint64_t seed = 42) {
+    std::mt19937_64 rng(seed);
+    std::vector<T> v(n);
+    for (auto& x : v) {
+        if constexpr (std::is_floating_point_v<T>)
+            x = static_cast<T>(std::uniform_real_distribution<double>(
+                -1e6, 1e6)(rng));
+        else
+            x = static_cast<T>(rng());
+    }
+    return v;
+}
+
+}   /* namespace bench */
+
+#endif
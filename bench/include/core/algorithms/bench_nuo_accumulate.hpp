@@ -0,0 +1,16 @@
+#ifndef NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_ACCUMULATE_HPP_
+#define NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_ACCUMULATE_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Accumulate {
+private:
+    static void bench_accumulate();
+    static void bench_compare();
+public:
+    static void bench_nuo_accumulate();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_COPY_HPP_
+#define NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_COPY_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Copy {
+private:
+    static void bench_copy();
+    static void bench_fill();
+public:
+    static void bench_nuo_copy();
+};
+
+}   /* namespace bench */
+
+#endif
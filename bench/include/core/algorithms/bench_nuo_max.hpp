@@ -0,0 +1,17 @@
+#ifndef NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_MAX_HPP_
+#define NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_MAX_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Max {
+private:
+    static void bench_nuo_max_range();
+    static void bench_nuo_max_string();
+    static void bench_nuo_max_initializer_list();
+public:
+    static void bench_nuo_max();
+};
+
+}   /* namespace bench */
+
+#endif
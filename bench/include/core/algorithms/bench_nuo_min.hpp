@@ -0,0 +1,17 @@
+#ifndef NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_MIN_HPP_
+#define NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_MIN_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Min {
+private:
+    static void bench_nuo_min_range();
+    static void bench_nuo_min_string();
+    static void bench_nuo_min_initializer_list();
+public:
+    static void bench_nuo_min();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_SELECT_HPP_
+#define NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_SELECT_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Select {
+private:
+    static void bench_nth_element();
+    static void bench_partial_sort();
+    static void bench_top_k();
+public:
+    static void bench_nuo_select();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_SLIDING_WINDOW_HPP_
+#define NUOSTL_BENCH_CORE_ALGORITHMS_BENCH_NUO_SLIDING_WINDOW_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Sliding_Window {
+private:
+    static void bench_sliding_min();
+    static void bench_aggregator();
+    static void bench_stream();
+public:
+    static void bench_nuo_sliding_window();
+};
+
+}   /* namespace bench */
+
+#endif
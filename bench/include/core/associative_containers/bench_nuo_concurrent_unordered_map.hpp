@@ -0,0 +1,15 @@
+#ifndef NUOSTL_BENCH_CORE_ASSOCIATIVE_CONTAINERS_BENCH_NUO_CONCURRENT_UNORDERED_MAP_HPP_
+#define NUOSTL_BENCH_CORE_ASSOCIATIVE_CONTAINERS_BENCH_NUO_CONCURRENT_UNORDERED_MAP_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Concurrent_Unordered_Map {
+private:
+    static void bench_mix(const char* mix, unsigned write_percent);
+public:
+    static void bench_nuo_concurrent_unordered_map();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef NUOSTL_BENCH_CORE_ASSOCIATIVE_CONTAINERS_BENCH_NUO_FLAT_MAP_HPP_
+#define NUOSTL_BENCH_CORE_ASSOCIATIVE_CONTAINERS_BENCH_NUO_FLAT_MAP_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Flat_Map {
+private:
+    static void bench_build();
+    static void bench_find();
+    static void bench_find_batch();
+    static void bench_batch_insert();
+    static void bench_memory();
+public:
+    static void bench_nuo_flat_map();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_ANY_HPP_
+#define NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_ANY_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Any {
+private:
+    static void bench_copy();
+public:
+    static void bench_nuo_any();
+};
+
+}   /* namespace bench */
+
+#endif
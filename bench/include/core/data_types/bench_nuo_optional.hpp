@@ -0,0 +1,15 @@
+#ifndef NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_OPTIONAL_HPP_
+#define NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_OPTIONAL_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Optional {
+private:
+    static void bench_scan();
+public:
+    static void bench_nuo_optional();
+};
+
+}   /* namespace bench */
+
+#endif
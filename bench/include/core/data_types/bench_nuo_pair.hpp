@@ -0,0 +1,17 @@
+#ifndef NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_PAIR_HPP_
+#define NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_PAIR_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Pair {
+private:
+    static void bench_compare();
+    static void bench_arithmetic();
+    static void bench_min_max();
+public:
+    static void bench_nuo_pair();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_STRING_HPP_
+#define NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_STRING_HPP_
+
+namespace bench {
+
+class Bench_Nuo_String {
+private:
+    static void bench_construct();
+    static void bench_equal();
+    static void bench_find();
+    static void bench_append();
+public:
+    static void bench_nuo_string();
+};
+
+}   /* namespace bench */
+
+#endif
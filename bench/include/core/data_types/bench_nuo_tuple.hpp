@@ -0,0 +1,16 @@
+#ifndef NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_TUPLE_HPP_
+#define NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_TUPLE_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Tuple {
+private:
+    static void bench_scan();
+    static void bench_sort();
+public:
+    static void bench_nuo_tuple();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_VARIANT_HPP_
+#define NUOSTL_BENCH_CORE_DATA_TYPES_BENCH_NUO_VARIANT_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Variant {
+private:
+    static void bench_visit();
+    static void bench_visit2();
+public:
+    static void bench_nuo_variant();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef NUOSTL_BENCH_CORE_DISPATCH_BENCH_NUO_CPU_DISPATCH_HPP_
+#define NUOSTL_BENCH_CORE_DISPATCH_BENCH_NUO_CPU_DISPATCH_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Cpu_Dispatch {
+private:
+    static void bench_dispatch_overhead();
+    static void bench_minmax_per_isa();
+public:
+    static void bench_nuo_cpu_dispatch();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef NUOSTL_BENCH_CORE_EXECUTION_BENCH_NUO_SCHEDULER_HPP_
+#define NUOSTL_BENCH_CORE_EXECUTION_BENCH_NUO_SCHEDULER_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Scheduler {
+private:
+    static void bench_fork_join();
+    static void bench_compute();
+    static void bench_memory();
+public:
+    static void bench_nuo_scheduler();
+};
+
+}   /* namespace bench */
+
+#endif
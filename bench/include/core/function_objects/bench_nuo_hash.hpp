@@ -0,0 +1,17 @@
+#ifndef NUOSTL_BENCH_CORE_FUNCTION_OBJECTS_BENCH_NUO_HASH_HPP_
+#define NUOSTL_BENCH_CORE_FUNCTION_OBJECTS_BENCH_NUO_HASH_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Hash {
+private:
+    static void bench_integers();
+    static void bench_bytes();
+    static void bench_bytes_per_isa();
+public:
+    static void bench_nuo_hash();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef NUOSTL_BENCH_CORE_SEQUENCE_CONTAINERS_BENCH_NUO_LIST_HPP_
+#define NUOSTL_BENCH_CORE_SEQUENCE_CONTAINERS_BENCH_NUO_LIST_HPP_
+
+namespace bench {
+
+class Bench_Nuo_List {
+private:
+    static void bench_lru();
+    static void bench_fill();
+public:
+    static void bench_nuo_list();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef NUOSTL_BENCH_CORE_SEQUENCE_CONTAINERS_BENCH_NUO_MAPPED_ARRAY_HPP_
+#define NUOSTL_BENCH_CORE_SEQUENCE_CONTAINERS_BENCH_NUO_MAPPED_ARRAY_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Mapped_Array {
+private:
+    static void bench_min_column();
+public:
+    static void bench_nuo_mapped_array();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef NUOSTL_BENCH_CORE_SEQUENCE_CONTAINERS_BENCH_NUO_PRIORITY_QUEUE_HPP_
+#define NUOSTL_BENCH_CORE_SEQUENCE_CONTAINERS_BENCH_NUO_PRIORITY_QUEUE_HPP_
+
+namespace bench {
+
+class Bench_Nuo_Priority_Queue {
+private:
+    static void bench_push_pop();
+    static void bench_hold();
+    static void bench_make_heap();
+    static void bench_reschedule();
+    static void bench_compact_index();
+public:
+    static void bench_nuo_priority_queue();
+};
+
+}   /* namespace bench */
+
+#endif
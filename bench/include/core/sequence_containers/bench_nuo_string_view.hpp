@@ -0,0 +1,19 @@
+#ifndef NUOSTL_BENCH_CORE_SEQUENCE_CONTAINERS_BENCH_NUO_STRING_VIEW_HPP_
+#define NUOSTL_BENCH_CORE_SEQUENCE_CONTAINERS_BENCH_NUO_STRING_VIEW_HPP_
+
+namespace bench {
+
+class Bench_Nuo_String_View {
+private:
+    static void bench_find();
+    static void bench_find_first_of();
+    static void bench_split_lines();
+    static void bench_tokenize();
+    static void bench_degenerate();
+public:
+    static void bench_nuo_string_view();
+};
+
+}   /* namespace bench */
+
+#endif
@@ -0,0 +1,287 @@
+#include "./additional/math/bench_nuo_biginteger.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#if defined(NUOSTL_BENCH_HAVE_GMP)
+#include <gmp.h>
+#endif
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_biginteger;
+
+/*
+ * Operand sizes are in 64-bit limbs, rates are limbs of the larger operand
+ * per second. With GMP found at configure time every nuo_biginteger line
+ * is followed by the same operation on mpz_t.
+ */
+
+namespace {
+
+using limb = nuo_biginteger::limb_type;
+
+nuo_biginteger random_big(size_t n, uint64_t seed) {
+    std::vector<limb> v = bench::random_vector<limb>(n, seed);
+    v.back() |= limb(1) << 63;
+    nuo_biginteger r;
+    for (size_t i = n; i-- > 0; ) {
+        r <<= 64;
+        r += v[i];
+    }
+    return r;
+}
+
+#if defined(NUOSTL_BENCH_HAVE_GMP)
+/* mpz_t wrapper holding the same value as a nuo_biginteger */
+struct Mpz {
+    mpz_t z;
+    Mpz() { mpz_init(z); }
+    explicit Mpz(const nuo_biginteger& x) {
+        mpz_init(z);
+        mpz_import(z, x.size_limbs(), -1, sizeof(limb), 0, 0, x.data());
+        if (x.sign() < 0)
+            mpz_neg(z, z);
+    }
+    ~Mpz() { mpz_clear(z); }
+    Mpz(const Mpz&) = delete;
+    Mpz& operator=(const Mpz&) = delete;
+};
+#endif
+
+std::string name_n(const char* base, size_t n) {
+    return std::string(base) + "/" + std::to_string(n);
+}
+
+}   /* namespace */
+
+/* ------------------------------------------------- */
+void bench::Bench_Nuo_BigInteger::bench_nuo_biginteger() {
+    bench_small();
+    bench_mul_kernels();
+    bench_mul();
+    bench_div();
+    bench_gcd();
+    bench_to_string();
+}
+
+/* ------------------------------------------------- */
+/* Word sized values: inline storage, no allocation */
+void bench::Bench_Nuo_BigInteger::bench_small() {
+    const size_t n = 4096;
+    std::vector<int64_t> v = bench::random_vector<int64_t>(n, 31);
+    for (auto& x : v)
+        x >>= 34;
+    if (bench::enabled("nuo_biginteger/small_mul_add")) {
+        double ns = bench::measure_ns([&] {
+            nuo_biginteger acc;
+            for (size_t i = 0; i + 1 < n; i += 2)
+                acc += nuo_biginteger(v[i]) * v[i + 1];
+            bench::do_not_optimize(acc);
+        });
+        bench::report("nuo_biginteger/small_mul_add", n, ns,
+                      static_cast<double>(n / 2));
+    }
+#if defined(NUOSTL_BENCH_HAVE_GMP)
+    if (bench::enabled("gmp/small_mul_add")) {
+        double ns = bench::measure_ns([&] {
+            Mpz acc, t;
+            for (size_t i = 0; i + 1 < n; i += 2) {
+                mpz_set_si(t.z, v[i]);
+                mpz_mul_si(t.z, t.z, v[i + 1]);
+                mpz_add(acc.z, acc.z, t.z);
+            }
+            bench::do_not_optimize(acc.z);
+        });
+        bench::report("gmp/small_mul_add", n, ns, static_cast<double>(n / 2));
+    }
+#endif
+}
+
+/*
+ * Balanced n x n products by the schoolbook and Karatsuba kernels alone,
+ * the crossover sets nuo_bigint_karatsuba_threshold. Beyond it compare
+ * Karatsuba with operator*, which switches to Toom-3 at
+ * nuo_bigint_toom3_threshold.
+ */
+void bench::Bench_Nuo_BigInteger::bench_mul_kernels() {
+    for (size_t n : {8, 16, 24, 32, 48, 64, 128, 256, 512, 1024, 2048}) {
+        std::vector<limb> a = bench::random_vector<limb>(n, 1);
+        std::vector<limb> b = bench::random_vector<limb>(n, 2);
+        std::vector<limb> r(2 * n);
+        std::vector<limb> ws(nuostl::detail::nuo_bigint_karatsuba_scratch(n));
+        std::string name = name_n("nuo_biginteger/mul_basecase", n);
+        if (n <= 512 && bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuostl::detail::nuo_bigint_mul_basecase(r.data(), a.data(), n,
+                                                        b.data(), n);
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n("nuo_biginteger/mul_karatsuba", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuostl::detail::nuo_bigint_mul_karatsuba(r.data(), a.data(),
+                    b.data(), n, ws.data());
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+
+    /* 512 limb Karatsuba with the basecase switch at t limbs */
+    const size_t n = 512;
+    std::vector<limb> a = bench::random_vector<limb>(n, 1);
+    std::vector<limb> b = bench::random_vector<limb>(n, 2);
+    std::vector<limb> r(2 * n);
+    std::vector<limb> ws(nuostl::detail::nuo_bigint_karatsuba_scratch(n));
+    for (size_t t : {8, 12, 16, 20, 24, 32, 48, 64}) {
+        std::string name = name_n("nuo_biginteger/karatsuba_threshold", t);
+        if (!bench::enabled(name.c_str()))
+            continue;
+        double ns = bench::measure_ns([&] {
+            nuostl::detail::nuo_bigint_mul_karatsuba(r.data(), a.data(),
+                b.data(), n, ws.data(), t);
+            bench::clobber();
+        });
+        bench::report(name.c_str(), n, ns, static_cast<double>(n));
+    }
+}
+
+/* ------------------------------------------------- */
+/*
+ * operator* through all of its kernels, the three prime NTT from
+ * nuo_bigint_ntt_threshold limbs on.
+ */
+void bench::Bench_Nuo_BigInteger::bench_mul() {
+    for (size_t n : {16, 64, 256, 512, 1024, 2048, 4096, 16384, 65536}) {
+        nuo_biginteger a = random_big(n, 3);
+        nuo_biginteger b = random_big(n, 4);
+        std::string name = name_n("nuo_biginteger/mul", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                bench::do_not_optimize(a * b);
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+#if defined(NUOSTL_BENCH_HAVE_GMP)
+        name = name_n("gmp/mul", n);
+        if (bench::enabled(name.c_str())) {
+            Mpz ga(a), gb(b), gr;
+            double ns = bench::measure_ns([&] {
+                mpz_mul(gr.z, ga.z, gb.z);
+                bench::do_not_optimize(gr.z);
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+#endif
+    }
+}
+
+/*
+ * 2n / n limb division: Knuth D kernel against operator/, which switches
+ * to the Newton reciprocal at nuo_bigint_newton_threshold.
+ */
+void bench::Bench_Nuo_BigInteger::bench_div() {
+    for (size_t n : {32, 128, 512, 1024, 2048, 4096}) {
+        nuo_biginteger a = random_big(2 * n, 5);
+        nuo_biginteger b = random_big(n, 6);
+        std::string name = name_n("nuo_biginteger/div_knuth", n);
+        if (bench::enabled(name.c_str())) {
+            std::vector<limb> q(n + 1), r(n);
+            double ns = bench::measure_ns([&] {
+                nuostl::detail::nuo_bigint_divrem_knuth(q.data(), r.data(),
+                    a.data(), 2 * n, b.data(), n);
+                bench::clobber();
+            });
+            bench::report(name.c_str(), 2 * n, ns, static_cast<double>(2 * n));
+        }
+        name = name_n("nuo_biginteger/div", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuo_biginteger q, r;
+                divmod(a, b, q, r);
+                bench::do_not_optimize(q);
+                bench::do_not_optimize(r);
+            });
+            bench::report(name.c_str(), 2 * n, ns, static_cast<double>(2 * n));
+        }
+#if defined(NUOSTL_BENCH_HAVE_GMP)
+        name = name_n("gmp/div", n);
+        if (bench::enabled(name.c_str())) {
+            Mpz ga(a), gb(b), gq, gr;
+            double ns = bench::measure_ns([&] {
+                mpz_tdiv_qr(gq.z, gr.z, ga.z, gb.z);
+                bench::do_not_optimize(gq.z);
+            });
+            bench::report(name.c_str(), 2 * n, ns, static_cast<double>(2 * n));
+        }
+#endif
+    }
+}
+
+/* ------------------------------------------------- */
+/* n / n limb gcd, Lehmer steps on the leading 126 bits */
+void bench::Bench_Nuo_BigInteger::bench_gcd() {
+    for (size_t n : {4, 64, 1024, 8192}) {
+        nuo_biginteger a = random_big(n, 8);
+        nuo_biginteger b = random_big(n, 9);
+        std::string name = name_n("nuo_biginteger/gcd", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                bench::do_not_optimize(gcd(a, b));
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+#if defined(NUOSTL_BENCH_HAVE_GMP)
+        name = name_n("gmp/gcd", n);
+        if (bench::enabled(name.c_str())) {
+            Mpz ga(a), gb(b), gg;
+            double ns = bench::measure_ns([&] {
+                mpz_gcd(gg.z, ga.z, gb.z);
+                bench::do_not_optimize(gg.z);
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+#endif
+    }
+}
+
+/* ------------------------------------------------- */
+void bench::Bench_Nuo_BigInteger::bench_to_string() {
+    for (size_t n : {4, 64, 1024, 8192}) {
+        nuo_biginteger a = random_big(n, 7);
+        std::string name = name_n("nuo_biginteger/to_string", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                bench::do_not_optimize(a.to_string());
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        std::string dec = a.to_string();
+        name = name_n("nuo_biginteger/from_string", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                bench::do_not_optimize(nuo_biginteger(dec));
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+#if defined(NUOSTL_BENCH_HAVE_GMP)
+        name = name_n("gmp/to_string", n);
+        if (bench::enabled(name.c_str())) {
+            Mpz ga(a);
+            std::string buf(mpz_sizeinbase(ga.z, 10) + 2, '\0');
+            double ns = bench::measure_ns([&] {
+                mpz_get_str(buf.data(), 10, ga.z);
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+#endif
+    }
+}
@@ -0,0 +1,167 @@
+#include "./additional/math/bench_nuo_complex.hpp"
+
+#include <math.h>
+#include <stdint.h>
+
+#include <complex>
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_complex;
+using nuostl::nuo_complex_array;
+
+/*
+ * Element-wise kernels over n complex values, rates are elements per
+ * second. nuo_complex_array runs split storage through the dispatched
+ * kernels; std_* is the same loop over std::vector<std::complex<T>>, with
+ * operator* going through the Annex G check (__muldc3 at -O2), and
+ * std_*_limited writes the plain formula out by hand on the interleaved
+ * layout, what -fcx-limited-range would give. Products are taken in place
+ * by unit-modulus factors so the values stay bounded across repetitions.
+ */
+
+namespace {
+
+const size_t sizes[] = {1024, 16384, 1 << 20};
+
+std::string name_n(const char* base, const char* type, size_t n) {
+    return std::string(base) + "_" + type + "/" + std::to_string(n);
+}
+
+template<typename T>
+struct Data {
+    nuo_complex_array<T> a, b;
+    std::vector<std::complex<T>> sa, sb;
+
+    explicit Data(size_t n) : a(n), b(n), sa(n), sb(n) {
+        std::vector<double> v = bench::random_vector<double>(2 * n, 5);
+        for (size_t i = 0; i < n; i++) {
+            nuo_complex<T> x(static_cast<T>(v[i] * 1e-6),
+                             static_cast<T>(v[n + i] * 1e-6));
+            nuo_complex<T> u = nuostl::polar(T(1), static_cast<T>(v[i] * 1e-5));
+            a.set(i, x);
+            b.set(i, u);
+            sa[i] = x;
+            sb[i] = u;
+        }
+    }
+};
+
+template<typename T, bool Conj>
+void run_mul(const char* type) {
+    for (size_t n : sizes) {
+        Data<T> d(n);
+        std::string name = name_n(Conj ? "nuo_complex/conj_mul" : "nuo_complex/mul",
+                                  type, n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                if constexpr (Conj)
+                    d.a.conj_mul_assign(d.b);
+                else
+                    d.a *= d.b;
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n(Conj ? "nuo_complex/std_conj_mul" : "nuo_complex/std_mul",
+                      type, n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                for (size_t i = 0; i < n; i++)
+                    d.sa[i] *= Conj ? std::conj(d.sb[i]) : d.sb[i];
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n(Conj ? "nuo_complex/std_conj_mul_limited"
+                           : "nuo_complex/std_mul_limited",
+                      type, n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                for (size_t i = 0; i < n; i++) {
+                    T a = d.sa[i].real(), b = d.sa[i].imag();
+                    T c = d.sb[i].real(), e = Conj ? -d.sb[i].imag() : d.sb[i].imag();
+                    d.sa[i] = std::complex<T>(a * c - b * e, a * e + b * c);
+                }
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+template<typename T>
+void run_abs(const char* type) {
+    for (size_t n : sizes) {
+        Data<T> d(n);
+        std::vector<T> out(n);
+        std::string name = name_n("nuo_complex/abs", type, n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuostl::detail::nuo_complex_abs_n<T, false>(
+                    d.a.real_data(), d.a.imag_data(), out.data(), n);
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n("nuo_complex/std_abs", type, n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                for (size_t i = 0; i < n; i++)
+                    out[i] = std::abs(d.sa[i]);
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n("nuo_complex/norm", type, n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuostl::detail::nuo_complex_abs_n<T, true>(
+                    d.a.real_data(), d.a.imag_data(), out.data(), n);
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n("nuo_complex/std_norm", type, n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                for (size_t i = 0; i < n; i++)
+                    out[i] = std::norm(d.sa[i]);
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+}   /* namespace */
+
+/* ------------------------------------------------- */
+void bench::Bench_Nuo_Complex::bench_nuo_complex() {
+    bench_mul();
+    bench_conj_mul();
+    bench_abs();
+}
+
+/* ------------------------------------------------- */
+void bench::Bench_Nuo_Complex::bench_mul() {
+    run_mul<double, false>("f64");
+    run_mul<float, false>("f32");
+}
+
+/* ------------------------------------------------- */
+/* a * conj(b), the cross-correlation product */
+void bench::Bench_Nuo_Complex::bench_conj_mul() {
+    run_mul<double, true>("f64");
+    run_mul<float, true>("f32");
+}
+
+/* ------------------------------------------------- */
+/* |z| (hypot on the std side) and |z|^2 */
+void bench::Bench_Nuo_Complex::bench_abs() {
+    run_abs<double>("f64");
+    run_abs<float>("f32");
+}
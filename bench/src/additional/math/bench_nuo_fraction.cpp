@@ -0,0 +1,205 @@
+#include "./additional/math/bench_nuo_fraction.hpp"
+
+#include <stdint.h>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_biginteger;
+using nuostl::nuo_fraction;
+
+/*
+ * Long accumulation chains, rates are operations per second. The eager_*
+ * lines run the same chain on an int64 rational reduced with std::gcd
+ * after every operation, the usual textbook layout.
+ */
+
+namespace {
+
+using frac = nuo_fraction<int64_t>;
+using bigfrac = nuo_fraction<nuo_biginteger>;
+
+/* Always in lowest terms, no overflow handling */
+struct Eager {
+    int64_t num = 0;
+    int64_t den = 1;
+
+    Eager() = default;
+    Eager(int64_t n, int64_t d) : num(n), den(d) {}
+
+    Eager& operator+=(const Eager& o) {
+        int64_t g = std::gcd(den, o.den);
+        int64_t t = num * (o.den / g) + o.num * (den / g);
+        int64_t g2 = std::gcd(t, g);
+        num = t / g2;
+        den = (den / g) * (o.den / g2);
+        return *this;
+    }
+
+    Eager& operator*=(const Eager& o) {
+        int64_t g1 = std::gcd(num, o.den), g2 = std::gcd(o.num, den);
+        num = (num / g1) * (o.num / g2);
+        den = (den / g2) * (o.den / g1);
+        return *this;
+    }
+};
+
+std::string name_n(const char* base, size_t n) {
+    return std::string(base) + "/" + std::to_string(n);
+}
+
+}   /* namespace */
+
+/* ------------------------------------------------- */
+void bench::Bench_Nuo_Fraction::bench_nuo_fraction() {
+    bench_gcd();
+    bench_sum();
+    bench_product();
+    bench_harmonic();
+}
+
+/* ------------------------------------------------- */
+/* Binary GCD against std::gcd (Euclid) on random 64-bit pairs */
+void bench::Bench_Nuo_Fraction::bench_gcd() {
+    const size_t n = 4096;
+    std::vector<uint64_t> a = bench::random_vector<uint64_t>(n, 1);
+    std::vector<uint64_t> b = bench::random_vector<uint64_t>(n, 2);
+    if (bench::enabled("nuo_fraction/gcd_binary")) {
+        double ns = bench::measure_ns([&] {
+            uint64_t s = 0;
+            for (size_t i = 0; i < n; i++)
+                s += nuostl::detail::nuo_gcd_binary(a[i], b[i]);
+            bench::do_not_optimize(s);
+        });
+        bench::report("nuo_fraction/gcd_binary", n, ns, static_cast<double>(n));
+    }
+    if (bench::enabled("nuo_fraction/gcd_std")) {
+        double ns = bench::measure_ns([&] {
+            uint64_t s = 0;
+            for (size_t i = 0; i < n; i++)
+                s += std::gcd(a[i], b[i]);
+            bench::do_not_optimize(s);
+        });
+        bench::report("nuo_fraction/gcd_std", n, ns, static_cast<double>(n));
+    }
+}
+
+/*
+ * Sums: random terms over denominators 1..12 (the value stays small, lazy
+ * reduction skips most gcds) and the telescoping 1 / (k (k + 1)), whose
+ * denominators reach 2^40 and keep the int64 parts near overflow. The
+ * telescoping sum is the eager layout's best case, every reduced value
+ * being k / (k + 1).
+ */
+void bench::Bench_Nuo_Fraction::bench_sum() {
+    for (size_t n : {1000, 100000}) {
+        std::vector<uint64_t> r = bench::random_vector<uint64_t>(n, 7);
+        std::vector<int64_t> num(n), den(n);
+        for (size_t i = 0; i < n; i++) {
+            num[i] = static_cast<int64_t>(r[i] % 41) - 20;
+            den[i] = static_cast<int64_t>((r[i] >> 8) % 12) + 1;
+        }
+
+        std::string name = name_n("nuo_fraction/sum_small", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                frac s;
+                for (size_t i = 0; i < n; i++)
+                    s += frac(num[i], den[i]);
+                bench::do_not_optimize(s);
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n("nuo_fraction/eager_sum_small", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                Eager s;
+                for (size_t i = 0; i < n; i++)
+                    s += Eager(num[i], den[i]);
+                bench::do_not_optimize(s);
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+
+        name = name_n("nuo_fraction/sum_telescoping", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                frac s;
+                for (size_t k = 1; k <= n; k++)
+                    s += frac(1, static_cast<int64_t>(k * (k + 1)));
+                bench::do_not_optimize(s);
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n("nuo_fraction/eager_sum_telescoping", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                Eager s;
+                for (size_t k = 1; k <= n; k++)
+                    s += Eager(1, static_cast<int64_t>(k * (k + 1)));
+                bench::do_not_optimize(s);
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+/* ------------------------------------------------- */
+/* prod k / (k + 1) = 1 / (n + 1), kept in int64 by cross-cancellation */
+void bench::Bench_Nuo_Fraction::bench_product() {
+    const size_t n = 100000;
+    if (bench::enabled("nuo_fraction/product_telescoping")) {
+        double ns = bench::measure_ns([&] {
+            frac p(1);
+            for (size_t k = 1; k <= n; k++)
+                p *= frac(static_cast<int64_t>(k), static_cast<int64_t>(k + 1));
+            bench::do_not_optimize(p);
+        });
+        bench::report("nuo_fraction/product_telescoping", n, ns,
+                      static_cast<double>(n));
+    }
+    if (bench::enabled("nuo_fraction/eager_product_telescoping")) {
+        double ns = bench::measure_ns([&] {
+            Eager p(1, 1);
+            for (size_t k = 1; k <= n; k++)
+                p *= Eager(static_cast<int64_t>(k), static_cast<int64_t>(k + 1));
+            bench::do_not_optimize(p);
+        });
+        bench::report("nuo_fraction/eager_product_telescoping", n, ns,
+                      static_cast<double>(n));
+    }
+}
+
+/*
+ * Harmonic numbers leave int64 after 46 terms: nuo_fraction<int64_t>
+ * promotes itself, nuo_fraction<nuo_biginteger> is big from the start.
+ */
+void bench::Bench_Nuo_Fraction::bench_harmonic() {
+    for (size_t n : {40, 1000, 5000}) {
+        std::string name = name_n("nuo_fraction/harmonic_i64", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                frac h;
+                for (size_t k = 1; k <= n; k++)
+                    h += frac(1, static_cast<int64_t>(k));
+                bench::do_not_optimize(h);
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n("nuo_fraction/harmonic_big", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                bigfrac h;
+                for (size_t k = 1; k <= n; k++)
+                    h += bigfrac(nuo_biginteger(1),
+                                 nuo_biginteger(static_cast<int64_t>(k)));
+                bench::do_not_optimize(h);
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
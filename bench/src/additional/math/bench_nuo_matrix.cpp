@@ -0,0 +1,190 @@
+#include "./additional/math/bench_nuo_matrix.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+#if defined(NUOSTL_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+using nuostl::nuo_matrix;
+
+/*
+ * Rates are GFLOP/s, 2 m n k per product. The peak lines time independent
+ * FMAs on registers at the active ISA level, the ceiling a GEMM kernel can
+ * reach on this core; the naive lines are the i-j-k triple loop.
+ */
+
+namespace {
+
+std::string name_n(const char* base, size_t n) {
+    return std::string(base) + "/" + std::to_string(n);
+}
+
+template<typename T>
+nuo_matrix<T> random_matrix(size_t r, size_t c, uint64_t seed) {
+    std::vector<double> v = bench::random_vector<double>(r * c, seed);
+    nuo_matrix<T> m(r, c);
+    for (size_t i = 0; i < r; i++) {
+        for (size_t j = 0; j < c; j++)
+            m(i, j) = static_cast<T>(v[i * c + j] * 1e-6);
+    }
+    return m;
+}
+
+template<typename T>
+void naive(const nuo_matrix<T>& a, const nuo_matrix<T>& b, nuo_matrix<T>& c) {
+    for (size_t i = 0; i < a.rows(); i++) {
+        for (size_t j = 0; j < b.cols(); j++) {
+            T s = T(0);
+            for (size_t p = 0; p < a.cols(); p++)
+                s += a(i, p) * b(p, j);
+            c(i, j) = s;
+        }
+    }
+}
+
+#if defined(NUOSTL_ARCH_X86)
+
+constexpr long peak_iters = 1 << 20;
+
+/* 12 independent chains cover FMA latency x ports on current cores */
+NUOSTL_TARGET_AVX512 double peak_avx512_f64() {
+    bench::clobber();
+    __m512d acc[12];
+    for (int i = 0; i < 12; i++)
+        acc[i] = _mm512_set1_pd(i * 0.1);
+    __m512d b = _mm512_set1_pd(0.999), c = _mm512_set1_pd(1e-3);
+    for (long it = 0; it < peak_iters; it++) {
+#pragma GCC unroll 12
+        for (int i = 0; i < 12; i++)
+            acc[i] = _mm512_fmadd_pd(acc[i], b, c);
+    }
+    for (int i = 1; i < 12; i++)
+        acc[0] = _mm512_add_pd(acc[0], acc[i]);
+    double out[8];
+    _mm512_storeu_pd(out, acc[0]);
+    return out[0] + out[7];
+}
+
+NUOSTL_TARGET_AVX2 double peak_avx2_f64() {
+    bench::clobber();
+    __m256d acc[12];
+    for (int i = 0; i < 12; i++)
+        acc[i] = _mm256_set1_pd(i * 0.1);
+    __m256d b = _mm256_set1_pd(0.999), c = _mm256_set1_pd(1e-3);
+    for (long it = 0; it < peak_iters; it++) {
+#pragma GCC unroll 12
+        for (int i = 0; i < 12; i++)
+            acc[i] = _mm256_fmadd_pd(acc[i], b, c);
+    }
+    for (int i = 1; i < 12; i++)
+        acc[0] = _mm256_add_pd(acc[0], acc[i]);
+    double out[4];
+    _mm256_storeu_pd(out, acc[0]);
+    return out[0] + out[3];
+}
+
+#endif
+
+}   /* namespace */
+
+/* ------------------------------------------------- */
+void bench::Bench_Nuo_Matrix::bench_nuo_matrix() {
+    bench_peak();
+    bench_gemm();
+    bench_expression();
+}
+
+/* ------------------------------------------------- */
+/* f64 FMA throughput, float peaks are twice these */
+void bench::Bench_Nuo_Matrix::bench_peak() {
+#if defined(NUOSTL_ARCH_X86)
+    nuostl::nuo_isa isa = nuostl::nuo_cpu_isa();
+    if (isa == nuostl::nuo_isa::avx512 &&
+        bench::enabled("nuo_matrix/peak_f64_avx512")) {
+        double ns = bench::measure_ns([] {
+            bench::do_not_optimize(peak_avx512_f64());
+        });
+        bench::report("nuo_matrix/peak_f64_avx512", 0, ns,
+                      2.0 * 8 * 12 * peak_iters, "GFLOP/s");
+    }
+    if (isa >= nuostl::nuo_isa::avx2 &&
+        bench::enabled("nuo_matrix/peak_f64_avx2")) {
+        double ns = bench::measure_ns([] {
+            bench::do_not_optimize(peak_avx2_f64());
+        });
+        bench::report("nuo_matrix/peak_f64_avx2", 0, ns,
+                      2.0 * 4 * 12 * peak_iters, "GFLOP/s");
+    }
+#endif
+}
+
+/* ------------------------------------------------- */
+/* n x n x n products, naive up to 512 */
+void bench::Bench_Nuo_Matrix::bench_gemm() {
+    auto run = [](auto tag, const char* gemm, const char* base) {
+        using T = decltype(tag);
+        for (size_t n : {32, 64, 128, 256, 512, 1024, 2048}) {
+            nuo_matrix<T> a = random_matrix<T>(n, n, 1);
+            nuo_matrix<T> b = random_matrix<T>(n, n, 2);
+            nuo_matrix<T> c(n, n);
+            double flops = 2.0 * n * n * n;
+            std::string name = name_n(gemm, n);
+            if (bench::enabled(name.c_str())) {
+                double ns = bench::measure_ns([&] {
+                    c = a * b;
+                    bench::clobber();
+                });
+                bench::report(name.c_str(), n, ns, flops, "GFLOP/s");
+            }
+            name = name_n(base, n);
+            if (n <= 512 && bench::enabled(name.c_str())) {
+                double ns = bench::measure_ns([&] {
+                    naive(a, b, c);
+                    bench::clobber();
+                });
+                bench::report(name.c_str(), n, ns, flops, "GFLOP/s");
+            }
+        }
+    };
+    run(double(), "nuo_matrix/gemm_f64", "nuo_matrix/naive_f64");
+    run(float(), "nuo_matrix/gemm_f32", "nuo_matrix/naive_f32");
+}
+
+/*
+ * D = A B + C as one fused GEMM against the same product through an
+ * explicit temporary.
+ */
+void bench::Bench_Nuo_Matrix::bench_expression() {
+    for (size_t n : {64, 256, 1024}) {
+        nuo_matrix<double> a = random_matrix<double>(n, n, 3);
+        nuo_matrix<double> b = random_matrix<double>(n, n, 4);
+        nuo_matrix<double> c = random_matrix<double>(n, n, 5);
+        nuo_matrix<double> d(n, n);
+        double flops = 2.0 * n * n * n;
+        std::string name = name_n("nuo_matrix/fused_f64", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                d = a * b + c;
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, flops, "GFLOP/s");
+        }
+        name = name_n("nuo_matrix/temporary_f64", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuo_matrix<double> t = a * b;
+                d = t + c;
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, flops, "GFLOP/s");
+        }
+    }
+}
@@ -0,0 +1,208 @@
+#include "./additional/math/bench_nuo_polynomial.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_modint;
+using nuostl::nuo_polynomial;
+
+/*
+ * Sizes are coefficient counts, rates are coefficients of the larger
+ * operand per second. Integer operands are 20-bit so one NTT prime is
+ * enough; nuo_modint products need two.
+ */
+
+namespace {
+
+using mint = nuo_modint<998244353>;
+
+template<typename T>
+std::vector<T> random_coefs(size_t n, uint64_t seed) {
+    std::vector<uint64_t> v = bench::random_vector<uint64_t>(n, seed);
+    std::vector<T> r(n);
+    for (size_t i = 0; i < n; i++) {
+        if constexpr (std::is_same_v<T, mint>)
+            r[i] = mint(v[i]);
+        else
+            r[i] = static_cast<T>(static_cast<int64_t>(v[i] >> 44) - (1 << 19));
+    }
+    return r;
+}
+
+std::string name_n(const char* base, size_t n) {
+    return std::string(base) + "/" + std::to_string(n);
+}
+
+/* n x n kernel products by schoolbook and by the transform */
+template<typename T, typename Fast>
+void bench_kernel_pair(const char* school, const char* fast, Fast mul_fast) {
+    for (size_t n : {16, 32, 64, 96, 128, 160, 192, 256, 512}) {
+        std::vector<T> a = random_coefs<T>(n, 1);
+        std::vector<T> b = random_coefs<T>(n, 2);
+        std::vector<T> r(2 * n - 1);
+        std::string name = name_n(school, n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuostl::detail::nuo_poly_mul_schoolbook(a.data(), n, b.data(),
+                                                        n, r.data());
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n(fast, n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                mul_fast(a.data(), n, b.data(), n, r.data());
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+template<typename T>
+void bench_mul_type(const char* base, const char* school) {
+    for (size_t n : {100, 1000, 10000, 100000, 1000000}) {
+        nuo_polynomial<T> a(random_coefs<T>(n, 3));
+        nuo_polynomial<T> b(random_coefs<T>(n, 4));
+        std::string name = name_n(base, n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                bench::do_not_optimize(a * b);
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n(school, n);
+        if (n <= 10000 && bench::enabled(name.c_str())) {
+            std::vector<T> r(2 * n - 1);
+            double ns = bench::measure_ns([&] {
+                nuostl::detail::nuo_poly_mul_schoolbook(
+                    a.coefficients().data(), n, b.coefficients().data(), n,
+                    r.data());
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+}   /* namespace */
+
+/* ------------------------------------------------- */
+void bench::Bench_Nuo_Polynomial::bench_nuo_polynomial() {
+    bench_mul_kernels();
+    bench_mul();
+    bench_div();
+    bench_evaluate();
+}
+
+/*
+ * Schoolbook against the transform kernels, the crossovers set
+ * nuo_poly_ntt_threshold and nuo_poly_fft_threshold.
+ */
+void bench::Bench_Nuo_Polynomial::bench_mul_kernels() {
+    bench_kernel_pair<int64_t>("nuo_polynomial/mul_schoolbook_i64",
+        "nuo_polynomial/mul_ntt_i64",
+        nuostl::detail::nuo_poly_mul_ntt<int64_t>);
+    bench_kernel_pair<mint>("nuo_polynomial/mul_schoolbook_mod",
+        "nuo_polynomial/mul_ntt_mod",
+        nuostl::detail::nuo_poly_mul_ntt<mint>);
+    bench_kernel_pair<double>("nuo_polynomial/mul_schoolbook_f64",
+        "nuo_polynomial/mul_fft_f64",
+        nuostl::detail::nuo_poly_mul_fft<double>);
+}
+
+/* ------------------------------------------------- */
+/* operator* up to degree 10^6, schoolbook alongside up to 10^4 */
+void bench::Bench_Nuo_Polynomial::bench_mul() {
+    bench_mul_type<int64_t>("nuo_polynomial/mul_i64",
+                            "nuo_polynomial/mul_i64_schoolbook");
+    bench_mul_type<mint>("nuo_polynomial/mul_mod",
+                         "nuo_polynomial/mul_mod_schoolbook");
+    bench_mul_type<double>("nuo_polynomial/mul_f64",
+                           "nuo_polynomial/mul_f64_schoolbook");
+}
+
+/*
+ * 2n / n division over nuo_modint, which switches from long division to
+ * the Newton inverse at nuo_poly_newton_threshold. Integer polynomials
+ * always divide the long way, the i64 line shows what that costs.
+ */
+void bench::Bench_Nuo_Polynomial::bench_div() {
+    for (size_t n : {100, 1000, 10000, 100000, 500000}) {
+        nuo_polynomial<mint> a(random_coefs<mint>(2 * n, 5));
+        nuo_polynomial<mint> b(random_coefs<mint>(n, 6));
+        std::string name = name_n("nuo_polynomial/div_mod", 2 * n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuo_polynomial<mint> q, r;
+                divmod(a, b, q, r);
+                bench::do_not_optimize(q);
+                bench::do_not_optimize(r);
+            });
+            bench::report(name.c_str(), 2 * n, ns, static_cast<double>(2 * n));
+        }
+        name = name_n("nuo_polynomial/div_i64_long", 2 * n);
+        if (n <= 10000 && bench::enabled(name.c_str())) {
+            std::vector<int64_t> bc = random_coefs<int64_t>(n, 6);
+            bc.back() = 1;
+            nuo_polynomial<int64_t> ai(random_coefs<int64_t>(2 * n, 5));
+            nuo_polynomial<int64_t> bi(bc);
+            double ns = bench::measure_ns([&] {
+                nuo_polynomial<int64_t> q, r;
+                divmod(ai, bi, q, r);
+                bench::do_not_optimize(q);
+                bench::do_not_optimize(r);
+            });
+            bench::report(name.c_str(), 2 * n, ns, static_cast<double>(2 * n));
+        }
+    }
+}
+
+/* ------------------------------------------------- */
+/*
+ * Degree n - 1 at n points: Horner per point against the subproduct tree
+ * (nuo_poly_tree_threshold), and interpolation through the same tree.
+ */
+void bench::Bench_Nuo_Polynomial::bench_evaluate() {
+    for (size_t n : {64, 256, 1000, 10000, 100000}) {
+        nuo_polynomial<mint> p(random_coefs<mint>(n, 7));
+        std::vector<mint> xs(n);
+        for (size_t i = 0; i < n; i++)
+            xs[i] = mint(3 * i + 1);
+        std::string name = name_n("nuo_polynomial/evaluate_horner", n);
+        if (n <= 10000 && bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                std::vector<mint> ys(n);
+                for (size_t i = 0; i < n; i++)
+                    ys[i] = p(xs[i]);
+                bench::do_not_optimize(ys.data());
+                bench::clobber();
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n("nuo_polynomial/evaluate", n);
+        if (bench::enabled(name.c_str())) {
+            double ns = bench::measure_ns([&] {
+                bench::do_not_optimize(p.evaluate(xs));
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+        name = name_n("nuo_polynomial/interpolate", n);
+        if (bench::enabled(name.c_str())) {
+            std::vector<mint> ys = p.evaluate(xs);
+            double ns = bench::measure_ns([&] {
+                bench::do_not_optimize(
+                    nuo_polynomial<mint>::interpolate(xs, ys));
+            });
+            bench::report(name.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#include "bench.hpp"
+
+#include <stdio.h>
+
+#include "bench_harness.hpp"
+
+using namespace bench;
+
+/*
+ * Usage: bench [filter]
+ * Only benchmarks whose name contains filter are run.
+ */
+int main(int argc, char** argv) {
+    if (argc > 1)
+        bench::filter = argv[1];
+
+    printf("%-44s %12s %17s %15s\n", "benchmark", "n", "time/call", "rate");
+
+    /* Dispatch */
+    Bench_Nuo_Cpu_Dispatch::bench_nuo_cpu_dispatch();
+
+    /* Data Types */
+    Bench_Nuo_Any::bench_nuo_any();
+    Bench_Nuo_Optional::bench_nuo_optional();
+    Bench_Nuo_Pair::bench_nuo_pair();
+    Bench_Nuo_String::bench_nuo_string();
+    Bench_Nuo_Tuple::bench_nuo_tuple();
+    Bench_Nuo_Variant::bench_nuo_variant();
+
+    /* Sequence Containers */
+    Bench_Nuo_List::bench_nuo_list();
+    Bench_Nuo_Mapped_Array::bench_nuo_mapped_array();
+    Bench_Nuo_Priority_Queue::bench_nuo_priority_queue();
+    Bench_Nuo_String_View::bench_nuo_string_view();
+
+    /* Associative Containers */
+    Bench_Nuo_Concurrent_Unordered_Map::bench_nuo_concurrent_unordered_map();
+    Bench_Nuo_Flat_Map::bench_nuo_flat_map();
+
+    /* Function Objects */
+    Bench_Nuo_Hash::bench_nuo_hash();
+
+    /* Algorithms */
+    Bench_Nuo_Accumulate::bench_nuo_accumulate();
+    Bench_Nuo_Copy::bench_nuo_copy();
+    Bench_Nuo_Max::bench_nuo_max();
+    Bench_Nuo_Min::bench_nuo_min();
+    Bench_Nuo_Select::bench_nuo_select();
+    Bench_Nuo_Sliding_Window::bench_nuo_sliding_window();
+
+    /* Execution */
+    Bench_Nuo_Scheduler::bench_nuo_scheduler();
+
+    /* Math */
+    Bench_Nuo_BigInteger::bench_nuo_biginteger();
+    Bench_Nuo_Complex::bench_nuo_complex();
+    Bench_Nuo_Fraction::bench_nuo_fraction();
+    Bench_Nuo_Matrix::bench_nuo_matrix();
+    Bench_Nuo_Polynomial::bench_nuo_polynomial();
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include "./core/algorithms/bench_nuo_accumulate.hpp"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+namespace {
+
+/*
+ * Reductions over 64 Ki elements (in L2), where the loop-carried
+ * dependency rather than memory bounds the serial loop: a 64-bit multiply
+ * chain runs at its latency, the four lanes of nuo_accumulate at its
+ * throughput. The comparator benchmarks show a known comparison
+ * (std::greater<int>) reaching the SIMD kernel through nuo_min.
+ */
+
+template<typename T, typename Op>
+void accumulate(const char* what, const std::vector<T>& v, Op op) {
+    std::string s = std::string("std::accumulate/") + what;
+    std::string n = std::string("nuo_accumulate/") + what;
+    if (bench::enabled(s.c_str())) {
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(std::accumulate(v.begin(), v.end(), T(1), op));
+        });
+        bench::report(s.c_str(), v.size(), ns, static_cast<double>(v.size()));
+    }
+    if (bench::enabled(n.c_str())) {
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(nuostl::nuo_accumulate(v.begin(), v.end(), T(1), op));
+        });
+        bench::report(n.c_str(), v.size(), ns, static_cast<double>(v.size()));
+    }
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Accumulate::bench_accumulate() {
+    const size_t n = size_t(1) << 16;
+    std::vector<uint64_t> u = bench::random_vector<uint64_t>(n, 44);
+    std::vector<int32_t> i = bench::random_vector<int32_t>(n, 45);
+    accumulate("u64_plus", u, nuostl::nuo_plus<>());
+    accumulate("u64_multiplies", u, nuostl::nuo_multiplies<>());
+    accumulate("u64_bit_xor", u, std::bit_xor<>());
+    accumulate("i32_plus", i, nuostl::nuo_plus<>());
+}
+
+void bench::Bench_Nuo_Accumulate::bench_compare() {
+    const size_t n = size_t(1) << 16;
+    std::vector<int32_t> v = bench::random_vector<int32_t>(n, 46);
+    if (bench::enabled("std::min_element/greater")) {
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(*std::min_element(v.begin(), v.end(), std::greater<int32_t>()));
+        });
+        bench::report("std::min_element/greater", n, ns, static_cast<double>(n));
+    }
+    if (bench::enabled("nuo_min/greater")) {
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(nuostl::nuo_min(v.begin(), v.end(), std::greater<int32_t>()));
+        });
+        bench::report("nuo_min/greater", n, ns, static_cast<double>(n));
+    }
+}
+
+void bench::Bench_Nuo_Accumulate::bench_nuo_accumulate() {
+    bench_accumulate();
+    bench_compare();
+}
@@ -0,0 +1,92 @@
+#include "./core/algorithms/bench_nuo_copy.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+namespace {
+
+/*
+ * Copies and fills of uint64_t arrays from 64 B to 1 GB, in and out of
+ * every cache level. The last level cache here decides where nuo_copy
+ * switches to non-temporal stores; "nuo_copy_cached" keeps regular stores
+ * at every size to show what streaming changes.
+ */
+
+const size_t sizes[] = {64, 4096, size_t(1) << 18, size_t(1) << 24,
+                        size_t(1) << 28, size_t(1) << 30};
+constexpr size_t max_bytes = size_t(1) << 30;
+
+/* Both buffers, allocated once and touched so no page faults are timed */
+uint64_t* buffer(int which) {
+    static std::unique_ptr<uint64_t[]> b[2];
+    if (!b[which]) {
+        b[which].reset(new uint64_t[max_bytes / sizeof(uint64_t)]);
+        memset(b[which].get(), which, max_bytes);
+    }
+    return b[which].get();
+}
+
+template<typename F>
+void run(const char* op, size_t bytes, F&& f) {
+    std::string name = std::string(op) + "/" + std::to_string(bytes);
+    if (!bench::enabled(name.c_str()))
+        return;
+    double ns = bench::measure_ns(f);
+    bench::report(name.c_str(), bytes, ns, static_cast<double>(bytes), "GB/s");
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Copy::bench_copy() {
+    const size_t threshold = nuostl::nuo_copy_stream_threshold();
+    for (size_t bytes : sizes) {
+        size_t n = bytes / sizeof(uint64_t);
+        const uint64_t* src = buffer(0);
+        uint64_t* dst = buffer(1);
+        run("memcpy", bytes, [&] {
+            memcpy(dst, src, bytes);
+            bench::clobber();
+        });
+        run("std::copy", bytes, [&] {
+            std::copy(src, src + n, dst);
+            bench::clobber();
+        });
+        run("nuo_copy", bytes, [&] {
+            nuostl::nuo_copy(src, src + n, dst);
+            bench::clobber();
+        });
+        nuostl::nuo_set_copy_stream_threshold(SIZE_MAX);
+        run("nuo_copy_cached", bytes, [&] {
+            nuostl::nuo_copy(src, src + n, dst);
+            bench::clobber();
+        });
+        nuostl::nuo_set_copy_stream_threshold(threshold);
+    }
+}
+
+void bench::Bench_Nuo_Copy::bench_fill() {
+    for (size_t bytes : sizes) {
+        size_t n = bytes / sizeof(uint32_t);
+        uint32_t* dst = reinterpret_cast<uint32_t*>(buffer(1));
+        run("std::fill/ones", bytes, [&] {
+            std::fill(dst, dst + n, ~uint32_t(0));
+            bench::clobber();
+        });
+        run("nuo_fill/ones", bytes, [&] {
+            nuostl::nuo_fill(dst, dst + n, ~uint32_t(0));
+            bench::clobber();
+        });
+    }
+}
+
+void bench::Bench_Nuo_Copy::bench_nuo_copy() {
+    bench_copy();
+    bench_fill();
+}
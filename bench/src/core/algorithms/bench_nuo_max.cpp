@@ -0,0 +1,72 @@
+#include "./core/algorithms/bench_nuo_max.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+namespace {
+
+template<typename T>
+void run_range(const char* name, const char* std_name, size_t n) {
+    std::vector<T> v = bench::random_vector<T>(n);
+    if (bench::enabled(name)) {
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(nuostl::nuo_max(v.begin(), v.end()));
+        });
+        bench::report(name, n, ns, static_cast<double>(n));
+    }
+    if (bench::enabled(std_name)) {
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(*std::max_element(v.begin(), v.end()));
+        });
+        bench::report(std_name, n, ns, static_cast<double>(n));
+    }
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Max::bench_nuo_max_range() {
+    const size_t n = (1u << 20) * bench::scale();
+    run_range<int>("nuo_max/range/int", "std::max_element/int", n);
+    run_range<long long>("nuo_max/range/long_long",
+                         "std::max_element/long_long", n);
+    run_range<double>("nuo_max/range/double", "std::max_element/double", n);
+}
+
+void bench::Bench_Nuo_Max::bench_nuo_max_string() {
+    if (!bench::enabled("nuo_max/range/string"))
+        return;
+    const size_t n = (1u << 16) * bench::scale();
+    std::vector<std::string> v(n);
+    std::vector<long long> keys = bench::random_vector<long long>(n);
+    for (size_t i = 0; i < n; i++)
+        v[i] = "key_" + std::to_string(keys[i]);
+
+    double ns = bench::measure_ns([&] {
+        bench::do_not_optimize(nuostl::nuo_max(v.begin(), v.end()));
+    });
+    bench::report("nuo_max/range/string", n, ns, static_cast<double>(n));
+}
+
+void bench::Bench_Nuo_Max::bench_nuo_max_initializer_list() {
+    if (!bench::enabled("nuo_max/initializer_list"))
+        return;
+    volatile int seed = 7;
+    double ns = bench::measure_ns([&] {
+        int s = seed;
+        bench::do_not_optimize(nuostl::nuo_max({
+            s + 3, s - 1, s * 2, s + 9, s - 4, s * 3, s + 5, s - 7
+        }));
+    });
+    bench::report("nuo_max/initializer_list/int8", 8, ns, 8.0);
+}
+
+void bench::Bench_Nuo_Max::bench_nuo_max() {
+    bench_nuo_max_range();
+    bench_nuo_max_string();
+    bench_nuo_max_initializer_list();
+}
@@ -0,0 +1,141 @@
+#include "./core/algorithms/bench_nuo_select.hpp"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+namespace {
+
+/*
+ * Selection over 2^20 (times the scale) random samples with k much
+ * smaller than n. Each run first copies the input back into the working
+ * buffer, so the std:: and nuostl columns carry the same copy; rates are
+ * input elements per second.
+ */
+
+const size_t ks[] = {10, 100, 1000};
+
+std::string name(const char* what, size_t k) {
+    return std::string(what) + "/k" + std::to_string(k);
+}
+
+template<typename T>
+void partial_sorts(const char* type, uint64_t seed) {
+    const size_t n = (size_t(1) << 20) * bench::scale();
+    const std::vector<T> v = bench::random_vector<T>(n, seed);
+    std::vector<T> w(n);
+    std::string s = std::string("std::sort/") + type;
+    if (bench::enabled(s.c_str())) {
+        double ns = bench::measure_ns([&] {
+            std::copy(v.begin(), v.end(), w.begin());
+            std::sort(w.begin(), w.end());
+            bench::clobber();
+        });
+        bench::report(s.c_str(), n, ns, static_cast<double>(n));
+    }
+    for (size_t k : ks) {
+        const auto mid = static_cast<ptrdiff_t>(k);
+        s = name((std::string("std::partial_sort/") + type).c_str(), k);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                std::copy(v.begin(), v.end(), w.begin());
+                std::partial_sort(w.begin(), w.begin() + mid, w.end());
+                bench::clobber();
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+        s = name((std::string("nuo_partial_sort/") + type).c_str(), k);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                std::copy(v.begin(), v.end(), w.begin());
+                nuostl::nuo_partial_sort(w.begin(), w.begin() + mid, w.end());
+                bench::clobber();
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+}   /* namespace */
+
+/* The median and the k-th smallest, both linear on average */
+void bench::Bench_Nuo_Select::bench_nth_element() {
+    const size_t n = (size_t(1) << 20) * bench::scale();
+    const std::vector<int32_t> v = bench::random_vector<int32_t>(n, 60);
+    std::vector<int32_t> w(n);
+    for (size_t k : {size_t(1000), n / 2}) {
+        const auto nth = static_cast<ptrdiff_t>(k);
+        std::string s = name("std::nth_element", k);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                std::copy(v.begin(), v.end(), w.begin());
+                std::nth_element(w.begin(), w.begin() + nth, w.end());
+                bench::clobber();
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+        s = name("nuo_nth_element", k);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                std::copy(v.begin(), v.end(), w.begin());
+                nuostl::nuo_nth_element(w.begin(), w.begin() + nth, w.end());
+                bench::clobber();
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+/*
+ * The k smallest in order: a full sort for reference, then the heap
+ * selections of std::partial_sort and nuo_partial_sort, the latter
+ * skipping the rejected elements with the SIMD threshold scan.
+ */
+void bench::Bench_Nuo_Select::bench_partial_sort() {
+    partial_sorts<int32_t>("int32", 61);
+    partial_sorts<float>("float", 62);
+}
+
+/*
+ * The k largest of a stream of int32 arriving in chunks of 4096:
+ * one push() per sample, against one per chunk through the SIMD scan.
+ */
+void bench::Bench_Nuo_Select::bench_top_k() {
+    const size_t n = (size_t(1) << 20) * bench::scale();
+    const size_t chunk = 4096;
+    const std::vector<int32_t> v = bench::random_vector<int32_t>(n, 63);
+    for (size_t k : ks) {
+        std::string s = name("nuo_top_k/push", k);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuostl::nuo_top_k<int32_t> t(k);
+                for (int32_t x : v)
+                    t.push(x);
+                bench::do_not_optimize(t.threshold());
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+        s = name("nuo_top_k/push_chunk", k);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuostl::nuo_top_k<int32_t> t(k);
+                for (size_t i = 0; i < n; i += chunk)
+                    t.push(v.begin() + static_cast<ptrdiff_t>(i),
+                           v.begin() + static_cast<ptrdiff_t>(std::min(i + chunk, n)));
+                bench::do_not_optimize(t.threshold());
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+void bench::Bench_Nuo_Select::bench_nuo_select() {
+    bench_nth_element();
+    bench_partial_sort();
+    bench_top_k();
+}
@@ -0,0 +1,155 @@
+#include "./core/algorithms/bench_nuo_sliding_window.hpp"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+namespace {
+
+/*
+ * Rolling minima of 2^20 (times the scale) random int32 samples for
+ * window sizes from 4 to 4096: rescanning each window with nuo_min costs
+ * n * w comparisons and only runs up to w = 256; nuo_window_min is the
+ * monotonic queue fed one sample at a time, nuo_sliding_min the block
+ * algorithm over the whole range. Rates are samples per second.
+ */
+
+const size_t windows[] = {4, 16, 64, 256, 4096};
+
+std::string name(const char* what, size_t w) {
+    return std::string(what) + "/w" + std::to_string(w);
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Sliding_Window::bench_sliding_min() {
+    const size_t n = (size_t(1) << 20) * bench::scale();
+    const std::vector<int32_t> v = bench::random_vector<int32_t>(n, 50);
+    std::vector<int32_t> out(n);
+    for (size_t w : windows) {
+        std::string s = name("rescan/nuo_min", w);
+        if (w <= 256 && bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                for (size_t i = 0; i + w <= n; i++)
+                    out[i] = nuostl::nuo_min(v.begin() + static_cast<ptrdiff_t>(i),
+                                             v.begin() + static_cast<ptrdiff_t>(i + w));
+                bench::clobber();
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+        s = name("nuo_window_min", w);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuostl::nuo_window_min<int32_t> q(w);
+                for (size_t i = 0; i < n; i++) {
+                    q.push(v[i]);
+                    out[i] = q.top();
+                }
+                bench::clobber();
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+        s = name("nuo_sliding_min", w);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuostl::nuo_sliding_min(v.begin(), v.end(), w, out.begin());
+                bench::clobber();
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+/*
+ * Rolling sums and products over the same samples: the sum is invertible
+ * and keeps one running total, the wrapping product has no inverse and
+ * goes through the two stacks. rescan refolds every window.
+ */
+void bench::Bench_Nuo_Sliding_Window::bench_aggregator() {
+    const size_t n = (size_t(1) << 20) * bench::scale();
+    const std::vector<uint32_t> v = bench::random_vector<uint32_t>(n, 51);
+    for (size_t w : windows) {
+        std::string s = name("rescan/nuo_accumulate", w);
+        if (w <= 256 && bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                uint32_t r = 0;
+                for (size_t i = 0; i + w <= n; i++)
+                    r ^= nuostl::nuo_accumulate(v.begin() + static_cast<ptrdiff_t>(i),
+                                                v.begin() + static_cast<ptrdiff_t>(i + w),
+                                                uint32_t(0));
+                bench::do_not_optimize(r);
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+        s = name("nuo_window_aggregator/plus", w);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuostl::nuo_window_aggregator<uint32_t> a;
+                uint32_t r = 0;
+                for (size_t i = 0; i < n; i++) {
+                    a.push(v[i]);
+                    if (a.size() > w)
+                        a.pop();
+                    r ^= a.value();
+                }
+                bench::do_not_optimize(r);
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+        s = name("nuo_window_aggregator/multiplies", w);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuostl::nuo_window_aggregator<uint32_t, nuostl::nuo_multiplies<>> a;
+                uint32_t r = 0;
+                for (size_t i = 0; i < n; i++) {
+                    a.push(v[i] | 1);
+                    if (a.size() > w)
+                        a.pop();
+                    r ^= a.value();
+                }
+                bench::do_not_optimize(r);
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+/*
+ * Running minimum and maximum of a stream arriving in chunks of 4096:
+ * per sample, and per chunk through the SIMD range kernels.
+ */
+void bench::Bench_Nuo_Sliding_Window::bench_stream() {
+    const size_t n = (size_t(1) << 20) * bench::scale();
+    const size_t chunk = 4096;
+    const std::vector<int32_t> v = bench::random_vector<int32_t>(n, 52);
+    if (bench::enabled("nuo_stream_minmax/push")) {
+        double ns = bench::measure_ns([&] {
+            nuostl::nuo_stream_minmax<int32_t> s;
+            for (int32_t x : v)
+                s.push(x);
+            bench::do_not_optimize(s.min() ^ s.max());
+        });
+        bench::report("nuo_stream_minmax/push", n, ns, static_cast<double>(n));
+    }
+    if (bench::enabled("nuo_stream_minmax/push_chunk")) {
+        double ns = bench::measure_ns([&] {
+            nuostl::nuo_stream_minmax<int32_t> s;
+            for (size_t i = 0; i < n; i += chunk)
+                s.push(v.begin() + static_cast<ptrdiff_t>(i),
+                       v.begin() + static_cast<ptrdiff_t>(std::min(i + chunk, n)));
+            bench::do_not_optimize(s.min() ^ s.max());
+        });
+        bench::report("nuo_stream_minmax/push_chunk", n, ns, static_cast<double>(n));
+    }
+}
+
+void bench::Bench_Nuo_Sliding_Window::bench_nuo_sliding_window() {
+    bench_sliding_min();
+    bench_aggregator();
+    bench_stream();
+}
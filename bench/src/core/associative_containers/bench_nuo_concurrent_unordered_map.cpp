@@ -0,0 +1,114 @@
+#include "./core/associative_containers/bench_nuo_concurrent_unordered_map.hpp"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+namespace {
+
+const uint64_t key_range = uint64_t(1) << 17;
+const size_t ops_per_thread = size_t(1) << 16;
+
+/* One global lock around std::unordered_map, the baseline */
+template<typename Mutex>
+struct Locked_Map {
+    std::unordered_map<uint64_t, uint64_t> m;
+    mutable Mutex lock;
+
+    bool find(uint64_t k) const {
+        if constexpr (std::is_same_v<Mutex, std::shared_mutex>) {
+            std::shared_lock<Mutex> lk(lock);
+            return m.find(k) != m.end();
+        } else {
+            std::lock_guard<Mutex> lk(lock);
+            return m.find(k) != m.end();
+        }
+    }
+
+    void write(uint64_t k) {
+        std::lock_guard<Mutex> lk(lock);
+        m[k]++;
+    }
+};
+
+struct Concurrent_Map {
+    nuostl::nuo_concurrent_unordered_map<uint64_t, uint64_t> m;
+
+    bool find(uint64_t k) const { return m.contains(k); }
+    void write(uint64_t k) { m.upsert(k, uint64_t(1), [](uint64_t& v) { v++; }); }
+};
+
+std::vector<unsigned> thread_counts() {
+    std::vector<unsigned> r = {1, 2, 4};
+    const unsigned hw = std::thread::hardware_concurrency();
+    for (unsigned t = 8; t <= std::max(hw, 4u); t *= 2)
+        r.push_back(t);
+    return r;
+}
+
+/* threads x ops_per_thread operations, write_percent of them upserts */
+template<typename Map>
+void run(Map& map, unsigned threads, unsigned write_percent) {
+    std::vector<std::thread> ts;
+    for (unsigned t = 0; t < threads; t++) {
+        ts.emplace_back([&map, t, write_percent] {
+            uint64_t x = 0x9e3779b97f4a7c15ull * (t + 1);
+            size_t hits = 0;
+            for (size_t i = 0; i < ops_per_thread; i++) {
+                x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+                const uint64_t k = x % key_range;
+                if ((x >> 40) % 100 < write_percent)
+                    map.write(k);
+                else
+                    hits += map.find(k);
+            }
+            bench::do_not_optimize(hits);
+        });
+    }
+    for (std::thread& th : ts)
+        th.join();
+}
+
+template<typename Map>
+void bench_one(const std::string& name, unsigned write_percent) {
+    for (unsigned threads : thread_counts()) {
+        std::string s = name + "/" + std::to_string(threads) + "t";
+        if (!bench::enabled(s.c_str()))
+            continue;
+        Map map;
+        for (uint64_t k = 0; k < key_range; k += 2)
+            map.write(k);
+        double ns = bench::measure_ns([&] { run(map, threads, write_percent); }, 0.05);
+        const size_t ops = threads * ops_per_thread;
+        bench::report(s.c_str(), ops, ns, static_cast<double>(ops));
+    }
+}
+
+}   /* namespace */
+
+/*
+ * Threads looking up and upserting random keys of a map half full of
+ * 2^17 keys. The rate is total operations per second over all threads;
+ * it only scales with threads that have cores to run on.
+ */
+void bench::Bench_Nuo_Concurrent_Unordered_Map::bench_mix(const char* mix, unsigned write_percent) {
+    const std::string p = std::string("concurrent/") + mix + "/";
+    bench_one<Locked_Map<std::mutex>>(p + "std::unordered_map+mutex", write_percent);
+    bench_one<Locked_Map<std::shared_mutex>>(p + "std::unordered_map+shared_mutex", write_percent);
+    bench_one<Concurrent_Map>(p + "nuo_concurrent_unordered_map", write_percent);
+}
+
+void bench::Bench_Nuo_Concurrent_Unordered_Map::bench_nuo_concurrent_unordered_map() {
+    bench_mix("read_heavy", 5);
+    bench_mix("write_heavy", 50);
+}
@@ -0,0 +1,278 @@
+#include "./core/associative_containers/bench_nuo_flat_map.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_flat_map;
+using nuostl::nuo_pair;
+
+namespace {
+
+const size_t sizes[] = {size_t(1) << 10, size_t(1) << 16, size_t(1) << 20};
+
+using Entries = std::vector<nuo_pair<uint64_t, uint64_t>>;
+
+Entries random_entries(size_t n, uint64_t seed) {
+    const std::vector<uint64_t> k = bench::random_vector<uint64_t>(n, seed);
+    Entries e(n);
+    for (size_t i = 0; i < n; i++)
+        e[i] = nuo_pair<uint64_t, uint64_t>(k[i], i);
+    return e;
+}
+
+/* Present keys in random order */
+std::vector<uint64_t> queries(const Entries& e, size_t m, uint64_t seed) {
+    const std::vector<uint64_t> r = bench::random_vector<uint64_t>(m, seed);
+    std::vector<uint64_t> q(m);
+    for (size_t i = 0; i < m; i++)
+        q[i] = e[r[i] % e.size()].first;
+    return q;
+}
+
+/* Counts the bytes a std::map holds in its nodes */
+inline size_t live_bytes = 0;
+
+template<typename T>
+struct Counting_Allocator {
+    using value_type = T;
+
+    Counting_Allocator() = default;
+
+    template<typename U>
+    Counting_Allocator(const Counting_Allocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        live_bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        live_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template<typename U>
+    bool operator==(const Counting_Allocator<U>&) const noexcept { return true; }
+};
+
+}   /* namespace */
+
+/* n random entries: one insert at a time into std::map, one sort for nuo_flat_map */
+void bench::Bench_Nuo_Flat_Map::bench_build() {
+    for (size_t base : sizes) {
+        const size_t n = base * bench::scale();
+        const Entries e = random_entries(n, 80);
+        std::string s = "build/std::map/" + std::to_string(n);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                std::map<uint64_t, uint64_t> m;
+                for (const auto& p : e)
+                    m.emplace(p.first, p.second);
+                bench::do_not_optimize(m.size());
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+        s = "build/nuo_flat_map/" + std::to_string(n);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuo_flat_map<uint64_t, uint64_t> m(e.begin(), e.end());
+                bench::do_not_optimize(m.size());
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+/*
+ * Lookups of present keys in random order: a tree walk, std::lower_bound
+ * over the flat keys, and the branchless search of nuo_flat_map.
+ */
+void bench::Bench_Nuo_Flat_Map::bench_find() {
+    const size_t m = size_t(1) << 16;
+    for (size_t base : sizes) {
+        const size_t n = base * bench::scale();
+        const Entries e = random_entries(n, 81);
+        const std::vector<uint64_t> q = queries(e, m, 82);
+        std::string s = "find/std::map/" + std::to_string(n);
+        if (bench::enabled(s.c_str())) {
+            std::map<uint64_t, uint64_t> tree;
+            for (const auto& p : e)
+                tree.emplace(p.first, p.second);
+            double ns = bench::measure_ns([&] {
+                uint64_t r = 0;
+                for (uint64_t k : q)
+                    r += tree.find(k)->second;
+                bench::do_not_optimize(r);
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(m));
+        }
+        nuo_flat_map<uint64_t, uint64_t> flat(e.begin(), e.end());
+        s = "find/std::lower_bound/" + std::to_string(n);
+        if (bench::enabled(s.c_str())) {
+            const std::vector<uint64_t>& keys = flat.keys();
+            const std::vector<uint64_t>& values = flat.values();
+            double ns = bench::measure_ns([&] {
+                uint64_t r = 0;
+                for (uint64_t k : q)
+                    r += values[std::lower_bound(keys.begin(), keys.end(), k) - keys.begin()];
+                bench::do_not_optimize(r);
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(m));
+        }
+        s = "find/nuo_flat_map/" + std::to_string(n);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                uint64_t r = 0;
+                for (uint64_t k : q)
+                    r += flat.find(k)->second;
+                bench::do_not_optimize(r);
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(m));
+        }
+    }
+}
+
+/*
+ * Request-sized groups of 32 random keys, about half of them present,
+ * looked up one find at a time and with find_batch / contains_batch. The
+ * 2^24 keys (128 MiB, plus as much in values) are past the LLC of
+ * current servers, where the interleaved searches overlap their misses.
+ * Keys are generated in order, so the map adopts them without sorting.
+ */
+void bench::Bench_Nuo_Flat_Map::bench_find_batch() {
+    using It = nuo_flat_map<uint64_t, uint64_t>::const_iterator;
+    const size_t group = 32;
+    const size_t m = size_t(1) << 16;
+    for (size_t n : {size_t(1) << 16, (size_t(1) << 24) * bench::scale()}) {
+        std::vector<uint64_t> keys(n), values(n);
+        for (size_t i = 0; i < n; i++)
+            keys[i] = 2 * i, values[i] = i;
+        const nuo_flat_map<uint64_t, uint64_t> flat(nuostl::nuo_sorted_unique, std::move(keys),
+                                                    std::move(values));
+        std::vector<uint64_t> q = bench::random_vector<uint64_t>(m, 85);
+        for (uint64_t& k : q)
+            k %= 2 * n;
+
+        std::string s = "find_batch/find_loop/" + std::to_string(n);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                uint64_t r = 0;
+                for (uint64_t k : q) {
+                    auto it = flat.find(k);
+                    r += it != flat.end() ? it->second : 0;
+                }
+                bench::do_not_optimize(r);
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(m));
+        }
+        s = "find_batch/nuo_flat_map/" + std::to_string(n);
+        if (bench::enabled(s.c_str())) {
+            std::vector<nuo_pair<size_t, It>> out(group);
+            double ns = bench::measure_ns([&] {
+                uint64_t r = 0;
+                for (size_t i = 0; i < m; i += group) {
+                    auto hits = flat.find_batch(std::span<const uint64_t>(q.data() + i, group), out);
+                    for (const auto& h : hits)
+                        r += h.second->second;
+                }
+                bench::do_not_optimize(r);
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(m));
+        }
+        s = "contains_batch/nuo_flat_map/" + std::to_string(n);
+        if (bench::enabled(s.c_str())) {
+            bool found[group];
+            double ns = bench::measure_ns([&] {
+                size_t r = 0;
+                for (size_t i = 0; i < m; i += group)
+                    r += flat.contains_batch(std::span<const uint64_t>(q.data() + i, group), found);
+                bench::do_not_optimize(r);
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(m));
+        }
+    }
+}
+
+/*
+ * n entries arriving in 16 batches: element by element into std::map and
+ * (up to 64K entries) nuo_flat_map, against a sort and a merge per batch
+ * with nuo_flat_map's range insert.
+ */
+void bench::Bench_Nuo_Flat_Map::bench_batch_insert() {
+    for (size_t base : sizes) {
+        const size_t n = base * bench::scale();
+        const size_t b = n / 16;
+        const Entries e = random_entries(n, 83);
+        std::string s = "batch_insert/std::map/" + std::to_string(n);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                std::map<uint64_t, uint64_t> m;
+                for (const auto& p : e)
+                    m.emplace(p.first, p.second);
+                bench::do_not_optimize(m.size());
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+        s = "batch_insert/nuo_flat_map/one_by_one/" + std::to_string(n);
+        if (n <= (size_t(1) << 16) && bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuo_flat_map<uint64_t, uint64_t> m;
+                for (const auto& p : e)
+                    m.insert(p);
+                bench::do_not_optimize(m.size());
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+        s = "batch_insert/nuo_flat_map/" + std::to_string(n);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                nuo_flat_map<uint64_t, uint64_t> m;
+                for (size_t i = 0; i < n; i += b)
+                    m.insert(e.begin() + i, e.begin() + i + b);
+                bench::do_not_optimize(m.size());
+            });
+            bench::report(s.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+/* Bytes per entry of 8-byte keys and values, 16 of them payload */
+void bench::Bench_Nuo_Flat_Map::bench_memory() {
+    const size_t n = (size_t(1) << 20) * bench::scale();
+    const Entries e = random_entries(n, 84);
+    if (bench::enabled("memory/std::map")) {
+        live_bytes = 0;
+        std::map<uint64_t, uint64_t, std::less<uint64_t>,
+                 Counting_Allocator<std::pair<const uint64_t, uint64_t>>> m;
+        for (const auto& p : e)
+            m.emplace(p.first, p.second);
+        printf("%-44s %12zu %14.1f B/entry\n", "memory/std::map", m.size(),
+               static_cast<double>(live_bytes) / static_cast<double>(m.size()));
+    }
+    if (bench::enabled("memory/nuo_flat_map")) {
+        nuo_flat_map<uint64_t, uint64_t> m(e.begin(), e.end());
+        const size_t bytes = m.keys().capacity() * sizeof(uint64_t) +
+                             m.values().capacity() * sizeof(uint64_t);
+        printf("%-44s %12zu %14.1f B/entry\n", "memory/nuo_flat_map", m.size(),
+               static_cast<double>(bytes) / static_cast<double>(m.size()));
+    }
+    fflush(stdout);
+}
+
+void bench::Bench_Nuo_Flat_Map::bench_nuo_flat_map() {
+    bench_build();
+    bench_find();
+    bench_find_batch();
+    bench_batch_insert();
+    bench_memory();
+}
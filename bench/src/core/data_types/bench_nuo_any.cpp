@@ -0,0 +1,69 @@
+#include "./core/data_types/bench_nuo_any.hpp"
+
+#include <stdint.h>
+
+#include <any>
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_any;
+
+/*
+ * Copy an array of type-erased values into another and read them back.
+ * A 16-byte trivially copyable payload stays in nuo_any's buffer and
+ * copies with a memcpy, libstdc++'s std::any stores only pointer-sized
+ * values inline and allocates for it. int is inline for both.
+ */
+
+namespace {
+
+struct Pod16 {
+    int64_t a, b;
+};
+
+template<typename Any, typename T, typename Cast>
+void copy(const char* name, size_t n, T value, Cast cast) {
+    if (!bench::enabled(name))
+        return;
+    std::vector<Any> src(n, Any(value)), dst(n);
+    double ns = bench::measure_ns([&] {
+        for (size_t i = 0; i < n; i++)
+            dst[i] = src[i];
+        int64_t sum = 0;
+        for (size_t i = 0; i < n; i++)
+            sum += cast(dst[i]);
+        bench::do_not_optimize(sum);
+    });
+    bench::report(name, n, ns, static_cast<double>(n));
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Any::bench_copy() {
+    const size_t n = (1u << 14) * bench::scale();
+    copy<nuo_any>("nuo_any/copy_int", n, 1, [](const nuo_any& a) {
+        return *nuostl::nuo_any_cast<int>(&a);
+    });
+    copy<std::any>("std::any/copy_int", n, 1, [](const std::any& a) {
+        return *std::any_cast<int>(&a);
+    });
+    copy<nuo_any>("nuo_any/copy_pod16", n, Pod16{1, 2}, [](const nuo_any& a) {
+        return nuostl::nuo_any_cast<Pod16>(&a)->b;
+    });
+    copy<std::any>("std::any/copy_pod16", n, Pod16{1, 2}, [](const std::any& a) {
+        return std::any_cast<Pod16>(&a)->b;
+    });
+    copy<nuo_any>("nuo_any/copy_string", n, std::string(40, 's'), [](const nuo_any& a) {
+        return static_cast<int64_t>(nuostl::nuo_any_cast<std::string>(&a)->size());
+    });
+    copy<std::any>("std::any/copy_string", n, std::string(40, 's'), [](const std::any& a) {
+        return static_cast<int64_t>(std::any_cast<std::string>(&a)->size());
+    });
+}
+
+void bench::Bench_Nuo_Any::bench_nuo_any() {
+    bench_copy();
+}
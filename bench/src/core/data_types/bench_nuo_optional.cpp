@@ -0,0 +1,63 @@
+#include "./core/data_types/bench_nuo_optional.hpp"
+
+#include <stdint.h>
+
+#include <optional>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::idx_t;
+using nuostl::nuo_idx_niche;
+using nuostl::nuo_optional;
+
+/*
+ * Sum of the engaged values of an array where one in eight is empty. The
+ * niche-packed nuo_optional<double> and nuo_optional<idx_t, nuo_idx_niche>
+ * take 8 bytes per element, std::optional 16, so out of cache the scan
+ * moves half the memory.
+ */
+
+namespace {
+
+template<typename Opt, typename T>
+std::vector<Opt> sparse(size_t n) {
+    std::vector<int> r = bench::random_vector<int>(n);
+    std::vector<Opt> v(n);
+    for (size_t i = 0; i < n; i++) {
+        if (r[i] & 7)
+            v[i] = static_cast<T>(r[i] & 0xffff);
+    }
+    return v;
+}
+
+template<typename Opt, typename T>
+void scan(const char* name, size_t n) {
+    if (!bench::enabled(name))
+        return;
+    std::vector<Opt> v = sparse<Opt, T>(n);
+    double ns = bench::measure_ns([&] {
+        T sum = 0;
+        for (const Opt& o : v) {
+            if (o.has_value())
+                sum += *o;
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::report(name, n, ns, static_cast<double>(n));
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Optional::bench_scan() {
+    const size_t n = (1u << 22) * bench::scale();
+    scan<nuo_optional<double>, double>("nuo_optional/scan_double", n);
+    scan<std::optional<double>, double>("std::optional/scan_double", n);
+    scan<nuo_optional<idx_t, nuo_idx_niche>, idx_t>("nuo_optional/scan_idx", n);
+    scan<std::optional<idx_t>, idx_t>("std::optional/scan_idx", n);
+}
+
+void bench::Bench_Nuo_Optional::bench_nuo_optional() {
+    bench_scan();
+}
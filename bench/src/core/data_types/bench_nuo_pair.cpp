@@ -0,0 +1,88 @@
+#include "./core/data_types/bench_nuo_pair.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_pair;
+
+namespace {
+
+std::vector<nuo_pair<int, int>> random_pairs(size_t n) {
+    std::vector<int> keys = bench::random_vector<int>(2 * n);
+    std::vector<nuo_pair<int, int>> v(n);
+    for (size_t i = 0; i < n; i++) {
+        /* narrow first component so ties on first are common */
+        v[i] = nuo_pair<int, int>(keys[2 * i] & 0xff, keys[2 * i + 1]);
+    }
+    return v;
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Pair::bench_compare() {
+    const size_t n = (1u << 16) * bench::scale();
+    std::vector<nuo_pair<int, int>> src = random_pairs(n);
+
+    if (bench::enabled("nuo_pair/sort")) {
+        std::vector<nuo_pair<int, int>> v;
+        double ns = bench::measure_ns([&] {
+            v = src;
+            std::sort(v.begin(), v.end());
+            bench::do_not_optimize(v.front());
+        });
+        bench::report("nuo_pair/sort", n, ns, static_cast<double>(n));
+    }
+
+    if (bench::enabled("std::pair/sort")) {
+        std::vector<std::pair<int, int>> ssrc(n), v;
+        for (size_t i = 0; i < n; i++)
+            ssrc[i] = {src[i].first, src[i].second};
+        double ns = bench::measure_ns([&] {
+            v = ssrc;
+            std::sort(v.begin(), v.end());
+            bench::do_not_optimize(v.front());
+        });
+        bench::report("std::pair/sort", n, ns, static_cast<double>(n));
+    }
+}
+
+void bench::Bench_Nuo_Pair::bench_arithmetic() {
+    if (!bench::enabled("nuo_pair/accumulate"))
+        return;
+    const size_t n = (1u << 20) * bench::scale();
+    std::vector<nuo_pair<int, int>> v = random_pairs(n);
+    double ns = bench::measure_ns([&] {
+        nuo_pair<int, int> sum;
+        for (const auto& p : v)
+            sum += p;
+        bench::do_not_optimize(sum);
+    });
+    bench::report("nuo_pair/accumulate", n, ns, static_cast<double>(n));
+}
+
+void bench::Bench_Nuo_Pair::bench_min_max() {
+    const size_t n = (1u << 20) * bench::scale();
+    std::vector<nuo_pair<int, int>> v = random_pairs(n);
+    if (bench::enabled("nuo_pair/nuo_min")) {
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(nuostl::nuo_min(v.begin(), v.end()));
+        });
+        bench::report("nuo_pair/nuo_min", n, ns, static_cast<double>(n));
+    }
+    if (bench::enabled("nuo_pair/nuo_max")) {
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(nuostl::nuo_max(v.begin(), v.end()));
+        });
+        bench::report("nuo_pair/nuo_max", n, ns, static_cast<double>(n));
+    }
+}
+
+void bench::Bench_Nuo_Pair::bench_nuo_pair() {
+    bench_compare();
+    bench_arithmetic();
+    bench_min_max();
+}
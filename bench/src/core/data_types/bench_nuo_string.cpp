@@ -0,0 +1,239 @@
+#include "./core/data_types/bench_nuo_string.hpp"
+
+#include <math.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_string;
+
+namespace {
+
+/*
+ * Key length distributions. There is no trace shipped with the repo, the
+ * shapes follow what key-value and log workloads typically look like:
+ *   ids    8..16 bytes, numeric ids and short hashes
+ *   kv     mostly below 24 bytes with a tail up to 128 (cache keys)
+ *   uuid   36 bytes
+ *   paths  log-normal around 40 bytes, URL paths / file names
+ */
+struct KeyDist {
+    const char* name;
+    size_t (*draw)(std::mt19937_64&);
+};
+
+size_t draw_ids(std::mt19937_64& rng) { return 8 + rng() % 9; }
+
+size_t draw_kv(std::mt19937_64& rng) {
+    unsigned r = rng() % 100;
+    if (r < 70) return 4 + rng() % 19;
+    if (r < 90) return 23 + rng() % 18;
+    return 41 + rng() % 88;
+}
+
+size_t draw_uuid(std::mt19937_64&) { return 36; }
+
+size_t draw_paths(std::mt19937_64& rng) {
+    std::lognormal_distribution<double> d(3.5, 0.6);
+    double v = d(rng);
+    return static_cast<size_t>(v < 1 ? 1 : (v > 512 ? 512 : v));
+}
+
+const KeyDist dists[] = {
+    {"ids", draw_ids},
+    {"kv", draw_kv},
+    {"uuid", draw_uuid},
+    {"paths", draw_paths},
+};
+
+std::vector<std::string> make_keys(const KeyDist& d, size_t n) {
+    std::mt19937_64 rng(1234);
+    std::vector<std::string> keys(n);
+    for (auto& k : keys) {
+        k.resize(d.draw(rng));
+        for (auto& c : k)
+            c = static_cast<char>('a' + rng() % 26);
+    }
+    return keys;
+}
+
+std::string name_of(const char* op, const char* type, const KeyDist& d) {
+    return std::string(type) + "/" + op + "/" + d.name;
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_String::bench_construct() {
+    const size_t n = (1u << 15) * bench::scale();
+    for (const KeyDist& d : dists) {
+        std::vector<std::string> keys = make_keys(d, n);
+        std::string nn = name_of("construct", "nuo_string", d);
+        if (bench::enabled(nn.c_str())) {
+            double ns = bench::measure_ns([&] {
+                std::vector<nuo_string> v;
+                v.reserve(n);
+                for (const auto& k : keys)
+                    v.emplace_back(k.data(), k.size());
+                bench::do_not_optimize(v.back());
+            });
+            bench::report(nn.c_str(), n, ns, static_cast<double>(n));
+        }
+        std::string sn = name_of("construct", "std::string", d);
+        if (bench::enabled(sn.c_str())) {
+            double ns = bench::measure_ns([&] {
+                std::vector<std::string> v;
+                v.reserve(n);
+                for (const auto& k : keys)
+                    v.emplace_back(k.data(), k.size());
+                bench::do_not_optimize(v.back());
+            });
+            bench::report(sn.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+void bench::Bench_Nuo_String::bench_equal() {
+    const size_t n = (1u << 15) * bench::scale();
+    for (const KeyDist& d : dists) {
+        std::vector<std::string> keys = make_keys(d, n);
+        /* every other probe equal, the rest differ in the last byte */
+        std::vector<std::string> probes(keys);
+        for (size_t i = 1; i < n; i += 2)
+            probes[i].back() ^= 1;
+
+        std::vector<nuo_string> nk, np;
+        for (size_t i = 0; i < n; i++) {
+            nk.emplace_back(keys[i].data(), keys[i].size());
+            np.emplace_back(probes[i].data(), probes[i].size());
+        }
+
+        std::string nn = name_of("equal", "nuo_string", d);
+        if (bench::enabled(nn.c_str())) {
+            double ns = bench::measure_ns([&] {
+                size_t hits = 0;
+                for (size_t i = 0; i < n; i++)
+                    hits += nk[i] == np[i];
+                bench::do_not_optimize(hits);
+            });
+            bench::report(nn.c_str(), n, ns, static_cast<double>(n));
+        }
+        std::string sn = name_of("equal", "std::string", d);
+        if (bench::enabled(sn.c_str())) {
+            double ns = bench::measure_ns([&] {
+                size_t hits = 0;
+                for (size_t i = 0; i < n; i++)
+                    hits += keys[i] == probes[i];
+                bench::do_not_optimize(hits);
+            });
+            bench::report(sn.c_str(), n, ns, static_cast<double>(n));
+        }
+
+        std::string ns_name = name_of("sort", "nuo_string", d);
+        if (bench::enabled(ns_name.c_str())) {
+            std::vector<nuo_string> v;
+            double ns = bench::measure_ns([&] {
+                v = nk;
+                std::sort(v.begin(), v.end());
+                bench::do_not_optimize(v.front());
+            });
+            bench::report(ns_name.c_str(), n, ns, static_cast<double>(n));
+        }
+        std::string ss_name = name_of("sort", "std::string", d);
+        if (bench::enabled(ss_name.c_str())) {
+            std::vector<std::string> v;
+            double ns = bench::measure_ns([&] {
+                v = keys;
+                std::sort(v.begin(), v.end());
+                bench::do_not_optimize(v.front());
+            });
+            bench::report(ss_name.c_str(), n, ns, static_cast<double>(n));
+        }
+    }
+}
+
+void bench::Bench_Nuo_String::bench_find() {
+    /* "rare": the first needle byte never occurs in the haystack, the best
+     * case for memchr based searches; "common": it occurs every 23 bytes */
+    const char* needles[2][2] = {{"rare", "NEEDLE"}, {"common", "aNEEDLE"}};
+    const size_t sizes[] = {64, 4096, 1u << 20};
+    for (size_t n : sizes) {
+        std::string h(n, 'a');
+        for (size_t i = 0; i < n; i++)
+            h[i] = static_cast<char>('a' + (i * 7) % 23);
+        h.replace(n - 9, 9, "XaNEEDLEX");
+        nuo_string nh(h.data(), h.size());
+        std::string label = std::to_string(n);
+
+        std::string nc = std::string("nuo_string/find_char/").append(label);
+        if (bench::enabled(nc.c_str())) {
+            double ns = bench::measure_ns([&] {
+                bench::do_not_optimize(nh.find('X'));
+            });
+            bench::report(nc.c_str(), n, ns, static_cast<double>(n), "GB/s");
+        }
+        std::string sc = std::string("std::string/find_char/").append(label);
+        if (bench::enabled(sc.c_str())) {
+            double ns = bench::measure_ns([&] {
+                bench::do_not_optimize(h.find('X'));
+            });
+            bench::report(sc.c_str(), n, ns, static_cast<double>(n), "GB/s");
+        }
+
+        for (const auto& nd : needles) {
+            const char* needle = nd[1];
+            std::string suffix = std::string(nd[0]) + "/" + label;
+            std::string nn = "nuo_string/find_str_" + suffix;
+            if (bench::enabled(nn.c_str())) {
+                double ns = bench::measure_ns([&] {
+                    bench::do_not_optimize(nh.find(needle));
+                });
+                bench::report(nn.c_str(), n, ns, static_cast<double>(n),
+                              "GB/s");
+            }
+            std::string sn = "std::string/find_str_" + suffix;
+            if (bench::enabled(sn.c_str())) {
+                double ns = bench::measure_ns([&] {
+                    bench::do_not_optimize(h.find(needle));
+                });
+                bench::report(sn.c_str(), n, ns, static_cast<double>(n),
+                              "GB/s");
+            }
+        }
+    }
+}
+
+void bench::Bench_Nuo_String::bench_append() {
+    const size_t n = (1u << 20) * bench::scale();
+    if (bench::enabled("nuo_string/append_grow")) {
+        double ns = bench::measure_ns([&] {
+            nuo_string s;
+            for (size_t i = 0; i < n; i += 16)
+                s.append("0123456789abcdef", 16);
+            bench::do_not_optimize(s.size());
+        });
+        bench::report("nuo_string/append_grow", n, ns,
+                      static_cast<double>(n), "GB/s");
+    }
+    if (bench::enabled("std::string/append_grow")) {
+        double ns = bench::measure_ns([&] {
+            std::string s;
+            for (size_t i = 0; i < n; i += 16)
+                s.append("0123456789abcdef", 16);
+            bench::do_not_optimize(s.size());
+        });
+        bench::report("std::string/append_grow", n, ns,
+                      static_cast<double>(n), "GB/s");
+    }
+}
+
+void bench::Bench_Nuo_String::bench_nuo_string() {
+    bench_construct();
+    bench_equal();
+    bench_find();
+    bench_append();
+}
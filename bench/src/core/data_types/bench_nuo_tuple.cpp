@@ -0,0 +1,85 @@
+#include "./core/data_types/bench_nuo_tuple.hpp"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_tuple;
+
+/*
+ * Arrays of <char, double, char> records: 16 bytes each as nuo_tuple, 24 as
+ * std::tuple. The scan is bandwidth bound once the array leaves the cache,
+ * the sort moves whole records.
+ */
+
+namespace {
+
+template<typename Tuple>
+std::vector<Tuple> random_records(size_t n) {
+    std::vector<int> keys = bench::random_vector<int>(2 * n);
+    std::vector<Tuple> v(n);
+    for (size_t i = 0; i < n; i++) {
+        std::get<0>(v[i]) = static_cast<char>(keys[2 * i] & 0x7f);
+        std::get<1>(v[i]) = static_cast<double>(keys[2 * i + 1]);
+        std::get<2>(v[i]) = static_cast<char>((keys[2 * i] >> 8) & 0x7f);
+    }
+    return v;
+}
+
+template<typename Tuple>
+void scan(const char* name, size_t n) {
+    if (!bench::enabled(name))
+        return;
+    std::vector<Tuple> v = random_records<Tuple>(n);
+    double ns = bench::measure_ns([&] {
+        double sum = 0;
+        int64_t tags = 0;
+        for (const Tuple& t : v) {
+            sum += std::get<1>(t);
+            tags += std::get<0>(t) ^ std::get<2>(t);
+        }
+        bench::do_not_optimize(sum);
+        bench::do_not_optimize(tags);
+    });
+    bench::report(name, n, ns, static_cast<double>(n));
+}
+
+template<typename Tuple>
+void sort(const char* name, size_t n) {
+    if (!bench::enabled(name))
+        return;
+    std::vector<Tuple> src = random_records<Tuple>(n), v;
+    double ns = bench::measure_ns([&] {
+        v = src;
+        std::sort(v.begin(), v.end(), [](const Tuple& a, const Tuple& b) {
+            return std::get<1>(a) < std::get<1>(b);
+        });
+        bench::do_not_optimize(v.front());
+    });
+    bench::report(name, n, ns, static_cast<double>(n));
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Tuple::bench_scan() {
+    for (size_t n : {size_t(1) << 12, (size_t(1) << 22) * bench::scale()}) {
+        scan<nuo_tuple<char, double, char>>(n < 65536 ? "nuo_tuple/scan_l1" : "nuo_tuple/scan", n);
+        scan<std::tuple<char, double, char>>(n < 65536 ? "std::tuple/scan_l1" : "std::tuple/scan", n);
+    }
+}
+
+void bench::Bench_Nuo_Tuple::bench_sort() {
+    const size_t n = (1u << 18) * bench::scale();
+    sort<nuo_tuple<char, double, char>>("nuo_tuple/sort", n);
+    sort<std::tuple<char, double, char>>("std::tuple/sort", n);
+}
+
+void bench::Bench_Nuo_Tuple::bench_nuo_tuple() {
+    bench_scan();
+    bench_sort();
+}
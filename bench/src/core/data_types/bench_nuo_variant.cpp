@@ -0,0 +1,139 @@
+#include "./core/data_types/bench_nuo_variant.hpp"
+
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_variant;
+
+/*
+ * Event dispatch: a vector of variants over K small event types, each
+ * visited once with a visitor that folds the event into a checksum. The
+ * alternatives are random so the dispatch branch is unpredictable, which
+ * is the common case for mixed event streams. visit2 visits pairs of
+ * variants (K * K combinations). libstdc++ 12 also lowers std::visit to a
+ * jump table, so with gcc the two should run level; the difference shows
+ * against function-pointer dispatch elsewhere.
+ */
+
+namespace {
+
+template<size_t I>
+struct Event {
+    uint32_t payload;
+};
+
+struct Fold {
+    template<size_t I>
+    uint64_t operator()(const Event<I>& e) const {
+        return (e.payload ^ I) * (2 * I + 1);
+    }
+
+    template<size_t I, size_t J>
+    uint64_t operator()(const Event<I>& a, const Event<J>& b) const {
+        return (a.payload + b.payload) * (I + 1) ^ J;
+    }
+};
+
+template<template<typename...> class V, size_t... I>
+V<Event<I>...> variant_of(std::index_sequence<I...>);
+
+template<template<typename...> class V, size_t K>
+using events = decltype(variant_of<V>(std::make_index_sequence<K>{}));
+
+template<typename Var, size_t K>
+std::vector<Var> random_events(size_t n) {
+    std::vector<int> r = bench::random_vector<int>(n);
+    std::vector<Var> v(n);
+    for (size_t i = 0; i < n; i++) {
+        uint32_t x = static_cast<uint32_t>(r[i]);
+        [&]<size_t... J>(std::index_sequence<J...>) {
+            ((x % K == J ? (v[i] = Var(Event<J>{x >> 8}), 0) : 0), ...);
+        }(std::make_index_sequence<K>{});
+    }
+    return v;
+}
+
+std::string name_k(const char* base, size_t k) {
+    return std::string(base) + "/" + std::to_string(k);
+}
+
+template<size_t K>
+void run_visit(size_t n) {
+    std::string name = name_k("nuo_variant/visit", K);
+    if (bench::enabled(name.c_str())) {
+        std::vector<events<nuo_variant, K>> v = random_events<events<nuo_variant, K>, K>(n);
+        double ns = bench::measure_ns([&] {
+            uint64_t sum = 0;
+            for (const auto& e : v)
+                sum += nuostl::nuo_visit(Fold{}, e);
+            bench::do_not_optimize(sum);
+        });
+        bench::report(name.c_str(), n, ns, static_cast<double>(n));
+    }
+    name = name_k("std::variant/visit", K);
+    if (bench::enabled(name.c_str())) {
+        std::vector<events<std::variant, K>> v = random_events<events<std::variant, K>, K>(n);
+        double ns = bench::measure_ns([&] {
+            uint64_t sum = 0;
+            for (const auto& e : v)
+                sum += std::visit(Fold{}, e);
+            bench::do_not_optimize(sum);
+        });
+        bench::report(name.c_str(), n, ns, static_cast<double>(n));
+    }
+}
+
+template<size_t K>
+void run_visit2(size_t n) {
+    std::string name = name_k("nuo_variant/visit2", K);
+    if (bench::enabled(name.c_str())) {
+        std::vector<events<nuo_variant, K>> v = random_events<events<nuo_variant, K>, K>(n + 1);
+        double ns = bench::measure_ns([&] {
+            uint64_t sum = 0;
+            for (size_t i = 0; i < n; i++)
+                sum += nuostl::nuo_visit(Fold{}, v[i], v[i + 1]);
+            bench::do_not_optimize(sum);
+        });
+        bench::report(name.c_str(), n, ns, static_cast<double>(n));
+    }
+    name = name_k("std::variant/visit2", K);
+    if (bench::enabled(name.c_str())) {
+        std::vector<events<std::variant, K>> v = random_events<events<std::variant, K>, K>(n + 1);
+        double ns = bench::measure_ns([&] {
+            uint64_t sum = 0;
+            for (size_t i = 0; i < n; i++)
+                sum += std::visit(Fold{}, v[i], v[i + 1]);
+            bench::do_not_optimize(sum);
+        });
+        bench::report(name.c_str(), n, ns, static_cast<double>(n));
+    }
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Variant::bench_visit() {
+    const size_t n = (1u << 16) * bench::scale();
+    run_visit<2>(n);
+    run_visit<4>(n);
+    run_visit<16>(n);
+    run_visit<64>(n);
+}
+
+void bench::Bench_Nuo_Variant::bench_visit2() {
+    const size_t n = (1u << 16) * bench::scale();
+    run_visit2<4>(n);
+    run_visit2<8>(n);
+    run_visit2<16>(n);
+}
+
+void bench::Bench_Nuo_Variant::bench_nuo_variant() {
+    bench_visit();
+    bench_visit2();
+}
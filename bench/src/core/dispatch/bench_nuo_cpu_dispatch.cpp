@@ -0,0 +1,74 @@
+#include "./core/dispatch/bench_nuo_cpu_dispatch.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_isa;
+
+namespace {
+
+__attribute__((noinline)) int add_one(int x) { return x + 1; }
+
+template<typename T>
+void run_minmax(const char* type, size_t n) {
+    std::vector<T> v = bench::random_vector<T>(n);
+    const nuo_isa hw = nuostl::nuo_cpu_detect().isa;
+    for (unsigned level = 0; level <= static_cast<unsigned>(hw); level++) {
+        nuo_isa isa = static_cast<nuo_isa>(level);
+        std::string name = std::string("nuo_min/") + type + "/" +
+            nuostl::nuo_isa_name(isa);
+        if (!bench::enabled(name.c_str()))
+            continue;
+        nuostl::nuo_cpu_force_isa(isa);
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(nuostl::nuo_min(v.begin(), v.end()));
+        });
+        bench::report(name.c_str(), n, ns, static_cast<double>(n));
+    }
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Cpu_Dispatch::bench_dispatch_overhead() {
+    static const auto d = nuostl::nuo_dispatcher<int(int)>(&add_one);
+    const size_t n = 1u << 20;
+    if (bench::enabled("nuo_dispatcher/call")) {
+        double ns = bench::measure_ns([&] {
+            int x = 0;
+            for (size_t i = 0; i < n; i++)
+                x = d(x);
+            bench::do_not_optimize(x);
+        });
+        bench::report("nuo_dispatcher/call", n, ns, static_cast<double>(n));
+    }
+    if (bench::enabled("nuo_dispatcher/direct")) {
+        double ns = bench::measure_ns([&] {
+            int x = 0;
+            for (size_t i = 0; i < n; i++)
+                x = add_one(x);
+            bench::do_not_optimize(x);
+        });
+        bench::report("nuo_dispatcher/direct", n, ns, static_cast<double>(n));
+    }
+}
+
+void bench::Bench_Nuo_Cpu_Dispatch::bench_minmax_per_isa() {
+    const nuo_isa saved = nuostl::nuo_cpu_isa();
+    const size_t n = (1u << 20) * bench::scale();
+    run_minmax<uint8_t>("uint8", n);
+    run_minmax<int32_t>("int32", n);
+    run_minmax<int64_t>("int64", n);
+    nuostl::nuo_cpu_force_isa(saved);
+}
+
+void bench::Bench_Nuo_Cpu_Dispatch::bench_nuo_cpu_dispatch() {
+    printf("# cpu: %s\n", nuostl::nuo_isa_name(nuostl::nuo_cpu_isa()));
+    bench_dispatch_overhead();
+    bench_minmax_per_isa();
+}
@@ -0,0 +1,112 @@
+#include "./core/execution/bench_nuo_scheduler.hpp"
+
+#include <math.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_scheduler;
+using nuostl::nuo_scheduler_options;
+
+namespace {
+
+/*
+ * Scaling from one thread to every allowed CPU: each benchmark runs once
+ * per thread count t in 1, 2, 4, ..., N (and N itself), the global
+ * scheduler being rebuilt with t threads in between; the name carries
+ * "/t=<t>". The rate at t divided by the rate at 1 is the speedup.
+ *
+ * - fork_join: an uncut fib(n) recursion, one task per call, measures the
+ *   fork and join overhead and how fast the work spreads;
+ * - compute: a loop of a few hundred flops per element, which should
+ *   scale with the cores;
+ * - memory: nuo_fill, nuo_copy and nuo_min over 256 MiB, which scale
+ *   with the memory bandwidth the threads can reach (see the scatter
+ *   affinity on NUMA machines).
+ */
+
+std::vector<size_t> thread_counts() {
+    const size_t cpus = nuostl::detail::nuo_allowed_cpus().size();
+    std::vector<size_t> t;
+    for (size_t n = 1; n < cpus; n *= 2)
+        t.push_back(n);
+    t.push_back(cpus);
+    return t;
+}
+
+template<typename F>
+void scaling(const char* op, size_t n, double per_call, const char* unit, F&& f) {
+    const nuo_scheduler_options saved = nuo_scheduler::global().options();
+    for (size_t t : thread_counts()) {
+        std::string name = std::string(op) + "/t=" + std::to_string(t);
+        if (!bench::enabled(name.c_str()))
+            continue;
+        nuostl::nuo_set_num_threads(t);
+        double ns = bench::measure_ns(f);
+        bench::report(name.c_str(), n, ns, per_call, unit);
+    }
+    nuostl::nuo_set_scheduler_options(saved);
+}
+
+uint64_t fib(unsigned n) {
+    if (n < 2)
+        return n;
+    uint64_t a = 0, b = 0;
+    nuostl::nuo_parallel_invoke([&] { a = fib(n - 1); }, [&] { b = fib(n - 2); });
+    return a + b;
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Scheduler::bench_fork_join() {
+    /* fib(25) makes 242785 calls */
+    scaling("nuo_parallel_invoke/fib25", 25, 242785.0, "M/s", [] {
+        bench::do_not_optimize(fib(25));
+    });
+}
+
+void bench::Bench_Nuo_Scheduler::bench_compute() {
+    const size_t n = (size_t(1) << 18) * bench::scale();
+    std::vector<double> x = bench::random_vector<double>(n, 42);
+    std::vector<double> y(n);
+    /* 64 Newton steps for the square root, 3 flops each */
+    auto body = [&](size_t i) {
+        double a = fabs(x[i]) + 1.0;
+        double r = a;
+        for (int k = 0; k < 64; k++)
+            r = 0.5 * (r + a / r);
+        y[i] = r;
+    };
+    scaling("nuo_parallel_for/newton", n, static_cast<double>(n), "M/s", [&] {
+        nuostl::nuo_parallel_for(size_t(0), n, body);
+        bench::clobber();
+    });
+}
+
+void bench::Bench_Nuo_Scheduler::bench_memory() {
+    const size_t n = (size_t(1) << 25) * bench::scale();
+    const double bytes = static_cast<double>(n * sizeof(uint64_t));
+    std::vector<uint64_t> a = bench::random_vector<uint64_t>(n, 43);
+    std::vector<uint64_t> b(n, 1);
+    scaling("nuo_fill(par)", n, bytes, "GB/s", [&] {
+        nuostl::nuo_fill(nuostl::nuo_par, b.begin(), b.end(), uint64_t(7));
+        bench::clobber();
+    });
+    scaling("nuo_copy(par)", n, bytes, "GB/s", [&] {
+        nuostl::nuo_copy(nuostl::nuo_par, a.begin(), a.end(), b.begin());
+        bench::clobber();
+    });
+    scaling("nuo_min(par)", n, bytes, "GB/s", [&] {
+        bench::do_not_optimize(nuostl::nuo_min(nuostl::nuo_par, a.begin(), a.end()));
+    });
+}
+
+void bench::Bench_Nuo_Scheduler::bench_nuo_scheduler() {
+    bench_fork_join();
+    bench_compute();
+    bench_memory();
+}
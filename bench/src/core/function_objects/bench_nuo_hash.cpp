@@ -0,0 +1,144 @@
+#include "./core/function_objects/bench_nuo_hash.hpp"
+
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_isa;
+
+namespace {
+
+const size_t lengths[] = {8, 16, 32, 64, 256, 1024, 4096, 65536};
+
+/* 64 KiB of random bytes, hashed as consecutive keys of len bytes */
+template<typename H>
+uint64_t hash_chunks(const std::vector<uint8_t>& buf, size_t len, H hash) {
+    uint64_t r = 0;
+    for (size_t i = 0; i + len <= buf.size(); i += len)
+        r ^= hash(reinterpret_cast<const char*>(buf.data()) + i, len);
+    return r;
+}
+
+/*
+ * Linear probing insert of n keys into 2n slots indexed by the low hash
+ * bits, the way an open addressing table uses its hasher.
+ */
+template<typename H>
+void probe_insert(const std::vector<uint64_t>& keys, std::vector<uint64_t>& slots, H hash) {
+    const size_t mask = slots.size() - 1;
+    for (uint64_t& s : slots)
+        s = 0;
+    for (uint64_t k : keys) {
+        size_t i = hash(k) & mask;
+        while (slots[i] != 0)
+            i = (i + 1) & mask;
+        slots[i] = k;
+    }
+}
+
+}   /* namespace */
+
+/*
+ * Random 64-bit keys hashed one after the other, then keys that are
+ * multiples of 4096 inserted into a linear probing table: the identity
+ * std::hash sends them all to the few slots that are multiples of 4096,
+ * nuo_hash spreads them.
+ */
+void bench::Bench_Nuo_Hash::bench_integers() {
+    const size_t n = (size_t(1) << 20) * bench::scale();
+    const std::vector<uint64_t> v = bench::random_vector<uint64_t>(n, 70);
+    if (bench::enabled("std::hash/uint64")) {
+        double ns = bench::measure_ns([&] {
+            uint64_t r = 0;
+            for (uint64_t x : v)
+                r += std::hash<uint64_t>()(x);
+            bench::do_not_optimize(r);
+        });
+        bench::report("std::hash/uint64", n, ns, static_cast<double>(n));
+    }
+    if (bench::enabled("nuo_hash/uint64")) {
+        double ns = bench::measure_ns([&] {
+            uint64_t r = 0;
+            for (uint64_t x : v)
+                r += nuostl::nuo_hash<uint64_t>()(x);
+            bench::do_not_optimize(r);
+        });
+        bench::report("nuo_hash/uint64", n, ns, static_cast<double>(n));
+    }
+
+    const size_t m = size_t(1) << 14;
+    std::vector<uint64_t> keys(m);
+    for (size_t i = 0; i < m; i++)
+        keys[i] = (i + 1) * 4096;
+    std::vector<uint64_t> slots(2 * m);
+    if (bench::enabled("probe_insert/std::hash/stride4096")) {
+        double ns = bench::measure_ns([&] {
+            probe_insert(keys, slots, std::hash<uint64_t>());
+            bench::clobber();
+        });
+        bench::report("probe_insert/std::hash/stride4096", m, ns, static_cast<double>(m));
+    }
+    if (bench::enabled("probe_insert/nuo_hash/stride4096")) {
+        double ns = bench::measure_ns([&] {
+            probe_insert(keys, slots, nuostl::nuo_hash<uint64_t>());
+            bench::clobber();
+        });
+        bench::report("probe_insert/nuo_hash/stride4096", m, ns, static_cast<double>(m));
+    }
+}
+
+/* Keys of 8 bytes to 64 KiB, against the library's std::hash of a string_view */
+void bench::Bench_Nuo_Hash::bench_bytes() {
+    const std::vector<uint8_t> buf = bench::random_vector<uint8_t>(65536, 71);
+    for (size_t len : lengths) {
+        std::string s = "std::hash/string_view/" + std::to_string(len);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                bench::do_not_optimize(hash_chunks(buf, len, [](const char* p, size_t l) {
+                    return std::hash<std::string_view>()(std::string_view(p, l));
+                }));
+            });
+            bench::report(s.c_str(), len, ns, static_cast<double>(buf.size()), "GB/s");
+        }
+        s = "nuo_hash_bytes/" + std::to_string(len);
+        if (bench::enabled(s.c_str())) {
+            double ns = bench::measure_ns([&] {
+                bench::do_not_optimize(hash_chunks(buf, len, [](const char* p, size_t l) {
+                    return nuostl::nuo_hash_bytes(p, l);
+                }));
+            });
+            bench::report(s.c_str(), len, ns, static_cast<double>(buf.size()), "GB/s");
+        }
+    }
+}
+
+/* The long path at each ISA level */
+void bench::Bench_Nuo_Hash::bench_bytes_per_isa() {
+    const nuo_isa saved = nuostl::nuo_cpu_isa();
+    const nuo_isa hw = nuostl::nuo_cpu_detect().isa;
+    const std::vector<uint8_t> buf = bench::random_vector<uint8_t>(65536, 72);
+    for (unsigned level = 0; level <= static_cast<unsigned>(hw); level++) {
+        nuo_isa isa = static_cast<nuo_isa>(level);
+        std::string s = std::string("nuo_hash_bytes/65536/") + nuostl::nuo_isa_name(isa);
+        if (!bench::enabled(s.c_str()))
+            continue;
+        nuostl::nuo_cpu_force_isa(isa);
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(nuostl::nuo_hash_bytes(buf.data(), buf.size()));
+        });
+        bench::report(s.c_str(), buf.size(), ns, static_cast<double>(buf.size()), "GB/s");
+    }
+    nuostl::nuo_cpu_force_isa(saved);
+}
+
+void bench::Bench_Nuo_Hash::bench_nuo_hash() {
+    bench_integers();
+    bench_bytes();
+    bench_bytes_per_isa();
+}
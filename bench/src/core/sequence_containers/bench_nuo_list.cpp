@@ -0,0 +1,212 @@
+#include "./core/sequence_containers/bench_nuo_list.hpp"
+
+#include <stdint.h>
+
+#include <list>
+#include <random>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_intrusive_list;
+using nuostl::nuo_list;
+using nuostl::nuo_list_hook;
+
+namespace {
+
+/*
+ * Segmented LRU: a miss enters the probation segment, a hit there
+ * promotes the entry to the protected segment, whose overflow is demoted
+ * back to the front of probation; a full cache evicts the back of
+ * probation. Every access moves an entry within or between two lists.
+ * Keys are drawn from 64K with a cubic skew against a capacity of 8K,
+ * about half the accesses hit. Moves are done either by splice or by
+ * erase + insert (one node freed and one allocated), and the cache state
+ * persists across timed calls.
+ */
+
+constexpr uint32_t n_keys = 1u << 16;
+constexpr size_t capacity = 1u << 13;
+constexpr size_t protected_capacity = capacity * 4 / 5;
+
+const std::vector<uint32_t>& trace() {
+    static const std::vector<uint32_t> t = [] {
+        std::mt19937_64 rng(39);
+        std::uniform_real_distribution<double> u(0, 1);
+        std::vector<uint32_t> v((size_t(1) << 20) * bench::scale());
+        for (auto& k : v) {
+            double x = u(rng);
+            k = static_cast<uint32_t>(x * x * x * n_keys);
+        }
+        return v;
+    }();
+    return t;
+}
+
+template<typename List, bool Splice>
+class Slru {
+private:
+    enum : uint8_t { in_none, in_probation, in_protected };
+
+    List probation_;
+    List protected_;
+    std::vector<typename List::iterator> where_;
+    std::vector<uint8_t> segment_;
+
+    /* k at it in from goes to the front of to */
+    void move(List& to, List& from, typename List::iterator it, uint32_t k) {
+        if constexpr (Splice) {
+            to.splice(to.begin(), from, it);
+        } else {
+            from.erase(it);
+            where_[k] = to.insert(to.begin(), k);
+        }
+    }
+public:
+    template<typename... Args>
+    explicit Slru(Args&... args) :
+        probation_(args...), protected_(args...), where_(n_keys), segment_(n_keys, in_none) {}
+
+    bool access(uint32_t k) {
+        switch (segment_[k]) {
+        case in_protected:
+            move(protected_, protected_, where_[k], k);
+            return true;
+        case in_probation:
+            move(protected_, probation_, where_[k], k);
+            segment_[k] = in_protected;
+            if (protected_.size() > protected_capacity) {
+                uint32_t d = protected_.back();
+                move(probation_, protected_, std::prev(protected_.end()), d);
+                segment_[d] = in_probation;
+            }
+            return true;
+        default:
+            if (probation_.size() + protected_.size() == capacity) {
+                segment_[probation_.back()] = in_none;
+                probation_.pop_back();
+            }
+            probation_.push_front(k);
+            where_[k] = probation_.begin();
+            segment_[k] = in_probation;
+            return false;
+        }
+    }
+};
+
+/* The same policy with the links inside a preallocated entry table */
+class Intrusive_Slru {
+private:
+    enum : uint8_t { in_none, in_probation, in_protected };
+
+    struct Entry : nuo_list_hook<> {
+        uint32_t key;
+        uint8_t segment = in_none;
+    };
+
+    std::vector<Entry> entries_;
+    nuo_intrusive_list<Entry> probation_;
+    nuo_intrusive_list<Entry> protected_;
+public:
+    Intrusive_Slru() : entries_(n_keys) {
+        for (uint32_t k = 0; k < n_keys; k++)
+            entries_[k].key = k;
+    }
+
+    ~Intrusive_Slru() {
+        probation_.clear();
+        protected_.clear();
+    }
+
+    bool access(uint32_t k) {
+        Entry& e = entries_[k];
+        switch (e.segment) {
+        case in_protected:
+            protected_.splice(protected_.begin(), protected_, protected_.iterator_to(e));
+            return true;
+        case in_probation:
+            protected_.splice(protected_.begin(), probation_, probation_.iterator_to(e));
+            e.segment = in_protected;
+            if (protected_.size() > protected_capacity) {
+                Entry& d = protected_.back();
+                probation_.splice(probation_.begin(), protected_, protected_.iterator_to(d));
+                d.segment = in_probation;
+            }
+            return true;
+        default:
+            if (probation_.size() + protected_.size() == capacity) {
+                probation_.back().segment = in_none;
+                probation_.pop_back();
+            }
+            probation_.push_front(e);
+            e.segment = in_probation;
+            return false;
+        }
+    }
+};
+
+template<typename Cache>
+void run_lru(const char* name, Cache& cache) {
+    if (!bench::enabled(name))
+        return;
+    const std::vector<uint32_t>& t = trace();
+    double ns = bench::measure_ns([&] {
+        size_t hits = 0;
+        for (uint32_t k : t)
+            hits += cache.access(k);
+        bench::do_not_optimize(hits);
+    });
+    bench::report(name, t.size(), ns, static_cast<double>(t.size()));
+}
+
+template<typename List>
+void fill(const char* name, size_t n) {
+    if (!bench::enabled(name))
+        return;
+    double ns = bench::measure_ns([&] {
+        List l;
+        for (size_t i = 0; i < n; i++)
+            l.push_back(i);
+        bench::do_not_optimize(l.back());
+    });
+    bench::report(name, n, ns, static_cast<double>(n));
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_List::bench_lru() {
+    {
+        Slru<std::list<uint32_t>, false> c;
+        run_lru("std::list/slru_erase_insert", c);
+    }
+    {
+        Slru<std::list<uint32_t>, true> c;
+        run_lru("std::list/slru_splice", c);
+    }
+    {
+        nuo_list<uint32_t>::pool_type pool;
+        Slru<nuo_list<uint32_t>, false> c(pool);
+        run_lru("nuo_list/slru_erase_insert", c);
+    }
+    {
+        nuo_list<uint32_t>::pool_type pool;
+        Slru<nuo_list<uint32_t>, true> c(pool);
+        run_lru("nuo_list/slru_splice", c);
+    }
+    {
+        Intrusive_Slru c;
+        run_lru("nuo_intrusive_list/slru", c);
+    }
+}
+
+void bench::Bench_Nuo_List::bench_fill() {
+    const size_t n = (1u << 16) * bench::scale();
+    fill<std::list<size_t>>("std::list/push_back", n);
+    fill<nuo_list<size_t>>("nuo_list/push_back", n);
+}
+
+void bench::Bench_Nuo_List::bench_nuo_list() {
+    bench_lru();
+    bench_fill();
+}
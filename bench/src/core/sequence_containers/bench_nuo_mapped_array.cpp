@@ -0,0 +1,96 @@
+#include "./core/sequence_containers/bench_nuo_mapped_array.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_map_options;
+using nuostl::nuo_mapped_array;
+
+/*
+ * nuo_min over an int32 column file of 64 MiB times NUOSTL_BENCH_SCALE.
+ * The file was just written, so it sits in the page cache: the numbers
+ * compare the cost of getting the data into the process (read() copy vs
+ * page faults) plus the scan, not the disk.
+ */
+void bench::Bench_Nuo_Mapped_Array::bench_min_column() {
+    const size_t n = (size_t(16) << 20) * bench::scale();
+    const size_t bytes = n * sizeof(int32_t);
+    const char* dir = getenv("TMPDIR");
+    std::string path = std::string(dir ? dir : "/tmp") + "/nuostl_benchXXXXXX";
+    int fd = mkstemp(path.data());
+    if (fd < 0) {
+        perror("nuo_mapped_array bench: mkstemp");
+        return;
+    }
+    {
+        std::vector<int32_t> col = bench::random_vector<int32_t>(n, 30);
+        FILE* f = fdopen(fd, "wb");
+        size_t w = fwrite(col.data(), sizeof(int32_t), n, f);
+        fclose(f);
+        if (w != n) {
+            perror("nuo_mapped_array bench: fwrite");
+            unlink(path.c_str());
+            return;
+        }
+    }
+
+    if (bench::enabled("read_vector/min_int32")) {
+        double ns = bench::measure_ns([&] {
+            std::vector<int32_t> v(n);
+            FILE* f = fopen(path.c_str(), "rb");
+            size_t r = fread(v.data(), sizeof(int32_t), n, f);
+            fclose(f);
+            bench::do_not_optimize(r);
+            bench::do_not_optimize(nuostl::nuo_min(v.begin(), v.end()));
+        });
+        bench::report("read_vector/min_int32", n, ns,
+                      static_cast<double>(bytes), "GB/s");
+    }
+
+    struct Variant {
+        const char* name;
+        bool populate;
+        bool prefetch;
+    };
+    const Variant variants[] = {
+        {"nuo_mapped_array/min_int32", false, false},
+        {"nuo_mapped_array/min_int32_populate", true, false},
+        {"nuo_mapped_array/min_int32_prefetch", false, true},
+    };
+    for (const Variant& var : variants) {
+        if (!bench::enabled(var.name))
+            continue;
+        nuo_map_options opt;
+        opt.populate = var.populate;
+        opt.prefetch_thread = var.prefetch;
+        double ns = bench::measure_ns([&] {
+            nuo_mapped_array<int32_t> m(path.c_str(), opt);
+            bench::do_not_optimize(nuostl::nuo_min(m.begin(), m.end()));
+        });
+        bench::report(var.name, n, ns, static_cast<double>(bytes), "GB/s");
+    }
+
+    /* mapping kept open: the scan alone */
+    if (bench::enabled("nuo_mapped_array/min_int32_mapped")) {
+        nuo_mapped_array<int32_t> m(path.c_str());
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(nuostl::nuo_min(m.begin(), m.end()));
+        });
+        bench::report("nuo_mapped_array/min_int32_mapped", n, ns,
+                      static_cast<double>(bytes), "GB/s");
+    }
+
+    unlink(path.c_str());
+}
+
+void bench::Bench_Nuo_Mapped_Array::bench_nuo_mapped_array() {
+    bench_min_column();
+}
@@ -0,0 +1,282 @@
+#include "./core/sequence_containers/bench_nuo_priority_queue.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_addressable_heap;
+using nuostl::nuo_make_heap;
+using nuostl::nuo_pair;
+using nuostl::nuo_priority_queue;
+using nuostl::nuo_radix_heap;
+
+namespace {
+
+/*
+ * The workload is a deadline queue: events are (deadline, task id) pairs
+ * and the earliest deadline comes out first, hence std::greater. The hold
+ * model keeps the queue at a fixed size and repeatedly takes the earliest
+ * event and schedules it again a random delay later, which is the steady
+ * state of a timer wheel or a discrete event simulation.
+ */
+
+using Event = nuo_pair<uint64_t, uint64_t>;
+using Later = std::greater<Event>;
+using Std_Queue = std::priority_queue<Event, std::vector<Event>, Later>;
+
+constexpr size_t n_delays = 1u << 16;
+
+const std::vector<uint64_t>& delays() {
+    static const std::vector<uint64_t> d = [] {
+        std::vector<uint64_t> v = bench::random_vector<uint64_t>(n_delays, 40);
+        for (uint64_t& x : v)
+            x %= 1u << 20;
+        return v;
+    }();
+    return d;
+}
+
+std::vector<Event> random_events(size_t n) {
+    std::vector<uint64_t> k = bench::random_vector<uint64_t>(n, 41);
+    std::vector<Event> v(n);
+    for (size_t i = 0; i < n; i++)
+        v[i] = Event(k[i] % (1u << 20), i);
+    return v;
+}
+
+/* The earliest event again, later by delay */
+void reschedule(Std_Queue& q, uint64_t delay) {
+    Event e = q.top();
+    q.pop();
+    q.push(Event(e.first + delay, e.second));
+}
+
+template<size_t D>
+void reschedule(nuo_priority_queue<Event, Later, D>& q, uint64_t delay) {
+    const Event& e = q.top();
+    q.replace_top(Event(e.first + delay, e.second));
+}
+
+void reschedule(nuo_addressable_heap<Event, Later>& q, uint64_t delay) {
+    const Event& e = q.top();
+    q.update(q.top_handle(), Event(e.first + delay, e.second));
+}
+
+void reschedule(nuo_radix_heap<uint64_t, uint64_t>& q, uint64_t delay) {
+    Event e = q.top();
+    q.pop();
+    q.push(e.first + delay, e.second);
+}
+
+template<typename Queue>
+void push_pop(const char* name, const std::vector<Event>& v) {
+    if (!bench::enabled(name))
+        return;
+    double ns = bench::measure_ns([&] {
+        Queue q;
+        for (const Event& e : v)
+            q.push(e);
+        uint64_t sum = 0;
+        while (!q.empty()) {
+            sum += q.top().second;
+            q.pop();
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::report(name, v.size(), ns, static_cast<double>(v.size()));
+}
+
+template<typename Queue>
+void hold(const char* name, const std::vector<Event>& v) {
+    if (!bench::enabled(name))
+        return;
+    Queue q;
+    for (const Event& e : v)
+        q.push(e);
+    const std::vector<uint64_t>& d = delays();
+    double ns = bench::measure_ns([&] {
+        for (uint64_t x : d)
+            reschedule(q, x);
+        bench::do_not_optimize(q.top());
+    });
+    bench::report(name, v.size(), ns, static_cast<double>(d.size()));
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Priority_Queue::bench_push_pop() {
+    for (size_t n : {size_t(1) << 10, (size_t(1) << 20) * bench::scale()}) {
+        std::vector<Event> v = random_events(n);
+        push_pop<Std_Queue>("std::priority_queue/push_pop", v);
+        push_pop<nuo_priority_queue<Event, Later, 2>>("nuo_priority_queue<2>/push_pop", v);
+        push_pop<nuo_priority_queue<Event, Later>>("nuo_priority_queue<4>/push_pop", v);
+    }
+}
+
+void bench::Bench_Nuo_Priority_Queue::bench_hold() {
+    for (size_t n : {size_t(1) << 10, size_t(1) << 16, (size_t(1) << 21) * bench::scale()}) {
+        std::vector<Event> v = random_events(n);
+        hold<Std_Queue>("std::priority_queue/hold", v);
+        hold<nuo_priority_queue<Event, Later, 2>>("nuo_priority_queue<2>/hold", v);
+        hold<nuo_priority_queue<Event, Later>>("nuo_priority_queue<4>/hold", v);
+        hold<nuo_priority_queue<Event, Later, 8>>("nuo_priority_queue<8>/hold", v);
+        hold<nuo_addressable_heap<Event, Later>>("nuo_addressable_heap/hold", v);
+        hold<nuo_radix_heap<uint64_t, uint64_t>>("nuo_radix_heap/hold", v);
+    }
+}
+
+void bench::Bench_Nuo_Priority_Queue::bench_make_heap() {
+    const size_t n = (size_t(1) << 20) * bench::scale();
+    const std::vector<Event> v = random_events(n);
+    std::vector<Event> w(n);
+    if (bench::enabled("std::make_heap")) {
+        double ns = bench::measure_ns([&] {
+            std::copy(v.begin(), v.end(), w.begin());
+            std::make_heap(w.begin(), w.end(), Later());
+            bench::do_not_optimize(w[0]);
+        });
+        bench::report("std::make_heap", n, ns, static_cast<double>(n));
+    }
+    if (bench::enabled("nuo_make_heap<4>")) {
+        double ns = bench::measure_ns([&] {
+            std::copy(v.begin(), v.end(), w.begin());
+            nuo_make_heap<4>(w.begin(), w.end(), Later());
+            bench::do_not_optimize(w[0]);
+        });
+        bench::report("nuo_make_heap<4>", n, ns, static_cast<double>(n));
+    }
+}
+
+/*
+ * Timers that get moved before they fire: each step moves a random timer
+ * to a new deadline and fires the earliest one, which is re-armed. The
+ * addressable heap updates in place; std::priority_queue pushes a new
+ * entry and skips the stale ones as they surface, tracked by a version
+ * number per timer kept in the low bits of the id.
+ */
+void bench::Bench_Nuo_Priority_Queue::bench_reschedule() {
+    const size_t n = size_t(1) << 16;
+    const std::vector<uint64_t>& d = delays();
+    const std::vector<uint64_t> pick = bench::random_vector<uint64_t>(n_delays, 42);
+
+    if (bench::enabled("std::priority_queue/reschedule_lazy")) {
+        Std_Queue q;
+        std::vector<uint32_t> version(n, 0);
+        for (size_t i = 0; i < n; i++)
+            q.push(Event(d[i], i << 32));
+        uint64_t now = 0;
+        double ns = bench::measure_ns([&] {
+            for (size_t i = 0; i < n_delays; i++) {
+                uint64_t t = pick[i] % n;
+                q.push(Event(now + d[i], t << 32 | ++version[t]));
+                while ((q.top().second & 0xffffffffu) != version[q.top().second >> 32])
+                    q.pop();
+                Event e = q.top();
+                q.pop();
+                now = e.first;
+                uint64_t id = e.second >> 32;
+                q.push(Event(now + d[n_delays - 1 - i], id << 32 | ++version[id]));
+            }
+            bench::do_not_optimize(now);
+        });
+        bench::report("std::priority_queue/reschedule_lazy", n, ns, static_cast<double>(n_delays));
+    }
+    if (bench::enabled("nuo_addressable_heap/reschedule")) {
+        nuo_addressable_heap<Event, Later> q;
+        std::vector<size_t> handle(n);
+        for (size_t i = 0; i < n; i++)
+            handle[i] = q.push(Event(d[i], i));
+        uint64_t now = 0;
+        double ns = bench::measure_ns([&] {
+            for (size_t i = 0; i < n_delays; i++) {
+                uint64_t t = pick[i] % n;
+                q.update(handle[t], Event(now + d[i], t));
+                now = q.top().first;
+                q.update(q.top_handle(), Event(now + d[n_delays - 1 - i], q.top().second));
+            }
+            bench::do_not_optimize(now);
+        });
+        bench::report("nuo_addressable_heap/reschedule", n, ns, static_cast<double>(n_delays));
+    }
+}
+
+namespace {
+
+/*
+ * The same timers with 32-bit deadlines and 2^20 (times the scale) of
+ * them, past the L2 cache, under uint64_t and uint32_t handles: the slot
+ * of each timer is {deadline, handle} and the handle table holds one
+ * position per timer, 24 or 12 bytes per timer. "get" reads random timers
+ * through the handle table, "reschedule" is the loop above.
+ */
+template<typename Index>
+void compact_index(const char* footprint, const char* get, const char* reschedule) {
+    using Heap = nuo_addressable_heap<uint32_t, std::greater<uint32_t>, 4, Index>;
+    struct slot {
+        uint32_t value;
+        Index id;
+    };
+    const size_t n = (size_t(1) << 20) * bench::scale();
+    const std::vector<uint64_t> r = bench::random_vector<uint64_t>(n_delays, 43);
+
+    Heap q;
+    q.reserve(n);
+    std::vector<Index> handle(n);
+    for (size_t i = 0; i < n; i++)
+        handle[i] = q.push(static_cast<uint32_t>(r[i % n_delays] >> 44));
+
+    if (bench::enabled(footprint)) {
+        const double bytes = static_cast<double>(sizeof(slot) + sizeof(Index));
+        printf("%-44s %12zu %17s %12.2f B/elem\n", footprint, n, "", bytes);
+        fflush(stdout);
+    }
+    if (bench::enabled(get)) {
+        double ns = bench::measure_ns([&] {
+            uint64_t sum = 0;
+            for (size_t i = 0; i < n_delays; i++)
+                sum += q.get(handle[r[i] % n]);
+            bench::do_not_optimize(sum);
+        });
+        bench::report(get, n, ns, static_cast<double>(n_delays));
+    }
+    if (bench::enabled(reschedule)) {
+        const std::vector<uint64_t>& d = delays();
+        uint32_t now = 0;
+        double ns = bench::measure_ns([&] {
+            for (size_t i = 0; i < n_delays; i++) {
+                q.update(handle[r[i] % n], static_cast<uint32_t>(now + d[i]));
+                now = q.top();
+                q.update(q.top_handle(), static_cast<uint32_t>(now + d[n_delays - 1 - i]));
+            }
+            bench::do_not_optimize(now);
+        });
+        bench::report(reschedule, n, ns, static_cast<double>(n_delays));
+    }
+}
+
+}   /* namespace */
+
+void bench::Bench_Nuo_Priority_Queue::bench_compact_index() {
+    compact_index<uint64_t>("nuo_addressable_heap/idx64/footprint",
+                            "nuo_addressable_heap/idx64/get",
+                            "nuo_addressable_heap/idx64/reschedule");
+    compact_index<uint32_t>("nuo_addressable_heap/idx32/footprint",
+                            "nuo_addressable_heap/idx32/get",
+                            "nuo_addressable_heap/idx32/reschedule");
+}
+
+void bench::Bench_Nuo_Priority_Queue::bench_nuo_priority_queue() {
+    bench_push_pop();
+    bench_hold();
+    bench_make_heap();
+    bench_reschedule();
+    bench_compact_index();
+}
@@ -0,0 +1,191 @@
+#include "./core/sequence_containers/bench_nuo_string_view.hpp"
+
+#include <stdio.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "bench_harness.hpp"
+#include "nuostl.hpp"
+
+using nuostl::nuo_string_view;
+
+namespace {
+
+/*
+ * Access log shaped text, one request per line, about 90 bytes per line:
+ *   2024-05-01T12:34:56.789Z INFO [worker-17] GET /api/v1/items/48213 200 1532us
+ * The buffer is 64 MiB times NUOSTL_BENCH_SCALE, e.g. NUOSTL_BENCH_SCALE=32
+ * for a 2 GiB log. It is built once and shared by all benchmarks.
+ */
+const std::string& log_buffer() {
+    static const std::string buf = [] {
+        const size_t n = (size_t(64) << 20) * bench::scale();
+        const char* levels[] = {"INFO", "INFO", "INFO", "DEBUG", "WARN"};
+        const char* methods[] = {"GET", "GET", "POST", "PUT", "DELETE"};
+        const char* paths[] = {"/api/v1/items/", "/api/v1/users/",
+                               "/static/img/", "/health", "/api/v2/search?q="};
+        std::mt19937_64 rng(29);
+        std::string s;
+        s.reserve(n + 256);
+        char line[256];
+        while (s.size() < n) {
+            int len = snprintf(line, sizeof(line),
+                "2024-05-%02uT%02u:%02u:%02u.%03uZ %s [worker-%u] %s %s%u "
+                "%u %uus\n",
+                unsigned(1 + rng() % 28), unsigned(rng() % 24),
+                unsigned(rng() % 60), unsigned(rng() % 60),
+                unsigned(rng() % 1000), levels[rng() % 5],
+                unsigned(rng() % 32), methods[rng() % 5], paths[rng() % 5],
+                unsigned(rng() % 100000), rng() % 50 ? 200u : 404u,
+                unsigned(rng() % 20000));
+            s.append(line, static_cast<size_t>(len));
+        }
+        return s;
+    }();
+    return buf;
+}
+
+void report_gbs(const char* name, double ns) {
+    const size_t bytes = log_buffer().size();
+    bench::report(name, bytes, ns, static_cast<double>(bytes), "GB/s");
+}
+
+}   /* namespace */
+
+/* Substring absent from the log: one full pass over the buffer. */
+void bench::Bench_Nuo_String_View::bench_find() {
+    const std::string& log = log_buffer();
+    const char* needle = "ERROR 503 upstream";
+    if (bench::enabled("nuo_string_view/find_str")) {
+        nuo_string_view sv(log);
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(sv.find(needle));
+        });
+        report_gbs("nuo_string_view/find_str", ns);
+    }
+    if (bench::enabled("std::string_view/find_str")) {
+        std::string_view sv(log);
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(sv.find(needle));
+        });
+        report_gbs("std::string_view/find_str", ns);
+    }
+}
+
+/* Set with no member in the log: one full pass over the buffer. */
+void bench::Bench_Nuo_String_View::bench_find_first_of() {
+    const std::string& log = log_buffer();
+    const char* set = "{}|<>";
+    if (bench::enabled("nuo_string_view/find_first_of")) {
+        nuo_string_view sv(log);
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(sv.find_first_of(set));
+        });
+        report_gbs("nuo_string_view/find_first_of", ns);
+    }
+    if (bench::enabled("std::string_view/find_first_of")) {
+        std::string_view sv(log);
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(sv.find_first_of(set));
+        });
+        report_gbs("std::string_view/find_first_of", ns);
+    }
+}
+
+void bench::Bench_Nuo_String_View::bench_split_lines() {
+    const std::string& log = log_buffer();
+    if (bench::enabled("nuo_string_view/split_lines")) {
+        double ns = bench::measure_ns([&] {
+            size_t lines = 0, bytes = 0;
+            for (nuo_string_view line : nuostl::nuo_split(log, '\n')) {
+                lines++;
+                bytes += line.size();
+            }
+            bench::do_not_optimize(lines + bytes);
+        });
+        report_gbs("nuo_string_view/split_lines", ns);
+    }
+    if (bench::enabled("std::string_view/split_lines")) {
+        std::string_view sv(log);
+        double ns = bench::measure_ns([&] {
+            size_t lines = 0, bytes = 0, pos = 0;
+            while (pos < sv.size()) {
+                size_t k = sv.find('\n', pos);
+                if (k == std::string_view::npos)
+                    k = sv.size();
+                lines++;
+                bytes += k - pos;
+                pos = k + 1;
+            }
+            bench::do_not_optimize(lines + bytes);
+        });
+        report_gbs("std::string_view/split_lines", ns);
+    }
+}
+
+void bench::Bench_Nuo_String_View::bench_tokenize() {
+    const std::string& log = log_buffer();
+    const char* delims = " []\n";
+    if (bench::enabled("nuo_string_view/tokenize_fields")) {
+        double ns = bench::measure_ns([&] {
+            size_t tokens = 0;
+            for (nuo_string_view t : nuostl::nuo_tokenize(log, delims))
+                tokens += t.size() != 0;
+            bench::do_not_optimize(tokens);
+        });
+        report_gbs("nuo_string_view/tokenize_fields", ns);
+    }
+    if (bench::enabled("std::string_view/tokenize_fields")) {
+        std::string_view sv(log);
+        double ns = bench::measure_ns([&] {
+            size_t tokens = 0;
+            size_t pos = sv.find_first_not_of(delims);
+            while (pos != std::string_view::npos) {
+                size_t end = sv.find_first_of(delims, pos);
+                if (end == std::string_view::npos)
+                    end = sv.size();
+                tokens += end != pos;
+                pos = sv.find_first_not_of(delims, end);
+            }
+            bench::do_not_optimize(tokens);
+        });
+        report_gbs("std::string_view/tokenize_fields", ns);
+    }
+}
+
+/*
+ * Worst case of first/last byte filtering: "aaa...a" searched for
+ * a^63 b a^64. Every position passes the filter except for the last byte,
+ * nuo_string_view switches to Two-Way.
+ */
+void bench::Bench_Nuo_String_View::bench_degenerate() {
+    const size_t n = (size_t(4) << 20) * bench::scale();
+    std::string hay(n, 'a');
+    std::string needle = std::string(63, 'a') + "b" + std::string(64, 'a');
+    if (bench::enabled("nuo_string_view/find_degenerate")) {
+        nuo_string_view sv(hay);
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(sv.find(needle));
+        });
+        bench::report("nuo_string_view/find_degenerate", n, ns,
+                      static_cast<double>(n), "GB/s");
+    }
+    if (bench::enabled("std::string_view/find_degenerate")) {
+        std::string_view sv(hay);
+        double ns = bench::measure_ns([&] {
+            bench::do_not_optimize(sv.find(needle));
+        });
+        bench::report("std::string_view/find_degenerate", n, ns,
+                      static_cast<double>(n), "GB/s");
+    }
+}
+
+void bench::Bench_Nuo_String_View::bench_nuo_string_view() {
+    bench_find();
+    bench_find_first_of();
+    bench_split_lines();
+    bench_tokenize();
+    bench_degenerate();
+}
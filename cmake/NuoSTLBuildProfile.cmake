@@ -0,0 +1,110 @@
+# Build profile for NuoSTL: LTO, ISA level, profile guided optimization,
+# index width and sanitizers.
+#
+# All options are applied directory-wide so that every target built through
+# the project (tests, benchmarks, consumers added via add_subdirectory) is
+# compiled with the same profile.
+
+# LTO
+if(NUOSTL_ENABLE_LTO)
+    include(CheckIPOSupported)
+    check_ipo_supported(RESULT NUOSTL_IPO_SUPPORTED OUTPUT NUOSTL_IPO_OUTPUT)
+    if(NUOSTL_IPO_SUPPORTED)
+        set(CMAKE_INTERPROCEDURAL_OPTIMIZATION ON)
+    else()
+        message(WARNING "NuoSTL: LTO is not supported: ${NUOSTL_IPO_OUTPUT}")
+    endif()
+endif()
+
+# ISA level
+if(NUOSTL_ISA_LEVEL)
+    if(NOT NUOSTL_ISA_LEVEL MATCHES "^(x86-64-v[234]|native)$")
+        message(FATAL_ERROR
+            "NuoSTL: unknown NUOSTL_ISA_LEVEL '${NUOSTL_ISA_LEVEL}'")
+    endif()
+    include(CheckCXXCompilerFlag)
+    check_cxx_compiler_flag(-march=${NUOSTL_ISA_LEVEL} NUOSTL_HAS_MARCH)
+    if(NOT NUOSTL_HAS_MARCH)
+        message(FATAL_ERROR
+            "NuoSTL: compiler does not accept -march=${NUOSTL_ISA_LEVEL}")
+    endif()
+    add_compile_options(-march=${NUOSTL_ISA_LEVEL})
+endif()
+
+# PGO
+# 1. configure with -DNUOSTL_PGO=GENERATE, build, then build the
+#    nuostl_pgo_train target to run the benchmark suite;
+# 2. reconfigure the same build tree with -DNUOSTL_PGO=USE and rebuild.
+string(TOUPPER "${NUOSTL_PGO}" NUOSTL_PGO)
+if(NUOSTL_PGO STREQUAL "GENERATE")
+    file(MAKE_DIRECTORY ${NUOSTL_PGO_DIR})
+    add_compile_options(-fprofile-generate=${NUOSTL_PGO_DIR})
+    add_link_options(-fprofile-generate=${NUOSTL_PGO_DIR})
+elseif(NUOSTL_PGO STREQUAL "USE")
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        set(NUOSTL_PGO_PROFILE ${NUOSTL_PGO_DIR}/default.profdata)
+        if(NOT EXISTS ${NUOSTL_PGO_PROFILE})
+            message(WARNING "NuoSTL: ${NUOSTL_PGO_PROFILE} does not exist, "
+                "run the nuostl_pgo_train target of a GENERATE build first")
+        endif()
+        add_compile_options(-fprofile-use=${NUOSTL_PGO_PROFILE}
+            -Wno-profile-instr-unprofiled -Wno-profile-instr-out-of-date)
+        add_link_options(-fprofile-use=${NUOSTL_PGO_PROFILE})
+    else()
+        add_compile_options(-fprofile-use=${NUOSTL_PGO_DIR}
+            -fprofile-correction -Wno-missing-profile)
+        add_link_options(-fprofile-use=${NUOSTL_PGO_DIR})
+    endif()
+elseif(NOT NUOSTL_PGO STREQUAL "OFF")
+    message(FATAL_ERROR "NuoSTL: unknown NUOSTL_PGO stage '${NUOSTL_PGO}'")
+endif()
+
+# Index width
+if(NOT NUOSTL_IDX_BITS MATCHES "^(32|64)$")
+    message(FATAL_ERROR "NuoSTL: NUOSTL_IDX_BITS must be 32 or 64")
+endif()
+add_compile_definitions(NUOSTL_IDX_BITS=${NUOSTL_IDX_BITS})
+
+# Sanitizers
+# thread runs the concurrent container stress tests under ThreadSanitizer;
+# it cannot be combined with address.
+if(NUOSTL_SANITIZE)
+    if(NOT NUOSTL_SANITIZE MATCHES "^(address|undefined|address,undefined|thread)$")
+        message(FATAL_ERROR "NuoSTL: unknown NUOSTL_SANITIZE '${NUOSTL_SANITIZE}'")
+    endif()
+    add_compile_options(-fsanitize=${NUOSTL_SANITIZE} -fno-omit-frame-pointer -g)
+    add_link_options(-fsanitize=${NUOSTL_SANITIZE})
+endif()
+
+message(STATUS "NuoSTL: build type '${CMAKE_BUILD_TYPE}', "
+    "LTO ${NUOSTL_ENABLE_LTO}, ISA '${NUOSTL_ISA_LEVEL}', PGO ${NUOSTL_PGO}, "
+    "idx_t ${NUOSTL_IDX_BITS} bits, sanitize '${NUOSTL_SANITIZE}'")
+
+# Training run, only meaningful for an instrumented build.
+function(nuostl_add_pgo_targets)
+    if(NOT NUOSTL_PGO STREQUAL "GENERATE")
+        return()
+    endif()
+    if(NOT TARGET nuostl_bench)
+        message(FATAL_ERROR
+            "NuoSTL: NUOSTL_PGO=GENERATE needs NUOSTL_BUILD_BENCHMARKS=ON")
+    endif()
+
+    set(NUOSTL_PGO_COMMANDS COMMAND $<TARGET_FILE:nuostl_bench>)
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        find_program(NUOSTL_LLVM_PROFDATA llvm-profdata)
+        if(NOT NUOSTL_LLVM_PROFDATA)
+            message(FATAL_ERROR "NuoSTL: llvm-profdata is needed for clang PGO")
+        endif()
+        list(APPEND NUOSTL_PGO_COMMANDS
+            COMMAND sh -c "${NUOSTL_LLVM_PROFDATA} merge -output=${NUOSTL_PGO_DIR}/default.profdata ${NUOSTL_PGO_DIR}/*.profraw")
+    endif()
+
+    add_custom_target(nuostl_pgo_train
+        ${NUOSTL_PGO_COMMANDS}
+        DEPENDS nuostl_bench
+        WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
+        COMMENT "NuoSTL: running the benchmark suite to collect PGO profiles"
+        VERBATIM
+    )
+endfunction()
@@ -0,0 +1,524 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_BIGINT_KERNELS_HPP_
+#define NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_BIGINT_KERNELS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+#include "../../../core/dispatch/nuo_cpu_dispatch.hpp"
+#include "./nuo_gcd.hpp"
+#include "./nuo_ntt.hpp"
+
+#if defined(NUOSTL_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+/*
+ * Natural number kernels on little-endian arrays of 64-bit limbs, the
+ * mpn layer of nuo_biginteger. Lengths are in limbs; unless stated
+ * otherwise an output may alias an input of the same length and offset.
+ *
+ * Thresholds are in limbs of the smaller operand, picked from the
+ * crossovers of the nuo_biginteger benchmarks on x86-64 (AVX-512 class
+ * core). Each can be overridden with -DNUOSTL_BIGINT_<NAME>_THRESHOLD=n
+ * to retune another machine against the same benchmarks.
+ */
+
+#if !defined(NUOSTL_BIGINT_KARATSUBA_THRESHOLD)
+#define NUOSTL_BIGINT_KARATSUBA_THRESHOLD 24
+#endif
+#if !defined(NUOSTL_BIGINT_TOOM3_THRESHOLD)
+#define NUOSTL_BIGINT_TOOM3_THRESHOLD 400
+#endif
+#if !defined(NUOSTL_BIGINT_NEWTON_THRESHOLD)
+#define NUOSTL_BIGINT_NEWTON_THRESHOLD 1500
+#endif
+#if !defined(NUOSTL_BIGINT_NTT_THRESHOLD)
+#define NUOSTL_BIGINT_NTT_THRESHOLD 1800
+#endif
+
+namespace nuostl {
+namespace detail {
+
+using nuo_limb = uint64_t;
+using nuo_dlimb = unsigned __int128;
+
+/* basecase -> Karatsuba */
+inline constexpr size_t nuo_bigint_karatsuba_threshold =
+    NUOSTL_BIGINT_KARATSUBA_THRESHOLD;
+/* Karatsuba -> Toom-3 */
+inline constexpr size_t nuo_bigint_toom3_threshold =
+    NUOSTL_BIGINT_TOOM3_THRESHOLD;
+/* Knuth D -> Newton reciprocal, divisor and quotient limbs */
+inline constexpr size_t nuo_bigint_newton_threshold =
+    NUOSTL_BIGINT_NEWTON_THRESHOLD;
+/* Toom-3 -> three prime NTT */
+inline constexpr size_t nuo_bigint_ntt_threshold =
+    NUOSTL_BIGINT_NTT_THRESHOLD;
+
+/* Length without the high zero limbs. */
+inline size_t nuo_bigint_normalize(const nuo_limb* a, size_t n) noexcept {
+    while (n > 0 && a[n - 1] == 0)
+        n--;
+    return n;
+}
+
+/* Compare two n limb numbers. */
+inline int nuo_bigint_cmp_n(const nuo_limb* a, const nuo_limb* b,
+                            size_t n) noexcept {
+    while (n-- > 0) {
+        if (a[n] != b[n])
+            return a[n] < b[n] ? -1 : 1;
+    }
+    return 0;
+}
+
+/* Compare normalized numbers of lengths an and bn. */
+inline int nuo_bigint_cmp(const nuo_limb* a, size_t an, const nuo_limb* b,
+                          size_t bn) noexcept {
+    if (an != bn)
+        return an < bn ? -1 : 1;
+    return nuo_bigint_cmp_n(a, b, an);
+}
+
+/* r = a + b + carry, returns the carry out */
+inline nuo_limb nuo_bigint_add_n(nuo_limb* r, const nuo_limb* a,
+                                 const nuo_limb* b, size_t n) noexcept {
+#if defined(NUOSTL_ARCH_X86)
+    unsigned char c = 0;
+    for (size_t i = 0; i < n; i++) {
+        unsigned long long s;
+        c = _addcarry_u64(c, a[i], b[i], &s);
+        r[i] = s;
+    }
+    return c;
+#else
+    nuo_limb c = 0;
+    for (size_t i = 0; i < n; i++) {
+        nuo_dlimb s = static_cast<nuo_dlimb>(a[i]) + b[i] + c;
+        r[i] = static_cast<nuo_limb>(s);
+        c = static_cast<nuo_limb>(s >> 64);
+    }
+    return c;
+#endif
+}
+
+/* r = a - b, returns the borrow out */
+inline nuo_limb nuo_bigint_sub_n(nuo_limb* r, const nuo_limb* a,
+                                 const nuo_limb* b, size_t n) noexcept {
+#if defined(NUOSTL_ARCH_X86)
+    unsigned char c = 0;
+    for (size_t i = 0; i < n; i++) {
+        unsigned long long s;
+        c = _subborrow_u64(c, a[i], b[i], &s);
+        r[i] = s;
+    }
+    return c;
+#else
+    nuo_limb c = 0;
+    for (size_t i = 0; i < n; i++) {
+        nuo_limb x = a[i], y = b[i];
+        nuo_limb d = x - y - c;
+        c = (x < y) | ((x == y) & c);
+        r[i] = d;
+    }
+    return c;
+#endif
+}
+
+/* r[0, n) = a[0, n) + b, returns the carry out */
+inline nuo_limb nuo_bigint_add_1(nuo_limb* r, const nuo_limb* a, size_t n,
+                                 nuo_limb b) noexcept {
+    size_t i = 0;
+    for (; i < n && b != 0; i++) {
+        nuo_limb s = a[i] + b;
+        b = s < b;
+        r[i] = s;
+    }
+    if (r != a) {
+        for (; i < n; i++)
+            r[i] = a[i];
+    }
+    return b;
+}
+
+/* r[0, n) = a[0, n) - b, returns the borrow out */
+inline nuo_limb nuo_bigint_sub_1(nuo_limb* r, const nuo_limb* a, size_t n,
+                                 nuo_limb b) noexcept {
+    size_t i = 0;
+    for (; i < n && b != 0; i++) {
+        nuo_limb x = a[i];
+        r[i] = x - b;
+        b = x < b;
+    }
+    if (r != a) {
+        for (; i < n; i++)
+            r[i] = a[i];
+    }
+    return b;
+}
+
+/* r[0, an) = a + b with an >= bn, returns the carry out */
+inline nuo_limb nuo_bigint_add(nuo_limb* r, const nuo_limb* a, size_t an,
+                               const nuo_limb* b, size_t bn) noexcept {
+    nuo_limb c = nuo_bigint_add_n(r, a, b, bn);
+    return nuo_bigint_add_1(r + bn, a + bn, an - bn, c);
+}
+
+/* r[0, an) = a - b with an >= bn, returns the borrow out */
+inline nuo_limb nuo_bigint_sub(nuo_limb* r, const nuo_limb* a, size_t an,
+                               const nuo_limb* b, size_t bn) noexcept {
+    nuo_limb c = nuo_bigint_sub_n(r, a, b, bn);
+    return nuo_bigint_sub_1(r + bn, a + bn, an - bn, c);
+}
+
+/* r = a * b, returns the high limb */
+inline nuo_limb nuo_bigint_mul_1(nuo_limb* r, const nuo_limb* a, size_t n,
+                                 nuo_limb b) noexcept {
+    nuo_limb c = 0;
+    for (size_t i = 0; i < n; i++) {
+        nuo_dlimb p = static_cast<nuo_dlimb>(a[i]) * b + c;
+        r[i] = static_cast<nuo_limb>(p);
+        c = static_cast<nuo_limb>(p >> 64);
+    }
+    return c;
+}
+
+/* r += a * b, returns the high limb */
+inline nuo_limb nuo_bigint_addmul_1(nuo_limb* r, const nuo_limb* a, size_t n,
+                                    nuo_limb b) noexcept {
+    nuo_limb c = 0;
+    for (size_t i = 0; i < n; i++) {
+        nuo_dlimb p = static_cast<nuo_dlimb>(a[i]) * b + r[i] + c;
+        r[i] = static_cast<nuo_limb>(p);
+        c = static_cast<nuo_limb>(p >> 64);
+    }
+    return c;
+}
+
+/* r -= a * b, returns the limb to subtract from r[n] */
+inline nuo_limb nuo_bigint_submul_1(nuo_limb* r, const nuo_limb* a, size_t n,
+                                    nuo_limb b) noexcept {
+    nuo_limb c = 0;
+    for (size_t i = 0; i < n; i++) {
+        nuo_dlimb p = static_cast<nuo_dlimb>(a[i]) * b + c;
+        nuo_limb lo = static_cast<nuo_limb>(p);
+        c = static_cast<nuo_limb>(p >> 64);
+        nuo_limb x = r[i];
+        r[i] = x - lo;
+        c += x < lo;
+    }
+    return c;
+}
+
+/* r = a << s for 0 < s < 64, returns the bits shifted out */
+inline nuo_limb nuo_bigint_lshift(nuo_limb* r, const nuo_limb* a, size_t n,
+                                  unsigned s) noexcept {
+    nuo_limb out = a[n - 1] >> (64 - s);
+    for (size_t i = n - 1; i > 0; i--)
+        r[i] = (a[i] << s) | (a[i - 1] >> (64 - s));
+    r[0] = a[0] << s;
+    return out;
+}
+
+/* r = a >> s for 0 < s < 64, returns the bits shifted out (high aligned) */
+inline nuo_limb nuo_bigint_rshift(nuo_limb* r, const nuo_limb* a, size_t n,
+                                  unsigned s) noexcept {
+    nuo_limb out = a[0] << (64 - s);
+    for (size_t i = 0; i + 1 < n; i++)
+        r[i] = (a[i] >> s) | (a[i + 1] << (64 - s));
+    r[n - 1] = a[n - 1] >> s;
+    return out;
+}
+
+/* (hi:lo) / d with hi < d, quotient and remainder */
+inline nuo_limb nuo_bigint_div_2by1(nuo_limb hi, nuo_limb lo, nuo_limb d,
+                                    nuo_limb* rem) noexcept {
+#if defined(NUOSTL_ARCH_X86)
+    nuo_limb q, r;
+    asm("divq %4" : "=a"(q), "=d"(r) : "a"(lo), "d"(hi), "rm"(d));
+    *rem = r;
+    return q;
+#else
+    nuo_dlimb n = (static_cast<nuo_dlimb>(hi) << 64) | lo;
+    *rem = static_cast<nuo_limb>(n % d);
+    return static_cast<nuo_limb>(n / d);
+#endif
+}
+
+/* q = a / d, returns a % d; d != 0, q may alias a */
+inline nuo_limb nuo_bigint_divrem_1(nuo_limb* q, const nuo_limb* a, size_t n,
+                                    nuo_limb d) noexcept {
+    nuo_limb r = 0;
+    for (size_t i = n; i-- > 0; )
+        q[i] = nuo_bigint_div_2by1(r, a[i], d, &r);
+    return r;
+}
+
+/* Bits [s, s + 128) of a[0, n), zeros past the top */
+inline nuo_dlimb nuo_bigint_bits(const nuo_limb* a, size_t n, size_t s) noexcept {
+    auto at = [&](size_t i) -> nuo_limb { return i < n ? a[i] : 0; };
+    const size_t i = s / 64;
+    const unsigned r = static_cast<unsigned>(s % 64);
+    nuo_dlimb x = at(i) | (static_cast<nuo_dlimb>(at(i + 1)) << 64);
+    if (r == 0)
+        return x;
+    return (x >> r) | (static_cast<nuo_dlimb>(at(i + 2)) << (128 - r));
+}
+
+/* a' = u0 a + v0 b, b' = u1 a + v1 b */
+struct nuo_bigint_cofactors {
+    int64_t u0, v0, u1, v1;
+};
+
+/*
+ * Lehmer's step (Knuth 4.5.2, Algorithm L) on x >= y, the leading bits of
+ * two numbers a >= b cut at the same position, below 2^126. Euclid runs
+ * on x and y while the quotient is the same for both ends of the range
+ * the full numbers may be in, so every quotient taken is the one Euclid
+ * would take on a and b; it stops before a cofactor reaches 2^63. About
+ * half the bits of x are cancelled. v0 == 0 when no quotient was certain
+ * and a full division step is needed.
+ */
+inline nuo_bigint_cofactors nuo_bigint_lehmer(nuo_dlimb x, nuo_dlimb y) noexcept {
+    using s128 = __int128;
+    constexpr s128 lim = s128(1) << 63;
+    /* a floor quotient of non-negative values, in 64 bits when they fit */
+    auto quot = [](s128 n, s128 d) -> s128 {
+        if ((static_cast<nuo_dlimb>(n) >> 64) == 0)
+            return static_cast<s128>(static_cast<uint64_t>(n) / static_cast<uint64_t>(d));
+        return n / d;
+    };
+    s128 xs = static_cast<s128>(x), ys = static_cast<s128>(y);
+    s128 u0 = 1, v0 = 0, u1 = 0, v1 = 1;
+    for (;;) {
+        s128 nu = xs + u0, nv = xs + v0, du = ys + u1, dv = ys + v1;
+        if (du <= 0 || dv <= 0 || nu < 0 || nv < 0)
+            break;
+        s128 q = quot(nu, du);
+        if (q != quot(nv, dv))
+            break;
+        s128 qu, qv;
+        if (__builtin_mul_overflow(q, u1, &qu) || __builtin_mul_overflow(q, v1, &qv))
+            break;
+        s128 u2 = u0 - qu, v2 = v0 - qv;
+        if (u2 <= -lim || u2 >= lim || v2 <= -lim || v2 >= lim)
+            break;
+        u0 = u1;
+        v0 = v1;
+        u1 = u2;
+        v1 = v2;
+        s128 t = xs - q * ys;
+        xs = ys;
+        ys = t;
+    }
+    return {static_cast<int64_t>(u0), static_cast<int64_t>(v0),
+            static_cast<int64_t>(u1), static_cast<int64_t>(v1)};
+}
+
+/*
+ * r = u0 a + v0 b and t = u1 a + v1 b over n limbs, in one pass with
+ * signed carries, for cofactors as nuo_bigint_lehmer returns them: each
+ * pair of opposite signs, both combinations non-negative and fitting n
+ * limbs. r and t alias neither input.
+ */
+inline void nuo_bigint_lincomb_2(nuo_limb* r, nuo_limb* t, const nuo_limb* a,
+                                 const nuo_limb* b, size_t n,
+                                 const nuo_bigint_cofactors& c) noexcept {
+    using s128 = __int128;
+    /* u a + v b as p x - q y with p, q >= 0, so each product is one mul */
+    struct side {
+        const nuo_limb* x;
+        const nuo_limb* y;
+        nuo_limb p, q;
+    };
+    auto split = [&](int64_t u, int64_t v) -> side {
+        if (v <= 0)
+            return {a, b, static_cast<nuo_limb>(u), nuo_limb(0) - static_cast<nuo_limb>(v)};
+        return {b, a, static_cast<nuo_limb>(v), nuo_limb(0) - static_cast<nuo_limb>(u)};
+    };
+    const side sr = split(c.u0, c.v0), st = split(c.u1, c.v1);
+    s128 cr = 0, ct = 0;
+    for (size_t i = 0; i < n; i++) {
+        /* p, q < 2^63: each product is below 2^127 */
+        cr += static_cast<s128>(static_cast<nuo_dlimb>(sr.x[i]) * sr.p) -
+              static_cast<s128>(static_cast<nuo_dlimb>(sr.y[i]) * sr.q);
+        ct += static_cast<s128>(static_cast<nuo_dlimb>(st.x[i]) * st.p) -
+              static_cast<s128>(static_cast<nuo_dlimb>(st.y[i]) * st.q);
+        r[i] = static_cast<nuo_limb>(cr);
+        t[i] = static_cast<nuo_limb>(ct);
+        cr >>= 64;
+        ct >>= 64;
+    }
+}
+
+/* Schoolbook r[0, an + bn) = a * b, an >= bn >= 1, r aliases neither. */
+inline void nuo_bigint_mul_basecase(nuo_limb* r, const nuo_limb* a, size_t an,
+                                    const nuo_limb* b, size_t bn) noexcept {
+    r[an] = nuo_bigint_mul_1(r, a, an, b[0]);
+    for (size_t j = 1; j < bn; j++)
+        r[an + j] = nuo_bigint_addmul_1(r + j, a, an, b[j]);
+}
+
+/* Scratch limbs nuo_bigint_mul_karatsuba needs for n limb operands. */
+constexpr size_t nuo_bigint_karatsuba_scratch(size_t n) noexcept {
+    return 6 * n + 6 * 64;
+}
+
+/*
+ * Karatsuba r[0, 2n) = a * b for two n limb operands, r aliases neither.
+ * With a = a1 B^l + a0: a b = z2 B^2l + (z0 + z2 - (a0 - a1)(b0 - b1)) B^l
+ * + z0, the middle product works on |a0 - a1| and |b0 - b1| plus a sign.
+ * Recursion stops below threshold limbs (a parameter for the benchmarks).
+ */
+inline void nuo_bigint_mul_karatsuba(
+        nuo_limb* r, const nuo_limb* a, const nuo_limb* b, size_t n,
+        nuo_limb* ws,
+        size_t threshold = nuo_bigint_karatsuba_threshold) noexcept {
+    if (n < threshold || n < 2) {
+        nuo_bigint_mul_basecase(r, a, n, b, n);
+        return;
+    }
+    const size_t lo = (n + 1) / 2;
+    const size_t hi = n - lo;
+    nuo_limb* da = ws;
+    nuo_limb* db = ws + lo;
+    nuo_limb* z1 = ws + 2 * lo;
+    nuo_limb* t = ws + 4 * lo;
+    nuo_limb* next = ws + 6 * lo + 1;
+
+    /* da = |a0 - a1|, db = |b0 - b1|, a1 and b1 zero extended to lo */
+    auto absdiff = [lo, hi](nuo_limb* d, const nuo_limb* x) {
+        const nuo_limb* x0 = x;
+        const nuo_limb* x1 = x + lo;
+        bool neg = (lo == hi || x0[lo - 1] == 0) &&
+            nuo_bigint_cmp(x0, nuo_bigint_normalize(x0, lo),
+                           x1, nuo_bigint_normalize(x1, hi)) < 0;
+        if (neg) {
+            nuo_bigint_sub_n(d, x1, x0, hi);
+            if (lo > hi)
+                d[hi] = 0;    /* x0's top limb is 0 here, no borrow either */
+        } else {
+            nuo_bigint_sub(d, x0, lo, x1, hi);
+        }
+        return neg;
+    };
+    bool sign = absdiff(da, a) != absdiff(db, b);
+
+    nuo_bigint_mul_karatsuba(r, a, b, lo, next, threshold);
+    nuo_bigint_mul_karatsuba(r + 2 * lo, a + lo, b + lo, hi, next, threshold);
+    nuo_bigint_mul_karatsuba(z1, da, db, lo, next, threshold);
+
+    /* t = z0 + z2 -/+ z1, always non-negative */
+    memcpy(t, r, 2 * lo * sizeof(nuo_limb));
+    t[2 * lo] = nuo_bigint_add(t, t, 2 * lo, r + 2 * lo, 2 * hi);
+    if (sign)
+        t[2 * lo] += nuo_bigint_add_n(t, t, z1, 2 * lo);
+    else
+        t[2 * lo] -= nuo_bigint_sub_n(t, t, z1, 2 * lo);
+
+    size_t tn = nuo_bigint_normalize(t, 2 * lo + 1);
+    if (tn != 0)
+        nuo_bigint_add(r + lo, r + lo, 2 * n - lo, t, tn);
+}
+
+/*
+ * Knuth's algorithm D: q[0, an - dn + 1) = a / d, rem[0, dn) = a % d for
+ * an >= dn >= 2 and d[dn - 1] != 0. Outputs alias nothing.
+ */
+inline void nuo_bigint_divrem_knuth(nuo_limb* q, nuo_limb* rem,
+                                    const nuo_limb* a, size_t an,
+                                    const nuo_limb* d, size_t dn) {
+    const unsigned s = static_cast<unsigned>(__builtin_clzll(d[dn - 1]));
+    std::vector<nuo_limb> un(an + 1), vn(dn);
+    if (s != 0) {
+        nuo_bigint_lshift(vn.data(), d, dn, s);
+        un[an] = nuo_bigint_lshift(un.data(), a, an, s);
+    } else {
+        memcpy(vn.data(), d, dn * sizeof(nuo_limb));
+        memcpy(un.data(), a, an * sizeof(nuo_limb));
+        un[an] = 0;
+    }
+    const nuo_limb v1 = vn[dn - 1];
+    const nuo_limb v2 = vn[dn - 2];
+    for (size_t j = an - dn + 1; j-- > 0; ) {
+        nuo_limb u0 = un[j + dn];
+        nuo_limb u1 = un[j + dn - 1];
+        nuo_limb u2 = un[j + dn - 2];
+        nuo_limb qhat;
+        nuo_dlimb rhat;
+        if (u0 >= v1) {
+            /* u0 == v1: the estimate (B - 1) is at most 2 too large */
+            qhat = ~nuo_limb(0);
+            rhat = static_cast<nuo_dlimb>(u1) + v1;
+        } else {
+            nuo_limb r1;
+            qhat = nuo_bigint_div_2by1(u0, u1, v1, &r1);
+            rhat = r1;
+        }
+        while ((rhat >> 64) == 0 &&
+               static_cast<nuo_dlimb>(qhat) * v2 >
+                   ((rhat << 64) | u2)) {
+            qhat--;
+            rhat += v1;
+        }
+        nuo_limb borrow = nuo_bigint_submul_1(un.data() + j, vn.data(), dn,
+                                              qhat);
+        if (un[j + dn] < borrow) {
+            /* qhat was one too large, add d back */
+            qhat--;
+            un[j + dn] = un[j + dn] - borrow +
+                nuo_bigint_add_n(un.data() + j, un.data() + j, vn.data(), dn);
+        } else {
+            un[j + dn] -= borrow;
+        }
+        q[j] = qhat;
+    }
+    if (s != 0)
+        nuo_bigint_rshift(rem, un.data(), dn, s);
+    else
+        memcpy(rem, un.data(), dn * sizeof(nuo_limb));
+}
+
+/*
+ * r[0, an + bn) = a * b, an >= bn >= 1, r aliases neither. The limbs are
+ * the coefficients of a convolution over the three NTT primes: each
+ * product coefficient is below bn 2^128, well inside their 2^185, and is
+ * recombined by the CRT and added into r at its limb offset.
+ */
+inline void nuo_bigint_mul_ntt(nuo_limb* r, const nuo_limb* a, size_t an,
+                               const nuo_limb* b, size_t bn) {
+    const size_t nc = an + bn - 1;
+    const bool square = a == b && an == bn;
+    std::vector<uint64_t> res[3];
+    for (unsigned q = 0; q < 3; q++) {
+        const nuo_ntt_prime& P = nuo_ntt_primes[q];
+        res[q].resize(nc);
+        /* x 2^64 2^-64 mod p, cheaper than a division for x >= p */
+        nuo_ntt_convolve(q,
+            an, [&](size_t i) { return P.mul(a[i], P.r1); },
+            bn, [&](size_t i) { return P.mul(b[i], P.r1); },
+            square, res[q].data());
+    }
+    nuo_limb c0 = 0, c1 = 0;
+    uint64_t rv[3], v[3];
+    for (size_t i = 0; i < nc; i++) {
+        for (unsigned q = 0; q < 3; q++)
+            rv[q] = res[q][i];
+        nuo_ntt_crt::digits(3, rv, v);
+        nuo_u192 x = nuo_ntt_crt::value(3, v);
+        nuo_dlimb s = static_cast<nuo_dlimb>(c0) + x.w[0];
+        r[i] = static_cast<nuo_limb>(s);
+        s = (s >> 64) + c1 + x.w[1];
+        c0 = static_cast<nuo_limb>(s);
+        c1 = static_cast<nuo_limb>(s >> 64) + x.w[2];
+    }
+    r[nc] = c0;
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
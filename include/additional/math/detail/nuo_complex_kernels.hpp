@@ -0,0 +1,588 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_COMPLEX_KERNELS_HPP_
+#define NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_COMPLEX_KERNELS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <type_traits>
+
+#include "../../../core/dispatch/nuo_cpu_dispatch.hpp"
+
+#if defined(NUOSTL_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+/*
+ * Complex arithmetic behind nuo_complex and nuo_complex_array.
+ *
+ * Multiplication and division follow C11 Annex G like std::complex: the
+ * textbook formula first, and only when both parts of the result are NaN a
+ * recovery pass that turns an infinite operand into an infinite result.
+ * NaN and infinity are tested on the bit pattern, which -ffast-math
+ * (-ffinite-math-only) cannot fold to false the way it folds std::isnan,
+ * so the check is not silently dropped. Defining
+ * NUOSTL_COMPLEX_LIMITED_RANGE drops the recovery, Smith's division and
+ * the overflow-safe abs for the plain formulas, the same contract as
+ * CX_LIMITED_RANGE or -fcx-limited-range.
+ *
+ * Array kernels work on split storage (all real parts, then all imaginary
+ * parts), so one vector holds lanes of one component and a product is four
+ * multiplies and two adds with no shuffles. Nothing is fused: every ISA
+ * level rounds like the scalar formulas and returns the same bits, the
+ * products kept apart from the adds by an optimization barrier. float and
+ * double get AVX2 and AVX-512 kernels through nuo_dispatcher. The Annex G
+ * check costs a compare per vector; the rare vector that needs it is
+ * redone by the scalar code. Outputs may be the inputs.
+ */
+
+namespace nuostl {
+namespace detail {
+
+#if defined(NUOSTL_COMPLEX_LIMITED_RANGE)
+inline constexpr bool nuo_complex_limited_range = true;
+#else
+inline constexpr bool nuo_complex_limited_range = false;
+#endif
+
+template<typename T>
+inline constexpr bool nuo_fp_has_bits =
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+template<typename T>
+using nuo_fp_bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+/* |x| as bits against the exponent mask; long double uses <cmath> */
+template<std::floating_point T>
+constexpr bool nuo_fp_isnan(T x) noexcept {
+    if constexpr (nuo_fp_has_bits<T>) {
+        using B = nuo_fp_bits<T>;
+        constexpr B sign = B(1) << (8 * sizeof(T) - 1);
+        return (std::bit_cast<B>(x) & ~sign) >
+               std::bit_cast<B>(std::numeric_limits<T>::infinity());
+    } else {
+        return std::isnan(x);
+    }
+}
+
+template<std::floating_point T>
+constexpr bool nuo_fp_isinf(T x) noexcept {
+    if constexpr (nuo_fp_has_bits<T>) {
+        using B = nuo_fp_bits<T>;
+        constexpr B sign = B(1) << (8 * sizeof(T) - 1);
+        return (std::bit_cast<B>(x) & ~sign) ==
+               std::bit_cast<B>(std::numeric_limits<T>::infinity());
+    } else {
+        return std::isinf(x);
+    }
+}
+
+template<std::floating_point T>
+constexpr bool nuo_fp_isfinite(T x) noexcept {
+    if constexpr (nuo_fp_has_bits<T>) {
+        using B = nuo_fp_bits<T>;
+        constexpr B sign = B(1) << (8 * sizeof(T) - 1);
+        return (std::bit_cast<B>(x) & ~sign) <
+               std::bit_cast<B>(std::numeric_limits<T>::infinity());
+    } else {
+        return std::isfinite(x);
+    }
+}
+
+/*
+ * a * b rounded on its own. The empty asm hides the product from the
+ * optimizer, so -ffp-contract=fast (GCC's default for C++) cannot fuse it
+ * with the add that follows into an FMA.
+ */
+template<std::floating_point T>
+T nuo_fp_mul(T a, T b) noexcept {
+    T p = a * b;
+#if defined(NUOSTL_ARCH_X86)
+    if constexpr (nuo_fp_has_bits<T>)
+        __asm__("" : "+x"(p));
+#endif
+    return p;
+}
+
+/* +-1 for an infinity, +-0 otherwise, keeping the sign */
+template<std::floating_point T>
+T nuo_fp_box(T x) noexcept {
+    return std::copysign(nuo_fp_isinf(x) ? T(1) : T(0), x);
+}
+
+/* +-0 for a NaN, x otherwise */
+template<std::floating_point T>
+T nuo_fp_unnan(T x) noexcept {
+    return nuo_fp_isnan(x) ? std::copysign(T(0), x) : x;
+}
+
+/* Annex G recovery of (a + bi)(c + di) once x and y both came out NaN */
+template<std::floating_point T>
+__attribute__((noinline)) void nuo_complex_mul_recover(T a, T b, T c, T d,
+                                                       T& x, T& y) noexcept {
+    bool again = false;
+    if (nuo_fp_isinf(a) || nuo_fp_isinf(b)) {
+        a = nuo_fp_box(a);
+        b = nuo_fp_box(b);
+        c = nuo_fp_unnan(c);
+        d = nuo_fp_unnan(d);
+        again = true;
+    }
+    if (nuo_fp_isinf(c) || nuo_fp_isinf(d)) {
+        c = nuo_fp_box(c);
+        d = nuo_fp_box(d);
+        a = nuo_fp_unnan(a);
+        b = nuo_fp_unnan(b);
+        again = true;
+    }
+    if (!again && (nuo_fp_isinf(a * c) || nuo_fp_isinf(b * d) ||
+                   nuo_fp_isinf(a * d) || nuo_fp_isinf(b * c))) {
+        /* overflow of an intermediate product */
+        a = nuo_fp_unnan(a);
+        b = nuo_fp_unnan(b);
+        c = nuo_fp_unnan(c);
+        d = nuo_fp_unnan(d);
+        again = true;
+    }
+    if (again) {
+        const T inf = std::numeric_limits<T>::infinity();
+        x = inf * (a * c - b * d);
+        y = inf * (a * d + b * c);
+    }
+}
+
+/* x + yi = (a + bi)(c + di) */
+template<std::floating_point T>
+void nuo_complex_mul(T a, T b, T c, T d, T& x, T& y) noexcept {
+    T re = nuo_fp_mul(a, c) - nuo_fp_mul(b, d);
+    T im = nuo_fp_mul(a, d) + nuo_fp_mul(b, c);
+    if constexpr (!nuo_complex_limited_range) {
+        if (nuo_fp_isnan(re) && nuo_fp_isnan(im))
+            nuo_complex_mul_recover(a, b, c, d, re, im);
+    }
+    x = re;
+    y = im;
+}
+
+/* Annex G recovery of (a + bi) / (c + di) */
+template<std::floating_point T>
+__attribute__((noinline)) void nuo_complex_div_recover(T a, T b, T c, T d,
+                                                       T& x, T& y) noexcept {
+    const T inf = std::numeric_limits<T>::infinity();
+    if (c == T(0) && d == T(0) && (!nuo_fp_isnan(a) || !nuo_fp_isnan(b))) {
+        x = std::copysign(inf, c) * a;
+        y = std::copysign(inf, c) * b;
+    } else if ((nuo_fp_isinf(a) || nuo_fp_isinf(b)) && nuo_fp_isfinite(c) &&
+               nuo_fp_isfinite(d)) {
+        a = nuo_fp_box(a);
+        b = nuo_fp_box(b);
+        x = inf * (a * c + b * d);
+        y = inf * (b * c - a * d);
+    } else if ((nuo_fp_isinf(c) || nuo_fp_isinf(d)) && nuo_fp_isfinite(a) &&
+               nuo_fp_isfinite(b)) {
+        c = nuo_fp_box(c);
+        d = nuo_fp_box(d);
+        x = T(0) * (a * c + b * d);
+        y = T(0) * (b * c - a * d);
+    }
+}
+
+/* x + yi = (a + bi) / (c + di), Smith's algorithm */
+template<std::floating_point T>
+void nuo_complex_div(T a, T b, T c, T d, T& x, T& y) noexcept {
+    if constexpr (nuo_complex_limited_range) {
+        T n = c * c + d * d;
+        x = (a * c + b * d) / n;
+        y = (b * c - a * d) / n;
+    } else {
+        T re, im;
+        if (std::fabs(c) >= std::fabs(d)) {
+            T r = d / c, n = c + d * r;
+            re = (a + b * r) / n;
+            im = (b - a * r) / n;
+        } else {
+            T r = c / d, n = c * r + d;
+            re = (a * r + b) / n;
+            im = (b * r - a) / n;
+        }
+        if (nuo_fp_isnan(re) && nuo_fp_isnan(im))
+            nuo_complex_div_recover(a, b, c, d, re, im);
+        x = re;
+        y = im;
+    }
+}
+
+/* |a + bi| without intermediate overflow or underflow */
+template<std::floating_point T>
+T nuo_complex_abs(T a, T b) noexcept {
+    if constexpr (nuo_complex_limited_range)
+        return std::sqrt(a * a + b * b);
+    else
+        return std::hypot(a, b);
+}
+
+/* Scalar array kernels, also the tails of the vector ones */
+
+/* c = a * b, or a * conj(b) */
+template<typename T, bool Conj>
+void nuo_complex_mul_scalar(const T* ar, const T* ai, const T* br,
+                            const T* bi, T* cr, T* ci, size_t n) noexcept {
+    for (size_t i = 0; i < n; i++) {
+        T d = Conj ? -bi[i] : bi[i];
+        nuo_complex_mul(ar[i], ai[i], br[i], d, cr[i], ci[i]);
+    }
+}
+
+template<typename T>
+void nuo_complex_abs_scalar(const T* re, const T* im, T* out,
+                            size_t n) noexcept {
+    for (size_t i = 0; i < n; i++)
+        out[i] = nuo_complex_abs(re[i], im[i]);
+}
+
+template<typename T>
+void nuo_complex_norm_scalar(const T* re, const T* im, T* out,
+                             size_t n) noexcept {
+    for (size_t i = 0; i < n; i++)
+        out[i] = nuo_fp_mul(re[i], re[i]) + nuo_fp_mul(im[i], im[i]);
+}
+
+template<typename T>
+inline constexpr bool nuo_complex_simd_eligible =
+#if defined(NUOSTL_ARCH_X86)
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+#else
+    false;
+#endif
+
+#if defined(NUOSTL_ARCH_X86)
+
+/* gcc 12 warns on the _mm512_undefined_* placeholders inside intrinsics */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+
+/*
+ * nan2(x, y): lanes where x and y are both NaN. outside(s): lanes where s
+ * is NaN or not in [min normal, max], where a^2 + b^2 lost range. zero2:
+ * lanes where both are zero.
+ */
+template<typename T>
+struct nuo_complex_vec_avx2;
+
+template<>
+struct nuo_complex_vec_avx2<double> {
+    using reg = __m256d;
+    static constexpr size_t lanes = 4;
+    NUOSTL_TARGET_AVX2 static reg loadu(const double* p) { return _mm256_loadu_pd(p); }
+    NUOSTL_TARGET_AVX2 static void storeu(double* p, reg x) { _mm256_storeu_pd(p, x); }
+    NUOSTL_TARGET_AVX2 static reg mul(reg a, reg b) {
+        reg p = _mm256_mul_pd(a, b);
+        __asm__("" : "+x"(p));
+        return p;
+    }
+    NUOSTL_TARGET_AVX2 static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+    NUOSTL_TARGET_AVX2 static reg sub(reg a, reg b) { return _mm256_sub_pd(a, b); }
+    NUOSTL_TARGET_AVX2 static reg sqrt(reg a) { return _mm256_sqrt_pd(a); }
+    NUOSTL_TARGET_AVX2 static unsigned nan2(reg x, reg y) {
+        return static_cast<unsigned>(_mm256_movemask_pd(
+            _mm256_and_pd(_mm256_cmp_pd(x, x, _CMP_UNORD_Q),
+                          _mm256_cmp_pd(y, y, _CMP_UNORD_Q))));
+    }
+    NUOSTL_TARGET_AVX2 static unsigned outside(reg s) {
+        reg lo = _mm256_set1_pd(std::numeric_limits<double>::min());
+        reg hi = _mm256_set1_pd(std::numeric_limits<double>::max());
+        return static_cast<unsigned>(_mm256_movemask_pd(
+            _mm256_or_pd(_mm256_cmp_pd(s, lo, _CMP_NGE_UQ),
+                         _mm256_cmp_pd(s, hi, _CMP_NLE_UQ))));
+    }
+    NUOSTL_TARGET_AVX2 static unsigned zero2(reg a, reg b) {
+        reg z = _mm256_setzero_pd();
+        return static_cast<unsigned>(_mm256_movemask_pd(
+            _mm256_and_pd(_mm256_cmp_pd(a, z, _CMP_EQ_OQ),
+                          _mm256_cmp_pd(b, z, _CMP_EQ_OQ))));
+    }
+};
+
+template<>
+struct nuo_complex_vec_avx2<float> {
+    using reg = __m256;
+    static constexpr size_t lanes = 8;
+    NUOSTL_TARGET_AVX2 static reg loadu(const float* p) { return _mm256_loadu_ps(p); }
+    NUOSTL_TARGET_AVX2 static void storeu(float* p, reg x) { _mm256_storeu_ps(p, x); }
+    NUOSTL_TARGET_AVX2 static reg mul(reg a, reg b) {
+        reg p = _mm256_mul_ps(a, b);
+        __asm__("" : "+x"(p));
+        return p;
+    }
+    NUOSTL_TARGET_AVX2 static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+    NUOSTL_TARGET_AVX2 static reg sub(reg a, reg b) { return _mm256_sub_ps(a, b); }
+    NUOSTL_TARGET_AVX2 static reg sqrt(reg a) { return _mm256_sqrt_ps(a); }
+    NUOSTL_TARGET_AVX2 static unsigned nan2(reg x, reg y) {
+        return static_cast<unsigned>(_mm256_movemask_ps(
+            _mm256_and_ps(_mm256_cmp_ps(x, x, _CMP_UNORD_Q),
+                          _mm256_cmp_ps(y, y, _CMP_UNORD_Q))));
+    }
+    NUOSTL_TARGET_AVX2 static unsigned outside(reg s) {
+        reg lo = _mm256_set1_ps(std::numeric_limits<float>::min());
+        reg hi = _mm256_set1_ps(std::numeric_limits<float>::max());
+        return static_cast<unsigned>(_mm256_movemask_ps(
+            _mm256_or_ps(_mm256_cmp_ps(s, lo, _CMP_NGE_UQ),
+                         _mm256_cmp_ps(s, hi, _CMP_NLE_UQ))));
+    }
+    NUOSTL_TARGET_AVX2 static unsigned zero2(reg a, reg b) {
+        reg z = _mm256_setzero_ps();
+        return static_cast<unsigned>(_mm256_movemask_ps(
+            _mm256_and_ps(_mm256_cmp_ps(a, z, _CMP_EQ_OQ),
+                          _mm256_cmp_ps(b, z, _CMP_EQ_OQ))));
+    }
+};
+
+template<typename T>
+struct nuo_complex_vec_avx512;
+
+template<>
+struct nuo_complex_vec_avx512<double> {
+    using reg = __m512d;
+    static constexpr size_t lanes = 8;
+    NUOSTL_TARGET_AVX512 static reg loadu(const double* p) { return _mm512_loadu_pd(p); }
+    NUOSTL_TARGET_AVX512 static void storeu(double* p, reg x) { _mm512_storeu_pd(p, x); }
+    NUOSTL_TARGET_AVX512 static reg mul(reg a, reg b) {
+        reg p = _mm512_mul_pd(a, b);
+        __asm__("" : "+v"(p));
+        return p;
+    }
+    NUOSTL_TARGET_AVX512 static reg add(reg a, reg b) { return _mm512_add_pd(a, b); }
+    NUOSTL_TARGET_AVX512 static reg sub(reg a, reg b) { return _mm512_sub_pd(a, b); }
+    NUOSTL_TARGET_AVX512 static reg sqrt(reg a) { return _mm512_sqrt_pd(a); }
+    NUOSTL_TARGET_AVX512 static unsigned nan2(reg x, reg y) {
+        return _mm512_cmp_pd_mask(x, x, _CMP_UNORD_Q) &
+               _mm512_cmp_pd_mask(y, y, _CMP_UNORD_Q);
+    }
+    NUOSTL_TARGET_AVX512 static unsigned outside(reg s) {
+        reg lo = _mm512_set1_pd(std::numeric_limits<double>::min());
+        reg hi = _mm512_set1_pd(std::numeric_limits<double>::max());
+        return _mm512_cmp_pd_mask(s, lo, _CMP_NGE_UQ) |
+               _mm512_cmp_pd_mask(s, hi, _CMP_NLE_UQ);
+    }
+    NUOSTL_TARGET_AVX512 static unsigned zero2(reg a, reg b) {
+        reg z = _mm512_setzero_pd();
+        return _mm512_cmp_pd_mask(a, z, _CMP_EQ_OQ) &
+               _mm512_cmp_pd_mask(b, z, _CMP_EQ_OQ);
+    }
+};
+
+template<>
+struct nuo_complex_vec_avx512<float> {
+    using reg = __m512;
+    static constexpr size_t lanes = 16;
+    NUOSTL_TARGET_AVX512 static reg loadu(const float* p) { return _mm512_loadu_ps(p); }
+    NUOSTL_TARGET_AVX512 static void storeu(float* p, reg x) { _mm512_storeu_ps(p, x); }
+    NUOSTL_TARGET_AVX512 static reg mul(reg a, reg b) {
+        reg p = _mm512_mul_ps(a, b);
+        __asm__("" : "+v"(p));
+        return p;
+    }
+    NUOSTL_TARGET_AVX512 static reg add(reg a, reg b) { return _mm512_add_ps(a, b); }
+    NUOSTL_TARGET_AVX512 static reg sub(reg a, reg b) { return _mm512_sub_ps(a, b); }
+    NUOSTL_TARGET_AVX512 static reg sqrt(reg a) { return _mm512_sqrt_ps(a); }
+    NUOSTL_TARGET_AVX512 static unsigned nan2(reg x, reg y) {
+        return _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q) &
+               _mm512_cmp_ps_mask(y, y, _CMP_UNORD_Q);
+    }
+    NUOSTL_TARGET_AVX512 static unsigned outside(reg s) {
+        reg lo = _mm512_set1_ps(std::numeric_limits<float>::min());
+        reg hi = _mm512_set1_ps(std::numeric_limits<float>::max());
+        return _mm512_cmp_ps_mask(s, lo, _CMP_NGE_UQ) |
+               _mm512_cmp_ps_mask(s, hi, _CMP_NLE_UQ);
+    }
+    NUOSTL_TARGET_AVX512 static unsigned zero2(reg a, reg b) {
+        reg z = _mm512_setzero_ps();
+        return _mm512_cmp_ps_mask(a, z, _CMP_EQ_OQ) &
+               _mm512_cmp_ps_mask(b, z, _CMP_EQ_OQ);
+    }
+};
+
+/*
+ * a * b or a * conj(b) a vector at a time; a vector with a lane that is NaN
+ * in both parts is redone by the scalar code before anything is stored.
+ */
+template<typename T, bool Conj>
+NUOSTL_TARGET_AVX2 void nuo_complex_mul_avx2(const T* ar, const T* ai,
+                                             const T* br, const T* bi,
+                                             T* cr, T* ci, size_t n) noexcept {
+    using V = nuo_complex_vec_avx2<T>;
+    size_t i = 0;
+    for (; i + V::lanes <= n; i += V::lanes) {
+        typename V::reg a = V::loadu(ar + i), b = V::loadu(ai + i);
+        typename V::reg c = V::loadu(br + i), d = V::loadu(bi + i);
+        typename V::reg x, y;
+        if constexpr (Conj) {
+            x = V::add(V::mul(a, c), V::mul(b, d));
+            y = V::sub(V::mul(b, c), V::mul(a, d));
+        } else {
+            x = V::sub(V::mul(a, c), V::mul(b, d));
+            y = V::add(V::mul(a, d), V::mul(b, c));
+        }
+        if (!nuo_complex_limited_range && V::nan2(x, y) != 0) {
+            nuo_complex_mul_scalar<T, Conj>(ar + i, ai + i, br + i, bi + i,
+                                            cr + i, ci + i, V::lanes);
+            continue;
+        }
+        V::storeu(cr + i, x);
+        V::storeu(ci + i, y);
+    }
+    nuo_complex_mul_scalar<T, Conj>(ar + i, ai + i, br + i, bi + i, cr + i,
+                                    ci + i, n - i);
+}
+
+template<typename T, bool Conj>
+NUOSTL_TARGET_AVX512 void nuo_complex_mul_avx512(const T* ar, const T* ai,
+                                                 const T* br, const T* bi,
+                                                 T* cr, T* ci,
+                                                 size_t n) noexcept {
+    using V = nuo_complex_vec_avx512<T>;
+    size_t i = 0;
+    for (; i + V::lanes <= n; i += V::lanes) {
+        typename V::reg a = V::loadu(ar + i), b = V::loadu(ai + i);
+        typename V::reg c = V::loadu(br + i), d = V::loadu(bi + i);
+        typename V::reg x, y;
+        if constexpr (Conj) {
+            x = V::add(V::mul(a, c), V::mul(b, d));
+            y = V::sub(V::mul(b, c), V::mul(a, d));
+        } else {
+            x = V::sub(V::mul(a, c), V::mul(b, d));
+            y = V::add(V::mul(a, d), V::mul(b, c));
+        }
+        if (!nuo_complex_limited_range && V::nan2(x, y) != 0) {
+            nuo_complex_mul_scalar<T, Conj>(ar + i, ai + i, br + i, bi + i,
+                                            cr + i, ci + i, V::lanes);
+            continue;
+        }
+        V::storeu(cr + i, x);
+        V::storeu(ci + i, y);
+    }
+    nuo_complex_mul_scalar<T, Conj>(ar + i, ai + i, br + i, bi + i, cr + i,
+                                    ci + i, n - i);
+}
+
+/*
+ * |z| as sqrt(a^2 + b^2), then hypot for the lanes where a^2 + b^2 left
+ * the normal range; the squared magnitude needs no check.
+ */
+template<typename T, bool Norm>
+NUOSTL_TARGET_AVX2 void nuo_complex_abs_avx2(const T* re, const T* im,
+                                             T* out, size_t n) noexcept {
+    using V = nuo_complex_vec_avx2<T>;
+    size_t i = 0;
+    for (; i + V::lanes <= n; i += V::lanes) {
+        typename V::reg a = V::loadu(re + i), b = V::loadu(im + i);
+        typename V::reg s = V::add(V::mul(a, a), V::mul(b, b));
+        if constexpr (Norm) {
+            V::storeu(out + i, s);
+        } else {
+            V::storeu(out + i, V::sqrt(s));
+            if (!nuo_complex_limited_range) {
+                unsigned bad = V::outside(s) & ~V::zero2(a, b);
+                for (; bad != 0; bad &= bad - 1) {
+                    size_t j = i + static_cast<size_t>(__builtin_ctz(bad));
+                    out[j] = nuo_complex_abs(re[j], im[j]);
+                }
+            }
+        }
+    }
+    if constexpr (Norm)
+        nuo_complex_norm_scalar(re + i, im + i, out + i, n - i);
+    else
+        nuo_complex_abs_scalar(re + i, im + i, out + i, n - i);
+}
+
+template<typename T, bool Norm>
+NUOSTL_TARGET_AVX512 void nuo_complex_abs_avx512(const T* re, const T* im,
+                                                 T* out, size_t n) noexcept {
+    using V = nuo_complex_vec_avx512<T>;
+    size_t i = 0;
+    for (; i + V::lanes <= n; i += V::lanes) {
+        typename V::reg a = V::loadu(re + i), b = V::loadu(im + i);
+        typename V::reg s = V::add(V::mul(a, a), V::mul(b, b));
+        if constexpr (Norm) {
+            V::storeu(out + i, s);
+        } else {
+            V::storeu(out + i, V::sqrt(s));
+            if (!nuo_complex_limited_range) {
+                unsigned bad = V::outside(s) & ~V::zero2(a, b);
+                for (; bad != 0; bad &= bad - 1) {
+                    size_t j = i + static_cast<size_t>(__builtin_ctz(bad));
+                    out[j] = nuo_complex_abs(re[j], im[j]);
+                }
+            }
+        }
+    }
+    if constexpr (Norm)
+        nuo_complex_norm_scalar(re + i, im + i, out + i, n - i);
+    else
+        nuo_complex_abs_scalar(re + i, im + i, out + i, n - i);
+}
+
+#pragma GCC diagnostic pop
+
+template<typename T>
+using nuo_complex_mul_fn = void(const T*, const T*, const T*, const T*, T*,
+                                T*, size_t);
+
+template<typename T>
+using nuo_complex_abs_fn = void(const T*, const T*, T*, size_t);
+
+template<typename T, bool Conj>
+inline constexpr nuo_dispatcher<nuo_complex_mul_fn<T>>
+    nuo_complex_mul_dispatch =
+        nuo_dispatcher<nuo_complex_mul_fn<T>>(
+            &nuo_complex_mul_scalar<T, Conj>)
+            .add(nuo_isa::avx2, &nuo_complex_mul_avx2<T, Conj>)
+            .add(nuo_isa::avx512, &nuo_complex_mul_avx512<T, Conj>);
+
+template<typename T, bool Norm>
+inline constexpr nuo_dispatcher<nuo_complex_abs_fn<T>>
+    nuo_complex_abs_dispatch =
+        nuo_dispatcher<nuo_complex_abs_fn<T>>(
+            Norm ? &nuo_complex_norm_scalar<T> : &nuo_complex_abs_scalar<T>)
+            .add(nuo_isa::avx2, &nuo_complex_abs_avx2<T, Norm>)
+            .add(nuo_isa::avx512, &nuo_complex_abs_avx512<T, Norm>);
+
+#endif  /* NUOSTL_ARCH_X86 */
+
+/* c[i] = a[i] * b[i], or a[i] * conj(b[i]), over split arrays */
+template<std::floating_point T, bool Conj>
+void nuo_complex_mul_n(const T* ar, const T* ai, const T* br, const T* bi,
+                       T* cr, T* ci, size_t n) {
+#if defined(NUOSTL_ARCH_X86)
+    if constexpr (nuo_complex_simd_eligible<T>) {
+        nuo_complex_mul_dispatch<T, Conj>(ar, ai, br, bi, cr, ci, n);
+        return;
+    }
+#endif
+    nuo_complex_mul_scalar<T, Conj>(ar, ai, br, bi, cr, ci, n);
+}
+
+/* out[i] = |z[i]|, or |z[i]|^2 */
+template<std::floating_point T, bool Norm>
+void nuo_complex_abs_n(const T* re, const T* im, T* out, size_t n) {
+#if defined(NUOSTL_ARCH_X86)
+    if constexpr (nuo_complex_simd_eligible<T>) {
+        nuo_complex_abs_dispatch<T, Norm>(re, im, out, n);
+        return;
+    }
+#endif
+    if constexpr (Norm)
+        nuo_complex_norm_scalar(re, im, out, n);
+    else
+        nuo_complex_abs_scalar(re, im, out, n);
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_FFT_HPP_
+#define NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_FFT_HPP_
+
+#include <stddef.h>
+
+#include <cmath>
+#include <vector>
+
+#include "./nuo_ntt.hpp"
+
+/*
+ * Complex double FFT for real convolutions. Same layout as the NTT:
+ * decimation in frequency forward (bit reversed out), decimation in time
+ * inverse, so no permutation pass. Twiddles are computed directly with
+ * cos/sin rather than by repeated multiplication to keep the error at
+ * O(eps log n).
+ */
+
+namespace nuostl {
+namespace detail {
+
+/* plain struct, std::complex multiplication goes through __muldc3 */
+struct nuo_fft_cd {
+    double re, im;
+};
+
+class nuo_fft_plan {
+public:
+    unsigned log_n;
+    std::vector<nuo_fft_cd> w;  /* w[h + j] = exp(-i pi j / h) */
+
+    explicit nuo_fft_plan(unsigned lg) : log_n(lg), w(size_t(1) << lg) {
+        const double pi = 3.14159265358979323846;
+        for (size_t h = 1; h < (size_t(1) << lg); h <<= 1) {
+            for (size_t j = 0; j < h; j++) {
+                double t = -pi * static_cast<double>(j) / static_cast<double>(h);
+                w[h + j] = {std::cos(t), std::sin(t)};
+            }
+        }
+    }
+
+    void forward(nuo_fft_cd* a) const noexcept {
+        const size_t n = size_t(1) << log_n;
+        for (size_t h = n >> 1; h >= 1; h >>= 1) {
+            const nuo_fft_cd* tw = w.data() + h;
+            for (size_t s = 0; s < n; s += 2 * h) {
+                nuo_fft_cd* x = a + s;
+                nuo_fft_cd* y = a + s + h;
+                for (size_t j = 0; j < h; j++) {
+                    double dr = x[j].re - y[j].re, di = x[j].im - y[j].im;
+                    x[j].re += y[j].re;
+                    x[j].im += y[j].im;
+                    y[j].re = dr * tw[j].re - di * tw[j].im;
+                    y[j].im = dr * tw[j].im + di * tw[j].re;
+                }
+            }
+        }
+    }
+
+    /* n times the inverse, conjugate twiddles */
+    void inverse(nuo_fft_cd* a) const noexcept {
+        const size_t n = size_t(1) << log_n;
+        for (size_t h = 1; h < n; h <<= 1) {
+            const nuo_fft_cd* tw = w.data() + h;
+            for (size_t s = 0; s < n; s += 2 * h) {
+                nuo_fft_cd* x = a + s;
+                nuo_fft_cd* y = a + s + h;
+                for (size_t j = 0; j < h; j++) {
+                    double vr = y[j].re * tw[j].re + y[j].im * tw[j].im;
+                    double vi = y[j].im * tw[j].re - y[j].re * tw[j].im;
+                    y[j].re = x[j].re - vr;
+                    y[j].im = x[j].im - vi;
+                    x[j].re += vr;
+                    x[j].im += vi;
+                }
+            }
+        }
+    }
+};
+
+/*
+ * out[0, na + nb - 1) = a * b with one forward and one inverse transform:
+ * with z = a + i b, (z * z) = a*a - b*b + 2i a*b, so the convolution is
+ * the imaginary part of the inverse of Z^2, halved.
+ */
+inline void nuo_fft_convolve(const double* a, size_t na, const double* b,
+                             size_t nb, double* out) {
+    const size_t nc = na + nb - 1;
+    const unsigned lg = nuo_ntt_log2_ceil(nc);
+    const size_t n = size_t(1) << lg;
+    nuo_fft_plan plan(lg);
+    std::vector<nuo_fft_cd> z(n, nuo_fft_cd{0, 0});
+    for (size_t i = 0; i < na; i++)
+        z[i].re = a[i];
+    for (size_t i = 0; i < nb; i++)
+        z[i].im = b[i];
+    plan.forward(z.data());
+    for (size_t i = 0; i < n; i++) {
+        double re = z[i].re, im = z[i].im;
+        z[i] = {re * re - im * im, 2 * re * im};
+    }
+    plan.inverse(z.data());
+    const double scale = 0.5 / static_cast<double>(n);
+    for (size_t i = 0; i < nc; i++)
+        out[i] = z[i].im * scale;
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
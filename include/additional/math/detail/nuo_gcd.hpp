@@ -0,0 +1,46 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_GCD_HPP_
+#define NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_GCD_HPP_
+
+#include <concepts>
+
+namespace nuostl {
+namespace detail {
+
+template<std::unsigned_integral U>
+constexpr int nuo_ctz(U x) noexcept {
+    if constexpr (sizeof(U) <= sizeof(unsigned))
+        return __builtin_ctz(x);
+    else
+        return __builtin_ctzll(x);
+}
+
+/*
+ * Binary (Stein) GCD: the common power of two comes out with one ctz, then
+ * both operands stay odd and the larger is replaced by the difference,
+ * stripped of its trailing zeros. No division, about one iteration per
+ * bit removed. gcd(0, b) = b.
+ */
+template<std::unsigned_integral U>
+constexpr U nuo_gcd_binary(U a, U b) noexcept {
+    if (a == 0)
+        return b;
+    if (b == 0)
+        return a;
+    int shift = nuo_ctz<U>(static_cast<U>(a | b));
+    a >>= nuo_ctz(a);
+    do {
+        b >>= nuo_ctz(b);
+        if (a > b) {
+            U t = a;
+            a = b;
+            b = t;
+        }
+        b -= a;
+    } while (b != 0);
+    return static_cast<U>(a << shift);
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,597 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_GEMM_HPP_
+#define NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_GEMM_HPP_
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+
+#include "../../../core/dispatch/nuo_cpu_dispatch.hpp"
+#include "./nuo_thread_team.hpp"
+
+#if defined(NUOSTL_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+/*
+ * C = alpha A B + beta C on row-major operands, the product behind
+ * nuo_matrix.
+ *
+ * Large products follow the usual blocked layout: B is packed KC x NC at a
+ * time into NR-column slivers (the panel lives in L3, one sliver in L1), A
+ * MC x KC at a time into MR-row slivers (the block lives in L2), and a
+ * register-blocked micro-kernel accumulates one MR x NR tile of C over KC
+ * with broadcast FMAs. Packing pads the edges with zeros, so the kernel
+ * always runs full tiles and edge tiles go through a scratch tile.
+ *
+ * float and double get AVX2 (6 x 2 vectors) and AVX-512 (8 x 3 vectors)
+ * kernels through nuo_dispatcher; every other T, and the scalar level,
+ * runs the same blocking with a 4 x 8 scalar kernel. Products below
+ * NUOSTL_GEMM_SMALL_THRESHOLD multiply-adds skip the packing and run a
+ * row-wise loop. Above NUOSTL_GEMM_PARALLEL_THRESHOLD multiply-adds per
+ * thread the MC blocks (and, when there are few, NR slivers within them)
+ * are split across nuo_thread_team.
+ *
+ * When beta is zero C is only written, like BLAS.
+ */
+
+#if !defined(NUOSTL_GEMM_SMALL_THRESHOLD)
+#define NUOSTL_GEMM_SMALL_THRESHOLD 256
+#endif
+#if !defined(NUOSTL_GEMM_PARALLEL_THRESHOLD)
+#define NUOSTL_GEMM_PARALLEL_THRESHOLD 4194304
+#endif
+
+namespace nuostl {
+namespace detail {
+
+inline constexpr size_t nuo_gemm_small_threshold = NUOSTL_GEMM_SMALL_THRESHOLD;
+inline constexpr size_t nuo_gemm_parallel_threshold =
+    NUOSTL_GEMM_PARALLEL_THRESHOLD;
+
+template<typename T>
+struct nuo_gemm_args {
+    size_t m, n, k;
+    T alpha;
+    const T* a;
+    size_t lda;
+    const T* b;
+    size_t ldb;
+    T beta;
+    T* c;
+    size_t ldc;
+};
+
+/*
+ * Packing space, 64-byte aligned and uninitialized. One per calling
+ * thread, grown on demand and kept, so repeated products do not pay for
+ * fresh pages each call.
+ */
+template<typename T>
+class nuo_gemm_scratch {
+private:
+    T* p_ = nullptr;
+    size_t cap_ = 0;
+
+public:
+    nuo_gemm_scratch() = default;
+    nuo_gemm_scratch(const nuo_gemm_scratch&) = delete;
+    nuo_gemm_scratch& operator=(const nuo_gemm_scratch&) = delete;
+
+    ~nuo_gemm_scratch() {
+        free(p_);
+    }
+
+    T* get(size_t n) {
+        if (n > cap_) {
+            size_t bytes = (n * sizeof(T) + 63) & ~static_cast<size_t>(63);
+            T* p = static_cast<T*>(aligned_alloc(64, bytes));
+            if (p == nullptr)
+                throw std::bad_alloc();
+            free(p_);
+            p_ = p;
+            cap_ = n;
+        }
+        return p_;
+    }
+
+    static nuo_gemm_scratch& local() {
+        thread_local nuo_gemm_scratch s;
+        return s;
+    }
+};
+
+constexpr size_t nuo_gemm_round_up(size_t x, size_t m) noexcept {
+    return (x + m - 1) / m * m;
+}
+
+/* c = alpha acc + beta c over an mr x nr tile, c not read when beta == 0 */
+template<typename T>
+inline void nuo_gemm_store(const T* acc, size_t ldacc, size_t mr, size_t nr,
+                           T* c, size_t ldc, T alpha, T beta) noexcept {
+    for (size_t i = 0; i < mr; i++) {
+        const T* s = acc + i * ldacc;
+        T* d = c + i * ldc;
+        if (beta == T(0)) {
+            for (size_t j = 0; j < nr; j++)
+                d[j] = alpha * s[j];
+        } else {
+            for (size_t j = 0; j < nr; j++)
+                d[j] = alpha * s[j] + beta * d[j];
+        }
+    }
+}
+
+/* C *= beta, zero-filled when beta == 0 */
+template<typename T>
+void nuo_gemm_scale(size_t m, size_t n, T beta, T* c, size_t ldc) noexcept {
+    if (beta == T(1))
+        return;
+    for (size_t i = 0; i < m; i++) {
+        T* d = c + i * ldc;
+        if (beta == T(0)) {
+            std::fill(d, d + n, T(0));
+        } else {
+            for (size_t j = 0; j < n; j++)
+                d[j] = beta * d[j];
+        }
+    }
+}
+
+/* Unpacked i-k-j loop for small products */
+template<typename T>
+void nuo_gemm_rowwise(const nuo_gemm_args<T>& g) noexcept {
+    for (size_t i = 0; i < g.m; i++) {
+        T* c = g.c + i * g.ldc;
+        const T* a = g.a + i * g.lda;
+        nuo_gemm_scale(1, g.n, g.beta, c, g.ldc);
+        for (size_t p = 0; p < g.k; p++) {
+            T s = g.alpha * a[p];
+            const T* b = g.b + p * g.ldb;
+            for (size_t j = 0; j < g.n; j++)
+                c[j] += s * b[j];
+        }
+    }
+}
+
+/* ------------------------------------------------- */
+/* Packing */
+
+/* mc x kc block of A into MR-row slivers, ap[p * MR + i] */
+template<typename T, size_t MR>
+void nuo_gemm_pack_a(const T* a, size_t lda, size_t mc, size_t kc,
+                     T* ap) noexcept {
+    for (size_t ir = 0; ir < mc; ir += MR) {
+        size_t mr = std::min(MR, mc - ir);
+        const T* s = a + ir * lda;
+        if (mr == MR) {
+            for (size_t p = 0; p < kc; p++) {
+                for (size_t i = 0; i < MR; i++)
+                    ap[p * MR + i] = s[i * lda + p];
+            }
+        } else {
+            for (size_t p = 0; p < kc; p++) {
+                for (size_t i = 0; i < mr; i++)
+                    ap[p * MR + i] = s[i * lda + p];
+                for (size_t i = mr; i < MR; i++)
+                    ap[p * MR + i] = T(0);
+            }
+        }
+        ap += MR * kc;
+    }
+}
+
+/* kc x nc panel of B into NR-column slivers, bp[p * NR + j] */
+template<typename T, size_t NR>
+void nuo_gemm_pack_b(const T* b, size_t ldb, size_t kc, size_t nc,
+                     T* bp) noexcept {
+    for (size_t jr = 0; jr < nc; jr += NR) {
+        size_t nr = std::min(NR, nc - jr);
+        const T* s = b + jr;
+        if (nr == NR) {
+            for (size_t p = 0; p < kc; p++)
+                std::copy(s + p * ldb, s + p * ldb + NR, bp + p * NR);
+        } else {
+            for (size_t p = 0; p < kc; p++) {
+                std::copy(s + p * ldb, s + p * ldb + nr, bp + p * NR);
+                std::fill(bp + p * NR + nr, bp + (p + 1) * NR, T(0));
+            }
+        }
+        bp += NR * kc;
+    }
+}
+
+/* ------------------------------------------------- */
+/* Micro-kernels: c[0, MR) x [0, NR) = alpha a b + beta c over kc */
+
+template<typename T>
+struct nuo_gemm_kernel_scalar {
+    static constexpr size_t mr = 4;
+    static constexpr size_t nr = 8;
+    static constexpr size_t kc = 256;
+    static constexpr size_t mc = 128;
+    static constexpr size_t nc = 2048;
+
+    static void micro(size_t k, const T* a, const T* b, T* c, size_t ldc,
+                      T alpha, T beta) noexcept {
+        T acc[mr * nr];
+        std::fill(acc, acc + mr * nr, T(0));
+        for (size_t p = 0; p < k; p++) {
+            for (size_t i = 0; i < mr; i++) {
+                T ai = a[i];
+                for (size_t j = 0; j < nr; j++)
+                    acc[i * nr + j] += ai * b[j];
+            }
+            a += mr;
+            b += nr;
+        }
+        nuo_gemm_store(acc, nr, mr, nr, c, ldc, alpha, beta);
+    }
+};
+
+#if defined(NUOSTL_ARCH_X86)
+
+/* gcc 12 warns on the _mm512_undefined_* placeholders inside intrinsics */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+
+template<typename T>
+struct nuo_gemm_vec_avx2;
+
+template<>
+struct nuo_gemm_vec_avx2<double> {
+    using reg = __m256d;
+    static constexpr size_t lanes = 4;
+    NUOSTL_TARGET_AVX2 static reg zero() { return _mm256_setzero_pd(); }
+    NUOSTL_TARGET_AVX2 static reg set1(double x) { return _mm256_set1_pd(x); }
+    NUOSTL_TARGET_AVX2 static reg load(const double* p) { return _mm256_load_pd(p); }
+    NUOSTL_TARGET_AVX2 static reg loadu(const double* p) { return _mm256_loadu_pd(p); }
+    NUOSTL_TARGET_AVX2 static void storeu(double* p, reg x) { _mm256_storeu_pd(p, x); }
+    NUOSTL_TARGET_AVX2 static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+    NUOSTL_TARGET_AVX2 static reg fma(reg a, reg b, reg c) { return _mm256_fmadd_pd(a, b, c); }
+};
+
+template<>
+struct nuo_gemm_vec_avx2<float> {
+    using reg = __m256;
+    static constexpr size_t lanes = 8;
+    NUOSTL_TARGET_AVX2 static reg zero() { return _mm256_setzero_ps(); }
+    NUOSTL_TARGET_AVX2 static reg set1(float x) { return _mm256_set1_ps(x); }
+    NUOSTL_TARGET_AVX2 static reg load(const float* p) { return _mm256_load_ps(p); }
+    NUOSTL_TARGET_AVX2 static reg loadu(const float* p) { return _mm256_loadu_ps(p); }
+    NUOSTL_TARGET_AVX2 static void storeu(float* p, reg x) { _mm256_storeu_ps(p, x); }
+    NUOSTL_TARGET_AVX2 static reg mul(reg a, reg b) { return _mm256_mul_ps(a, b); }
+    NUOSTL_TARGET_AVX2 static reg fma(reg a, reg b, reg c) { return _mm256_fmadd_ps(a, b, c); }
+};
+
+template<typename T>
+struct nuo_gemm_vec_avx512;
+
+template<>
+struct nuo_gemm_vec_avx512<double> {
+    using reg = __m512d;
+    static constexpr size_t lanes = 8;
+    NUOSTL_TARGET_AVX512 static reg zero() { return _mm512_setzero_pd(); }
+    NUOSTL_TARGET_AVX512 static reg set1(double x) { return _mm512_set1_pd(x); }
+    NUOSTL_TARGET_AVX512 static reg load(const double* p) { return _mm512_load_pd(p); }
+    NUOSTL_TARGET_AVX512 static reg loadu(const double* p) { return _mm512_loadu_pd(p); }
+    NUOSTL_TARGET_AVX512 static void storeu(double* p, reg x) { _mm512_storeu_pd(p, x); }
+    NUOSTL_TARGET_AVX512 static reg mul(reg a, reg b) { return _mm512_mul_pd(a, b); }
+    NUOSTL_TARGET_AVX512 static reg fma(reg a, reg b, reg c) { return _mm512_fmadd_pd(a, b, c); }
+};
+
+template<>
+struct nuo_gemm_vec_avx512<float> {
+    using reg = __m512;
+    static constexpr size_t lanes = 16;
+    NUOSTL_TARGET_AVX512 static reg zero() { return _mm512_setzero_ps(); }
+    NUOSTL_TARGET_AVX512 static reg set1(float x) { return _mm512_set1_ps(x); }
+    NUOSTL_TARGET_AVX512 static reg load(const float* p) { return _mm512_load_ps(p); }
+    NUOSTL_TARGET_AVX512 static reg loadu(const float* p) { return _mm512_loadu_ps(p); }
+    NUOSTL_TARGET_AVX512 static void storeu(float* p, reg x) { _mm512_storeu_ps(p, x); }
+    NUOSTL_TARGET_AVX512 static reg mul(reg a, reg b) { return _mm512_mul_ps(a, b); }
+    NUOSTL_TARGET_AVX512 static reg fma(reg a, reg b, reg c) { return _mm512_fmadd_ps(a, b, c); }
+};
+
+/*
+ * MR x NV vector accumulators stay in registers: per k step NV aligned
+ * loads from the B sliver, MR broadcasts from the A sliver, MR * NV FMAs.
+ */
+template<typename T, size_t MR, size_t NV>
+NUOSTL_TARGET_AVX2 void nuo_gemm_micro_avx2(size_t kc, const T* a, const T* b,
+                                            T* c, size_t ldc, T alpha,
+                                            T beta) noexcept {
+    using V = nuo_gemm_vec_avx2<T>;
+    using reg = typename V::reg;
+    constexpr size_t L = V::lanes;
+    reg acc[MR][NV];
+#pragma GCC unroll 32
+    for (size_t i = 0; i < MR; i++) {
+#pragma GCC unroll 8
+        for (size_t v = 0; v < NV; v++)
+            acc[i][v] = V::zero();
+    }
+#pragma GCC unroll 32
+    for (size_t i = 0; i < MR; i++) {
+#pragma GCC unroll 8
+        for (size_t v = 0; v < NV * L * sizeof(T); v += 64)
+            _mm_prefetch(reinterpret_cast<const char*>(c + i * ldc) + v,
+                         _MM_HINT_T0);
+    }
+#pragma GCC unroll 4
+    for (size_t p = 0; p < kc; p++) {
+        reg bv[NV];
+#pragma GCC unroll 8
+        for (size_t v = 0; v < NV; v++)
+            bv[v] = V::load(b + v * L);
+#pragma GCC unroll 32
+        for (size_t i = 0; i < MR; i++) {
+            reg ai = V::set1(a[i]);
+#pragma GCC unroll 8
+            for (size_t v = 0; v < NV; v++)
+                acc[i][v] = V::fma(ai, bv[v], acc[i][v]);
+        }
+        a += MR;
+        b += NV * L;
+    }
+    reg va = V::set1(alpha);
+    if (beta == T(0)) {
+#pragma GCC unroll 32
+        for (size_t i = 0; i < MR; i++) {
+#pragma GCC unroll 8
+            for (size_t v = 0; v < NV; v++)
+                V::storeu(c + i * ldc + v * L, V::mul(va, acc[i][v]));
+        }
+    } else {
+        reg vb = V::set1(beta);
+#pragma GCC unroll 32
+        for (size_t i = 0; i < MR; i++) {
+#pragma GCC unroll 8
+            for (size_t v = 0; v < NV; v++) {
+                T* d = c + i * ldc + v * L;
+                V::storeu(d, V::fma(vb, V::loadu(d), V::mul(va, acc[i][v])));
+            }
+        }
+    }
+}
+
+template<typename T, size_t MR, size_t NV>
+NUOSTL_TARGET_AVX512 void nuo_gemm_micro_avx512(size_t kc, const T* a,
+                                                const T* b, T* c, size_t ldc,
+                                                T alpha, T beta) noexcept {
+    using V = nuo_gemm_vec_avx512<T>;
+    using reg = typename V::reg;
+    constexpr size_t L = V::lanes;
+    reg acc[MR][NV];
+#pragma GCC unroll 32
+    for (size_t i = 0; i < MR; i++) {
+#pragma GCC unroll 8
+        for (size_t v = 0; v < NV; v++)
+            acc[i][v] = V::zero();
+    }
+#pragma GCC unroll 32
+    for (size_t i = 0; i < MR; i++) {
+#pragma GCC unroll 8
+        for (size_t v = 0; v < NV * L * sizeof(T); v += 64)
+            _mm_prefetch(reinterpret_cast<const char*>(c + i * ldc) + v,
+                         _MM_HINT_T0);
+    }
+#pragma GCC unroll 4
+    for (size_t p = 0; p < kc; p++) {
+        reg bv[NV];
+#pragma GCC unroll 8
+        for (size_t v = 0; v < NV; v++)
+            bv[v] = V::load(b + v * L);
+#pragma GCC unroll 32
+        for (size_t i = 0; i < MR; i++) {
+            reg ai = V::set1(a[i]);
+#pragma GCC unroll 8
+            for (size_t v = 0; v < NV; v++)
+                acc[i][v] = V::fma(ai, bv[v], acc[i][v]);
+        }
+        a += MR;
+        b += NV * L;
+    }
+    reg va = V::set1(alpha);
+    if (beta == T(0)) {
+#pragma GCC unroll 32
+        for (size_t i = 0; i < MR; i++) {
+#pragma GCC unroll 8
+            for (size_t v = 0; v < NV; v++)
+                V::storeu(c + i * ldc + v * L, V::mul(va, acc[i][v]));
+        }
+    } else {
+        reg vb = V::set1(beta);
+#pragma GCC unroll 32
+        for (size_t i = 0; i < MR; i++) {
+#pragma GCC unroll 8
+            for (size_t v = 0; v < NV; v++) {
+                T* d = c + i * ldc + v * L;
+                V::storeu(d, V::fma(vb, V::loadu(d), V::mul(va, acc[i][v])));
+            }
+        }
+    }
+}
+
+#pragma GCC diagnostic pop
+
+/* 12 of 16 ymm registers accumulate */
+template<typename T>
+struct nuo_gemm_kernel_avx2 {
+    static constexpr size_t mr = 6;
+    static constexpr size_t nr = 2 * nuo_gemm_vec_avx2<T>::lanes;
+    static constexpr size_t kc = 256;
+    static constexpr size_t mc = 72;
+    static constexpr size_t nc = 4096;
+
+    static void micro(size_t k, const T* a, const T* b, T* c, size_t ldc,
+                      T alpha, T beta) noexcept {
+        nuo_gemm_micro_avx2<T, mr, 2>(k, a, b, c, ldc, alpha, beta);
+    }
+};
+
+/* 24 of 32 zmm registers accumulate */
+template<typename T>
+struct nuo_gemm_kernel_avx512 {
+    static constexpr size_t mr = 8;
+    static constexpr size_t nr = 3 * nuo_gemm_vec_avx512<T>::lanes;
+    static constexpr size_t kc = 256;
+    static constexpr size_t mc = 96;
+    static constexpr size_t nc = 4080;
+
+    static void micro(size_t k, const T* a, const T* b, T* c, size_t ldc,
+                      T alpha, T beta) noexcept {
+        nuo_gemm_micro_avx512<T, mr, 3>(k, a, b, c, ldc, alpha, beta);
+    }
+};
+
+#endif  /* NUOSTL_ARCH_X86 */
+
+/* ------------------------------------------------- */
+/* Blocked driver */
+
+/* Threads for an m x n x k product, 1 below the parallel threshold */
+inline size_t nuo_gemm_threads(size_t m, size_t n, size_t k) {
+    double work = static_cast<double>(m) * static_cast<double>(n) *
+                  static_cast<double>(k);
+    double t = work / static_cast<double>(nuo_gemm_parallel_threshold);
+    size_t limit = nuo_thread_team_size();
+    if (t < 2.0 || limit <= 1)
+        return 1;
+    return t >= static_cast<double>(limit) ? limit : static_cast<size_t>(t);
+}
+
+/* Slivers [j0, j1) of the packed panel against one packed A block */
+template<typename T, typename K>
+void nuo_gemm_macro(size_t mc, size_t nc, size_t kc, const T* ap,
+                    const T* bp, size_t j0, size_t j1, T* c, size_t ldc,
+                    T alpha, T beta) noexcept {
+    constexpr size_t MR = K::mr, NR = K::nr;
+    for (size_t js = j0; js < j1; js++) {
+        size_t jr = js * NR;
+        size_t nr = std::min(NR, nc - jr);
+        const T* b = bp + js * NR * kc;
+        for (size_t ir = 0; ir < mc; ir += MR) {
+            size_t mr = std::min(MR, mc - ir);
+            const T* a = ap + ir * kc;
+            T* d = c + ir * ldc + jr;
+            if (mr == MR && nr == NR) {
+                K::micro(kc, a, b, d, ldc, alpha, beta);
+            } else {
+                alignas(64) T tile[MR * NR];
+                K::micro(kc, a, b, tile, NR, T(1), T(0));
+                nuo_gemm_store(tile, NR, mr, nr, d, ldc, alpha, beta);
+            }
+        }
+    }
+}
+
+template<typename T, typename K>
+void nuo_gemm_blocked(const nuo_gemm_args<T>& g) {
+    constexpr size_t MR = K::mr, NR = K::nr;
+    const size_t kcmax = std::min(K::kc, g.k);
+    const size_t ncmax = std::min(K::nc, nuo_gemm_round_up(g.n, NR));
+    const size_t mcmax = std::min(K::mc, nuo_gemm_round_up(g.m, MR));
+    const size_t threads = nuo_gemm_threads(g.m, g.n, g.k);
+    T* bp = nuo_gemm_scratch<T>::local().get(kcmax * (ncmax + threads * mcmax));
+    T* abase = bp + kcmax * ncmax;
+    nuo_thread_team& team = nuo_thread_team::instance();
+
+    const size_t mblocks = (g.m + K::mc - 1) / K::mc;
+    /* with fewer blocks than threads, each block is shared by split threads */
+    const size_t split = (threads + mblocks - 1) / mblocks;
+    const size_t items = mblocks * split;
+
+    for (size_t jc = 0; jc < g.n; jc += K::nc) {
+        const size_t nc = std::min(K::nc, g.n - jc);
+        const size_t slivers = (nc + NR - 1) / NR;
+        for (size_t pc = 0; pc < g.k; pc += K::kc) {
+            const size_t kc = std::min(K::kc, g.k - pc);
+            const T beta = pc == 0 ? g.beta : T(1);
+            const T* b = g.b + pc * g.ldb + jc;
+
+            team.run(threads, [&](size_t t) {
+                size_t s0 = slivers * t / threads;
+                size_t s1 = slivers * (t + 1) / threads;
+                if (s0 < s1)
+                    nuo_gemm_pack_b<T, NR>(b + s0 * NR, g.ldb, kc,
+                                           std::min(nc, s1 * NR) - s0 * NR,
+                                           bp + s0 * NR * kc);
+            });
+
+            team.run(threads, [&](size_t t) {
+                T* ap = abase + t * mcmax * kcmax;
+                size_t packed = mblocks;
+                for (size_t it = items * t / threads;
+                     it < items * (t + 1) / threads; it++) {
+                    size_t ib = it / split, part = it % split;
+                    size_t ic = ib * K::mc;
+                    size_t mc = std::min(K::mc, g.m - ic);
+                    if (packed != ib) {
+                        nuo_gemm_pack_a<T, MR>(g.a + ic * g.lda + pc, g.lda,
+                                               mc, kc, ap);
+                        packed = ib;
+                    }
+                    nuo_gemm_macro<T, K>(mc, nc, kc, ap, bp,
+                                         slivers * part / split,
+                                         slivers * (part + 1) / split,
+                                         g.c + ic * g.ldc + jc, g.ldc,
+                                         g.alpha, beta);
+                }
+            });
+        }
+    }
+}
+
+template<typename T>
+inline constexpr bool nuo_gemm_simd_eligible =
+#if defined(NUOSTL_ARCH_X86)
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+#else
+    false;
+#endif
+
+#if defined(NUOSTL_ARCH_X86)
+
+template<typename T>
+inline constexpr nuo_dispatcher<void(const nuo_gemm_args<T>&)>
+    nuo_gemm_dispatch =
+        nuo_dispatcher<void(const nuo_gemm_args<T>&)>(
+            &nuo_gemm_blocked<T, nuo_gemm_kernel_scalar<T>>)
+            .add(nuo_isa::avx2, &nuo_gemm_blocked<T, nuo_gemm_kernel_avx2<T>>)
+            .add(nuo_isa::avx512,
+                 &nuo_gemm_blocked<T, nuo_gemm_kernel_avx512<T>>);
+
+#endif  /* NUOSTL_ARCH_X86 */
+
+/* C = alpha A B + beta C, A m x k, B k x n, C m x n, C not overlapping A, B */
+template<typename T>
+void nuo_gemm(const nuo_gemm_args<T>& g) {
+    if (g.m == 0 || g.n == 0)
+        return;
+    if (g.k == 0 || g.alpha == T(0)) {
+        nuo_gemm_scale(g.m, g.n, g.beta, g.c, g.ldc);
+        return;
+    }
+    if (static_cast<double>(g.m) * static_cast<double>(g.n) *
+            static_cast<double>(g.k) <
+        static_cast<double>(nuo_gemm_small_threshold)) {
+        nuo_gemm_rowwise(g);
+        return;
+    }
+#if defined(NUOSTL_ARCH_X86)
+    if constexpr (nuo_gemm_simd_eligible<T>) {
+        nuo_gemm_dispatch<T>(g);
+        return;
+    }
+#endif
+    nuo_gemm_blocked<T, nuo_gemm_kernel_scalar<T>>(g);
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,347 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_NTT_HPP_
+#define NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_NTT_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+/*
+ * Number theoretic transform over three 62-bit primes p = c 2^k + 1
+ * (k >= 41) with 64-bit Montgomery arithmetic (Shoup's precomputed
+ * quotients for the twiddle factors), and the CRT to recombine the
+ * residues of up to three primes.
+ *
+ * A convolution whose coefficients are below P/2 in absolute value, P the
+ * product of the primes used, comes out exact: one prime covers about 61
+ * bits, three about 185 bits, e.g. a length 2^20 convolution of arbitrary
+ * 64-bit words.
+ *
+ * The forward transform is decimation in frequency (natural order in, bit
+ * reversed out), the inverse decimation in time (bit reversed in, natural
+ * out), so no bit reversal permutation is ever done.
+ */
+
+namespace nuostl {
+namespace detail {
+
+using nuo_u128 = unsigned __int128;
+
+struct nuo_ntt_prime {
+    uint64_t p;
+    uint64_t g;         /* primitive root */
+    uint64_t nip;       /* -p^-1 mod 2^64 */
+    uint64_t r1;        /* 2^64 mod p */
+    uint64_t r2;        /* 2^128 mod p */
+
+    constexpr nuo_ntt_prime(uint64_t prime, uint64_t root)
+        : p(prime), g(root), nip(0), r1(0), r2(0) {
+        uint64_t inv = prime;           /* Newton: correct to 3 bits */
+        for (int i = 0; i < 5; i++)
+            inv *= 2 - prime * inv;
+        nip = 0 - inv;
+        r1 = static_cast<uint64_t>((nuo_u128(1) << 64) % prime);
+        r2 = static_cast<uint64_t>(nuo_u128(r1) * r1 % prime);
+    }
+
+    /* a b 2^-64 mod p for a b < 2^64 p, result in [0, p) */
+    constexpr uint64_t mul(uint64_t a, uint64_t b) const noexcept {
+        nuo_u128 t = nuo_u128(a) * b;
+        uint64_t m = static_cast<uint64_t>(t) * nip;
+        uint64_t u = static_cast<uint64_t>((t + nuo_u128(m) * p) >> 64);
+        return u >= p ? u - p : u;
+    }
+    constexpr uint64_t add(uint64_t a, uint64_t b) const noexcept {
+        uint64_t s = a + b;
+        return s >= p ? s - p : s;
+    }
+    constexpr uint64_t sub(uint64_t a, uint64_t b) const noexcept {
+        return a >= b ? a - b : a + p - b;
+    }
+    constexpr uint64_t to_mont(uint64_t a) const noexcept { return mul(a, r2); }
+    constexpr uint64_t from_mont(uint64_t a) const noexcept { return mul(a, 1); }
+
+    /* a^e, a and the result in Montgomery form */
+    constexpr uint64_t pow_mont(uint64_t a, uint64_t e) const noexcept {
+        uint64_t r = r1;
+        while (e != 0) {
+            if (e & 1)
+                r = mul(r, a);
+            a = mul(a, a);
+            e >>= 1;
+        }
+        return r;
+    }
+
+    /* a^-1 mod p in Montgomery form, a in Montgomery form */
+    constexpr uint64_t inv_mont(uint64_t a) const noexcept {
+        return pow_mont(a, p - 2);
+    }
+
+    /* residue of a word */
+    constexpr uint64_t reduce(uint64_t a) const noexcept {
+        return a >= p ? a % p : a;
+    }
+    constexpr uint64_t reduce_signed(int64_t a) const noexcept {
+        if (a >= 0)
+            return reduce(static_cast<uint64_t>(a));
+        uint64_t m = reduce(0 - static_cast<uint64_t>(a));
+        return m == 0 ? 0 : p - m;
+    }
+};
+
+inline constexpr nuo_ntt_prime nuo_ntt_primes[3] = {
+    nuo_ntt_prime(0x3fffc00000000001ull, 11),   /* 2^46 | p - 1 */
+    nuo_ntt_prime(0x3fffbe0000000001ull, 3),    /* 2^41 | p - 1 */
+    nuo_ntt_prime(0x3fff840000000001ull, 19),   /* 2^42 | p - 1 */
+};
+
+/* Bits each prime adds to the exact range, floor(log2 p) */
+inline constexpr unsigned nuo_ntt_prime_bits = 61;
+
+/* Transform length limit of the prime set, 2^41 */
+inline constexpr unsigned nuo_ntt_max_log = 41;
+
+/* A twiddle factor and its Shoup quotient floor(w 2^64 / p) */
+struct nuo_ntt_twiddle {
+    uint64_t w, q;
+};
+
+/*
+ * Twiddles of one prime for transforms of length 2^log_n: w[h + j] is
+ * omega_2h^j, h a power of two, each level contiguous. The inverse needs
+ * omega_2h^-j = -omega_2h^(h - j) and reads the same table backwards.
+ *
+ * Multiplying by a fixed twiddle through its Shoup quotient is two
+ * multiplies and no reduction, and the butterflies keep values lazily in
+ * [0, 2p) (Harvey), which 62-bit primes allow.
+ */
+class nuo_ntt_plan {
+public:
+    const nuo_ntt_prime& prime;
+    unsigned log_n;
+    std::vector<nuo_ntt_twiddle> w;
+
+    nuo_ntt_plan(const nuo_ntt_prime& p, unsigned lg)
+        : prime(p), log_n(lg), w(size_t(1) << lg) {
+        const nuo_ntt_prime& P = prime;
+        if (lg == 0)
+            return;
+        /* the root of order 2h is the square of the one of order 4h */
+        uint64_t roots[nuo_ntt_max_log];
+        roots[lg - 1] = P.pow_mont(P.to_mont(P.g), (P.p - 1) >> lg);
+        for (unsigned k = lg - 1; k-- > 0; )
+            roots[k] = P.mul(roots[k + 1], roots[k + 1]);
+        for (size_t h = 1, k = 0; h < w.size(); h <<= 1, k++) {
+            const uint64_t root = roots[k];
+            uint64_t x = P.r1;
+            for (size_t j = 0; j < h; j++) {
+                /* x = w 2^64 mod p, so w 2^64 - x = q p, q = -x / p */
+                w[h + j] = {P.from_mont(x), x * P.nip};
+                x = P.mul(x, root);
+            }
+        }
+    }
+
+    /* x w mod p in [0, 2p) for any 64-bit x */
+    static uint64_t mul_shoup(uint64_t x, nuo_ntt_twiddle t,
+                              uint64_t p) noexcept {
+        uint64_t q = static_cast<uint64_t>((nuo_u128(x) * t.q) >> 64);
+        return x * t.w - q * p;
+    }
+
+    /*
+     * Decimation in frequency, a[0, 2^log_n) natural in, bit reversed out,
+     * inputs and outputs in [0, 2p)
+     */
+    void forward(uint64_t* a) const noexcept {
+        const uint64_t p = prime.p, p2 = 2 * p;
+        const size_t n = size_t(1) << log_n;
+        for (size_t h = n >> 1; h >= 1; h >>= 1) {
+            const nuo_ntt_twiddle* tw = w.data() + h;
+            for (size_t s = 0; s < n; s += 2 * h) {
+                uint64_t* x = a + s;
+                uint64_t* y = a + s + h;
+                for (size_t j = 0; j < h; j++) {
+                    uint64_t u = x[j], v = y[j];
+                    uint64_t t = u + v;
+                    x[j] = t >= p2 ? t - p2 : t;
+                    y[j] = mul_shoup(u - v + p2, tw[j], p);
+                }
+            }
+        }
+    }
+
+    /*
+     * Decimation in time, bit reversed in, n times the inverse out, inputs
+     * and outputs in [0, 2p)
+     */
+    void inverse(uint64_t* a) const noexcept {
+        const uint64_t p = prime.p, p2 = 2 * p;
+        const size_t n = size_t(1) << log_n;
+        for (size_t h = 1; h < n; h <<= 1) {
+            /* tw[-j] = omega_2h^(h - j) = -omega_2h^-j for 0 < j < h */
+            const nuo_ntt_twiddle* tw = w.data() + 2 * h;
+            for (size_t s = 0; s < n; s += 2 * h) {
+                uint64_t* x = a + s;
+                uint64_t* y = a + s + h;
+                uint64_t u = x[0], v = y[0] >= p2 ? y[0] - p2 : y[0];
+                uint64_t t = u + v, d = u - v + p2;
+                x[0] = t >= p2 ? t - p2 : t;
+                y[0] = d >= p2 ? d - p2 : d;
+                for (size_t j = 1; j < h; j++) {
+                    u = x[j];
+                    v = mul_shoup(y[j], tw[-static_cast<ptrdiff_t>(j)], p);
+                    t = u - v + p2;
+                    d = u + v;
+                    x[j] = t >= p2 ? t - p2 : t;
+                    y[j] = d >= p2 ? d - p2 : d;
+                }
+            }
+        }
+    }
+};
+
+inline unsigned nuo_ntt_log2_ceil(size_t n) noexcept {
+    unsigned lg = 0;
+    while ((size_t(1) << lg) < n)
+        lg++;
+    return lg;
+}
+
+/*
+ * out[0, na + nb - 1) = the cyclic-free convolution of a and b modulo
+ * prime q, load_a(i) / load_b(i) give the residues of the inputs. With
+ * square set b is taken equal to a and transformed once.
+ */
+template<typename LoadA, typename LoadB>
+void nuo_ntt_convolve(unsigned q, size_t na, LoadA load_a, size_t nb,
+                      LoadB load_b, bool square, uint64_t* out) {
+    const nuo_ntt_prime P = nuo_ntt_primes[q];
+    const size_t nc = na + nb - 1;
+    const unsigned lg = nuo_ntt_log2_ceil(nc);
+    const size_t n = size_t(1) << lg;
+    nuo_ntt_plan plan(P, lg);
+
+    std::vector<uint64_t> fa(n, 0);
+    for (size_t i = 0; i < na; i++)
+        fa[i] = load_a(i);
+    plan.forward(fa.data());
+    if (square) {
+        for (size_t i = 0; i < n; i++)
+            fa[i] = P.mul(fa[i], fa[i]);
+    } else {
+        std::vector<uint64_t> fb(n, 0);
+        for (size_t i = 0; i < nb; i++)
+            fb[i] = load_b(i);
+        plan.forward(fb.data());
+        for (size_t i = 0; i < n; i++)
+            fa[i] = P.mul(fa[i], fb[i]);
+    }
+    plan.inverse(fa.data());
+
+    /* the pointwise products lost a 2^64, the inverse gained an n */
+    uint64_t inv_n = P.inv_mont(P.to_mont(n));
+    uint64_t scale = P.mul(inv_n, P.r2);
+    for (size_t i = 0; i < nc; i++)
+        out[i] = P.mul(fa[i], scale);
+}
+
+/* 192-bit unsigned value, little-endian words */
+struct nuo_u192 {
+    uint64_t w[3];
+};
+
+/*
+ * Garner's mixed radix digits v of the residues r over the first k primes,
+ * x = v0 + v1 p0 + v2 p0 p1 with 0 <= x < p0 ... p(k-1).
+ */
+class nuo_ntt_crt {
+    /* Montgomery constants: p0^-1 mod p1, p0 mod p2, (p0 p1)^-1 mod p2 */
+    static constexpr uint64_t inv_p0_1 = nuo_ntt_primes[1].inv_mont(
+        nuo_ntt_primes[1].to_mont(nuo_ntt_primes[0].p % nuo_ntt_primes[1].p));
+    static constexpr uint64_t p0_2 = nuo_ntt_primes[2].to_mont(
+        nuo_ntt_primes[0].p % nuo_ntt_primes[2].p);
+    static constexpr uint64_t inv_p01_2 = nuo_ntt_primes[2].inv_mont(
+        nuo_ntt_primes[2].mul(p0_2, nuo_ntt_primes[2].to_mont(
+            nuo_ntt_primes[1].p % nuo_ntt_primes[2].p)));
+
+public:
+    static void digits(unsigned k, const uint64_t* r, uint64_t* v) noexcept {
+        const nuo_ntt_prime& P1 = nuo_ntt_primes[1];
+        const nuo_ntt_prime& P2 = nuo_ntt_primes[2];
+        v[0] = r[0];
+        if (k == 1)
+            return;
+        v[1] = P1.mul(P1.sub(r[1], P1.reduce(v[0])), inv_p0_1);
+        if (k == 2)
+            return;
+        /* (v0 + v1 p0) mod p2 */
+        uint64_t t = P2.add(P2.reduce(v[0]), P2.mul(P2.reduce(v[1]), p0_2));
+        v[2] = P2.mul(P2.sub(r[2], t), inv_p01_2);
+    }
+
+    /* x from its digits */
+    static constexpr nuo_u192 value(unsigned k, const uint64_t* v) noexcept {
+        const nuo_u128 p0 = nuo_ntt_primes[0].p;
+        nuo_u128 lo = v[0];
+        if (k >= 2)
+            lo += p0 * v[1];                            /* < 2^124 */
+        if (k < 3)
+            return {{static_cast<uint64_t>(lo), static_cast<uint64_t>(lo >> 64), 0}};
+        /* + p0 p1 v2 with p0 p1 = (a1 : a0) */
+        const nuo_u128 p01 = p0 * nuo_ntt_primes[1].p;
+        nuo_u128 s = lo + nuo_u128(static_cast<uint64_t>(p01)) * v[2];   /* < 2^127 */
+        nuo_u128 t = (s >> 64) + nuo_u128(static_cast<uint64_t>(p01 >> 64)) * v[2];
+        return {{static_cast<uint64_t>(s), static_cast<uint64_t>(t),
+                 static_cast<uint64_t>(t >> 64)}};
+    }
+
+    /* p0 ... p(k-1) */
+    static constexpr nuo_u192 modulus(unsigned k) noexcept {
+        uint64_t v[3] = {0, 0, 0};
+        /* P - 1 has the digits p_i - 1 */
+        for (unsigned i = 0; i < k; i++)
+            v[i] = nuo_ntt_primes[i].p - 1;
+        nuo_u192 x = value(k, v);
+        for (int i = 0; i < 3; i++) {
+            if (++x.w[i] != 0)
+                break;
+        }
+        return x;
+    }
+
+    /*
+     * The residues as a signed value in (-P/2, P/2], reduced modulo 2^64:
+     * the exact value whenever it fits an int64_t.
+     */
+    static int64_t signed_value(unsigned k, const uint64_t* v) noexcept {
+        nuo_u192 x = value(k, v);
+        const nuo_u192 P = modulus(k);
+        /* x > P / 2  <=>  2x > P */
+        nuo_u192 d = {{x.w[0] << 1, (x.w[1] << 1) | (x.w[0] >> 63),
+                       (x.w[2] << 1) | (x.w[1] >> 63)}};
+        bool neg = false;
+        for (int i = 2; i >= 0; i--) {
+            if (d.w[i] != P.w[i]) {
+                neg = d.w[i] > P.w[i];
+                break;
+            }
+        }
+        uint64_t lo = x.w[0];
+        if (neg)
+            lo -= P.w[0];
+        return static_cast<int64_t>(lo);
+    }
+};
+
+/* Primes needed for an exact result below 2^bits in absolute value */
+constexpr unsigned nuo_ntt_primes_for(unsigned bits) noexcept {
+    unsigned k = (bits + 1 + nuo_ntt_prime_bits - 1) / nuo_ntt_prime_bits;
+    return k == 0 ? 1 : k;
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
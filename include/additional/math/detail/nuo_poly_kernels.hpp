@@ -0,0 +1,281 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_POLY_KERNELS_HPP_
+#define NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_POLY_KERNELS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <bit>
+#include <concepts>
+#include <type_traits>
+#include <vector>
+
+#include "../nuo_modint.hpp"
+#include "./nuo_fft.hpp"
+#include "./nuo_ntt.hpp"
+
+/*
+ * Coefficient convolution behind nuo_polynomial: schoolbook below a
+ * threshold, above it the NTT for integers and nuo_modint (exact, one to
+ * three primes picked from a bound on the result) or the double FFT for
+ * floating point. Thresholds are in coefficients, from the nuo_polynomial
+ * benchmarks, and can be overridden like the nuo_biginteger ones.
+ */
+
+#if !defined(NUOSTL_POLY_NTT_THRESHOLD)
+#define NUOSTL_POLY_NTT_THRESHOLD 200
+#endif
+#if !defined(NUOSTL_POLY_FFT_THRESHOLD)
+#define NUOSTL_POLY_FFT_THRESHOLD 200
+#endif
+#if !defined(NUOSTL_POLY_NEWTON_THRESHOLD)
+#define NUOSTL_POLY_NEWTON_THRESHOLD 1500
+#endif
+#if !defined(NUOSTL_POLY_TREE_THRESHOLD)
+#define NUOSTL_POLY_TREE_THRESHOLD 64
+#endif
+
+namespace nuostl {
+namespace detail {
+
+inline constexpr size_t nuo_poly_ntt_threshold = NUOSTL_POLY_NTT_THRESHOLD;
+inline constexpr size_t nuo_poly_fft_threshold = NUOSTL_POLY_FFT_THRESHOLD;
+/* long division -> Newton, divisor and quotient lengths, fields only */
+inline constexpr size_t nuo_poly_newton_threshold = NUOSTL_POLY_NEWTON_THRESHOLD;
+/* Horner per point -> subproduct tree, points and coefficients */
+inline constexpr size_t nuo_poly_tree_threshold = NUOSTL_POLY_TREE_THRESHOLD;
+
+/* coefficient types nuo_polynomial supports */
+template<typename T>
+concept nuo_poly_coefficient =
+    (std::integral<T> && !std::same_as<T, bool>) || std::floating_point<T> ||
+    nuo_is_modint<T>;
+
+/* exact division by any non-zero coefficient */
+template<typename T>
+inline constexpr bool nuo_poly_field = std::floating_point<T> || nuo_is_modint<T>;
+
+/*
+ * Coefficient arithmetic. Integers go through the matching unsigned type
+ * (promoted to at least unsigned int), so they wrap modulo 2^bits like the
+ * products instead of overflowing; other types use their own operators.
+ */
+template<typename T, bool = std::is_integral_v<T>>
+struct nuo_poly_wrap {
+    using type = T;
+};
+
+template<typename T>
+struct nuo_poly_wrap<T, true> {
+    using type = std::make_unsigned_t<std::common_type_t<T, int>>;
+};
+
+template<typename T>
+using nuo_poly_wrap_t = typename nuo_poly_wrap<T>::type;
+
+template<typename T>
+T nuo_poly_add(const T& a, const T& b) {
+    using U = nuo_poly_wrap_t<T>;
+    return static_cast<T>(static_cast<U>(a) + static_cast<U>(b));
+}
+
+template<typename T>
+T nuo_poly_sub(const T& a, const T& b) {
+    using U = nuo_poly_wrap_t<T>;
+    return static_cast<T>(static_cast<U>(a) - static_cast<U>(b));
+}
+
+template<typename T>
+T nuo_poly_neg(const T& a) {
+    using U = nuo_poly_wrap_t<T>;
+    return static_cast<T>(U(0) - static_cast<U>(a));
+}
+
+template<typename T>
+T nuo_poly_mulc(const T& a, const T& b) {
+    using U = nuo_poly_wrap_t<T>;
+    return static_cast<T>(static_cast<U>(a) * static_cast<U>(b));
+}
+
+/*
+ * Integers accumulate in uint64_t, so overflow wraps modulo 2^bits like
+ * the NTT result does instead of being undefined for signed T. nuo_modint
+ * sums its unreduced products in 128 bits and reduces once per output.
+ */
+template<typename T>
+void nuo_poly_mul_schoolbook(const T* a, size_t na, const T* b, size_t nb,
+                             T* out) {
+    if constexpr (nuo_is_modint<T>) {
+        std::vector<nuo_u128> acc(na + nb - 1, 0);
+        for (size_t i = 0; i < na; i++) {
+            const uint64_t x = a[i].value();
+            for (size_t j = 0; j < nb; j++)
+                acc[i + j] += x * b[j].value();
+        }
+        for (size_t i = 0; i < acc.size(); i++)
+            out[i] = T::raw(static_cast<uint32_t>(acc[i] % T::modulus()));
+    } else if constexpr (std::is_integral_v<T>) {
+        std::vector<uint64_t> acc(na + nb - 1, 0);
+        for (size_t i = 0; i < na; i++) {
+            const uint64_t x = static_cast<uint64_t>(a[i]);
+            for (size_t j = 0; j < nb; j++)
+                acc[i + j] += x * static_cast<uint64_t>(b[j]);
+        }
+        for (size_t i = 0; i < acc.size(); i++)
+            out[i] = static_cast<T>(acc[i]);
+    } else {
+        for (size_t i = 0; i < na + nb - 1; i++)
+            out[i] = T(0);
+        for (size_t i = 0; i < na; i++) {
+            const T x = a[i];
+            for (size_t j = 0; j < nb; j++)
+                out[i + j] += x * b[j];
+        }
+    }
+}
+
+/*
+ * Long division a = q b + r, na >= nb >= 1, inv_lead the inverse of the
+ * leading coefficient of b: q[0, na - nb + 1), r[0, nb - 1). nuo_modint
+ * computes every coefficient as one 128-bit dot product of the known
+ * quotient with b, reduced once, rather than updating the dividend.
+ */
+template<typename T>
+void nuo_poly_div_schoolbook(const T* a, size_t na, const T* b, size_t nb,
+                             const T& inv_lead, T* q, T* r) {
+    const size_t qn = na - nb + 1;
+    if constexpr (nuo_is_modint<T>) {
+        auto dot = [&](size_t k, size_t lo, size_t hi) {
+            /* a[k] - sum q[j] b[k - j], j in [lo, hi) */
+            nuo_u128 acc = 0;
+            for (size_t j = lo; j < hi; j++)
+                acc += static_cast<uint64_t>(q[j].value()) * b[k - j].value();
+            return a[k] - T::raw(static_cast<uint32_t>(acc % T::modulus()));
+        };
+        for (size_t i = qn; i-- > 0; ) {
+            size_t k = i + nb - 1;
+            q[i] = dot(k, i + 1, qn < k + 1 ? qn : k + 1) * inv_lead;
+        }
+        for (size_t k = 0; k + 1 < nb; k++)
+            r[k] = dot(k, k + 1 >= nb ? k + 1 - nb : 0, qn < k + 1 ? qn : k + 1);
+    } else {
+        std::vector<T> rem(a, a + na);
+        for (size_t i = qn; i-- > 0; ) {
+            T coef = nuo_poly_mulc(rem[i + nb - 1], inv_lead);
+            q[i] = coef;
+            if (coef == T(0))
+                continue;
+            for (size_t j = 0; j < nb; j++)
+                rem[i + j] = nuo_poly_sub(rem[i + j], nuo_poly_mulc(coef, b[j]));
+        }
+        for (size_t k = 0; k + 1 < nb; k++)
+            r[k] = rem[k];
+    }
+}
+
+/* bits of the largest magnitude among a[0, n) */
+template<typename T>
+unsigned nuo_poly_max_bits(const T* a, size_t n) noexcept {
+    uint64_t m = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t v;
+        if constexpr (nuo_is_modint<T>)
+            v = a[i].value();
+        else if constexpr (std::is_signed_v<T>)
+            v = a[i] < 0 ? 0 - static_cast<uint64_t>(a[i])
+                         : static_cast<uint64_t>(a[i]);
+        else
+            v = static_cast<uint64_t>(a[i]);
+        m |= v;
+    }
+    return static_cast<unsigned>(std::bit_width(m));
+}
+
+template<typename T>
+uint64_t nuo_poly_residue(const nuo_ntt_prime& P, const T& x) noexcept {
+    if constexpr (nuo_is_modint<T>)
+        return P.reduce(x.value());
+    else if constexpr (std::is_signed_v<T>)
+        return P.reduce_signed(static_cast<int64_t>(x));
+    else
+        return P.reduce(static_cast<uint64_t>(x));
+}
+
+/* Exact convolution through one to three NTT primes and the CRT */
+template<typename T>
+void nuo_poly_mul_ntt(const T* a, size_t na, const T* b, size_t nb,
+                      T* out) {
+    const size_t nc = na + nb - 1;
+    const bool square = a == b && na == nb;
+    unsigned bits = nuo_poly_max_bits(a, na) +
+        (square ? nuo_poly_max_bits(a, na) : nuo_poly_max_bits(b, nb)) +
+        static_cast<unsigned>(std::bit_width(na < nb ? na : nb));
+    const unsigned k = nuo_ntt_primes_for(bits);
+
+    std::vector<uint64_t> res[3];
+    for (unsigned q = 0; q < k; q++) {
+        const nuo_ntt_prime& P = nuo_ntt_primes[q];
+        res[q].resize(nc);
+        nuo_ntt_convolve(q,
+            na, [&](size_t i) { return nuo_poly_residue(P, a[i]); },
+            nb, [&](size_t i) { return nuo_poly_residue(P, b[i]); },
+            square, res[q].data());
+    }
+
+    uint64_t r[3], v[3] = {0, 0, 0};
+    if constexpr (nuo_is_modint<T>) {
+        constexpr uint64_t M = T::modulus();
+        const uint64_t c1 = nuo_ntt_primes[0].p % M;
+        const uint64_t c2 = static_cast<uint64_t>(
+            nuo_u128(nuo_ntt_primes[0].p) * nuo_ntt_primes[1].p % M);
+        for (size_t i = 0; i < nc; i++) {
+            for (unsigned q = 0; q < k; q++)
+                r[q] = res[q][i];
+            nuo_ntt_crt::digits(k, r, v);
+            nuo_u128 x = nuo_u128(v[0]) + nuo_u128(v[1]) * c1 +
+                         nuo_u128(v[2]) * c2;
+            out[i] = T::raw(static_cast<uint32_t>(x % M));
+        }
+    } else {
+        for (size_t i = 0; i < nc; i++) {
+            for (unsigned q = 0; q < k; q++)
+                r[q] = res[q][i];
+            nuo_ntt_crt::digits(k, r, v);
+            out[i] = static_cast<T>(nuo_ntt_crt::signed_value(k, v));
+        }
+    }
+}
+
+template<typename T>
+void nuo_poly_mul_fft(const T* a, size_t na, const T* b, size_t nb, T* out) {
+    if constexpr (std::is_same_v<T, double>) {
+        nuo_fft_convolve(a, na, b, nb, out);
+    } else {
+        std::vector<double> da(a, a + na), db(b, b + nb), dc(na + nb - 1);
+        nuo_fft_convolve(da.data(), na, db.data(), nb, dc.data());
+        for (size_t i = 0; i < dc.size(); i++)
+            out[i] = static_cast<T>(dc[i]);
+    }
+}
+
+/* out[0, na + nb - 1) = a * b, na, nb >= 1, out aliases neither */
+template<typename T>
+void nuo_poly_mul(const T* a, size_t na, const T* b, size_t nb, T* out) {
+    const size_t m = na < nb ? na : nb;
+    if constexpr (std::floating_point<T>) {
+        if (m >= nuo_poly_fft_threshold) {
+            nuo_poly_mul_fft(a, na, b, nb, out);
+            return;
+        }
+    } else {
+        if (m >= nuo_poly_ntt_threshold) {
+            nuo_poly_mul_ntt(a, na, b, nb, out);
+            return;
+        }
+    }
+    nuo_poly_mul_schoolbook(a, na, b, nb, out);
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_THREAD_TEAM_HPP_
+#define NUOSTL_ADDITIONAL_MATH_DETAIL_NUO_THREAD_TEAM_HPP_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace nuostl {
+namespace detail {
+
+/*
+ * Fork-join team for the blocked GEMM: run(n, f) calls f(0) .. f(n - 1),
+ * f(0) on the caller and the rest on persistent workers, and returns once
+ * every call has finished. Workers are started on first use and parked on
+ * a condition variable between jobs, so a phase costs one wake-up rather
+ * than a thread start.
+ *
+ * One job at a time: a caller that finds the team busy (another thread's
+ * product, or a product issued from inside a job) runs its n calls inline.
+ */
+class nuo_thread_team {
+private:
+    std::mutex busy_;
+    std::mutex m_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::vector<std::thread> workers_;
+    void (*fn_)(void*, size_t) = nullptr;
+    void* ctx_ = nullptr;
+    size_t size_ = 0;
+    size_t generation_ = 0;
+    size_t pending_ = 0;
+    bool stop_ = false;
+
+    void work(size_t id) {
+        size_t seen = 0;
+        for (;;) {
+            std::unique_lock<std::mutex> lock(m_);
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_)
+                return;
+            seen = generation_;
+            if (id >= size_)
+                continue;
+            void (*fn)(void*, size_t) = fn_;
+            void* ctx = ctx_;
+            lock.unlock();
+            fn(ctx, id);
+            lock.lock();
+            if (--pending_ == 0)
+                done_.notify_one();
+        }
+    }
+
+    void grow(size_t n) {
+        /* workers_[i] runs index i + 1 */
+        while (workers_.size() + 1 < n) {
+            size_t id = workers_.size() + 1;
+            workers_.emplace_back([this, id] { work(id); });
+        }
+    }
+
+public:
+    nuo_thread_team() = default;
+    nuo_thread_team(const nuo_thread_team&) = delete;
+    nuo_thread_team& operator=(const nuo_thread_team&) = delete;
+
+    ~nuo_thread_team() {
+        {
+            std::lock_guard<std::mutex> lock(m_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& t : workers_)
+            t.join();
+    }
+
+    static nuo_thread_team& instance() {
+        static nuo_thread_team team;
+        return team;
+    }
+
+    template<typename F>
+    void run(size_t n, F&& f) {
+        std::unique_lock<std::mutex> busy(busy_, std::try_to_lock);
+        if (n <= 1 || !busy.owns_lock()) {
+            for (size_t i = 0; i < n; i++)
+                f(i);
+            return;
+        }
+        using fn_t = std::remove_reference_t<F>;
+        {
+            std::lock_guard<std::mutex> lock(m_);
+            grow(n);
+            fn_ = [](void* ctx, size_t i) { (*static_cast<fn_t*>(ctx))(i); };
+            ctx_ = const_cast<void*>(static_cast<const void*>(&f));
+            size_ = n;
+            pending_ = n - 1;
+            generation_++;
+        }
+        wake_.notify_all();
+        f(0);
+        std::unique_lock<std::mutex> lock(m_);
+        done_.wait(lock, [&] { return pending_ == 0; });
+    }
+};
+
+/* Upper bound on the team size, 0 until first queried or set */
+inline std::atomic<size_t> nuo_thread_team_limit{0};
+
+inline size_t nuo_thread_team_size() {
+    size_t n = nuo_thread_team_limit.load(std::memory_order_relaxed);
+    if (n == 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        n = hw == 0 ? 1 : hw;
+        nuo_thread_team_limit.store(n, std::memory_order_relaxed);
+    }
+    return n;
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
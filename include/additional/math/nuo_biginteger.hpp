@@ -0,0 +1,934 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_NUO_BIGINTEGER_HPP_
+#define NUOSTL_ADDITIONAL_MATH_NUO_BIGINTEGER_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <compare>
+#include <concepts>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../../core/allocators/nuo_malloc_allocator.hpp"
+#include "./detail/nuo_bigint_kernels.hpp"
+
+namespace nuostl {
+
+/*
+ * Arbitrary precision signed integer, sign and magnitude in 64-bit limbs.
+ *
+ * A magnitude below 2^64 lives inline in the object (sizeof is 16), so
+ * values that fit a machine word never allocate and take __int128 fast
+ * paths. Larger values are heap allocated through nuo_malloc_allocator and
+ * grow with reallocate().
+ *
+ * Multiplication goes schoolbook -> Karatsuba -> Toom-3 -> three prime NTT
+ * by operand size, see the thresholds in detail/nuo_bigint_kernels.hpp.
+ * Division is Knuth D, or a Newton reciprocal for large divisors and
+ * quotients. / and % truncate toward zero like the built-in types, >>
+ * rounds toward negative infinity. Dividing by zero throws
+ * std::domain_error.
+ */
+class nuo_biginteger {
+public:
+    using limb_type = detail::nuo_limb;
+    using size_type = size_t;
+
+private:
+    using limb = detail::nuo_limb;
+    using dlimb = detail::nuo_dlimb;
+    using alloc = nuo_malloc_allocator<limb>;
+
+    union {
+        limb small_;    /* cap_ == 0 */
+        limb* heap_;    /* cap_ > 0 */
+    };
+    int32_t size_;      /* limbs in use, negative for negative values */
+    uint32_t cap_;      /* heap capacity in limbs, 0 for the inline limb */
+
+    static constexpr size_t max_limbs = size_t(INT32_MAX);
+
+    limb* limbs() noexcept { return cap_ != 0 ? heap_ : &small_; }
+    const limb* limbs() const noexcept { return cap_ != 0 ? heap_ : &small_; }
+    size_t len() const noexcept {
+        return static_cast<size_t>(size_ < 0 ? -int64_t(size_) : size_);
+    }
+    size_t capacity() const noexcept { return cap_ != 0 ? cap_ : 1; }
+
+    /* the magnitude fits the inline limb, whatever the storage */
+    bool word() const noexcept { return size_ >= -1 && size_ <= 1; }
+    limb word_mag() const noexcept { return size_ != 0 ? limbs()[0] : 0; }
+
+    /* Capacity for n limbs, the limbs in use are kept */
+    void grow(size_t n) {
+        if (n <= capacity())
+            return;
+        if (n > max_limbs)
+            throw std::length_error("nuo_biginteger: too many limbs");
+        size_t c = capacity() + capacity() / 2;
+        if (c < n)
+            c = n;
+        if (c > max_limbs)
+            c = max_limbs;
+        if (cap_ == 0) {
+            limb v = small_;
+            heap_ = alloc().allocate(c);
+            heap_[0] = v;
+        } else {
+            heap_ = alloc().reallocate(heap_, cap_, c);
+        }
+        cap_ = static_cast<uint32_t>(c);
+    }
+
+    /* Drop high zero limbs and store the sign */
+    void set_len(size_t n, bool neg) noexcept {
+        n = detail::nuo_bigint_normalize(limbs(), n);
+        size_ = static_cast<int32_t>(n);
+        if (neg)
+            size_ = -size_;
+    }
+
+    void set_word(limb mag, bool neg) noexcept {
+        limbs()[0] = mag;
+        size_ = mag == 0 ? 0 : (neg ? -1 : 1);
+    }
+
+    /* Store sign * (hi:lo) */
+    void set_dword(dlimb mag, bool neg) {
+        limb hi = static_cast<limb>(mag >> 64);
+        if (hi == 0) {
+            set_word(static_cast<limb>(mag), neg);
+            return;
+        }
+        grow(2);
+        limbs()[0] = static_cast<limb>(mag);
+        limbs()[1] = hi;
+        size_ = neg ? -2 : 2;
+    }
+
+    /* An empty value with room for n limbs */
+    static nuo_biginteger with_capacity(size_t n) {
+        nuo_biginteger r;
+        r.grow(n);
+        return r;
+    }
+
+    /* A value made of a copy of the limbs p[0, n) */
+    static nuo_biginteger from_limbs(const limb* p, size_t n, bool neg) {
+        n = detail::nuo_bigint_normalize(p, n);
+        nuo_biginteger r = with_capacity(n);
+        if (n != 0)
+            memcpy(r.limbs(), p, n * sizeof(limb));
+        r.set_len(n, neg);
+        return r;
+    }
+
+    /* *this = sign * (|*this| + |b|) or sign * ||*this| - |b||, in place */
+    void add_signed(const nuo_biginteger& b, bool b_neg) {
+        if (&b == this) {
+            nuo_biginteger copy(b);
+            add_signed(copy, b_neg);
+            return;
+        }
+        const bool a_neg = size_ < 0;
+        if (word() && b.word()) {
+            dlimb x = word_mag(), y = b.word_mag();
+            if (a_neg == b_neg)
+                set_dword(x + y, a_neg);
+            else if (x >= y)
+                set_word(static_cast<limb>(x - y), a_neg);
+            else
+                set_word(static_cast<limb>(y - x), b_neg);
+            return;
+        }
+        size_t an = len(), bn = b.len();
+        if (a_neg == b_neg) {
+            size_t n = an > bn ? an : bn;
+            grow(n + 1);
+            limb* r = limbs();
+            const limb* bp = b.limbs();
+            limb c = an >= bn ? detail::nuo_bigint_add(r, r, an, bp, bn)
+                              : detail::nuo_bigint_add(r, bp, bn, r, an);
+            r[n] = c;
+            set_len(n + 1, a_neg);
+            return;
+        }
+        int c = detail::nuo_bigint_cmp(limbs(), an, b.limbs(), bn);
+        if (c == 0) {
+            size_ = 0;
+        } else if (c > 0) {
+            detail::nuo_bigint_sub(limbs(), limbs(), an, b.limbs(), bn);
+            set_len(an, a_neg);
+        } else {
+            grow(bn);
+            detail::nuo_bigint_sub(limbs(), b.limbs(), bn, limbs(), an);
+            set_len(bn, b_neg);
+        }
+    }
+
+    /* r[0, an + bn) = a * b, an >= bn >= 1, r aliases neither */
+    static void mul_limbs(limb* r, const limb* a, size_t an,
+                          const limb* b, size_t bn) {
+        if (bn < detail::nuo_bigint_karatsuba_threshold) {
+            detail::nuo_bigint_mul_basecase(r, a, an, b, bn);
+            return;
+        }
+        if (bn >= detail::nuo_bigint_ntt_threshold) {
+            detail::nuo_bigint_mul_ntt(r, a, an, b, bn);
+            return;
+        }
+        if (an == bn) {
+            mul_balanced(r, a, b, bn);
+            return;
+        }
+        /* unbalanced: bn x bn blocks of a, accumulated into r */
+        std::vector<limb> t(2 * bn);
+        memset(r, 0, (an + bn) * sizeof(limb));
+        size_t i = 0;
+        for (; i + bn <= an; i += bn) {
+            mul_balanced(t.data(), a + i, b, bn);
+            detail::nuo_bigint_add(r + i, r + i, an + bn - i, t.data(), 2 * bn);
+        }
+        if (i < an) {
+            size_t rest = an - i;
+            mul_limbs(t.data(), b, bn, a + i, rest);
+            detail::nuo_bigint_add(r + i, r + i, an + bn - i, t.data(),
+                                   bn + rest);
+        }
+    }
+
+    static void mul_balanced(limb* r, const limb* a, const limb* b, size_t n) {
+        if (n >= detail::nuo_bigint_ntt_threshold) {
+            detail::nuo_bigint_mul_ntt(r, a, n, b, n);
+            return;
+        }
+        if (n >= detail::nuo_bigint_toom3_threshold) {
+            mul_toom3(r, a, b, n);
+            return;
+        }
+        std::vector<limb> ws(detail::nuo_bigint_karatsuba_scratch(n));
+        detail::nuo_bigint_mul_karatsuba(r, a, b, n, ws.data());
+    }
+
+    /*
+     * Toom-3 r[0, 2n) = a * b: split both into three k limb pieces,
+     * multiply at 0, 1, -1, -2 and infinity, interpolate (Bodrato's
+     * sequence, exact divisions by 2 and 3 only).
+     */
+    static void mul_toom3(limb* r, const limb* a, const limb* b, size_t n) {
+        const size_t k = (n + 2) / 3;
+        const size_t top = n - 2 * k;
+        nuo_biginteger a0 = from_limbs(a, k, false);
+        nuo_biginteger a1 = from_limbs(a + k, k, false);
+        nuo_biginteger a2 = from_limbs(a + 2 * k, top, false);
+        nuo_biginteger b0 = from_limbs(b, k, false);
+        nuo_biginteger b1 = from_limbs(b + k, k, false);
+        nuo_biginteger b2 = from_limbs(b + 2 * k, top, false);
+
+        /* evaluation, p(-2) = 2 (p(-1) + a2) - a0 */
+        nuo_biginteger pa = a0 + a2;
+        nuo_biginteger a_1 = pa + a1;
+        nuo_biginteger a_m1 = pa - a1;
+        nuo_biginteger a_m2 = ((a_m1 + a2) << 1) - a0;
+        nuo_biginteger pb = b0 + b2;
+        nuo_biginteger b_1 = pb + b1;
+        nuo_biginteger b_m1 = pb - b1;
+        nuo_biginteger b_m2 = ((b_m1 + b2) << 1) - b0;
+
+        nuo_biginteger r0 = a0 * b0;
+        nuo_biginteger r1 = a_1 * b_1;
+        nuo_biginteger rm1 = a_m1 * b_m1;
+        nuo_biginteger rm2 = a_m2 * b_m2;
+        nuo_biginteger rinf = a2 * b2;
+
+        /* interpolation */
+        nuo_biginteger r3 = rm2 - r1;
+        r3.div_exact_1(3);
+        nuo_biginteger t1 = r1 - rm1;
+        t1 >>= 1;
+        nuo_biginteger t2 = rm1 - r0;
+        r3 = t2 - r3;
+        r3 >>= 1;
+        r3 += rinf << 1;
+        t2 += t1;
+        t2 -= rinf;
+        t1 -= r3;
+
+        /* r = r0 + t1 B^k + t2 B^2k + r3 B^3k + rinf B^4k */
+        memset(r, 0, 2 * n * sizeof(limb));
+        const nuo_biginteger* coef[] = {&r0, &t1, &t2, &r3, &rinf};
+        for (size_t i = 0; i < 5; i++) {
+            /* every coefficient is non-negative and fits */
+            size_t cn = coef[i]->len();
+            if (cn != 0)
+                detail::nuo_bigint_add(r + i * k, r + i * k, 2 * n - i * k,
+                                       coef[i]->limbs(), cn);
+        }
+    }
+
+    /* *this /= d for a d that divides it exactly */
+    void div_exact_1(limb d) noexcept {
+        size_t n = len();
+        if (n == 0)
+            return;
+        detail::nuo_bigint_divrem_1(limbs(), limbs(), n, d);
+        set_len(n, size_ < 0);
+    }
+
+    /*
+     * Newton reciprocal: an approximation of 2^(bit_length(d) + p) / d,
+     * d > 0, within a few units. d is first cut to its top p + 64 bits, so
+     * a recursion step costs a few multiplications of p bit numbers.
+     */
+    static nuo_biginteger reciprocal(nuo_biginteger d, size_t p) {
+        size_t m = d.bit_length();
+        if (m > p + 64) {
+            d >>= m - (p + 64);
+            m = p + 64;
+        }
+        if (p <= 128) {
+            nuo_biginteger x = nuo_biginteger(1) << (m + p);
+            return divmod_impl(x, d).first;
+        }
+        size_t h = p / 2 + 32;
+        nuo_biginteger x = reciprocal(d, h) << (p - h);
+        /* x += x (2^(m+p) - d x) / 2^(m+p) */
+        nuo_biginteger e = (nuo_biginteger(1) << (m + p)) - d * x;
+        x += (x * e) >> (m + p);
+        return x;
+    }
+
+    /* |a| / |b| and |a| % |b|, |b| has at least 2 limbs */
+    static std::pair<nuo_biginteger, nuo_biginteger>
+    divmod_knuth(const nuo_biginteger& a, const nuo_biginteger& b) {
+        size_t an = a.len(), bn = b.len();
+        nuo_biginteger q = with_capacity(an - bn + 1);
+        nuo_biginteger r = with_capacity(bn);
+        detail::nuo_bigint_divrem_knuth(q.limbs(), r.limbs(), a.limbs(), an,
+                                        b.limbs(), bn);
+        q.set_len(an - bn + 1, false);
+        r.set_len(bn, false);
+        return {std::move(q), std::move(r)};
+    }
+
+    static std::pair<nuo_biginteger, nuo_biginteger>
+    divmod_newton(const nuo_biginteger& a, const nuo_biginteger& b) {
+        nuo_biginteger ma = a.abs(), mb = b.abs();
+        size_t na = ma.bit_length(), m = mb.bit_length();
+        size_t p = na - m + 32;
+        nuo_biginteger q = (ma * reciprocal(mb, p)) >> (m + p);
+        nuo_biginteger r = ma - q * mb;
+        while (r.size_ < 0) {
+            --q;
+            r += mb;
+        }
+        while (r >= mb) {
+            ++q;
+            r -= mb;
+        }
+        return {std::move(q), std::move(r)};
+    }
+
+    /* (q, r) with a = q b + r, truncating */
+    static std::pair<nuo_biginteger, nuo_biginteger>
+    divmod_impl(const nuo_biginteger& a, const nuo_biginteger& b) {
+        if (b.size_ == 0)
+            throw std::domain_error("nuo_biginteger: division by zero");
+        const bool qneg = (a.size_ < 0) != (b.size_ < 0);
+        const bool rneg = a.size_ < 0;
+        if (a.word() && b.word()) {
+            limb x = a.word_mag(), y = b.word_mag();
+            nuo_biginteger q, r;
+            q.set_word(x / y, qneg);
+            r.set_word(x % y, rneg);
+            return {std::move(q), std::move(r)};
+        }
+        size_t an = a.len(), bn = b.len();
+        if (detail::nuo_bigint_cmp(a.limbs(), an, b.limbs(), bn) < 0)
+            return {nuo_biginteger(), a};
+        std::pair<nuo_biginteger, nuo_biginteger> qr;
+        if (bn == 1) {
+            nuo_biginteger q = with_capacity(an);
+            limb rem = detail::nuo_bigint_divrem_1(q.limbs(), a.limbs(), an,
+                                                   b.limbs()[0]);
+            q.set_len(an, false);
+            qr.first = std::move(q);
+            qr.second.set_word(rem, false);
+        } else if (bn >= detail::nuo_bigint_newton_threshold &&
+                   an - bn >= detail::nuo_bigint_newton_threshold) {
+            qr = divmod_newton(a, b);
+        } else {
+            qr = divmod_knuth(a, b);
+        }
+        qr.first.set_len(qr.first.len(), qneg);
+        qr.second.set_len(qr.second.len(), rneg);
+        return qr;
+    }
+
+    static void mul_into(nuo_biginteger& r, const nuo_biginteger& a,
+                         const nuo_biginteger& b) {
+        const bool neg = (a.size_ < 0) != (b.size_ < 0);
+        if (a.word() && b.word()) {
+            r.set_dword(static_cast<dlimb>(a.word_mag()) * b.word_mag(), neg);
+            return;
+        }
+        size_t an = a.len(), bn = b.len();
+        if (an == 0 || bn == 0) {
+            r.size_ = 0;
+            return;
+        }
+        r.grow(an + bn);
+        if (an >= bn)
+            mul_limbs(r.limbs(), a.limbs(), an, b.limbs(), bn);
+        else
+            mul_limbs(r.limbs(), b.limbs(), bn, a.limbs(), an);
+        r.set_len(an + bn, neg);
+    }
+
+    /* Decimal digits per limb, 10^19 < 2^64 */
+    static constexpr size_t dec_digits = 19;
+    static constexpr limb dec_base = 10000000000000000000ull;
+    /* Below this many limbs conversions run the quadratic loops */
+    static constexpr size_t dec_dc_threshold = 40;
+
+    /* powers[j] = 10^(19 * 2^j) while it is at most half of n limbs */
+    static std::vector<nuo_biginteger> dec_powers(size_t n) {
+        std::vector<nuo_biginteger> pw;
+        nuo_biginteger p(dec_base);
+        while (2 * p.len() <= n + 1) {
+            pw.push_back(p);
+            p = p * p;
+        }
+        return pw;
+    }
+
+    /* Append |x| in decimal, zero padded to width digits if width > 0 */
+    static void to_dec(std::string& out, const nuo_biginteger& x,
+                       const std::vector<nuo_biginteger>& pw, size_t j,
+                       size_t width) {
+        if (j == 0 || x.len() < dec_dc_threshold) {
+            to_dec_basecase(out, x, width);
+            return;
+        }
+        const nuo_biginteger& p = pw[j - 1];
+        if (x.len() < p.len()) {
+            to_dec(out, x, pw, j - 1, width);
+            return;
+        }
+        size_t lo_width = dec_digits << (j - 1);
+        auto [q, r] = divmod_impl(x, p);
+        to_dec(out, q, pw, j - 1, width > lo_width ? width - lo_width : 0);
+        to_dec(out, r, pw, j - 1, lo_width);
+    }
+
+    static void to_dec_basecase(std::string& out, const nuo_biginteger& x,
+                                size_t width) {
+        std::vector<limb> t(x.limbs(), x.limbs() + x.len());
+        std::string digits;
+        size_t n = t.size();
+        while (n > 0) {
+            limb chunk = detail::nuo_bigint_divrem_1(t.data(), t.data(), n,
+                                                     dec_base);
+            n = detail::nuo_bigint_normalize(t.data(), n);
+            for (size_t i = 0; i < dec_digits && (n > 0 || chunk != 0); i++) {
+                digits.push_back(static_cast<char>('0' + chunk % 10));
+                chunk /= 10;
+            }
+        }
+        while (digits.size() < width)
+            digits.push_back('0');
+        out.append(digits.rbegin(), digits.rend());
+    }
+
+    /* Parse decimal digits, validated by the caller */
+    static nuo_biginteger from_dec(std::string_view s,
+                                   const std::vector<nuo_biginteger>& pw,
+                                   size_t j) {
+        while (j > 0 && (dec_digits << (j - 1)) >= s.size())
+            j--;
+        if (j == 0 || s.size() < dec_digits * dec_dc_threshold)
+            return from_dec_basecase(s);
+        size_t lo_width = dec_digits << (j - 1);
+        nuo_biginteger hi = from_dec(s.substr(0, s.size() - lo_width), pw, j);
+        nuo_biginteger lo = from_dec(s.substr(s.size() - lo_width), pw, j - 1);
+        hi *= pw[j - 1];
+        hi += lo;
+        return hi;
+    }
+
+    static nuo_biginteger from_dec_basecase(std::string_view s) {
+        nuo_biginteger r = with_capacity(s.size() / dec_digits + 1);
+        size_t n = 0;
+        size_t first = s.size() % dec_digits;
+        if (first == 0)
+            first = dec_digits;
+        for (size_t i = 0; i < s.size(); ) {
+            size_t len = i == 0 ? first : dec_digits;
+            limb chunk = 0, scale = 1;
+            for (size_t k = 0; k < len; k++) {
+                chunk = chunk * 10 + static_cast<limb>(s[i + k] - '0');
+                scale *= 10;
+            }
+            limb* p = r.limbs();
+            limb c = detail::nuo_bigint_mul_1(p, p, n, scale);
+            c += detail::nuo_bigint_add_1(p, p, n, chunk);
+            if (c != 0)
+                p[n++] = c;
+            i += len;
+        }
+        r.set_len(n, false);
+        return r;
+    }
+
+    static int hex_value(char c) noexcept {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+        return -1;
+    }
+
+public:
+    /* Constructor */
+    constexpr nuo_biginteger() noexcept : small_(0), size_(0), cap_(0) {}
+
+    template<std::integral T>
+    nuo_biginteger(T v) noexcept : small_(0), size_(0), cap_(0) {
+        if constexpr (std::is_signed_v<T>) {
+            limb mag = v < 0 ? limb(0) - static_cast<limb>(v)
+                             : static_cast<limb>(v);
+            set_word(mag, v < 0);
+        } else {
+            set_word(static_cast<limb>(v), false);
+        }
+    }
+
+    /* Decimal, or hexadecimal with a 0x prefix, optional leading sign */
+    explicit nuo_biginteger(std::string_view s) : nuo_biginteger() {
+        bool neg = false;
+        if (!s.empty() && (s[0] == '-' || s[0] == '+')) {
+            neg = s[0] == '-';
+            s.remove_prefix(1);
+        }
+        if (s.size() > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+            s.remove_prefix(2);
+            size_t n = (s.size() + 15) / 16;
+            grow(n);
+            limb* p = limbs();
+            for (size_t i = 0; i < n; i++)
+                p[i] = 0;
+            for (size_t i = 0; i < s.size(); i++) {
+                int v = hex_value(s[s.size() - 1 - i]);
+                if (v < 0)
+                    throw std::invalid_argument("nuo_biginteger: bad digit");
+                p[i / 16] |= static_cast<limb>(v) << (4 * (i % 16));
+            }
+            set_len(n, neg);
+            return;
+        }
+        if (s.empty())
+            throw std::invalid_argument("nuo_biginteger: no digits");
+        for (char c : s) {
+            if (c < '0' || c > '9')
+                throw std::invalid_argument("nuo_biginteger: bad digit");
+        }
+        std::vector<nuo_biginteger> pw;
+        if (s.size() >= dec_digits * dec_dc_threshold)
+            pw = dec_powers(s.size() / dec_digits + 1);
+        *this = from_dec(s, pw, pw.size());
+        set_len(len(), neg);
+    }
+
+    nuo_biginteger(const nuo_biginteger& other)
+        : small_(0), size_(0), cap_(0) {
+        size_t n = other.len();
+        grow(n);
+        if (n != 0)
+            memcpy(limbs(), other.limbs(), n * sizeof(limb));
+        size_ = other.size_;
+    }
+
+    nuo_biginteger(nuo_biginteger&& other) noexcept
+        : small_(other.small_), size_(other.size_), cap_(other.cap_) {
+        if (cap_ != 0)
+            heap_ = other.heap_;
+        other.small_ = 0;
+        other.size_ = 0;
+        other.cap_ = 0;
+    }
+
+    nuo_biginteger& operator=(const nuo_biginteger& other) {
+        if (this != &other) {
+            size_t n = other.len();
+            if (n > capacity()) {
+                size_ = 0;
+                grow(n);
+            }
+            if (n != 0)
+                memcpy(limbs(), other.limbs(), n * sizeof(limb));
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    nuo_biginteger& operator=(nuo_biginteger&& other) noexcept {
+        if (this != &other) {
+            if (cap_ != 0)
+                alloc().deallocate(heap_, cap_);
+            small_ = other.small_;
+            if (other.cap_ != 0)
+                heap_ = other.heap_;
+            size_ = other.size_;
+            cap_ = other.cap_;
+            other.small_ = 0;
+            other.size_ = 0;
+            other.cap_ = 0;
+        }
+        return *this;
+    }
+
+    ~nuo_biginteger() {
+        if (cap_ != 0)
+            alloc().deallocate(heap_, cap_);
+    }
+
+    /* Observers */
+    int sign() const noexcept { return size_ < 0 ? -1 : (size_ > 0); }
+    bool is_zero() const noexcept { return size_ == 0; }
+    /* true while the value uses the inline limb, no heap block */
+    bool is_inline() const noexcept { return cap_ == 0; }
+    size_type size_limbs() const noexcept { return len(); }
+    const limb_type* data() const noexcept { return limbs(); }
+
+    /* bits of |*this|, 0 for 0 */
+    size_type bit_length() const noexcept {
+        size_t n = len();
+        if (n == 0)
+            return 0;
+        return 64 * n - static_cast<size_t>(__builtin_clzll(limbs()[n - 1]));
+    }
+
+    bool bit(size_type i) const noexcept {
+        size_t w = i / 64;
+        return w < len() && ((limbs()[w] >> (i % 64)) & 1) != 0;
+    }
+
+    nuo_biginteger abs() const {
+        nuo_biginteger r(*this);
+        if (r.size_ < 0)
+            r.size_ = -r.size_;
+        return r;
+    }
+
+    /* true if the value is representable as T */
+    template<std::integral T>
+    bool fits() const noexcept {
+        if (size_ == 0)
+            return true;
+        if (!word())
+            return false;
+        limb m = word_mag();
+        if (size_ > 0)
+            return m <= static_cast<limb>(std::numeric_limits<T>::max());
+        if constexpr (std::is_unsigned_v<T>)
+            return false;
+        else
+            return m <= limb(0) - static_cast<limb>(std::numeric_limits<T>::min());
+    }
+
+    /* The value modulo 2^bits(T), two's complement for negatives */
+    template<std::integral T>
+    explicit operator T() const noexcept {
+        if (size_ == 0)
+            return T(0);
+        limb m = limbs()[0];
+        return static_cast<T>(size_ < 0 ? limb(0) - m : m);
+    }
+
+    explicit operator bool() const noexcept { return size_ != 0; }
+
+    explicit operator double() const noexcept {
+        size_t n = len();
+        double r = 0;
+        for (size_t i = n; i-- > 0; )
+            r = r * 18446744073709551616.0 + static_cast<double>(limbs()[i]);
+        return size_ < 0 ? -r : r;
+    }
+
+    /* Digits in base 10 or 16 (no prefix), a leading '-' if negative */
+    std::string to_string(int base = 10) const {
+        std::string out;
+        if (size_ < 0)
+            out.push_back('-');
+        if (size_ == 0) {
+            out.push_back('0');
+            return out;
+        }
+        if (base == 16) {
+            static constexpr char hex[] = "0123456789abcdef";
+            size_t n = len();
+            bool lead = true;
+            for (size_t i = n; i-- > 0; ) {
+                for (int s = 60; s >= 0; s -= 4) {
+                    unsigned v = static_cast<unsigned>(limbs()[i] >> s) & 15;
+                    if (lead && v == 0)
+                        continue;
+                    lead = false;
+                    out.push_back(hex[v]);
+                }
+            }
+            return out;
+        }
+        if (base != 10)
+            throw std::invalid_argument("nuo_biginteger: base must be 10 or 16");
+        std::vector<nuo_biginteger> pw;
+        if (len() >= dec_dc_threshold)
+            pw = dec_powers(len());
+        to_dec(out, abs(), pw, pw.size(), 0);
+        return out;
+    }
+
+    /* Arithmetic */
+    nuo_biginteger operator-() const {
+        nuo_biginteger r(*this);
+        r.size_ = -r.size_;
+        return r;
+    }
+    nuo_biginteger operator+() const { return *this; }
+
+    nuo_biginteger& operator+=(const nuo_biginteger& b) {
+        add_signed(b, b.size_ < 0);
+        return *this;
+    }
+    nuo_biginteger& operator-=(const nuo_biginteger& b) {
+        add_signed(b, b.size_ > 0);
+        return *this;
+    }
+    nuo_biginteger& operator*=(const nuo_biginteger& b) {
+        if (word() && b.word()) {
+            set_dword(static_cast<dlimb>(word_mag()) * b.word_mag(),
+                      (size_ < 0) != (b.size_ < 0));
+            return *this;
+        }
+        nuo_biginteger r;
+        mul_into(r, *this, b);
+        return *this = std::move(r);
+    }
+    nuo_biginteger& operator/=(const nuo_biginteger& b) {
+        return *this = divmod_impl(*this, b).first;
+    }
+    nuo_biginteger& operator%=(const nuo_biginteger& b) {
+        return *this = divmod_impl(*this, b).second;
+    }
+
+    nuo_biginteger& operator++() { return *this += 1; }
+    nuo_biginteger& operator--() { return *this -= 1; }
+    nuo_biginteger operator++(int) {
+        nuo_biginteger old(*this);
+        ++*this;
+        return old;
+    }
+    nuo_biginteger operator--(int) {
+        nuo_biginteger old(*this);
+        --*this;
+        return old;
+    }
+
+    nuo_biginteger& operator<<=(size_type s) {
+        size_t n = len();
+        if (n == 0 || s == 0)
+            return *this;
+        size_t w = s / 64;
+        unsigned b = static_cast<unsigned>(s % 64);
+        if (n + w + 1 > max_limbs)
+            throw std::length_error("nuo_biginteger: too many limbs");
+        grow(n + w + 1);
+        limb* p = limbs();
+        limb out = 0;
+        if (b != 0)
+            out = detail::nuo_bigint_lshift(p, p, n, b);
+        p[n] = out;
+        if (w != 0) {
+            memmove(p + w, p, (n + 1) * sizeof(limb));
+            memset(p, 0, w * sizeof(limb));
+        }
+        set_len(n + w + 1, size_ < 0);
+        return *this;
+    }
+
+    /* Floor division by 2^s */
+    nuo_biginteger& operator>>=(size_type s) {
+        size_t n = len();
+        if (n == 0 || s == 0)
+            return *this;
+        const bool neg = size_ < 0;
+        size_t w = s / 64;
+        unsigned b = static_cast<unsigned>(s % 64);
+        limb* p = limbs();
+        /* a negative value rounds down if any bit shifted out is set */
+        bool lost = false;
+        if (neg) {
+            for (size_t i = 0; i < w && i < n && !lost; i++)
+                lost = p[i] != 0;
+            if (!lost && b != 0 && w < n)
+                lost = (p[w] << (64 - b)) != 0;
+        }
+        if (w >= n) {
+            size_ = 0;
+        } else {
+            size_t m = n - w;
+            if (w != 0)
+                memmove(p, p + w, m * sizeof(limb));
+            if (b != 0)
+                detail::nuo_bigint_rshift(p, p, m, b);
+            set_len(m, neg);
+        }
+        if (lost)
+            add_signed(nuo_biginteger(1), true);
+        return *this;
+    }
+
+    friend nuo_biginteger operator+(nuo_biginteger a, const nuo_biginteger& b) {
+        a += b;
+        return a;
+    }
+    friend nuo_biginteger operator-(nuo_biginteger a, const nuo_biginteger& b) {
+        a -= b;
+        return a;
+    }
+    friend nuo_biginteger operator*(const nuo_biginteger& a,
+                                    const nuo_biginteger& b) {
+        nuo_biginteger r;
+        mul_into(r, a, b);
+        return r;
+    }
+    friend nuo_biginteger operator/(const nuo_biginteger& a,
+                                    const nuo_biginteger& b) {
+        return divmod_impl(a, b).first;
+    }
+    friend nuo_biginteger operator%(const nuo_biginteger& a,
+                                    const nuo_biginteger& b) {
+        return divmod_impl(a, b).second;
+    }
+    friend nuo_biginteger operator<<(nuo_biginteger a, size_type s) {
+        a <<= s;
+        return a;
+    }
+    friend nuo_biginteger operator>>(nuo_biginteger a, size_type s) {
+        a >>= s;
+        return a;
+    }
+
+    /* Quotient and remainder of a truncating division in one pass */
+    friend void divmod(const nuo_biginteger& a, const nuo_biginteger& b,
+                       nuo_biginteger& q, nuo_biginteger& r) {
+        auto qr = divmod_impl(a, b);
+        q = std::move(qr.first);
+        r = std::move(qr.second);
+    }
+
+    friend nuo_biginteger pow(nuo_biginteger base, unsigned long e) {
+        nuo_biginteger r(1);
+        while (e != 0) {
+            if (e & 1)
+                r *= base;
+            e >>= 1;
+            if (e != 0)
+                base *= base;
+        }
+        return r;
+    }
+
+    friend nuo_biginteger abs(const nuo_biginteger& a) { return a.abs(); }
+
+    /*
+     * Non-negative. Lehmer's algorithm while both operands span limbs: the
+     * Euclid quotients of the leading 126 bits, as cofactors below 2^63,
+     * are applied to the full numbers in one linear pass, or a full
+     * division step is taken when none of them is certain. Then Euclid
+     * down to words and binary GCD.
+     */
+    friend nuo_biginteger gcd(nuo_biginteger a, nuo_biginteger b) {
+        if (a.size_ < 0)
+            a.size_ = -a.size_;
+        if (b.size_ < 0)
+            b.size_ = -b.size_;
+        if (a < b)
+            a.swap(b);
+        nuo_biginteger ta, tb;
+        while (b.len() >= 2) {
+            const size_t n = a.len(), bn = b.len();
+            const size_t bits = a.bit_length();
+            const size_t s = bits > 126 ? bits - 126 : 0;
+            detail::nuo_bigint_cofactors c = detail::nuo_bigint_lehmer(
+                detail::nuo_bigint_bits(a.limbs(), n, s),
+                detail::nuo_bigint_bits(b.limbs(), bn, s));
+            if (c.v0 == 0) {
+                nuo_biginteger r = a % b;
+                a.swap(b);
+                b.swap(r);
+                continue;
+            }
+            b.grow(n);
+            memset(b.limbs() + bn, 0, (n - bn) * sizeof(limb));
+            ta.grow(n);
+            tb.grow(n);
+            detail::nuo_bigint_lincomb_2(ta.limbs(), tb.limbs(), a.limbs(), b.limbs(), n, c);
+            ta.set_len(n, false);
+            tb.set_len(n, false);
+            a.swap(ta);
+            b.swap(tb);
+        }
+        while (b.size_ != 0 && !(a.word() && b.word())) {
+            nuo_biginteger r = a % b;
+            a.swap(b);
+            b.swap(r);
+        }
+        if (b.size_ == 0)
+            return a;
+        return nuo_biginteger(detail::nuo_gcd_binary(a.word_mag(), b.word_mag()));
+    }
+
+    /* Comparison */
+    friend bool operator==(const nuo_biginteger& a,
+                           const nuo_biginteger& b) noexcept {
+        return a.size_ == b.size_ &&
+            detail::nuo_bigint_cmp_n(a.limbs(), b.limbs(), a.len()) == 0;
+    }
+
+    friend std::strong_ordering operator<=>(const nuo_biginteger& a,
+                                            const nuo_biginteger& b) noexcept {
+        if (a.size_ != b.size_)
+            return a.size_ <=> b.size_;
+        int c = detail::nuo_bigint_cmp_n(a.limbs(), b.limbs(), a.len());
+        if (a.size_ < 0)
+            c = -c;
+        return c <=> 0;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const nuo_biginteger& a) {
+        return os << a.to_string(
+            (os.flags() & std::ios_base::basefield) == std::ios_base::hex
+                ? 16 : 10);
+    }
+
+    void swap(nuo_biginteger& other) noexcept {
+        std::swap(*this, other);
+    }
+
+    friend void swap(nuo_biginteger& a, nuo_biginteger& b) noexcept {
+        a.swap(b);
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,513 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_NUO_COMPLEX_HPP_
+#define NUOSTL_ADDITIONAL_MATH_NUO_COMPLEX_HPP_
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "./detail/nuo_complex_kernels.hpp"
+
+namespace nuostl {
+
+/*
+ * Complex number with the layout of std::complex<T> (real part, then
+ * imaginary part), convertible to and from it.
+ *
+ * * and / follow C11 Annex G like std::complex, with the NaN tests done on
+ * the bit pattern so -ffast-math does not fold them away; defining
+ * NUOSTL_COMPLEX_LIMITED_RANGE, or calling mul_fast() / div_fast(), uses
+ * the plain formulas instead. Operations with a real T operand do not go
+ * through the complex product.
+ */
+template<std::floating_point T>
+class nuo_complex {
+public:
+    using value_type = T;
+
+private:
+    T re_ = T(0);
+    T im_ = T(0);
+
+public:
+    constexpr nuo_complex() noexcept = default;
+
+    constexpr nuo_complex(T re, T im = T(0)) noexcept : re_(re), im_(im) {}
+
+    template<std::floating_point U>
+    explicit constexpr nuo_complex(const nuo_complex<U>& z) noexcept :
+        re_(static_cast<T>(z.real())), im_(static_cast<T>(z.imag())) {}
+
+    explicit constexpr nuo_complex(const std::complex<T>& z) noexcept :
+        re_(z.real()), im_(z.imag()) {}
+
+    constexpr operator std::complex<T>() const noexcept { return {re_, im_}; }
+
+    constexpr T real() const noexcept { return re_; }
+    constexpr T imag() const noexcept { return im_; }
+    constexpr void real(T x) noexcept { re_ = x; }
+    constexpr void imag(T x) noexcept { im_ = x; }
+
+    /* Arithmetic */
+    constexpr nuo_complex operator+() const noexcept { return *this; }
+    constexpr nuo_complex operator-() const noexcept { return {-re_, -im_}; }
+
+    constexpr nuo_complex& operator+=(const nuo_complex& z) noexcept {
+        re_ += z.re_;
+        im_ += z.im_;
+        return *this;
+    }
+
+    constexpr nuo_complex& operator-=(const nuo_complex& z) noexcept {
+        re_ -= z.re_;
+        im_ -= z.im_;
+        return *this;
+    }
+
+    nuo_complex& operator*=(const nuo_complex& z) noexcept {
+        detail::nuo_complex_mul(re_, im_, z.re_, z.im_, re_, im_);
+        return *this;
+    }
+
+    nuo_complex& operator/=(const nuo_complex& z) noexcept {
+        detail::nuo_complex_div(re_, im_, z.re_, z.im_, re_, im_);
+        return *this;
+    }
+
+    constexpr nuo_complex& operator+=(T x) noexcept {
+        re_ += x;
+        return *this;
+    }
+
+    constexpr nuo_complex& operator-=(T x) noexcept {
+        re_ -= x;
+        return *this;
+    }
+
+    constexpr nuo_complex& operator*=(T x) noexcept {
+        re_ *= x;
+        im_ *= x;
+        return *this;
+    }
+
+    constexpr nuo_complex& operator/=(T x) noexcept {
+        re_ /= x;
+        im_ /= x;
+        return *this;
+    }
+
+    friend constexpr nuo_complex operator+(nuo_complex a, const nuo_complex& b) noexcept {
+        return a += b;
+    }
+
+    friend constexpr nuo_complex operator-(nuo_complex a, const nuo_complex& b) noexcept {
+        return a -= b;
+    }
+
+    friend nuo_complex operator*(nuo_complex a, const nuo_complex& b) noexcept {
+        return a *= b;
+    }
+
+    friend nuo_complex operator/(nuo_complex a, const nuo_complex& b) noexcept {
+        return a /= b;
+    }
+
+    friend constexpr nuo_complex operator+(nuo_complex a, T x) noexcept { return a += x; }
+    friend constexpr nuo_complex operator-(nuo_complex a, T x) noexcept { return a -= x; }
+    friend constexpr nuo_complex operator*(nuo_complex a, T x) noexcept { return a *= x; }
+    friend constexpr nuo_complex operator/(nuo_complex a, T x) noexcept { return a /= x; }
+    friend constexpr nuo_complex operator+(T x, const nuo_complex& a) noexcept {
+        return {x + a.re_, a.im_};
+    }
+    friend constexpr nuo_complex operator-(T x, const nuo_complex& a) noexcept {
+        return {x - a.re_, -a.im_};
+    }
+    friend constexpr nuo_complex operator*(T x, nuo_complex a) noexcept { return a *= x; }
+
+    friend nuo_complex operator/(T x, const nuo_complex& a) noexcept {
+        return nuo_complex(x) / a;
+    }
+
+    /* The plain formulas whatever NUOSTL_COMPLEX_LIMITED_RANGE says */
+    friend constexpr nuo_complex mul_fast(const nuo_complex& a,
+                                          const nuo_complex& b) noexcept {
+        return {a.re_ * b.re_ - a.im_ * b.im_, a.re_ * b.im_ + a.im_ * b.re_};
+    }
+
+    friend constexpr nuo_complex div_fast(const nuo_complex& a,
+                                          const nuo_complex& b) noexcept {
+        T n = b.re_ * b.re_ + b.im_ * b.im_;
+        return {(a.re_ * b.re_ + a.im_ * b.im_) / n,
+                (a.im_ * b.re_ - a.re_ * b.im_) / n};
+    }
+
+    /* Comparison */
+    friend constexpr bool operator==(const nuo_complex& a,
+                                     const nuo_complex& b) noexcept {
+        return a.re_ == b.re_ && a.im_ == b.im_;
+    }
+
+    friend constexpr bool operator==(const nuo_complex& a, T x) noexcept {
+        return a.re_ == x && a.im_ == T(0);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const nuo_complex& z) {
+        return os << '(' << z.re_ << ',' << z.im_ << ')';
+    }
+};
+
+/* Functions */
+
+template<std::floating_point T>
+constexpr nuo_complex<T> conj(const nuo_complex<T>& z) noexcept {
+    return {z.real(), -z.imag()};
+}
+
+/* |z|^2 */
+template<std::floating_point T>
+constexpr T norm(const nuo_complex<T>& z) noexcept {
+    return z.real() * z.real() + z.imag() * z.imag();
+}
+
+template<std::floating_point T>
+T abs(const nuo_complex<T>& z) noexcept {
+    return detail::nuo_complex_abs(z.real(), z.imag());
+}
+
+template<std::floating_point T>
+T arg(const nuo_complex<T>& z) noexcept {
+    return std::atan2(z.imag(), z.real());
+}
+
+/* r e^(i theta) */
+template<std::floating_point T>
+nuo_complex<T> polar(T r, T theta = T(0)) noexcept {
+    return {r * std::cos(theta), r * std::sin(theta)};
+}
+
+template<std::floating_point T>
+nuo_complex<T> exp(const nuo_complex<T>& z) noexcept {
+    return polar(std::exp(z.real()), z.imag());
+}
+
+/* Principal branch, imaginary part in (-pi, pi] */
+template<std::floating_point T>
+nuo_complex<T> log(const nuo_complex<T>& z) noexcept {
+    return {std::log(abs(z)), arg(z)};
+}
+
+/* Principal root, real part >= 0, without cancellation */
+template<std::floating_point T>
+nuo_complex<T> sqrt(const nuo_complex<T>& z) noexcept {
+    T x = z.real(), y = z.imag();
+    if (x == T(0) && y == T(0))
+        return {T(0), y};
+    T t = std::sqrt((std::fabs(x) + abs(z)) / T(2));
+    if (x >= T(0))
+        return {t, y / (T(2) * t)};
+    return {std::fabs(y) / (T(2) * t), std::copysign(t, y)};
+}
+
+/*
+ * Array of nuo_complex<T> stored split: all real parts in one 64-byte
+ * aligned block, all imaginary parts in another. Element-wise products
+ * (operator*, conj_mul) and magnitudes (abs, norm) run on the vector
+ * kernels of detail/nuo_complex_kernels.hpp, an interleaved array of
+ * std::complex needing shuffles for the same work. Elements are read and
+ * written by value through operator[] and set().
+ *
+ * Element-wise operations on arrays of different sizes throw
+ * std::invalid_argument, at() std::out_of_range.
+ */
+template<std::floating_point T>
+class nuo_complex_array {
+public:
+    using value_type = nuo_complex<T>;
+    using size_type = size_t;
+
+    static constexpr size_t align = 64;
+
+private:
+    T* re_ = nullptr;   /* one block: real parts, then imaginary parts */
+    T* im_ = nullptr;
+    size_t size_ = 0;
+
+    static size_t padded(size_t n) noexcept {
+        constexpr size_t step = align % sizeof(T) == 0 ? align / sizeof(T) : 1;
+        return (n + step - 1) / step * step;
+    }
+
+    static void check_size(bool ok) {
+        if (!ok)
+            throw std::invalid_argument("nuo_complex_array: size mismatch");
+    }
+
+    /* Storage for n elements, contents unspecified */
+    void reshape(size_t n) {
+        if (n == size_)
+            return;
+        T* p = nullptr;
+        size_t cap = padded(n);
+        if (n != 0) {
+            size_t bytes = 2 * cap * sizeof(T);
+            bytes = (bytes + align - 1) & ~(align - 1);
+            p = static_cast<T*>(aligned_alloc(align, bytes));
+            if (p == nullptr)
+                throw std::bad_alloc();
+        }
+        free(re_);
+        re_ = p;
+        im_ = p != nullptr ? p + cap : nullptr;
+        size_ = n;
+    }
+
+public:
+    nuo_complex_array() noexcept = default;
+
+    /* n zeros */
+    explicit nuo_complex_array(size_type n) : nuo_complex_array(n, value_type()) {}
+
+    nuo_complex_array(size_type n, const value_type& value) {
+        reshape(n);
+        fill(value);
+    }
+
+    nuo_complex_array(std::initializer_list<value_type> init) :
+        nuo_complex_array(init.begin(), init.end()) {}
+
+    template<std::forward_iterator It>
+        requires std::constructible_from<value_type, std::iter_reference_t<It>>
+    nuo_complex_array(It first, It last) {
+        reshape(static_cast<size_t>(std::distance(first, last)));
+        for (size_t i = 0; first != last; ++first, ++i)
+            set(i, value_type(*first));
+    }
+
+    /* From separate real and imaginary parts */
+    nuo_complex_array(const T* re, const T* im, size_type n) {
+        reshape(n);
+        if (n != 0) {
+            memcpy(re_, re, n * sizeof(T));
+            memcpy(im_, im, n * sizeof(T));
+        }
+    }
+
+    nuo_complex_array(const nuo_complex_array& o) :
+        nuo_complex_array(o.re_, o.im_, o.size_) {}
+
+    nuo_complex_array(nuo_complex_array&& o) noexcept :
+        re_(std::exchange(o.re_, nullptr)),
+        im_(std::exchange(o.im_, nullptr)),
+        size_(std::exchange(o.size_, 0)) {}
+
+    ~nuo_complex_array() { free(re_); }
+
+    nuo_complex_array& operator=(const nuo_complex_array& o) {
+        if (this != &o) {
+            reshape(o.size_);
+            if (size_ != 0) {
+                memcpy(re_, o.re_, size_ * sizeof(T));
+                memcpy(im_, o.im_, size_ * sizeof(T));
+            }
+        }
+        return *this;
+    }
+
+    nuo_complex_array& operator=(nuo_complex_array&& o) noexcept {
+        nuo_complex_array t(std::move(o));
+        swap(t);
+        return *this;
+    }
+
+    void swap(nuo_complex_array& o) noexcept {
+        std::swap(re_, o.re_);
+        std::swap(im_, o.im_);
+        std::swap(size_, o.size_);
+    }
+
+    friend void swap(nuo_complex_array& a, nuo_complex_array& b) noexcept {
+        a.swap(b);
+    }
+
+    /* Observers */
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    T* real_data() noexcept { return re_; }
+    const T* real_data() const noexcept { return re_; }
+    T* imag_data() noexcept { return im_; }
+    const T* imag_data() const noexcept { return im_; }
+
+    value_type operator[](size_type i) const noexcept { return {re_[i], im_[i]}; }
+
+    value_type at(size_type i) const {
+        if (i >= size_)
+            throw std::out_of_range("nuo_complex_array::at");
+        return (*this)[i];
+    }
+
+    void set(size_type i, const value_type& z) noexcept {
+        re_[i] = z.real();
+        im_[i] = z.imag();
+    }
+
+    /* Modifiers */
+    void fill(const value_type& z) noexcept {
+        std::fill_n(re_, size_, z.real());
+        std::fill_n(im_, size_, z.imag());
+    }
+
+    /* Keeps the first min(n, size()) elements, new ones are zero */
+    void resize(size_type n) {
+        if (n == size_)
+            return;
+        nuo_complex_array t;
+        t.reshape(n);
+        size_t keep = std::min(n, size_);
+        if (keep != 0) {
+            memcpy(t.re_, re_, keep * sizeof(T));
+            memcpy(t.im_, im_, keep * sizeof(T));
+        }
+        std::fill(t.re_ + keep, t.re_ + n, T(0));
+        std::fill(t.im_ + keep, t.im_ + n, T(0));
+        swap(t);
+    }
+
+    /* Element-wise arithmetic */
+    nuo_complex_array& operator+=(const nuo_complex_array& o) {
+        check_size(o.size_ == size_);
+        for (size_t i = 0; i < size_; i++) {
+            re_[i] += o.re_[i];
+            im_[i] += o.im_[i];
+        }
+        return *this;
+    }
+
+    nuo_complex_array& operator-=(const nuo_complex_array& o) {
+        check_size(o.size_ == size_);
+        for (size_t i = 0; i < size_; i++) {
+            re_[i] -= o.re_[i];
+            im_[i] -= o.im_[i];
+        }
+        return *this;
+    }
+
+    nuo_complex_array& operator*=(const nuo_complex_array& o) {
+        check_size(o.size_ == size_);
+        detail::nuo_complex_mul_n<T, false>(re_, im_, o.re_, o.im_, re_, im_,
+                                            size_);
+        return *this;
+    }
+
+    /* *this[i] * conj(o[i]) */
+    nuo_complex_array& conj_mul_assign(const nuo_complex_array& o) {
+        check_size(o.size_ == size_);
+        detail::nuo_complex_mul_n<T, true>(re_, im_, o.re_, o.im_, re_, im_,
+                                           size_);
+        return *this;
+    }
+
+    nuo_complex_array& operator*=(const value_type& z) noexcept {
+        for (size_t i = 0; i < size_; i++)
+            detail::nuo_complex_mul(re_[i], im_[i], z.real(), z.imag(),
+                                    re_[i], im_[i]);
+        return *this;
+    }
+
+    nuo_complex_array& operator*=(T x) noexcept {
+        for (size_t i = 0; i < size_; i++) {
+            re_[i] *= x;
+            im_[i] *= x;
+        }
+        return *this;
+    }
+
+    friend nuo_complex_array operator+(nuo_complex_array a,
+                                       const nuo_complex_array& b) {
+        return a += b;
+    }
+
+    friend nuo_complex_array operator-(nuo_complex_array a,
+                                       const nuo_complex_array& b) {
+        return a -= b;
+    }
+
+    friend nuo_complex_array operator*(const nuo_complex_array& a,
+                                       const nuo_complex_array& b) {
+        check_size(a.size_ == b.size_);
+        nuo_complex_array r;
+        r.reshape(a.size_);
+        detail::nuo_complex_mul_n<T, false>(a.re_, a.im_, b.re_, b.im_, r.re_,
+                                            r.im_, a.size_);
+        return r;
+    }
+
+    /* a[i] * conj(b[i]), the cross-correlation product */
+    friend nuo_complex_array conj_mul(const nuo_complex_array& a,
+                                      const nuo_complex_array& b) {
+        check_size(a.size_ == b.size_);
+        nuo_complex_array r;
+        r.reshape(a.size_);
+        detail::nuo_complex_mul_n<T, true>(a.re_, a.im_, b.re_, b.im_, r.re_,
+                                           r.im_, a.size_);
+        return r;
+    }
+
+    friend nuo_complex_array operator*(nuo_complex_array a, const value_type& z) noexcept {
+        return a *= z;
+    }
+
+    friend nuo_complex_array operator*(nuo_complex_array a, T x) noexcept {
+        return a *= x;
+    }
+
+    friend nuo_complex_array conj(nuo_complex_array a) noexcept {
+        for (size_t i = 0; i < a.size_; i++)
+            a.im_[i] = -a.im_[i];
+        return a;
+    }
+
+    /* |a[i]| */
+    friend std::vector<T> abs(const nuo_complex_array& a) {
+        std::vector<T> r(a.size_);
+        detail::nuo_complex_abs_n<T, false>(a.re_, a.im_, r.data(), a.size_);
+        return r;
+    }
+
+    /* |a[i]|^2 */
+    friend std::vector<T> norm(const nuo_complex_array& a) {
+        std::vector<T> r(a.size_);
+        detail::nuo_complex_abs_n<T, true>(a.re_, a.im_, r.data(), a.size_);
+        return r;
+    }
+
+    /* Comparison */
+    friend bool operator==(const nuo_complex_array& a,
+                           const nuo_complex_array& b) noexcept {
+        return a.size_ == b.size_ && std::equal(a.re_, a.re_ + a.size_, b.re_) &&
+               std::equal(a.im_, a.im_ + a.size_, b.im_);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const nuo_complex_array& a) {
+        os << '{';
+        for (size_t i = 0; i < a.size_; i++)
+            os << (i ? ", " : "") << a[i];
+        return os << '}';
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
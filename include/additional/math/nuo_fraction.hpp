@@ -0,0 +1,577 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_NUO_FRACTION_HPP_
+#define NUOSTL_ADDITIONAL_MATH_NUO_FRACTION_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "./detail/nuo_gcd.hpp"
+#include "./nuo_biginteger.hpp"
+
+namespace nuostl {
+
+namespace detail {
+
+template<typename Int>
+concept nuo_fraction_integer =
+    (std::signed_integral<Int> && sizeof(Int) <= 8) ||
+    std::same_as<Int, nuo_biginteger>;
+
+/* The product of two Int is exact in this type */
+template<typename Int>
+using nuo_fraction_wide =
+    std::conditional_t<(sizeof(Int) <= 4), int64_t, __int128>;
+
+}   /* namespace detail */
+
+template<detail::nuo_fraction_integer Int>
+class nuo_fraction;
+
+/*
+ * Rational over nuo_biginteger, the type nuo_fraction<Int> promotes to.
+ *
+ * It never overflows, so normalization is purely a size trade-off: the
+ * gcd is only taken once the larger of numerator and denominator has
+ * doubled in bits since the last reduction (at least 128 bits), which
+ * keeps the gcd cost amortized over long accumulation chains. Comparisons
+ * cross-multiply and need no reduction; numerator(), denominator() and
+ * output are in lowest terms. The denominator is always positive.
+ */
+template<>
+class nuo_fraction<nuo_biginteger> {
+    template<detail::nuo_fraction_integer>
+    friend class nuo_fraction;
+
+public:
+    using int_type = nuo_biginteger;
+
+private:
+    static constexpr size_t min_mark = 128;
+
+    nuo_biginteger num_;
+    nuo_biginteger den_ = nuo_biginteger(1);
+    size_t mark_ = min_mark;
+
+    size_t bits() const noexcept {
+        return std::max(num_.bit_length(), den_.bit_length());
+    }
+
+    void settle() {
+        if (bits() > mark_)
+            normalize();
+    }
+
+    void set_signed(nuo_biginteger n, nuo_biginteger d) {
+        if (d.is_zero())
+            throw std::domain_error("nuo_fraction: zero denominator");
+        if (d.sign() < 0) {
+            n = -n;
+            d = -d;
+        }
+        num_ = std::move(n);
+        den_ = std::move(d);
+        settle();
+    }
+
+public:
+    nuo_fraction() = default;
+
+    nuo_fraction(nuo_biginteger n) : num_(std::move(n)) {}
+
+    template<std::integral T>
+    nuo_fraction(T n) : num_(n) {}
+
+    nuo_fraction(nuo_biginteger n, nuo_biginteger d) {
+        set_signed(std::move(n), std::move(d));
+    }
+
+    /* Lowest terms */
+    nuo_fraction& normalize() {
+        nuo_biginteger g = gcd(num_, den_);
+        if (g != nuo_biginteger(1)) {
+            num_ /= g;
+            den_ /= g;
+        }
+        mark_ = std::max(min_mark, 2 * bits());
+        return *this;
+    }
+
+    nuo_biginteger numerator() const {
+        return nuo_fraction(*this).normalize().num_;
+    }
+
+    nuo_biginteger denominator() const {
+        return nuo_fraction(*this).normalize().den_;
+    }
+
+    int sign() const noexcept { return num_.sign(); }
+
+    explicit operator double() const {
+        /* keep both parts within the double exponent range */
+        size_t top = bits();
+        size_t s = top > 960 ? top - 960 : 0;
+        return static_cast<double>(num_ >> s) / static_cast<double>(den_ >> s);
+    }
+
+    /* Arithmetic */
+    nuo_fraction operator-() const {
+        nuo_fraction r(*this);
+        r.num_ = -r.num_;
+        return r;
+    }
+
+    nuo_fraction& operator+=(const nuo_fraction& o) {
+        if (den_ == o.den_) {
+            num_ += o.num_;
+        } else {
+            num_ = num_ * o.den_ + o.num_ * den_;
+            den_ *= o.den_;
+        }
+        settle();
+        return *this;
+    }
+
+    nuo_fraction& operator-=(const nuo_fraction& o) {
+        if (den_ == o.den_) {
+            num_ -= o.num_;
+        } else {
+            num_ = num_ * o.den_ - o.num_ * den_;
+            den_ *= o.den_;
+        }
+        settle();
+        return *this;
+    }
+
+    nuo_fraction& operator*=(const nuo_fraction& o) {
+        num_ *= o.num_;
+        den_ *= o.den_;
+        settle();
+        return *this;
+    }
+
+    nuo_fraction& operator/=(const nuo_fraction& o) {
+        nuo_biginteger n = num_ * o.den_;
+        nuo_biginteger d = den_ * o.num_;
+        set_signed(std::move(n), std::move(d));
+        return *this;
+    }
+
+    friend nuo_fraction operator+(nuo_fraction a, const nuo_fraction& b) {
+        a += b;
+        return a;
+    }
+
+    friend nuo_fraction operator-(nuo_fraction a, const nuo_fraction& b) {
+        a -= b;
+        return a;
+    }
+
+    friend nuo_fraction operator*(nuo_fraction a, const nuo_fraction& b) {
+        a *= b;
+        return a;
+    }
+
+    friend nuo_fraction operator/(nuo_fraction a, const nuo_fraction& b) {
+        a /= b;
+        return a;
+    }
+
+    /* Comparison */
+    friend bool operator==(const nuo_fraction& a, const nuo_fraction& b) {
+        if (a.den_ == b.den_)
+            return a.num_ == b.num_;
+        return a.num_ * b.den_ == b.num_ * a.den_;
+    }
+
+    friend std::strong_ordering operator<=>(const nuo_fraction& a,
+                                            const nuo_fraction& b) {
+        if (a.den_ == b.den_)
+            return a.num_ <=> b.num_;
+        return a.num_ * b.den_ <=> b.num_ * a.den_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const nuo_fraction& f) {
+        nuo_fraction r(f);
+        r.normalize();
+        os << r.num_;
+        if (r.den_ != nuo_biginteger(1))
+            os << '/' << r.den_;
+        return os;
+    }
+};
+
+/*
+ * Rational over a built-in signed integer, numerator and denominator kept
+ * in Int while they fit and promoted to nuo_fraction<nuo_biginteger> when
+ * they do not, so no operation overflows; the value moves back to Int once
+ * both parts fit again (a promoted result within twice Int's width is
+ * reduced first to give it the chance).
+ *
+ * Normalization is lazy. A result is only reduced (binary GCD) when its
+ * numerator or denominator reaches the upper half of Int's bits, where the
+ * next product would be likely to overflow, and on output or through
+ * numerator() / denominator(). Equal or small denominators add without a
+ * gcd; larger ones factor the gcd of the denominators out of the sum
+ * (Knuth's form). A product or quotient that overflows is retried with
+ * the operands cross-cancelled before promoting. Comparisons cross-multiply
+ * in a double-width integer and never reduce.
+ *
+ * A zero denominator or division by zero throws std::domain_error.
+ */
+template<detail::nuo_fraction_integer Int>
+class nuo_fraction {
+public:
+    using int_type = Int;
+    using big_type = nuo_fraction<nuo_biginteger>;
+
+private:
+    using U = std::make_unsigned_t<Int>;
+    using wide = detail::nuo_fraction_wide<Int>;
+
+    static constexpr int half = std::numeric_limits<Int>::digits / 2;
+    static constexpr Int min_int = std::numeric_limits<Int>::min();
+
+    Int num_ = 0;
+    Int den_ = 1;                   /* > 0 */
+    std::unique_ptr<big_type> big_; /* the value while it does not fit */
+
+    static U mag(Int x) noexcept {
+        return x < 0 ? static_cast<U>(U(0) - static_cast<U>(x))
+                     : static_cast<U>(x);
+    }
+
+    /* gcd(|a|, d) for d > 0, fits Int as it divides d */
+    static Int gcd_den(Int a, Int d) noexcept {
+        return static_cast<Int>(detail::nuo_gcd_binary(mag(a), mag(d)));
+    }
+
+    void reduce() noexcept {
+        Int g = gcd_den(num_, den_);
+        if (g > 1) {
+            num_ /= g;
+            den_ /= g;
+        }
+    }
+
+    /* Reduce once either part has a bit in the upper half */
+    void settle() noexcept {
+        if (((mag(num_) | mag(den_)) >> half) != 0)
+            reduce();
+    }
+
+    big_type as_big() const {
+        if (big_)
+            return *big_;
+        big_type r;
+        r.num_ = nuo_biginteger(num_);
+        r.den_ = nuo_biginteger(den_);
+        return r;
+    }
+
+    /* Back to Int if the promoted value fits */
+    void demote() {
+        big_type& b = *big_;
+        bool fits = b.num_.template fits<Int>() && b.den_.template fits<Int>();
+        /* an overflowed product may still reduce into Int */
+        if (!fits && b.bits() <= 2 * sizeof(Int) * 8) {
+            b.normalize();
+            fits = b.num_.template fits<Int>() && b.den_.template fits<Int>();
+        }
+        if (fits) {
+            num_ = static_cast<Int>(b.num_);
+            den_ = static_cast<Int>(b.den_);
+            big_.reset();
+            settle();
+        }
+    }
+
+    void set_big(big_type&& b) {
+        if (big_)
+            *big_ = std::move(b);
+        else
+            big_ = std::make_unique<big_type>(std::move(b));
+        demote();
+    }
+
+    /* *this = f(*this, o) in nuo_biginteger */
+    template<typename F>
+    void big_op(const nuo_fraction& o, F f) {
+        if (!big_)
+            big_ = std::make_unique<big_type>(as_big());
+        if (o.big_)
+            f(*big_, *o.big_);
+        else
+            f(*big_, o.as_big());
+        demote();
+    }
+
+    /* *this +- c / d in Int, false (value unchanged) if it cannot fit */
+    template<bool Sub>
+    bool add_small(Int c, Int d) noexcept {
+        auto addsub = [](Int x, Int y, Int* r) {
+            if constexpr (Sub)
+                return __builtin_sub_overflow(x, y, r);
+            else
+                return __builtin_add_overflow(x, y, r);
+        };
+        Int n, t, m;
+        if (den_ == d) {
+            if (!addsub(num_, c, &n)) {
+                num_ = n;
+                settle();
+                return true;
+            }
+        } else if (!__builtin_mul_overflow(den_, d, &m) &&
+                   (mag(m) >> half) == 0 &&
+                   !__builtin_mul_overflow(num_, d, &n) &&
+                   !__builtin_mul_overflow(c, den_, &t) &&
+                   !addsub(n, t, &n)) {
+            /* small denominators: no gcd at all */
+            num_ = n;
+            den_ = m;
+            settle();
+            return true;
+        }
+
+        /*
+         * a/b +- c/d = (a d' +- c b') / (b' (d / g2)) with g = (b, d),
+         * b' = b / g, d' = d / g and g2 = (a d' +- c b', g): lowest terms
+         * from lowest terms, and the gcds are of the operands rather than
+         * of the product. Retried once with both operands reduced.
+         */
+        auto knuth = [&] {
+            Int g = gcd_den(den_, d);
+            Int b1 = den_ / g, d1 = d / g;
+            Int s, u, w;
+            if (__builtin_mul_overflow(num_, d1, &s) ||
+                __builtin_mul_overflow(c, b1, &u) || addsub(s, u, &s))
+                return false;
+            Int g2 = gcd_den(s, g);
+            if (__builtin_mul_overflow(b1, d / g2, &w))
+                return false;
+            num_ = s / g2;
+            den_ = w;
+            settle();
+            return true;
+        };
+        if (knuth())
+            return true;
+        reduce();
+        Int g0 = gcd_den(c, d);
+        c /= g0;
+        d /= g0;
+        return knuth();
+    }
+
+    /* *this * c / d, d > 0 */
+    bool mul_small(Int c, Int d) noexcept {
+        Int n, m;
+        if (!__builtin_mul_overflow(num_, c, &n) &&
+            !__builtin_mul_overflow(den_, d, &m)) {
+            num_ = n;
+            den_ = m;
+            settle();
+            return true;
+        }
+        /* cross-cancel: (a / g1)(c / g2) / ((b / g2)(d / g1)) */
+        Int g1 = gcd_den(num_, d), g2 = gcd_den(c, den_);
+        if (__builtin_mul_overflow(num_ / g1, c / g2, &n) ||
+            __builtin_mul_overflow(den_ / g2, d / g1, &m))
+            return false;
+        num_ = n;
+        den_ = m;
+        settle();
+        return true;
+    }
+
+    /* *this * d / c */
+    bool div_small(Int c, Int d) noexcept {
+        if (c == min_int)
+            return false;
+        return c < 0 ? mul_small(-d, -c) : mul_small(d, c);
+    }
+
+public:
+    nuo_fraction() = default;
+
+    nuo_fraction(Int n) noexcept : num_(n) {}
+
+    nuo_fraction(Int n, Int d) : num_(n), den_(d) {
+        if (d == 0)
+            throw std::domain_error("nuo_fraction: zero denominator");
+        if (d < 0) {
+            if (n == min_int || d == min_int) {
+                set_big(big_type(nuo_biginteger(n), nuo_biginteger(d)));
+                return;
+            }
+            num_ = -n;
+            den_ = -d;
+        }
+    }
+
+    explicit nuo_fraction(const big_type& b) {
+        set_big(big_type(b));
+    }
+
+    nuo_fraction(const nuo_fraction& o) :
+        num_(o.num_), den_(o.den_),
+        big_(o.big_ ? std::make_unique<big_type>(*o.big_) : nullptr) {}
+
+    nuo_fraction(nuo_fraction&&) noexcept = default;
+
+    nuo_fraction& operator=(const nuo_fraction& o) {
+        if (this != &o) {
+            nuo_fraction t(o);
+            *this = std::move(t);
+        }
+        return *this;
+    }
+
+    nuo_fraction& operator=(nuo_fraction&&) noexcept = default;
+
+    /* Observers */
+
+    /* true while the value lives in nuo_biginteger */
+    bool promoted() const noexcept { return big_ != nullptr; }
+
+    big_type to_big() const { return as_big(); }
+
+    /* Lowest terms; throws std::overflow_error if it does not fit Int */
+    Int numerator() const {
+        nuo_fraction r(*this);
+        r.normalize();
+        if (r.big_)
+            throw std::overflow_error("nuo_fraction: numerator exceeds Int");
+        return r.num_;
+    }
+
+    Int denominator() const {
+        nuo_fraction r(*this);
+        r.normalize();
+        if (r.big_)
+            throw std::overflow_error("nuo_fraction: denominator exceeds Int");
+        return r.den_;
+    }
+
+    int sign() const noexcept {
+        if (big_)
+            return big_->sign();
+        return (num_ > 0) - (num_ < 0);
+    }
+
+    nuo_fraction& normalize() {
+        if (big_) {
+            big_->normalize();
+            demote();
+        } else {
+            reduce();
+        }
+        return *this;
+    }
+
+    explicit operator double() const {
+        if (big_)
+            return static_cast<double>(*big_);
+        return static_cast<double>(num_) / static_cast<double>(den_);
+    }
+
+    /* Arithmetic */
+    nuo_fraction operator-() const {
+        if (!big_ && num_ != min_int) {
+            nuo_fraction r(*this);
+            r.num_ = -r.num_;
+            return r;
+        }
+        nuo_fraction r;
+        r.set_big(-as_big());
+        return r;
+    }
+
+    nuo_fraction& operator+=(const nuo_fraction& o) {
+        if (!big_ && !o.big_ && add_small<false>(o.num_, o.den_))
+            return *this;
+        big_op(o, [](big_type& a, const big_type& b) { a += b; });
+        return *this;
+    }
+
+    nuo_fraction& operator-=(const nuo_fraction& o) {
+        if (!big_ && !o.big_ && add_small<true>(o.num_, o.den_))
+            return *this;
+        big_op(o, [](big_type& a, const big_type& b) { a -= b; });
+        return *this;
+    }
+
+    nuo_fraction& operator*=(const nuo_fraction& o) {
+        if (!big_ && !o.big_ && mul_small(o.num_, o.den_))
+            return *this;
+        big_op(o, [](big_type& a, const big_type& b) { a *= b; });
+        return *this;
+    }
+
+    nuo_fraction& operator/=(const nuo_fraction& o) {
+        if (o.sign() == 0)
+            throw std::domain_error("nuo_fraction: division by zero");
+        if (!big_ && !o.big_ && div_small(o.num_, o.den_))
+            return *this;
+        big_op(o, [](big_type& a, const big_type& b) { a /= b; });
+        return *this;
+    }
+
+    friend nuo_fraction operator+(nuo_fraction a, const nuo_fraction& b) {
+        a += b;
+        return a;
+    }
+
+    friend nuo_fraction operator-(nuo_fraction a, const nuo_fraction& b) {
+        a -= b;
+        return a;
+    }
+
+    friend nuo_fraction operator*(nuo_fraction a, const nuo_fraction& b) {
+        a *= b;
+        return a;
+    }
+
+    friend nuo_fraction operator/(nuo_fraction a, const nuo_fraction& b) {
+        a /= b;
+        return a;
+    }
+
+    /* Comparison */
+    friend bool operator==(const nuo_fraction& a, const nuo_fraction& b) {
+        if (a.big_ || b.big_)
+            return a.as_big() == b.as_big();
+        return wide(a.num_) * b.den_ == wide(b.num_) * a.den_;
+    }
+
+    friend std::strong_ordering operator<=>(const nuo_fraction& a,
+                                            const nuo_fraction& b) {
+        if (a.big_ || b.big_)
+            return a.as_big() <=> b.as_big();
+        return wide(a.num_) * b.den_ <=> wide(b.num_) * a.den_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const nuo_fraction& f) {
+        if (f.big_)
+            return os << *f.big_;
+        nuo_fraction r(f);
+        r.reduce();
+        os << +r.num_;
+        if (r.den_ != 1)
+            os << '/' << +r.den_;
+        return os;
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
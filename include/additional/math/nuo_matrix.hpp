@@ -0,0 +1,628 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_NUO_MATRIX_HPP_
+#define NUOSTL_ADDITIONAL_MATH_NUO_MATRIX_HPP_
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <initializer_list>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "./detail/nuo_gemm.hpp"
+
+namespace nuostl {
+
+template<typename T>
+class nuo_matrix;
+
+namespace detail {
+
+/*
+ * Lazy matrix expressions. A node is cheap to build and holds its
+ * nuo_matrix leaves by reference and its sub-expressions by value, so an
+ * expression must not outlive the matrices it was built from. Every node
+ * exposes rows(), cols(), coeff(i, j), prepare() (evaluates the products
+ * nested inside an element-wise expression, once) and aliases(p) (whether
+ * a leaf is the matrix stored at p).
+ */
+template<typename E>
+concept nuo_matrix_expression = requires(const E& e) {
+    typename E::value_type;
+    { E::nuo_matrix_leaf } -> std::convertible_to<bool>;
+    { e.rows() } -> std::convertible_to<size_t>;
+    { e.cols() } -> std::convertible_to<size_t>;
+};
+
+template<typename E>
+using nuo_mat_operand =
+    std::conditional_t<E::nuo_matrix_leaf, const E&, const E>;
+
+struct nuo_mat_add {
+    template<typename T>
+    static T apply(const T& a, const T& b) {
+        return a + b;
+    }
+};
+
+struct nuo_mat_sub {
+    template<typename T>
+    static T apply(const T& a, const T& b) {
+        return a - b;
+    }
+};
+
+inline void nuo_mat_check(bool ok) {
+    if (!ok)
+        throw std::invalid_argument("nuo_matrix: shape mismatch");
+}
+
+template<typename Op, typename L, typename R>
+class nuo_mat_binary {
+public:
+    using value_type = typename L::value_type;
+    static constexpr bool nuo_matrix_leaf = false;
+
+private:
+    nuo_mat_operand<L> l_;
+    nuo_mat_operand<R> r_;
+
+public:
+    nuo_mat_binary(const L& l, const R& r) : l_(l), r_(r) {
+        nuo_mat_check(l.rows() == r.rows() && l.cols() == r.cols());
+    }
+
+    size_t rows() const noexcept { return l_.rows(); }
+    size_t cols() const noexcept { return l_.cols(); }
+    const L& lhs() const noexcept { return l_; }
+    const R& rhs() const noexcept { return r_; }
+
+    value_type coeff(size_t i, size_t j) const {
+        return Op::apply(l_.coeff(i, j), r_.coeff(i, j));
+    }
+
+    void prepare() const {
+        l_.prepare();
+        r_.prepare();
+    }
+
+    bool aliases(const value_type* p) const noexcept {
+        return l_.aliases(p) || r_.aliases(p);
+    }
+};
+
+template<typename E>
+class nuo_mat_negate {
+public:
+    using value_type = typename E::value_type;
+    static constexpr bool nuo_matrix_leaf = false;
+
+private:
+    nuo_mat_operand<E> e_;
+
+public:
+    explicit nuo_mat_negate(const E& e) : e_(e) {}
+
+    size_t rows() const noexcept { return e_.rows(); }
+    size_t cols() const noexcept { return e_.cols(); }
+    value_type coeff(size_t i, size_t j) const { return -e_.coeff(i, j); }
+    void prepare() const { e_.prepare(); }
+    bool aliases(const value_type* p) const noexcept { return e_.aliases(p); }
+};
+
+template<typename E>
+class nuo_mat_scaled {
+public:
+    using value_type = typename E::value_type;
+    static constexpr bool nuo_matrix_leaf = false;
+
+private:
+    value_type s_;
+    nuo_mat_operand<E> e_;
+
+public:
+    nuo_mat_scaled(const value_type& s, const E& e) : s_(s), e_(e) {}
+
+    size_t rows() const noexcept { return e_.rows(); }
+    size_t cols() const noexcept { return e_.cols(); }
+    const value_type& scalar() const noexcept { return s_; }
+    const E& inner() const noexcept { return e_; }
+    value_type coeff(size_t i, size_t j) const { return s_ * e_.coeff(i, j); }
+    void prepare() const { e_.prepare(); }
+    bool aliases(const value_type* p) const noexcept { return e_.aliases(p); }
+};
+
+template<typename L, typename R>
+class nuo_mat_product;
+
+template<typename E>
+inline constexpr bool nuo_mat_is_product = false;
+template<typename L, typename R>
+inline constexpr bool nuo_mat_is_product<nuo_mat_product<L, R>> = true;
+
+/* P or s P, a product that can be evaluated straight into C with alpha */
+template<typename E>
+inline constexpr bool nuo_mat_is_gemm = nuo_mat_is_product<E>;
+template<typename E>
+inline constexpr bool nuo_mat_is_gemm<nuo_mat_scaled<E>> =
+    nuo_mat_is_product<E>;
+
+/* X + P or P + X as 1, X - P or P - X as -1, P a gemm */
+template<typename E>
+inline constexpr int nuo_mat_is_gemm_sum = 0;
+template<typename L, typename R>
+inline constexpr int nuo_mat_is_gemm_sum<nuo_mat_binary<nuo_mat_add, L, R>> =
+    nuo_mat_is_gemm<L> || nuo_mat_is_gemm<R> ? 1 : 0;
+template<typename L, typename R>
+inline constexpr int nuo_mat_is_gemm_sum<nuo_mat_binary<nuo_mat_sub, L, R>> =
+    nuo_mat_is_gemm<L> || nuo_mat_is_gemm<R> ? -1 : 0;
+
+/*
+ * Operand of a product as a nuo_matrix: a leaf as is, s M as M with s
+ * folded into alpha, anything else evaluated into tmp.
+ */
+template<typename T, typename E>
+const nuo_matrix<T>& nuo_mat_materialize(const E& e, nuo_matrix<T>& tmp,
+                                         T& alpha) {
+    if constexpr (E::nuo_matrix_leaf) {
+        return e;
+    } else if constexpr (std::is_same_v<E, nuo_mat_scaled<nuo_matrix<T>>>) {
+        alpha = alpha * e.scalar();
+        return e.inner();
+    } else {
+        tmp = e;
+        return tmp;
+    }
+}
+
+template<typename L, typename R>
+class nuo_mat_product {
+public:
+    using value_type = typename L::value_type;
+    static constexpr bool nuo_matrix_leaf = false;
+
+private:
+    nuo_mat_operand<L> l_;
+    nuo_mat_operand<R> r_;
+    mutable nuo_matrix<value_type> value_;
+    mutable bool ready_ = false;
+
+public:
+    nuo_mat_product(const L& l, const R& r) : l_(l), r_(r) {
+        nuo_mat_check(l.cols() == r.rows());
+    }
+
+    size_t rows() const noexcept { return l_.rows(); }
+    size_t cols() const noexcept { return r_.cols(); }
+
+    /* Only valid after prepare() */
+    value_type coeff(size_t i, size_t j) const { return value_(i, j); }
+
+    void prepare() const {
+        if (!ready_) {
+            value_ = *this;
+            ready_ = true;
+        }
+    }
+
+    bool aliases(const value_type* p) const noexcept {
+        return l_.aliases(p) || r_.aliases(p);
+    }
+
+    /* c = alpha L R + beta c, c rows() x cols() and not aliased */
+    void gemm(value_type alpha, value_type beta,
+              nuo_matrix<value_type>& c) const {
+        nuo_matrix<value_type> ta, tb;
+        const nuo_matrix<value_type>& a = nuo_mat_materialize(l_, ta, alpha);
+        const nuo_matrix<value_type>& b = nuo_mat_materialize(r_, tb, alpha);
+        nuo_gemm<value_type>({a.rows(), b.cols(), a.cols(), alpha, a.data(),
+                              a.stride(), b.data(), b.stride(), beta,
+                              c.data(), c.stride()});
+    }
+};
+
+/* P as (P, 1), s P as (P, s) */
+template<typename E>
+const auto& nuo_mat_gemm_product(const E& e) {
+    if constexpr (nuo_mat_is_product<E>)
+        return e;
+    else
+        return e.inner();
+}
+
+template<typename E>
+typename E::value_type nuo_mat_gemm_alpha(const E& e) {
+    if constexpr (nuo_mat_is_product<E>)
+        return typename E::value_type(1);
+    else
+        return e.scalar();
+}
+
+}   /* namespace detail */
+
+/*
+ * Dense row-major matrix of trivially copyable T.
+ *
+ * Every row starts on a 64-byte boundary: the row stride is the column
+ * count rounded up to a cache line, the padding is never read. Arithmetic
+ * builds lazy expressions (see detail::nuo_mat_binary and friends) that
+ * are evaluated element by element on assignment, without temporaries.
+ * Products go through detail::nuo_gemm, the packed and register-blocked
+ * GEMM (AVX2/AVX-512 FMA kernels for float and double, threaded for large
+ * sizes), and assignments of the form
+ *
+ *     D = A * B,  D = s * (A * B),  D = A * B + C,  D = C - A * B,  D += A * B
+ *
+ * run as one GEMM into D with the right alpha and beta, C copied into D
+ * first. Operands of a product that are themselves expressions, other
+ * than s * M, are evaluated into temporaries, as are products nested
+ * deeper in an element-wise expression. A product whose operands alias
+ * the destination is evaluated into fresh storage.
+ *
+ * Shape mismatches throw std::invalid_argument when the expression is
+ * built, at() throws std::out_of_range.
+ */
+template<typename T>
+class nuo_matrix {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "nuo_matrix: T must be trivially copyable");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    static constexpr bool nuo_matrix_leaf = true;
+
+private:
+    static constexpr size_t align = 64;
+
+    T* data_ = nullptr;
+    size_t rows_ = 0;
+    size_t cols_ = 0;
+    size_t stride_ = 0;
+
+    static size_t padded(size_t cols) noexcept {
+        if constexpr (align % sizeof(T) == 0)
+            return detail::nuo_gemm_round_up(cols, align / sizeof(T));
+        else
+            return cols;
+    }
+
+    /* Storage for rows x cols, contents unspecified */
+    void reshape(size_t rows, size_t cols) {
+        if (rows == rows_ && cols == cols_)
+            return;
+        size_t stride = padded(cols);
+        T* p = nullptr;
+        if (rows != 0 && cols != 0) {
+            size_t bytes = rows * stride * sizeof(T);
+            bytes = (bytes + align - 1) & ~(align - 1);
+            p = static_cast<T*>(aligned_alloc(align, bytes));
+            if (p == nullptr)
+                throw std::bad_alloc();
+        }
+        free(data_);
+        data_ = p;
+        rows_ = rows;
+        cols_ = cols;
+        stride_ = rows != 0 && cols != 0 ? stride : 0;
+    }
+
+    template<typename E>
+    void assign(const E& e) {
+        if constexpr (detail::nuo_mat_is_gemm<E>) {
+            const auto& p = detail::nuo_mat_gemm_product(e);
+            if (p.aliases(data_)) {
+                nuo_matrix t(e);
+                swap(t);
+                return;
+            }
+            reshape(p.rows(), p.cols());
+            p.gemm(detail::nuo_mat_gemm_alpha(e), T(0), *this);
+        } else if constexpr (detail::nuo_mat_is_gemm_sum<E>) {
+            /* X +- P or P +- X: X into *this, then one GEMM with beta = +-1 */
+            constexpr bool sub = detail::nuo_mat_is_gemm_sum<E> < 0;
+            constexpr bool left = detail::nuo_mat_is_gemm<
+                std::remove_cvref_t<decltype(e.lhs())>>;
+            const auto& pe = [&]() -> const auto& {
+                if constexpr (left) return e.lhs(); else return e.rhs();
+            }();
+            const auto& x = [&]() -> const auto& {
+                if constexpr (left) return e.rhs(); else return e.lhs();
+            }();
+            const auto& p = detail::nuo_mat_gemm_product(pe);
+            if (p.aliases(data_)) {
+                nuo_matrix t(e);
+                swap(t);
+                return;
+            }
+            assign(x);
+            T alpha = detail::nuo_mat_gemm_alpha(pe);
+            if (sub && !left)
+                alpha = -alpha;
+            p.gemm(alpha, sub && left ? T(-1) : T(1), *this);
+        } else {
+            e.prepare();
+            reshape(e.rows(), e.cols());
+            for (size_t i = 0; i < rows_; i++) {
+                T* d = row(i);
+                for (size_t j = 0; j < cols_; j++)
+                    d[j] = e.coeff(i, j);
+            }
+        }
+    }
+
+    /* *this += sign e */
+    template<typename E>
+    void accumulate(const E& e, bool negate) {
+        detail::nuo_mat_check(e.rows() == rows_ && e.cols() == cols_);
+        if constexpr (detail::nuo_mat_is_gemm<E>) {
+            const auto& p = detail::nuo_mat_gemm_product(e);
+            if (p.aliases(data_)) {
+                nuo_matrix t(e);
+                accumulate(t, negate);
+                return;
+            }
+            T alpha = detail::nuo_mat_gemm_alpha(e);
+            p.gemm(negate ? -alpha : alpha, T(1), *this);
+        } else {
+            e.prepare();
+            for (size_t i = 0; i < rows_; i++) {
+                T* d = row(i);
+                for (size_t j = 0; j < cols_; j++)
+                    d[j] = negate ? d[j] - e.coeff(i, j) : d[j] + e.coeff(i, j);
+            }
+        }
+    }
+
+public:
+    nuo_matrix() noexcept = default;
+
+    /* rows x cols zeros */
+    nuo_matrix(size_type rows, size_type cols) : nuo_matrix(rows, cols, T()) {}
+
+    nuo_matrix(size_type rows, size_type cols, const T& value) {
+        reshape(rows, cols);
+        fill(value);
+    }
+
+    nuo_matrix(std::initializer_list<std::initializer_list<T>> rows) {
+        size_t cols = rows.size() ? rows.begin()->size() : 0;
+        for (const auto& r : rows)
+            detail::nuo_mat_check(r.size() == cols);
+        reshape(rows.size(), cols);
+        size_t i = 0;
+        for (const auto& r : rows)
+            std::copy(r.begin(), r.end(), row(i++));
+    }
+
+    template<detail::nuo_matrix_expression E>
+        requires(!std::is_same_v<E, nuo_matrix> &&
+                 std::is_same_v<typename E::value_type, T>)
+    nuo_matrix(const E& e) {
+        assign(e);
+    }
+
+    nuo_matrix(const nuo_matrix& o) {
+        reshape(o.rows_, o.cols_);
+        if (data_ != nullptr)
+            memcpy(data_, o.data_, rows_ * stride_ * sizeof(T));
+    }
+
+    nuo_matrix(nuo_matrix&& o) noexcept :
+        data_(std::exchange(o.data_, nullptr)),
+        rows_(std::exchange(o.rows_, 0)),
+        cols_(std::exchange(o.cols_, 0)),
+        stride_(std::exchange(o.stride_, 0)) {}
+
+    ~nuo_matrix() {
+        free(data_);
+    }
+
+    nuo_matrix& operator=(const nuo_matrix& o) {
+        if (this != &o) {
+            reshape(o.rows_, o.cols_);
+            if (data_ != nullptr)
+                memcpy(data_, o.data_, rows_ * stride_ * sizeof(T));
+        }
+        return *this;
+    }
+
+    nuo_matrix& operator=(nuo_matrix&& o) noexcept {
+        nuo_matrix t(std::move(o));
+        swap(t);
+        return *this;
+    }
+
+    template<detail::nuo_matrix_expression E>
+        requires(!std::is_same_v<E, nuo_matrix> &&
+                 std::is_same_v<typename E::value_type, T>)
+    nuo_matrix& operator=(const E& e) {
+        assign(e);
+        return *this;
+    }
+
+    static nuo_matrix identity(size_type n) {
+        nuo_matrix m(n, n);
+        for (size_t i = 0; i < n; i++)
+            m(i, i) = T(1);
+        return m;
+    }
+
+    void swap(nuo_matrix& o) noexcept {
+        std::swap(data_, o.data_);
+        std::swap(rows_, o.rows_);
+        std::swap(cols_, o.cols_);
+        std::swap(stride_, o.stride_);
+    }
+
+    /* ------------------------------------------------- */
+
+    size_type rows() const noexcept { return rows_; }
+    size_type cols() const noexcept { return cols_; }
+    /* Elements between the starts of consecutive rows */
+    size_type stride() const noexcept { return stride_; }
+    bool empty() const noexcept { return rows_ == 0 || cols_ == 0; }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+    T* row(size_type i) noexcept { return data_ + i * stride_; }
+    const T* row(size_type i) const noexcept { return data_ + i * stride_; }
+
+    T& operator()(size_type i, size_type j) noexcept {
+        return data_[i * stride_ + j];
+    }
+
+    const T& operator()(size_type i, size_type j) const noexcept {
+        return data_[i * stride_ + j];
+    }
+
+    T& at(size_type i, size_type j) {
+        if (i >= rows_ || j >= cols_)
+            throw std::out_of_range("nuo_matrix::at");
+        return (*this)(i, j);
+    }
+
+    const T& at(size_type i, size_type j) const {
+        if (i >= rows_ || j >= cols_)
+            throw std::out_of_range("nuo_matrix::at");
+        return (*this)(i, j);
+    }
+
+    /* Expression interface */
+    T coeff(size_type i, size_type j) const noexcept { return (*this)(i, j); }
+    void prepare() const noexcept {}
+    bool aliases(const T* p) const noexcept {
+        return p != nullptr && p == data_;
+    }
+
+    /* ------------------------------------------------- */
+
+    void fill(const T& value) {
+        for (size_t i = 0; i < rows_; i++)
+            std::fill(row(i), row(i) + cols_, value);
+    }
+
+    /* 32 x 32 tiles, so both sides stream whole cache lines */
+    nuo_matrix transpose() const {
+        constexpr size_t tile = 32;
+        nuo_matrix t;
+        t.reshape(cols_, rows_);
+        for (size_t i0 = 0; i0 < rows_; i0 += tile) {
+            size_t i1 = std::min(rows_, i0 + tile);
+            for (size_t j0 = 0; j0 < cols_; j0 += tile) {
+                size_t j1 = std::min(cols_, j0 + tile);
+                for (size_t i = i0; i < i1; i++) {
+                    for (size_t j = j0; j < j1; j++)
+                        t(j, i) = (*this)(i, j);
+                }
+            }
+        }
+        return t;
+    }
+
+    template<detail::nuo_matrix_expression E>
+        requires std::is_same_v<typename E::value_type, T>
+    nuo_matrix& operator+=(const E& e) {
+        accumulate(e, false);
+        return *this;
+    }
+
+    template<detail::nuo_matrix_expression E>
+        requires std::is_same_v<typename E::value_type, T>
+    nuo_matrix& operator-=(const E& e) {
+        accumulate(e, true);
+        return *this;
+    }
+
+    /* *this = *this * e */
+    template<detail::nuo_matrix_expression E>
+        requires std::is_same_v<typename E::value_type, T>
+    nuo_matrix& operator*=(const E& e) {
+        assign(detail::nuo_mat_product<nuo_matrix, E>(*this, e));
+        return *this;
+    }
+
+    nuo_matrix& operator*=(const T& s) {
+        for (size_t i = 0; i < rows_; i++) {
+            T* d = row(i);
+            for (size_t j = 0; j < cols_; j++)
+                d[j] = d[j] * s;
+        }
+        return *this;
+    }
+
+    friend bool operator==(const nuo_matrix& a, const nuo_matrix& b) {
+        if (a.rows_ != b.rows_ || a.cols_ != b.cols_)
+            return false;
+        for (size_t i = 0; i < a.rows_; i++) {
+            if (!std::equal(a.row(i), a.row(i) + a.cols_, b.row(i)))
+                return false;
+        }
+        return true;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const nuo_matrix& m) {
+        os << '{';
+        for (size_t i = 0; i < m.rows_; i++) {
+            os << (i ? ", {" : "{");
+            for (size_t j = 0; j < m.cols_; j++)
+                os << (j ? ", " : "") << m(i, j);
+            os << '}';
+        }
+        return os << '}';
+    }
+};
+
+/* ------------------------------------------------- */
+/* Expression builders */
+
+template<detail::nuo_matrix_expression L, detail::nuo_matrix_expression R>
+    requires std::is_same_v<typename L::value_type, typename R::value_type>
+auto operator+(const L& l, const R& r) {
+    return detail::nuo_mat_binary<detail::nuo_mat_add, L, R>(l, r);
+}
+
+template<detail::nuo_matrix_expression L, detail::nuo_matrix_expression R>
+    requires std::is_same_v<typename L::value_type, typename R::value_type>
+auto operator-(const L& l, const R& r) {
+    return detail::nuo_mat_binary<detail::nuo_mat_sub, L, R>(l, r);
+}
+
+template<detail::nuo_matrix_expression E>
+auto operator-(const E& e) {
+    return detail::nuo_mat_negate<E>(e);
+}
+
+template<detail::nuo_matrix_expression L, detail::nuo_matrix_expression R>
+    requires std::is_same_v<typename L::value_type, typename R::value_type>
+auto operator*(const L& l, const R& r) {
+    return detail::nuo_mat_product<L, R>(l, r);
+}
+
+template<detail::nuo_matrix_expression E>
+auto operator*(const typename E::value_type& s, const E& e) {
+    return detail::nuo_mat_scaled<E>(s, e);
+}
+
+template<detail::nuo_matrix_expression E>
+auto operator*(const E& e, const typename E::value_type& s) {
+    return detail::nuo_mat_scaled<E>(s, e);
+}
+
+/*
+ * Cap on the threads a large product may use, 0 restores the default
+ * (std::thread::hardware_concurrency()).
+ */
+inline void nuo_matrix_set_threads(size_t n) {
+    detail::nuo_thread_team_limit.store(n, std::memory_order_relaxed);
+}
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_NUO_MODINT_HPP_
+#define NUOSTL_ADDITIONAL_MATH_NUO_MODINT_HPP_
+
+#include <stdint.h>
+
+#include <concepts>
+#include <ostream>
+#include <type_traits>
+
+namespace nuostl {
+
+/*
+ * Integer modulo M, the exact coefficient type of nuo_polynomial (its
+ * products go through the NTT, its division and interpolation need a
+ * field). Division and inv() use Fermat's little theorem and so assume M
+ * is prime.
+ */
+template<uint32_t M>
+class nuo_modint {
+    static_assert(M >= 1, "nuo_modint: the modulus must be positive");
+
+    uint32_t v_ = 0;
+
+public:
+    using value_type = uint32_t;
+
+    static constexpr uint32_t modulus() noexcept { return M; }
+
+    /* Constructor */
+    constexpr nuo_modint() noexcept = default;
+
+    template<std::integral T>
+    constexpr nuo_modint(T x) noexcept {
+        if constexpr (std::is_signed_v<T>) {
+            int64_t r = static_cast<int64_t>(x) % static_cast<int64_t>(M);
+            v_ = static_cast<uint32_t>(r < 0 ? r + M : r);
+        } else {
+            v_ = static_cast<uint32_t>(static_cast<uint64_t>(x) % M);
+        }
+    }
+
+    /* A value known to be in [0, M) */
+    static constexpr nuo_modint raw(uint32_t v) noexcept {
+        nuo_modint r;
+        r.v_ = v;
+        return r;
+    }
+
+    constexpr uint32_t value() const noexcept { return v_; }
+    explicit constexpr operator uint32_t() const noexcept { return v_; }
+
+    /* Arithmetic */
+    constexpr nuo_modint& operator+=(nuo_modint b) noexcept {
+        uint64_t s = uint64_t(v_) + b.v_;
+        v_ = static_cast<uint32_t>(s >= M ? s - M : s);
+        return *this;
+    }
+    constexpr nuo_modint& operator-=(nuo_modint b) noexcept {
+        v_ = v_ >= b.v_ ? v_ - b.v_ : static_cast<uint32_t>(uint64_t(v_) + M - b.v_);
+        return *this;
+    }
+    constexpr nuo_modint& operator*=(nuo_modint b) noexcept {
+        v_ = static_cast<uint32_t>(uint64_t(v_) * b.v_ % M);
+        return *this;
+    }
+    constexpr nuo_modint& operator/=(nuo_modint b) noexcept {
+        return *this *= b.inv();
+    }
+
+    constexpr nuo_modint operator-() const noexcept {
+        return raw(v_ == 0 ? 0 : M - v_);
+    }
+    constexpr nuo_modint operator+() const noexcept { return *this; }
+
+    constexpr nuo_modint pow(uint64_t e) const noexcept {
+        nuo_modint r = raw(1 % M), b = *this;
+        while (e != 0) {
+            if (e & 1)
+                r *= b;
+            b *= b;
+            e >>= 1;
+        }
+        return r;
+    }
+
+    /* Multiplicative inverse, M prime and *this != 0 */
+    constexpr nuo_modint inv() const noexcept { return pow(M - 2); }
+
+    friend constexpr nuo_modint operator+(nuo_modint a, nuo_modint b) noexcept {
+        return a += b;
+    }
+    friend constexpr nuo_modint operator-(nuo_modint a, nuo_modint b) noexcept {
+        return a -= b;
+    }
+    friend constexpr nuo_modint operator*(nuo_modint a, nuo_modint b) noexcept {
+        return a *= b;
+    }
+    friend constexpr nuo_modint operator/(nuo_modint a, nuo_modint b) noexcept {
+        return a /= b;
+    }
+
+    friend constexpr bool operator==(nuo_modint a, nuo_modint b) noexcept {
+        return a.v_ == b.v_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, nuo_modint a) {
+        return os << a.v_;
+    }
+};
+
+namespace detail {
+
+template<typename T>
+inline constexpr bool nuo_is_modint = false;
+
+template<uint32_t M>
+inline constexpr bool nuo_is_modint<nuo_modint<M>> = true;
+
+}   /* namespace detail */
+
+}   /* namespace nuostl */
+
+#endif
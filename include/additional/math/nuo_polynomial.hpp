@@ -0,0 +1,419 @@
+#ifndef NUOSTL_ADDITIONAL_MATH_NUO_POLYNOMIAL_HPP_
+#define NUOSTL_ADDITIONAL_MATH_NUO_POLYNOMIAL_HPP_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "./detail/nuo_poly_kernels.hpp"
+#include "./nuo_modint.hpp"
+
+namespace nuostl {
+
+/*
+ * Dense univariate polynomial, c[i] the coefficient of x^i, without high
+ * zero coefficients (the zero polynomial has none and degree -1).
+ *
+ * T is an integer type, a floating point type or nuo_modint<M>. Products
+ * switch from schoolbook to an O(n log n) transform above a threshold:
+ * multi-prime NTT + CRT for integers and nuo_modint, exact (integers
+ * wrapping modulo 2^bits like unsigned arithmetic); the double FFT for
+ * floating point.
+ *
+ * Over a field, division uses a Newton power series inverse for large
+ * operands. Integer polynomials stay on long division, where intermediate
+ * values are no larger than the result (the inverse series of an integer
+ * polynomial grows exponentially), and can only be divided by a divisor
+ * with leading coefficient 1 or -1; anything else throws
+ * std::domain_error, as does dividing by zero. Multipoint evaluation and
+ * interpolation use a subproduct tree; interpolation needs a field
+ * (floating point or nuo_modint with prime M) and distinct points, and is
+ * only numerically sound for nuo_modint.
+ */
+template<detail::nuo_poly_coefficient T>
+class nuo_polynomial {
+public:
+    using value_type = T;
+    using size_type = size_t;
+
+private:
+    using vec = std::vector<T>;
+
+    vec c_;
+
+    static void trim(vec& v) {
+        while (!v.empty() && v.back() == T(0))
+            v.pop_back();
+    }
+
+    static vec mul(const vec& a, const vec& b) {
+        if (a.empty() || b.empty())
+            return {};
+        vec r(a.size() + b.size() - 1);
+        detail::nuo_poly_mul(a.data(), a.size(), b.data(), b.size(), r.data());
+        return r;
+    }
+
+    /* a b mod x^k */
+    static vec mul_trunc(const vec& a, const vec& b, size_t k) {
+        if (a.empty() || b.empty())
+            return {};
+        size_t na = std::min(a.size(), k), nb = std::min(b.size(), k);
+        vec r(na + nb - 1);
+        detail::nuo_poly_mul(a.data(), na, b.data(), nb, r.data());
+        if (r.size() > k)
+            r.resize(k);
+        return r;
+    }
+
+    static T unit_inverse(const T& x) {
+        if constexpr (detail::nuo_poly_field<T>) {
+            return T(1) / x;
+        } else {
+            if (x != T(1) && x != T(-1))
+                throw std::domain_error(
+                    "nuo_polynomial: integer division needs a unit leading coefficient");
+            return x;
+        }
+    }
+
+    /* f^-1 mod x^k by Newton iteration, g <- g (2 - f g) */
+    static vec series_inverse(const vec& f, size_t k) {
+        vec g{unit_inverse(f[0])};
+        for (size_t len = 1; len < k; ) {
+            len = std::min(2 * len, k);
+            vec e = mul_trunc(f, g, len);
+            e.resize(len, T(0));
+            for (T& x : e)
+                x = detail::nuo_poly_neg(x);
+            e[0] = detail::nuo_poly_add(e[0], T(2));
+            g = mul_trunc(g, e, len);
+        }
+        g.resize(k, T(0));
+        return g;
+    }
+
+    static void divmod_vec(const vec& a, const vec& b, vec& q, vec& r) {
+        if (b.empty())
+            throw std::domain_error("nuo_polynomial: division by zero");
+        const T inv_lead = unit_inverse(b.back());
+        if (a.size() < b.size()) {
+            q.clear();
+            r = a;
+            return;
+        }
+        const size_t nb = b.size();
+        const size_t qn = a.size() - nb + 1;
+        if (!detail::nuo_poly_field<T> ||
+            nb < detail::nuo_poly_newton_threshold ||
+            qn < detail::nuo_poly_newton_threshold) {
+            vec rem(nb - 1);
+            vec quo(qn);
+            detail::nuo_poly_div_schoolbook(a.data(), a.size(), b.data(), nb,
+                                            inv_lead, quo.data(), rem.data());
+            trim(rem);
+            trim(quo);
+            q = std::move(quo);
+            r = std::move(rem);
+            return;
+        }
+        /* rev(q) = rev(a) rev(b)^-1 mod x^qn */
+        vec rb(b.rbegin(), b.rend());
+        vec ra(a.rbegin(), a.rbegin() + static_cast<ptrdiff_t>(qn));
+        vec rq = mul_trunc(ra, series_inverse(rb, qn), qn);
+        rq.resize(qn, T(0));
+        vec quo(rq.rbegin(), rq.rend());
+        /* r = a - b q, only the low nb - 1 coefficients survive */
+        vec bq = mul_trunc(b, quo, nb - 1);
+        vec rem(a.begin(), a.begin() + static_cast<ptrdiff_t>(nb - 1));
+        for (size_t i = 0; i < bq.size(); i++)
+            rem[i] = detail::nuo_poly_sub(rem[i], bq[i]);
+        trim(rem);
+        trim(quo);
+        q = std::move(quo);
+        r = std::move(rem);
+    }
+
+    static T horner(const vec& c, const T& x) {
+        T r = T(0);
+        for (size_t i = c.size(); i-- > 0; )
+            r = detail::nuo_poly_add(detail::nuo_poly_mulc(r, x), c[i]);
+        return r;
+    }
+
+    /*
+     * Subproduct tree over points: node 1 is prod (x - x_i), node k has
+     * children 2k and 2k + 1 over the two halves of its range, leaves
+     * cover at most leaf points.
+     */
+    struct subproduct_tree {
+        static constexpr size_t leaf = 32;
+
+        const std::vector<T>& xs;
+        std::vector<vec> node;
+
+        explicit subproduct_tree(const std::vector<T>& points)
+            : xs(points), node(4 * (points.size() / leaf + 1)) {
+            build(1, 0, xs.size());
+        }
+
+        void build(size_t k, size_t lo, size_t hi) {
+            if (hi - lo <= leaf) {
+                vec p{T(1)};
+                for (size_t i = lo; i < hi; i++) {
+                    /* p *= (x - x_i) */
+                    p.push_back(T(0));
+                    for (size_t j = p.size() - 1; j > 0; j--)
+                        p[j] = detail::nuo_poly_sub(p[j - 1],
+                                                    detail::nuo_poly_mulc(xs[i], p[j]));
+                    p[0] = detail::nuo_poly_neg(detail::nuo_poly_mulc(xs[i], p[0]));
+                }
+                node[k] = std::move(p);
+                return;
+            }
+            size_t mid = lo + (hi - lo) / 2;
+            build(2 * k, lo, mid);
+            build(2 * k + 1, mid, hi);
+            node[k] = mul(node[2 * k], node[2 * k + 1]);
+        }
+
+        void evaluate(size_t k, size_t lo, size_t hi, const vec& f,
+                      std::vector<T>& out) const {
+            vec q, r;
+            if (f.size() >= node[k].size())
+                divmod_vec(f, node[k], q, r);
+            else
+                r = f;
+            if (hi - lo <= leaf) {
+                for (size_t i = lo; i < hi; i++)
+                    out[i] = horner(r, xs[i]);
+                return;
+            }
+            size_t mid = lo + (hi - lo) / 2;
+            evaluate(2 * k, lo, mid, r, out);
+            evaluate(2 * k + 1, mid, hi, r, out);
+        }
+
+        /* sum of w_i prod_{j != i} (x - x_j) over the range */
+        vec combine(size_t k, size_t lo, size_t hi,
+                    const std::vector<T>& w) const {
+            if (hi - lo <= leaf) {
+                const vec& m = node[k];
+                vec acc(m.size() - 1, T(0));
+                vec t(m.size() - 1);
+                for (size_t i = lo; i < hi; i++) {
+                    /* t = m / (x - x_i) by synthetic division */
+                    T carry = T(0);
+                    for (size_t j = m.size() - 1; j-- > 0; ) {
+                        carry = detail::nuo_poly_add(m[j + 1],
+                                                     detail::nuo_poly_mulc(carry, xs[i]));
+                        t[j] = carry;
+                    }
+                    for (size_t j = 0; j < t.size(); j++)
+                        acc[j] = detail::nuo_poly_add(acc[j],
+                                                      detail::nuo_poly_mulc(w[i], t[j]));
+                }
+                return acc;
+            }
+            size_t mid = lo + (hi - lo) / 2;
+            vec l = mul(combine(2 * k, lo, mid, w), node[2 * k + 1]);
+            vec r = mul(combine(2 * k + 1, mid, hi, w), node[2 * k]);
+            if (l.size() < r.size())
+                std::swap(l, r);
+            for (size_t i = 0; i < r.size(); i++)
+                l[i] = detail::nuo_poly_add(l[i], r[i]);
+            return l;
+        }
+    };
+
+public:
+    /* Constructor */
+    nuo_polynomial() = default;
+
+    nuo_polynomial(std::initializer_list<T> coefs) : c_(coefs) { trim(c_); }
+
+    explicit nuo_polynomial(std::vector<T> coefs) : c_(std::move(coefs)) {
+        trim(c_);
+    }
+
+    /* Observers */
+    ptrdiff_t degree() const noexcept {
+        return static_cast<ptrdiff_t>(c_.size()) - 1;
+    }
+    size_type size() const noexcept { return c_.size(); }
+    bool is_zero() const noexcept { return c_.empty(); }
+    const std::vector<T>& coefficients() const noexcept { return c_; }
+
+    /* coefficient of x^i, zero past the degree */
+    T operator[](size_type i) const { return i < c_.size() ? c_[i] : T(0); }
+    T leading() const { return c_.empty() ? T(0) : c_.back(); }
+
+    /* Evaluation */
+    T operator()(const T& x) const { return horner(c_, x); }
+
+    /* Values at all points, through the subproduct tree for large inputs */
+    std::vector<T> evaluate(const std::vector<T>& xs) const {
+        std::vector<T> out(xs.size());
+        if (xs.size() < detail::nuo_poly_tree_threshold ||
+            c_.size() < detail::nuo_poly_tree_threshold) {
+            for (size_t i = 0; i < xs.size(); i++)
+                out[i] = horner(c_, xs[i]);
+            return out;
+        }
+        subproduct_tree tree(xs);
+        tree.evaluate(1, 0, xs.size(), c_, out);
+        return out;
+    }
+
+    /* The polynomial of degree < n through (xs[i], ys[i]), distinct xs */
+    static nuo_polynomial interpolate(const std::vector<T>& xs,
+                                      const std::vector<T>& ys)
+        requires detail::nuo_poly_field<T>
+    {
+        if (xs.size() != ys.size())
+            throw std::invalid_argument("nuo_polynomial: point count mismatch");
+        if (xs.empty())
+            return {};
+        subproduct_tree tree(xs);
+        /* w_i = y_i / M'(x_i), M the product of all (x - x_i) */
+        nuo_polynomial dm = nuo_polynomial(tree.node[1]).derivative();
+        std::vector<T> d(xs.size());
+        if (xs.size() < detail::nuo_poly_tree_threshold) {
+            for (size_t i = 0; i < xs.size(); i++)
+                d[i] = horner(dm.c_, xs[i]);
+        } else {
+            tree.evaluate(1, 0, xs.size(), dm.c_, d);
+        }
+        for (size_t i = 0; i < xs.size(); i++)
+            d[i] = ys[i] / d[i];
+        return nuo_polynomial(tree.combine(1, 0, xs.size(), d));
+    }
+
+    nuo_polynomial derivative() const {
+        if (c_.size() <= 1)
+            return {};
+        vec d(c_.size() - 1);
+        for (size_t i = 1; i < c_.size(); i++)
+            d[i - 1] = detail::nuo_poly_mulc(c_[i], T(static_cast<long long>(i)));
+        return nuo_polynomial(std::move(d));
+    }
+
+    /* The power series inverse mod x^n, the constant term must be a unit */
+    nuo_polynomial inverse(size_type n) const {
+        if (c_.empty() || c_[0] == T(0))
+            throw std::domain_error("nuo_polynomial: constant term not invertible");
+        if (n == 0)
+            return {};
+        return nuo_polynomial(series_inverse(c_, n));
+    }
+
+    /* Arithmetic */
+    nuo_polynomial operator-() const {
+        nuo_polynomial r(*this);
+        for (T& x : r.c_)
+            x = detail::nuo_poly_neg(x);
+        return r;
+    }
+
+    nuo_polynomial& operator+=(const nuo_polynomial& b) {
+        if (c_.size() < b.c_.size())
+            c_.resize(b.c_.size(), T(0));
+        for (size_t i = 0; i < b.c_.size(); i++)
+            c_[i] = detail::nuo_poly_add(c_[i], b.c_[i]);
+        trim(c_);
+        return *this;
+    }
+    nuo_polynomial& operator-=(const nuo_polynomial& b) {
+        if (c_.size() < b.c_.size())
+            c_.resize(b.c_.size(), T(0));
+        for (size_t i = 0; i < b.c_.size(); i++)
+            c_[i] = detail::nuo_poly_sub(c_[i], b.c_[i]);
+        trim(c_);
+        return *this;
+    }
+    nuo_polynomial& operator*=(const nuo_polynomial& b) {
+        c_ = mul(c_, b.c_);
+        trim(c_);
+        return *this;
+    }
+    nuo_polynomial& operator*=(const T& s) {
+        for (T& x : c_)
+            x = detail::nuo_poly_mulc(x, s);
+        trim(c_);
+        return *this;
+    }
+    nuo_polynomial& operator/=(const nuo_polynomial& b) {
+        vec q, r;
+        divmod_vec(c_, b.c_, q, r);
+        c_ = std::move(q);
+        return *this;
+    }
+    nuo_polynomial& operator%=(const nuo_polynomial& b) {
+        vec q, r;
+        divmod_vec(c_, b.c_, q, r);
+        c_ = std::move(r);
+        return *this;
+    }
+
+    friend nuo_polynomial operator+(nuo_polynomial a, const nuo_polynomial& b) {
+        return a += b;
+    }
+    friend nuo_polynomial operator-(nuo_polynomial a, const nuo_polynomial& b) {
+        return a -= b;
+    }
+    friend nuo_polynomial operator*(const nuo_polynomial& a,
+                                    const nuo_polynomial& b) {
+        nuo_polynomial r;
+        r.c_ = mul(a.c_, b.c_);
+        trim(r.c_);
+        return r;
+    }
+    friend nuo_polynomial operator*(nuo_polynomial a, const T& s) {
+        return a *= s;
+    }
+    friend nuo_polynomial operator*(const T& s, nuo_polynomial a) {
+        return a *= s;
+    }
+    friend nuo_polynomial operator/(const nuo_polynomial& a,
+                                    const nuo_polynomial& b) {
+        nuo_polynomial q, r;
+        divmod_vec(a.c_, b.c_, q.c_, r.c_);
+        return q;
+    }
+    friend nuo_polynomial operator%(const nuo_polynomial& a,
+                                    const nuo_polynomial& b) {
+        nuo_polynomial q, r;
+        divmod_vec(a.c_, b.c_, q.c_, r.c_);
+        return r;
+    }
+
+    /* a = q b + r with deg r < deg b */
+    friend void divmod(const nuo_polynomial& a, const nuo_polynomial& b,
+                       nuo_polynomial& q, nuo_polynomial& r) {
+        vec qv, rv;
+        divmod_vec(a.c_, b.c_, qv, rv);
+        q.c_ = std::move(qv);
+        r.c_ = std::move(rv);
+    }
+
+    friend bool operator==(const nuo_polynomial& a, const nuo_polynomial& b) {
+        return a.c_ == b.c_;
+    }
+
+    /* {c0, c1, ...}, lowest degree first */
+    friend std::ostream& operator<<(std::ostream& os, const nuo_polynomial& p) {
+        os << '{';
+        for (size_t i = 0; i < p.c_.size(); i++)
+            os << (i ? ", " : "") << p.c_[i];
+        return os << '}';
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
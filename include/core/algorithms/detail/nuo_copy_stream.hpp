@@ -0,0 +1,183 @@
+#ifndef NUOSTL_CORE_ALGORITHMS_DETAIL_NUO_COPY_STREAM_HPP_
+#define NUOSTL_CORE_ALGORITHMS_DETAIL_NUO_COPY_STREAM_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <atomic>
+
+#include "../../dispatch/nuo_cpu_dispatch.hpp"
+
+#if defined(NUOSTL_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+/*
+ * Byte copy behind nuo_copy and friends. Copies below the streaming
+ * threshold (the last level cache size by default) go to memmove. Larger
+ * ones, when source and destination do not overlap, use non-temporal
+ * stores: the destination would not fit in the cache anyway, and
+ * streaming it skips the read-for-ownership of every destination line and
+ * leaves the cache to the data that still fits.
+ */
+
+namespace nuostl {
+namespace detail {
+
+inline size_t nuo_llc_bytes() noexcept {
+    static const size_t bytes = [] {
+        long v = -1;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+        v = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (v <= 0)
+            v = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+        return v > 0 ? static_cast<size_t>(v) : size_t(8) << 20;
+    }();
+    return bytes;
+}
+
+/* NUOSTL_STREAM_THRESHOLD (bytes) overrides the cache size */
+inline std::atomic<size_t>& nuo_stream_threshold_slot() noexcept {
+    static std::atomic<size_t> slot{[] {
+        const char* env = getenv("NUOSTL_STREAM_THRESHOLD");
+        if (env != nullptr) {
+            long long v = atoll(env);
+            if (v > 0)
+                return static_cast<size_t>(v);
+        }
+        return nuo_llc_bytes();
+    }()};
+    return slot;
+}
+
+inline void nuo_stream_copy_scalar(void* dst, const void* src, size_t n) noexcept {
+    memcpy(dst, src, n);
+}
+
+#if defined(NUOSTL_ARCH_X86)
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+
+/*
+ * The kernels copy the head up to a 64 byte aligned destination, stream
+ * whole lines, fence, and copy the tail. n is at least a few lines.
+ */
+NUOSTL_TARGET_SSE42 inline void nuo_stream_copy_sse42(void* dst, const void* src,
+                                                      size_t n) noexcept {
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+    size_t head = (64 - (reinterpret_cast<uintptr_t>(d) & 63)) & 63;
+    memcpy(d, s, head);
+    d += head;
+    s += head;
+    n -= head;
+    for (; n >= 64; n -= 64, d += 64, s += 64) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 32));
+        __m128i e = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d + 48), e);
+    }
+    _mm_sfence();
+    memcpy(d, s, n);
+}
+
+NUOSTL_TARGET_AVX2 inline void nuo_stream_copy_avx2(void* dst, const void* src,
+                                                    size_t n) noexcept {
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+    size_t head = (64 - (reinterpret_cast<uintptr_t>(d) & 63)) & 63;
+    memcpy(d, s, head);
+    d += head;
+    s += head;
+    n -= head;
+    for (; n >= 128; n -= 128, d += 128, s += 128) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + 32));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + 64));
+        __m256i e = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + 96));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d), a);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + 32), b);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + 64), c);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + 96), e);
+    }
+    _mm_sfence();
+    memcpy(d, s, n);
+}
+
+NUOSTL_TARGET_AVX512 inline void nuo_stream_copy_avx512(void* dst, const void* src,
+                                                        size_t n) noexcept {
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+    size_t head = (64 - (reinterpret_cast<uintptr_t>(d) & 63)) & 63;
+    memcpy(d, s, head);
+    d += head;
+    s += head;
+    n -= head;
+    for (; n >= 128; n -= 128, d += 128, s += 128) {
+        __m512i a = _mm512_loadu_si512(s);
+        __m512i b = _mm512_loadu_si512(s + 64);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d), a);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d + 64), b);
+    }
+    _mm_sfence();
+    memcpy(d, s, n);
+}
+
+#pragma GCC diagnostic pop
+
+inline constexpr nuo_dispatcher<void(void*, const void*, size_t)> nuo_stream_copy_dispatch =
+    nuo_dispatcher<void(void*, const void*, size_t)>(&nuo_stream_copy_scalar)
+        .add(nuo_isa::sse42, &nuo_stream_copy_sse42)
+        .add(nuo_isa::avx2, &nuo_stream_copy_avx2)
+        .add(nuo_isa::avx512, &nuo_stream_copy_avx512);
+
+#endif  /* NUOSTL_ARCH_X86 */
+
+/* Decides once whether n bytes from src to dst stream */
+inline bool nuo_copy_streams(const void* dst, const void* src, size_t n) noexcept {
+#if defined(NUOSTL_ARCH_X86)
+    if (n >= 256 && n >= nuo_stream_threshold_slot().load(std::memory_order_relaxed)) {
+        uintptr_t d = reinterpret_cast<uintptr_t>(dst);
+        uintptr_t s = reinterpret_cast<uintptr_t>(src);
+        return d + n <= s || s + n <= d;
+    }
+#endif
+    (void)dst;
+    (void)src;
+    (void)n;
+    return false;
+}
+
+/* One chunk of a parallel copy, streaming as decided for the whole copy */
+inline void nuo_copy_bytes_chunk(void* dst, const void* src, size_t n, bool stream) noexcept {
+#if defined(NUOSTL_ARCH_X86)
+    if (stream && n >= 256) {
+        nuo_stream_copy_dispatch(dst, src, n);
+        return;
+    }
+#endif
+    (void)stream;
+    memcpy(dst, src, n);
+}
+
+/* memmove, streaming above the threshold when the ranges are disjoint */
+inline void nuo_copy_bytes(void* dst, const void* src, size_t n) noexcept {
+    if (nuo_copy_streams(dst, src, n))
+        nuo_copy_bytes_chunk(dst, src, n, true);
+    else
+        memmove(dst, src, n);
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
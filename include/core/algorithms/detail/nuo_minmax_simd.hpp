@@ -0,0 +1,245 @@
+#ifndef NUOSTL_CORE_ALGORITHMS_DETAIL_NUO_MINMAX_SIMD_HPP_
+#define NUOSTL_CORE_ALGORITHMS_DETAIL_NUO_MINMAX_SIMD_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "../../dispatch/nuo_cpu_dispatch.hpp"
+
+#if defined(NUOSTL_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+/*
+ * Vectorized reduction kernels behind nuo_min(Iter, Iter) and
+ * nuo_max(Iter, Iter) for contiguous ranges of integers. Floating point
+ * stays on the scalar path, SIMD min/max do not order NaN like operator<.
+ */
+
+namespace nuostl {
+namespace detail {
+
+template<typename T>
+inline constexpr bool nuo_minmax_simd_eligible =
+#if defined(NUOSTL_ARCH_X86)
+    std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+#else
+    false;
+#endif
+
+template<bool Max, typename T>
+constexpr T nuo_minmax_pick(T best, T x) noexcept {
+    if constexpr (Max)
+        return (best < x) ? x : best;
+    else
+        return (x < best) ? x : best;
+}
+
+template<bool Max, typename T>
+T nuo_minmax_scalar(const T* p, size_t n) noexcept {
+    T best = p[0];
+    for (size_t i = 1; i < n; i++)
+        best = nuo_minmax_pick<Max>(best, p[i]);
+    return best;
+}
+
+#if defined(NUOSTL_ARCH_X86)
+
+/* SSE4.2 */
+template<bool Max, typename T>
+NUOSTL_TARGET_SSE42 inline __m128i nuo_minmax_op_sse42(__m128i a, __m128i b) {
+    constexpr bool S = std::is_signed_v<T>;
+    if constexpr (sizeof(T) == 1) {
+        if constexpr (S) return Max ? _mm_max_epi8(a, b) : _mm_min_epi8(a, b);
+        else return Max ? _mm_max_epu8(a, b) : _mm_min_epu8(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+        if constexpr (S) return Max ? _mm_max_epi16(a, b) : _mm_min_epi16(a, b);
+        else return Max ? _mm_max_epu16(a, b) : _mm_min_epu16(a, b);
+    } else if constexpr (sizeof(T) == 4) {
+        if constexpr (S) return Max ? _mm_max_epi32(a, b) : _mm_min_epi32(a, b);
+        else return Max ? _mm_max_epu32(a, b) : _mm_min_epu32(a, b);
+    } else {
+        __m128i x = a, y = b;
+        if constexpr (!S) {
+            const __m128i bias = _mm_set1_epi64x(INT64_MIN);
+            x = _mm_xor_si128(x, bias);
+            y = _mm_xor_si128(y, bias);
+        }
+        __m128i gt = _mm_cmpgt_epi64(x, y);
+        return Max ? _mm_blendv_epi8(b, a, gt) : _mm_blendv_epi8(a, b, gt);
+    }
+}
+
+template<bool Max, typename T>
+NUOSTL_TARGET_SSE42 T nuo_minmax_sse42(const T* p, size_t n) noexcept {
+    constexpr size_t lanes = 16 / sizeof(T);
+    if (n < 2 * lanes)
+        return nuo_minmax_scalar<Max>(p, n);
+
+    auto load = [p](size_t i) NUOSTL_TARGET_SSE42 {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    };
+    __m128i a0 = load(0), a1 = load(lanes);
+    size_t i = 2 * lanes;
+    for (; i + 2 * lanes <= n; i += 2 * lanes) {
+        a0 = nuo_minmax_op_sse42<Max, T>(a0, load(i));
+        a1 = nuo_minmax_op_sse42<Max, T>(a1, load(i + lanes));
+    }
+    a0 = nuo_minmax_op_sse42<Max, T>(a0, a1);
+
+    T buf[lanes];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(buf), a0);
+    T best = nuo_minmax_scalar<Max>(buf, lanes);
+    for (; i < n; i++)
+        best = nuo_minmax_pick<Max>(best, p[i]);
+    return best;
+}
+
+/* AVX2 */
+template<bool Max, typename T>
+NUOSTL_TARGET_AVX2 inline __m256i nuo_minmax_op_avx2(__m256i a, __m256i b) {
+    constexpr bool S = std::is_signed_v<T>;
+    if constexpr (sizeof(T) == 1) {
+        if constexpr (S)
+            return Max ? _mm256_max_epi8(a, b) : _mm256_min_epi8(a, b);
+        else
+            return Max ? _mm256_max_epu8(a, b) : _mm256_min_epu8(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+        if constexpr (S)
+            return Max ? _mm256_max_epi16(a, b) : _mm256_min_epi16(a, b);
+        else
+            return Max ? _mm256_max_epu16(a, b) : _mm256_min_epu16(a, b);
+    } else if constexpr (sizeof(T) == 4) {
+        if constexpr (S)
+            return Max ? _mm256_max_epi32(a, b) : _mm256_min_epi32(a, b);
+        else
+            return Max ? _mm256_max_epu32(a, b) : _mm256_min_epu32(a, b);
+    } else {
+        __m256i x = a, y = b;
+        if constexpr (!S) {
+            const __m256i bias = _mm256_set1_epi64x(INT64_MIN);
+            x = _mm256_xor_si256(x, bias);
+            y = _mm256_xor_si256(y, bias);
+        }
+        __m256i gt = _mm256_cmpgt_epi64(x, y);
+        return Max ? _mm256_blendv_epi8(b, a, gt)
+                   : _mm256_blendv_epi8(a, b, gt);
+    }
+}
+
+template<bool Max, typename T>
+NUOSTL_TARGET_AVX2 T nuo_minmax_avx2(const T* p, size_t n) noexcept {
+    constexpr size_t lanes = 32 / sizeof(T);
+    if (n < 4 * lanes)
+        return nuo_minmax_sse42<Max>(p, n);
+
+    auto load = [p](size_t i) NUOSTL_TARGET_AVX2 {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    };
+    __m256i a0 = load(0), a1 = load(lanes);
+    __m256i a2 = load(2 * lanes), a3 = load(3 * lanes);
+    size_t i = 4 * lanes;
+    for (; i + 4 * lanes <= n; i += 4 * lanes) {
+        a0 = nuo_minmax_op_avx2<Max, T>(a0, load(i));
+        a1 = nuo_minmax_op_avx2<Max, T>(a1, load(i + lanes));
+        a2 = nuo_minmax_op_avx2<Max, T>(a2, load(i + 2 * lanes));
+        a3 = nuo_minmax_op_avx2<Max, T>(a3, load(i + 3 * lanes));
+    }
+    a0 = nuo_minmax_op_avx2<Max, T>(a0, a1);
+    a2 = nuo_minmax_op_avx2<Max, T>(a2, a3);
+    a0 = nuo_minmax_op_avx2<Max, T>(a0, a2);
+
+    T buf[lanes];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(buf), a0);
+    T best = nuo_minmax_scalar<Max>(buf, lanes);
+    for (; i < n; i++)
+        best = nuo_minmax_pick<Max>(best, p[i]);
+    return best;
+}
+
+/* AVX-512 */
+/* gcc 12 warns on the _mm512_undefined_* placeholders inside intrinsics */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+template<bool Max, typename T>
+NUOSTL_TARGET_AVX512 inline __m512i nuo_minmax_op_avx512(__m512i a,
+                                                         __m512i b) {
+    constexpr bool S = std::is_signed_v<T>;
+    if constexpr (sizeof(T) == 1) {
+        if constexpr (S)
+            return Max ? _mm512_max_epi8(a, b) : _mm512_min_epi8(a, b);
+        else
+            return Max ? _mm512_max_epu8(a, b) : _mm512_min_epu8(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+        if constexpr (S)
+            return Max ? _mm512_max_epi16(a, b) : _mm512_min_epi16(a, b);
+        else
+            return Max ? _mm512_max_epu16(a, b) : _mm512_min_epu16(a, b);
+    } else if constexpr (sizeof(T) == 4) {
+        if constexpr (S)
+            return Max ? _mm512_max_epi32(a, b) : _mm512_min_epi32(a, b);
+        else
+            return Max ? _mm512_max_epu32(a, b) : _mm512_min_epu32(a, b);
+    } else {
+        if constexpr (S)
+            return Max ? _mm512_max_epi64(a, b) : _mm512_min_epi64(a, b);
+        else
+            return Max ? _mm512_max_epu64(a, b) : _mm512_min_epu64(a, b);
+    }
+}
+
+template<bool Max, typename T>
+NUOSTL_TARGET_AVX512 T nuo_minmax_avx512(const T* p, size_t n) noexcept {
+    constexpr size_t lanes = 64 / sizeof(T);
+    if (n < 4 * lanes)
+        return nuo_minmax_avx2<Max>(p, n);
+
+    auto load = [p](size_t i) NUOSTL_TARGET_AVX512 {
+        return _mm512_loadu_si512(p + i);
+    };
+    __m512i a0 = load(0), a1 = load(lanes);
+    __m512i a2 = load(2 * lanes), a3 = load(3 * lanes);
+    size_t i = 4 * lanes;
+    for (; i + 4 * lanes <= n; i += 4 * lanes) {
+        a0 = nuo_minmax_op_avx512<Max, T>(a0, load(i));
+        a1 = nuo_minmax_op_avx512<Max, T>(a1, load(i + lanes));
+        a2 = nuo_minmax_op_avx512<Max, T>(a2, load(i + 2 * lanes));
+        a3 = nuo_minmax_op_avx512<Max, T>(a3, load(i + 3 * lanes));
+    }
+    a0 = nuo_minmax_op_avx512<Max, T>(a0, a1);
+    a2 = nuo_minmax_op_avx512<Max, T>(a2, a3);
+    a0 = nuo_minmax_op_avx512<Max, T>(a0, a2);
+
+    T buf[lanes];
+    _mm512_storeu_si512(buf, a0);
+    T best = nuo_minmax_scalar<Max>(buf, lanes);
+    for (; i < n; i++)
+        best = nuo_minmax_pick<Max>(best, p[i]);
+    return best;
+}
+
+#pragma GCC diagnostic pop
+
+template<bool Max, typename T>
+inline constexpr nuo_dispatcher<T(const T*, size_t)> nuo_minmax_dispatch =
+    nuo_dispatcher<T(const T*, size_t)>(&nuo_minmax_scalar<Max, T>)
+        .add(nuo_isa::sse42, &nuo_minmax_sse42<Max, T>)
+        .add(nuo_isa::avx2, &nuo_minmax_avx2<Max, T>)
+        .add(nuo_isa::avx512, &nuo_minmax_avx512<Max, T>);
+
+/* Reduce p[0, n), n > 0, with the best kernel for the active ISA level. */
+template<bool Max, typename T>
+T nuo_minmax_simd(const T* p, size_t n) noexcept {
+    return nuo_minmax_dispatch<Max, T>(p, n);
+}
+
+#endif  /* NUOSTL_ARCH_X86 */
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef NUOSTL_CORE_ALGORITHMS_DETAIL_NUO_RING_HPP_
+#define NUOSTL_CORE_ALGORITHMS_DETAIL_NUO_RING_HPP_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+/*
+ * Growable ring buffer with a power-of-two capacity, the storage of the
+ * incremental window reducers: push at the back, pop at either end, in
+ * amortized O(1) and without the per-block allocations of std::deque.
+ * Popped slots keep their (moved-from) objects until overwritten.
+ */
+
+namespace nuostl {
+namespace detail {
+
+template<typename T>
+class nuo_ring {
+private:
+    std::vector<T> buf_;
+    size_t mask_ = size_t(-1);
+    size_t head_ = 0;
+    size_t size_ = 0;
+
+    void grow() {
+        std::vector<T> b(buf_.empty() ? 16 : buf_.size() * 2);
+        for (size_t i = 0; i < size_; i++)
+            b[i] = std::move(buf_[(head_ + i) & mask_]);
+        buf_.swap(b);
+        mask_ = buf_.size() - 1;
+        head_ = 0;
+    }
+public:
+    /* Element access */
+    T& front() noexcept { return buf_[head_]; }
+    const T& front() const noexcept { return buf_[head_]; }
+    T& back() noexcept { return buf_[(head_ + size_ - 1) & mask_]; }
+    const T& back() const noexcept { return buf_[(head_ + size_ - 1) & mask_]; }
+
+    /* Capacity */
+    bool empty() const noexcept { return size_ == 0; }
+    size_t size() const noexcept { return size_; }
+
+    void reserve(size_t n) {
+        while (mask_ + 1 < n)
+            grow();
+    }
+
+    /* Modifiers */
+    void push_back(T value) {
+        if (size_ == mask_ + 1)
+            grow();
+        buf_[(head_ + size_) & mask_] = std::move(value);
+        size_++;
+    }
+
+    void pop_front() noexcept {
+        head_ = (head_ + 1) & mask_;
+        size_--;
+    }
+
+    void pop_back() noexcept {
+        size_--;
+    }
+
+    void clear() noexcept {
+        head_ = 0;
+        size_ = 0;
+    }
+};
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
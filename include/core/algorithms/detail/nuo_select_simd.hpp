@@ -0,0 +1,190 @@
+#ifndef NUOSTL_CORE_ALGORITHMS_DETAIL_NUO_SELECT_SIMD_HPP_
+#define NUOSTL_CORE_ALGORITHMS_DETAIL_NUO_SELECT_SIMD_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "../../dispatch/nuo_cpu_dispatch.hpp"
+
+#if defined(NUOSTL_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+/*
+ * Threshold scan behind the heap selection of nuo_partial_sort and
+ * nuo_top_k: the index of the first element beyond t (greater when Gt,
+ * less otherwise). Once the heap holds k elements out of n, only about
+ * k * ln(n / k) of them get past its root, so the scan compares a vector
+ * of elements per instruction and leaves the loop only for those.
+ * Floating point compares are ordered: NaN is never beyond t and no
+ * element is beyond a NaN threshold, as with operator<.
+ */
+
+namespace nuostl {
+namespace detail {
+
+template<typename T>
+inline constexpr bool nuo_select_simd_eligible =
+#if defined(NUOSTL_ARCH_X86)
+    (std::is_integral_v<T> && !std::is_same_v<T, bool> && (sizeof(T) == 4 || sizeof(T) == 8)) ||
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+#else
+    false;
+#endif
+
+template<bool Gt, typename T>
+size_t nuo_find_beyond_scalar(const T* p, size_t n, T t) noexcept {
+    for (size_t i = 0; i < n; i++) {
+        if (Gt ? t < p[i] : p[i] < t)
+            return i;
+    }
+    return n;
+}
+
+#if defined(NUOSTL_ARCH_X86)
+
+/* AVX2, one bit per element in the movemask */
+template<bool Gt, typename T>
+NUOSTL_TARGET_AVX2 inline unsigned nuo_beyond_mask_avx2(const T* p, __m256i ti, __m256 tf,
+                                                        __m256d td) {
+    if constexpr (std::is_same_v<T, float>) {
+        __m256 x = _mm256_loadu_ps(p);
+        return static_cast<unsigned>(_mm256_movemask_ps(
+            Gt ? _mm256_cmp_ps(x, tf, _CMP_GT_OQ) : _mm256_cmp_ps(x, tf, _CMP_LT_OQ)));
+    } else if constexpr (std::is_same_v<T, double>) {
+        __m256d x = _mm256_loadu_pd(p);
+        return static_cast<unsigned>(_mm256_movemask_pd(
+            Gt ? _mm256_cmp_pd(x, td, _CMP_GT_OQ) : _mm256_cmp_pd(x, td, _CMP_LT_OQ)));
+    } else {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        if constexpr (sizeof(T) == 4) {
+            if constexpr (std::is_unsigned_v<T>)
+                x = _mm256_xor_si256(x, _mm256_set1_epi32(INT32_MIN));
+            __m256i m = Gt ? _mm256_cmpgt_epi32(x, ti) : _mm256_cmpgt_epi32(ti, x);
+            return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+        } else {
+            if constexpr (std::is_unsigned_v<T>)
+                x = _mm256_xor_si256(x, _mm256_set1_epi64x(INT64_MIN));
+            __m256i m = Gt ? _mm256_cmpgt_epi64(x, ti) : _mm256_cmpgt_epi64(ti, x);
+            return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(m)));
+        }
+    }
+}
+
+template<bool Gt, typename T>
+NUOSTL_TARGET_AVX2 size_t nuo_find_beyond_avx2(const T* p, size_t n, T t) noexcept {
+    constexpr size_t lanes = 32 / sizeof(T);
+    __m256i ti = _mm256_setzero_si256();
+    __m256 tf = _mm256_setzero_ps();
+    __m256d td = _mm256_setzero_pd();
+    if constexpr (std::is_same_v<T, float>) {
+        tf = _mm256_set1_ps(t);
+    } else if constexpr (std::is_same_v<T, double>) {
+        td = _mm256_set1_pd(t);
+    } else if constexpr (sizeof(T) == 4) {
+        uint32_t b = static_cast<uint32_t>(t);
+        if constexpr (std::is_unsigned_v<T>)
+            b ^= 0x80000000u;
+        ti = _mm256_set1_epi32(static_cast<int32_t>(b));
+    } else {
+        uint64_t b = static_cast<uint64_t>(t);
+        if constexpr (std::is_unsigned_v<T>)
+            b ^= 0x8000000000000000ull;
+        ti = _mm256_set1_epi64x(static_cast<int64_t>(b));
+    }
+    size_t i = 0;
+    for (; i + 4 * lanes <= n; i += 4 * lanes) {
+        unsigned m0 = nuo_beyond_mask_avx2<Gt>(p + i, ti, tf, td);
+        unsigned m1 = nuo_beyond_mask_avx2<Gt>(p + i + lanes, ti, tf, td);
+        unsigned m2 = nuo_beyond_mask_avx2<Gt>(p + i + 2 * lanes, ti, tf, td);
+        unsigned m3 = nuo_beyond_mask_avx2<Gt>(p + i + 3 * lanes, ti, tf, td);
+        if (m0 | m1 | m2 | m3) {
+            uint64_t m = uint64_t(m0) | uint64_t(m1) << lanes | uint64_t(m2) << 2 * lanes |
+                         uint64_t(m3) << 3 * lanes;
+            return i + static_cast<size_t>(__builtin_ctzll(m));
+        }
+    }
+    return i + nuo_find_beyond_scalar<Gt>(p + i, n - i, t);
+}
+
+/* AVX-512 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+template<bool Gt, typename T>
+NUOSTL_TARGET_AVX512 inline uint64_t nuo_beyond_mask_avx512(const T* p, T t) {
+    if constexpr (std::is_same_v<T, float>) {
+        __m512 x = _mm512_loadu_ps(p), y = _mm512_set1_ps(t);
+        return Gt ? _mm512_cmp_ps_mask(x, y, _CMP_GT_OQ) : _mm512_cmp_ps_mask(x, y, _CMP_LT_OQ);
+    } else if constexpr (std::is_same_v<T, double>) {
+        __m512d x = _mm512_loadu_pd(p), y = _mm512_set1_pd(t);
+        return Gt ? _mm512_cmp_pd_mask(x, y, _CMP_GT_OQ) : _mm512_cmp_pd_mask(x, y, _CMP_LT_OQ);
+    } else if constexpr (sizeof(T) == 4) {
+        __m512i x = _mm512_loadu_si512(p);
+        __m512i y = _mm512_set1_epi32(static_cast<int32_t>(t));
+        if constexpr (std::is_signed_v<T>)
+            return Gt ? _mm512_cmpgt_epi32_mask(x, y) : _mm512_cmplt_epi32_mask(x, y);
+        else
+            return Gt ? _mm512_cmpgt_epu32_mask(x, y) : _mm512_cmplt_epu32_mask(x, y);
+    } else {
+        __m512i x = _mm512_loadu_si512(p);
+        __m512i y = _mm512_set1_epi64(static_cast<int64_t>(t));
+        if constexpr (std::is_signed_v<T>)
+            return Gt ? _mm512_cmpgt_epi64_mask(x, y) : _mm512_cmplt_epi64_mask(x, y);
+        else
+            return Gt ? _mm512_cmpgt_epu64_mask(x, y) : _mm512_cmplt_epu64_mask(x, y);
+    }
+}
+
+template<bool Gt, typename T>
+NUOSTL_TARGET_AVX512 size_t nuo_find_beyond_avx512(const T* p, size_t n, T t) noexcept {
+    constexpr size_t lanes = 64 / sizeof(T);
+    size_t i = 0;
+    for (; i + 4 * lanes <= n; i += 4 * lanes) {
+        uint64_t m0 = nuo_beyond_mask_avx512<Gt>(p + i, t);
+        uint64_t m1 = nuo_beyond_mask_avx512<Gt>(p + i + lanes, t);
+        uint64_t m2 = nuo_beyond_mask_avx512<Gt>(p + i + 2 * lanes, t);
+        uint64_t m3 = nuo_beyond_mask_avx512<Gt>(p + i + 3 * lanes, t);
+        if (m0 | m1 | m2 | m3) {
+            size_t j = i;
+            for (uint64_t m : {m0, m1, m2, m3}) {
+                if (m)
+                    return j + static_cast<size_t>(__builtin_ctzll(m));
+                j += lanes;
+            }
+        }
+    }
+    for (; i + lanes <= n; i += lanes) {
+        uint64_t m = nuo_beyond_mask_avx512<Gt>(p + i, t);
+        if (m)
+            return i + static_cast<size_t>(__builtin_ctzll(m));
+    }
+    return i + nuo_find_beyond_scalar<Gt>(p + i, n - i, t);
+}
+
+#pragma GCC diagnostic pop
+
+template<bool Gt, typename T>
+inline constexpr nuo_dispatcher<size_t(const T*, size_t, T)> nuo_find_beyond_dispatch =
+    nuo_dispatcher<size_t(const T*, size_t, T)>(&nuo_find_beyond_scalar<Gt, T>)
+        .add(nuo_isa::avx2, &nuo_find_beyond_avx2<Gt, T>)
+        .add(nuo_isa::avx512, &nuo_find_beyond_avx512<Gt, T>);
+
+#endif  /* NUOSTL_ARCH_X86 */
+
+/* Index of the first of p[0, n) beyond t, n when there is none */
+template<bool Gt, typename T>
+size_t nuo_find_beyond(const T* p, size_t n, T t) noexcept {
+#if defined(NUOSTL_ARCH_X86)
+    if constexpr (nuo_select_simd_eligible<T>)
+        return nuo_find_beyond_dispatch<Gt, T>(p, n, t);
+#endif
+    return nuo_find_beyond_scalar<Gt>(p, n, t);
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
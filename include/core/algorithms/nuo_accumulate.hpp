@@ -0,0 +1,135 @@
+#ifndef NUOSTL_CORE_ALGORITHMS_NUO_ACCUMULATE_HPP_
+#define NUOSTL_CORE_ALGORITHMS_NUO_ACCUMULATE_HPP_
+
+#include <stddef.h>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "../execution/nuo_execution.hpp"
+#include "../function_objects/nuo_functional.hpp"
+#include "../iterators/nuo_iterator_traits.hpp"
+
+/*
+ * nuo_accumulate, similar to std::accumulate: init = op(std::move(init),
+ * *it) from left to right. When op is a known associative operation on
+ * integral init and elements (nuo_plus, nuo_multiplies, the bitwise ones,
+ * see nuo_functional.hpp), the order is free and the loop runs in four
+ * independent lanes of unsigned arithmetic, which keeps the multiplier
+ * or adder pipelined and vectorizes; unsigned lanes wrap, so the result
+ * is the one the serial loop gives whenever that loop has no overflow.
+ * The nuo_par overload splits such reductions over the scheduler; any
+ * other op is applied in order, serially.
+ */
+
+namespace nuostl {
+
+namespace detail {
+
+/*
+ * Lanes convert each element to T. The logical ops test the truth of
+ * what they are given, which for a transparent op is the element itself
+ * (1 << 32 is true, as an int it is 0), so they only take the lanes when
+ * the elements already are T.
+ */
+template<typename Op, typename T, typename It>
+inline constexpr bool nuo_accumulate_reassociates =
+    nuo_is_associative_v<Op, T> && std::is_integral_v<nuo_iter_value_t<It>> &&
+    !std::is_same_v<T, bool> &&
+    ((nuo_op_kind_v<Op> != nuo_op_kind::logical_and &&
+      nuo_op_kind_v<Op> != nuo_op_kind::logical_or) ||
+     std::is_same_v<nuo_iter_value_t<It>, T>);
+
+/* a op b for a known associative op, in wrapping unsigned arithmetic */
+template<nuo_op_kind K, typename U>
+constexpr U nuo_apply_unsigned(U a, U b) noexcept {
+    /* no promotion of narrow operands to (signed) int */
+    using W = std::conditional_t<(sizeof(U) < sizeof(unsigned)), unsigned, U>;
+    if constexpr (K == nuo_op_kind::plus)
+        return static_cast<U>(W(a) + W(b));
+    else if constexpr (K == nuo_op_kind::multiplies)
+        return static_cast<U>(W(a) * W(b));
+    else if constexpr (K == nuo_op_kind::bit_and)
+        return static_cast<U>(a & b);
+    else if constexpr (K == nuo_op_kind::bit_or)
+        return static_cast<U>(a | b);
+    else if constexpr (K == nuo_op_kind::bit_xor)
+        return static_cast<U>(a ^ b);
+    else if constexpr (K == nuo_op_kind::logical_and)
+        return static_cast<U>(a && b);
+    else
+        return static_cast<U>(a || b);
+}
+
+/* The reduction of [first, last) without init, as unsigned T */
+template<typename Op, typename T, std::random_access_iterator It>
+std::make_unsigned_t<T> nuo_accumulate_lanes(It first, It last) {
+    using U = std::make_unsigned_t<T>;
+    constexpr nuo_op_kind K = nuo_op_kind_v<Op>;
+    const U id = static_cast<U>(nuo_op_identity<Op, T>());
+    U a0 = id, a1 = id, a2 = id, a3 = id;
+    auto n = last - first;
+    decltype(n) i = 0;
+    for (; i + 4 <= n; i += 4) {
+        a0 = nuo_apply_unsigned<K>(a0, static_cast<U>(static_cast<T>(first[i])));
+        a1 = nuo_apply_unsigned<K>(a1, static_cast<U>(static_cast<T>(first[i + 1])));
+        a2 = nuo_apply_unsigned<K>(a2, static_cast<U>(static_cast<T>(first[i + 2])));
+        a3 = nuo_apply_unsigned<K>(a3, static_cast<U>(static_cast<T>(first[i + 3])));
+    }
+    for (; i < n; i++)
+        a0 = nuo_apply_unsigned<K>(a0, static_cast<U>(static_cast<T>(first[i])));
+    return nuo_apply_unsigned<K>(nuo_apply_unsigned<K>(a0, a1), nuo_apply_unsigned<K>(a2, a3));
+}
+
+}   /* namespace detail */
+
+template<std::input_iterator It, typename T, typename Op = nuo_plus<>>
+constexpr T nuo_accumulate(It first, It last, T init, Op op = Op()) {
+    if constexpr (std::random_access_iterator<It> &&
+                  detail::nuo_accumulate_reassociates<Op, T, It>) {
+        if (!std::is_constant_evaluated()) {
+            using U = std::make_unsigned_t<T>;
+            if (first == last)
+                return init;
+            return static_cast<T>(detail::nuo_apply_unsigned<nuo_op_kind_v<Op>>(
+                static_cast<U>(init), detail::nuo_accumulate_lanes<Op, T>(first, last)));
+        }
+    }
+    for (; first != last; ++first)
+        init = op(std::move(init), *first);
+    return init;
+}
+
+/*
+ * nuo_par splits known associative integral reductions over the
+ * scheduler, chunks reduced as above; other reductions stay serial and
+ * in order.
+ */
+template<nuo_execution_policy Policy, std::random_access_iterator It, typename T,
+         typename Op = nuo_plus<>>
+T nuo_accumulate(Policy&& policy, It first, It last, T init, Op op = Op()) {
+    if constexpr (nuo_parallel_execution_policy<Policy> &&
+                  detail::nuo_accumulate_reassociates<Op, T, It>) {
+        using D = nuo_iter_difference_t<It>;
+        using U = std::make_unsigned_t<T>;
+        constexpr nuo_op_kind K = nuo_op_kind_v<Op>;
+        const size_t n = static_cast<size_t>(last - first);
+        if (n == 0)
+            return init;
+        U r = nuo_parallel_reduce(size_t(0), n, static_cast<U>(nuo_op_identity<Op, T>()),
+            [&](size_t b, size_t e) {
+                return detail::nuo_accumulate_lanes<Op, T>(first + static_cast<D>(b),
+                                                           first + static_cast<D>(e));
+            },
+            [](U a, U b) { return detail::nuo_apply_unsigned<K>(a, b); },
+            detail::nuo_policy_grain(policy, n, size_t(1) << 14));
+        return static_cast<T>(detail::nuo_apply_unsigned<K>(static_cast<U>(init), r));
+    } else {
+        return nuo_accumulate(first, last, std::move(init), std::move(op));
+    }
+}
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef NUOSTL_CORE_ALGORITHMS_NUO_BINARY_SEARCH_HPP_
+#define NUOSTL_CORE_ALGORITHMS_NUO_BINARY_SEARCH_HPP_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+#include "../function_objects/nuo_functional.hpp"
+#include "../iterators/nuo_iterator_traits.hpp"
+
+/*
+ * Binary search over sorted ranges, similar to std::lower_bound,
+ * std::upper_bound and std::binary_search.
+ *
+ * On random access ranges the search is branchless: each step compares
+ * the middle element and advances the base by half or by nothing, which
+ * compiles to a conditional move, so the loop runs exactly ceil(log2 n)
+ * times and no comparison outcome is ever mispredicted. On contiguous
+ * ranges larger than the L1 cache both elements the next step may
+ * compare are prefetched, overlapping the cache misses of two levels.
+ * Other forward ranges use the std:: algorithms.
+ *
+ * nuo_lower_bound_batch searches many values at once. Since a branchless
+ * search of a fixed range always takes the same number of steps, groups
+ * of queries advance in lockstep: each one takes a step, then prefetches
+ * the exact element its next step compares, and the rest of the group
+ * runs while that line arrives. Up to a group's worth of cache misses
+ * are in flight instead of one.
+ */
+
+namespace nuostl {
+
+namespace detail {
+
+inline constexpr size_t nuo_search_prefetch_bytes = 32 * 1024;
+
+/* The first element of [first, first + n) for which before() is false */
+template<typename It, typename Before>
+It nuo_branchless_partition_point(It first, nuo_iter_difference_t<It> n, Before& before) {
+    using D = nuo_iter_difference_t<It>;
+    if (n == 0)
+        return first;
+    bool prefetch = false;
+    if constexpr (nuo_contiguous_iterator<It>)
+        prefetch = static_cast<size_t>(n) * sizeof(nuo_iter_value_t<It>) > nuo_search_prefetch_bytes;
+    while (n > 1) {
+        const D half = n / 2;
+        if constexpr (nuo_contiguous_iterator<It>) {
+            if (prefetch) {
+                const D next = (n - half) / 2;
+                __builtin_prefetch(std::to_address(first + next));
+                __builtin_prefetch(std::to_address(first + half + next));
+            }
+        }
+        first += before(first[half]) ? half : D(0);
+        n -= half;
+    }
+    return first + D(before(*first));
+}
+
+inline constexpr size_t nuo_search_group = 16;
+
+/*
+ * emit(j, it) with the first element of [first, first + n) not before
+ * q[j], for j in [0, m), in order. Lanes of a group share n, so they
+ * share the step count and advance together.
+ */
+template<typename It, typename QIt, typename Compare, typename Emit>
+void nuo_lower_bound_groups(It first, nuo_iter_difference_t<It> n, QIt q, size_t m,
+                            Compare& comp, Emit emit) {
+    using D = nuo_iter_difference_t<It>;
+    bool prefetch = false;
+    if constexpr (nuo_contiguous_iterator<It>)
+        prefetch = static_cast<size_t>(n) * sizeof(nuo_iter_value_t<It>) > nuo_search_prefetch_bytes;
+    It base[nuo_search_group];
+    for (size_t g0 = 0; g0 < m; g0 += nuo_search_group) {
+        const size_t g = std::min(nuo_search_group, m - g0);
+        if (n == 0) {
+            for (size_t i = 0; i < g; i++)
+                emit(g0 + i, first);
+            continue;
+        }
+        for (size_t i = 0; i < g; i++)
+            base[i] = first;
+        for (D len = n; len > 1;) {
+            const D half = len / 2;
+            const D next = (len - half) / 2;
+            for (size_t i = 0; i < g; i++) {
+                base[i] += comp(base[i][half], q[g0 + i]) ? half : D(0);
+                if constexpr (nuo_contiguous_iterator<It>) {
+                    if (prefetch)
+                        __builtin_prefetch(std::to_address(base[i] + next));
+                }
+            }
+            len -= half;
+        }
+        for (size_t i = 0; i < g; i++)
+            emit(g0 + i, base[i] + D(comp(*base[i], q[g0 + i])));
+    }
+}
+
+}   /* namespace detail */
+
+/* The first element not before value */
+template<std::forward_iterator It, typename T, typename Compare = nuo_less<>>
+It nuo_lower_bound(It first, It last, const T& value, Compare comp = Compare()) {
+    if constexpr (nuo_random_access_iterator<It>) {
+        auto before = [&](const auto& e) -> bool { return comp(e, value); };
+        return detail::nuo_branchless_partition_point(first, last - first, before);
+    } else {
+        return std::lower_bound(first, last, value, comp);
+    }
+}
+
+/* The first element after value */
+template<std::forward_iterator It, typename T, typename Compare = nuo_less<>>
+It nuo_upper_bound(It first, It last, const T& value, Compare comp = Compare()) {
+    if constexpr (nuo_random_access_iterator<It>) {
+        auto before = [&](const auto& e) -> bool { return !comp(value, e); };
+        return detail::nuo_branchless_partition_point(first, last - first, before);
+    } else {
+        return std::upper_bound(first, last, value, comp);
+    }
+}
+
+/* nuo_lower_bound of each of [qfirst, qlast), written to out in order */
+template<std::random_access_iterator It, std::random_access_iterator QIt,
+         std::output_iterator<It> OutIt, typename Compare = nuo_less<>>
+OutIt nuo_lower_bound_batch(It first, It last, QIt qfirst, QIt qlast, OutIt out,
+                            Compare comp = Compare()) {
+    detail::nuo_lower_bound_groups(first, last - first, qfirst,
+                                   static_cast<size_t>(qlast - qfirst), comp,
+                                   [&](size_t, It it) { *out++ = it; });
+    return out;
+}
+
+template<std::forward_iterator It, typename T, typename Compare = nuo_less<>>
+bool nuo_binary_search(It first, It last, const T& value, Compare comp = Compare()) {
+    It it = nuo_lower_bound(first, last, value, comp);
+    return it != last && !comp(value, *it);
+}
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,254 @@
+#ifndef NUOSTL_CORE_ALGORITHMS_NUO_COPY_HPP_
+#define NUOSTL_CORE_ALGORITHMS_NUO_COPY_HPP_
+
+#include <stddef.h>
+#include <string.h>
+
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../execution/nuo_execution.hpp"
+#include "../iterators/nuo_iterator_traits.hpp"
+#include "./detail/nuo_copy_stream.hpp"
+
+/*
+ * nuo_copy, nuo_move, nuo_fill and their _n / _backward forms, similar to
+ * the std ones. When both ranges are contiguous over the same trivially
+ * copyable type the copies lower to one memmove (streaming past the last
+ * level cache, see detail/nuo_copy_stream.hpp), and a fill whose value
+ * has the same byte everywhere (0, -1, any char) lowers to memset. Other
+ * iterators, and constant evaluation, take the element loop.
+ *
+ * The nuo_par overloads of nuo_copy and nuo_fill cut the range in chunks
+ * of 64 KiB (or the policy's grain) for the scheduler; a parallel copy
+ * decides once, from its total size, whether every chunk streams.
+ */
+
+namespace nuostl {
+
+/* Copies of at least this many bytes use non-temporal stores */
+inline size_t nuo_copy_stream_threshold() noexcept {
+    return detail::nuo_stream_threshold_slot().load(std::memory_order_relaxed);
+}
+
+/* Sets the threshold (tests, benchmarks); SIZE_MAX never streams */
+inline void nuo_set_copy_stream_threshold(size_t bytes) noexcept {
+    detail::nuo_stream_threshold_slot().store(bytes, std::memory_order_relaxed);
+}
+
+namespace detail {
+
+/* The value converts to T without changing meaning, so one T can be memset */
+template<typename T, typename V>
+inline constexpr bool nuo_fill_memset_candidate =
+    std::is_trivially_copyable_v<T> &&
+    (std::is_same_v<std::remove_cvref_t<V>, T> ||
+     (std::is_arithmetic_v<T> && std::is_arithmetic_v<std::remove_cvref_t<V>>));
+
+template<typename T>
+inline bool nuo_uniform_bytes(const T& v, unsigned char& byte) noexcept {
+    unsigned char b[sizeof(T)];
+    memcpy(b, &v, sizeof(T));
+    for (size_t i = 1; i < sizeof(T); i++) {
+        if (b[i] != b[0])
+            return false;
+    }
+    byte = b[0];
+    return true;
+}
+
+}   /* namespace detail */
+
+template<std::input_iterator In, std::weakly_incrementable Out>
+constexpr Out nuo_copy(In first, In last, Out d_first) {
+    if constexpr (nuo_memcpyable_iterators<In, Out>) {
+        if (!std::is_constant_evaluated()) {
+            auto n = last - first;
+            if (n > 0) {
+                detail::nuo_copy_bytes(std::to_address(d_first), std::to_address(first),
+                                       static_cast<size_t>(n) * sizeof(std::iter_value_t<Out>));
+            }
+            return d_first + n;
+        }
+    }
+    for (; first != last; ++first, ++d_first)
+        *d_first = *first;
+    return d_first;
+}
+
+template<std::input_iterator In, typename Size, std::weakly_incrementable Out>
+constexpr Out nuo_copy_n(In first, Size count, Out d_first) {
+    if constexpr (nuo_memcpyable_iterators<In, Out>) {
+        if (!std::is_constant_evaluated()) {
+            if (count <= 0)
+                return d_first;
+            return nuo_copy(first, first + count, d_first);
+        }
+    }
+    for (; count > 0; --count, ++first, ++d_first)
+        *d_first = *first;
+    return d_first;
+}
+
+/* Copies into the range ending at d_last, last element first */
+template<std::bidirectional_iterator In, std::bidirectional_iterator Out>
+constexpr Out nuo_copy_backward(In first, In last, Out d_last) {
+    if constexpr (nuo_memcpyable_iterators<In, Out>) {
+        if (!std::is_constant_evaluated()) {
+            auto n = last - first;
+            if (n > 0) {
+                detail::nuo_copy_bytes(std::to_address(d_last - n), std::to_address(first),
+                                       static_cast<size_t>(n) * sizeof(std::iter_value_t<Out>));
+            }
+            return d_last - n;
+        }
+    }
+    while (first != last)
+        *--d_last = *--last;
+    return d_last;
+}
+
+template<std::input_iterator In, std::weakly_incrementable Out>
+constexpr Out nuo_move(In first, In last, Out d_first) {
+    if constexpr (nuo_memmovable_iterators<In, Out>) {
+        if (!std::is_constant_evaluated())
+            return nuo_copy(first, last, d_first);
+    }
+    for (; first != last; ++first, ++d_first)
+        *d_first = std::ranges::iter_move(first);
+    return d_first;
+}
+
+template<std::bidirectional_iterator In, std::bidirectional_iterator Out>
+constexpr Out nuo_move_backward(In first, In last, Out d_last) {
+    if constexpr (nuo_memmovable_iterators<In, Out>) {
+        if (!std::is_constant_evaluated())
+            return nuo_copy_backward(first, last, d_last);
+    }
+    while (first != last)
+        *--d_last = std::ranges::iter_move(--last);
+    return d_last;
+}
+
+template<std::forward_iterator It, typename Size, typename V>
+constexpr It nuo_fill_n(It first, Size count, const V& value) {
+    using T = std::iter_value_t<It>;
+    if constexpr (std::contiguous_iterator<It> && detail::nuo_fill_memset_candidate<T, V>) {
+        if (!std::is_constant_evaluated()) {
+            if (count <= 0)
+                return first;
+            const T v = static_cast<T>(value);
+            unsigned char byte;
+            if (detail::nuo_uniform_bytes(v, byte)) {
+                memset(static_cast<void*>(std::to_address(first)), byte,
+                       static_cast<size_t>(count) * sizeof(T));
+                return first + count;
+            }
+        }
+    }
+    for (; count > 0; --count, ++first)
+        *first = value;
+    return first;
+}
+
+template<std::forward_iterator It, typename V>
+constexpr void nuo_fill(It first, It last, const V& value) {
+    if constexpr (std::contiguous_iterator<It>) {
+        nuo_fill_n(first, last - first, value);
+    } else {
+        for (; first != last; ++first)
+            *first = value;
+    }
+}
+
+/*
+ * Moves [first, last) into the uninitialized storage at d_first and ends
+ * the lifetime of the source objects: one memmove for trivially
+ * relocatable types, a move construction and a destruction per element
+ * otherwise. Returns the end of the destination.
+ */
+template<std::forward_iterator In, std::forward_iterator Out>
+Out nuo_uninitialized_relocate(In first, In last, Out d_first) {
+    using T = std::iter_value_t<Out>;
+    if constexpr (std::contiguous_iterator<In> && std::contiguous_iterator<Out> &&
+                  std::is_same_v<std::iter_value_t<In>, T> &&
+                  nuo_is_trivially_relocatable_v<T>) {
+        auto n = last - first;
+        if (n > 0) {
+            detail::nuo_copy_bytes(static_cast<void*>(std::to_address(d_first)),
+                                   static_cast<const void*>(std::to_address(first)),
+                                   static_cast<size_t>(n) * sizeof(T));
+        }
+        return d_first + n;
+    } else {
+        for (; first != last; ++first, ++d_first) {
+            std::construct_at(std::addressof(*d_first), std::move(*first));
+            std::destroy_at(std::addressof(*first));
+        }
+        return d_first;
+    }
+}
+
+namespace detail {
+
+template<typename T>
+inline size_t nuo_par_chunk(const nuo_parallel_policy& policy) noexcept {
+    if (policy.grain != 0)
+        return policy.grain;
+    return sizeof(T) >= (size_t(1) << 16) ? 1 : (size_t(1) << 16) / sizeof(T);
+}
+
+}   /* namespace detail */
+
+/* The ranges may not overlap */
+template<nuo_execution_policy Policy, std::random_access_iterator In,
+         std::random_access_iterator Out>
+Out nuo_copy(Policy&& policy, In first, In last, Out d_first) {
+    if constexpr (nuo_parallel_execution_policy<Policy>) {
+        using D = std::iter_difference_t<In>;
+        using E = std::iter_difference_t<Out>;
+        const D n = last - first;
+        if (n <= 0)
+            return d_first;
+        const size_t grain = detail::nuo_par_chunk<std::iter_value_t<Out>>(policy);
+        if constexpr (nuo_memcpyable_iterators<In, Out>) {
+            constexpr size_t sz = sizeof(std::iter_value_t<Out>);
+            char* dst = reinterpret_cast<char*>(std::to_address(d_first));
+            const char* src = reinterpret_cast<const char*>(std::to_address(first));
+            const bool stream = detail::nuo_copy_streams(dst, src, static_cast<size_t>(n) * sz);
+            nuo_parallel_for_range(0, static_cast<size_t>(n), [&](size_t b, size_t e) {
+                detail::nuo_copy_bytes_chunk(dst + b * sz, src + b * sz, (e - b) * sz, stream);
+            }, grain);
+        } else {
+            nuo_parallel_for_range(0, static_cast<size_t>(n), [&](size_t b, size_t e) {
+                nuo_copy(first + static_cast<D>(b), first + static_cast<D>(e),
+                         d_first + static_cast<E>(b));
+            }, grain);
+        }
+        return d_first + static_cast<E>(n);
+    } else {
+        return nuo_copy(first, last, d_first);
+    }
+}
+
+template<nuo_execution_policy Policy, std::random_access_iterator It, typename V>
+void nuo_fill(Policy&& policy, It first, It last, const V& value) {
+    if constexpr (nuo_parallel_execution_policy<Policy>) {
+        using D = std::iter_difference_t<It>;
+        const D n = last - first;
+        if (n <= 0)
+            return;
+        nuo_parallel_for_range(0, static_cast<size_t>(n), [&](size_t b, size_t e) {
+            nuo_fill(first + static_cast<D>(b), first + static_cast<D>(e), value);
+        }, detail::nuo_par_chunk<std::iter_value_t<It>>(policy));
+    } else {
+        nuo_fill(first, last, value);
+    }
+}
+
+}   /* namespace nuostl */
+
+#endif
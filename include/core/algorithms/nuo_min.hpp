@@ -4,10 +4,21 @@
 #include <concepts>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+
+#include "../execution/nuo_execution.hpp"
+#include "../function_objects/nuo_functional.hpp"
+#include "../iterators/nuo_iterator_traits.hpp"
+#include "./detail/nuo_minmax_simd.hpp"
 
 namespace nuostl {
 
+/*
+ * The smaller of two values. Two iterators are a range instead, see
+ * nuo_min(first, last) below; to pick between iterators, compare them.
+ */
 template<typename T>
+    requires (!std::input_iterator<T>)
 constexpr const T& nuo_min(const T& a, const T& b) {
     if constexpr (requires (const T& x, const T& y) {
         { x < y } -> std::convertible_to<bool>;
@@ -28,7 +39,7 @@ constexpr const T& nuo_min(const T& a, const T& b) {
 }
 
 template<typename T, typename... Ts>
-constexpr const T nuo_min(const T& a, const T& b, const Ts&... rest) {
+constexpr const T& nuo_min(const T& a, const T& b, const Ts&... rest) {
     const T& ans = nuo_min(a, b);
     if (sizeof...(rest) == 0) {
         return ans;
@@ -51,13 +62,23 @@ constexpr T nuo_min(std::initializer_list<T> ilist) {
     return ans;
 }
 
-template<typename Iter>
+template<std::input_iterator Iter>
 constexpr auto nuo_min(Iter first, Iter last)
-        -> typename std::iterator_traits<Iter>::value_type {
-    using T = typename std::iterator_traits<Iter>::value_type;
+        -> nuo_iter_value_t<Iter> {
+    using T = nuo_iter_value_t<Iter>;
     if (first == last)
         return T{};
 
+#if defined(NUOSTL_ARCH_X86)
+    if constexpr (nuo_contiguous_iterator<Iter> &&
+                  detail::nuo_minmax_simd_eligible<T>) {
+        if (!std::is_constant_evaluated()) {
+            return detail::nuo_minmax_simd<false>(std::to_address(first),
+                static_cast<size_t>(last - first));
+        }
+    }
+#endif
+
     T ans = *first;
     first++;
     for (; first != last; first++)
@@ -66,6 +87,80 @@ constexpr auto nuo_min(Iter first, Iter last)
     return ans;
 }
 
+/* b when comp(b, a), otherwise a */
+template<typename T, typename Compare>
+    requires (!std::input_iterator<T>) && std::predicate<Compare&, const T&, const T&>
+constexpr const T& nuo_min(const T& a, const T& b, Compare comp) {
+    return comp(b, a) ? b : a;
+}
+
+template<typename T, typename Compare>
+    requires std::predicate<Compare&, const T&, const T&>
+constexpr T nuo_min(std::initializer_list<T> ilist, Compare comp) {
+    if (ilist.size() == 0)
+        return T{};
+    auto it = ilist.begin();
+    T ans = *it;
+    for (++it; it != ilist.end(); ++it)
+        ans = nuo_min(ans, *it, comp);
+    return ans;
+}
+
+/*
+ * With a comparator, the first of the smallest elements under comp. A
+ * known comparison on an arithmetic element type (nuo_less<>,
+ * std::greater<int>, ...) is the built-in one, so the SIMD kernels apply;
+ * the minimum under nuo_greater is the maximum.
+ */
+template<std::input_iterator Iter, typename Compare>
+    requires std::predicate<Compare&, nuo_iter_reference_t<Iter>, nuo_iter_reference_t<Iter>>
+constexpr auto nuo_min(Iter first, Iter last, Compare comp)
+        -> nuo_iter_value_t<Iter> {
+    using T = nuo_iter_value_t<Iter>;
+    if (first == last)
+        return T{};
+
+#if defined(NUOSTL_ARCH_X86)
+    if constexpr (nuo_contiguous_iterator<Iter> &&
+                  detail::nuo_minmax_simd_eligible<T> &&
+                  (nuo_is_less_v<Compare, T> || nuo_is_greater_v<Compare, T>)) {
+        if (!std::is_constant_evaluated()) {
+            return detail::nuo_minmax_simd<nuo_is_greater_v<Compare, T>>(std::to_address(first),
+                static_cast<size_t>(last - first));
+        }
+    }
+#endif
+
+    T ans = *first;
+    for (++first; first != last; ++first) {
+        if (comp(*first, ans))
+            ans = *first;
+    }
+    return ans;
+}
+
+/*
+ * nuo_seq is the serial nuo_min; nuo_par reduces chunks of at least
+ * 16384 elements with it on the scheduler and combines the results.
+ */
+template<nuo_execution_policy Policy, std::random_access_iterator Iter>
+auto nuo_min(Policy&& policy, Iter first, Iter last)
+        -> nuo_iter_value_t<Iter> {
+    using T = nuo_iter_value_t<Iter>;
+    if constexpr (nuo_parallel_execution_policy<Policy>) {
+        size_t n = static_cast<size_t>(last - first);
+        return nuo_parallel_reduce(size_t(0), n, T{},
+            [&](size_t b, size_t e) {
+                using D = nuo_iter_difference_t<Iter>;
+                return nuo_min(first + static_cast<D>(b), first + static_cast<D>(e));
+            },
+            [](const T& a, const T& b) { return T(nuo_min(a, b)); },
+            detail::nuo_policy_grain(policy, n, size_t(1) << 14));
+    } else {
+        return nuo_min(first, last);
+    }
+}
+
 }   /* namespace nuostl*/
 
 #endif
\ No newline at end of file
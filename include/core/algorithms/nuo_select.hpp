@@ -0,0 +1,337 @@
+#ifndef NUOSTL_CORE_ALGORITHMS_NUO_SELECT_HPP_
+#define NUOSTL_CORE_ALGORITHMS_NUO_SELECT_HPP_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../function_objects/nuo_functional.hpp"
+#include "../iterators/nuo_iterator_traits.hpp"
+#include "../sequence_containers/nuo_heap.hpp"
+#include "./detail/nuo_select_simd.hpp"
+
+/*
+ * Selection, the generalization of nuo_min / nuo_max to the k smallest or
+ * largest elements without sorting everything:
+ *
+ * - nuo_nth_element: introselect, quickselect on a median-of-3 (ninther
+ *   above 128 elements) pivot that falls back to median-of-medians pivots
+ *   once it has taken 2 log2 n rounds, so the worst case stays linear;
+ * - nuo_partial_sort: the k smallest in order, by heap selection when
+ *   k <= n / 8 and by nuo_nth_element then a heap sort of the k otherwise;
+ * - nuo_top_k: the k largest of a stream fed a value or a chunk at a time,
+ *   in a bounded heap whose root is the admission threshold.
+ *
+ * Elements are compared as nuo_min and nuo_max compare them: with operator<
+ * where T has one and operator> otherwise, or with comp. On contiguous
+ * ranges of 4 and 8 byte integers, float or double with a known less /
+ * greater, heap selection skips the elements that cannot enter the heap
+ * with a SIMD scan against its root (see detail/nuo_select_simd.hpp).
+ */
+
+namespace nuostl {
+
+namespace detail {
+
+/* a < b, or b > a when only operator> exists */
+struct nuo_natural_less {
+    using is_transparent = void;
+
+    template<typename A, typename B>
+    constexpr bool operator()(const A& a, const B& b) const {
+        if constexpr (requires { { a < b } -> std::convertible_to<bool>; })
+            return a < b;
+        else
+            return b > a;
+    }
+};
+
+}   /* namespace detail */
+
+template<>
+struct nuo_op_traits<detail::nuo_natural_less> {
+    static constexpr nuo_op_kind kind = nuo_op_kind::less;
+};
+
+namespace detail {
+
+template<typename It, typename Compare>
+void nuo_insertion_sort(It first, It last, Compare& comp) {
+    if (first == last)
+        return;
+    for (It i = first + 1; i != last; ++i) {
+        nuo_iter_value_t<It> v = std::move(*i);
+        It j = i;
+        for (; j != first && comp(v, *(j - 1)); --j)
+            *j = std::move(*(j - 1));
+        *j = std::move(v);
+    }
+}
+
+template<typename It, typename Compare>
+It nuo_median_of_3(It a, It b, It c, Compare& comp) {
+    if (comp(*a, *b)) {
+        if (comp(*b, *c))
+            return b;
+        return comp(*a, *c) ? c : a;
+    }
+    if (comp(*a, *c))
+        return a;
+    return comp(*b, *c) ? c : b;
+}
+
+template<typename It, typename Compare>
+It nuo_select_pivot(It first, It last, Compare& comp) {
+    using D = nuo_iter_difference_t<It>;
+    D n = last - first;
+    It mid = first + n / 2;
+    if (n <= 128)
+        return nuo_median_of_3(first + 1, mid, last - 1, comp);
+    D s = n / 8;
+    return nuo_median_of_3(nuo_median_of_3(first, first + s, first + 2 * s, comp),
+                           nuo_median_of_3(mid - s, mid, mid + s, comp),
+                           nuo_median_of_3(last - 1 - 2 * s, last - 1 - s, last - 1, comp),
+                           comp);
+}
+
+/*
+ * Partitions (first, last) around the pivot *first: returns cut with no
+ * element of [first, cut) after the pivot and none of [cut, last) before
+ * it. Both scans stop on keys equal to the pivot, so runs of them split
+ * evenly, and run without bounds checks: the pivot stops the right scan
+ * and every pivot rule here leaves a key not less than the pivot to its
+ * right, which stops the left one; after a swap the swapped keys do.
+ */
+template<typename It, typename Compare>
+It nuo_partition_unguarded(It first, It last, Compare& comp) {
+    using T = nuo_iter_value_t<It>;
+    /* a register copy, the swaps would otherwise reload it */
+    using Pivot = std::conditional_t<std::is_trivially_copyable_v<T> && sizeof(T) <= 16, const T,
+                                     const T&>;
+    Pivot pivot = *first;
+    It lo = first + 1;
+    It hi = last;
+    for (;;) {
+        while (comp(*lo, pivot))
+            ++lo;
+        --hi;
+        while (comp(pivot, *hi))
+            --hi;
+        if (!(lo < hi))
+            return lo;
+        std::iter_swap(lo, hi);
+        ++lo;
+    }
+}
+
+template<typename It, typename Compare>
+void nuo_introselect(It first, It nth, It last, Compare& comp);
+
+/* A pivot with at least 3/10 of the range on either side */
+template<typename It, typename Compare>
+It nuo_median_of_medians(It first, It last, Compare& comp) {
+    using D = nuo_iter_difference_t<It>;
+    D groups = 0;
+    for (It g = first; last - g >= 5; g += 5) {
+        nuo_insertion_sort(g, g + 5, comp);
+        std::iter_swap(first + groups, g + 2);
+        groups++;
+    }
+    It mid = first + (groups - 1) / 2;
+    nuo_introselect(first, mid, first + groups, comp);
+    return mid;
+}
+
+template<typename It, typename Compare>
+void nuo_introselect(It first, It nth, It last, Compare& comp) {
+    unsigned budget = 2 * static_cast<unsigned>(std::bit_width(static_cast<size_t>(last - first)));
+    while (last - first > 16) {
+        It pivot;
+        if (budget > 0) {
+            budget--;
+            pivot = nuo_select_pivot(first, last, comp);
+        } else {
+            pivot = nuo_median_of_medians(first, last, comp);
+        }
+        std::iter_swap(first, pivot);
+        It cut = nuo_partition_unguarded(first, last, comp);
+        if (nth < cut)
+            last = cut;
+        else
+            first = cut;
+    }
+    nuo_insertion_sort(first, last, comp);
+}
+
+/*
+ * [first, first + k) is a heap under comp: swaps in each later element
+ * comp puts before its root, leaving the k smallest in the heap.
+ */
+template<typename It, typename Compare>
+void nuo_heap_select(It first, It middle, It last, Compare& comp) {
+    using T = nuo_iter_value_t<It>;
+    using D = nuo_iter_difference_t<It>;
+    const D k = middle - first;
+    if constexpr (nuo_contiguous_iterator<It> && nuo_select_simd_eligible<T> &&
+                  (nuo_is_less_v<Compare, T> || nuo_is_greater_v<Compare, T>)) {
+        T* p = std::to_address(first);
+        const size_t n = static_cast<size_t>(last - first);
+        size_t i = static_cast<size_t>(k);
+        for (;;) {
+            i += nuo_find_beyond<nuo_is_greater_v<Compare, T>>(p + i, n - i, p[0]);
+            if (i >= n)
+                break;
+            T v = std::move(p[i]);
+            p[i] = std::move(p[0]);
+            nuo_heap_replace_front<4>(p, static_cast<ptrdiff_t>(k), std::move(v), comp);
+            i++;
+        }
+    } else {
+        for (It it = middle; it != last; ++it) {
+            if (comp(*it, *first)) {
+                T v = std::move(*it);
+                *it = std::move(*first);
+                nuo_heap_replace_front<4>(first, k, std::move(v), comp);
+            }
+        }
+    }
+}
+
+}   /* namespace detail */
+
+/*
+ * Rearranges [first, last) so that *nth is the element a sort would put
+ * there, no element of [first, nth) is after it and none of (nth, last)
+ * before it.
+ */
+template<std::random_access_iterator It, typename Compare = detail::nuo_natural_less>
+void nuo_nth_element(It first, It nth, It last, Compare comp = Compare()) {
+    if (nth == last || last - first < 2)
+        return;
+    detail::nuo_introselect(first, nth, last, comp);
+}
+
+/* The middle - first smallest elements in order at the front */
+template<std::random_access_iterator It, typename Compare = detail::nuo_natural_less>
+void nuo_partial_sort(It first, It middle, It last, Compare comp = Compare()) {
+    const auto k = middle - first;
+    if (k == 0)
+        return;
+    if (k <= (last - first) / 8) {
+        nuo_make_heap<4>(first, middle, comp);
+        detail::nuo_heap_select(first, middle, last, comp);
+    } else {
+        if (middle != last)
+            nuo_nth_element(first, middle - 1, last, comp);
+        nuo_make_heap<4>(first, middle, comp);
+    }
+    nuo_sort_heap<4>(first, middle, comp);
+}
+
+/*
+ * The k largest values under Compare seen so far, nuo_max generalized to
+ * a stream: push() values or chunks, sorted() lists the current top k,
+ * largest first; with nuo_greater<> it keeps the k smallest. The values
+ * live in a k-element heap whose root, threshold(), is the smallest of
+ * them, so a value not above it is rejected with one comparison. States
+ * built on separate threads combine with merge().
+ */
+template<typename T, typename Compare = detail::nuo_natural_less>
+class nuo_top_k {
+private:
+    /* Heap order: the root is the smallest kept value */
+    struct after {
+        Compare comp;
+
+        bool operator()(const T& a, const T& b) const { return comp(b, a); }
+    };
+
+    std::vector<T> heap_;
+    size_t k_;
+    [[no_unique_address]] after after_;
+
+    void admit(T value) {
+        if (heap_.size() < k_) {
+            heap_.push_back(std::move(value));
+            nuo_push_heap<4>(heap_.begin(), heap_.end(), after_);
+        } else if (k_ > 0 && after_.comp(heap_[0], value)) {
+            detail::nuo_heap_replace_front<4>(heap_.begin(), static_cast<ptrdiff_t>(k_),
+                                              std::move(value), after_);
+        }
+    }
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = size_t;
+
+    /* Constructor */
+    explicit nuo_top_k(size_t k, const Compare& comp = Compare())
+        : k_(k), after_{comp} {}
+
+    /* Element access */
+    /* The smallest of the values kept, needs !empty() */
+    const T& threshold() const noexcept { return heap_[0]; }
+
+    /* The values kept, largest first */
+    std::vector<T> sorted() const {
+        std::vector<T> v = heap_;
+        after a = after_;
+        nuo_sort_heap<4>(v.begin(), v.end(), a);
+        return v;
+    }
+
+    /* Capacity */
+    bool empty() const noexcept { return heap_.empty(); }
+    size_type size() const noexcept { return heap_.size(); }
+    size_type k() const noexcept { return k_; }
+    /* k values were seen, so threshold() is the k-th largest */
+    bool full() const noexcept { return heap_.size() == k_; }
+
+    /* Modifiers */
+    void push(const T& value) { admit(value); }
+
+    template<std::input_iterator It>
+    void push(It first, It last) {
+        if constexpr (nuo_contiguous_iterator<It> &&
+                      std::is_same_v<nuo_iter_value_t<It>, T> && detail::nuo_select_simd_eligible<T> &&
+                      (nuo_is_less_v<Compare, T> || nuo_is_greater_v<Compare, T>)) {
+            const T* p = std::to_address(first);
+            const size_t n = static_cast<size_t>(last - first);
+            size_t i = 0;
+            for (; i < n && heap_.size() < k_; i++)
+                admit(p[i]);
+            if (i == n || k_ == 0)
+                return;
+            for (;;) {
+                i += detail::nuo_find_beyond<nuo_is_less_v<Compare, T>>(p + i, n - i, heap_[0]);
+                if (i >= n)
+                    break;
+                detail::nuo_heap_replace_front<4>(heap_.begin(), static_cast<ptrdiff_t>(k_),
+                                                  T(p[i]), after_);
+                i++;
+            }
+        } else {
+            for (; first != last; ++first)
+                admit(*first);
+        }
+    }
+
+    /* Adds the values o kept */
+    void merge(const nuo_top_k& o) {
+        for (const T& v : o.heap_)
+            admit(v);
+    }
+
+    void clear() noexcept { heap_.clear(); }
+};
+
+}   /* namespace nuostl */
+
+#endif
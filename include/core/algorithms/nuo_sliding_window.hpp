@@ -0,0 +1,352 @@
+#ifndef NUOSTL_CORE_ALGORITHMS_NUO_SLIDING_WINDOW_HPP_
+#define NUOSTL_CORE_ALGORITHMS_NUO_SLIDING_WINDOW_HPP_
+
+#include <stddef.h>
+
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../function_objects/nuo_functional.hpp"
+#include "../iterators/nuo_iterator_traits.hpp"
+#include "./detail/nuo_ring.hpp"
+#include "./nuo_accumulate.hpp"
+
+/*
+ * Incremental reducers over a window of the latest values of a stream,
+ * for rolling minima, maxima and sums that would otherwise rescan each
+ * window:
+ *
+ * - nuo_monotonic_queue: a FIFO whose top() is its smallest value under
+ *   Compare. It only keeps the values that can still become the minimum,
+ *   in increasing order, so push and pop are amortized O(1);
+ * - nuo_sliding_window (nuo_window_min / nuo_window_max): the same over
+ *   the last `window` values pushed;
+ * - nuo_sliding_min / nuo_sliding_max: the minimum of every window of a
+ *   range. Random access ranges of arithmetic values compared with a
+ *   known less / greater use van Herk / Gil-Werman blocks instead, three
+ *   branch-free comparisons per element whatever the window size;
+ * - nuo_window_aggregator: a FIFO folding its values with any associative
+ *   op, kept as two stacks (O(1) amortized push and pop). When the op has
+ *   an inverse (nuo_plus and the xors on integers) it keeps one running
+ *   total and subtracts each evicted value instead.
+ */
+
+namespace nuostl {
+
+/* Queue whose top() is the first of the smallest values under Compare */
+template<typename T, typename Compare = nuo_less<>>
+class nuo_monotonic_queue {
+private:
+    struct entry {
+        T value;
+        size_t seq;
+    };
+
+    /* Values no later value is smaller than, oldest first */
+    detail::nuo_ring<entry> ring_;
+    size_t pushed_ = 0;
+    size_t popped_ = 0;
+    [[no_unique_address]] Compare comp_;
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = size_t;
+
+    /* Constructor */
+    nuo_monotonic_queue() = default;
+
+    explicit nuo_monotonic_queue(const Compare& comp) : comp_(comp) {}
+
+    /* Element access */
+    const T& top() const noexcept {
+        return ring_.front().value;
+    }
+
+    /* Capacity */
+    bool empty() const noexcept { return pushed_ == popped_; }
+    size_type size() const noexcept { return pushed_ - popped_; }
+
+    /* Modifiers */
+    void push(T value) {
+        /* queued values larger than the new one can no longer be the top */
+        while (!ring_.empty() && comp_(value, ring_.back().value))
+            ring_.pop_back();
+        ring_.push_back(entry{std::move(value), pushed_++});
+    }
+
+    /* Removes the oldest value */
+    void pop() noexcept {
+        if (ring_.front().seq == popped_)
+            ring_.pop_front();
+        popped_++;
+    }
+
+    void clear() noexcept {
+        ring_.clear();
+        pushed_ = popped_ = 0;
+    }
+};
+
+/* The smallest under Compare of the last `window` values pushed */
+template<typename T, typename Compare = nuo_less<>>
+class nuo_sliding_window {
+private:
+    nuo_monotonic_queue<T, Compare> queue_;
+    size_t window_;
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = size_t;
+
+    /* Constructor */
+    explicit nuo_sliding_window(size_t window, const Compare& comp = Compare())
+        : queue_(comp), window_(window) {
+        if (window == 0)
+            throw std::invalid_argument("nuo_sliding_window: empty window");
+    }
+
+    /* Element access */
+    const T& top() const noexcept { return queue_.top(); }
+
+    /* Capacity */
+    bool empty() const noexcept { return queue_.empty(); }
+    size_type size() const noexcept { return queue_.size(); }
+    size_type window() const noexcept { return window_; }
+    /* window() values were pushed */
+    bool full() const noexcept { return queue_.size() == window_; }
+
+    /* Modifiers */
+    void push(T value) {
+        queue_.push(std::move(value));
+        if (queue_.size() > window_)
+            queue_.pop();
+    }
+
+    void clear() noexcept { queue_.clear(); }
+};
+
+template<typename T>
+using nuo_window_min = nuo_sliding_window<T, nuo_less<>>;
+
+template<typename T>
+using nuo_window_max = nuo_sliding_window<T, nuo_greater<>>;
+
+namespace detail {
+
+/*
+ * van Herk / Gil-Werman: the window starting at base + k, in the block
+ * [base, base + w), is the suffix [base + k, base + w) of that block
+ * followed by the prefix [base + w, base + w + k) of the next one, so the
+ * block suffix and next-block prefix minima give every window of the
+ * block with one more comparison each.
+ */
+template<typename Compare, std::random_access_iterator It, typename Out>
+Out nuo_sliding_blocks(It a, size_t n, size_t w, Out out, Compare comp) {
+    using T = nuo_iter_value_t<It>;
+    using D = nuo_iter_difference_t<It>;
+    auto pick = [&](const T& x, const T& y) { return comp(y, x) ? y : x; };
+    if (n < w)
+        return out;
+    std::vector<T> suf(w), pre(w);
+    for (size_t base = 0; base + w <= n; base += w) {
+        const size_t starts = w < n - w - base + 1 ? w : n - w - base + 1;
+        It b = a + static_cast<D>(base);
+        suf[w - 1] = b[static_cast<D>(w - 1)];
+        for (size_t j = w - 1; j-- > 0;)
+            suf[j] = pick(b[static_cast<D>(j)], suf[j + 1]);
+        It next = b + static_cast<D>(w);
+        if (starts > 1) {
+            pre[0] = next[0];
+            for (size_t j = 1; j + 1 < starts; j++)
+                pre[j] = pick(pre[j - 1], next[static_cast<D>(j)]);
+        }
+        *out = suf[0];
+        ++out;
+        for (size_t k = 1; k < starts; k++) {
+            *out = pick(suf[k], pre[k - 1]);
+            ++out;
+        }
+    }
+    return out;
+}
+
+}   /* namespace detail */
+
+/*
+ * Writes the smallest value under comp of each window [i, i + window) of
+ * [first, last), n - window + 1 values for n >= window and none
+ * otherwise; returns the end of the output.
+ */
+template<std::input_iterator It, typename Out, typename Compare = nuo_less<>>
+Out nuo_sliding_min(It first, It last, size_t window, Out out, Compare comp = Compare()) {
+    using T = nuo_iter_value_t<It>;
+    if (window == 0)
+        throw std::invalid_argument("nuo_sliding_min: empty window");
+    if constexpr (std::random_access_iterator<It> &&
+                  (nuo_is_less_v<Compare, T> || nuo_is_greater_v<Compare, T>)) {
+        return detail::nuo_sliding_blocks(first, static_cast<size_t>(last - first), window, out,
+                                          comp);
+    } else {
+        nuo_sliding_window<T, Compare> w(window, comp);
+        for (; first != last; ++first) {
+            w.push(*first);
+            if (w.full()) {
+                *out = w.top();
+                ++out;
+            }
+        }
+        return out;
+    }
+}
+
+/* The largest value of each window, see nuo_sliding_min */
+template<std::input_iterator It, typename Out>
+Out nuo_sliding_max(It first, It last, size_t window, Out out) {
+    return nuo_sliding_min(first, last, window, out, nuo_greater<>());
+}
+
+namespace detail {
+
+/* op has an inverse on T that the running total can undo evictions with */
+template<typename Op, typename T>
+inline constexpr bool nuo_window_invertible =
+    nuo_is_associative_v<Op, T> && !std::is_same_v<T, bool> &&
+    (nuo_op_kind_v<Op> == nuo_op_kind::plus || nuo_op_kind_v<Op> == nuo_op_kind::bit_xor);
+
+/* Two stacks: aggregates of the older values, values of the newer ones */
+template<typename T, typename Op>
+class nuo_window_stacks {
+private:
+    /* front_.back() folds the oldest value with all of front_ */
+    std::vector<T> front_;
+    std::vector<T> back_;
+    T back_value_{};
+    [[no_unique_address]] Op op_;
+
+    /* the newer values move over, each paired with its suffix fold */
+    void flip() {
+        T acc = std::move(back_.back());
+        back_.pop_back();
+        front_.push_back(acc);
+        while (!back_.empty()) {
+            acc = op_(back_.back(), acc);
+            back_.pop_back();
+            front_.push_back(acc);
+        }
+    }
+public:
+    explicit nuo_window_stacks(const Op& op) : op_(op) {}
+
+    size_t size() const noexcept { return front_.size() + back_.size(); }
+
+    T value() const {
+        if (back_.empty())
+            return front_.back();
+        if (front_.empty())
+            return back_value_;
+        return op_(front_.back(), back_value_);
+    }
+
+    void push(T value) {
+        back_value_ = back_.empty() ? value : op_(back_value_, value);
+        back_.push_back(std::move(value));
+    }
+
+    void pop() {
+        if (front_.empty())
+            flip();
+        front_.pop_back();
+    }
+
+    void clear() noexcept {
+        front_.clear();
+        back_.clear();
+    }
+};
+
+/* One running total in wrapping unsigned arithmetic */
+template<typename T, typename Op>
+class nuo_window_total {
+private:
+    using U = std::make_unsigned_t<T>;
+    static constexpr nuo_op_kind K = nuo_op_kind_v<Op>;
+
+    nuo_ring<T> values_;
+    U total_ = 0;
+public:
+    explicit nuo_window_total(const Op&) {}
+
+    size_t size() const noexcept { return values_.size(); }
+
+    T value() const noexcept { return static_cast<T>(total_); }
+
+    void push(T value) {
+        total_ = nuo_apply_unsigned<K>(total_, static_cast<U>(value));
+        values_.push_back(value);
+    }
+
+    void pop() noexcept {
+        U v = static_cast<U>(values_.front());
+        if constexpr (K == nuo_op_kind::plus)
+            total_ = static_cast<U>(total_ - v);
+        else
+            total_ ^= v;
+        values_.pop_front();
+    }
+
+    void clear() noexcept {
+        values_.clear();
+        total_ = 0;
+    }
+};
+
+}   /* namespace detail */
+
+/*
+ * FIFO of values folded in order with the associative op: value() is
+ * op(...op(op(oldest, second), third)..., newest). value() needs at least
+ * one value, except with an invertible op, where an empty aggregator gives
+ * the identity.
+ */
+template<typename T, typename Op = nuo_plus<>>
+class nuo_window_aggregator {
+private:
+    using impl = std::conditional_t<detail::nuo_window_invertible<Op, T>,
+                                    detail::nuo_window_total<T, Op>,
+                                    detail::nuo_window_stacks<T, Op>>;
+
+    impl impl_;
+public:
+    using value_type = T;
+    using size_type = size_t;
+
+    /* the op is undone by subtraction rather than refolded */
+    static constexpr bool invertible = detail::nuo_window_invertible<Op, T>;
+
+    /* Constructor */
+    nuo_window_aggregator() : impl_(Op()) {}
+
+    explicit nuo_window_aggregator(const Op& op) : impl_(op) {}
+
+    /* Element access */
+    T value() const { return impl_.value(); }
+
+    /* Capacity */
+    bool empty() const noexcept { return impl_.size() == 0; }
+    size_type size() const noexcept { return impl_.size(); }
+
+    /* Modifiers */
+    void push(T value) { impl_.push(std::move(value)); }
+
+    /* Removes the oldest value */
+    void pop() { impl_.pop(); }
+
+    void clear() noexcept { impl_.clear(); }
+};
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef NUOSTL_CORE_ALGORITHMS_NUO_STREAM_ACCUMULATOR_HPP_
+#define NUOSTL_CORE_ALGORITHMS_NUO_STREAM_ACCUMULATOR_HPP_
+
+#include <stddef.h>
+
+#include <iterator>
+#include <utility>
+
+#include "../function_objects/nuo_functional.hpp"
+#include "../iterators/nuo_iterator_traits.hpp"
+#include "./nuo_accumulate.hpp"
+#include "./nuo_max.hpp"
+#include "./nuo_min.hpp"
+
+/*
+ * Running reductions of an unbounded stream, fed a value or a chunk at a
+ * time. Each state is a small value: every thread reduces its own part of
+ * the input, and merge() combines the partial states afterwards, in input
+ * order, e.g. as the combine step of nuo_parallel_reduce. Chunks go
+ * through the range algorithms, so the SIMD nuo_min / nuo_max kernels and
+ * the lanes of nuo_accumulate apply.
+ */
+
+namespace nuostl {
+
+/* Count, smallest and largest value under Compare */
+template<typename T, typename Compare = nuo_less<>>
+class nuo_stream_minmax {
+private:
+    size_t count_ = 0;
+    T min_{};
+    T max_{};
+    [[no_unique_address]] Compare comp_;
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = size_t;
+
+    /* Constructor */
+    nuo_stream_minmax() = default;
+
+    explicit nuo_stream_minmax(const Compare& comp) : comp_(comp) {}
+
+    /* Element access, min() and max() need count() > 0 */
+    size_type count() const noexcept { return count_; }
+    bool empty() const noexcept { return count_ == 0; }
+    const T& min() const noexcept { return min_; }
+    const T& max() const noexcept { return max_; }
+
+    /* Modifiers */
+    void push(const T& value) {
+        if (count_++ == 0) {
+            min_ = max_ = value;
+        } else {
+            if (comp_(value, min_))
+                min_ = value;
+            if (comp_(max_, value))
+                max_ = value;
+        }
+    }
+
+    template<std::input_iterator It>
+    void push(It first, It last) {
+        if constexpr (std::forward_iterator<It>) {
+            if (first == last)
+                return;
+            nuo_stream_minmax chunk(comp_);
+            chunk.count_ = static_cast<size_t>(std::distance(first, last));
+            chunk.min_ = nuo_min(first, last, comp_);
+            chunk.max_ = nuo_max(first, last, comp_);
+            merge(chunk);
+        } else {
+            for (; first != last; ++first)
+                push(*first);
+        }
+    }
+
+    /* Adds the values o has seen */
+    void merge(const nuo_stream_minmax& o) {
+        if (o.count_ == 0)
+            return;
+        if (count_ == 0) {
+            min_ = o.min_;
+            max_ = o.max_;
+        } else {
+            if (comp_(o.min_, min_))
+                min_ = o.min_;
+            if (comp_(max_, o.max_))
+                max_ = o.max_;
+        }
+        count_ += o.count_;
+    }
+
+    void clear() noexcept { count_ = 0; }
+};
+
+/*
+ * Count and fold of the values with the associative op, in input order:
+ * merging the state of a later part of the input keeps that order, so op
+ * need not commute. value() needs count() > 0.
+ */
+template<typename T, typename Op = nuo_plus<>>
+class nuo_stream_reducer {
+private:
+    size_t count_ = 0;
+    T value_{};
+    [[no_unique_address]] Op op_;
+public:
+    using value_type = T;
+    using size_type = size_t;
+
+    /* Constructor */
+    nuo_stream_reducer() = default;
+
+    explicit nuo_stream_reducer(const Op& op) : op_(op) {}
+
+    /* Element access */
+    size_type count() const noexcept { return count_; }
+    bool empty() const noexcept { return count_ == 0; }
+    const T& value() const noexcept { return value_; }
+
+    /* Modifiers */
+    void push(T value) {
+        value_ = count_++ == 0 ? std::move(value) : op_(std::move(value_), std::move(value));
+    }
+
+    template<std::input_iterator It>
+    void push(It first, It last) {
+        if constexpr (std::forward_iterator<It>) {
+            if (first == last)
+                return;
+            if (count_ == 0) {
+                value_ = *first;
+                ++first;
+                count_ = 1;
+            }
+            count_ += static_cast<size_t>(std::distance(first, last));
+            value_ = nuo_accumulate(first, last, std::move(value_), op_);
+        } else {
+            for (; first != last; ++first)
+                push(*first);
+        }
+    }
+
+    /* Appends the values o has seen after the ones seen here */
+    void merge(const nuo_stream_reducer& o) {
+        if (o.count_ == 0)
+            return;
+        value_ = count_ == 0 ? o.value_ : op_(std::move(value_), o.value_);
+        count_ += o.count_;
+    }
+
+    void clear() noexcept { count_ = 0; }
+};
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef NUOSTL_CORE_ALLOCATORS_NUO_MALLOC_ALLOCATOR_HPP_
+#define NUOSTL_CORE_ALLOCATORS_NUO_MALLOC_ALLOCATOR_HPP_
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace nuostl {
+
+/*
+ * Allocator on top of malloc/free. Besides the standard interface it has
+ * reallocate(), which containers of trivially copyable elements use to
+ * grow a buffer in place (or let the C library move it, e.g. via mremap)
+ * instead of allocate + copy + deallocate.
+ */
+template<typename T>
+class nuo_malloc_allocator {
+    static_assert(alignof(T) <= alignof(max_align_t),
+        "nuo_malloc_allocator: over-aligned types are not supported");
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    constexpr nuo_malloc_allocator() noexcept = default;
+
+    template<typename U>
+    constexpr nuo_malloc_allocator(const nuo_malloc_allocator<U>&) noexcept {}
+
+    T* allocate(size_type n) {
+        if (n > max_size())
+            throw std::bad_array_new_length();
+        void* p = malloc(n * sizeof(T));
+        if (p == nullptr)
+            throw std::bad_alloc();
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_type) noexcept {
+        free(p);
+    }
+
+    /* Resize the block at p to new_n elements, the first min(old_n, new_n) are kept */
+    T* reallocate(T* p, size_type /* old_n */, size_type new_n)
+        requires std::is_trivially_copyable_v<T>
+    {
+        if (new_n > max_size())
+            throw std::bad_array_new_length();
+        void* q = realloc(p, new_n * sizeof(T));
+        if (q == nullptr)
+            throw std::bad_alloc();
+        return static_cast<T*>(q);
+    }
+
+    constexpr size_type max_size() const noexcept {
+        return std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+};
+
+template<typename T, typename U>
+constexpr bool operator==(const nuo_malloc_allocator<T>&,
+                          const nuo_malloc_allocator<U>&) noexcept {
+    return true;
+}
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,169 @@
+#ifndef NUOSTL_CORE_ALLOCATORS_NUO_NODE_POOL_HPP_
+#define NUOSTL_CORE_ALLOCATORS_NUO_NODE_POOL_HPP_
+
+#include <stddef.h>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "./nuo_malloc_allocator.hpp"
+
+namespace nuostl {
+
+/*
+ * Fixed-size block pool for the nodes of linked containers. Blocks are
+ * carved out of slabs taken from Alloc, growing geometrically from 16 to
+ * 4096 blocks per slab, and freed blocks go on an intrusive free list, so
+ * allocate() and deallocate() are a few pointer moves with no call into
+ * the allocator. reserve(n) makes the next n allocations come from at
+ * most one new slab. Memory goes back to Alloc only when the pool is
+ * destroyed.
+ *
+ * Containers sharing one pool can move nodes between each other: a node
+ * allocated by one is freed by another. The pool must outlive every
+ * container using it, and moving it is only safe while none does. Not
+ * thread-safe.
+ */
+template<typename Node, typename Alloc = nuo_malloc_allocator<Node>>
+class nuo_node_pool {
+private:
+    struct slab_header {
+        void* prev;
+        size_t count;
+    };
+
+    union block {
+        block* next;
+        slab_header slab;
+        alignas(Node) unsigned char bytes[sizeof(Node)];
+    };
+
+    using block_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<block>;
+    using block_traits = std::allocator_traits<block_alloc>;
+
+    static constexpr size_t min_slab = 16;
+    static constexpr size_t max_slab = 4096;
+
+    [[no_unique_address]] block_alloc alloc_;
+    block* free_ = nullptr;
+    block* fresh_ = nullptr;
+    block* fresh_end_ = nullptr;
+    block* slabs_ = nullptr;
+    size_t free_count_ = 0;
+    size_t capacity_ = 0;
+    size_t next_slab_ = min_slab;
+
+    /* New slab of count blocks, the rest of the current one goes to the free list */
+    void grow(size_t count) {
+        block* s = block_traits::allocate(alloc_, count + 1);
+        s->slab = slab_header{slabs_, count + 1};
+        slabs_ = s;
+        while (fresh_ != fresh_end_)
+            deallocate(fresh_++);
+        fresh_ = s + 1;
+        fresh_end_ = s + 1 + count;
+        capacity_ += count;
+        if (next_slab_ < max_slab)
+            next_slab_ *= 2;
+    }
+
+    void release() noexcept {
+        while (slabs_ != nullptr) {
+            block* s = slabs_;
+            slabs_ = static_cast<block*>(s->slab.prev);
+            block_traits::deallocate(alloc_, s, s->slab.count);
+        }
+        free_ = fresh_ = fresh_end_ = nullptr;
+        free_count_ = capacity_ = 0;
+        next_slab_ = min_slab;
+    }
+
+    void steal(nuo_node_pool& o) noexcept {
+        free_ = std::exchange(o.free_, nullptr);
+        fresh_ = std::exchange(o.fresh_, nullptr);
+        fresh_end_ = std::exchange(o.fresh_end_, nullptr);
+        slabs_ = std::exchange(o.slabs_, nullptr);
+        free_count_ = std::exchange(o.free_count_, 0);
+        capacity_ = std::exchange(o.capacity_, 0);
+        next_slab_ = std::exchange(o.next_slab_, min_slab);
+    }
+public:
+    using node_type = Node;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+
+    /* Constructor */
+    nuo_node_pool() noexcept = default;
+
+    explicit nuo_node_pool(const Alloc& alloc) noexcept : alloc_(alloc) {}
+
+    /* Destructor */
+    ~nuo_node_pool() {
+        release();
+    }
+
+    nuo_node_pool(const nuo_node_pool&) = delete;
+    nuo_node_pool& operator=(const nuo_node_pool&) = delete;
+
+    nuo_node_pool(nuo_node_pool&& o) noexcept : alloc_(o.alloc_) {
+        steal(o);
+    }
+
+    nuo_node_pool& operator=(nuo_node_pool&& o) noexcept {
+        if (this != &o) {
+            release();
+            alloc_ = o.alloc_;
+            steal(o);
+        }
+        return *this;
+    }
+
+    /* Uninitialized storage for one Node */
+    void* allocate() {
+        if (free_ != nullptr) {
+            block* b = free_;
+            free_ = b->next;
+            free_count_--;
+            return b;
+        }
+        if (fresh_ == fresh_end_)
+            grow(next_slab_);
+        return fresh_++;
+    }
+
+    /* p must come from allocate() of this pool, the Node already destroyed */
+    void deallocate(void* p) noexcept {
+        block* b = static_cast<block*>(p);
+        b->next = free_;
+        free_ = b;
+        free_count_++;
+    }
+
+    /* Make the next n allocations succeed with at most this one slab allocation */
+    void reserve(size_type n) {
+        size_type have = available();
+        if (have < n)
+            grow(n - have > next_slab_ ? n - have : next_slab_);
+    }
+
+    /* Blocks that can be handed out without a new slab */
+    size_type available() const noexcept {
+        return free_count_ + static_cast<size_type>(fresh_end_ - fresh_);
+    }
+
+    /* Blocks in all slabs, handed out or not */
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    friend void swap(nuo_node_pool& a, nuo_node_pool& b) noexcept {
+        nuo_node_pool t(std::move(a));
+        a = std::move(b);
+        b = std::move(t);
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
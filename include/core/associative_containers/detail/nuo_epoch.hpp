@@ -0,0 +1,189 @@
+#ifndef NUOSTL_CORE_ASSOCIATIVE_CONTAINERS_DETAIL_NUO_EPOCH_HPP_
+#define NUOSTL_CORE_ASSOCIATIVE_CONTAINERS_DETAIL_NUO_EPOCH_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+/*
+ * Epoch-based reclamation (Fraser 2004) for the lock-free readers of the
+ * concurrent containers. A reader pins the current global epoch for the
+ * length of a lookup; a writer that unlinks a node retires it tagged
+ * with the epoch of the unlinking. The global epoch only advances once
+ * every pinned thread has caught up with it, so when it is two past the
+ * tag, no reader that could have seen the node is still running and the
+ * node is freed.
+ *
+ * There is one domain per process. Each thread owns a record, taken
+ * from a lock-free list on first use and handed back when the thread
+ * exits; nodes a thread retired but could not free yet stay with the
+ * record for its next owner. Pinning and the scan of the pins are
+ * seq_cst: the pin must be visible before the reader's first load of a
+ * shared pointer.
+ */
+
+namespace nuostl {
+namespace detail {
+
+class nuo_epoch_domain {
+private:
+    struct retired {
+        void* p;
+        void (*del)(void*);
+        uint64_t epoch;
+    };
+
+    struct alignas(64) record {
+        std::atomic<uint64_t> epoch{0};     /* 0 when not pinned */
+        std::atomic<bool> owned{true};
+        record* next = nullptr;             /* fixed once published */
+        unsigned nest = 0;                  /* owner only */
+        std::vector<retired> garbage;       /* owner only */
+    };
+
+    struct holder {
+        record* r = nullptr;
+
+        ~holder() {
+            if (r != nullptr) {
+                r->nest = 0;
+                r->epoch.store(0, std::memory_order_seq_cst);
+                r->owned.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    /* Retirements between attempts to advance and free */
+    static constexpr size_t collect_every = 64;
+
+    std::atomic<uint64_t> global_{1};
+    std::atomic<record*> head_{nullptr};
+
+    record* acquire() {
+        for (record* r = head_.load(std::memory_order_acquire); r != nullptr; r = r->next) {
+            if (!r->owned.load(std::memory_order_relaxed) &&
+                !r->owned.exchange(true, std::memory_order_acquire))
+                return r;
+        }
+        record* r = new record;
+        record* h = head_.load(std::memory_order_relaxed);
+        do {
+            r->next = h;
+        } while (!head_.compare_exchange_weak(h, r, std::memory_order_release,
+                                              std::memory_order_relaxed));
+        return r;
+    }
+
+    record* local() {
+        thread_local holder h;
+        if (h.r == nullptr)
+            h.r = acquire();
+        return h.r;
+    }
+
+    /* Advances the global epoch if every pinned thread has seen it */
+    bool try_advance() {
+        uint64_t g = global_.load(std::memory_order_seq_cst);
+        for (record* r = head_.load(std::memory_order_acquire); r != nullptr; r = r->next) {
+            uint64_t e = r->epoch.load(std::memory_order_seq_cst);
+            if (e != 0 && e != g)
+                return false;
+        }
+        return global_.compare_exchange_strong(g, g + 1, std::memory_order_seq_cst);
+    }
+
+    /* Frees what r retired at least two epochs ago */
+    void free_safe(record* r) {
+        const uint64_t g = global_.load(std::memory_order_seq_cst);
+        size_t out = 0;
+        for (size_t i = 0; i < r->garbage.size(); i++) {
+            retired x = r->garbage[i];
+            if (x.epoch + 2 <= g)
+                x.del(x.p);
+            else
+                r->garbage[out++] = x;
+        }
+        r->garbage.resize(out);
+    }
+
+    nuo_epoch_domain() = default;
+public:
+    nuo_epoch_domain(const nuo_epoch_domain&) = delete;
+    nuo_epoch_domain& operator=(const nuo_epoch_domain&) = delete;
+
+    /* Threads are gone by now: everything left can be freed */
+    ~nuo_epoch_domain() {
+        record* r = head_.load(std::memory_order_acquire);
+        while (r != nullptr) {
+            for (const retired& x : r->garbage)
+                x.del(x.p);
+            record* next = r->next;
+            delete r;
+            r = next;
+        }
+    }
+
+    static nuo_epoch_domain& instance() {
+        static nuo_epoch_domain d;
+        return d;
+    }
+
+    /* Pins the current epoch; nests. Returns the handle for leave() */
+    void* enter() {
+        record* r = local();
+        if (r->nest++ == 0)
+            r->epoch.store(global_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        return r;
+    }
+
+    /* The reader's loads are done once the unpin is seen: release suffices */
+    void leave(void* handle) noexcept {
+        record* r = static_cast<record*>(handle);
+        if (--r->nest == 0)
+            r->epoch.store(0, std::memory_order_release);
+    }
+
+    /* Frees p with del(p) once no reader can still hold it */
+    void retire(void* p, void (*del)(void*)) {
+        record* r = local();
+        r->garbage.push_back(retired{p, del, global_.load(std::memory_order_seq_cst)});
+        if (r->garbage.size() % collect_every == 0)
+            collect();
+    }
+
+    /* Tries to advance the epoch and frees this thread's safe retirements */
+    void collect() {
+        try_advance();
+        free_safe(local());
+    }
+
+    /* This thread's retirements not freed yet */
+    size_t pending() {
+        return local()->garbage.size();
+    }
+};
+
+/* Pins the epoch for the lifetime of the guard */
+class nuo_epoch_guard {
+private:
+    nuo_epoch_domain& d_;
+    void* r_;
+public:
+    nuo_epoch_guard() : d_(nuo_epoch_domain::instance()), r_(d_.enter()) {}
+    ~nuo_epoch_guard() { d_.leave(r_); }
+
+    nuo_epoch_guard(const nuo_epoch_guard&) = delete;
+    nuo_epoch_guard& operator=(const nuo_epoch_guard&) = delete;
+};
+
+template<typename T>
+void nuo_epoch_retire(T* p) {
+    nuo_epoch_domain::instance().retire(p, [](void* q) { delete static_cast<T*>(q); });
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
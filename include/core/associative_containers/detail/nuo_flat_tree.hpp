@@ -0,0 +1,153 @@
+#ifndef NUOSTL_CORE_ASSOCIATIVE_CONTAINERS_DETAIL_NUO_FLAT_TREE_HPP_
+#define NUOSTL_CORE_ASSOCIATIVE_CONTAINERS_DETAIL_NUO_FLAT_TREE_HPP_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../../algorithms/nuo_binary_search.hpp"
+
+/*
+ * The sorted array machinery shared by nuo_flat_set and nuo_flat_map:
+ * normalizing a bulk of keys (sort once, drop repeats keeping the first)
+ * and merging a normalized batch into the sorted array in one backward
+ * pass. Values, when there are any, travel in parallel vectors.
+ */
+
+namespace nuostl {
+
+/* Tags input that is already sorted and free of repeated keys */
+struct nuo_sorted_unique_t {
+    explicit nuo_sorted_unique_t() = default;
+};
+
+inline constexpr nuo_sorted_unique_t nuo_sorted_unique{};
+
+namespace detail {
+
+/* Sorts items by key(item), stable, and keeps the first of equal keys */
+template<typename T, typename Key, typename Compare>
+void nuo_flat_sort_unique(std::vector<T>& items, Key key, Compare& comp) {
+    auto before = [&](const T& a, const T& b) { return comp(key(a), key(b)); };
+    if (!std::is_sorted(items.begin(), items.end(), before))
+        std::stable_sort(items.begin(), items.end(), before);
+    auto equal = [&](const T& a, const T& b) { return !comp(key(a), key(b)); };
+    items.erase(std::unique(items.begin(), items.end(), equal), items.end());
+}
+
+/* Moves out the elements of v where keep[i] is false */
+template<typename T>
+void nuo_flat_compact(std::vector<T>& v, const std::vector<bool>& keep) {
+    size_t out = 0;
+    for (size_t i = 0; i < v.size(); i++) {
+        if (keep[i]) {
+            if (out != i)
+                v[out] = std::move(v[i]);
+            out++;
+        }
+    }
+    v.erase(v.begin() + static_cast<ptrdiff_t>(out), v.end());
+}
+
+/*
+ * Drops from the sorted, unique batch bk (and the values bv... that go
+ * with it) the keys already in keys: a binary search per key when the
+ * batch is small next to keys, a merge walk otherwise.
+ */
+template<typename K, typename Compare, typename... Values>
+void nuo_flat_drop_present(const std::vector<K>& keys, std::vector<K>& bk, Compare& comp,
+                           Values&... bv) {
+    std::vector<bool> keep(bk.size(), true);
+    bool any = false;
+    if (bk.size() * (std::bit_width(keys.size()) + 1) < keys.size()) {
+        for (size_t j = 0; j < bk.size(); j++) {
+            auto it = nuo_lower_bound(keys.begin(), keys.end(), bk[j], comp);
+            if (it != keys.end() && !comp(bk[j], *it))
+                keep[j] = false, any = true;
+        }
+    } else {
+        size_t i = 0;
+        for (size_t j = 0; j < bk.size(); j++) {
+            while (i < keys.size() && comp(keys[i], bk[j]))
+                i++;
+            if (i < keys.size() && !comp(bk[j], keys[i]))
+                keep[j] = false, any = true;
+        }
+    }
+    if (any) {
+        nuo_flat_compact(bk, keep);
+        (nuo_flat_compact(bv, keep), ...);
+    }
+}
+
+/* Grows v by batch.size() slots at the end and hands the batch back */
+template<typename T>
+std::vector<T> nuo_flat_open_slots(std::vector<T>& v, std::vector<T>& batch) {
+    const size_t n = v.size();
+    v.insert(v.end(), std::make_move_iterator(batch.begin()),
+             std::make_move_iterator(batch.end()));
+    for (size_t j = 0; j < batch.size(); j++)
+        batch[j] = std::move(v[n + j]);
+    return std::move(batch);
+}
+
+/*
+ * Merges the sorted batch bk, none of whose keys is in keys, into keys.
+ * Values follow through shift(to, from), a move within the array, and
+ * place(to, j), the j-th batch value landing. Merging runs backward from
+ * the end and stops once the batch is placed, so appending keys above
+ * the current maximum moves nothing that is already there.
+ */
+template<typename K, typename Compare, typename Shift, typename Place>
+void nuo_flat_merge(std::vector<K>& keys, std::vector<K>& bk, Compare& comp, Shift shift,
+                    Place place) {
+    size_t i = keys.size();
+    size_t j = bk.size();
+    if (j == 0)
+        return;
+    std::vector<K> b = nuo_flat_open_slots(keys, bk);
+    for (size_t k = i + j; j > 0;) {
+        k--;
+        if (i > 0 && comp(b[j - 1], keys[i - 1])) {
+            i--;
+            keys[k] = std::move(keys[i]);
+            shift(k, i);
+        } else {
+            j--;
+            keys[k] = std::move(b[j]);
+            place(k, j);
+        }
+    }
+}
+
+/*
+ * hit(j, i) for every q[j] found at keys[i], in order of j. The searches
+ * run interleaved (nuo_lower_bound_groups) so their misses overlap.
+ */
+template<typename K, typename Q, typename Compare, typename Hit>
+void nuo_flat_find_batch(const std::vector<K>& keys, std::span<const Q> q, Compare& comp,
+                         Hit hit) {
+    nuo_lower_bound_groups(
+        keys.begin(), static_cast<ptrdiff_t>(keys.size()), q.begin(), q.size(), comp,
+        [&](size_t j, typename std::vector<K>::const_iterator it) {
+            if (it != keys.end() && !comp(q[j], *it))
+                hit(j, static_cast<size_t>(it - keys.begin()));
+        });
+}
+
+inline void nuo_flat_check_batch(size_t keys, size_t out) {
+    if (out < keys)
+        throw std::length_error("nuo_flat: batch output is shorter than the keys");
+}
+
+}   /* namespace detail */
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,385 @@
+#ifndef NUOSTL_CORE_ASSOCIATIVE_CONTAINERS_NUO_CONCURRENT_UNORDERED_MAP_HPP_
+#define NUOSTL_CORE_ASSOCIATIVE_CONTAINERS_NUO_CONCURRENT_UNORDERED_MAP_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+#include "../data_types/nuo_optional.hpp"
+#include "../function_objects/nuo_functional.hpp"
+#include "../function_objects/nuo_hash.hpp"
+#include "./detail/nuo_epoch.hpp"
+
+/*
+ * Hash map shared by many threads. Keys are spread over a power of two
+ * shards by the high bits of their hash; each shard is a chained table
+ * with its own mutex (lock striping), so writers to different shards
+ * never meet, and readers take no lock at all.
+ *
+ * Readers walk the chains through acquire loads inside an epoch guard
+ * (detail::nuo_epoch_domain). Nodes are never modified once published:
+ * an update builds a new node, runs the update on its value there, and
+ * swings the one link that pointed at the old node, which is retired to
+ * the epoch domain and freed once no reader can still be on it. A
+ * reader therefore sees either the old or the new value, whole, and no
+ * read races a write, which also keeps the map clean under
+ * ThreadSanitizer. Growing a shard copies its nodes into a table twice
+ * as large and retires the old table with its nodes.
+ *
+ * Lookups hand out copies (find) or run a visitor on the value under the
+ * guard (visit); no reference outlives the call. K and V must be copy
+ * constructible.
+ */
+
+namespace nuostl {
+
+template<typename K, typename V, typename Hash = nuo_hash<K>,
+         typename KeyEqual = nuo_equal_to<K>>
+class nuo_concurrent_unordered_map {
+    static_assert(std::is_copy_constructible_v<K> && std::is_copy_constructible_v<V>,
+                  "nuo_concurrent_unordered_map: K and V must be copy constructible");
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using size_type = size_t;
+
+private:
+    struct node {
+        const uint64_t hash;
+        const K key;
+        V value;                    /* written only before the node is published */
+        std::atomic<node*> next;
+
+        template<typename KK, typename... Args>
+        node(uint64_t h, KK&& k, node* n, Args&&... args)
+            : hash(h), key(std::forward<KK>(k)), value(std::forward<Args>(args)...), next(n) {}
+    };
+
+    struct table {
+        size_t mask;
+        std::unique_ptr<std::atomic<node*>[]> buckets;
+
+        explicit table(size_t n) : mask(n - 1), buckets(new std::atomic<node*>[n]()) {}
+
+        /* Frees the table and every node still linked in it */
+        static void destroy(table* t) {
+            for (size_t i = 0; i <= t->mask; i++) {
+                node* n = t->buckets[i].load(std::memory_order_relaxed);
+                while (n != nullptr) {
+                    node* next = n->next.load(std::memory_order_relaxed);
+                    delete n;
+                    n = next;
+                }
+            }
+            delete t;
+        }
+    };
+
+    struct alignas(64) shard {
+        std::mutex lock;
+        std::atomic<table*> tab{nullptr};
+        std::atomic<size_t> size{0};    /* written under lock */
+    };
+
+    /* Bits below shard_shift pick the bucket, the ones above the shard */
+    static constexpr unsigned shard_shift = 40;
+    static constexpr size_t initial_buckets = 8;
+
+    std::unique_ptr<shard[]> shards_;
+    size_t shard_mask_;
+    [[no_unique_address]] Hash hash_;
+    [[no_unique_address]] KeyEqual eq_;
+
+    template<typename Q>
+    uint64_t hash_of(const Q& key) const {
+        uint64_t h = static_cast<uint64_t>(hash_(key));
+        if constexpr (!nuo_avalanching_hash<Hash>)
+            h = nuo_hash_mix(h);
+        return h;
+    }
+
+    shard& shard_of(uint64_t h) const noexcept {
+        return shards_[(h >> shard_shift) & shard_mask_];
+    }
+
+    /* Reader side: caller holds an epoch guard */
+    const node* find_node(const shard& s, uint64_t h, const K& key) const {
+        const table* t = s.tab.load(std::memory_order_acquire);
+        const node* n = t->buckets[h & t->mask].load(std::memory_order_acquire);
+        for (; n != nullptr; n = n->next.load(std::memory_order_acquire)) {
+            if (n->hash == h && eq_(n->key, key))
+                return n;
+        }
+        return nullptr;
+    }
+
+    /* Writer side, under s.lock: the link that points at key's node, and the node */
+    struct slot {
+        std::atomic<node*>* link;
+        node* n;
+    };
+
+    slot locate(table* t, uint64_t h, const K& key) const {
+        std::atomic<node*>* link = &t->buckets[h & t->mask];
+        for (node* n = link->load(std::memory_order_relaxed); n != nullptr;
+             n = link->load(std::memory_order_relaxed)) {
+            if (n->hash == h && eq_(n->key, key))
+                return slot{link, n};
+            link = &n->next;
+        }
+        return slot{&t->buckets[h & t->mask], nullptr};
+    }
+
+    template<typename... Args>
+    void link_new(shard& s, table* t, uint64_t h, const K& key, Args&&... args) {
+        std::atomic<node*>& b = t->buckets[h & t->mask];
+        node* n = new node(h, key, b.load(std::memory_order_relaxed), std::forward<Args>(args)...);
+        b.store(n, std::memory_order_release);
+        const size_t size = s.size.load(std::memory_order_relaxed) + 1;
+        s.size.store(size, std::memory_order_relaxed);
+        if (size > t->mask + 1)
+            grow(s, t);
+    }
+
+    /* Publishes n in place of sl.n and retires sl.n */
+    void replace(const slot& sl, node* n) {
+        n->next.store(sl.n->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        sl.link->store(n, std::memory_order_release);
+        detail::nuo_epoch_retire(sl.n);
+    }
+
+    void unlink(shard& s, const slot& sl) {
+        sl.link->store(sl.n->next.load(std::memory_order_relaxed), std::memory_order_release);
+        detail::nuo_epoch_retire(sl.n);
+        s.size.store(s.size.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    }
+
+    /*
+     * Copies the shard into a table twice as large; readers keep the old
+     * one. If a copy throws the shard stays as it is, overfull, and the
+     * next insert tries again.
+     */
+    void grow(shard& s, table* t) noexcept {
+        table* g = nullptr;
+        try {
+            g = new table(2 * (t->mask + 1));
+            for (size_t i = 0; i <= t->mask; i++) {
+                node* n = t->buckets[i].load(std::memory_order_relaxed);
+                for (; n != nullptr; n = n->next.load(std::memory_order_relaxed)) {
+                    std::atomic<node*>& b = g->buckets[n->hash & g->mask];
+                    b.store(new node(n->hash, n->key, b.load(std::memory_order_relaxed), n->value),
+                            std::memory_order_relaxed);
+                }
+            }
+        } catch (...) {
+            if (g != nullptr)
+                table::destroy(g);
+            return;
+        }
+        s.tab.store(g, std::memory_order_release);
+        retire_table(t);
+    }
+
+    static void retire_table(table* t) {
+        detail::nuo_epoch_domain::instance().retire(
+            t, [](void* p) { table::destroy(static_cast<table*>(p)); });
+    }
+public:
+    /* Constructor */
+    explicit nuo_concurrent_unordered_map(size_t shards = 64, const Hash& hash = Hash(),
+                                          const KeyEqual& eq = KeyEqual())
+        : shard_mask_(std::bit_ceil(shards == 0 ? size_t(1) : shards) - 1), hash_(hash), eq_(eq) {
+        /* The domain must outlive any map, static ones included */
+        detail::nuo_epoch_domain::instance();
+        shards_.reset(new shard[shard_mask_ + 1]);
+        for (size_t i = 0; i <= shard_mask_; i++)
+            shards_[i].tab.store(new table(initial_buckets), std::memory_order_relaxed);
+    }
+
+    nuo_concurrent_unordered_map(const nuo_concurrent_unordered_map&) = delete;
+    nuo_concurrent_unordered_map& operator=(const nuo_concurrent_unordered_map&) = delete;
+
+    /* Destructor: no other thread may still be using the map */
+    ~nuo_concurrent_unordered_map() {
+        for (size_t i = 0; i <= shard_mask_; i++)
+            table::destroy(shards_[i].tab.load(std::memory_order_relaxed));
+    }
+
+    /* Capacity */
+    /* Exact when no writer runs, a recent count otherwise */
+    size_type size() const noexcept {
+        size_t n = 0;
+        for (size_t i = 0; i <= shard_mask_; i++)
+            n += shards_[i].size.load(std::memory_order_relaxed);
+        return n;
+    }
+
+    bool empty() const noexcept { return size() == 0; }
+    size_type shard_count() const noexcept { return shard_mask_ + 1; }
+
+    /* Lookup, lock-free */
+    /* Runs f(const V&) on key's value; false when key is absent */
+    template<typename F>
+    bool visit(const K& key, F&& f) const {
+        const uint64_t h = hash_of(key);
+        detail::nuo_epoch_guard g;
+        const node* n = find_node(shard_of(h), h, key);
+        if (n == nullptr)
+            return false;
+        std::forward<F>(f)(n->value);
+        return true;
+    }
+
+    nuo_optional<V> find(const K& key) const {
+        nuo_optional<V> r;
+        visit(key, [&](const V& v) { r.emplace(v); });
+        return r;
+    }
+
+    bool contains(const K& key) const {
+        const uint64_t h = hash_of(key);
+        detail::nuo_epoch_guard g;
+        return find_node(shard_of(h), h, key) != nullptr;
+    }
+
+    size_type count(const K& key) const { return contains(key); }
+
+    /*
+     * f(const K&, const V&) on every entry. Each shard is walked as one
+     * lock-free snapshot; entries changed meanwhile may or may not show.
+     */
+    template<typename F>
+    void for_each(F f) const {
+        detail::nuo_epoch_guard g;
+        for (size_t i = 0; i <= shard_mask_; i++) {
+            const table* t = shards_[i].tab.load(std::memory_order_acquire);
+            for (size_t b = 0; b <= t->mask; b++) {
+                const node* n = t->buckets[b].load(std::memory_order_acquire);
+                for (; n != nullptr; n = n->next.load(std::memory_order_acquire))
+                    f(n->key, n->value);
+            }
+        }
+    }
+
+    /* Modifiers, under the shard's lock */
+    /* Inserts V(args...) if key is absent; true if it did */
+    template<typename... Args>
+    bool try_emplace(const K& key, Args&&... args) {
+        const uint64_t h = hash_of(key);
+        shard& s = shard_of(h);
+        std::lock_guard<std::mutex> lk(s.lock);
+        table* t = s.tab.load(std::memory_order_relaxed);
+        if (locate(t, h, key).n != nullptr)
+            return false;
+        link_new(s, t, h, key, std::forward<Args>(args)...);
+        return true;
+    }
+
+    bool insert(const K& key, const V& value) { return try_emplace(key, value); }
+
+    /* Sets key's value; true if key was absent */
+    template<typename M>
+    bool insert_or_assign(const K& key, M&& m) {
+        const uint64_t h = hash_of(key);
+        shard& s = shard_of(h);
+        std::lock_guard<std::mutex> lk(s.lock);
+        table* t = s.tab.load(std::memory_order_relaxed);
+        slot sl = locate(t, h, key);
+        if (sl.n == nullptr) {
+            link_new(s, t, h, key, std::forward<M>(m));
+            return true;
+        }
+        replace(sl, new node(h, sl.n->key, nullptr, std::forward<M>(m)));
+        return false;
+    }
+
+    /*
+     * update(V&) on key's value, or inserts V(init) if key is absent;
+     * true if it inserted. The update runs on the copy in the new node,
+     * under the shard's lock, so concurrent upserts of one key compose.
+     */
+    template<typename U, typename F>
+    bool upsert(const K& key, U&& init, F&& update) {
+        const uint64_t h = hash_of(key);
+        shard& s = shard_of(h);
+        std::lock_guard<std::mutex> lk(s.lock);
+        table* t = s.tab.load(std::memory_order_relaxed);
+        slot sl = locate(t, h, key);
+        if (sl.n == nullptr) {
+            link_new(s, t, h, key, std::forward<U>(init));
+            return true;
+        }
+        std::unique_ptr<node> n(new node(h, sl.n->key, nullptr, sl.n->value));
+        std::forward<F>(update)(n->value);
+        replace(sl, n.release());
+        return false;
+    }
+
+    /*
+     * f(nuo_optional<V>&) sees key's value, or an empty optional; what it
+     * leaves there becomes key's value, an empty optional erases key.
+     * Returns whether key is present afterwards.
+     */
+    template<typename F>
+    bool compute(const K& key, F&& f) {
+        const uint64_t h = hash_of(key);
+        shard& s = shard_of(h);
+        std::lock_guard<std::mutex> lk(s.lock);
+        table* t = s.tab.load(std::memory_order_relaxed);
+        slot sl = locate(t, h, key);
+        nuo_optional<V> v;
+        if (sl.n != nullptr)
+            v.emplace(sl.n->value);
+        std::forward<F>(f)(v);
+        if (!v.has_value()) {
+            if (sl.n != nullptr)
+                unlink(s, sl);
+            return false;
+        }
+        if (sl.n == nullptr)
+            link_new(s, t, h, key, std::move(*v));
+        else
+            replace(sl, new node(h, sl.n->key, nullptr, std::move(*v)));
+        return true;
+    }
+
+    bool erase(const K& key) {
+        const uint64_t h = hash_of(key);
+        shard& s = shard_of(h);
+        std::lock_guard<std::mutex> lk(s.lock);
+        slot sl = locate(s.tab.load(std::memory_order_relaxed), h, key);
+        if (sl.n == nullptr)
+            return false;
+        unlink(s, sl);
+        return true;
+    }
+
+    /* Empties one shard at a time */
+    void clear() {
+        for (size_t i = 0; i <= shard_mask_; i++) {
+            shard& s = shards_[i];
+            table* fresh = new table(initial_buckets);
+            std::lock_guard<std::mutex> lk(s.lock);
+            table* t = s.tab.load(std::memory_order_relaxed);
+            s.tab.store(fresh, std::memory_order_release);
+            s.size.store(0, std::memory_order_relaxed);
+            retire_table(t);
+        }
+    }
+
+    /* Observers */
+    hasher hash_function() const { return hash_; }
+    key_equal key_eq() const { return eq_; }
+};
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,536 @@
+#ifndef NUOSTL_CORE_ASSOCIATIVE_CONTAINERS_NUO_FLAT_MAP_HPP_
+#define NUOSTL_CORE_ASSOCIATIVE_CONTAINERS_NUO_FLAT_MAP_HPP_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../algorithms/nuo_binary_search.hpp"
+#include "../data_types/nuo_pair.hpp"
+#include "../function_objects/nuo_functional.hpp"
+#include "./detail/nuo_flat_tree.hpp"
+
+/*
+ * Sorted map in two parallel arrays, similar to std::flat_map: the keys
+ * in one vector, the values at the same positions in another. A lookup
+ * is a branchless binary search (nuo_lower_bound) over the keys alone,
+ * so every cache line it touches holds only keys, and the value is read
+ * once at the end.
+ *
+ * Iterators are proxies: dereferencing yields nuo_pair<const K&, V&>
+ * built from the two arrays, and -> works on that pair. They are random
+ * access but do not model std::random_access_iterator, since the
+ * reference is not a real reference to value_type.
+ *
+ * Construction from a range sorts once and drops repeated keys (the
+ * first one stays); a range insert sorts the new entries and merges them
+ * in one backward pass. Input tagged nuo_sorted_unique skips the sort.
+ * An insert or erase of a single key shifts the tail of both arrays.
+ *
+ * find_batch and contains_batch look up many keys in one call with the
+ * binary searches interleaved, so on maps larger than the cache the
+ * misses of a dozen lookups overlap.
+ */
+
+namespace nuostl {
+
+template<typename K, typename V, typename Compare = nuo_less<K>>
+class nuo_flat_map {
+    static_assert(!std::is_same_v<V, bool>,
+                  "nuo_flat_map: V = bool would store the values in std::vector<bool>");
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = nuo_pair<K, V>;
+    using key_compare = Compare;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using key_container_type = std::vector<K>;
+    using mapped_container_type = std::vector<V>;
+
+    template<bool Const>
+    class nuo_flat_map_iterator {
+        friend class nuo_flat_map;
+        using VP = std::conditional_t<Const, const V*, V*>;
+
+        const K* k_ = nullptr;
+        VP v_ = nullptr;
+
+        nuo_flat_map_iterator(const K* k, VP v) noexcept : k_(k), v_(v) {}
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = nuo_pair<K, V>;
+        using difference_type = ptrdiff_t;
+        using reference = nuo_pair<const K&, std::conditional_t<Const, const V&, V&>>;
+
+        struct pointer {
+            reference r;
+            const reference* operator->() const noexcept { return &r; }
+        };
+
+        nuo_flat_map_iterator() = default;
+
+        /* iterator converts to const_iterator */
+        template<bool C = Const>
+            requires C
+        nuo_flat_map_iterator(const nuo_flat_map_iterator<false>& o) noexcept
+            : k_(o.k_), v_(o.v_) {}
+
+        reference operator*() const { return reference(*k_, *v_); }
+        pointer operator->() const { return pointer{**this}; }
+        reference operator[](difference_type n) const { return reference(k_[n], v_[n]); }
+
+        nuo_flat_map_iterator& operator++() noexcept { ++k_, ++v_; return *this; }
+        nuo_flat_map_iterator& operator--() noexcept { --k_, --v_; return *this; }
+        nuo_flat_map_iterator operator++(int) noexcept { auto t = *this; ++*this; return t; }
+        nuo_flat_map_iterator operator--(int) noexcept { auto t = *this; --*this; return t; }
+
+        nuo_flat_map_iterator& operator+=(difference_type n) noexcept {
+            k_ += n, v_ += n;
+            return *this;
+        }
+
+        nuo_flat_map_iterator& operator-=(difference_type n) noexcept { return *this += -n; }
+
+        friend nuo_flat_map_iterator operator+(nuo_flat_map_iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend nuo_flat_map_iterator operator+(difference_type n, nuo_flat_map_iterator it) noexcept {
+            return it += n;
+        }
+
+        friend nuo_flat_map_iterator operator-(nuo_flat_map_iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const nuo_flat_map_iterator& a,
+                                         const nuo_flat_map_iterator& b) noexcept {
+            return a.k_ - b.k_;
+        }
+
+        friend bool operator==(const nuo_flat_map_iterator& a,
+                               const nuo_flat_map_iterator& b) noexcept {
+            return a.k_ == b.k_;
+        }
+
+        friend auto operator<=>(const nuo_flat_map_iterator& a,
+                                const nuo_flat_map_iterator& b) noexcept {
+            return a.k_ <=> b.k_;
+        }
+
+        /* The key, without building the pair */
+        const K& key() const noexcept { return *k_; }
+    };
+
+    using iterator = nuo_flat_map_iterator<false>;
+    using const_iterator = nuo_flat_map_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    std::vector<K> keys_;
+    std::vector<V> values_;
+    [[no_unique_address]] Compare comp_;
+
+    iterator at_index(size_t i) noexcept {
+        return iterator(keys_.data() + i, values_.data() + i);
+    }
+
+    const_iterator at_index(size_t i) const noexcept {
+        return const_iterator(keys_.data() + i, values_.data() + i);
+    }
+
+    size_t index_of(const_iterator it) const noexcept {
+        return static_cast<size_t>(it.k_ - keys_.data());
+    }
+
+    template<typename Q>
+    size_t lower_index(const Q& k) const {
+        return static_cast<size_t>(nuo_lower_bound(keys_.begin(), keys_.end(), k, comp_) -
+                                   keys_.begin());
+    }
+
+    template<typename Q>
+    size_t upper_index(const Q& k) const {
+        return static_cast<size_t>(nuo_upper_bound(keys_.begin(), keys_.end(), k, comp_) -
+                                   keys_.begin());
+    }
+
+    /* The index of k, or size() */
+    template<typename Q>
+    size_t find_index(const Q& k) const {
+        size_t i = lower_index(k);
+        return (i < keys_.size() && !comp_(k, keys_[i])) ? i : keys_.size();
+    }
+
+    template<typename Q>
+    size_type erase_impl(const Q& k) {
+        size_t i = find_index(k);
+        if (i == keys_.size())
+            return 0;
+        keys_.erase(keys_.begin() + static_cast<ptrdiff_t>(i));
+        values_.erase(values_.begin() + static_cast<ptrdiff_t>(i));
+        return 1;
+    }
+
+    /* Inserts at i, which lower_index(key) returned */
+    template<typename KK, typename... Args>
+    iterator insert_at(size_t i, KK&& key, Args&&... args) {
+        const ptrdiff_t d = static_cast<ptrdiff_t>(i);
+        values_.emplace(values_.begin() + d, std::forward<Args>(args)...);
+        try {
+            keys_.emplace(keys_.begin() + d, std::forward<KK>(key));
+        } catch (...) {
+            values_.erase(values_.begin() + d);
+            throw;
+        }
+        return at_index(i);
+    }
+
+    template<typename KK, typename... Args>
+    nuo_pair<iterator, bool> try_emplace_impl(KK&& key, Args&&... args) {
+        size_t i = lower_index(key);
+        if (i < keys_.size() && !comp_(key, keys_[i]))
+            return nuo_pair<iterator, bool>(at_index(i), false);
+        iterator it = insert_at(i, std::forward<KK>(key), std::forward<Args>(args)...);
+        return nuo_pair<iterator, bool>(it, true);
+    }
+
+    template<typename KK, typename M>
+    nuo_pair<iterator, bool> insert_or_assign_impl(KK&& key, M&& m) {
+        size_t i = lower_index(key);
+        if (i < keys_.size() && !comp_(key, keys_[i])) {
+            values_[i] = std::forward<M>(m);
+            return nuo_pair<iterator, bool>(at_index(i), false);
+        }
+        iterator it = insert_at(i, std::forward<KK>(key), std::forward<M>(m));
+        return nuo_pair<iterator, bool>(it, true);
+    }
+
+    template<typename Self, typename It>
+    static std::span<nuo_pair<size_t, It>> find_batch_impl(Self& self, std::span<const K> keys,
+                                                           std::span<nuo_pair<size_t, It>> out) {
+        detail::nuo_flat_check_batch(keys.size(), out.size());
+        size_t hits = 0;
+        detail::nuo_flat_find_batch(self.keys_, keys, self.comp_, [&](size_t j, size_t i) {
+            out[hits++] = nuo_pair<size_t, It>(j, self.at_index(i));
+        });
+        return out.first(hits);
+    }
+
+    static auto key_of() {
+        return [](const value_type& p) -> const K& { return p.first; };
+    }
+
+    /* Sorts and splits a bulk of entries into the two arrays */
+    void build(std::vector<value_type>& items) {
+        detail::nuo_flat_sort_unique(items, key_of(), comp_);
+        split(items, keys_, values_);
+    }
+
+    static void split(std::vector<value_type>& items, std::vector<K>& ks, std::vector<V>& vs) {
+        ks.clear(), vs.clear();
+        ks.reserve(items.size()), vs.reserve(items.size());
+        for (value_type& p : items) {
+            ks.push_back(std::move(p.first));
+            vs.push_back(std::move(p.second));
+        }
+    }
+
+    /* items: sorted, without repeats */
+    void merge_batch(std::vector<value_type>& items) {
+        std::vector<K> bk;
+        std::vector<V> bv;
+        split(items, bk, bv);
+        detail::nuo_flat_drop_present(keys_, bk, comp_, bv);
+        if (bk.empty())
+            return;
+        std::vector<V> vb = detail::nuo_flat_open_slots(values_, bv);
+        detail::nuo_flat_merge(
+            keys_, bk, comp_,
+            [&](size_t to, size_t from) { values_[to] = std::move(values_[from]); },
+            [&](size_t to, size_t j) { values_[to] = std::move(vb[j]); });
+    }
+public:
+    /* Constructor */
+    nuo_flat_map() = default;
+
+    explicit nuo_flat_map(const Compare& comp) : comp_(comp) {}
+
+    template<std::input_iterator It>
+    nuo_flat_map(It first, It last, const Compare& comp = Compare()) : comp_(comp) {
+        std::vector<value_type> items(first, last);
+        build(items);
+    }
+
+    template<std::input_iterator It>
+    nuo_flat_map(nuo_sorted_unique_t, It first, It last, const Compare& comp = Compare())
+        : comp_(comp) {
+        std::vector<value_type> items(first, last);
+        split(items, keys_, values_);
+    }
+
+    nuo_flat_map(std::initializer_list<value_type> il, const Compare& comp = Compare())
+        : nuo_flat_map(il.begin(), il.end(), comp) {}
+
+    /* Adopts the entries, then sorts them */
+    explicit nuo_flat_map(std::vector<value_type> items, const Compare& comp = Compare())
+        : comp_(comp) {
+        build(items);
+    }
+
+    /* Adopts parallel arrays already sorted by key, without repeats */
+    nuo_flat_map(nuo_sorted_unique_t, std::vector<K> keys, std::vector<V> values,
+                 const Compare& comp = Compare())
+        : keys_(std::move(keys)), values_(std::move(values)), comp_(comp) {
+        if (keys_.size() != values_.size())
+            throw std::invalid_argument("nuo_flat_map: keys and values differ in size");
+    }
+
+    /* Iterators */
+    iterator begin() noexcept { return at_index(0); }
+    iterator end() noexcept { return at_index(keys_.size()); }
+    const_iterator begin() const noexcept { return at_index(0); }
+    const_iterator end() const noexcept { return at_index(keys_.size()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    /* Element access */
+    V& at(const K& key) {
+        size_t i = find_index(key);
+        if (i == keys_.size())
+            throw std::out_of_range("nuo_flat_map::at: key not found");
+        return values_[i];
+    }
+
+    const V& at(const K& key) const {
+        size_t i = find_index(key);
+        if (i == keys_.size())
+            throw std::out_of_range("nuo_flat_map::at: key not found");
+        return values_[i];
+    }
+
+    V& operator[](const K& key) { return try_emplace_impl(key).first->second; }
+    V& operator[](K&& key) { return try_emplace_impl(std::move(key)).first->second; }
+
+    /* Capacity */
+    bool empty() const noexcept { return keys_.empty(); }
+    size_type size() const noexcept { return keys_.size(); }
+    size_type max_size() const noexcept { return keys_.max_size(); }
+    size_type capacity() const noexcept { return keys_.capacity(); }
+
+    void reserve(size_type n) {
+        keys_.reserve(n);
+        values_.reserve(n);
+    }
+
+    void shrink_to_fit() {
+        keys_.shrink_to_fit();
+        values_.shrink_to_fit();
+    }
+
+    /* Modifiers */
+    nuo_pair<iterator, bool> insert(const value_type& p) { return try_emplace_impl(p.first, p.second); }
+
+    nuo_pair<iterator, bool> insert(value_type&& p) {
+        return try_emplace_impl(std::move(p.first), std::move(p.second));
+    }
+
+    template<typename KK, typename M>
+    nuo_pair<iterator, bool> emplace(KK&& key, M&& m) {
+        return try_emplace_impl(K(std::forward<KK>(key)), std::forward<M>(m));
+    }
+
+    template<typename... Args>
+    nuo_pair<iterator, bool> try_emplace(const K& key, Args&&... args) {
+        return try_emplace_impl(key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    nuo_pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+        return try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<typename M>
+    nuo_pair<iterator, bool> insert_or_assign(const K& key, M&& m) {
+        return insert_or_assign_impl(key, std::forward<M>(m));
+    }
+
+    template<typename M>
+    nuo_pair<iterator, bool> insert_or_assign(K&& key, M&& m) {
+        return insert_or_assign_impl(std::move(key), std::forward<M>(m));
+    }
+
+    /* Sorts the new entries and merges them in one pass; present keys keep their value */
+    template<std::input_iterator It>
+    void insert(It first, It last) {
+        std::vector<value_type> items(first, last);
+        detail::nuo_flat_sort_unique(items, key_of(), comp_);
+        merge_batch(items);
+    }
+
+    template<std::input_iterator It>
+    void insert(nuo_sorted_unique_t, It first, It last) {
+        std::vector<value_type> items(first, last);
+        merge_batch(items);
+    }
+
+    void insert(std::initializer_list<value_type> il) { insert(il.begin(), il.end()); }
+
+    iterator erase(const_iterator pos) {
+        size_t i = index_of(pos);
+        keys_.erase(keys_.begin() + static_cast<ptrdiff_t>(i));
+        values_.erase(values_.begin() + static_cast<ptrdiff_t>(i));
+        return at_index(i);
+    }
+
+    iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        const ptrdiff_t a = static_cast<ptrdiff_t>(index_of(first));
+        const ptrdiff_t b = static_cast<ptrdiff_t>(index_of(last));
+        keys_.erase(keys_.begin() + a, keys_.begin() + b);
+        values_.erase(values_.begin() + a, values_.begin() + b);
+        return at_index(static_cast<size_t>(a));
+    }
+
+    size_type erase(const K& key) { return erase_impl(key); }
+
+    template<typename Q>
+        requires (nuo_transparent<Compare> && !std::is_convertible_v<Q, const_iterator>)
+    size_type erase(const Q& key) {
+        return erase_impl(key);
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+        values_.clear();
+    }
+
+    void swap(nuo_flat_map& o) noexcept {
+        std::swap(keys_, o.keys_);
+        std::swap(values_, o.values_);
+        std::swap(comp_, o.comp_);
+    }
+
+    /* Lookup */
+    iterator find(const K& key) { return at_index(find_index(key)); }
+    const_iterator find(const K& key) const { return at_index(find_index(key)); }
+    bool contains(const K& key) const { return find_index(key) != keys_.size(); }
+    size_type count(const K& key) const { return contains(key); }
+    iterator lower_bound(const K& key) { return at_index(lower_index(key)); }
+    const_iterator lower_bound(const K& key) const { return at_index(lower_index(key)); }
+    iterator upper_bound(const K& key) { return at_index(upper_index(key)); }
+    const_iterator upper_bound(const K& key) const { return at_index(upper_index(key)); }
+
+    nuo_pair<iterator, iterator> equal_range(const K& key) {
+        return nuo_pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    nuo_pair<const_iterator, const_iterator> equal_range(const K& key) const {
+        return nuo_pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    iterator find(const Q& key) {
+        return at_index(find_index(key));
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    const_iterator find(const Q& key) const {
+        return at_index(find_index(key));
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    bool contains(const Q& key) const {
+        return find_index(key) != keys_.size();
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    size_type count(const Q& key) const {
+        return upper_index(key) - lower_index(key);
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    iterator lower_bound(const Q& key) {
+        return at_index(lower_index(key));
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    const_iterator lower_bound(const Q& key) const {
+        return at_index(lower_index(key));
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    iterator upper_bound(const Q& key) {
+        return at_index(upper_index(key));
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    const_iterator upper_bound(const Q& key) const {
+        return at_index(upper_index(key));
+    }
+
+    /*
+     * Every key found is written to out as (its index in keys, iterator);
+     * returns the filled prefix of out, which must be as long as keys.
+     */
+    std::span<nuo_pair<size_t, iterator>> find_batch(
+        std::span<const K> keys, std::span<nuo_pair<size_t, iterator>> out) {
+        return find_batch_impl(*this, keys, out);
+    }
+
+    std::span<nuo_pair<size_t, const_iterator>> find_batch(
+        std::span<const K> keys, std::span<nuo_pair<size_t, const_iterator>> out) const {
+        return find_batch_impl(*this, keys, out);
+    }
+
+    /* out[j] = contains(keys[j]); returns how many are present */
+    size_type contains_batch(std::span<const K> keys, std::span<bool> out) const {
+        detail::nuo_flat_check_batch(keys.size(), out.size());
+        size_t hits = 0;
+        std::fill_n(out.begin(), keys.size(), false);
+        detail::nuo_flat_find_batch(keys_, keys, comp_, [&](size_t j, size_t) {
+            out[j] = true;
+            hits++;
+        });
+        return hits;
+    }
+
+    /* Observers */
+    key_compare key_comp() const { return comp_; }
+
+    /* The sorted keys, and the values at the same positions */
+    const std::vector<K>& keys() const noexcept { return keys_; }
+    const std::vector<V>& values() const noexcept { return values_; }
+
+    /* Operations */
+    friend bool operator==(const nuo_flat_map& a, const nuo_flat_map& b) {
+        return a.keys_ == b.keys_ && a.values_ == b.values_;
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
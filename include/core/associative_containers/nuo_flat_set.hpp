@@ -0,0 +1,294 @@
+#ifndef NUOSTL_CORE_ASSOCIATIVE_CONTAINERS_NUO_FLAT_SET_HPP_
+#define NUOSTL_CORE_ASSOCIATIVE_CONTAINERS_NUO_FLAT_SET_HPP_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../algorithms/nuo_binary_search.hpp"
+#include "../data_types/nuo_pair.hpp"
+#include "../function_objects/nuo_functional.hpp"
+#include "./detail/nuo_flat_tree.hpp"
+
+/*
+ * Sorted set in one contiguous array, similar to std::flat_set: lookups
+ * are a branchless binary search (nuo_lower_bound) over keys packed with
+ * no per-element overhead, iteration is a linear scan, and an insert or
+ * erase shifts the tail of the array.
+ *
+ * It is meant to be built once and read many times: construction from a
+ * range sorts once and drops repeated keys (the first one stays), and a
+ * range insert sorts the new keys and merges them in one backward pass,
+ * O(n + m log m) instead of m shifts of the tail. Input tagged
+ * nuo_sorted_unique skips the sort.
+ *
+ * With a transparent Compare (nuo_less<>), find, contains, count, the
+ * bounds and erase accept any type comparable with the keys.
+ *
+ * find_batch and contains_batch look up many keys in one call, their
+ * binary searches interleaved so that on sets larger than the cache the
+ * misses of a dozen lookups overlap instead of queueing one by one.
+ */
+
+namespace nuostl {
+
+template<typename K, typename Compare = nuo_less<K>>
+class nuo_flat_set {
+public:
+    using key_type = K;
+    using value_type = K;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = const K&;
+    using const_reference = const K&;
+    using iterator = typename std::vector<K>::const_iterator;
+    using const_iterator = iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = reverse_iterator;
+    using container_type = std::vector<K>;
+
+private:
+    std::vector<K> keys_;
+    [[no_unique_address]] Compare comp_;
+
+    template<typename Q>
+    size_t lower_index(const Q& k) const {
+        return static_cast<size_t>(nuo_lower_bound(keys_.begin(), keys_.end(), k, comp_) -
+                                   keys_.begin());
+    }
+
+    template<typename Q>
+    size_t upper_index(const Q& k) const {
+        return static_cast<size_t>(nuo_upper_bound(keys_.begin(), keys_.end(), k, comp_) -
+                                   keys_.begin());
+    }
+
+    template<typename Q>
+    iterator find_impl(const Q& k) const {
+        size_t i = lower_index(k);
+        if (i < keys_.size() && !comp_(k, keys_[i]))
+            return keys_.begin() + static_cast<ptrdiff_t>(i);
+        return keys_.end();
+    }
+
+    template<typename Q>
+    size_type erase_impl(const Q& k) {
+        size_t lo = lower_index(k);
+        size_t hi = upper_index(k);
+        keys_.erase(keys_.begin() + static_cast<ptrdiff_t>(lo),
+                    keys_.begin() + static_cast<ptrdiff_t>(hi));
+        return hi - lo;
+    }
+
+    auto key_of() const {
+        return [](const K& k) -> const K& { return k; };
+    }
+
+    void normalize() {
+        detail::nuo_flat_sort_unique(keys_, key_of(), comp_);
+    }
+
+    template<typename V>
+    nuo_pair<iterator, bool> insert_one(V&& v) {
+        size_t i = lower_index(v);
+        if (i < keys_.size() && !comp_(v, keys_[i]))
+            return nuo_pair<iterator, bool>(keys_.begin() + static_cast<ptrdiff_t>(i), false);
+        auto it = keys_.insert(keys_.begin() + static_cast<ptrdiff_t>(i), std::forward<V>(v));
+        return nuo_pair<iterator, bool>(it, true);
+    }
+
+    /* batch: sorted, without repeats */
+    void merge_batch(std::vector<K>& batch) {
+        detail::nuo_flat_drop_present(keys_, batch, comp_);
+        detail::nuo_flat_merge(keys_, batch, comp_, [](size_t, size_t) {}, [](size_t, size_t) {});
+    }
+public:
+    /* Constructor */
+    nuo_flat_set() = default;
+
+    explicit nuo_flat_set(const Compare& comp) : comp_(comp) {}
+
+    template<std::input_iterator It>
+    nuo_flat_set(It first, It last, const Compare& comp = Compare())
+        : keys_(first, last), comp_(comp) {
+        normalize();
+    }
+
+    template<std::input_iterator It>
+    nuo_flat_set(nuo_sorted_unique_t, It first, It last, const Compare& comp = Compare())
+        : keys_(first, last), comp_(comp) {}
+
+    nuo_flat_set(std::initializer_list<K> il, const Compare& comp = Compare())
+        : nuo_flat_set(il.begin(), il.end(), comp) {}
+
+    /* Adopts the keys, then sorts them */
+    explicit nuo_flat_set(std::vector<K> keys, const Compare& comp = Compare())
+        : keys_(std::move(keys)), comp_(comp) {
+        normalize();
+    }
+
+    nuo_flat_set(nuo_sorted_unique_t, std::vector<K> keys, const Compare& comp = Compare())
+        : keys_(std::move(keys)), comp_(comp) {}
+
+    /* Iterators */
+    iterator begin() const noexcept { return keys_.begin(); }
+    iterator end() const noexcept { return keys_.end(); }
+    iterator cbegin() const noexcept { return keys_.begin(); }
+    iterator cend() const noexcept { return keys_.end(); }
+    reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+    /* Capacity */
+    bool empty() const noexcept { return keys_.empty(); }
+    size_type size() const noexcept { return keys_.size(); }
+    size_type max_size() const noexcept { return keys_.max_size(); }
+    size_type capacity() const noexcept { return keys_.capacity(); }
+    void reserve(size_type n) { keys_.reserve(n); }
+    void shrink_to_fit() { keys_.shrink_to_fit(); }
+
+    /* Modifiers */
+    nuo_pair<iterator, bool> insert(const K& k) { return insert_one(k); }
+    nuo_pair<iterator, bool> insert(K&& k) { return insert_one(std::move(k)); }
+
+    template<typename... Args>
+    nuo_pair<iterator, bool> emplace(Args&&... args) {
+        return insert_one(K(std::forward<Args>(args)...));
+    }
+
+    /* Sorts the new keys and merges them in one pass */
+    template<std::input_iterator It>
+    void insert(It first, It last) {
+        std::vector<K> batch(first, last);
+        detail::nuo_flat_sort_unique(batch, key_of(), comp_);
+        merge_batch(batch);
+    }
+
+    template<std::input_iterator It>
+    void insert(nuo_sorted_unique_t, It first, It last) {
+        std::vector<K> batch(first, last);
+        merge_batch(batch);
+    }
+
+    void insert(std::initializer_list<K> il) { insert(il.begin(), il.end()); }
+
+    iterator erase(iterator pos) { return keys_.erase(pos); }
+    iterator erase(iterator first, iterator last) { return keys_.erase(first, last); }
+    size_type erase(const K& k) { return erase_impl(k); }
+
+    template<typename Q>
+        requires (nuo_transparent<Compare> && !std::is_convertible_v<Q, iterator>)
+    size_type erase(const Q& k) {
+        return erase_impl(k);
+    }
+
+    void clear() noexcept { keys_.clear(); }
+
+    void swap(nuo_flat_set& o) noexcept {
+        std::swap(keys_, o.keys_);
+        std::swap(comp_, o.comp_);
+    }
+
+    /* Hands over the sorted keys, leaving the set empty */
+    std::vector<K> extract() && {
+        std::vector<K> r = std::move(keys_);
+        keys_.clear();
+        return r;
+    }
+
+    /* Lookup */
+    iterator find(const K& k) const { return find_impl(k); }
+    bool contains(const K& k) const { return find_impl(k) != end(); }
+    size_type count(const K& k) const { return contains(k); }
+    iterator lower_bound(const K& k) const { return begin() + static_cast<ptrdiff_t>(lower_index(k)); }
+    iterator upper_bound(const K& k) const { return begin() + static_cast<ptrdiff_t>(upper_index(k)); }
+
+    nuo_pair<iterator, iterator> equal_range(const K& k) const {
+        return nuo_pair<iterator, iterator>(lower_bound(k), upper_bound(k));
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    iterator find(const Q& k) const {
+        return find_impl(k);
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    bool contains(const Q& k) const {
+        return find_impl(k) != end();
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    size_type count(const Q& k) const {
+        return upper_index(k) - lower_index(k);
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    iterator lower_bound(const Q& k) const {
+        return begin() + static_cast<ptrdiff_t>(lower_index(k));
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    iterator upper_bound(const Q& k) const {
+        return begin() + static_cast<ptrdiff_t>(upper_index(k));
+    }
+
+    template<typename Q>
+        requires nuo_transparent<Compare>
+    nuo_pair<iterator, iterator> equal_range(const Q& k) const {
+        return nuo_pair<iterator, iterator>(lower_bound(k), upper_bound(k));
+    }
+
+    /*
+     * Every key found is written to out as (its index in keys, iterator);
+     * returns the filled prefix of out, which must be as long as keys.
+     */
+    std::span<nuo_pair<size_t, iterator>> find_batch(
+        std::span<const K> keys, std::span<nuo_pair<size_t, iterator>> out) const {
+        detail::nuo_flat_check_batch(keys.size(), out.size());
+        size_t hits = 0;
+        detail::nuo_flat_find_batch(keys_, keys, comp_, [&](size_t j, size_t i) {
+            out[hits++] = nuo_pair<size_t, iterator>(j, begin() + static_cast<ptrdiff_t>(i));
+        });
+        return out.first(hits);
+    }
+
+    /* out[j] = contains(keys[j]); returns how many are present */
+    size_type contains_batch(std::span<const K> keys, std::span<bool> out) const {
+        detail::nuo_flat_check_batch(keys.size(), out.size());
+        size_t hits = 0;
+        std::fill_n(out.begin(), keys.size(), false);
+        detail::nuo_flat_find_batch(keys_, keys, comp_, [&](size_t j, size_t) {
+            out[j] = true;
+            hits++;
+        });
+        return hits;
+    }
+
+    /* Observers */
+    key_compare key_comp() const { return comp_; }
+    value_compare value_comp() const { return comp_; }
+
+    /* The sorted keys */
+    const std::vector<K>& keys() const noexcept { return keys_; }
+
+    /* Operations */
+    friend bool operator==(const nuo_flat_set& a, const nuo_flat_set& b) {
+        return a.keys_ == b.keys_;
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
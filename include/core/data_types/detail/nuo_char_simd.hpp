@@ -0,0 +1,943 @@
+#ifndef NUOSTL_CORE_DATA_TYPES_DETAIL_NUO_CHAR_SIMD_HPP_
+#define NUOSTL_CORE_DATA_TYPES_DETAIL_NUO_CHAR_SIMD_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <bit>
+
+#include "../../dispatch/nuo_cpu_dispatch.hpp"
+
+#if defined(NUOSTL_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+/*
+ * Byte string kernels shared by nuo_string and nuo_string_view:
+ *   nuo_char_find      first occurrence of a byte
+ *   nuo_char_mismatch  first index where two buffers differ
+ *   nuo_char_search    first occurrence of a substring
+ *   nuo_char_find_set  first byte that is (not) a member of a nuo_char_set
+ *   nuo_char_set_block membership bitmask of a 64 byte block
+ * All return nuo_char_npos when nothing is found (mismatch returns n).
+ *
+ * The substring search is the "generic SIMD" filter: compare the first and
+ * the last needle byte against a whole vector of candidate positions and
+ * only verify the positions where both match. Inputs that defeat the
+ * filter (long periodic needles such as "aa...ab" in "aaaa...") would make
+ * it quadratic, so once verification clearly dominates the scan it hands
+ * the rest of the haystack to the linear time Two-Way algorithm.
+ *
+ * The byte set scan classifies 16/32/64 bytes at once with two nibble
+ * table lookups (pshufb), so its speed does not depend on the set size.
+ */
+
+namespace nuostl {
+namespace detail {
+
+inline constexpr size_t nuo_char_npos = static_cast<size_t>(-1);
+
+/* Below this many bytes the scalar loops beat an indirect call. */
+inline constexpr size_t nuo_char_simd_threshold = 16;
+
+inline size_t nuo_char_find_scalar(const char* p, size_t n, char c) noexcept {
+    for (size_t i = 0; i < n; i++) {
+        if (p[i] == c)
+            return i;
+    }
+    return nuo_char_npos;
+}
+
+inline size_t nuo_char_mismatch_scalar(const char* a, const char* b,
+                                       size_t n) noexcept {
+    size_t i = 0;
+    if constexpr (std::endian::native == std::endian::little) {
+        /* word at a time, the first differing byte is the lowest one */
+        for (; i + 8 <= n; i += 8) {
+            uint64_t x, y;
+            memcpy(&x, a + i, 8);
+            memcpy(&y, b + i, 8);
+            if (x != y)
+                return i + static_cast<size_t>(__builtin_ctzll(x ^ y) >> 3);
+        }
+        if (n >= 8 && i < n) {
+            /* overlapping last word, its first i - (n - 8) bytes are equal */
+            uint64_t x, y;
+            memcpy(&x, a + n - 8, 8);
+            memcpy(&y, b + n - 8, 8);
+            if (x != y)
+                return n - 8 + static_cast<size_t>(__builtin_ctzll(x ^ y) >> 3);
+            return n;
+        }
+    }
+    for (; i < n; i++) {
+        if (a[i] != b[i])
+            return i;
+    }
+    return n;
+}
+
+/* Equality of two n byte buffers, branch-light for short keys. */
+inline bool nuo_char_equal_short(const char* a, const char* b,
+                                 size_t n) noexcept {
+    auto load64 = [](const char* p) {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        return v;
+    };
+    auto load32 = [](const char* p) {
+        uint32_t v;
+        memcpy(&v, p, 4);
+        return v;
+    };
+    if (n >= 16) {
+        /* 16..32 bytes, four possibly overlapping words */
+        return ((load64(a) ^ load64(b)) |
+                (load64(a + 8) ^ load64(b + 8)) |
+                (load64(a + n - 16) ^ load64(b + n - 16)) |
+                (load64(a + n - 8) ^ load64(b + n - 8))) == 0;
+    }
+    if (n >= 8) {
+        return ((load64(a) ^ load64(b)) |
+                (load64(a + n - 8) ^ load64(b + n - 8))) == 0;
+    }
+    if (n >= 4) {
+        return ((load32(a) ^ load32(b)) |
+                (load32(a + n - 4) ^ load32(b + n - 4))) == 0;
+    }
+    if (n == 0)
+        return true;
+    return a[0] == b[0] && a[n >> 1] == b[n >> 1] && a[n - 1] == b[n - 1];
+}
+
+/*
+ * Crochemore-Perrin critical factorization of s[0, m), m >= 1. Returns the
+ * split point and stores the period of the needle in *period. Both maximal
+ * suffix passes start at index -1, hence the unsigned wrap-around.
+ */
+inline size_t nuo_char_critical_factorization(const unsigned char* s,
+                                              size_t m,
+                                              size_t* period) noexcept {
+    /* maximal suffix for the natural byte order */
+    size_t ms = nuo_char_npos;
+    size_t j = 0, k = 1, p = 1;
+    while (j + k < m) {
+        unsigned char a = s[j + k];
+        unsigned char b = s[ms + k];
+        if (a < b) {
+            j += k;
+            k = 1;
+            p = j - ms;
+        } else if (a == b) {
+            if (k != p) {
+                k++;
+            } else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            ms = j++;
+            k = p = 1;
+        }
+    }
+    *period = p;
+
+    /* maximal suffix for the reversed order */
+    size_t ms_rev = nuo_char_npos;
+    j = 0;
+    k = p = 1;
+    while (j + k < m) {
+        unsigned char a = s[j + k];
+        unsigned char b = s[ms_rev + k];
+        if (b < a) {
+            j += k;
+            k = 1;
+            p = j - ms_rev;
+        } else if (a == b) {
+            if (k != p) {
+                k++;
+            } else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            ms_rev = j++;
+            k = p = 1;
+        }
+    }
+
+    /* the later of the two suffixes is a critical factorization */
+    if (ms_rev + 1 < ms + 1)
+        return ms + 1;
+    *period = p;
+    return ms_rev + 1;
+}
+
+/* Two-Way string matching: O(n + m) time, O(1) space, m >= 1. */
+inline size_t nuo_char_search_two_way(const char* hc, size_t n,
+                                      const char* sc, size_t m) noexcept {
+    if (m > n)
+        return nuo_char_npos;
+    auto h = reinterpret_cast<const unsigned char*>(hc);
+    auto s = reinterpret_cast<const unsigned char*>(sc);
+    size_t period;
+    const size_t split = nuo_char_critical_factorization(s, m, &period);
+    size_t j = 0;
+    if (memcmp(s, s + period, split) == 0) {
+        /*
+         * Periodic needle: a mismatch only shifts by the period, remember
+         * how much of the right half is already known to match.
+         */
+        size_t memory = 0;
+        while (j + m <= n) {
+            size_t i = split > memory ? split : memory;
+            while (i < m && s[i] == h[i + j])
+                i++;
+            if (i >= m) {
+                i = split - 1;
+                while (memory < i + 1 && s[i] == h[i + j])
+                    i--;
+                if (i + 1 < memory + 1)
+                    return j;
+                j += period;
+                memory = m - period;
+            } else {
+                j += i - split + 1;
+                memory = 0;
+            }
+        }
+    } else {
+        /* the halves differ, any mismatch allows a maximal shift */
+        period = (split > m - split ? split : m - split) + 1;
+        while (j + m <= n) {
+            size_t i = split;
+            while (i < m && s[i] == h[i + j])
+                i++;
+            if (i >= m) {
+                i = split - 1;
+                while (i != nuo_char_npos && s[i] == h[i + j])
+                    i--;
+                if (i == nuo_char_npos)
+                    return j;
+                j += period;
+            } else {
+                j += i - split + 1;
+            }
+        }
+    }
+    return nuo_char_npos;
+}
+
+/*
+ * True once the failed verifications of a filter based search clearly
+ * outweigh the i bytes scanned so far. Short needles verify cheaply and
+ * never switch.
+ */
+constexpr bool nuo_char_search_degenerate(size_t fails, size_t i,
+                                          size_t m) noexcept {
+    return m >= 16 && fails > (i >> 3) + 256;
+}
+
+/* Two-Way on h[i, n), for the searches that gave up filtering at i. */
+inline size_t nuo_char_search_rest(const char* h, size_t n, const char* s,
+                                   size_t m, size_t i) noexcept {
+    size_t k = nuo_char_search_two_way(h + i, n - i, s, m);
+    return k == nuo_char_npos ? k : i + k;
+}
+
+/* needle length m >= 1 */
+inline size_t nuo_char_search_scalar(const char* h, size_t n,
+                                     const char* s, size_t m) noexcept {
+    if (m > n)
+        return nuo_char_npos;
+    const char first = s[0];
+    size_t fails = 0;
+    for (size_t i = 0; i + m <= n; i++) {
+        if (h[i] == first) {
+            if (memcmp(h + i + 1, s + 1, m - 1) == 0)
+                return i;
+            if (nuo_char_search_degenerate(++fails, i, m))
+                return nuo_char_search_rest(h, n, s, m, i + 1);
+        }
+    }
+    return nuo_char_npos;
+}
+
+/*
+ * Check the candidate positions base + (set bits of mask) of a SIMD
+ * substring filter, first and last needle bytes already match. Kept out
+ * of line so the filter loops stay free of the verification's registers.
+ */
+template<typename Mask>
+__attribute__((noinline)) size_t nuo_char_verify(const char* h, size_t base,
+                                                 Mask mask, const char* s,
+                                                 size_t m) noexcept {
+    while (mask != 0) {
+        size_t k = base + static_cast<size_t>(__builtin_ctzll(mask));
+        if (m <= 2 || memcmp(h + k + 1, s + 1, m - 2) == 0)
+            return k;
+        mask &= mask - 1;
+    }
+    return nuo_char_npos;
+}
+
+/*
+ * Byte set for find_first_of style scans. bits is the 256 bit membership
+ * bitmap of the scalar loops. lo[] are the nibble tables of the vector
+ * lookup: byte c is a member iff bit ((c >> 4) & 7) of lo[c >> 7][c & 15]
+ * is set.
+ */
+struct nuo_char_set {
+    uint64_t bits[4] = {};
+    alignas(16) uint8_t lo[2][16] = {};
+
+    constexpr nuo_char_set() noexcept = default;
+
+    constexpr nuo_char_set(const char* s, size_t k) noexcept {
+        for (size_t i = 0; i < k; i++)
+            insert(s[i]);
+    }
+
+    constexpr void insert(char c) noexcept {
+        unsigned u = static_cast<unsigned char>(c);
+        bits[u >> 6] |= UINT64_C(1) << (u & 63);
+        lo[u >> 7][u & 15] |= static_cast<uint8_t>(1u << ((u >> 4) & 7));
+    }
+
+    constexpr bool contains(char c) const noexcept {
+        unsigned u = static_cast<unsigned char>(c);
+        return (bits[u >> 6] >> (u & 63)) & 1;
+    }
+};
+
+/* First index whose membership in set equals Member. */
+template<bool Member>
+size_t nuo_char_find_set_scalar(const char* p, size_t n,
+                                const nuo_char_set& set) noexcept {
+    for (size_t i = 0; i < n; i++) {
+        if (set.contains(p[i]) == Member)
+            return i;
+    }
+    return nuo_char_npos;
+}
+
+/* Last index below n whose membership in set equals Member. */
+template<bool Member>
+size_t nuo_char_rfind_set(const char* p, size_t n,
+                          const nuo_char_set& set) noexcept {
+    while (n-- > 0) {
+        if (set.contains(p[n]) == Member)
+            return n;
+    }
+    return nuo_char_npos;
+}
+
+/* Membership bitmask of p[0, min(n, 64)), bit i for p[i]. */
+inline uint64_t nuo_char_set_block_scalar(const char* p, size_t n,
+                                          const nuo_char_set& set) noexcept {
+    if (n > 64)
+        n = 64;
+    uint64_t mask = 0;
+    for (size_t i = 0; i < n; i++)
+        mask |= static_cast<uint64_t>(set.contains(p[i])) << i;
+    return mask;
+}
+
+#if defined(NUOSTL_ARCH_X86)
+
+/* SSE4.2 */
+NUOSTL_TARGET_SSE42 inline size_t nuo_char_find_sse42(const char* p, size_t n,
+                                                      char c) noexcept {
+    if (n < 16)
+        return nuo_char_find_scalar(p, n, c);
+    const __m128i needle = _mm_set1_epi8(c);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        unsigned mask = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)));
+        if (mask != 0)
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+    }
+    if (i == n)
+        return nuo_char_npos;
+    /* overlapping last vector, skip the bytes already checked */
+    size_t last = n - 16;
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + last));
+    unsigned mask = static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)));
+    mask >>= (i - last);
+    return mask != 0 ? i + static_cast<size_t>(__builtin_ctz(mask))
+                     : nuo_char_npos;
+}
+
+NUOSTL_TARGET_SSE42 inline size_t nuo_char_mismatch_sse42(
+        const char* a, const char* b, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        unsigned eq = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+        if (eq != 0xffffu)
+            return i + static_cast<size_t>(__builtin_ctz(~eq));
+    }
+    size_t rest = nuo_char_mismatch_scalar(a + i, b + i, n - i);
+    return i + rest;
+}
+
+NUOSTL_TARGET_SSE42 inline size_t nuo_char_search_sse42(
+        const char* h, size_t n, const char* s, size_t m) noexcept {
+    if (m > n)
+        return nuo_char_npos;
+    const __m128i first = _mm_set1_epi8(s[0]);
+    const __m128i last = _mm_set1_epi8(s[m - 1]);
+    const size_t end = n - m + 1;   /* candidate positions [0, end) */
+    const char* hl = h + m - 1;
+    size_t fails = 0;
+    size_t i = 0;
+    for (; i + 16 <= end; i += 16) {
+        __m128i bf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + i));
+        __m128i bl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hl + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(bf, first),
+                          _mm_cmpeq_epi8(bl, last))));
+        if (mask != 0) {
+            size_t k = nuo_char_verify(h, i, mask, s, m);
+            if (k != nuo_char_npos)
+                return k;
+            fails += static_cast<size_t>(__builtin_popcount(mask));
+            if (nuo_char_search_degenerate(fails, i, m))
+                return nuo_char_search_rest(h, n, s, m, i + 16);
+        }
+    }
+    size_t rest = nuo_char_search_scalar(h + i, n - i, s, m);
+    return rest == nuo_char_npos ? rest : i + rest;
+}
+
+/* AVX2 */
+NUOSTL_TARGET_AVX2 inline size_t nuo_char_find_avx2(const char* p, size_t n,
+                                                    char c) noexcept {
+    if (n < 32)
+        return nuo_char_find_sse42(p, n, c);
+    const __m256i needle = _mm256_set1_epi8(c);
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m256i v0 = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(p + i));
+        __m256i v1 = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(p + i + 32));
+        __m256i e0 = _mm256_cmpeq_epi8(v0, needle);
+        __m256i e1 = _mm256_cmpeq_epi8(v1, needle);
+        if (!_mm256_testz_si256(_mm256_or_si256(e0, e1),
+                                _mm256_or_si256(e0, e1))) {
+            uint64_t m0 = static_cast<uint32_t>(_mm256_movemask_epi8(e0));
+            uint64_t m1 = static_cast<uint32_t>(_mm256_movemask_epi8(e1));
+            return i + static_cast<size_t>(__builtin_ctzll(m0 | (m1 << 32)));
+        }
+    }
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(p + i));
+        unsigned mask = static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle)));
+        if (mask != 0)
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+    }
+    if (i == n)
+        return nuo_char_npos;
+    size_t last = n - 32;
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + last));
+    unsigned mask = static_cast<unsigned>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle)));
+    mask >>= (i - last);
+    return mask != 0 ? i + static_cast<size_t>(__builtin_ctz(mask))
+                     : nuo_char_npos;
+}
+
+NUOSTL_TARGET_AVX2 inline size_t nuo_char_mismatch_avx2(
+        const char* a, const char* b, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(a + i));
+        __m256i y = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(b + i));
+        unsigned eq = static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+        if (eq != 0xffffffffu)
+            return i + static_cast<size_t>(__builtin_ctz(~eq));
+    }
+    return i + nuo_char_mismatch_sse42(a + i, b + i, n - i);
+}
+
+NUOSTL_TARGET_AVX2 inline size_t nuo_char_search_avx2(
+        const char* h, size_t n, const char* s, size_t m) noexcept {
+    if (m > n)
+        return nuo_char_npos;
+    const __m256i first = _mm256_set1_epi8(s[0]);
+    const __m256i last = _mm256_set1_epi8(s[m - 1]);
+    const size_t end = n - m + 1;
+    const char* hl = h + m - 1;
+    auto filter = [&](size_t i) NUOSTL_TARGET_AVX2 {
+        __m256i bf = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(h + i));
+        __m256i bl = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(hl + i));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(bf, first),
+                             _mm256_cmpeq_epi8(bl, last))));
+    };
+    size_t fails = 0;
+    size_t i = 0;
+    for (; i + 64 <= end; i += 64) {
+        uint64_t mask = filter(i) | (static_cast<uint64_t>(filter(i + 32)) << 32);
+        if (mask != 0) {
+            size_t k = nuo_char_verify(h, i, mask, s, m);
+            if (k != nuo_char_npos)
+                return k;
+            fails += static_cast<size_t>(__builtin_popcountll(mask));
+            if (nuo_char_search_degenerate(fails, i, m))
+                return nuo_char_search_rest(h, n, s, m, i + 64);
+        }
+    }
+    for (; i + 32 <= end; i += 32) {
+        uint32_t mask = filter(i);
+        if (mask != 0) {
+            size_t k = nuo_char_verify(h, i, mask, s, m);
+            if (k != nuo_char_npos)
+                return k;
+        }
+    }
+    size_t rest = nuo_char_search_sse42(h + i, n - i, s, m);
+    return rest == nuo_char_npos ? rest : i + rest;
+}
+
+/* AVX-512 */
+NUOSTL_TARGET_AVX512 inline size_t nuo_char_find_avx512(const char* p,
+                                                        size_t n,
+                                                        char c) noexcept {
+    const __m512i needle = _mm512_set1_epi8(c);
+    size_t i = 0;
+    for (; i + 256 <= n; i += 256) {
+        __mmask64 m0 = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(p + i),
+                                              needle);
+        __mmask64 m1 = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(p + i + 64),
+                                              needle);
+        __mmask64 m2 = _mm512_cmpeq_epi8_mask(
+            _mm512_loadu_si512(p + i + 128), needle);
+        __mmask64 m3 = _mm512_cmpeq_epi8_mask(
+            _mm512_loadu_si512(p + i + 192), needle);
+        if ((m0 | m1 | m2 | m3) != 0) {
+            if (m0) return i + static_cast<size_t>(__builtin_ctzll(m0));
+            if (m1) return i + 64 + static_cast<size_t>(__builtin_ctzll(m1));
+            if (m2) return i + 128 + static_cast<size_t>(__builtin_ctzll(m2));
+            return i + 192 + static_cast<size_t>(__builtin_ctzll(m3));
+        }
+    }
+    for (; i + 64 <= n; i += 64) {
+        __m512i v = _mm512_loadu_si512(p + i);
+        uint64_t mask = _mm512_cmpeq_epi8_mask(v, needle);
+        if (mask != 0)
+            return i + static_cast<size_t>(__builtin_ctzll(mask));
+    }
+    if (i == n)
+        return nuo_char_npos;
+    /* masked tail load never touches bytes past the end */
+    __mmask64 live = _bzhi_u64(~UINT64_C(0), static_cast<unsigned>(n - i));
+    __m512i v = _mm512_maskz_loadu_epi8(live, p + i);
+    uint64_t mask = _mm512_mask_cmpeq_epi8_mask(live, v, needle);
+    return mask != 0 ? i + static_cast<size_t>(__builtin_ctzll(mask))
+                     : nuo_char_npos;
+}
+
+NUOSTL_TARGET_AVX512 inline size_t nuo_char_mismatch_avx512(
+        const char* a, const char* b, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        uint64_t ne = _mm512_cmpneq_epi8_mask(_mm512_loadu_si512(a + i),
+                                              _mm512_loadu_si512(b + i));
+        if (ne != 0)
+            return i + static_cast<size_t>(__builtin_ctzll(ne));
+    }
+    if (i == n)
+        return n;
+    __mmask64 live = _bzhi_u64(~UINT64_C(0), static_cast<unsigned>(n - i));
+    uint64_t ne = _mm512_mask_cmpneq_epi8_mask(live,
+        _mm512_maskz_loadu_epi8(live, a + i),
+        _mm512_maskz_loadu_epi8(live, b + i));
+    return ne != 0 ? i + static_cast<size_t>(__builtin_ctzll(ne)) : n;
+}
+
+NUOSTL_TARGET_AVX512 inline size_t nuo_char_search_avx512(
+        const char* h, size_t n, const char* s, size_t m) noexcept {
+    if (m > n)
+        return nuo_char_npos;
+    const __m512i first = _mm512_set1_epi8(s[0]);
+    const __m512i last = _mm512_set1_epi8(s[m - 1]);
+    const size_t end = n - m + 1;
+    const char* hl = h + m - 1;
+    auto filter = [&](size_t i) NUOSTL_TARGET_AVX512 {
+        return static_cast<uint64_t>(
+            _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(h + i), first) &
+            _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(hl + i), last));
+    };
+    size_t fails = 0;
+    size_t i = 0;
+    for (; i + 128 <= end; i += 128) {
+        uint64_t m0 = filter(i);
+        uint64_t m1 = filter(i + 64);
+        if ((m0 | m1) != 0) {
+            size_t k = m0 != 0 ? nuo_char_verify(h, i, m0, s, m)
+                               : nuo_char_npos;
+            if (k == nuo_char_npos && m1 != 0)
+                k = nuo_char_verify(h, i + 64, m1, s, m);
+            if (k != nuo_char_npos)
+                return k;
+            fails += static_cast<size_t>(__builtin_popcountll(m0) +
+                                         __builtin_popcountll(m1));
+            if (nuo_char_search_degenerate(fails, i, m))
+                return nuo_char_search_rest(h, n, s, m, i + 128);
+        }
+    }
+    for (; i + 64 <= end; i += 64) {
+        uint64_t mask = filter(i);
+        if (mask != 0) {
+            size_t k = nuo_char_verify(h, i, mask, s, m);
+            if (k != nuo_char_npos)
+                return k;
+        }
+    }
+    if (i == end)
+        return nuo_char_npos;
+    /* masked tail: the last candidate's last byte is h[n - 1] */
+    __mmask64 live = _bzhi_u64(~UINT64_C(0), static_cast<unsigned>(end - i));
+    uint64_t mask =
+        _mm512_mask_cmpeq_epi8_mask(live,
+            _mm512_maskz_loadu_epi8(live, h + i), first) &
+        _mm512_mask_cmpeq_epi8_mask(live,
+            _mm512_maskz_loadu_epi8(live, hl + i), last);
+    return mask != 0 ? nuo_char_verify(h, i, mask, s, m) : nuo_char_npos;
+}
+
+/*
+ * Byte set classifiers. For each byte c: row = lo[c >> 7][c & 15] through
+ * pshufb and a blend on the top bit, bit = 1 << ((c >> 4) & 7) through a
+ * second pshufb; c is a member iff row & bit is non-zero. Each returns the
+ * membership bitmask of the bytes at p, bit i for p[i].
+ */
+struct nuo_char_classify_sse42 {
+    __m128i lo0, lo1, bitsel, nibble;
+
+    NUOSTL_TARGET_SSE42 explicit nuo_char_classify_sse42(
+            const nuo_char_set& set) noexcept :
+        lo0(_mm_load_si128(reinterpret_cast<const __m128i*>(set.lo[0]))),
+        lo1(_mm_load_si128(reinterpret_cast<const __m128i*>(set.lo[1]))),
+        bitsel(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                             1, 2, 4, 8, 16, 32, 64, -128)),
+        nibble(_mm_set1_epi8(0x0f)) {}
+
+    NUOSTL_TARGET_SSE42 unsigned member16(const char* p) const noexcept {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i lo = _mm_and_si128(v, nibble);
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+        __m128i row = _mm_blendv_epi8(_mm_shuffle_epi8(lo0, lo),
+                                      _mm_shuffle_epi8(lo1, lo), v);
+        __m128i bit = _mm_shuffle_epi8(bitsel, hi);
+        unsigned absent = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_and_si128(row, bit), _mm_setzero_si128())));
+        return ~absent & 0xffffu;
+    }
+
+    NUOSTL_TARGET_SSE42 uint64_t member64(const char* p) const noexcept {
+        return static_cast<uint64_t>(member16(p)) |
+               static_cast<uint64_t>(member16(p + 16)) << 16 |
+               static_cast<uint64_t>(member16(p + 32)) << 32 |
+               static_cast<uint64_t>(member16(p + 48)) << 48;
+    }
+};
+
+struct nuo_char_classify_avx2 {
+    __m256i lo0, lo1, bitsel, nibble;
+
+    NUOSTL_TARGET_AVX2 explicit nuo_char_classify_avx2(
+            const nuo_char_set& set) noexcept :
+        lo0(_mm256_broadcastsi128_si256(_mm_load_si128(
+            reinterpret_cast<const __m128i*>(set.lo[0])))),
+        lo1(_mm256_broadcastsi128_si256(_mm_load_si128(
+            reinterpret_cast<const __m128i*>(set.lo[1])))),
+        bitsel(_mm256_setr_epi8(
+            1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+            1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128)),
+        nibble(_mm256_set1_epi8(0x0f)) {}
+
+    NUOSTL_TARGET_AVX2 uint32_t member32(const char* p) const noexcept {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        __m256i lo = _mm256_and_si256(v, nibble);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+        __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(lo0, lo),
+                                         _mm256_shuffle_epi8(lo1, lo), v);
+        __m256i bit = _mm256_shuffle_epi8(bitsel, hi);
+        return ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_and_si256(row, bit), _mm256_setzero_si256())));
+    }
+
+    NUOSTL_TARGET_AVX2 uint64_t member64(const char* p) const noexcept {
+        return static_cast<uint64_t>(member32(p)) |
+               static_cast<uint64_t>(member32(p + 32)) << 32;
+    }
+};
+
+struct nuo_char_classify_avx512 {
+    __m512i lo0, lo1, bitsel, nibble;
+
+    /* maskz broadcasts: the plain form trips -Wuninitialized on gcc 12 */
+    NUOSTL_TARGET_AVX512 explicit nuo_char_classify_avx512(
+            const nuo_char_set& set) noexcept :
+        lo0(_mm512_maskz_broadcast_i32x4(0xffff, _mm_load_si128(
+            reinterpret_cast<const __m128i*>(set.lo[0])))),
+        lo1(_mm512_maskz_broadcast_i32x4(0xffff, _mm_load_si128(
+            reinterpret_cast<const __m128i*>(set.lo[1])))),
+        bitsel(_mm512_maskz_broadcast_i32x4(0xffff, _mm_setr_epi8(
+            1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128))),
+        nibble(_mm512_set1_epi8(0x0f)) {}
+
+    NUOSTL_TARGET_AVX512 uint64_t member(__m512i v) const noexcept {
+        __m512i lo = _mm512_and_si512(v, nibble);
+        __m512i hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), nibble);
+        __m512i row = _mm512_mask_blend_epi8(_mm512_movepi8_mask(v),
+                                             _mm512_shuffle_epi8(lo0, lo),
+                                             _mm512_shuffle_epi8(lo1, lo));
+        __m512i bit = _mm512_shuffle_epi8(bitsel, hi);
+        return _mm512_test_epi8_mask(row, bit);
+    }
+
+    NUOSTL_TARGET_AVX512 uint64_t member64(const char* p) const noexcept {
+        return member(_mm512_loadu_si512(p));
+    }
+
+    /* n < 64 bytes, never reads past p + n */
+    NUOSTL_TARGET_AVX512 uint64_t member_tail(const char* p,
+                                              size_t n) const noexcept {
+        __mmask64 live = _bzhi_u64(~UINT64_C(0), static_cast<unsigned>(n));
+        return member(_mm512_maskz_loadu_epi8(live, p)) & live;
+    }
+};
+
+/* First index whose membership in set equals Member. */
+template<bool Member>
+NUOSTL_TARGET_SSE42 size_t nuo_char_find_set_sse42(
+        const char* p, size_t n, const nuo_char_set& set) noexcept {
+    const nuo_char_classify_sse42 cls(set);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        unsigned mask = cls.member16(p + i);
+        if (!Member)
+            mask ^= 0xffffu;
+        if (mask != 0)
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+    }
+    size_t rest = nuo_char_find_set_scalar<Member>(p + i, n - i, set);
+    return rest == nuo_char_npos ? rest : i + rest;
+}
+
+template<bool Member>
+NUOSTL_TARGET_AVX2 size_t nuo_char_find_set_avx2(
+        const char* p, size_t n, const nuo_char_set& set) noexcept {
+    if (n < 32)
+        return nuo_char_find_set_sse42<Member>(p, n, set);
+    const nuo_char_classify_avx2 cls(set);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        uint32_t mask = Member ? cls.member32(p + i) : ~cls.member32(p + i);
+        if (mask != 0)
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+    }
+    if (i == n)
+        return nuo_char_npos;
+    /* overlapping last vector, skip the bytes already checked */
+    size_t last = n - 32;
+    uint32_t mask = Member ? cls.member32(p + last) : ~cls.member32(p + last);
+    mask >>= (i - last);
+    return mask != 0 ? i + static_cast<size_t>(__builtin_ctz(mask))
+                     : nuo_char_npos;
+}
+
+template<bool Member>
+NUOSTL_TARGET_AVX512 size_t nuo_char_find_set_avx512(
+        const char* p, size_t n, const nuo_char_set& set) noexcept {
+    const nuo_char_classify_avx512 cls(set);
+    const uint64_t flip = Member ? 0 : ~UINT64_C(0);
+    size_t i = 0;
+    for (; i + 128 <= n; i += 128) {
+        uint64_t m0 = cls.member64(p + i) ^ flip;
+        uint64_t m1 = cls.member64(p + i + 64) ^ flip;
+        if ((m0 | m1) != 0) {
+            if (m0) return i + static_cast<size_t>(__builtin_ctzll(m0));
+            return i + 64 + static_cast<size_t>(__builtin_ctzll(m1));
+        }
+    }
+    for (; i + 64 <= n; i += 64) {
+        uint64_t mask = cls.member64(p + i) ^ flip;
+        if (mask != 0)
+            return i + static_cast<size_t>(__builtin_ctzll(mask));
+    }
+    if (i == n)
+        return nuo_char_npos;
+    uint64_t live = _bzhi_u64(~UINT64_C(0), static_cast<unsigned>(n - i));
+    uint64_t mask = (cls.member_tail(p + i, n - i) ^ flip) & live;
+    return mask != 0 ? i + static_cast<size_t>(__builtin_ctzll(mask))
+                     : nuo_char_npos;
+}
+
+/* Membership bitmask of p[0, min(n, 64)), n >= 1. */
+NUOSTL_TARGET_SSE42 inline uint64_t nuo_char_set_block_sse42(
+        const char* p, size_t n, const nuo_char_set& set) noexcept {
+    if (n < 64) {
+        alignas(16) char buf[64] = {};
+        memcpy(buf, p, n);
+        return nuo_char_classify_sse42(set).member64(buf) &
+               ((UINT64_C(1) << n) - 1);
+    }
+    return nuo_char_classify_sse42(set).member64(p);
+}
+
+NUOSTL_TARGET_AVX2 inline uint64_t nuo_char_set_block_avx2(
+        const char* p, size_t n, const nuo_char_set& set) noexcept {
+    if (n < 64) {
+        alignas(32) char buf[64] = {};
+        memcpy(buf, p, n);
+        return nuo_char_classify_avx2(set).member64(buf) &
+               ((UINT64_C(1) << n) - 1);
+    }
+    return nuo_char_classify_avx2(set).member64(p);
+}
+
+NUOSTL_TARGET_AVX512 inline uint64_t nuo_char_set_block_avx512(
+        const char* p, size_t n, const nuo_char_set& set) noexcept {
+    const nuo_char_classify_avx512 cls(set);
+    return n < 64 ? cls.member_tail(p, n) : cls.member64(p);
+}
+
+inline constexpr nuo_dispatcher<size_t(const char*, size_t, char)>
+    nuo_char_find_dispatch =
+        nuo_dispatcher<size_t(const char*, size_t, char)>(
+            &nuo_char_find_scalar)
+        .add(nuo_isa::sse42, &nuo_char_find_sse42)
+        .add(nuo_isa::avx2, &nuo_char_find_avx2)
+        .add(nuo_isa::avx512, &nuo_char_find_avx512);
+
+inline constexpr nuo_dispatcher<size_t(const char*, const char*, size_t)>
+    nuo_char_mismatch_dispatch =
+        nuo_dispatcher<size_t(const char*, const char*, size_t)>(
+            &nuo_char_mismatch_scalar)
+        .add(nuo_isa::sse42, &nuo_char_mismatch_sse42)
+        .add(nuo_isa::avx2, &nuo_char_mismatch_avx2)
+        .add(nuo_isa::avx512, &nuo_char_mismatch_avx512);
+
+inline constexpr nuo_dispatcher<size_t(const char*, size_t, const char*, size_t)>
+    nuo_char_search_dispatch =
+        nuo_dispatcher<size_t(const char*, size_t, const char*, size_t)>(
+            &nuo_char_search_scalar)
+        .add(nuo_isa::sse42, &nuo_char_search_sse42)
+        .add(nuo_isa::avx2, &nuo_char_search_avx2)
+        .add(nuo_isa::avx512, &nuo_char_search_avx512);
+
+template<bool Member>
+inline constexpr nuo_dispatcher<size_t(const char*, size_t, const nuo_char_set&)>
+    nuo_char_find_set_dispatch =
+        nuo_dispatcher<size_t(const char*, size_t, const nuo_char_set&)>(
+            &nuo_char_find_set_scalar<Member>)
+        .add(nuo_isa::sse42, &nuo_char_find_set_sse42<Member>)
+        .add(nuo_isa::avx2, &nuo_char_find_set_avx2<Member>)
+        .add(nuo_isa::avx512, &nuo_char_find_set_avx512<Member>);
+
+inline constexpr nuo_dispatcher<uint64_t(const char*, size_t, const nuo_char_set&)>
+    nuo_char_set_block_dispatch =
+        nuo_dispatcher<uint64_t(const char*, size_t, const nuo_char_set&)>(
+            &nuo_char_set_block_scalar)
+        .add(nuo_isa::sse42, &nuo_char_set_block_sse42)
+        .add(nuo_isa::avx2, &nuo_char_set_block_avx2)
+        .add(nuo_isa::avx512, &nuo_char_set_block_avx512);
+
+#endif  /* NUOSTL_ARCH_X86 */
+
+inline size_t nuo_char_find(const char* p, size_t n, char c) noexcept {
+#if defined(NUOSTL_ARCH_X86)
+    if (n >= nuo_char_simd_threshold)
+        return nuo_char_find_dispatch(p, n, c);
+#endif
+    return nuo_char_find_scalar(p, n, c);
+}
+
+inline size_t nuo_char_mismatch(const char* a, const char* b,
+                                size_t n) noexcept {
+#if defined(NUOSTL_ARCH_X86)
+    if (n >= 2 * nuo_char_simd_threshold)
+        return nuo_char_mismatch_dispatch(a, b, n);
+#endif
+    return nuo_char_mismatch_scalar(a, b, n);
+}
+
+inline bool nuo_char_equal(const char* a, const char* b, size_t n) noexcept {
+    if (n <= 32)
+        return nuo_char_equal_short(a, b, n);
+    return nuo_char_mismatch(a, b, n) == n;
+}
+
+/* m == 0 matches at 0 */
+inline size_t nuo_char_search(const char* h, size_t n,
+                              const char* s, size_t m) noexcept {
+    if (m == 0)
+        return 0;
+    if (m == 1)
+        return nuo_char_find(h, n, s[0]);
+#if defined(NUOSTL_ARCH_X86)
+    if (n >= nuo_char_simd_threshold)
+        return nuo_char_search_dispatch(h, n, s, m);
+#endif
+    return nuo_char_search_scalar(h, n, s, m);
+}
+
+/* First byte that is (Member) or is not (!Member) in set. */
+template<bool Member>
+size_t nuo_char_find_set(const char* p, size_t n,
+                         const nuo_char_set& set) noexcept {
+#if defined(NUOSTL_ARCH_X86)
+    if (n >= nuo_char_simd_threshold)
+        return nuo_char_find_set_dispatch<Member>(p, n, set);
+#endif
+    return nuo_char_find_set_scalar<Member>(p, n, set);
+}
+
+/*
+ * Membership bitmask of the 64 byte block at p (bit i for p[i]), bits at
+ * and past n are clear. Lets a caller walk many short runs, e.g. tokens,
+ * with bit scans instead of one search call per run.
+ */
+inline uint64_t nuo_char_set_block(const char* p, size_t n,
+                                   const nuo_char_set& set) noexcept {
+#if defined(NUOSTL_ARCH_X86)
+    if (n != 0)
+        return nuo_char_set_block_dispatch(p, n, set);
+#endif
+    return nuo_char_set_block_scalar(p, n, set);
+}
+
+/* memcmp-like three way compare of two byte strings of lengths n and m */
+inline int nuo_char_compare(const char* a, size_t n,
+                            const char* b, size_t m) noexcept {
+    size_t len = n < m ? n : m;
+    size_t k = nuo_char_mismatch(a, b, len);
+    if (k != len) {
+        return static_cast<unsigned char>(a[k]) <
+               static_cast<unsigned char>(b[k]) ? -1 : 1;
+    }
+    return n < m ? -1 : (n > m ? 1 : 0);
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef NUOSTL_CORE_DATA_TYPES_DETAIL_NUO_TUPLE_STORAGE_HPP_
+#define NUOSTL_CORE_DATA_TYPES_DETAIL_NUO_TUPLE_STORAGE_HPP_
+
+#include <stddef.h>
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Storage behind nuo_tuple. Every element lives in its own leaf base tagged
+ * with the element's logical index, and the storage class inherits all
+ * leaves in one flat pack expansion: no recursive instantiation, and
+ * get<I> is a single cast to leaf<I, T>. The order the leaves are listed
+ * in is the physical layout, which nuo_tuple_layout picks to remove
+ * padding.
+ */
+
+namespace nuostl {
+
+namespace detail {
+
+/* I-th type of a pack without recursion: overload resolution picks the base */
+template<size_t I, typename T>
+struct nuo_indexed {
+    using type = T;
+};
+
+template<typename Seq, typename... T>
+struct nuo_indexer;
+
+template<size_t... I, typename... T>
+struct nuo_indexer<std::index_sequence<I...>, T...> : nuo_indexed<I, T>... {};
+
+template<size_t I, typename T>
+nuo_indexed<I, T> nuo_select(const nuo_indexed<I, T>&);
+
+template<size_t I, typename... T>
+using nuo_type_at = typename decltype(
+    nuo_select<I>(nuo_indexer<std::index_sequence_for<T...>, T...>{}))::type;
+
+/* Logical index of the only T in the pack, sizeof...(U) if absent or repeated */
+template<typename T, typename... U>
+constexpr size_t nuo_unique_index() {
+    constexpr bool hit[] = {std::is_same_v<T, U>..., false};
+    size_t found = sizeof...(U);
+    for (size_t i = 0; i < sizeof...(U); i++) {
+        if (hit[i]) {
+            if (found != sizeof...(U))
+                return sizeof...(U);
+            found = i;
+        }
+    }
+    return found;
+}
+
+/* Empty element types take no space; references are stored as such */
+template<size_t I, typename T>
+struct nuo_tuple_leaf {
+    [[no_unique_address]] T value;
+};
+
+/*
+ * Physical order of the elements: non-empty leaves by decreasing
+ * alignment, then empty ones, declaration order among equals. Every size
+ * is a multiple of its alignment, so this leaves no padding between
+ * members and at most the tail padding up to the largest alignment.
+ */
+template<typename... T>
+struct nuo_tuple_layout {
+    static constexpr size_t n = sizeof...(T);
+
+    static constexpr std::array<size_t, n> order = [] {
+        using seq = std::index_sequence_for<T...>;
+        std::array<size_t, n> key = []<size_t... I>(std::index_sequence<I...>) {
+            return std::array<size_t, n>{
+                (std::is_empty_v<nuo_tuple_leaf<I, T>>
+                     ? 0 : alignof(nuo_tuple_leaf<I, T>))...};
+        }(seq{});
+        std::array<size_t, n> o{};
+        for (size_t i = 0; i < n; i++) {
+            size_t j = i;
+            for (; j > 0 && key[o[j - 1]] < key[i]; j--)
+                o[j] = o[j - 1];
+            o[j] = i;
+        }
+        return o;
+    }();
+
+    template<typename = std::make_index_sequence<n>>
+    struct physical;
+
+    template<size_t... S>
+    struct physical<std::index_sequence<S...>> {
+        using type = std::index_sequence<order[S]...>;
+    };
+
+    using sequence = typename physical<>::type;
+};
+
+/* Tags for the storage constructors */
+struct nuo_tuple_gen_t {};
+
+/* Arguments of a constructor call, addressable by index */
+template<typename Seq, typename... A>
+struct nuo_tuple_args;
+
+template<size_t... I, typename... A>
+struct nuo_tuple_args<std::index_sequence<I...>, A...> : nuo_tuple_leaf<I, A&&>... {
+    template<size_t J>
+    constexpr nuo_type_at<J, A...>&& get() const noexcept {
+        using U = nuo_type_at<J, A...>;
+        return static_cast<U&&>(static_cast<const nuo_tuple_leaf<J, U&&>&>(*this).value);
+    }
+};
+
+template<typename Seq, typename... T>
+struct nuo_tuple_storage;
+
+template<size_t... P, typename... T>
+struct nuo_tuple_storage<std::index_sequence<P...>, T...>
+    : nuo_tuple_leaf<P, nuo_type_at<P, T...>>... {
+    constexpr nuo_tuple_storage() = default;
+
+    /* Leaf P is initialized from gen(integral_constant<size_t, P>), narrowing allowed */
+    template<typename Gen>
+    constexpr nuo_tuple_storage(nuo_tuple_gen_t, Gen&& gen)
+        : nuo_tuple_leaf<P, nuo_type_at<P, T...>>(
+              gen(std::integral_constant<size_t, P>{}))... {}
+};
+
+}   /* namespace detail */
+
+}   /* namespace nuostl */
+
+#endif
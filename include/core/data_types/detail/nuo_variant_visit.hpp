@@ -0,0 +1,166 @@
+#ifndef NUOSTL_CORE_DATA_TYPES_DETAIL_NUO_VARIANT_VISIT_HPP_
+#define NUOSTL_CORE_DATA_TYPES_DETAIL_NUO_VARIANT_VISIT_HPP_
+
+#include <stddef.h>
+
+#include <array>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Visitation for nuo_variant. Several variants are visited through one
+ * flattened case number. Up to nuo_switch_max cases the dispatch is a
+ * switch whose case C calls the visitor directly on the alternatives
+ * encoded in C; cases past the real count are unreachable, so the compiler
+ * emits a bounds-free jump table (or a few compares) with the visitor
+ * inlined into each case. Larger products use one table of function
+ * pointers, still a single indirect branch per visit.
+ */
+
+namespace nuostl {
+
+namespace detail {
+
+inline constexpr size_t nuo_switch_max = 64;
+
+template<typename R, size_t N, size_t C, typename Call>
+__attribute__((always_inline)) inline constexpr R nuo_switch_case(Call& call) {
+    if constexpr (C < N)
+        return call(std::integral_constant<size_t, C>{});
+    else
+        __builtin_unreachable();
+}
+
+/* call(integral_constant<size_t, c>) for a runtime c < N <= nuo_switch_max */
+template<typename R, size_t N, typename Call>
+__attribute__((always_inline)) inline constexpr R nuo_switch(size_t c, Call&& call) {
+    static_assert(N <= nuo_switch_max, "nuo_switch: too many cases");
+    switch (c) {
+        case 0: return nuo_switch_case<R, N, 0>(call);
+        case 1: return nuo_switch_case<R, N, 1>(call);
+        case 2: return nuo_switch_case<R, N, 2>(call);
+        case 3: return nuo_switch_case<R, N, 3>(call);
+        case 4: return nuo_switch_case<R, N, 4>(call);
+        case 5: return nuo_switch_case<R, N, 5>(call);
+        case 6: return nuo_switch_case<R, N, 6>(call);
+        case 7: return nuo_switch_case<R, N, 7>(call);
+        case 8: return nuo_switch_case<R, N, 8>(call);
+        case 9: return nuo_switch_case<R, N, 9>(call);
+        case 10: return nuo_switch_case<R, N, 10>(call);
+        case 11: return nuo_switch_case<R, N, 11>(call);
+        case 12: return nuo_switch_case<R, N, 12>(call);
+        case 13: return nuo_switch_case<R, N, 13>(call);
+        case 14: return nuo_switch_case<R, N, 14>(call);
+        case 15: return nuo_switch_case<R, N, 15>(call);
+        case 16: return nuo_switch_case<R, N, 16>(call);
+        case 17: return nuo_switch_case<R, N, 17>(call);
+        case 18: return nuo_switch_case<R, N, 18>(call);
+        case 19: return nuo_switch_case<R, N, 19>(call);
+        case 20: return nuo_switch_case<R, N, 20>(call);
+        case 21: return nuo_switch_case<R, N, 21>(call);
+        case 22: return nuo_switch_case<R, N, 22>(call);
+        case 23: return nuo_switch_case<R, N, 23>(call);
+        case 24: return nuo_switch_case<R, N, 24>(call);
+        case 25: return nuo_switch_case<R, N, 25>(call);
+        case 26: return nuo_switch_case<R, N, 26>(call);
+        case 27: return nuo_switch_case<R, N, 27>(call);
+        case 28: return nuo_switch_case<R, N, 28>(call);
+        case 29: return nuo_switch_case<R, N, 29>(call);
+        case 30: return nuo_switch_case<R, N, 30>(call);
+        case 31: return nuo_switch_case<R, N, 31>(call);
+        case 32: return nuo_switch_case<R, N, 32>(call);
+        case 33: return nuo_switch_case<R, N, 33>(call);
+        case 34: return nuo_switch_case<R, N, 34>(call);
+        case 35: return nuo_switch_case<R, N, 35>(call);
+        case 36: return nuo_switch_case<R, N, 36>(call);
+        case 37: return nuo_switch_case<R, N, 37>(call);
+        case 38: return nuo_switch_case<R, N, 38>(call);
+        case 39: return nuo_switch_case<R, N, 39>(call);
+        case 40: return nuo_switch_case<R, N, 40>(call);
+        case 41: return nuo_switch_case<R, N, 41>(call);
+        case 42: return nuo_switch_case<R, N, 42>(call);
+        case 43: return nuo_switch_case<R, N, 43>(call);
+        case 44: return nuo_switch_case<R, N, 44>(call);
+        case 45: return nuo_switch_case<R, N, 45>(call);
+        case 46: return nuo_switch_case<R, N, 46>(call);
+        case 47: return nuo_switch_case<R, N, 47>(call);
+        case 48: return nuo_switch_case<R, N, 48>(call);
+        case 49: return nuo_switch_case<R, N, 49>(call);
+        case 50: return nuo_switch_case<R, N, 50>(call);
+        case 51: return nuo_switch_case<R, N, 51>(call);
+        case 52: return nuo_switch_case<R, N, 52>(call);
+        case 53: return nuo_switch_case<R, N, 53>(call);
+        case 54: return nuo_switch_case<R, N, 54>(call);
+        case 55: return nuo_switch_case<R, N, 55>(call);
+        case 56: return nuo_switch_case<R, N, 56>(call);
+        case 57: return nuo_switch_case<R, N, 57>(call);
+        case 58: return nuo_switch_case<R, N, 58>(call);
+        case 59: return nuo_switch_case<R, N, 59>(call);
+        case 60: return nuo_switch_case<R, N, 60>(call);
+        case 61: return nuo_switch_case<R, N, 61>(call);
+        case 62: return nuo_switch_case<R, N, 62>(call);
+        case 63: return nuo_switch_case<R, N, 63>(call);
+        default: break;
+    }
+    __builtin_unreachable();
+}
+
+/* Case C of a table dispatch, the same for every call site of one Call */
+template<typename R, typename Call, typename Seq>
+inline constexpr auto nuo_switch_table = nullptr;
+
+template<typename R, typename Call, size_t... C>
+inline constexpr std::array<R (*)(Call&), sizeof...(C)>
+nuo_switch_table<R, Call, std::index_sequence<C...>> = {+[](Call& f) -> R {
+    return f(std::integral_constant<size_t, C>{});
+}...};
+
+/* call(integral_constant<size_t, c>) through a table, any N */
+template<typename R, size_t N, typename Call>
+constexpr R nuo_table_switch(size_t c, Call&& call) {
+    return nuo_switch_table<R, std::remove_reference_t<Call>, std::make_index_sequence<N>>[c](call);
+}
+
+/* Alternative indices packed into a flattened case number, last one fastest */
+template<size_t C, size_t... N>
+struct nuo_visit_decode {
+    static constexpr std::array<size_t, sizeof...(N)> index = [] {
+        std::array<size_t, sizeof...(N)> n{N...}, r{};
+        size_t c = C;
+        for (size_t k = sizeof...(N); k-- > 0;) {
+            r[k] = c % n[k];
+            c /= n[k];
+        }
+        return r;
+    }();
+};
+
+/*
+ * Visit the variants V... with the visitor F, R is the common result. Access
+ * supplies size<V> and get<I>(V&&) for an engaged variant; valueless
+ * variants have been rejected by the caller.
+ */
+template<typename Access, typename R, typename F, typename... V>
+constexpr R nuo_visit_impl(F&& f, V&&... v) {
+    constexpr size_t total = (Access::template size<V> * ... * 1);
+    size_t c = 0;
+    ((c = c * Access::template size<V> + Access::index(v)), ...);
+    auto call = [&](auto c) -> R {
+        using decode = nuo_visit_decode<decltype(c)::value, Access::template size<V>...>;
+        return [&]<size_t... K>(std::index_sequence<K...>) -> R {
+            return std::invoke(std::forward<F>(f),
+                               Access::template get<decode::index[K]>(std::forward<V>(v))...);
+        }(std::index_sequence_for<V...>{});
+    };
+    if constexpr (total <= nuo_switch_max)
+        return nuo_switch<R, total>(c, call);
+    else
+        return nuo_table_switch<R, total>(c, call);
+}
+
+}   /* namespace detail */
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,305 @@
+#ifndef NUOSTL_CORE_DATA_TYPES_NUO_ANY_HPP_
+#define NUOSTL_CORE_DATA_TYPES_NUO_ANY_HPP_
+
+#include <stddef.h>
+#include <string.h>
+
+#include <any>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+/*
+ * Type-erased value with an inline buffer of Capacity bytes (three pointers
+ * for nuo_any). Values that fit, are at most max_align_t aligned and are
+ * nothrow move constructible live in the buffer, anything else on the
+ * heap. Each stored type has one constant descriptor; its copy, move and
+ * destroy entries are null when the operation is a plain byte copy or
+ * nothing, which covers trivially copyable payloads in the buffer and the
+ * pointer of heap payloads, so those copy and move with a fixed-size
+ * memcpy and no indirect call. Failed casts throw std::bad_any_cast.
+ */
+
+namespace nuostl {
+
+namespace detail {
+
+struct nuo_any_desc {
+    const std::type_info* type;
+    /* construct dst from src; null: memcpy the buffer */
+    void (*copy)(void* dst, const void* src);
+    /* construct dst from src and end src; null: memcpy the buffer */
+    void (*move)(void* dst, void* src) noexcept;
+    /* null: nothing to do */
+    void (*destroy)(void* p) noexcept;
+    bool is_inline;
+};
+
+}   /* namespace detail */
+
+template<size_t Capacity = 3 * sizeof(void*)>
+class nuo_basic_any {
+private:
+    static_assert(Capacity >= sizeof(void*), "nuo_basic_any: buffer must hold a pointer");
+
+    template<typename T>
+    static constexpr bool fits_inline = sizeof(T) <= Capacity &&
+        alignof(T) <= alignof(max_align_t) && std::is_nothrow_move_constructible_v<T>;
+
+    template<typename T>
+    struct ops {
+        static void copy_inline(void* dst, const void* src) {
+            ::new (dst) T(*static_cast<const T*>(src));
+        }
+
+        static void move_inline(void* dst, void* src) noexcept {
+            T* s = static_cast<T*>(src);
+            ::new (dst) T(std::move(*s));
+            s->~T();
+        }
+
+        static void destroy_inline(void* p) noexcept {
+            static_cast<T*>(p)->~T();
+        }
+
+        static void copy_heap(void* dst, const void* src) {
+            T* p = new T(**static_cast<T* const*>(src));
+            memcpy(dst, &p, sizeof(p));
+        }
+
+        static void destroy_heap(void* p) noexcept {
+            delete *static_cast<T**>(p);
+        }
+
+        static constexpr bool trivial = std::is_trivially_copyable_v<T>;
+
+        static constexpr detail::nuo_any_desc desc = fits_inline<T>
+            ? detail::nuo_any_desc{&typeid(T), trivial ? nullptr : &copy_inline,
+                                   trivial ? nullptr : &move_inline,
+                                   std::is_trivially_destructible_v<T> ? nullptr : &destroy_inline,
+                                   true}
+            : detail::nuo_any_desc{&typeid(T), &copy_heap, nullptr, &destroy_heap, false};
+    };
+
+    alignas(max_align_t) unsigned char buf_[Capacity];
+    const detail::nuo_any_desc* desc_ = nullptr;
+
+    template<typename T, typename... Args>
+    T& construct(Args&&... args) {
+        T* p;
+        if constexpr (fits_inline<T>) {
+            p = ::new (static_cast<void*>(buf_)) T(std::forward<Args>(args)...);
+        } else {
+            p = new T(std::forward<Args>(args)...);
+            memcpy(buf_, &p, sizeof(p));
+        }
+        desc_ = &ops<T>::desc;
+        return *p;
+    }
+
+    void copy_from(const nuo_basic_any& o) {
+        if (o.desc_ == nullptr)
+            return;
+        if (o.desc_->copy)
+            o.desc_->copy(buf_, o.buf_);
+        else
+            memcpy(buf_, o.buf_, Capacity);
+        desc_ = o.desc_;
+    }
+
+    void move_from(nuo_basic_any& o) noexcept {
+        if (o.desc_ == nullptr)
+            return;
+        if (o.desc_->move)
+            o.desc_->move(buf_, o.buf_);
+        else
+            memcpy(buf_, o.buf_, Capacity);
+        desc_ = o.desc_;
+        o.desc_ = nullptr;
+    }
+
+    template<typename T>
+    bool holds() const noexcept {
+        if (desc_ == &ops<T>::desc)
+            return true;
+        /* the same type can get distinct descriptors across shared objects */
+        return desc_ != nullptr && *desc_->type == typeid(T);
+    }
+
+    template<typename T>
+    T* unchecked() noexcept {
+        if (desc_->is_inline)
+            return std::launder(reinterpret_cast<T*>(buf_));
+        T* p;
+        memcpy(&p, buf_, sizeof(p));
+        return p;
+    }
+
+    template<typename T>
+    const T* unchecked() const noexcept {
+        return const_cast<nuo_basic_any*>(this)->template unchecked<T>();
+    }
+public:
+    static constexpr size_t capacity = Capacity;
+
+    /* Constructor */
+    constexpr nuo_basic_any() noexcept {}
+
+    template<typename U, typename T = std::decay_t<U>>
+        requires (!std::is_same_v<T, nuo_basic_any> &&
+                  !std::is_same_v<std::remove_cvref_t<U>, std::in_place_type_t<T>> &&
+                  std::is_copy_constructible_v<T>)
+    nuo_basic_any(U&& value) {
+        construct<T>(std::forward<U>(value));
+    }
+
+    template<typename T, typename... Args>
+        requires (std::is_copy_constructible_v<std::decay_t<T>> &&
+                  std::is_constructible_v<std::decay_t<T>, Args&&...>)
+    explicit nuo_basic_any(std::in_place_type_t<T>, Args&&... args) {
+        construct<std::decay_t<T>>(std::forward<Args>(args)...);
+    }
+
+    /* Destructor */
+    ~nuo_basic_any() {
+        reset();
+    }
+
+    /* Copy Constructor */
+    nuo_basic_any(const nuo_basic_any& o) {
+        copy_from(o);
+    }
+
+    nuo_basic_any(nuo_basic_any&& o) noexcept {
+        move_from(o);
+    }
+
+    /* Operator */
+    /* Group 0 */
+    nuo_basic_any& operator=(const nuo_basic_any& o) {
+        if (this != &o) {
+            nuo_basic_any tmp(o);
+            reset();
+            move_from(tmp);
+        }
+        return *this;
+    }
+
+    nuo_basic_any& operator=(nuo_basic_any&& o) noexcept {
+        if (this != &o) {
+            reset();
+            move_from(o);
+        }
+        return *this;
+    }
+
+    template<typename U, typename T = std::decay_t<U>>
+        requires (!std::is_same_v<T, nuo_basic_any> && std::is_copy_constructible_v<T>)
+    nuo_basic_any& operator=(U&& value) {
+        nuo_basic_any tmp(std::forward<U>(value));
+        reset();
+        move_from(tmp);
+        return *this;
+    }
+
+    /* Modifiers */
+    template<typename T, typename... Args>
+        requires (std::is_copy_constructible_v<std::decay_t<T>> &&
+                  std::is_constructible_v<std::decay_t<T>, Args&&...>)
+    std::decay_t<T>& emplace(Args&&... args) {
+        reset();
+        return construct<std::decay_t<T>>(std::forward<Args>(args)...);
+    }
+
+    void reset() noexcept {
+        if (desc_ != nullptr && desc_->destroy)
+            desc_->destroy(buf_);
+        desc_ = nullptr;
+    }
+
+    void swap(nuo_basic_any& o) noexcept {
+        nuo_basic_any tmp(std::move(o));
+        o.move_from(*this);
+        move_from(tmp);
+    }
+
+    friend void swap(nuo_basic_any& a, nuo_basic_any& b) noexcept {
+        a.swap(b);
+    }
+
+    /* Observers */
+    bool has_value() const noexcept {
+        return desc_ != nullptr;
+    }
+
+    const std::type_info& type() const noexcept {
+        return desc_ ? *desc_->type : typeid(void);
+    }
+
+    /* Whether the value lives in the inline buffer */
+    bool is_inline() const noexcept {
+        return desc_ != nullptr && desc_->is_inline;
+    }
+
+    /* The value if it has type T, else nullptr */
+    template<typename T>
+    T* get_if() noexcept {
+        using U = std::remove_cv_t<T>;
+        return holds<U>() ? unchecked<U>() : nullptr;
+    }
+
+    template<typename T>
+    const T* get_if() const noexcept {
+        using U = std::remove_cv_t<T>;
+        return holds<U>() ? unchecked<U>() : nullptr;
+    }
+};
+
+using nuo_any = nuo_basic_any<>;
+
+template<typename T, size_t Capacity>
+const T* nuo_any_cast(const nuo_basic_any<Capacity>* a) noexcept {
+    return a ? a->template get_if<T>() : nullptr;
+}
+
+template<typename T, size_t Capacity>
+T* nuo_any_cast(nuo_basic_any<Capacity>* a) noexcept {
+    return a ? a->template get_if<T>() : nullptr;
+}
+
+template<typename T, size_t Capacity>
+T nuo_any_cast(const nuo_basic_any<Capacity>& a) {
+    using U = std::remove_cvref_t<T>;
+    const U* p = nuo_any_cast<U>(&a);
+    if (p == nullptr)
+        throw std::bad_any_cast();
+    return static_cast<T>(*p);
+}
+
+template<typename T, size_t Capacity>
+T nuo_any_cast(nuo_basic_any<Capacity>& a) {
+    using U = std::remove_cvref_t<T>;
+    U* p = nuo_any_cast<U>(&a);
+    if (p == nullptr)
+        throw std::bad_any_cast();
+    return static_cast<T>(*p);
+}
+
+template<typename T, size_t Capacity>
+T nuo_any_cast(nuo_basic_any<Capacity>&& a) {
+    using U = std::remove_cvref_t<T>;
+    U* p = nuo_any_cast<U>(&a);
+    if (p == nullptr)
+        throw std::bad_any_cast();
+    return static_cast<T>(std::move(*p));
+}
+
+template<typename T, typename... Args>
+nuo_any nuo_make_any(Args&&... args) {
+    return nuo_any(std::in_place_type<T>, std::forward<Args>(args)...);
+}
+
+} /* namespace nuostl */
+
+#endif
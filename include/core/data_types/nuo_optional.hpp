@@ -0,0 +1,393 @@
+#ifndef NUOSTL_CORE_DATA_TYPES_NUO_OPTIONAL_HPP_
+#define NUOSTL_CORE_DATA_TYPES_NUO_OPTIONAL_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <compare>
+#include <concepts>
+#include <functional>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "../../nuo_typedefs.hpp"
+
+/*
+ * Optional value. Where T has a niche, a bit pattern no valid T takes,
+ * the empty state is that pattern written over T's storage and
+ * sizeof(nuo_optional<T>) == sizeof(T); otherwise a flag follows the value
+ * as in std::optional. Absent values are reported with std::nullopt and
+ * std::bad_optional_access.
+ *
+ * The niche is chosen by the second template argument, nuo_niche<T> by
+ * default, which only packs bool: every other bit pattern of a built-in
+ * type may be a value. nuo_idx_niche, nuo_sentinel_niche, nuo_ptr_niche
+ * and nuo_nan_niche pack types whose users know a pattern never occurs.
+ * A niche policy provides
+ *
+ *     static constexpr bool available = true;
+ *     static void set_empty(unsigned char* p) noexcept;
+ *     static bool is_empty(const unsigned char* p) noexcept;
+ *
+ * operating on the sizeof(T) bytes of storage with no live T in them
+ * (set_empty) or possibly holding one (is_empty). Storing the niche value
+ * itself in the optional reads back as empty.
+ */
+
+namespace nuostl {
+
+/* No niche: a separate flag */
+template<typename T, typename = void>
+struct nuo_niche {
+    static constexpr bool available = false;
+};
+
+/* Empty when the object representation of T equals Pattern, read as U */
+template<typename T, typename U, U Pattern>
+struct nuo_niche_bits {
+    static_assert(sizeof(T) == sizeof(U), "nuo_niche_bits: pattern size must match");
+
+    static constexpr bool available = true;
+
+    static void set_empty(unsigned char* p) noexcept {
+        U v = Pattern;
+        memcpy(p, &v, sizeof(U));
+    }
+
+    static bool is_empty(const unsigned char* p) noexcept {
+        U v;
+        memcpy(&v, p, sizeof(U));
+        return v == Pattern;
+    }
+};
+
+/* An integer that never takes the value Sentinel */
+template<typename T, T Sentinel>
+    requires std::is_integral_v<T>
+struct nuo_sentinel_niche : nuo_niche_bits<T, T, Sentinel> {};
+
+/* Indices use the all-ones value, never a valid position */
+using nuo_idx_niche = nuo_sentinel_niche<idx_t, static_cast<idx_t>(-1)>;
+
+/*
+ * Pointers that never hold the all-ones address. That is a valid address
+ * (MAP_FAILED is one), so the default for pointers stays the flag.
+ */
+template<typename P>
+    requires std::is_pointer_v<P>
+struct nuo_ptr_niche : nuo_niche_bits<P, uintptr_t, UINTPTR_MAX> {};
+
+/*
+ * float or double that never hold one signaling NaN payload. Arithmetic
+ * only yields quiet NaNs, but bits read from a file or the network may
+ * take it, so the default for floating point stays the flag.
+ */
+template<typename T>
+struct nuo_nan_niche;
+
+template<>
+struct nuo_nan_niche<float> : nuo_niche_bits<float, uint32_t, 0xffbadbadu> {};
+
+template<>
+struct nuo_nan_niche<double> : nuo_niche_bits<double, uint64_t, 0xfff4deadbeefbad1ull> {};
+
+/* No bool holds any byte but 0 and 1 */
+template<>
+struct nuo_niche<bool> : nuo_niche_bits<bool, uint8_t, 2> {};
+
+template<typename T, typename Niche = nuo_niche<T>>
+class nuo_optional {
+private:
+    static_assert(std::is_object_v<T> && !std::is_array_v<T> &&
+                  !std::is_same_v<std::remove_cv_t<T>, std::nullopt_t>,
+                  "nuo_optional needs a non-array object type");
+
+    static constexpr bool packed = Niche::available;
+
+    struct no_flag {};
+
+    static constexpr bool trivial_copy = std::is_trivially_copy_constructible_v<T>;
+    static constexpr bool trivial_move = std::is_trivially_move_constructible_v<T>;
+    static constexpr bool trivial_copy_assign = trivial_copy &&
+        std::is_trivially_copy_assignable_v<T> && std::is_trivially_destructible_v<T>;
+    static constexpr bool trivial_move_assign = trivial_move &&
+        std::is_trivially_move_assignable_v<T> && std::is_trivially_destructible_v<T>;
+
+    alignas(T) unsigned char buf_[sizeof(T)];
+    [[no_unique_address]] std::conditional_t<packed, no_flag, bool> engaged_;
+
+    T* ptr() noexcept {
+        return std::launder(reinterpret_cast<T*>(buf_));
+    }
+
+    const T* ptr() const noexcept {
+        return std::launder(reinterpret_cast<const T*>(buf_));
+    }
+
+    void set_empty() noexcept {
+        if constexpr (packed)
+            Niche::set_empty(buf_);
+        else
+            engaged_ = false;
+    }
+
+    template<typename... Args>
+    void construct(Args&&... args) {
+        ::new (static_cast<void*>(buf_)) T(std::forward<Args>(args)...);
+        if constexpr (!packed)
+            engaged_ = true;
+    }
+
+    template<typename Other>
+    void construct_from(Other&& o) {
+        if (o.has_value())
+            construct(*std::forward<Other>(o));
+        else
+            set_empty();
+    }
+
+    template<typename Other>
+    void assign_from(Other&& o) {
+        if (o.has_value()) {
+            if (has_value())
+                **this = *std::forward<Other>(o);
+            else
+                construct(*std::forward<Other>(o));
+        } else {
+            reset();
+        }
+    }
+public:
+    using value_type = T;
+
+    /* Constructor */
+    nuo_optional() noexcept {
+        set_empty();
+    }
+
+    nuo_optional(std::nullopt_t) noexcept {
+        set_empty();
+    }
+
+    template<typename U = T>
+        requires (std::is_constructible_v<T, U&&> &&
+                  !std::is_same_v<std::remove_cvref_t<U>, nuo_optional> &&
+                  !std::is_same_v<std::remove_cvref_t<U>, std::in_place_t> &&
+                  !std::is_same_v<std::remove_cvref_t<U>, std::nullopt_t>)
+    explicit(!std::is_convertible_v<U&&, T>)
+    nuo_optional(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>) {
+        construct(std::forward<U>(value));
+    }
+
+    template<typename... Args>
+        requires std::is_constructible_v<T, Args&&...>
+    explicit nuo_optional(std::in_place_t, Args&&... args) {
+        construct(std::forward<Args>(args)...);
+    }
+
+    /* Destructor */
+    ~nuo_optional() requires std::is_trivially_destructible_v<T> = default;
+    ~nuo_optional() {
+        reset();
+    }
+
+    /* Copy Constructor */
+    nuo_optional(const nuo_optional&) requires trivial_copy = default;
+    nuo_optional(const nuo_optional& o)
+        requires (!trivial_copy && std::is_copy_constructible_v<T>) {
+        construct_from(o);
+    }
+
+    nuo_optional(nuo_optional&&) requires trivial_move = default;
+    nuo_optional(nuo_optional&& o) noexcept(std::is_nothrow_move_constructible_v<T>)
+        requires (!trivial_move && std::is_move_constructible_v<T>) {
+        construct_from(std::move(o));
+    }
+
+    /* Operator */
+    /* Group 0 */
+    nuo_optional& operator=(const nuo_optional&) requires trivial_copy_assign = default;
+    nuo_optional& operator=(const nuo_optional& o) requires (!trivial_copy_assign &&
+        std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>) {
+        if (this != &o)
+            assign_from(o);
+        return *this;
+    }
+
+    nuo_optional& operator=(nuo_optional&&) requires trivial_move_assign = default;
+    nuo_optional& operator=(nuo_optional&& o) noexcept(
+        std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>
+    ) requires (!trivial_move_assign &&
+        std::is_move_constructible_v<T> && std::is_move_assignable_v<T>) {
+        if (this != &o)
+            assign_from(std::move(o));
+        return *this;
+    }
+
+    nuo_optional& operator=(std::nullopt_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    template<typename U = T>
+        requires (!std::is_same_v<std::remove_cvref_t<U>, nuo_optional> &&
+                  !std::is_same_v<std::remove_cvref_t<U>, std::nullopt_t> &&
+                  std::is_constructible_v<T, U&&> && std::is_assignable_v<T&, U&&>)
+    nuo_optional& operator=(U&& value) {
+        if (has_value())
+            **this = std::forward<U>(value);
+        else
+            construct(std::forward<U>(value));
+        return *this;
+    }
+
+    /* Group 1 */
+    friend bool operator==(const nuo_optional& a, const nuo_optional& b)
+        requires std::equality_comparable<T> {
+        if (a.has_value() != b.has_value())
+            return false;
+        return !a.has_value() || *a == *b;
+    }
+
+    friend bool operator==(const nuo_optional& a, std::nullopt_t) noexcept {
+        return !a.has_value();
+    }
+
+    /* Empty orders before any value */
+    template<std::three_way_comparable U = T>
+    friend std::compare_three_way_result_t<U> operator<=>(const nuo_optional& a,
+                                                          const nuo_optional& b) {
+        if (a.has_value() && b.has_value())
+            return *a <=> *b;
+        return a.has_value() <=> b.has_value();
+    }
+
+    friend std::strong_ordering operator<=>(const nuo_optional& a, std::nullopt_t) noexcept {
+        return a.has_value() <=> false;
+    }
+
+    /* Observers */
+    bool has_value() const noexcept {
+        if constexpr (packed)
+            return !Niche::is_empty(buf_);
+        else
+            return engaged_;
+    }
+
+    explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    T& operator*() & noexcept { return *ptr(); }
+    const T& operator*() const& noexcept { return *ptr(); }
+    T&& operator*() && noexcept { return std::move(*ptr()); }
+
+    T* operator->() noexcept { return ptr(); }
+    const T* operator->() const noexcept { return ptr(); }
+
+    T& value() & {
+        if (!has_value())
+            throw std::bad_optional_access();
+        return *ptr();
+    }
+
+    const T& value() const& {
+        if (!has_value())
+            throw std::bad_optional_access();
+        return *ptr();
+    }
+
+    T&& value() && {
+        return std::move(value());
+    }
+
+    template<typename U>
+    T value_or(U&& fallback) const& {
+        return has_value() ? *ptr() : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    template<typename U>
+    T value_or(U&& fallback) && {
+        return has_value() ? std::move(*ptr()) : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    /* Monadic operations */
+    template<typename F>
+    auto transform(F&& f) const& {
+        using U = std::remove_cv_t<std::invoke_result_t<F, const T&>>;
+        if (has_value())
+            return nuo_optional<U>(std::invoke(std::forward<F>(f), *ptr()));
+        return nuo_optional<U>();
+    }
+
+    template<typename F>
+    auto and_then(F&& f) const& {
+        using R = std::remove_cvref_t<std::invoke_result_t<F, const T&>>;
+        if (has_value())
+            return std::invoke(std::forward<F>(f), *ptr());
+        return R();
+    }
+
+    /* Modifiers */
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        reset();
+        construct(std::forward<Args>(args)...);
+        return *ptr();
+    }
+
+    void reset() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            if (has_value())
+                ptr()->~T();
+        }
+        set_empty();
+    }
+
+    void swap(nuo_optional& o) noexcept(
+        std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>
+    ) {
+        if (has_value() && o.has_value()) {
+            using std::swap;
+            swap(**this, *o);
+        } else if (has_value()) {
+            o.construct(std::move(**this));
+            reset();
+        } else if (o.has_value()) {
+            construct(std::move(*o));
+            o.reset();
+        }
+    }
+
+    friend void swap(nuo_optional& a, nuo_optional& b) noexcept(noexcept(a.swap(b))) {
+        a.swap(b);
+    }
+};
+
+/*
+ * Comparison with a plain value. A namespace-scope template rather than a
+ * hidden friend, so operands that merely mention nuo_optional in their
+ * template arguments (iterators of a vector of them) fail deduction
+ * instead of recursing through the constraint.
+ */
+template<typename T, typename Niche, typename U>
+    requires (!std::is_same_v<std::remove_cvref_t<U>, nuo_optional<T, Niche>> &&
+              std::equality_comparable_with<T, U>)
+bool operator==(const nuo_optional<T, Niche>& a, const U& b) {
+    return a.has_value() && *a == b;
+}
+
+template<typename T>
+nuo_optional(T) -> nuo_optional<T>;
+
+template<typename T>
+nuo_optional<std::decay_t<T>> nuo_make_optional(T&& value) {
+    return nuo_optional<std::decay_t<T>>(std::forward<T>(value));
+}
+
+} /* namespace nuostl */
+
+#endif
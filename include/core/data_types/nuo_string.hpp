@@ -0,0 +1,649 @@
+#ifndef NUOSTL_CORE_DATA_TYPES_NUO_STRING_HPP_
+#define NUOSTL_CORE_DATA_TYPES_NUO_STRING_HPP_
+
+#include <stddef.h>
+#include <string.h>
+
+#include <bit>
+#include <compare>
+#include <initializer_list>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "../allocators/nuo_malloc_allocator.hpp"
+#include "./detail/nuo_char_simd.hpp"
+
+namespace nuostl {
+
+/*
+ * Byte string with a 23 character small string buffer.
+ *
+ * Layout (24 bytes on 64-bit, little endian):
+ *   long  : | char* ptr | size | capacity, top bit set |
+ *   short : | char buf[23]                | 23 - size |
+ * The last byte of a short string is 23 - size, so a full short string
+ * uses it as the terminating '\0'. The top bit of that byte tells the two
+ * representations apart.
+ *
+ * Growth is geometric (x1.5). With an allocator providing reallocate()
+ * (e.g. nuo_malloc_allocator) long strings grow in place instead of
+ * allocate + copy + free.
+ */
+template<typename Alloc = nuo_malloc_allocator<char>>
+class nuo_basic_string {
+    static_assert(std::is_same_v<typename Alloc::value_type, char>,
+        "nuo_basic_string: allocator value_type must be char");
+    static_assert(std::endian::native == std::endian::little,
+        "nuo_basic_string: the small string layout assumes little endian");
+public:
+    using value_type = char;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = char&;
+    using const_reference = const char&;
+    using pointer = char*;
+    using const_pointer = const char*;
+    using iterator = char*;
+    using const_iterator = const char*;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+    static constexpr size_type sso_capacity = 2 * sizeof(size_type) +
+                                              sizeof(char*) - 1;
+
+private:
+    using alloc_traits = std::allocator_traits<Alloc>;
+
+    static constexpr size_type long_flag =
+        static_cast<size_type>(1) << (8 * sizeof(size_type) - 1);
+    static constexpr unsigned char short_flag = 0x80;
+
+    static constexpr bool can_reallocate = requires(Alloc& a, char* p) {
+        { a.reallocate(p, size_type{}, size_type{}) } -> std::same_as<char*>;
+    };
+
+    struct long_rep {
+        char* ptr;
+        size_type size;
+        size_type cap;      /* excludes the '\0', top bit is long_flag */
+    };
+
+    struct short_rep {
+        char buf[sso_capacity];
+        unsigned char spare;    /* sso_capacity - size */
+    };
+
+    /* reading the inactive member is a documented gcc/clang extension */
+    union rep {
+        long_rep l;
+        short_rep s;
+    };
+
+    rep r_;
+    [[no_unique_address]] Alloc alloc_;
+
+    bool is_long() const noexcept {
+        return (r_.s.spare & short_flag) != 0;
+    }
+
+    void set_short_empty() noexcept {
+        r_.s.buf[0] = '\0';
+        r_.s.spare = static_cast<unsigned char>(sso_capacity);
+    }
+
+    void set_short_size(size_type n) noexcept {
+        if (n < sso_capacity)
+            r_.s.buf[n] = '\0';
+        r_.s.spare = static_cast<unsigned char>(sso_capacity - n);
+    }
+
+    void set_size(size_type n) noexcept {
+        if (is_long()) {
+            r_.l.size = n;
+            r_.l.ptr[n] = '\0';
+        } else {
+            set_short_size(n);
+        }
+    }
+
+    char* allocate_buf(size_type cap) {
+        return alloc_traits::allocate(alloc_, cap + 1);
+    }
+
+    void release() noexcept {
+        if (is_long())
+            alloc_traits::deallocate(alloc_, r_.l.ptr, capacity() + 1);
+    }
+
+    size_type next_capacity(size_type needed) const {
+        if (needed > max_size())
+            throw std::length_error("nuo_string: length exceeds max_size");
+        size_type cap = capacity();
+        size_type grown = cap + cap / 2;
+        if (grown > max_size())
+            grown = max_size();
+        return needed > grown ? needed : grown;
+    }
+
+    /* new_cap > capacity(), contents are kept */
+    void grow_to(size_type new_cap) {
+        size_type n = size();
+        if (is_long()) {
+            size_type old_cap = capacity();
+            char* p;
+            if constexpr (can_reallocate) {
+                p = alloc_.reallocate(r_.l.ptr, old_cap + 1, new_cap + 1);
+            } else {
+                p = allocate_buf(new_cap);
+                memcpy(p, r_.l.ptr, n + 1);
+                alloc_traits::deallocate(alloc_, r_.l.ptr, old_cap + 1);
+            }
+            r_.l.ptr = p;
+            r_.l.cap = new_cap | long_flag;
+        } else {
+            char* p = allocate_buf(new_cap);
+            memcpy(p, r_.s.buf, n);
+            p[n] = '\0';
+            r_.l.ptr = p;
+            r_.l.size = n;
+            r_.l.cap = new_cap | long_flag;
+        }
+    }
+
+    void init(const char* s, size_type n) {
+        if (n <= sso_capacity) {
+            memcpy(r_.s.buf, s, n);
+            set_short_size(n);
+        } else {
+            if (n > max_size())
+                throw std::length_error("nuo_string: length exceeds max_size");
+            char* p = allocate_buf(n);
+            memcpy(p, s, n);
+            p[n] = '\0';
+            r_.l.ptr = p;
+            r_.l.size = n;
+            r_.l.cap = n | long_flag;
+        }
+    }
+
+    void check_pos(size_type pos) const {
+        if (pos > size())
+            throw std::out_of_range("nuo_string: position out of range");
+    }
+
+public:
+    /* Constructor */
+    nuo_basic_string() noexcept(noexcept(Alloc())) : alloc_() {
+        set_short_empty();
+    }
+    explicit nuo_basic_string(const Alloc& a) noexcept : alloc_(a) {
+        set_short_empty();
+    }
+    nuo_basic_string(const char* s, const Alloc& a = Alloc()) : alloc_(a) {
+        init(s, strlen(s));
+    }
+    nuo_basic_string(const char* s, size_type n, const Alloc& a = Alloc()) :
+        alloc_(a) {
+        init(s, n);
+    }
+    nuo_basic_string(size_type n, char c, const Alloc& a = Alloc()) :
+        alloc_(a) {
+        set_short_empty();
+        resize(n, c);
+    }
+    explicit nuo_basic_string(std::string_view sv, const Alloc& a = Alloc()) :
+        alloc_(a) {
+        init(sv.data(), sv.size());
+    }
+    nuo_basic_string(std::initializer_list<char> il,
+                     const Alloc& a = Alloc()) : alloc_(a) {
+        init(il.begin(), il.size());
+    }
+    nuo_basic_string(std::nullptr_t) = delete;
+
+    /* Destructor */
+    ~nuo_basic_string() {
+        release();
+    }
+
+    /* Copy Constructor */
+    nuo_basic_string(const nuo_basic_string& other) :
+        alloc_(alloc_traits::select_on_container_copy_construction(
+            other.alloc_)) {
+        if (other.is_long())
+            init(other.r_.l.ptr, other.r_.l.size);
+        else
+            r_ = other.r_;
+    }
+    nuo_basic_string(nuo_basic_string&& other) noexcept :
+        r_(other.r_), alloc_(std::move(other.alloc_)) {
+        other.set_short_empty();
+    }
+
+    /* Operator */
+    /* Group 0 */
+    nuo_basic_string& operator=(const nuo_basic_string& other) {
+        if (this == &other)
+            return *this;
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+            /* the old buffer goes back to the allocator it came from */
+            if (!alloc_traits::is_always_equal::value && alloc_ != other.alloc_) {
+                release();
+                set_short_empty();
+            }
+            alloc_ = other.alloc_;
+        }
+        return assign(other.data(), other.size());
+    }
+    nuo_basic_string& operator=(nuo_basic_string&& other) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_traits::is_always_equal::value
+    ) {
+        if (this == &other)
+            return *this;
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value
+                      || alloc_traits::is_always_equal::value) {
+            release();
+            if constexpr (
+                alloc_traits::propagate_on_container_move_assignment::value)
+                alloc_ = std::move(other.alloc_);
+            r_ = other.r_;
+            other.set_short_empty();
+        } else {
+            if (alloc_ == other.alloc_) {
+                release();
+                r_ = other.r_;
+                other.set_short_empty();
+            } else {
+                assign(other.data(), other.size());
+            }
+        }
+        return *this;
+    }
+    nuo_basic_string& operator=(const char* s) {
+        return assign(s, strlen(s));
+    }
+    nuo_basic_string& operator=(std::string_view sv) {
+        return assign(sv.data(), sv.size());
+    }
+    nuo_basic_string& operator=(char c) {
+        return assign(&c, 1);
+    }
+
+    /* Group 1 */
+    nuo_basic_string& operator+=(const nuo_basic_string& s) {
+        return append(s.data(), s.size());
+    }
+    nuo_basic_string& operator+=(const char* s) {
+        return append(s, strlen(s));
+    }
+    nuo_basic_string& operator+=(std::string_view sv) {
+        return append(sv.data(), sv.size());
+    }
+    nuo_basic_string& operator+=(char c) {
+        push_back(c);
+        return *this;
+    }
+
+    char& operator[](size_type i) noexcept { return data()[i]; }
+    const char& operator[](size_type i) const noexcept { return data()[i]; }
+
+    operator std::string_view() const noexcept {
+        return std::string_view(data(), size());
+    }
+
+    /* Element access */
+    char& at(size_type i) {
+        if (i >= size())
+            throw std::out_of_range("nuo_string::at: index out of range");
+        return data()[i];
+    }
+    const char& at(size_type i) const {
+        if (i >= size())
+            throw std::out_of_range("nuo_string::at: index out of range");
+        return data()[i];
+    }
+    char& front() noexcept { return data()[0]; }
+    const char& front() const noexcept { return data()[0]; }
+    char& back() noexcept { return data()[size() - 1]; }
+    const char& back() const noexcept { return data()[size() - 1]; }
+
+    char* data() noexcept { return is_long() ? r_.l.ptr : r_.s.buf; }
+    const char* data() const noexcept {
+        return is_long() ? r_.l.ptr : r_.s.buf;
+    }
+    const char* c_str() const noexcept { return data(); }
+
+    /* Iterators */
+    iterator begin() noexcept { return data(); }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator cbegin() const noexcept { return data(); }
+    iterator end() noexcept { return data() + size(); }
+    const_iterator end() const noexcept { return data() + size(); }
+    const_iterator cend() const noexcept { return data() + size(); }
+
+    /* Capacity */
+    size_type size() const noexcept {
+        return is_long() ? r_.l.size : sso_capacity - r_.s.spare;
+    }
+    size_type length() const noexcept { return size(); }
+    bool empty() const noexcept { return size() == 0; }
+    size_type capacity() const noexcept {
+        return is_long() ? (r_.l.cap & ~long_flag) : sso_capacity;
+    }
+    bool is_inline() const noexcept { return !is_long(); }
+    size_type max_size() const noexcept {
+        size_type m = alloc_traits::max_size(alloc_) - 1;
+        return m < long_flag - 1 ? m : long_flag - 1;
+    }
+    allocator_type get_allocator() const noexcept { return alloc_; }
+
+    void reserve(size_type new_cap) {
+        if (new_cap > capacity()) {
+            if (new_cap > max_size())
+                throw std::length_error("nuo_string: length exceeds max_size");
+            grow_to(new_cap);
+        }
+    }
+
+    void shrink_to_fit() {
+        if (!is_long())
+            return;
+        size_type n = r_.l.size;
+        size_type cap = capacity();
+        if (n <= sso_capacity) {
+            char* p = r_.l.ptr;
+            memcpy(r_.s.buf, p, n);
+            set_short_size(n);
+            alloc_traits::deallocate(alloc_, p, cap + 1);
+        } else if (n < cap) {
+            char* p;
+            if constexpr (can_reallocate) {
+                p = alloc_.reallocate(r_.l.ptr, cap + 1, n + 1);
+            } else {
+                p = allocate_buf(n);
+                memcpy(p, r_.l.ptr, n + 1);
+                alloc_traits::deallocate(alloc_, r_.l.ptr, cap + 1);
+            }
+            r_.l.ptr = p;
+            r_.l.cap = n | long_flag;
+        }
+    }
+
+    /* Modifiers */
+    void clear() noexcept { set_size(0); }
+
+    nuo_basic_string& assign(const char* s, size_type n) {
+        if (n > capacity()) {
+            /* fresh buffer, s may alias the old one */
+            nuo_basic_string tmp(s, n, alloc_);
+            swap(tmp);
+        } else {
+            memmove(data(), s, n);
+            set_size(n);
+        }
+        return *this;
+    }
+    nuo_basic_string& assign(std::string_view sv) {
+        return assign(sv.data(), sv.size());
+    }
+
+    nuo_basic_string& append(const char* s, size_type n) {
+        size_type len = size();
+        if (n > capacity() - len) {
+            /* s may point into our own buffer, which grow_to may move */
+            const char* base = data();
+            bool alias = s >= base && s < base + len;
+            size_type off = alias ? static_cast<size_type>(s - base) : 0;
+            grow_to(next_capacity(len + n));
+            if (alias)
+                s = data() + off;
+        }
+        memmove(data() + len, s, n);
+        set_size(len + n);
+        return *this;
+    }
+    nuo_basic_string& append(size_type n, char c) {
+        size_type len = size();
+        if (n > capacity() - len)
+            grow_to(next_capacity(len + n));
+        memset(data() + len, c, n);
+        set_size(len + n);
+        return *this;
+    }
+    nuo_basic_string& append(std::string_view sv) {
+        return append(sv.data(), sv.size());
+    }
+
+    void push_back(char c) {
+        size_type len = size();
+        if (len == capacity())
+            grow_to(next_capacity(len + 1));
+        data()[len] = c;
+        set_size(len + 1);
+    }
+
+    void pop_back() noexcept { set_size(size() - 1); }
+
+    nuo_basic_string& insert(size_type pos, const char* s, size_type n) {
+        check_pos(pos);
+        if (n == 0)
+            return *this;
+        size_type len = size();
+        const char* base = data();
+        if (s >= base && s <= base + len) {
+            /* self insert: go through a copy, it is rare enough */
+            nuo_basic_string tmp(s, n, alloc_);
+            return insert(pos, tmp.data(), n);
+        }
+        if (n > capacity() - len)
+            grow_to(next_capacity(len + n));
+        char* p = data();
+        memmove(p + pos + n, p + pos, len - pos);
+        memcpy(p + pos, s, n);
+        set_size(len + n);
+        return *this;
+    }
+    nuo_basic_string& insert(size_type pos, std::string_view sv) {
+        return insert(pos, sv.data(), sv.size());
+    }
+    nuo_basic_string& insert(size_type pos, size_type n, char c) {
+        check_pos(pos);
+        size_type len = size();
+        if (n > capacity() - len)
+            grow_to(next_capacity(len + n));
+        char* p = data();
+        memmove(p + pos + n, p + pos, len - pos);
+        memset(p + pos, c, n);
+        set_size(len + n);
+        return *this;
+    }
+
+    nuo_basic_string& erase(size_type pos = 0, size_type n = npos) {
+        check_pos(pos);
+        size_type len = size();
+        if (n > len - pos)
+            n = len - pos;
+        char* p = data();
+        memmove(p + pos, p + pos + n, len - pos - n);
+        set_size(len - n);
+        return *this;
+    }
+
+    void resize(size_type n, char c = '\0') {
+        size_type len = size();
+        if (n > len)
+            append(n - len, c);
+        else
+            set_size(n);
+    }
+
+    void swap(nuo_basic_string& other) noexcept {
+        std::swap(r_, other.r_);
+        if constexpr (alloc_traits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        }
+    }
+
+    /* Operations */
+    nuo_basic_string substr(size_type pos = 0, size_type n = npos) const {
+        check_pos(pos);
+        size_type len = size();
+        if (n > len - pos)
+            n = len - pos;
+        return nuo_basic_string(data() + pos, n, alloc_);
+    }
+
+    size_type find(char c, size_type pos = 0) const noexcept {
+        size_type len = size();
+        if (pos >= len)
+            return npos;
+        size_type k = detail::nuo_char_find(data() + pos, len - pos, c);
+        return k == detail::nuo_char_npos ? npos : pos + k;
+    }
+    size_type find(const char* s, size_type pos, size_type n) const noexcept {
+        size_type len = size();
+        if (pos > len)
+            return npos;
+        size_type k = detail::nuo_char_search(data() + pos, len - pos, s, n);
+        return k == detail::nuo_char_npos ? npos : pos + k;
+    }
+    size_type find(const char* s, size_type pos = 0) const noexcept {
+        return find(s, pos, strlen(s));
+    }
+    size_type find(std::string_view sv, size_type pos = 0) const noexcept {
+        return find(sv.data(), pos, sv.size());
+    }
+    size_type find(const nuo_basic_string& s,
+                   size_type pos = 0) const noexcept {
+        return find(s.data(), pos, s.size());
+    }
+
+    size_type rfind(char c, size_type pos = npos) const noexcept {
+        size_type len = size();
+        if (len == 0)
+            return npos;
+        if (pos >= len)
+            pos = len - 1;
+        const char* p = data();
+        for (size_type i = pos + 1; i-- > 0; ) {
+            if (p[i] == c)
+                return i;
+        }
+        return npos;
+    }
+
+    bool contains(std::string_view sv) const noexcept {
+        return find(sv) != npos;
+    }
+    bool contains(char c) const noexcept { return find(c) != npos; }
+    bool starts_with(std::string_view sv) const noexcept {
+        return size() >= sv.size() &&
+            detail::nuo_char_equal(data(), sv.data(), sv.size());
+    }
+    bool ends_with(std::string_view sv) const noexcept {
+        size_type len = size();
+        return len >= sv.size() &&
+            detail::nuo_char_equal(data() + len - sv.size(), sv.data(),
+                                   sv.size());
+    }
+
+    int compare(std::string_view sv) const noexcept {
+        return detail::nuo_char_compare(data(), size(), sv.data(), sv.size());
+    }
+    int compare(const nuo_basic_string& s) const noexcept {
+        return detail::nuo_char_compare(data(), size(), s.data(), s.size());
+    }
+
+    /* Comparison */
+    friend bool operator==(const nuo_basic_string& a,
+                           const nuo_basic_string& b) noexcept {
+        size_type n = a.size();
+        return n == b.size() && detail::nuo_char_equal(a.data(), b.data(), n);
+    }
+    friend bool operator==(const nuo_basic_string& a,
+                           std::string_view b) noexcept {
+        size_type n = a.size();
+        return n == b.size() && detail::nuo_char_equal(a.data(), b.data(), n);
+    }
+    friend bool operator==(const nuo_basic_string& a, const char* b) noexcept {
+        return a == std::string_view(b);
+    }
+    friend std::strong_ordering operator<=>(const nuo_basic_string& a,
+                                            const nuo_basic_string& b) noexcept {
+        return a.compare(b) <=> 0;
+    }
+    friend std::strong_ordering operator<=>(const nuo_basic_string& a,
+                                            std::string_view b) noexcept {
+        return a.compare(b) <=> 0;
+    }
+    friend std::strong_ordering operator<=>(const nuo_basic_string& a,
+                                            const char* b) noexcept {
+        return a.compare(std::string_view(b)) <=> 0;
+    }
+
+    /* Concatenation */
+    friend nuo_basic_string operator+(const nuo_basic_string& a,
+                                      std::string_view b) {
+        nuo_basic_string r(a.get_allocator());
+        r.reserve(a.size() + b.size());
+        r.append(a.data(), a.size());
+        r.append(b.data(), b.size());
+        return r;
+    }
+    friend nuo_basic_string operator+(nuo_basic_string&& a,
+                                      std::string_view b) {
+        a.append(b.data(), b.size());
+        return std::move(a);
+    }
+    friend nuo_basic_string operator+(nuo_basic_string&& a,
+                                      const nuo_basic_string& b) {
+        return std::move(a) + std::string_view(b);
+    }
+    friend nuo_basic_string operator+(nuo_basic_string&& a, const char* b) {
+        return std::move(a) + std::string_view(b);
+    }
+    friend nuo_basic_string operator+(const nuo_basic_string& a,
+                                      const nuo_basic_string& b) {
+        return a + std::string_view(b);
+    }
+    friend nuo_basic_string operator+(const nuo_basic_string& a,
+                                      const char* b) {
+        return a + std::string_view(b);
+    }
+    friend nuo_basic_string operator+(const char* a,
+                                      const nuo_basic_string& b) {
+        nuo_basic_string r(b.get_allocator());
+        size_type n = strlen(a);
+        r.reserve(n + b.size());
+        r.append(a, n);
+        r.append(b.data(), b.size());
+        return r;
+    }
+    friend nuo_basic_string operator+(const nuo_basic_string& a, char c) {
+        nuo_basic_string r(a);
+        r.push_back(c);
+        return r;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const nuo_basic_string& s) {
+        return os << std::string_view(s);
+    }
+};
+
+using nuo_string = nuo_basic_string<>;
+
+template<typename Alloc>
+void swap(nuo_basic_string<Alloc>& a, nuo_basic_string<Alloc>& b) noexcept {
+    a.swap(b);
+}
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,262 @@
+#ifndef NUOSTL_CORE_DATA_TYPES_NUO_TUPLE_HPP_
+#define NUOSTL_CORE_DATA_TYPES_NUO_TUPLE_HPP_
+
+#include <stddef.h>
+
+#include <compare>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#include "./detail/nuo_tuple_storage.hpp"
+
+/*
+ * Fixed-size heterogeneous tuple. Elements are laid out by decreasing
+ * alignment instead of declaration order, so nuo_tuple<char, double, char>
+ * takes 16 bytes where std::tuple takes 24; get<I> still uses the
+ * declared index. Empty element types occupy no storage, and a tuple of
+ * trivially copyable types is trivially copyable.
+ */
+
+namespace nuostl {
+
+template<typename... T>
+class nuo_tuple : private detail::nuo_tuple_storage<
+    typename detail::nuo_tuple_layout<T...>::sequence, T...> {
+private:
+    template<typename...>
+    friend class nuo_tuple;
+
+    using layout = detail::nuo_tuple_layout<T...>;
+    using storage = detail::nuo_tuple_storage<typename layout::sequence, T...>;
+
+    template<size_t I>
+    using element = detail::nuo_type_at<I, T...>;
+
+    template<size_t I>
+    using leaf = detail::nuo_tuple_leaf<I, element<I>>;
+
+    static constexpr bool has_reference = (std::is_reference_v<T> || ...);
+
+    struct args_t {};
+
+    template<typename Args>
+    constexpr nuo_tuple(args_t, const Args& args)
+        : storage(detail::nuo_tuple_gen_t{}, [&args](auto i) -> decltype(auto) {
+              return args.template get<decltype(i)::value>();
+          }) {}
+
+    template<typename Other>
+    static constexpr bool is_self = sizeof...(T) == 1 &&
+        std::is_same_v<std::remove_cvref_t<Other>, nuo_tuple>;
+
+    template<typename Other, size_t... I>
+    constexpr void assign_copy(const Other& o, std::index_sequence<I...>) {
+        ((get<I>() = o.template get<I>()), ...);
+    }
+
+    template<typename Other, size_t... I>
+    constexpr void assign_move(Other& o, std::index_sequence<I...>) {
+        ((get<I>() = std::move(o).template get<I>()), ...);
+    }
+public:
+    /* Constructor */
+    constexpr nuo_tuple() requires (std::is_default_constructible_v<T> && ...)
+        : storage() {}
+
+    constexpr explicit((!std::is_convertible_v<const T&, T> || ...))
+    nuo_tuple(const T&... values) requires (
+        sizeof...(T) >= 1 && (std::is_copy_constructible_v<T> && ...))
+        : nuo_tuple(args_t{},
+                    detail::nuo_tuple_args<std::index_sequence_for<T...>, const T&...>{
+                        {values}...}) {}
+
+    template<typename... U>
+        requires (sizeof...(U) == sizeof...(T) && sizeof...(T) >= 1 &&
+                  !(is_self<U> || ...) && (std::is_constructible_v<T, U&&> && ...))
+    constexpr explicit((!std::is_convertible_v<U&&, T> || ...))
+    nuo_tuple(U&&... values)
+        : nuo_tuple(args_t{},
+                    detail::nuo_tuple_args<std::index_sequence_for<U...>, U...>{
+                        {std::forward<U>(values)}...}) {}
+
+    /* Converting from a tuple of other element types */
+    template<typename... U>
+        requires (sizeof...(U) == sizeof...(T) && !std::is_same_v<nuo_tuple<U...>, nuo_tuple> &&
+                  (std::is_constructible_v<T, const U&> && ...))
+    constexpr explicit((!std::is_convertible_v<const U&, T> || ...))
+    nuo_tuple(const nuo_tuple<U...>& o)
+        : storage(detail::nuo_tuple_gen_t{}, [&o](auto i) -> decltype(auto) {
+              return o.template get<decltype(i)::value>();
+          }) {}
+
+    template<typename... U>
+        requires (sizeof...(U) == sizeof...(T) && !std::is_same_v<nuo_tuple<U...>, nuo_tuple> &&
+                  (std::is_constructible_v<T, U&&> && ...))
+    constexpr explicit((!std::is_convertible_v<U&&, T> || ...))
+    nuo_tuple(nuo_tuple<U...>&& o)
+        : storage(detail::nuo_tuple_gen_t{}, [&o](auto i) -> decltype(auto) {
+              return std::move(o).template get<decltype(i)::value>();
+          }) {}
+
+    /* Destructor */
+    ~nuo_tuple() = default;
+
+    /* Copy Constructor */
+    constexpr nuo_tuple(const nuo_tuple&) = default;
+    constexpr nuo_tuple(nuo_tuple&&) = default;
+
+    /* Operator */
+    /* Group 0 */
+    constexpr nuo_tuple& operator=(const nuo_tuple&) = default;
+    constexpr nuo_tuple& operator=(nuo_tuple&&) = default;
+
+    /* Reference elements assign through, as with std::tie */
+    constexpr nuo_tuple& operator=(const nuo_tuple& o) requires has_reference {
+        assign_copy(o, std::index_sequence_for<T...>{});
+        return *this;
+    }
+
+    constexpr nuo_tuple& operator=(nuo_tuple&& o) requires has_reference {
+        assign_move(o, std::index_sequence_for<T...>{});
+        return *this;
+    }
+
+    template<typename... U>
+        requires (sizeof...(U) == sizeof...(T) && !std::is_same_v<nuo_tuple<U...>, nuo_tuple> &&
+                  (std::is_assignable_v<T&, const U&> && ...))
+    constexpr nuo_tuple& operator=(const nuo_tuple<U...>& o) {
+        assign_copy(o, std::index_sequence_for<T...>{});
+        return *this;
+    }
+
+    template<typename... U>
+        requires (sizeof...(U) == sizeof...(T) && !std::is_same_v<nuo_tuple<U...>, nuo_tuple> &&
+                  (std::is_assignable_v<T&, U&&> && ...))
+    constexpr nuo_tuple& operator=(nuo_tuple<U...>&& o) {
+        assign_move(o, std::index_sequence_for<T...>{});
+        return *this;
+    }
+
+    /* Group 1 */
+    friend constexpr bool operator==(const nuo_tuple& a, const nuo_tuple& b)
+        requires (std::equality_comparable<T> && ...) {
+        return [&]<size_t... I>(std::index_sequence<I...>) {
+            return ((a.get<I>() == b.get<I>()) && ...);
+        }(std::index_sequence_for<T...>{});
+    }
+
+    /* Lexicographic in declaration order, whatever the layout */
+    friend constexpr auto operator<=>(const nuo_tuple& a, const nuo_tuple& b)
+        requires (std::three_way_comparable<std::remove_reference_t<T>> && ...) {
+        using result = std::common_comparison_category_t<
+            std::compare_three_way_result_t<std::remove_reference_t<T>>...>;
+        result r = result::equivalent;
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            ((r = a.get<I>() <=> b.get<I>(), r == 0) && ...);
+        }(std::index_sequence_for<T...>{});
+        return r;
+    }
+
+    /* Element access */
+    template<size_t I>
+    constexpr std::add_lvalue_reference_t<element<I>> get() & noexcept {
+        static_assert(I < sizeof...(T), "Index out of range in nuo_tuple::get");
+        return static_cast<leaf<I>&>(*this).value;
+    }
+
+    template<size_t I>
+    constexpr std::add_lvalue_reference_t<const element<I>> get() const& noexcept {
+        static_assert(I < sizeof...(T), "Index out of range in nuo_tuple::get");
+        return static_cast<const leaf<I>&>(*this).value;
+    }
+
+    template<size_t I>
+    constexpr element<I>&& get() && noexcept {
+        static_assert(I < sizeof...(T), "Index out of range in nuo_tuple::get");
+        return static_cast<element<I>&&>(static_cast<leaf<I>&>(*this).value);
+    }
+
+    template<size_t I>
+    constexpr const element<I>&& get() const&& noexcept {
+        static_assert(I < sizeof...(T), "Index out of range in nuo_tuple::get");
+        return static_cast<const element<I>&&>(static_cast<const leaf<I>&>(*this).value);
+    }
+
+    constexpr void swap(nuo_tuple& o) noexcept(
+        (std::is_nothrow_swappable_v<T> && ...)
+    ) {
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            using std::swap;
+            (swap(get<I>(), o.get<I>()), ...);
+        }(std::index_sequence_for<T...>{});
+    }
+
+    friend constexpr void swap(nuo_tuple& a, nuo_tuple& b) noexcept(noexcept(a.swap(b))) {
+        a.swap(b);
+    }
+};
+
+template<typename... T>
+nuo_tuple(T...) -> nuo_tuple<T...>;
+
+template<typename... T>
+constexpr nuo_tuple<std::unwrap_ref_decay_t<T>...> nuo_make_tuple(T&&... values) {
+    return nuo_tuple<std::unwrap_ref_decay_t<T>...>(std::forward<T>(values)...);
+}
+
+template<typename... T>
+constexpr nuo_tuple<T&...> nuo_tie(T&... values) noexcept {
+    return nuo_tuple<T&...>(values...);
+}
+
+} /* namespace nuostl */
+
+namespace std {
+
+/* for left value */
+template<size_t N, typename... T>
+constexpr decltype(auto) get(nuostl::nuo_tuple<T...>& t) noexcept {
+    return t.template get<N>();
+}
+
+/* for const left value */
+template<size_t N, typename... T>
+constexpr decltype(auto) get(const nuostl::nuo_tuple<T...>& t) noexcept {
+    return t.template get<N>();
+}
+
+/* for right value */
+template<size_t N, typename... T>
+constexpr decltype(auto) get(nuostl::nuo_tuple<T...>&& t) noexcept {
+    return std::move(t).template get<N>();
+}
+
+/* by type, the type must occur exactly once */
+template<typename U, typename... T>
+constexpr decltype(auto) get(nuostl::nuo_tuple<T...>& t) noexcept {
+    constexpr size_t i = nuostl::detail::nuo_unique_index<U, T...>();
+    static_assert(i < sizeof...(T), "Type must occur exactly once in nuo_tuple");
+    return t.template get<i>();
+}
+
+template<typename U, typename... T>
+constexpr decltype(auto) get(const nuostl::nuo_tuple<T...>& t) noexcept {
+    constexpr size_t i = nuostl::detail::nuo_unique_index<U, T...>();
+    static_assert(i < sizeof...(T), "Type must occur exactly once in nuo_tuple");
+    return t.template get<i>();
+}
+
+template<typename... T>
+struct tuple_size<nuostl::nuo_tuple<T...>> :
+    std::integral_constant<size_t, sizeof...(T)> {};
+
+template<size_t N, typename... T>
+struct tuple_element<N, nuostl::nuo_tuple<T...>> {
+    static_assert(N < sizeof...(T), "tuple_element index out of range for nuo_tuple");
+    using type = nuostl::detail::nuo_type_at<N, T...>;
+};
+
+} /* namespace std */
+
+#endif
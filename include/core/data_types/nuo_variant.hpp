@@ -0,0 +1,498 @@
+#ifndef NUOSTL_CORE_DATA_TYPES_NUO_VARIANT_HPP_
+#define NUOSTL_CORE_DATA_TYPES_NUO_VARIANT_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "./detail/nuo_tuple_storage.hpp"
+#include "./detail/nuo_variant_visit.hpp"
+
+/*
+ * Tagged union over T... The index is the smallest unsigned type that
+ * holds sizeof...(T) plus a valueless marker, visitation is a switch (see
+ * detail/nuo_variant_visit.hpp). When every alternative is nothrow move
+ * constructible a throwing emplace builds the new value aside before
+ * touching the old one, the variant can never become valueless, and
+ * index() and nuo_visit carry no valueless checks. Special members are
+ * trivial when they are trivial for all alternatives. Wrong-alternative
+ * access throws std::bad_variant_access.
+ */
+
+namespace nuostl {
+
+template<typename... T>
+class nuo_variant;
+
+namespace detail {
+
+/* Converting construction picks the alternative like std::variant does */
+template<typename Ti>
+struct nuo_variant_array {
+    Ti x[1];
+};
+
+template<size_t I, typename Ti, typename U>
+struct nuo_variant_fun {
+    static nuo_indexed<I, Ti> select(Ti) requires (
+        requires { nuo_variant_array<Ti>{{std::declval<U>()}}; } &&
+        (!std::is_same_v<std::remove_cv_t<Ti>, bool> ||
+         std::is_same_v<std::remove_cvref_t<U>, bool>));
+};
+
+template<typename Seq, typename U, typename... T>
+struct nuo_variant_overloads;
+
+template<size_t... I, typename U, typename... T>
+struct nuo_variant_overloads<std::index_sequence<I...>, U, T...>
+    : nuo_variant_fun<I, T, U>... {
+    using nuo_variant_fun<I, T, U>::select...;
+};
+
+template<typename U, typename... T>
+using nuo_variant_selected = decltype(
+    nuo_variant_overloads<std::index_sequence_for<T...>, U, T...>::select(
+        std::declval<U>()));
+
+/* What nuo_visit_impl needs to know about nuo_variant */
+struct nuo_variant_access {
+    template<typename V>
+    static constexpr size_t size = std::variant_size_v<std::remove_cvref_t<V>>;
+
+    template<typename V>
+    static size_t index(const V& v) noexcept {
+        return v.index_;
+    }
+
+    template<size_t I, typename V>
+    static decltype(auto) get(V&& v) noexcept {
+        if constexpr (std::is_lvalue_reference_v<V>)
+            return v.template raw<I>();
+        else
+            return std::move(v.template raw<I>());
+    }
+};
+
+}   /* namespace detail */
+
+template<typename... T>
+class nuo_variant {
+private:
+    static_assert(sizeof...(T) > 0, "nuo_variant needs at least one alternative");
+    static_assert(((!std::is_reference_v<T> && !std::is_array_v<T> && !std::is_void_v<T>) && ...),
+                  "nuo_variant alternatives must be object types");
+
+    friend struct detail::nuo_variant_access;
+
+    template<size_t I>
+    using alternative = detail::nuo_type_at<I, T...>;
+
+    using index_type = std::conditional_t<(sizeof...(T) < UINT8_MAX), uint8_t,
+                       std::conditional_t<(sizeof...(T) < UINT16_MAX), uint16_t, uint32_t>>;
+
+    static constexpr index_type npos = static_cast<index_type>(-1);
+
+    static constexpr bool trivial_copy =
+        (std::is_trivially_copy_constructible_v<T> && ...);
+    static constexpr bool trivial_move =
+        (std::is_trivially_move_constructible_v<T> && ...);
+    static constexpr bool trivial_copy_assign = trivial_copy &&
+        (std::is_trivially_copy_assignable_v<T> && ...) &&
+        (std::is_trivially_destructible_v<T> && ...);
+    static constexpr bool trivial_move_assign = trivial_move &&
+        (std::is_trivially_move_assignable_v<T> && ...) &&
+        (std::is_trivially_destructible_v<T> && ...);
+
+    alignas(T...) unsigned char buf_[std::max({sizeof(T)...})];
+    index_type index_;
+
+    template<size_t I>
+    alternative<I>& raw() noexcept {
+        return *std::launder(reinterpret_cast<alternative<I>*>(buf_));
+    }
+
+    template<size_t I>
+    const alternative<I>& raw() const noexcept {
+        return *std::launder(reinterpret_cast<const alternative<I>*>(buf_));
+    }
+
+    template<typename R, typename Call>
+    R dispatch(Call&& call) const {
+        if constexpr (sizeof...(T) <= detail::nuo_switch_max)
+            return detail::nuo_switch<R, sizeof...(T)>(index_, call);
+        else
+            return detail::nuo_table_switch<R, sizeof...(T)>(index_, call);
+    }
+
+    template<size_t I, typename... Args>
+    void construct(Args&&... args) {
+        ::new (static_cast<void*>(buf_)) alternative<I>(std::forward<Args>(args)...);
+        index_ = static_cast<index_type>(I);
+    }
+
+    void reset() noexcept {
+        if constexpr (!(std::is_trivially_destructible_v<T> && ...)) {
+            if (!valueless_by_exception()) {
+                dispatch<void>([this](auto i) {
+                    using Ti = alternative<decltype(i)::value>;
+                    raw<decltype(i)::value>().~Ti();
+                });
+            }
+        }
+        index_ = npos;
+    }
+
+    /* Same alternative as o, built from o's value (o is const& or &&) */
+    template<typename Other>
+    void construct_from(Other&& o) {
+        index_ = npos;
+        if (!o.valueless_by_exception()) {
+            o.template dispatch<void>([&](auto i) {
+                construct<decltype(i)::value>(detail::nuo_variant_access::get<decltype(i)::value>(
+                    std::forward<Other>(o)));
+            });
+        }
+    }
+
+    template<typename Other>
+    void assign_from(Other&& o) {
+        if (o.valueless_by_exception()) {
+            reset();
+            return;
+        }
+        o.template dispatch<void>([&](auto i) {
+            constexpr size_t I = decltype(i)::value;
+            if (index_ == I)
+                raw<I>() = detail::nuo_variant_access::get<I>(std::forward<Other>(o));
+            else
+                emplace<I>(detail::nuo_variant_access::get<I>(std::forward<Other>(o)));
+        });
+    }
+public:
+    /* Holds a value at all times, even after an exception in emplace */
+    static constexpr bool never_valueless =
+        (std::is_nothrow_move_constructible_v<T> && ...);
+
+    /* Constructor */
+    nuo_variant() noexcept(std::is_nothrow_default_constructible_v<alternative<0>>)
+        requires std::is_default_constructible_v<alternative<0>> {
+        construct<0>();
+    }
+
+    template<typename U, typename Selected = detail::nuo_variant_selected<U, T...>>
+        requires (!std::is_same_v<std::remove_cvref_t<U>, nuo_variant> &&
+                  std::is_constructible_v<typename Selected::type, U&&>)
+    nuo_variant(U&& value) noexcept(
+        std::is_nothrow_constructible_v<typename Selected::type, U&&>
+    ) {
+        construct<detail::nuo_unique_index<typename Selected::type, T...>()>(
+            std::forward<U>(value));
+    }
+
+    template<size_t I, typename... Args>
+        requires (I < sizeof...(T) && std::is_constructible_v<alternative<I>, Args&&...>)
+    explicit nuo_variant(std::in_place_index_t<I>, Args&&... args) {
+        construct<I>(std::forward<Args>(args)...);
+    }
+
+    template<typename U, typename... Args,
+             size_t I = detail::nuo_unique_index<U, T...>()>
+        requires (I < sizeof...(T) && std::is_constructible_v<U, Args&&...>)
+    explicit nuo_variant(std::in_place_type_t<U>, Args&&... args) {
+        construct<I>(std::forward<Args>(args)...);
+    }
+
+    /* Destructor */
+    ~nuo_variant() requires (std::is_trivially_destructible_v<T> && ...) = default;
+    ~nuo_variant() { reset(); }
+
+    /* Copy Constructor */
+    nuo_variant(const nuo_variant&) requires trivial_copy = default;
+    nuo_variant(const nuo_variant& o)
+        requires (!trivial_copy && (std::is_copy_constructible_v<T> && ...)) {
+        construct_from(o);
+    }
+
+    nuo_variant(nuo_variant&&) requires trivial_move = default;
+    nuo_variant(nuo_variant&& o) noexcept((std::is_nothrow_move_constructible_v<T> && ...))
+        requires (!trivial_move && (std::is_move_constructible_v<T> && ...)) {
+        construct_from(std::move(o));
+    }
+
+    /* Operator */
+    /* Group 0 */
+    nuo_variant& operator=(const nuo_variant&) requires trivial_copy_assign = default;
+    nuo_variant& operator=(const nuo_variant& o) requires (!trivial_copy_assign &&
+        ((std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>) && ...)) {
+        if (this != &o)
+            assign_from(o);
+        return *this;
+    }
+
+    nuo_variant& operator=(nuo_variant&&) requires trivial_move_assign = default;
+    nuo_variant& operator=(nuo_variant&& o) noexcept(
+        ((std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>) && ...)
+    ) requires (!trivial_move_assign &&
+        ((std::is_move_constructible_v<T> && std::is_move_assignable_v<T>) && ...)) {
+        if (this != &o)
+            assign_from(std::move(o));
+        return *this;
+    }
+
+    template<typename U, typename Selected = detail::nuo_variant_selected<U, T...>>
+        requires (!std::is_same_v<std::remove_cvref_t<U>, nuo_variant> &&
+                  std::is_constructible_v<typename Selected::type, U&&> &&
+                  std::is_assignable_v<typename Selected::type&, U&&>)
+    nuo_variant& operator=(U&& value) {
+        constexpr size_t I = detail::nuo_unique_index<typename Selected::type, T...>();
+        if (index_ == I)
+            raw<I>() = std::forward<U>(value);
+        else
+            emplace<I>(std::forward<U>(value));
+        return *this;
+    }
+
+    /* Group 1 */
+    friend bool operator==(const nuo_variant& a, const nuo_variant& b)
+        requires (std::equality_comparable<T> && ...) {
+        if (a.index_ != b.index_)
+            return false;
+        if (a.valueless_by_exception())
+            return true;
+        return a.template dispatch<bool>([&](auto i) {
+            return a.template raw<decltype(i)::value>() == b.template raw<decltype(i)::value>();
+        });
+    }
+
+    /* Valueless first, then by index, then by value */
+    friend auto operator<=>(const nuo_variant& a, const nuo_variant& b)
+        requires (std::three_way_comparable<T> && ...) {
+        using result = std::common_comparison_category_t<std::compare_three_way_result_t<T>...>;
+        if (a.index_ != b.index_) {
+            if (a.valueless_by_exception()) return result(std::strong_ordering::less);
+            if (b.valueless_by_exception()) return result(std::strong_ordering::greater);
+            return result(a.index_ <=> b.index_);
+        }
+        if (a.valueless_by_exception())
+            return result(std::strong_ordering::equal);
+        return a.template dispatch<result>([&](auto i) -> result {
+            return a.template raw<decltype(i)::value>() <=> b.template raw<decltype(i)::value>();
+        });
+    }
+
+    /* Observers */
+    constexpr size_t index() const noexcept {
+        if constexpr (never_valueless)
+            return index_;
+        else
+            return index_ == npos ? std::variant_npos : index_;
+    }
+
+    constexpr bool valueless_by_exception() const noexcept {
+        if constexpr (never_valueless)
+            return false;
+        else
+            return index_ == npos;
+    }
+
+    template<typename U>
+    constexpr bool holds_alternative() const noexcept {
+        constexpr size_t I = detail::nuo_unique_index<U, T...>();
+        static_assert(I < sizeof...(T), "Type must occur exactly once in nuo_variant");
+        return index_ == I;
+    }
+
+    /* Modifiers */
+    template<size_t I, typename... Args>
+        requires (I < sizeof...(T) && std::is_constructible_v<alternative<I>, Args&&...>)
+    alternative<I>& emplace(Args&&... args) {
+        using Ti = alternative<I>;
+        if constexpr (std::is_nothrow_constructible_v<Ti, Args&&...>) {
+            reset();
+            construct<I>(std::forward<Args>(args)...);
+        } else if constexpr (std::is_nothrow_move_constructible_v<Ti>) {
+            /* a throw leaves the current value untouched */
+            Ti tmp(std::forward<Args>(args)...);
+            reset();
+            construct<I>(std::move(tmp));
+        } else {
+            reset();
+            construct<I>(std::forward<Args>(args)...);
+        }
+        return raw<I>();
+    }
+
+    template<typename U, typename... Args>
+    U& emplace(Args&&... args) {
+        constexpr size_t I = detail::nuo_unique_index<U, T...>();
+        static_assert(I < sizeof...(T), "Type must occur exactly once in nuo_variant");
+        return emplace<I>(std::forward<Args>(args)...);
+    }
+
+    void swap(nuo_variant& o) noexcept(
+        ((std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>) && ...)
+    ) {
+        if (index_ == o.index_) {
+            if (!valueless_by_exception()) {
+                dispatch<void>([&](auto i) {
+                    using std::swap;
+                    swap(raw<decltype(i)::value>(), o.template raw<decltype(i)::value>());
+                });
+            }
+            return;
+        }
+        nuo_variant tmp(std::move(o));
+        o.reset();
+        o.construct_from(std::move(*this));
+        reset();
+        construct_from(std::move(tmp));
+    }
+
+    friend void swap(nuo_variant& a, nuo_variant& b) noexcept(noexcept(a.swap(b))) {
+        a.swap(b);
+    }
+
+    /* Element access */
+    template<size_t I>
+    alternative<I>& get() & {
+        static_assert(I < sizeof...(T), "Index out of range in nuo_variant::get");
+        if (index_ != I)
+            throw std::bad_variant_access();
+        return raw<I>();
+    }
+
+    template<size_t I>
+    const alternative<I>& get() const& {
+        static_assert(I < sizeof...(T), "Index out of range in nuo_variant::get");
+        if (index_ != I)
+            throw std::bad_variant_access();
+        return raw<I>();
+    }
+
+    template<size_t I>
+    alternative<I>&& get() && {
+        return std::move(get<I>());
+    }
+
+    template<size_t I>
+    alternative<I>* get_if() noexcept {
+        return index_ == I ? &raw<I>() : nullptr;
+    }
+
+    template<size_t I>
+    const alternative<I>* get_if() const noexcept {
+        return index_ == I ? &raw<I>() : nullptr;
+    }
+
+    template<typename F>
+    decltype(auto) visit(F&& f) & {
+        return nuo_visit(std::forward<F>(f), *this);
+    }
+
+    template<typename F>
+    decltype(auto) visit(F&& f) const& {
+        return nuo_visit(std::forward<F>(f), *this);
+    }
+
+    template<typename F>
+    decltype(auto) visit(F&& f) && {
+        return nuo_visit(std::forward<F>(f), std::move(*this));
+    }
+};
+
+namespace detail {
+
+template<typename F, typename... V>
+using nuo_visit_result = std::invoke_result_t<
+    F, decltype(nuo_variant_access::get<0>(std::declval<V>()))...>;
+
+}   /* namespace detail */
+
+template<typename R, typename F, typename... V>
+R nuo_visit(F&& f, V&&... v) {
+    if ((v.valueless_by_exception() || ...))
+        throw std::bad_variant_access();
+    return detail::nuo_visit_impl<detail::nuo_variant_access, R>(
+        std::forward<F>(f), std::forward<V>(v)...);
+}
+
+/* All alternatives must give the visitor's result type for the first ones */
+template<typename F, typename... V>
+decltype(auto) nuo_visit(F&& f, V&&... v) {
+    return nuo_visit<detail::nuo_visit_result<F, V...>>(
+        std::forward<F>(f), std::forward<V>(v)...);
+}
+
+template<typename U, typename... T>
+constexpr bool nuo_holds_alternative(const nuo_variant<T...>& v) noexcept {
+    return v.template holds_alternative<U>();
+}
+
+template<size_t I, typename... T>
+auto* nuo_get_if(nuo_variant<T...>* v) noexcept {
+    return v ? v->template get_if<I>() : nullptr;
+}
+
+template<size_t I, typename... T>
+auto* nuo_get_if(const nuo_variant<T...>* v) noexcept {
+    return v ? v->template get_if<I>() : nullptr;
+}
+
+} /* namespace nuostl */
+
+namespace std {
+
+/* for left value */
+template<size_t N, typename... T>
+decltype(auto) get(nuostl::nuo_variant<T...>& v) {
+    return v.template get<N>();
+}
+
+/* for const left value */
+template<size_t N, typename... T>
+decltype(auto) get(const nuostl::nuo_variant<T...>& v) {
+    return v.template get<N>();
+}
+
+/* for right value */
+template<size_t N, typename... T>
+decltype(auto) get(nuostl::nuo_variant<T...>&& v) {
+    return std::move(v).template get<N>();
+}
+
+/* by type, the type must occur exactly once */
+template<typename U, typename... T>
+decltype(auto) get(nuostl::nuo_variant<T...>& v) {
+    constexpr size_t i = nuostl::detail::nuo_unique_index<U, T...>();
+    static_assert(i < sizeof...(T), "Type must occur exactly once in nuo_variant");
+    return v.template get<i>();
+}
+
+template<typename U, typename... T>
+decltype(auto) get(const nuostl::nuo_variant<T...>& v) {
+    constexpr size_t i = nuostl::detail::nuo_unique_index<U, T...>();
+    static_assert(i < sizeof...(T), "Type must occur exactly once in nuo_variant");
+    return v.template get<i>();
+}
+
+template<typename... T>
+struct variant_size<nuostl::nuo_variant<T...>> :
+    std::integral_constant<size_t, sizeof...(T)> {};
+
+template<size_t N, typename... T>
+struct variant_alternative<N, nuostl::nuo_variant<T...>> {
+    static_assert(N < sizeof...(T), "variant_alternative index out of range for nuo_variant");
+    using type = nuostl::detail::nuo_type_at<N, T...>;
+};
+
+} /* namespace std */
+
+#endif
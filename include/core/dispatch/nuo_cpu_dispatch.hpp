@@ -0,0 +1,214 @@
+#ifndef NUOSTL_CORE_DISPATCH_NUO_CPU_DISPATCH_HPP_
+#define NUOSTL_CORE_DISPATCH_NUO_CPU_DISPATCH_HPP_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <utility>
+
+/*
+ * Runtime CPU dispatch shared by the vectorized kernels.
+ *
+ * The CPU is probed once, on first use, and the result is cached. Kernels
+ * are compiled for a given ISA level with the NUOSTL_TARGET_* attributes
+ * (no global -m flags needed) and registered in a nuo_dispatcher, a small
+ * function pointer table indexed by the active ISA level.
+ *
+ * The NUOSTL_FORCE_ISA environment variable (scalar, sse4.2, avx2, avx512)
+ * caps the active level so that every path can be exercised on one machine;
+ * it can never raise the level above what the hardware supports.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NUOSTL_ARCH_X86 1
+#define NUOSTL_TARGET_SSE42 __attribute__((target("sse4.2,popcnt")))
+#define NUOSTL_TARGET_AVX2 \
+    __attribute__((target("avx2,fma,bmi,bmi2,popcnt")))
+#define NUOSTL_TARGET_AVX512 \
+    __attribute__((target( \
+        "avx512f,avx512bw,avx512vl,avx512dq,avx2,fma,bmi,bmi2,popcnt")))
+#else
+#define NUOSTL_TARGET_SSE42
+#define NUOSTL_TARGET_AVX2
+#define NUOSTL_TARGET_AVX512
+#endif
+
+namespace nuostl {
+
+/* ISA levels, ordered: each level implies the previous ones. */
+enum class nuo_isa : uint8_t {
+    scalar = 0,
+    sse42 = 1,      /* SSE4.2 + POPCNT */
+    avx2 = 2,       /* AVX2 + FMA + BMI1/2 (x86-64-v3) */
+    avx512 = 3      /* AVX-512 F/BW/VL/DQ (x86-64-v4) */
+};
+
+inline constexpr unsigned nuo_isa_count = 4;
+
+struct nuo_cpu_features {
+    bool sse42 = false;
+    bool popcnt = false;
+    bool avx = false;
+    bool avx2 = false;
+    bool fma = false;
+    bool bmi1 = false;
+    bool bmi2 = false;
+    bool avx512f = false;
+    bool avx512bw = false;
+    bool avx512vl = false;
+    bool avx512dq = false;
+
+    /* highest level fully supported by the hardware */
+    nuo_isa isa = nuo_isa::scalar;
+};
+
+constexpr const char* nuo_isa_name(nuo_isa isa) noexcept {
+    switch (isa) {
+        case nuo_isa::sse42: return "sse4.2";
+        case nuo_isa::avx2: return "avx2";
+        case nuo_isa::avx512: return "avx512";
+        default: return "scalar";
+    }
+}
+
+namespace detail {
+
+inline nuo_cpu_features nuo_cpu_probe() noexcept {
+    nuo_cpu_features f;
+#if defined(NUOSTL_ARCH_X86)
+    __builtin_cpu_init();
+    f.sse42 = __builtin_cpu_supports("sse4.2");
+    f.popcnt = __builtin_cpu_supports("popcnt");
+    f.avx = __builtin_cpu_supports("avx");
+    f.avx2 = __builtin_cpu_supports("avx2");
+    f.fma = __builtin_cpu_supports("fma");
+    f.bmi1 = __builtin_cpu_supports("bmi");
+    f.bmi2 = __builtin_cpu_supports("bmi2");
+    f.avx512f = __builtin_cpu_supports("avx512f");
+    f.avx512bw = __builtin_cpu_supports("avx512bw");
+    f.avx512vl = __builtin_cpu_supports("avx512vl");
+    f.avx512dq = __builtin_cpu_supports("avx512dq");
+
+    if (f.sse42 && f.popcnt) {
+        f.isa = nuo_isa::sse42;
+        if (f.avx && f.avx2 && f.fma && f.bmi1 && f.bmi2) {
+            f.isa = nuo_isa::avx2;
+            if (f.avx512f && f.avx512bw && f.avx512vl && f.avx512dq)
+                f.isa = nuo_isa::avx512;
+        }
+    }
+#endif
+    return f;
+}
+
+inline bool nuo_isa_parse(const char* s, nuo_isa& out) noexcept {
+    if (strcmp(s, "scalar") == 0 || strcmp(s, "none") == 0)
+        out = nuo_isa::scalar;
+    else if (strcmp(s, "sse4.2") == 0 || strcmp(s, "sse42") == 0)
+        out = nuo_isa::sse42;
+    else if (strcmp(s, "avx2") == 0)
+        out = nuo_isa::avx2;
+    else if (strcmp(s, "avx512") == 0 || strcmp(s, "avx-512") == 0)
+        out = nuo_isa::avx512;
+    else
+        return false;
+    return true;
+}
+
+inline nuo_isa nuo_isa_clamp(nuo_isa want, nuo_isa have) noexcept {
+    return static_cast<uint8_t>(want) < static_cast<uint8_t>(have)
+        ? want : have;
+}
+
+}   /* namespace detail */
+
+/* Hardware features, probed on first call and cached. */
+inline const nuo_cpu_features& nuo_cpu_detect() noexcept {
+    static const nuo_cpu_features features = detail::nuo_cpu_probe();
+    return features;
+}
+
+namespace detail {
+
+inline std::atomic<uint8_t>& nuo_cpu_isa_slot() noexcept {
+    static std::atomic<uint8_t> slot{[] {
+        nuo_isa isa = nuo_cpu_detect().isa;
+        const char* env = getenv("NUOSTL_FORCE_ISA");
+        nuo_isa forced;
+        if (env != nullptr && nuo_isa_parse(env, forced))
+            isa = nuo_isa_clamp(forced, isa);
+        return static_cast<uint8_t>(isa);
+    }()};
+    return slot;
+}
+
+}   /* namespace detail */
+
+/* ISA level the dispatchers currently select. */
+inline nuo_isa nuo_cpu_isa() noexcept {
+    return static_cast<nuo_isa>(
+        detail::nuo_cpu_isa_slot().load(std::memory_order_relaxed));
+}
+
+/*
+ * Override the active level at runtime (tests, benchmarks). The level is
+ * clamped to the hardware, the effective level is returned.
+ */
+inline nuo_isa nuo_cpu_force_isa(nuo_isa isa) noexcept {
+    isa = detail::nuo_isa_clamp(isa, nuo_cpu_detect().isa);
+    detail::nuo_cpu_isa_slot().store(static_cast<uint8_t>(isa),
+                                     std::memory_order_relaxed);
+    return isa;
+}
+
+template<typename Sig>
+class nuo_dispatcher;
+
+/*
+ * Function pointer table with one slot per ISA level. Each slot holds the
+ * implementation registered for the highest level not above it, so a call
+ * is one relaxed load, one indexed load and one indirect call.
+ */
+template<typename R, typename... Args>
+class nuo_dispatcher<R(Args...)> {
+public:
+    using fn_type = R (*)(Args...);
+
+private:
+    fn_type table_[nuo_isa_count];
+    bool exact_[nuo_isa_count];
+
+public:
+    constexpr explicit nuo_dispatcher(fn_type scalar) noexcept :
+        table_{scalar, scalar, scalar, scalar},
+        exact_{true, false, false, false} {}
+
+    /* Register fn for isa, it also serves higher levels without their own */
+    constexpr nuo_dispatcher& add(nuo_isa isa, fn_type fn) noexcept {
+        unsigned level = static_cast<unsigned>(isa);
+        exact_[level] = true;
+        table_[level] = fn;
+        for (unsigned i = level + 1; i < nuo_isa_count && !exact_[i]; i++)
+            table_[i] = fn;
+        return *this;
+    }
+
+    constexpr fn_type resolve(nuo_isa isa) const noexcept {
+        return table_[static_cast<unsigned>(isa)];
+    }
+
+    fn_type resolve() const noexcept {
+        return resolve(nuo_cpu_isa());
+    }
+
+    R operator()(Args... args) const {
+        return resolve()(std::forward<Args>(args)...);
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef NUOSTL_CORE_EXECUTION_DETAIL_NUO_CPU_TOPOLOGY_HPP_
+#define NUOSTL_CORE_EXECUTION_DETAIL_NUO_CPU_TOPOLOGY_HPP_
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/*
+ * CPU and NUMA node enumeration for the scheduler's affinity options. On
+ * Linux the nodes come from /sys/devices/system/node, restricted to the
+ * CPUs the process may run on; elsewhere, or when sysfs is missing, all
+ * CPUs form a single node. No libnuma is needed.
+ */
+
+namespace nuostl {
+namespace detail {
+
+/* "0-3,8,10-11" -> {0, 1, 2, 3, 8, 10, 11} */
+inline std::vector<int> nuo_parse_cpu_list(const char* s) {
+    std::vector<int> cpus;
+    while (*s != '\0' && *s != '\n') {
+        char* end;
+        long lo = strtol(s, &end, 10);
+        if (end == s)
+            break;
+        long hi = lo;
+        s = end;
+        if (*s == '-') {
+            hi = strtol(s + 1, &end, 10);
+            s = end;
+        }
+        for (long c = lo; c <= hi; c++)
+            cpus.push_back(static_cast<int>(c));
+        if (*s == ',')
+            s++;
+    }
+    return cpus;
+}
+
+/* CPUs this process may run on, in increasing order */
+inline std::vector<int> nuo_allowed_cpus() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int c = 0; c < CPU_SETSIZE; c++) {
+            if (CPU_ISSET(c, &set))
+                cpus.push_back(c);
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        unsigned hw = std::thread::hardware_concurrency();
+        for (unsigned c = 0; c < (hw == 0 ? 1 : hw); c++)
+            cpus.push_back(static_cast<int>(c));
+    }
+    return cpus;
+}
+
+/* Allowed CPUs grouped by NUMA node, empty nodes dropped */
+inline std::vector<std::vector<int>> nuo_numa_nodes() {
+    const std::vector<int> allowed = nuo_allowed_cpus();
+    std::vector<std::vector<int>> nodes;
+#if defined(__linux__)
+    for (int node = 0; node < 1024; node++) {
+        char path[64];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+        FILE* f = fopen(path, "r");
+        if (f == nullptr)
+            break;
+        char buf[4096];
+        size_t len = fread(buf, 1, sizeof(buf) - 1, f);
+        fclose(f);
+        buf[len] = '\0';
+        std::vector<int> cpus;
+        for (int c : nuo_parse_cpu_list(buf)) {
+            for (int a : allowed) {
+                if (a == c) {
+                    cpus.push_back(c);
+                    break;
+                }
+            }
+        }
+        if (!cpus.empty())
+            nodes.push_back(std::move(cpus));
+    }
+#endif
+    if (nodes.empty())
+        nodes.push_back(allowed);
+    return nodes;
+}
+
+/*
+ * Placement order of the workers. compact fills one node before the next,
+ * so that threads sharing data share a last level cache; scatter deals
+ * the nodes out in turn, so that memory bandwidth scales with the first
+ * threads.
+ */
+inline std::vector<int> nuo_cpu_order(bool scatter) {
+    const std::vector<std::vector<int>> nodes = nuo_numa_nodes();
+    std::vector<int> order;
+    if (!scatter) {
+        for (const std::vector<int>& n : nodes)
+            order.insert(order.end(), n.begin(), n.end());
+        return order;
+    }
+    for (size_t i = 0;; i++) {
+        bool any = false;
+        for (const std::vector<int>& n : nodes) {
+            if (i < n.size()) {
+                order.push_back(n[i]);
+                any = true;
+            }
+        }
+        if (!any)
+            return order;
+    }
+}
+
+/* Pins the calling thread to one CPU; false when unsupported or refused */
+inline bool nuo_pin_this_thread(int cpu) noexcept {
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+        return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef NUOSTL_CORE_EXECUTION_DETAIL_NUO_WS_DEQUE_HPP_
+#define NUOSTL_CORE_EXECUTION_DETAIL_NUO_WS_DEQUE_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace nuostl {
+namespace detail {
+
+/*
+ * Chase-Lev work-stealing deque of T* (Chase and Lev 2005, with the C11
+ * orderings of Le et al. 2013). The owner thread pushes and pops at the
+ * bottom, any thread steals from the top; only the last element is
+ * contended, and then through a single CAS on top.
+ *
+ * The fences of the paper are folded into seq_cst accesses on bottom and
+ * top, which cost the same on x86 and keep the protocol visible to
+ * ThreadSanitizer. The ring grows by doubling; a retired ring is kept
+ * until the deque dies, since a thief may still be reading from it.
+ */
+template<typename T>
+class nuo_ws_deque {
+private:
+    struct ring {
+        size_t mask;
+        std::unique_ptr<std::atomic<T*>[]> slots;
+
+        explicit ring(size_t capacity)
+            : mask(capacity - 1), slots(new std::atomic<T*>[capacity]) {}
+
+        size_t capacity() const noexcept { return mask + 1; }
+
+        T* get(int64_t i) const noexcept {
+            return slots[static_cast<size_t>(i) & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t i, T* x) noexcept {
+            slots[static_cast<size_t>(i) & mask].store(x, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(64) std::atomic<int64_t> top_{0};
+    alignas(64) std::atomic<int64_t> bottom_{0};
+    std::atomic<ring*> ring_;
+    std::vector<std::unique_ptr<ring>> rings_;
+
+    ring* grow(ring* r, int64_t b, int64_t t) {
+        std::unique_ptr<ring> g(new ring(r->capacity() * 2));
+        for (int64_t i = t; i < b; i++)
+            g->put(i, r->get(i));
+        ring* p = g.get();
+        rings_.push_back(std::move(g));
+        ring_.store(p, std::memory_order_release);
+        return p;
+    }
+
+public:
+    /* Returned by steal() when it lost a race; the deque may not be empty */
+    static inline T* const lost_race = reinterpret_cast<T*>(uintptr_t(1));
+
+    explicit nuo_ws_deque(size_t capacity = 256) {
+        size_t c = 2;
+        while (c < capacity)
+            c *= 2;
+        rings_.emplace_back(new ring(c));
+        ring_.store(rings_.back().get(), std::memory_order_relaxed);
+    }
+
+    nuo_ws_deque(const nuo_ws_deque&) = delete;
+    nuo_ws_deque& operator=(const nuo_ws_deque&) = delete;
+
+    /* Owner only */
+    void push(T* x) {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_acquire);
+        ring* r = ring_.load(std::memory_order_relaxed);
+        if (b - t >= static_cast<int64_t>(r->capacity()))
+            r = grow(r, b, t);
+        r->put(b, x);
+        bottom_.store(b + 1, std::memory_order_seq_cst);
+    }
+
+    /* Owner only; the most recently pushed element, nullptr when empty */
+    T* pop() noexcept {
+        int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        ring* r = ring_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_seq_cst);
+        if (t > b) {
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T* x = r->get(b);
+        if (t == b) {
+            /* last element, race the thieves for it */
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                              std::memory_order_relaxed))
+                x = nullptr;
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+        return x;
+    }
+
+    /* Any thread; the oldest element, nullptr when empty, lost_race on a lost race */
+    T* steal() noexcept {
+        int64_t t = top_.load(std::memory_order_seq_cst);
+        int64_t b = bottom_.load(std::memory_order_seq_cst);
+        if (t >= b)
+            return nullptr;
+        ring* r = ring_.load(std::memory_order_acquire);
+        T* x = r->get(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed))
+            return lost_race;
+        return x;
+    }
+
+    /* A snapshot, exact only for the owner between its own operations */
+    bool empty() const noexcept {
+        return bottom_.load(std::memory_order_seq_cst) <= top_.load(std::memory_order_seq_cst);
+    }
+};
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
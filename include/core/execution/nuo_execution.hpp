@@ -0,0 +1,64 @@
+#ifndef NUOSTL_CORE_EXECUTION_NUO_EXECUTION_HPP_
+#define NUOSTL_CORE_EXECUTION_NUO_EXECUTION_HPP_
+
+#include <stddef.h>
+
+#include <type_traits>
+
+#include "./nuo_scheduler.hpp"
+
+/*
+ * Execution policies for the algorithm overloads, after the std ones:
+ * nuo_seq runs the serial algorithm, nuo_par runs it in chunks on the
+ * global nuo_scheduler. A policy may carry a grain, the chunk length in
+ * elements; 0 lets the algorithm pick one.
+ */
+
+namespace nuostl {
+
+struct nuo_sequenced_policy {};
+
+struct nuo_parallel_policy {
+    size_t grain = 0;
+
+    constexpr nuo_parallel_policy with_grain(size_t g) const noexcept {
+        return nuo_parallel_policy{g};
+    }
+};
+
+inline constexpr nuo_sequenced_policy nuo_seq{};
+inline constexpr nuo_parallel_policy nuo_par{};
+
+template<typename P>
+inline constexpr bool nuo_is_execution_policy_v = false;
+template<>
+inline constexpr bool nuo_is_execution_policy_v<nuo_sequenced_policy> = true;
+template<>
+inline constexpr bool nuo_is_execution_policy_v<nuo_parallel_policy> = true;
+
+template<typename P>
+concept nuo_execution_policy = nuo_is_execution_policy_v<std::remove_cvref_t<P>>;
+
+template<typename P>
+concept nuo_parallel_execution_policy =
+    std::is_same_v<std::remove_cvref_t<P>, nuo_parallel_policy>;
+
+namespace detail {
+
+/*
+ * Chunk length for a parallel pass over n elements: the policy's grain,
+ * else n split in a few chunks per thread, but at least min_grain so
+ * that a chunk outweighs a steal.
+ */
+inline size_t nuo_policy_grain(const nuo_parallel_policy& policy, size_t n,
+                               size_t min_grain) {
+    if (policy.grain != 0)
+        return policy.grain;
+    size_t g = n / (4 * nuo_num_threads());
+    return g < min_grain ? min_grain : g;
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
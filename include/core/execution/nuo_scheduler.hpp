@@ -0,0 +1,539 @@
+#ifndef NUOSTL_CORE_EXECUTION_NUO_SCHEDULER_HPP_
+#define NUOSTL_CORE_EXECUTION_NUO_SCHEDULER_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../data_types/nuo_optional.hpp"
+#include "../dispatch/nuo_cpu_dispatch.hpp"
+#include "./detail/nuo_cpu_topology.hpp"
+#include "./detail/nuo_ws_deque.hpp"
+
+/*
+ * Work-stealing scheduler behind the parallel algorithms.
+ *
+ * Every participating thread owns a slot with a Chase-Lev deque: slot 0
+ * belongs to the thread that enters a parallel region from outside, the
+ * others to persistent workers. Forking pushes a task on the own deque
+ * and joining pops it back, so an uncontended fork-join costs a push, a
+ * pop and no synchronization with other threads; idle threads steal the
+ * oldest (largest) task of a random victim. A thread waiting for a stolen
+ * task runs other tasks meanwhile instead of blocking.
+ *
+ * Loops are split lazily (lazy binary splitting, Tzannes et al. 2010): a
+ * range keeps running grain sized chunks and splits off its upper half
+ * only when its previous half was stolen, i.e. when some thread is idle.
+ * The effective chunk size therefore adapts to the load, and a loop on a
+ * busy or single thread machine costs a check per chunk.
+ *
+ * One region at a time enters from outside: a caller that finds slot 0
+ * taken (another thread's region) runs its work inline, as nested calls
+ * from within tasks are handled by their own slot.
+ *
+ * Idle workers spin briefly, then sleep on a condition variable; a push
+ * wakes one sleeper, which spreads the wake-ups along the split tree.
+ */
+
+namespace nuostl {
+
+/* Worker placement */
+enum class nuo_affinity : uint8_t {
+    none = 0,       /* left to the OS */
+    compact = 1,    /* fill one NUMA node before the next */
+    scatter = 2     /* deal the NUMA nodes out in turn */
+};
+
+struct nuo_scheduler_options {
+    /* threads taking part, the calling one included; 0 reads
+       NUOSTL_NUM_THREADS, then counts the CPUs the process may use */
+    size_t threads = 0;
+    nuo_affinity affinity = nuo_affinity::none;
+    /* CPU of worker i is cpus[(i - 1) % size], overrides affinity */
+    std::vector<int> cpus;
+};
+
+namespace detail {
+
+struct nuo_task {
+    void (*run)(nuo_task*) = nullptr;
+    std::atomic<bool> done{false};
+    std::exception_ptr error;
+};
+
+inline void nuo_task_execute(nuo_task* t) noexcept {
+    try {
+        t->run(t);
+    } catch (...) {
+        t->error = std::current_exception();
+    }
+    t->done.store(true, std::memory_order_release);
+}
+
+/* Runs a nullary callable owned by the forking frame */
+template<typename F>
+struct nuo_fn_task : nuo_task {
+    F* f;
+
+    explicit nuo_fn_task(F& fn) : f(&fn) {
+        run = [](nuo_task* t) { (*static_cast<nuo_fn_task*>(t)->f)(); };
+    }
+};
+
+inline void nuo_cpu_relax() noexcept {
+#if defined(NUOSTL_ARCH_X86)
+    __builtin_ia32_pause();
+#endif
+}
+
+inline size_t nuo_default_threads() {
+    const char* env = getenv("NUOSTL_NUM_THREADS");
+    if (env != nullptr) {
+        long long v = atoll(env);
+        if (v > 0)
+            return static_cast<size_t>(v);
+    }
+    return nuo_allowed_cpus().size();
+}
+
+}   /* namespace detail */
+
+class nuo_scheduler {
+private:
+    struct alignas(64) slot {
+        detail::nuo_ws_deque<detail::nuo_task> deque;
+        uint64_t seed = 0;
+    };
+
+    struct context {
+        nuo_scheduler* sched = nullptr;
+        size_t slot = 0;
+    };
+
+    /* Sets the calling thread's context for a scope */
+    struct context_scope {
+        context saved;
+
+        context_scope(nuo_scheduler* s, size_t i) : saved(current()) { current() = {s, i}; }
+        ~context_scope() { current() = saved; }
+    };
+
+    /* Half of a lazily split loop, lives in the frame that split it */
+    template<typename F>
+    struct range_task : detail::nuo_task {
+        nuo_scheduler* sched;
+        size_t first;
+        size_t last;
+        size_t grain;
+        F* f;
+
+        range_task(nuo_scheduler* s, size_t b, size_t e, size_t g, F& fn)
+            : sched(s), first(b), last(e), grain(g), f(&fn) {
+            run = [](detail::nuo_task* t) {
+                range_task* r = static_cast<range_task*>(t);
+                r->sched->split(current().slot, r->first, r->last, r->grain, *r->f);
+            };
+        }
+    };
+
+    /* Bounds the splits of one range; halving 32 times is plenty */
+    static constexpr size_t max_splits = 32;
+
+    nuo_scheduler_options options_;
+    size_t n_;
+    std::unique_ptr<slot[]> slots_;
+    std::vector<std::thread> threads_;
+    std::mutex master_;
+    std::mutex m_;
+    std::condition_variable wake_;
+    std::atomic<size_t> sleepers_{0};
+    std::atomic<bool> stop_{false};
+    uint64_t epoch_ = 0;
+
+    static context& current() noexcept {
+        static thread_local context c;
+        return c;
+    }
+
+    static std::mutex& global_mutex() {
+        static std::mutex m;
+        return m;
+    }
+
+    static std::unique_ptr<nuo_scheduler>& global_owner() {
+        static std::unique_ptr<nuo_scheduler> owner;
+        return owner;
+    }
+
+    static std::atomic<nuo_scheduler*>& global_slot() noexcept {
+        static std::atomic<nuo_scheduler*> slot{nullptr};
+        return slot;
+    }
+
+    void work(size_t self, int cpu) {
+        if (cpu >= 0)
+            detail::nuo_pin_this_thread(cpu);
+        current() = {this, self};
+        unsigned idle = 0;
+        while (!stop_.load(std::memory_order_relaxed)) {
+            if (detail::nuo_task* t = find(self)) {
+                detail::nuo_task_execute(t);
+                idle = 0;
+            } else if (++idle < 64) {
+                detail::nuo_cpu_relax();
+            } else if (idle < 128) {
+                std::this_thread::yield();
+            } else {
+                sleep();
+                idle = 0;
+            }
+        }
+    }
+
+    /*
+     * sleepers_ and the deque ends are all seq_cst: either push() sees
+     * the sleeper, or the sleeper sees the pushed task.
+     */
+    void sleep() {
+        std::unique_lock<std::mutex> lock(m_);
+        sleepers_.fetch_add(1, std::memory_order_seq_cst);
+        if (!stop_.load(std::memory_order_relaxed) && !has_work()) {
+            uint64_t e = epoch_;
+            wake_.wait(lock, [&] {
+                return stop_.load(std::memory_order_relaxed) || epoch_ != e;
+            });
+        }
+        sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    bool has_work() const noexcept {
+        for (size_t i = 0; i < n_; i++) {
+            if (!slots_[i].deque.empty())
+                return true;
+        }
+        return false;
+    }
+
+    void push(size_t self, detail::nuo_task* t) {
+        slots_[self].deque.push(t);
+        if (sleepers_.load(std::memory_order_seq_cst) != 0) {
+            {
+                std::lock_guard<std::mutex> lock(m_);
+                epoch_++;
+            }
+            wake_.notify_one();
+        }
+    }
+
+    detail::nuo_task* find(size_t self) noexcept {
+        if (detail::nuo_task* t = slots_[self].deque.pop())
+            return t;
+        /* xorshift victim choice */
+        uint64_t& s = slots_[self].seed;
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        size_t v = static_cast<size_t>(s % n_);
+        for (size_t i = 0; i < n_; i++, v = v + 1 == n_ ? 0 : v + 1) {
+            if (v == self)
+                continue;
+            detail::nuo_task* t;
+            do {
+                t = slots_[v].deque.steal();
+            } while (t == detail::nuo_ws_deque<detail::nuo_task>::lost_race);
+            if (t != nullptr)
+                return t;
+        }
+        return nullptr;
+    }
+
+    /*
+     * Completes a task pushed by this slot: runs it inline when nobody
+     * stole it, otherwise helps with other work until the thief is done.
+     * Everything pushed after t has been joined already, so t is at the
+     * bottom of the deque if it is there at all.
+     */
+    void join(size_t self, detail::nuo_task& t) {
+        if (slots_[self].deque.pop() == &t) {
+            detail::nuo_task_execute(&t);
+            return;
+        }
+        unsigned idle = 0;
+        while (!t.done.load(std::memory_order_acquire)) {
+            if (detail::nuo_task* w = find(self)) {
+                detail::nuo_task_execute(w);
+                idle = 0;
+            } else if (++idle < 64) {
+                detail::nuo_cpu_relax();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    template<typename F1, typename F2>
+    void fork_join(size_t self, F1& a, F2& b) {
+        detail::nuo_fn_task<F2> t(b);
+        push(self, &t);
+        std::exception_ptr error;
+        try {
+            a();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        join(self, t);
+        if (error)
+            std::rethrow_exception(error);
+        if (t.error)
+            std::rethrow_exception(t.error);
+    }
+
+    /* Lazy binary splitting of [first, last), f(b, e) per chunk */
+    template<typename F>
+    void split(size_t self, size_t first, size_t last, size_t grain, F& f) {
+        using task = range_task<F>;
+        alignas(task) unsigned char storage[max_splits * sizeof(task)];
+        task* forks = reinterpret_cast<task*>(storage);
+        size_t n = 0;
+        std::exception_ptr error;
+        try {
+            while (last - first > grain) {
+                if (n < max_splits && slots_[self].deque.empty()) {
+                    /* the last half was taken, or this is the start */
+                    size_t mid = first + (last - first) / 2;
+                    push(self, ::new (static_cast<void*>(forks + n)) task(this, mid, last, grain, f));
+                    n++;
+                    last = mid;
+                } else {
+                    f(first, first + grain);
+                    first += grain;
+                }
+            }
+            f(first, last);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        while (n > 0) {
+            n--;
+            join(self, forks[n]);
+            if (!error && forks[n].error)
+                error = forks[n].error;
+            forks[n].~task();
+        }
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    /* Runs body(slot) as part of this scheduler, or returns false */
+    template<typename Body>
+    bool enter(Body&& body) {
+        context& c = current();
+        if (c.sched == this) {
+            body(c.slot);
+            return true;
+        }
+        if (n_ <= 1)
+            return false;
+        std::unique_lock<std::mutex> lock(master_, std::try_to_lock);
+        if (!lock.owns_lock())
+            return false;
+        context_scope scope(this, 0);
+        body(size_t(0));
+        return true;
+    }
+
+    template<typename T, typename Map, typename Combine>
+    T reduce_split(size_t first, size_t last, size_t grain, Map& map, Combine& combine) {
+        if (last - first <= grain)
+            return map(first, last);
+        size_t mid = first + (last - first) / 2;
+        nuo_optional<T> l;
+        nuo_optional<T> r;
+        invoke([&] { l.emplace(reduce_split<T>(first, mid, grain, map, combine)); },
+               [&] { r.emplace(reduce_split<T>(mid, last, grain, map, combine)); });
+        return combine(std::move(*l), std::move(*r));
+    }
+
+public:
+    /* Constructor */
+    explicit nuo_scheduler(const nuo_scheduler_options& options = nuo_scheduler_options())
+        : options_(options) {
+        n_ = options_.threads != 0 ? options_.threads : detail::nuo_default_threads();
+        options_.threads = n_;
+        slots_.reset(new slot[n_]);
+        for (size_t i = 0; i < n_; i++)
+            slots_[i].seed = 0x9e3779b97f4a7c15ull * (i + 1);
+
+        std::vector<int> cpus = options_.cpus;
+        if (cpus.empty() && options_.affinity != nuo_affinity::none)
+            cpus = detail::nuo_cpu_order(options_.affinity == nuo_affinity::scatter);
+        threads_.reserve(n_ - 1);
+        for (size_t i = 1; i < n_; i++) {
+            int cpu = cpus.empty() ? -1 : cpus[(i - 1) % cpus.size()];
+            threads_.emplace_back([this, i, cpu] { work(i, cpu); });
+        }
+    }
+
+    nuo_scheduler(const nuo_scheduler&) = delete;
+    nuo_scheduler& operator=(const nuo_scheduler&) = delete;
+
+    /* Destructor */
+    ~nuo_scheduler() {
+        {
+            std::lock_guard<std::mutex> lock(m_);
+            stop_.store(true, std::memory_order_relaxed);
+            epoch_++;
+        }
+        wake_.notify_all();
+        for (std::thread& t : threads_)
+            t.join();
+    }
+
+    /* Threads taking part in a region, the calling one included */
+    size_t concurrency() const noexcept { return n_; }
+
+    const nuo_scheduler_options& options() const noexcept { return options_; }
+
+    /* The scheduler behind the parallel algorithms, started on first use */
+    static nuo_scheduler& global() {
+        nuo_scheduler* s = global_slot().load(std::memory_order_acquire);
+        if (s != nullptr)
+            return *s;
+        std::lock_guard<std::mutex> lock(global_mutex());
+        std::unique_ptr<nuo_scheduler>& owner = global_owner();
+        if (!owner) {
+            owner.reset(new nuo_scheduler());
+            global_slot().store(owner.get(), std::memory_order_release);
+        }
+        return *owner;
+    }
+
+    /*
+     * Replaces the global scheduler. No parallel region may be running,
+     * the old workers are joined before the new ones start.
+     */
+    static void configure(const nuo_scheduler_options& options) {
+        std::lock_guard<std::mutex> lock(global_mutex());
+        std::unique_ptr<nuo_scheduler>& owner = global_owner();
+        global_slot().store(nullptr, std::memory_order_release);
+        owner.reset();
+        owner.reset(new nuo_scheduler(options));
+        global_slot().store(owner.get(), std::memory_order_release);
+    }
+
+    /* Runs a() and b(), possibly in parallel; rethrows the first exception */
+    template<typename F1, typename F2>
+    void invoke(F1&& a, F2&& b) {
+        if (!enter([&](size_t self) { fork_join(self, a, b); })) {
+            a();
+            b();
+        }
+    }
+
+    /*
+     * Calls f(b, e) on disjoint chunks covering [first, last). Chunks are
+     * grain long except the last ones of each split; grain 0 picks one
+     * from the length and the thread count.
+     */
+    template<typename F>
+    void for_range(size_t first, size_t last, size_t grain, F&& f) {
+        if (first >= last)
+            return;
+        if (grain == 0) {
+            grain = (last - first) / (8 * n_);
+            grain = grain == 0 ? 1 : grain > 4096 ? 4096 : grain;
+        }
+        if (last - first <= grain || !enter([&](size_t self) { split(self, first, last, grain, f); }))
+            f(first, last);
+    }
+
+    /*
+     * combine(map(b0, e0), map(b1, e1), ...) over a split of [first, last)
+     * into chunks of at most grain, identity when empty. combine must be
+     * associative; the chunks are combined in order.
+     */
+    template<typename T, typename Map, typename Combine>
+    T reduce(size_t first, size_t last, T identity, Map&& map, Combine&& combine,
+             size_t grain = 0) {
+        if (first >= last)
+            return identity;
+        if (grain == 0)
+            grain = (last - first + 4 * n_ - 1) / (4 * n_);
+        return reduce_split<T>(first, last, grain, map, combine);
+    }
+};
+
+/* Threads of the global scheduler */
+inline size_t nuo_num_threads() {
+    return nuo_scheduler::global().concurrency();
+}
+
+inline void nuo_set_scheduler_options(const nuo_scheduler_options& options) {
+    nuo_scheduler::configure(options);
+}
+
+/* Keeps the affinity options, see nuo_scheduler::configure */
+inline void nuo_set_num_threads(size_t n) {
+    nuo_scheduler_options options = nuo_scheduler::global().options();
+    options.threads = n;
+    nuo_scheduler::configure(options);
+}
+
+template<typename F>
+void nuo_parallel_invoke(F&& f) {
+    f();
+}
+
+/* Calls every f, possibly in parallel, and returns when all are done */
+template<typename F1, typename F2, typename... Fs>
+void nuo_parallel_invoke(F1&& f1, F2&& f2, Fs&&... fs) {
+    if constexpr (sizeof...(Fs) == 0) {
+        nuo_scheduler::global().invoke(f1, f2);
+    } else {
+        nuo_scheduler::global().invoke(f1, [&] { nuo_parallel_invoke(f2, fs...); });
+    }
+}
+
+/* f(b, e) over chunks of [first, last), see nuo_scheduler::for_range */
+template<typename F>
+void nuo_parallel_for_range(size_t first, size_t last, F&& f, size_t grain = 0) {
+    nuo_scheduler::global().for_range(first, last, grain, f);
+}
+
+/* f(i) for every i in [first, last) */
+template<std::integral I, typename F>
+void nuo_parallel_for(I first, I last, F&& f, size_t grain = 0) {
+    using U = std::make_unsigned_t<I>;
+    if (!(first < last))
+        return;
+    /* in U, where a signed range wider than I's maximum cannot overflow */
+    const U n = static_cast<U>(static_cast<U>(last) - static_cast<U>(first));
+    nuo_scheduler::global().for_range(0, static_cast<size_t>(n), grain,
+        [&](size_t b, size_t e) {
+            for (size_t i = b; i < e; i++)
+                f(static_cast<I>(static_cast<U>(static_cast<U>(first) + static_cast<U>(i))));
+        });
+}
+
+template<typename T, typename Map, typename Combine>
+T nuo_parallel_reduce(size_t first, size_t last, T identity, Map&& map, Combine&& combine,
+                      size_t grain = 0) {
+    return nuo_scheduler::global().reduce(first, last, std::move(identity), map, combine,
+                                          grain);
+}
+
+}   /* namespace nuostl */
+
+#endif
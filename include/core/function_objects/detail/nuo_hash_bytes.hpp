@@ -0,0 +1,309 @@
+#ifndef NUOSTL_CORE_FUNCTION_OBJECTS_DETAIL_NUO_HASH_BYTES_HPP_
+#define NUOSTL_CORE_FUNCTION_OBJECTS_DETAIL_NUO_HASH_BYTES_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <bit>
+
+#include "../../dispatch/nuo_cpu_dispatch.hpp"
+
+#if defined(NUOSTL_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+/*
+ * Byte string hashing behind nuo_hash_bytes, in two regimes:
+ *
+ * - up to 256 bytes, the wyhash construction: 16 bytes at a time folded
+ *   into the state by a 64 x 64 -> 128 bit multiply (three independent
+ *   lanes above 48 bytes), the last 16 bytes read overlapping;
+ * - longer inputs, the xxh3 construction: eight 64-bit accumulators take
+ *   a 64-byte stripe per step, each lane adding the product of the two
+ *   32-bit halves of its word xor a per-stripe key, and its neighbour's
+ *   word. Every 16 stripes the accumulators are scrambled, and the last
+ *   64 bytes go in as one overlapping stripe. The stripe step is what the
+ *   AVX2 and AVX-512 kernels vectorize; they return the same accumulators
+ *   as the scalar loop, so a hash does not depend on the machine.
+ *
+ * Words are read little endian on every target.
+ */
+
+namespace nuostl {
+namespace detail {
+
+/* Bijective avalanche mixer, the Stafford variant 13 of the murmur3 finalizer */
+constexpr uint64_t nuo_mix64(uint64_t x) noexcept {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+/* 64 x 64 -> 128 bit product, high half xor low half */
+inline uint64_t nuo_mum(uint64_t a, uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+    return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+#else
+    uint64_t ha = a >> 32, la = static_cast<uint32_t>(a);
+    uint64_t hb = b >> 32, lb = static_cast<uint32_t>(b);
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    return lo ^ hi;
+#endif
+}
+
+inline uint64_t nuo_read64(const unsigned char* p) noexcept {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    if constexpr (std::endian::native == std::endian::big)
+        v = __builtin_bswap64(v);
+    return v;
+}
+
+inline uint64_t nuo_read32(const unsigned char* p) noexcept {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    if constexpr (std::endian::native == std::endian::big)
+        v = __builtin_bswap32(v);
+    return v;
+}
+
+/* wyhash secrets */
+inline constexpr uint64_t nuo_wy_s0 = 0x2d358dccaa6c78a5ull;
+inline constexpr uint64_t nuo_wy_s1 = 0x8bb84b93962eacc9ull;
+inline constexpr uint64_t nuo_wy_s2 = 0x4b33a62ed433d4a3ull;
+inline constexpr uint64_t nuo_wy_s3 = 0x4d5a2da51de1aa47ull;
+
+inline constexpr size_t nuo_hash_short_max = 256;
+inline constexpr size_t nuo_hash_stripe = 64;
+inline constexpr size_t nuo_hash_block_stripes = 16;
+
+/*
+ * Keys of the long regime: stripe s of a block uses [s, s + 8), the
+ * last stripe [16, 24), the scramble and the final fold [24, 32), the
+ * initial accumulators [32, 40). Drawn from splitmix64.
+ */
+struct nuo_hash_keys {
+    uint64_t k[40];
+};
+
+constexpr nuo_hash_keys nuo_make_hash_keys() noexcept {
+    nuo_hash_keys r{};
+    uint64_t x = 0x243f6a8885a308d3ull;
+    for (uint64_t& k : r.k) {
+        x += 0x9e3779b97f4a7c15ull;
+        k = nuo_mix64(x);
+    }
+    return r;
+}
+
+inline constexpr nuo_hash_keys nuo_hash_key = nuo_make_hash_keys();
+
+inline constexpr uint64_t nuo_hash_prime32 = 0x9e3779b1u;
+
+inline uint64_t nuo_hash_short(const unsigned char* p, size_t len, uint64_t seed) noexcept {
+    seed ^= nuo_mum(seed ^ nuo_wy_s0, nuo_wy_s1);
+    uint64_t a, b;
+    if (len <= 16) {
+        if (len >= 4) {
+            const size_t q = (len >> 3) << 2;
+            a = nuo_read32(p) << 32 | nuo_read32(p + q);
+            b = nuo_read32(p + len - 4) << 32 | nuo_read32(p + len - 4 - q);
+        } else if (len > 0) {
+            a = uint64_t(p[0]) << 16 | uint64_t(p[len >> 1]) << 8 | p[len - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = len;
+        if (i > 48) {
+            uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = nuo_mum(nuo_read64(p) ^ nuo_wy_s1, nuo_read64(p + 8) ^ seed);
+                see1 = nuo_mum(nuo_read64(p + 16) ^ nuo_wy_s2, nuo_read64(p + 24) ^ see1);
+                see2 = nuo_mum(nuo_read64(p + 32) ^ nuo_wy_s3, nuo_read64(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = nuo_mum(nuo_read64(p) ^ nuo_wy_s1, nuo_read64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        a = nuo_read64(p + i - 16);
+        b = nuo_read64(p + i - 8);
+    }
+    a ^= nuo_wy_s1;
+    b ^= seed;
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+    a = static_cast<uint64_t>(r);
+    b = static_cast<uint64_t>(r >> 64);
+#else
+    /* the low half, and the high half recovered from the fold */
+    uint64_t lo = a * b;
+    b = nuo_mum(a, b) ^ lo;
+    a = lo;
+#endif
+    return nuo_mum(a ^ nuo_wy_s0 ^ len, b ^ nuo_wy_s1);
+}
+
+/* The long regime, one stripe and one scramble at a time */
+inline void nuo_hash_stripe_scalar(uint64_t* acc, const unsigned char* p,
+                                   const uint64_t* key) noexcept {
+    for (size_t i = 0; i < 8; i++) {
+        uint64_t d = nuo_read64(p + 8 * i);
+        uint64_t k = d ^ key[i];
+        acc[i ^ 1] += d;
+        acc[i] += (k & 0xffffffffu) * (k >> 32);
+    }
+}
+
+inline void nuo_hash_scramble_scalar(uint64_t* acc, const uint64_t* key) noexcept {
+    for (size_t i = 0; i < 8; i++)
+        acc[i] = (acc[i] ^ (acc[i] >> 47) ^ key[i]) * nuo_hash_prime32;
+}
+
+inline void nuo_hash_long_scalar(uint64_t* acc, const unsigned char* p, size_t len) noexcept {
+    const uint64_t* key = nuo_hash_key.k;
+    const size_t block = nuo_hash_stripe * nuo_hash_block_stripes;
+    const size_t blocks = (len - 1) / block;
+    for (size_t b = 0; b < blocks; b++, p += block) {
+        for (size_t s = 0; s < nuo_hash_block_stripes; s++)
+            nuo_hash_stripe_scalar(acc, p + s * nuo_hash_stripe, key + s);
+        nuo_hash_scramble_scalar(acc, key + 24);
+    }
+    const size_t rest = len - blocks * block;
+    for (size_t s = 0; s < (rest - 1) / nuo_hash_stripe; s++)
+        nuo_hash_stripe_scalar(acc, p + s * nuo_hash_stripe, key + s);
+    nuo_hash_stripe_scalar(acc, p + rest - nuo_hash_stripe, key + 16);
+}
+
+#if defined(NUOSTL_ARCH_X86)
+
+/* AVX2, the accumulators in two registers of four */
+NUOSTL_TARGET_AVX2 inline __m256i nuo_hash_stripe_avx2(__m256i acc, const unsigned char* p,
+                                                       const uint64_t* key) {
+    __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i k = _mm256_xor_si256(d, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key)));
+    __m256i m = _mm256_mul_epu32(k, _mm256_srli_epi64(k, 32));
+    __m256i s = _mm256_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+    return _mm256_add_epi64(acc, _mm256_add_epi64(s, m));
+}
+
+NUOSTL_TARGET_AVX2 inline __m256i nuo_hash_scramble_avx2(__m256i acc, const uint64_t* key) {
+    const __m256i prime = _mm256_set1_epi32(static_cast<int32_t>(nuo_hash_prime32));
+    acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47));
+    acc = _mm256_xor_si256(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key)));
+    __m256i lo = _mm256_mul_epu32(acc, prime);
+    __m256i hi = _mm256_mul_epu32(_mm256_srli_epi64(acc, 32), prime);
+    return _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32));
+}
+
+NUOSTL_TARGET_AVX2 inline void nuo_hash_long_avx2(uint64_t* acc, const unsigned char* p,
+                                           size_t len) noexcept {
+    const uint64_t* key = nuo_hash_key.k;
+    const size_t block = nuo_hash_stripe * nuo_hash_block_stripes;
+    const size_t blocks = (len - 1) / block;
+    __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc));
+    __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + 4));
+    for (size_t b = 0; b < blocks; b++, p += block) {
+        for (size_t s = 0; s < nuo_hash_block_stripes; s++) {
+            a0 = nuo_hash_stripe_avx2(a0, p + s * nuo_hash_stripe, key + s);
+            a1 = nuo_hash_stripe_avx2(a1, p + s * nuo_hash_stripe + 32, key + s + 4);
+        }
+        a0 = nuo_hash_scramble_avx2(a0, key + 24);
+        a1 = nuo_hash_scramble_avx2(a1, key + 28);
+    }
+    const size_t rest = len - blocks * block;
+    for (size_t s = 0; s < (rest - 1) / nuo_hash_stripe; s++) {
+        a0 = nuo_hash_stripe_avx2(a0, p + s * nuo_hash_stripe, key + s);
+        a1 = nuo_hash_stripe_avx2(a1, p + s * nuo_hash_stripe + 32, key + s + 4);
+    }
+    a0 = nuo_hash_stripe_avx2(a0, p + rest - nuo_hash_stripe, key + 16);
+    a1 = nuo_hash_stripe_avx2(a1, p + rest - nuo_hash_stripe + 32, key + 20);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc), a0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + 4), a1);
+}
+
+/* AVX-512, all eight accumulators in one register */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+
+NUOSTL_TARGET_AVX512 inline __m512i nuo_hash_stripe_avx512(__m512i acc, const unsigned char* p,
+                                                           const uint64_t* key) {
+    __m512i d = _mm512_loadu_si512(p);
+    __m512i k = _mm512_xor_si512(d, _mm512_loadu_si512(key));
+    __m512i m = _mm512_mul_epu32(k, _mm512_srli_epi64(k, 32));
+    __m512i s = _mm512_shuffle_epi32(d, static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(1, 0, 3, 2)));
+    return _mm512_add_epi64(acc, _mm512_add_epi64(s, m));
+}
+
+NUOSTL_TARGET_AVX512 inline __m512i nuo_hash_scramble_avx512(__m512i acc, const uint64_t* key) {
+    const __m512i prime = _mm512_set1_epi32(static_cast<int32_t>(nuo_hash_prime32));
+    acc = _mm512_xor_si512(acc, _mm512_srli_epi64(acc, 47));
+    acc = _mm512_xor_si512(acc, _mm512_loadu_si512(key));
+    __m512i lo = _mm512_mul_epu32(acc, prime);
+    __m512i hi = _mm512_mul_epu32(_mm512_srli_epi64(acc, 32), prime);
+    return _mm512_add_epi64(lo, _mm512_slli_epi64(hi, 32));
+}
+
+NUOSTL_TARGET_AVX512 inline void nuo_hash_long_avx512(uint64_t* acc, const unsigned char* p,
+                                               size_t len) noexcept {
+    const uint64_t* key = nuo_hash_key.k;
+    const size_t block = nuo_hash_stripe * nuo_hash_block_stripes;
+    const size_t blocks = (len - 1) / block;
+    __m512i a = _mm512_loadu_si512(acc);
+    for (size_t b = 0; b < blocks; b++, p += block) {
+        for (size_t s = 0; s < nuo_hash_block_stripes; s++)
+            a = nuo_hash_stripe_avx512(a, p + s * nuo_hash_stripe, key + s);
+        a = nuo_hash_scramble_avx512(a, key + 24);
+    }
+    const size_t rest = len - blocks * block;
+    for (size_t s = 0; s < (rest - 1) / nuo_hash_stripe; s++)
+        a = nuo_hash_stripe_avx512(a, p + s * nuo_hash_stripe, key + s);
+    a = nuo_hash_stripe_avx512(a, p + rest - nuo_hash_stripe, key + 16);
+    _mm512_storeu_si512(acc, a);
+}
+
+#pragma GCC diagnostic pop
+
+inline constexpr nuo_dispatcher<void(uint64_t*, const unsigned char*, size_t)>
+    nuo_hash_long_dispatch =
+        nuo_dispatcher<void(uint64_t*, const unsigned char*, size_t)>(&nuo_hash_long_scalar)
+            .add(nuo_isa::avx2, &nuo_hash_long_avx2)
+            .add(nuo_isa::avx512, &nuo_hash_long_avx512);
+
+#endif  /* NUOSTL_ARCH_X86 */
+
+/* len > nuo_hash_short_max */
+inline uint64_t nuo_hash_long(const unsigned char* p, size_t len, uint64_t seed) noexcept {
+    const uint64_t* key = nuo_hash_key.k;
+    uint64_t acc[8];
+    for (size_t i = 0; i < 8; i++)
+        acc[i] = key[32 + i] + seed;
+#if defined(NUOSTL_ARCH_X86)
+    nuo_hash_long_dispatch(acc, p, len);
+#else
+    nuo_hash_long_scalar(acc, p, len);
+#endif
+    uint64_t h = len * 0x9e3779b97f4a7c15ull ^ seed;
+    for (size_t i = 0; i < 8; i += 2)
+        h += nuo_mum(acc[i] ^ key[24 + i], acc[i + 1] ^ key[25 + i]);
+    return nuo_mix64(h);
+}
+
+}   /* namespace detail */
+}   /* namespace nuostl */
+
+#endif
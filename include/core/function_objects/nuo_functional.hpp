@@ -0,0 +1,256 @@
+#ifndef NUOSTL_CORE_FUNCTION_OBJECTS_NUO_FUNCTIONAL_HPP_
+#define NUOSTL_CORE_FUNCTION_OBJECTS_NUO_FUNCTIONAL_HPP_
+
+#include <stdint.h>
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Arithmetic, comparison, logical and bitwise function objects, similar
+ * to the std ones: nuo_less<T> compares two T, nuo_less<> (= nuo_less<void>)
+ * is transparent and compares any two operands without converting them,
+ * which is what heterogeneous lookup in the ordered containers needs.
+ *
+ * Unlike an arbitrary callable, these are known operations: nuo_op_kind_v
+ * tells an algorithm what one computes (std::less, std::plus, ... are
+ * recognized too), and the traits below derive what it may do with it:
+ *
+ * - nuo_is_less_v / nuo_is_greater_v: the comparison is the built-in one
+ *   on an arithmetic type, so SIMD min/max or a radix pass gives the same
+ *   answer as calling it;
+ * - nuo_is_associative_v / nuo_is_commutative_v: a reduction may be
+ *   split, reordered and run in lanes or on threads with an exact result.
+ *   Only integral operands qualify, floating point sums round;
+ * - nuo_op_identity<F, T>(): the neutral element for the split parts.
+ *
+ * A user-defined functor opts in by specializing nuo_op_traits with the
+ * kind it computes.
+ */
+
+namespace nuostl {
+
+enum class nuo_op_kind : uint8_t {
+    none = 0,
+    plus,
+    minus,
+    multiplies,
+    divides,
+    modulus,
+    negate,
+    equal_to,
+    not_equal_to,
+    less,
+    greater,
+    less_equal,
+    greater_equal,
+    logical_and,
+    logical_or,
+    logical_not,
+    bit_and,
+    bit_or,
+    bit_xor,
+    bit_not
+};
+
+/*
+ * A typed binary operation and its transparent <void> specialization.
+ * The typed form returns R (T or bool), the transparent one whatever the
+ * operator returns for the operands as given.
+ */
+#define NUOSTL_BINARY_FUNCTOR(name, R, op)                                   \
+    template<typename T = void>                                              \
+    struct name {                                                            \
+        constexpr R operator()(const T& a, const T& b) const {               \
+            return a op b;                                                   \
+        }                                                                    \
+    };                                                                       \
+                                                                             \
+    template<>                                                               \
+    struct name<void> {                                                      \
+        using is_transparent = void;                                         \
+                                                                             \
+        template<typename A, typename B>                                     \
+        constexpr auto operator()(A&& a, B&& b) const                        \
+            noexcept(noexcept(std::forward<A>(a) op std::forward<B>(b)))     \
+            -> decltype(std::forward<A>(a) op std::forward<B>(b)) {          \
+            return std::forward<A>(a) op std::forward<B>(b);                 \
+        }                                                                    \
+    };
+
+#define NUOSTL_UNARY_FUNCTOR(name, R, op)                                    \
+    template<typename T = void>                                              \
+    struct name {                                                            \
+        constexpr R operator()(const T& a) const {                           \
+            return op a;                                                     \
+        }                                                                    \
+    };                                                                       \
+                                                                             \
+    template<>                                                               \
+    struct name<void> {                                                      \
+        using is_transparent = void;                                         \
+                                                                             \
+        template<typename A>                                                 \
+        constexpr auto operator()(A&& a) const                               \
+            noexcept(noexcept(op std::forward<A>(a)))                        \
+            -> decltype(op std::forward<A>(a)) {                             \
+            return op std::forward<A>(a);                                    \
+        }                                                                    \
+    };
+
+/* Arithmetic */
+NUOSTL_BINARY_FUNCTOR(nuo_plus, T, +)
+NUOSTL_BINARY_FUNCTOR(nuo_minus, T, -)
+NUOSTL_BINARY_FUNCTOR(nuo_multiplies, T, *)
+NUOSTL_BINARY_FUNCTOR(nuo_divides, T, /)
+NUOSTL_BINARY_FUNCTOR(nuo_modulus, T, %)
+NUOSTL_UNARY_FUNCTOR(nuo_negate, T, -)
+
+/* Comparisons */
+NUOSTL_BINARY_FUNCTOR(nuo_equal_to, bool, ==)
+NUOSTL_BINARY_FUNCTOR(nuo_not_equal_to, bool, !=)
+NUOSTL_BINARY_FUNCTOR(nuo_less, bool, <)
+NUOSTL_BINARY_FUNCTOR(nuo_greater, bool, >)
+NUOSTL_BINARY_FUNCTOR(nuo_less_equal, bool, <=)
+NUOSTL_BINARY_FUNCTOR(nuo_greater_equal, bool, >=)
+
+/* Logical */
+NUOSTL_BINARY_FUNCTOR(nuo_logical_and, bool, &&)
+NUOSTL_BINARY_FUNCTOR(nuo_logical_or, bool, ||)
+NUOSTL_UNARY_FUNCTOR(nuo_logical_not, bool, !)
+
+/* Bitwise */
+NUOSTL_BINARY_FUNCTOR(nuo_bit_and, T, &)
+NUOSTL_BINARY_FUNCTOR(nuo_bit_or, T, |)
+NUOSTL_BINARY_FUNCTOR(nuo_bit_xor, T, ^)
+NUOSTL_UNARY_FUNCTOR(nuo_bit_not, T, ~)
+
+#undef NUOSTL_BINARY_FUNCTOR
+#undef NUOSTL_UNARY_FUNCTOR
+
+/* Specialize for functors computing one of the known operations */
+template<typename F>
+struct nuo_op_traits {
+    static constexpr nuo_op_kind kind = nuo_op_kind::none;
+};
+
+#define NUOSTL_KNOWN_OP(name, std_name)                                      \
+    template<typename T>                                                     \
+    struct nuo_op_traits<nuo_##name<T>> {                                    \
+        static constexpr nuo_op_kind kind = nuo_op_kind::name;               \
+    };                                                                       \
+    template<typename T>                                                     \
+    struct nuo_op_traits<std::std_name<T>> {                                 \
+        static constexpr nuo_op_kind kind = nuo_op_kind::name;               \
+    };
+
+NUOSTL_KNOWN_OP(plus, plus)
+NUOSTL_KNOWN_OP(minus, minus)
+NUOSTL_KNOWN_OP(multiplies, multiplies)
+NUOSTL_KNOWN_OP(divides, divides)
+NUOSTL_KNOWN_OP(modulus, modulus)
+NUOSTL_KNOWN_OP(negate, negate)
+NUOSTL_KNOWN_OP(equal_to, equal_to)
+NUOSTL_KNOWN_OP(not_equal_to, not_equal_to)
+NUOSTL_KNOWN_OP(less, less)
+NUOSTL_KNOWN_OP(greater, greater)
+NUOSTL_KNOWN_OP(less_equal, less_equal)
+NUOSTL_KNOWN_OP(greater_equal, greater_equal)
+NUOSTL_KNOWN_OP(logical_and, logical_and)
+NUOSTL_KNOWN_OP(logical_or, logical_or)
+NUOSTL_KNOWN_OP(logical_not, logical_not)
+NUOSTL_KNOWN_OP(bit_and, bit_and)
+NUOSTL_KNOWN_OP(bit_or, bit_or)
+NUOSTL_KNOWN_OP(bit_xor, bit_xor)
+NUOSTL_KNOWN_OP(bit_not, bit_not)
+
+#undef NUOSTL_KNOWN_OP
+
+template<typename F>
+inline constexpr nuo_op_kind nuo_op_kind_v = nuo_op_traits<std::remove_cvref_t<F>>::kind;
+
+template<typename F>
+concept nuo_known_op = nuo_op_kind_v<F> != nuo_op_kind::none;
+
+/* Has is_transparent, so lookups may take any key comparable with it */
+template<typename F>
+concept nuo_transparent = requires { typename std::remove_cvref_t<F>::is_transparent; };
+
+namespace detail {
+
+/* The operand type F applies to, T itself for the transparent forms */
+template<typename F, typename T>
+struct nuo_op_operand {
+    using type = T;
+};
+
+template<template<typename> class Op, typename U, typename T>
+    requires (!std::is_void_v<U>)
+struct nuo_op_operand<Op<U>, T> {
+    using type = U;
+};
+
+/* F is built-in on the arithmetic type T (and T is what F sees) */
+template<typename F, typename T>
+inline constexpr bool nuo_op_builtin_on =
+    nuo_known_op<F> && std::is_arithmetic_v<std::remove_cvref_t<T>> &&
+    std::is_same_v<typename nuo_op_operand<std::remove_cvref_t<F>, std::remove_cvref_t<T>>::type,
+                   std::remove_cvref_t<T>>;
+
+constexpr bool nuo_op_kind_reassociates(nuo_op_kind k) noexcept {
+    switch (k) {
+        case nuo_op_kind::plus:
+        case nuo_op_kind::multiplies:
+        case nuo_op_kind::logical_and:
+        case nuo_op_kind::logical_or:
+        case nuo_op_kind::bit_and:
+        case nuo_op_kind::bit_or:
+        case nuo_op_kind::bit_xor:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}   /* namespace detail */
+
+/* F(a, b) is a < b on the arithmetic type T */
+template<typename F, typename T>
+inline constexpr bool nuo_is_less_v =
+    detail::nuo_op_builtin_on<F, T> && nuo_op_kind_v<F> == nuo_op_kind::less;
+
+/* F(a, b) is a > b on the arithmetic type T */
+template<typename F, typename T>
+inline constexpr bool nuo_is_greater_v =
+    detail::nuo_op_builtin_on<F, T> && nuo_op_kind_v<F> == nuo_op_kind::greater;
+
+/* F(F(a, b), c) == F(a, F(b, c)) exactly for T */
+template<typename F, typename T>
+inline constexpr bool nuo_is_associative_v =
+    detail::nuo_op_builtin_on<F, T> && std::is_integral_v<std::remove_cvref_t<T>> &&
+    detail::nuo_op_kind_reassociates(nuo_op_kind_v<F>);
+
+/* F(a, b) == F(b, a) exactly for T; all the associative ones commute */
+template<typename F, typename T>
+inline constexpr bool nuo_is_commutative_v = nuo_is_associative_v<F, T>;
+
+/* The neutral element of F on T */
+template<typename F, typename T>
+    requires nuo_is_associative_v<F, T>
+constexpr T nuo_op_identity() noexcept {
+    switch (nuo_op_kind_v<F>) {
+        case nuo_op_kind::multiplies:
+        case nuo_op_kind::logical_and:
+            return T(1);
+        case nuo_op_kind::bit_and:
+            return static_cast<T>(~std::make_unsigned_t<std::conditional_t<
+                std::is_same_v<T, bool>, unsigned char, T>>(0));
+        default:
+            return T(0);
+    }
+}
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef NUOSTL_CORE_FUNCTION_OBJECTS_NUO_HASH_HPP_
+#define NUOSTL_CORE_FUNCTION_OBJECTS_NUO_HASH_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <bit>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "../data_types/nuo_pair.hpp"
+#include "../data_types/nuo_string.hpp"
+#include "../data_types/nuo_tuple.hpp"
+#include "../sequence_containers/nuo_string_view.hpp"
+#include "./detail/nuo_hash_bytes.hpp"
+
+/*
+ * Hashing for the unordered containers. nuo_hash<T> is the customization
+ * point, similar to std::hash but with every output bit depending on every
+ * input bit, so a table may take its bucket from the low or the high bits:
+ *
+ * - integers, enums and pointers: nuo_hash_mix, a bijective 64-bit mixer
+ *   (two multiplies), so distinct keys never collide before the table
+ *   reduces them, where std::hash is usually the identity;
+ * - float and double: the bits, with -0.0 hashed as 0.0;
+ * - nuo_string, nuo_string_view, std::string, std::string_view:
+ *   nuo_hash_bytes over the characters. These are transparent and agree
+ *   with each other, so a table of nuo_string can be probed with a view;
+ * - nuo_pair and nuo_tuple: the element hashes folded in order with
+ *   nuo_hash_combine;
+ * - any other type with a std::hash: its value, mixed.
+ *
+ * Specializing nuo_hash<T> for a user type plugs it in. Hashers that
+ * already avalanche declare is_avalanching (all of the above do); a table
+ * runs nuo_hash_mix over the output of any other.
+ *
+ * Hash values are the same on every machine and ISA level, but they are
+ * not keyed: a seed varies them, it does not defend a table against
+ * inputs chosen to collide.
+ */
+
+namespace nuostl {
+
+/* Bijective, avalanching 64-bit mixer */
+constexpr uint64_t nuo_hash_mix(uint64_t x) noexcept {
+    return detail::nuo_mix64(x);
+}
+
+/* 64-bit hash of len bytes, wyhash below 256 bytes and xxh3-style above */
+inline uint64_t nuo_hash_bytes(const void* data, size_t len, uint64_t seed = 0) noexcept {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    if (len <= detail::nuo_hash_short_max)
+        return detail::nuo_hash_short(p, len, seed);
+    return detail::nuo_hash_long(p, len, seed);
+}
+
+/*
+ * Folds the hash h of the next field into seed. Order matters:
+ * combine(combine(s, a), b) differs from combine(combine(s, b), a).
+ * h should itself be a hash, the fold adds no avalanche of its own.
+ */
+inline uint64_t nuo_hash_combine(uint64_t seed, uint64_t h) noexcept {
+    /* the product alone is 0 for h == nuo_wy_s1, whatever the seed */
+    return seed ^ detail::nuo_mum(seed ^ detail::nuo_wy_s0, h ^ detail::nuo_wy_s1);
+}
+
+/* The hasher's output needs no further mixing */
+template<typename H>
+concept nuo_avalanching_hash = requires { typename std::remove_cvref_t<H>::is_avalanching; };
+
+namespace detail {
+
+/* Disabled, as std::hash of a type without one */
+template<typename T>
+struct nuo_std_hash {};
+
+template<typename T>
+    requires std::is_default_constructible_v<std::hash<T>>
+struct nuo_std_hash<T> {
+    using is_avalanching = void;
+
+    size_t operator()(const T& v) const noexcept(noexcept(std::hash<T>()(v))) {
+        return static_cast<size_t>(nuo_hash_mix(static_cast<uint64_t>(std::hash<T>()(v))));
+    }
+};
+
+struct nuo_string_hash {
+    using is_transparent = void;
+    using is_avalanching = void;
+
+    size_t operator()(nuo_string_view s) const noexcept {
+        return static_cast<size_t>(nuo_hash_bytes(s.data(), s.size()));
+    }
+};
+
+}   /* namespace detail */
+
+template<typename T>
+struct nuo_hash : detail::nuo_std_hash<T> {};
+
+template<typename T>
+    requires (std::is_integral_v<T> || std::is_enum_v<T>)
+struct nuo_hash<T> {
+    using is_avalanching = void;
+
+    constexpr size_t operator()(T v) const noexcept {
+        if constexpr (std::is_enum_v<T>)
+            return static_cast<size_t>(
+                nuo_hash_mix(static_cast<uint64_t>(static_cast<std::underlying_type_t<T>>(v))));
+        else
+            return static_cast<size_t>(nuo_hash_mix(static_cast<uint64_t>(v)));
+    }
+};
+
+template<typename T>
+    requires (std::is_same_v<T, float> || std::is_same_v<T, double>)
+struct nuo_hash<T> {
+    using is_avalanching = void;
+
+    constexpr size_t operator()(T v) const noexcept {
+        using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+        return static_cast<size_t>(nuo_hash_mix(v == T(0) ? 0 : std::bit_cast<Bits>(v)));
+    }
+};
+
+template<typename T>
+struct nuo_hash<T*> {
+    using is_avalanching = void;
+
+    size_t operator()(T* p) const noexcept {
+        return static_cast<size_t>(nuo_hash_mix(reinterpret_cast<uintptr_t>(p)));
+    }
+};
+
+template<typename Alloc>
+struct nuo_hash<nuo_basic_string<Alloc>> : detail::nuo_string_hash {};
+
+template<>
+struct nuo_hash<nuo_string_view> : detail::nuo_string_hash {};
+
+template<>
+struct nuo_hash<std::string> : detail::nuo_string_hash {};
+
+template<>
+struct nuo_hash<std::string_view> : detail::nuo_string_hash {};
+
+template<typename T1, typename T2>
+struct nuo_hash<nuo_pair<T1, T2>> {
+    using is_avalanching = void;
+
+    size_t operator()(const nuo_pair<T1, T2>& p) const {
+        uint64_t a = nuo_hash<std::remove_cvref_t<T1>>()(p.first);
+        uint64_t b = nuo_hash<std::remove_cvref_t<T2>>()(p.second);
+        return static_cast<size_t>(nuo_hash_combine(a, b));
+    }
+};
+
+/* The same value as the nuo_pair of the two elements */
+template<typename... T>
+struct nuo_hash<nuo_tuple<T...>> {
+private:
+    template<size_t I>
+    using element = nuo_hash<std::remove_cvref_t<detail::nuo_type_at<I, T...>>>;
+public:
+    using is_avalanching = void;
+
+    size_t operator()(const nuo_tuple<T...>& t) const {
+        if constexpr (sizeof...(T) == 0) {
+            return 0;
+        } else {
+            return [&]<size_t... I>(std::index_sequence<I...>) {
+                uint64_t h = element<0>()(t.template get<0>());
+                ((h = nuo_hash_combine(h, element<I + 1>()(t.template get<I + 1>()))), ...);
+                return static_cast<size_t>(h);
+            }(std::make_index_sequence<sizeof...(T) - 1>());
+        }
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef NUOSTL_CORE_ITERATORS_NUO_ITERATOR_TRAITS_HPP_
+#define NUOSTL_CORE_ITERATORS_NUO_ITERATOR_TRAITS_HPP_
+
+#include <stddef.h>
+
+#include <concepts>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+/*
+ * Iterator traits and concepts for the algorithms. The categories are
+ * those of std (the tags are aliases, so std iterators and nuostl ones
+ * interoperate), with two additions the algorithms branch on:
+ *
+ * - contiguity: nuo_iterator_traits<It>::iterator_concept reports
+ *   contiguous_iterator_tag for pointers and for every iterator modelling
+ *   std::contiguous_iterator, which std::iterator_traits alone does not
+ *   tell (its iterator_category stops at random access);
+ * - trivial relocation: a type whose objects can be moved to new storage
+ *   by copying their bytes and forgetting the old ones, without running a
+ *   move constructor and a destructor. Trivially copyable types qualify;
+ *   other types opt in by specializing nuo_enable_trivially_relocatable.
+ */
+
+namespace nuostl {
+
+using nuo_input_iterator_tag = std::input_iterator_tag;
+using nuo_output_iterator_tag = std::output_iterator_tag;
+using nuo_forward_iterator_tag = std::forward_iterator_tag;
+using nuo_bidirectional_iterator_tag = std::bidirectional_iterator_tag;
+using nuo_random_access_iterator_tag = std::random_access_iterator_tag;
+using nuo_contiguous_iterator_tag = std::contiguous_iterator_tag;
+
+template<typename It>
+using nuo_iter_value_t = std::iter_value_t<It>;
+template<typename It>
+using nuo_iter_reference_t = std::iter_reference_t<It>;
+template<typename It>
+using nuo_iter_difference_t = std::iter_difference_t<It>;
+
+template<typename It>
+concept nuo_input_iterator = std::input_iterator<It>;
+
+template<typename It, typename T>
+concept nuo_output_iterator = std::output_iterator<It, T>;
+
+template<typename It>
+concept nuo_forward_iterator = std::forward_iterator<It>;
+
+template<typename It>
+concept nuo_bidirectional_iterator = std::bidirectional_iterator<It>;
+
+template<typename It>
+concept nuo_random_access_iterator = std::random_access_iterator<It>;
+
+template<typename It>
+concept nuo_contiguous_iterator = std::contiguous_iterator<It>;
+
+namespace detail {
+
+template<typename It>
+constexpr auto nuo_iterator_concept_of() noexcept {
+    if constexpr (std::contiguous_iterator<It>)
+        return nuo_contiguous_iterator_tag{};
+    else if constexpr (std::random_access_iterator<It>)
+        return nuo_random_access_iterator_tag{};
+    else if constexpr (std::bidirectional_iterator<It>)
+        return nuo_bidirectional_iterator_tag{};
+    else if constexpr (std::forward_iterator<It>)
+        return nuo_forward_iterator_tag{};
+    else if constexpr (std::input_iterator<It>)
+        return nuo_input_iterator_tag{};
+    else
+        return nuo_output_iterator_tag{};
+}
+
+}   /* namespace detail */
+
+/*
+ * std::iterator_traits plus iterator_concept, the strongest category It
+ * models, and is_contiguous.
+ */
+template<typename It>
+struct nuo_iterator_traits : std::iterator_traits<It> {
+    using iterator_concept = decltype(detail::nuo_iterator_concept_of<It>());
+    static constexpr bool is_contiguous = std::contiguous_iterator<It>;
+};
+
+/* Specialize to true for types whose bytes can be moved as they are */
+template<typename T>
+inline constexpr bool nuo_enable_trivially_relocatable = false;
+
+/* The standard smart pointers hold no pointer into themselves */
+template<typename T>
+inline constexpr bool nuo_enable_trivially_relocatable<std::unique_ptr<T>> = true;
+template<typename T>
+inline constexpr bool nuo_enable_trivially_relocatable<std::shared_ptr<T>> = true;
+template<typename T>
+inline constexpr bool nuo_enable_trivially_relocatable<std::weak_ptr<T>> = true;
+
+template<typename T>
+inline constexpr bool nuo_is_trivially_relocatable_v =
+    std::is_trivially_copyable_v<T> ||
+    (std::is_object_v<T> && !std::is_const_v<T> && !std::is_volatile_v<T> &&
+     nuo_enable_trivially_relocatable<T>);
+
+template<typename T>
+struct nuo_is_trivially_relocatable :
+    std::bool_constant<nuo_is_trivially_relocatable_v<T>> {};
+
+/*
+ * *out = *in over these iterators is a plain copy of the object bytes, so
+ * a whole range can go through memmove: both are contiguous over the same
+ * trivially copyable type (up to cv) and the assignment is trivial.
+ */
+template<typename In, typename Out>
+concept nuo_memcpyable_iterators =
+    std::contiguous_iterator<In> && std::contiguous_iterator<Out> &&
+    std::is_same_v<std::remove_cv_t<std::iter_value_t<In>>, std::iter_value_t<Out>> &&
+    std::is_trivially_copyable_v<std::iter_value_t<Out>> &&
+    std::is_trivially_assignable_v<std::iter_reference_t<Out>, std::iter_reference_t<In>>;
+
+/* The same for *out = std::move(*in) */
+template<typename In, typename Out>
+concept nuo_memmovable_iterators =
+    nuo_memcpyable_iterators<In, Out> &&
+    std::is_trivially_assignable_v<std::iter_reference_t<Out>, std::iter_rvalue_reference_t<In>>;
+
+}   /* namespace nuostl */
+
+#endif
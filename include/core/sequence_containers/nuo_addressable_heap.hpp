@@ -0,0 +1,201 @@
+#ifndef NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_ADDRESSABLE_HEAP_HPP_
+#define NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_ADDRESSABLE_HEAP_HPP_
+
+#include <stddef.h>
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../../nuo_typedefs.hpp"
+
+namespace nuostl {
+
+/*
+ * D-ary heap whose elements can be changed or removed after insertion:
+ * push() returns a handle, and update(handle, value) / erase(handle) sift
+ * the element from wherever it is now, so a decrease-key costs O(log n)
+ * instead of a lazy re-push that leaves stale entries behind.
+ *
+ * Each slot of the heap array carries its handle, and a table indexed by
+ * handle holds the slot, so every move inside a sift also writes one entry
+ * of that table. Handles of erased or popped elements are reused by later
+ * pushes. Priority order is as in nuo_priority_queue: top() is the element
+ * no other is less than.
+ *
+ * Handles and slot positions are stored as Index (idx_t by default, see
+ * nuo_typedefs.hpp); uint32_t halves the handle table and the id in each
+ * slot, e.g. 12 instead of 24 bytes per element for 4-byte keys, for heaps
+ * of fewer than 2^32 - 1 elements.
+ */
+template<typename T, typename Less = std::less<T>, size_t D = 4, nuo_index_type Index = idx_t>
+class nuo_addressable_heap {
+private:
+    static_assert(D >= 2, "nuo_addressable_heap: arity must be at least 2");
+
+    static constexpr Index npos = nuo_idx_npos<Index>;
+
+    struct slot {
+        T value;
+        Index id;
+    };
+
+    std::vector<slot> heap_;
+    /* Slot of each handle, npos if the handle is free */
+    std::vector<Index> pos_;
+    std::vector<Index> free_;
+    [[no_unique_address]] Less less_;
+
+    /* i < size() <= max_size(), so it fits */
+    void place(size_t i, slot&& s) {
+        pos_[s.id] = static_cast<Index>(i);
+        heap_[i] = std::move(s);
+    }
+
+    void sift_up(size_t hole, slot s) {
+        while (hole > 0) {
+            size_t parent = (hole - 1) / D;
+            if (!less_(heap_[parent].value, s.value))
+                break;
+            place(hole, std::move(heap_[parent]));
+            hole = parent;
+        }
+        place(hole, std::move(s));
+    }
+
+    void sift_down(size_t hole, slot s) {
+        size_t n = heap_.size();
+        for (;;) {
+            size_t first = D * hole + 1;
+            if (first >= n)
+                break;
+            size_t last = first + D < n ? first + D : n;
+            size_t best = first;
+            for (size_t c = first + 1; c < last; c++) {
+                if (less_(heap_[best].value, heap_[c].value))
+                    best = c;
+            }
+            if (!less_(s.value, heap_[best].value))
+                break;
+            place(hole, std::move(heap_[best]));
+            hole = best;
+        }
+        place(hole, std::move(s));
+    }
+
+    /* Puts s at i, moving it whichever way it has to go */
+    void fix(size_t i, slot s) {
+        if (i > 0 && less_(heap_[(i - 1) / D].value, s.value))
+            sift_up(i, std::move(s));
+        else
+            sift_down(i, std::move(s));
+    }
+
+    void remove_at(size_t i) {
+        pos_[heap_[i].id] = npos;
+        free_.push_back(heap_[i].id);
+        slot last = std::move(heap_.back());
+        heap_.pop_back();
+        if (i < heap_.size())
+            fix(i, std::move(last));
+    }
+
+    size_t check(size_t h) const {
+        if (!contains(h))
+            throw std::out_of_range("nuo_addressable_heap: invalid handle");
+        return pos_[h];
+    }
+public:
+    using value_type = T;
+    using value_compare = Less;
+    using size_type = size_t;
+    using handle_type = Index;
+    using index_type = Index;
+
+    static constexpr size_t arity = D;
+
+    /* Constructor */
+    nuo_addressable_heap() = default;
+
+    explicit nuo_addressable_heap(const Less& less) : less_(less) {}
+
+    /* Element access */
+    const T& top() const noexcept {
+        return heap_[0].value;
+    }
+
+    handle_type top_handle() const noexcept {
+        return heap_[0].id;
+    }
+
+    const T& get(handle_type h) const {
+        return heap_[check(h)].value;
+    }
+
+    /* Capacity */
+    bool empty() const noexcept { return heap_.empty(); }
+    size_type size() const noexcept { return heap_.size(); }
+    size_type max_size() const noexcept { return nuo_idx_max<Index> + 1; }
+
+    void reserve(size_type n) {
+        heap_.reserve(n);
+        pos_.reserve(n);
+    }
+
+    /* Modifiers */
+    handle_type push(T value) {
+        Index id;
+        if (free_.empty()) {
+            id = nuo_idx_cast<Index>(pos_.size());
+            pos_.push_back(npos);
+        } else {
+            id = free_.back();
+            free_.pop_back();
+        }
+        heap_.push_back(slot{std::move(value), id});
+        slot s = std::move(heap_.back());
+        sift_up(heap_.size() - 1, std::move(s));
+        return id;
+    }
+
+    void pop() {
+        remove_at(0);
+    }
+
+    /* Replaces the value of h and restores the heap in either direction */
+    void update(handle_type h, T value) {
+        fix(check(h), slot{std::move(value), h});
+    }
+
+    void erase(handle_type h) {
+        remove_at(check(h));
+    }
+
+    void clear() noexcept {
+        heap_.clear();
+        pos_.clear();
+        free_.clear();
+    }
+
+    void swap(nuo_addressable_heap& o) noexcept {
+        using std::swap;
+        swap(heap_, o.heap_);
+        swap(pos_, o.pos_);
+        swap(free_, o.free_);
+        swap(less_, o.less_);
+    }
+
+    friend void swap(nuo_addressable_heap& a, nuo_addressable_heap& b) noexcept {
+        a.swap(b);
+    }
+
+    /* Operations */
+    bool contains(handle_type h) const noexcept {
+        return h < pos_.size() && pos_[h] != npos;
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
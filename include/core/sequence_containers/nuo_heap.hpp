@@ -0,0 +1,196 @@
+#ifndef NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_HEAP_HPP_
+#define NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_HEAP_HPP_
+
+#include <stddef.h>
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+/*
+ * Heap algorithms over random access ranges, like std::make_heap and
+ * friends but with D children per node (D = 4 by default): the children
+ * of i are D*i + 1 .. D*i + D. A 4-ary heap is half as deep as a binary
+ * one, so a pop touches half as many levels, and the D children a sift
+ * compares are adjacent in memory. As with std, less(a, b) means a has
+ * lower priority and the front of the range is the maximum.
+ *
+ * Every function takes the arity as its first template argument, e.g.
+ * nuo_push_heap<8>(v.begin(), v.end(), cmp); the same arity must be used
+ * for every call on a given range.
+ */
+
+namespace nuostl {
+
+namespace detail {
+
+/* Index of the child of parent with the highest priority, first .. first + D - 1 all present */
+template<size_t D, typename It, typename Diff, typename Less>
+inline Diff nuo_heap_best_full(It a, Diff first, Less& less) {
+    if constexpr (D == 4) {
+        /* a tournament: two independent compares, then one */
+        Diff l = less(a[first], a[first + 1]) ? first + 1 : first;
+        Diff r = less(a[first + 2], a[first + 3]) ? first + 3 : first + 2;
+        return less(a[l], a[r]) ? r : l;
+    } else {
+        Diff best = first;
+        for (Diff c = first + 1; c < first + static_cast<Diff>(D); c++)
+            best = less(a[best], a[c]) ? c : best;
+        return best;
+    }
+}
+
+template<size_t D, typename It, typename Diff, typename Less>
+inline Diff nuo_heap_best(It a, Diff first, Diff n, Less& less) {
+    if (first + static_cast<Diff>(D) <= n)
+        return nuo_heap_best_full<D>(a, first, less);
+    Diff best = first;
+    for (Diff c = first + 1; c < n; c++) {
+        if (less(a[best], a[c]))
+            best = c;
+    }
+    return best;
+}
+
+/* Heaps smaller than this are assumed cache resident and not prefetched */
+inline constexpr size_t nuo_heap_prefetch_bytes = size_t(1) << 18;
+
+/*
+ * Requests the children of first .. first + D - 1, which are contiguous,
+ * so that the next level is in flight while this one is compared; the
+ * compares of a sift become conditional moves, which would otherwise wait
+ * for each level's cache miss in turn.
+ */
+template<size_t D, typename It, typename Diff>
+inline void nuo_heap_prefetch_grandchildren(It a, Diff first, Diff n) {
+    if constexpr (std::contiguous_iterator<It>) {
+        using T = std::iter_value_t<It>;
+        Diff g = static_cast<Diff>(D) * first + 1;
+        if (static_cast<size_t>(n) > nuo_heap_prefetch_bytes / sizeof(T) && g < n) {
+            const char* p = reinterpret_cast<const char*>(std::to_address(a + g));
+            constexpr size_t bytes = D * D * sizeof(T);
+            for (size_t off = 0; off < bytes; off += 64)
+                __builtin_prefetch(p + off);
+        }
+    }
+}
+
+/* Moves value up from hole, not above top */
+template<size_t D, typename It, typename Diff, typename T, typename Less>
+inline void nuo_heap_sift_up(It a, Diff hole, Diff top, T&& value, Less& less) {
+    while (hole > top) {
+        Diff parent = (hole - 1) / static_cast<Diff>(D);
+        if (!less(a[parent], value))
+            break;
+        a[hole] = std::move(a[parent]);
+        hole = parent;
+    }
+    a[hole] = std::forward<T>(value);
+}
+
+/* Moves value down from hole within the first n elements */
+template<size_t D, typename It, typename Diff, typename T, typename Less>
+inline void nuo_heap_sift_down(It a, Diff hole, Diff n, T&& value, Less& less) {
+    for (;;) {
+        Diff first = static_cast<Diff>(D) * hole + 1;
+        if (first >= n)
+            break;
+        Diff best = nuo_heap_best<D>(a, first, n, less);
+        if (!less(value, a[best]))
+            break;
+        a[hole] = std::move(a[best]);
+        hole = best;
+    }
+    a[hole] = std::forward<T>(value);
+}
+
+/*
+ * Replaces the front by value: the hole goes all the way down along the
+ * best children without comparing against value, which then climbs back.
+ * A value taken from the back of the heap nearly always belongs near the
+ * bottom, so this saves one compare per level over a plain sift down.
+ */
+template<size_t D, typename It, typename Diff, typename T, typename Less>
+inline void nuo_heap_replace_front(It a, Diff n, T&& value, Less& less) {
+    Diff hole = 0;
+    for (;;) {
+        Diff first = static_cast<Diff>(D) * hole + 1;
+        if (first >= n)
+            break;
+        nuo_heap_prefetch_grandchildren<D>(a, first, n);
+        Diff best = nuo_heap_best<D>(a, first, n, less);
+        a[hole] = std::move(a[best]);
+        hole = best;
+    }
+    nuo_heap_sift_up<D>(a, hole, Diff(0), std::forward<T>(value), less);
+}
+
+}   /* namespace detail */
+
+/* [first, last - 1) is a heap; adds *(last - 1) */
+template<size_t D = 4, std::random_access_iterator It, typename Less = std::less<>>
+void nuo_push_heap(It first, It last, Less less = Less()) {
+    static_assert(D >= 2, "nuo_push_heap: arity must be at least 2");
+    using Diff = std::iter_difference_t<It>;
+    Diff n = last - first;
+    if (n < 2)
+        return;
+    std::iter_value_t<It> value = std::move(first[n - 1]);
+    detail::nuo_heap_sift_up<D>(first, n - 1, Diff(0), std::move(value), less);
+}
+
+/* Moves the front to last - 1 and makes [first, last - 1) a heap */
+template<size_t D = 4, std::random_access_iterator It, typename Less = std::less<>>
+void nuo_pop_heap(It first, It last, Less less = Less()) {
+    static_assert(D >= 2, "nuo_pop_heap: arity must be at least 2");
+    using Diff = std::iter_difference_t<It>;
+    Diff n = last - first;
+    if (n < 2)
+        return;
+    std::iter_value_t<It> value = std::move(first[n - 1]);
+    first[n - 1] = std::move(first[0]);
+    detail::nuo_heap_replace_front<D>(first, n - 1, std::move(value), less);
+}
+
+/* Floyd's bottom-up construction, O(n) */
+template<size_t D = 4, std::random_access_iterator It, typename Less = std::less<>>
+void nuo_make_heap(It first, It last, Less less = Less()) {
+    static_assert(D >= 2, "nuo_make_heap: arity must be at least 2");
+    using Diff = std::iter_difference_t<It>;
+    Diff n = last - first;
+    if (n < 2)
+        return;
+    for (Diff i = (n - 2) / static_cast<Diff>(D) + 1; i-- > 0;) {
+        std::iter_value_t<It> value = std::move(first[i]);
+        detail::nuo_heap_sift_down<D>(first, i, n, std::move(value), less);
+    }
+}
+
+/* Heap to ascending order */
+template<size_t D = 4, std::random_access_iterator It, typename Less = std::less<>>
+void nuo_sort_heap(It first, It last, Less less = Less()) {
+    for (; last - first > 1; --last)
+        nuo_pop_heap<D>(first, last, less);
+}
+
+/* End of the longest prefix that is a heap */
+template<size_t D = 4, std::random_access_iterator It, typename Less = std::less<>>
+It nuo_is_heap_until(It first, It last, Less less = Less()) {
+    using Diff = std::iter_difference_t<It>;
+    Diff n = last - first;
+    for (Diff i = 1; i < n; i++) {
+        if (less(first[(i - 1) / static_cast<Diff>(D)], first[i]))
+            return first + i;
+    }
+    return last;
+}
+
+template<size_t D = 4, std::random_access_iterator It, typename Less = std::less<>>
+bool nuo_is_heap(It first, It last, Less less = Less()) {
+    return nuo_is_heap_until<D>(first, last, less) == last;
+}
+
+}   /* namespace nuostl */
+
+#endif
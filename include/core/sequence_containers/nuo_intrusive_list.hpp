@@ -0,0 +1,393 @@
+#ifndef NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_INTRUSIVE_LIST_HPP_
+#define NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_INTRUSIVE_LIST_HPP_
+
+#include <stddef.h>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace nuostl {
+
+template<typename T, typename Tag>
+class nuo_intrusive_list;
+
+/*
+ * Links of a doubly linked intrusive list. A type derives from
+ * nuo_list_hook<Tag> once per list it can be in at the same time, with a
+ * distinct Tag each. Copying an object does not copy its membership.
+ */
+template<typename Tag = void>
+class nuo_list_hook {
+private:
+    template<typename, typename>
+    friend class nuo_intrusive_list;
+
+    nuo_list_hook* next_ = nullptr;
+    nuo_list_hook* prev_ = nullptr;
+public:
+    constexpr nuo_list_hook() noexcept = default;
+    constexpr nuo_list_hook(const nuo_list_hook&) noexcept {}
+    constexpr nuo_list_hook& operator=(const nuo_list_hook&) noexcept { return *this; }
+
+    bool is_linked() const noexcept {
+        return next_ != nullptr;
+    }
+};
+
+/*
+ * Doubly linked list of objects the caller owns, similar to
+ * boost::intrusive::list. T derives from nuo_list_hook<Tag>; the list
+ * stores no copies and never allocates, it only relinks hooks. Insertion,
+ * erasure, iterator_to and every form of splice are O(1) (range splice
+ * from another list takes the element count or counts the range).
+ *
+ * Erasing unlinks an object without destroying it; the *_and_dispose
+ * variants hand each unlinked object to a callback, after the list is
+ * already consistent, so the callback may free it. An object must be
+ * unlinked before it is destroyed.
+ */
+template<typename T, typename Tag = void>
+class nuo_intrusive_list {
+private:
+    using hook = nuo_list_hook<Tag>;
+
+    static_assert(std::is_base_of_v<hook, T>,
+        "nuo_intrusive_list: T must derive from nuo_list_hook<Tag>");
+
+    /* Circular through head_; an empty list points head_ at itself */
+    hook head_;
+    size_t size_ = 0;
+
+    static T& value_of(hook* h) noexcept {
+        return static_cast<T&>(*h);
+    }
+
+    static hook* hook_of(T& x) noexcept {
+        return static_cast<hook*>(&x);
+    }
+
+    void init() noexcept {
+        head_.next_ = head_.prev_ = &head_;
+        size_ = 0;
+    }
+
+    static void link_before(hook* pos, hook* h) noexcept {
+        h->next_ = pos;
+        h->prev_ = pos->prev_;
+        pos->prev_->next_ = h;
+        pos->prev_ = h;
+    }
+
+    static void unlink(hook* h) noexcept {
+        h->prev_->next_ = h->next_;
+        h->next_->prev_ = h->prev_;
+        h->next_ = h->prev_ = nullptr;
+    }
+
+    /* Move [first, last) in front of pos, all three already linked */
+    static void transfer(hook* pos, hook* first, hook* last) noexcept {
+        if (pos == last || first == last)
+            return;
+        hook* tail = last->prev_;
+        first->prev_->next_ = last;
+        last->prev_ = first->prev_;
+        tail->next_ = pos;
+        first->prev_ = pos->prev_;
+        pos->prev_->next_ = first;
+        pos->prev_ = tail;
+    }
+
+    /* Take over o's elements, *this being empty */
+    void adopt(nuo_intrusive_list& o) noexcept {
+        if (o.empty())
+            return;
+        head_.next_ = o.head_.next_;
+        head_.prev_ = o.head_.prev_;
+        head_.next_->prev_ = &head_;
+        head_.prev_->next_ = &head_;
+        size_ = o.size_;
+        o.init();
+    }
+
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class nuo_intrusive_list;
+        friend class basic_iterator<!Const>;
+
+        hook* h_ = nullptr;
+
+        explicit basic_iterator(const hook* h) noexcept : h_(const_cast<hook*>(h)) {}
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() noexcept = default;
+
+        template<bool C = Const>
+            requires C
+        basic_iterator(const basic_iterator<false>& o) noexcept : h_(o.h_) {}
+
+        /* The same position as a mutable iterator */
+        basic_iterator<false> unconst() const noexcept {
+            return basic_iterator<false>(h_);
+        }
+
+        reference operator*() const noexcept { return value_of(h_); }
+        pointer operator->() const noexcept { return &value_of(h_); }
+
+        basic_iterator& operator++() noexcept {
+            h_ = h_->next_;
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator t = *this;
+            h_ = h_->next_;
+            return t;
+        }
+
+        basic_iterator& operator--() noexcept {
+            h_ = h_->prev_;
+            return *this;
+        }
+
+        basic_iterator operator--(int) noexcept {
+            basic_iterator t = *this;
+            h_ = h_->prev_;
+            return t;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept {
+            return a.h_ == b.h_;
+        }
+    };
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /* Constructor */
+    nuo_intrusive_list() noexcept {
+        init();
+    }
+
+    template<typename It>
+    nuo_intrusive_list(It first, It last) noexcept {
+        init();
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    /* Destructor: the elements are left unlinked */
+    ~nuo_intrusive_list() {
+        clear();
+    }
+
+    nuo_intrusive_list(const nuo_intrusive_list&) = delete;
+    nuo_intrusive_list& operator=(const nuo_intrusive_list&) = delete;
+
+    nuo_intrusive_list(nuo_intrusive_list&& o) noexcept {
+        init();
+        adopt(o);
+    }
+
+    nuo_intrusive_list& operator=(nuo_intrusive_list&& o) noexcept {
+        if (this != &o) {
+            clear();
+            adopt(o);
+        }
+        return *this;
+    }
+
+    /* Iterators */
+    iterator begin() noexcept { return iterator(head_.next_); }
+    const_iterator begin() const noexcept { return const_iterator(head_.next_); }
+    iterator end() noexcept { return iterator(&head_); }
+    const_iterator end() const noexcept { return const_iterator(&head_); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    /* Iterator to an element of this list */
+    iterator iterator_to(T& x) noexcept { return iterator(hook_of(x)); }
+    const_iterator iterator_to(const T& x) const noexcept {
+        return const_iterator(hook_of(const_cast<T&>(x)));
+    }
+
+    /* Capacity */
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+
+    /* Element access */
+    T& front() noexcept { return value_of(head_.next_); }
+    const T& front() const noexcept { return value_of(head_.next_); }
+    T& back() noexcept { return value_of(head_.prev_); }
+    const T& back() const noexcept { return value_of(head_.prev_); }
+
+    /* Modifiers */
+    void push_front(T& x) noexcept {
+        insert(begin(), x);
+    }
+
+    void push_back(T& x) noexcept {
+        insert(end(), x);
+    }
+
+    void pop_front() noexcept {
+        erase(begin());
+    }
+
+    void pop_back() noexcept {
+        erase(iterator(head_.prev_));
+    }
+
+    /* x must not be linked into a list through this hook */
+    iterator insert(const_iterator pos, T& x) noexcept {
+        link_before(pos.h_, hook_of(x));
+        size_++;
+        return iterator(hook_of(x));
+    }
+
+    iterator erase(const_iterator pos) noexcept {
+        hook* next = pos.h_->next_;
+        unlink(pos.h_);
+        size_--;
+        return iterator(next);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        return erase_and_dispose(first, last, [](T&) {});
+    }
+
+    template<typename Dispose>
+    iterator erase_and_dispose(const_iterator pos, Dispose&& dispose) {
+        T& x = value_of(pos.h_);
+        iterator next = erase(pos);
+        dispose(x);
+        return next;
+    }
+
+    /* Detaches the whole range in one relink, then disposes element by element */
+    template<typename Dispose>
+    iterator erase_and_dispose(const_iterator first, const_iterator last, Dispose&& dispose) {
+        hook* h = first.h_;
+        hook* end = last.h_;
+        if (h == end)
+            return iterator(end);
+        h->prev_->next_ = end;
+        end->prev_ = h->prev_;
+        while (h != end) {
+            hook* next = h->next_;
+            h->next_ = h->prev_ = nullptr;
+            size_--;
+            dispose(value_of(h));
+            h = next;
+        }
+        return iterator(end);
+    }
+
+    void clear() noexcept {
+        erase(begin(), end());
+    }
+
+    template<typename Dispose>
+    void clear_and_dispose(Dispose&& dispose) {
+        erase_and_dispose(begin(), end(), std::forward<Dispose>(dispose));
+    }
+
+    void swap(nuo_intrusive_list& o) noexcept {
+        nuo_intrusive_list t(std::move(o));
+        o.adopt(*this);
+        adopt(t);
+    }
+
+    friend void swap(nuo_intrusive_list& a, nuo_intrusive_list& b) noexcept {
+        a.swap(b);
+    }
+
+    /* Operations */
+    /* All of o in front of pos */
+    void splice(const_iterator pos, nuo_intrusive_list& o) noexcept {
+        if (o.empty() || &o == this)
+            return;
+        transfer(pos.h_, o.head_.next_, &o.head_);
+        size_ += o.size_;
+        o.size_ = 0;
+    }
+
+    void splice(const_iterator pos, nuo_intrusive_list&& o) noexcept {
+        splice(pos, o);
+    }
+
+    /* The element at it, which may already be in this list */
+    void splice(const_iterator pos, nuo_intrusive_list& o, const_iterator it) noexcept {
+        hook* h = it.h_;
+        if (h == pos.h_ || h->next_ == pos.h_)
+            return;
+        transfer(pos.h_, h, h->next_);
+        o.size_--;
+        size_++;
+    }
+
+    /* [first, last) holding n elements, pos not inside it */
+    void splice(const_iterator pos, nuo_intrusive_list& o, const_iterator first,
+                const_iterator last, size_type n) noexcept {
+        transfer(pos.h_, first.h_, last.h_);
+        o.size_ -= n;
+        size_ += n;
+    }
+
+    /* Counts [first, last) unless o is this list */
+    void splice(const_iterator pos, nuo_intrusive_list& o, const_iterator first,
+                const_iterator last) noexcept {
+        size_type n = 0;
+        if (&o != this) {
+            for (const_iterator it = first; it != last; ++it)
+                n++;
+        }
+        splice(pos, o, first, last, n);
+    }
+
+    /* Unlinks every element for which pred is true */
+    template<typename Pred>
+    size_type remove_if(Pred pred) {
+        size_type n = 0;
+        for (iterator it = begin(); it != end();) {
+            if (pred(*it)) {
+                it = erase(it);
+                n++;
+            } else {
+                ++it;
+            }
+        }
+        return n;
+    }
+
+    void reverse() noexcept {
+        hook* h = &head_;
+        do {
+            std::swap(h->next_, h->prev_);
+            h = h->prev_;
+        } while (h != &head_);
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
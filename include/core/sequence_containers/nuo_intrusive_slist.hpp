@@ -0,0 +1,376 @@
+#ifndef NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_INTRUSIVE_SLIST_HPP_
+#define NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_INTRUSIVE_SLIST_HPP_
+
+#include <stddef.h>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace nuostl {
+
+template<typename T, typename Tag>
+class nuo_intrusive_slist;
+
+/* Link of a singly linked intrusive list, see nuo_list_hook */
+template<typename Tag = void>
+class nuo_slist_hook {
+private:
+    template<typename, typename>
+    friend class nuo_intrusive_slist;
+
+    nuo_slist_hook* next_ = nullptr;
+    bool linked_ = false;
+public:
+    constexpr nuo_slist_hook() noexcept = default;
+    constexpr nuo_slist_hook(const nuo_slist_hook&) noexcept {}
+    constexpr nuo_slist_hook& operator=(const nuo_slist_hook&) noexcept { return *this; }
+
+    bool is_linked() const noexcept {
+        return linked_;
+    }
+};
+
+/*
+ * Singly linked list of objects the caller owns. Keeps a tail pointer and
+ * the size, so push_back, back and splicing a whole list at either end
+ * are O(1) as well as the usual forward_list operations. Positions are
+ * "before" iterators as in std::forward_list; before_begin() designates
+ * the head. Ownership rules are those of nuo_intrusive_list.
+ */
+template<typename T, typename Tag = void>
+class nuo_intrusive_slist {
+private:
+    using hook = nuo_slist_hook<Tag>;
+
+    static_assert(std::is_base_of_v<hook, T>,
+        "nuo_intrusive_slist: T must derive from nuo_slist_hook<Tag>");
+
+    /* head_.next_ is the first element, the last one points to nullptr */
+    hook head_;
+    hook* tail_;
+    size_t size_ = 0;
+
+    static T& value_of(hook* h) noexcept {
+        return static_cast<T&>(*h);
+    }
+
+    static hook* hook_of(T& x) noexcept {
+        return static_cast<hook*>(&x);
+    }
+
+    void init() noexcept {
+        head_.next_ = nullptr;
+        tail_ = &head_;
+        size_ = 0;
+    }
+
+    void adopt(nuo_intrusive_slist& o) noexcept {
+        if (o.empty())
+            return;
+        head_.next_ = o.head_.next_;
+        tail_ = o.tail_;
+        size_ = o.size_;
+        o.init();
+    }
+
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class nuo_intrusive_slist;
+        friend class basic_iterator<!Const>;
+
+        hook* h_ = nullptr;
+
+        explicit basic_iterator(const hook* h) noexcept : h_(const_cast<hook*>(h)) {}
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() noexcept = default;
+
+        template<bool C = Const>
+            requires C
+        basic_iterator(const basic_iterator<false>& o) noexcept : h_(o.h_) {}
+
+        /* The same position as a mutable iterator */
+        basic_iterator<false> unconst() const noexcept {
+            return basic_iterator<false>(h_);
+        }
+
+        reference operator*() const noexcept { return value_of(h_); }
+        pointer operator->() const noexcept { return &value_of(h_); }
+
+        basic_iterator& operator++() noexcept {
+            h_ = h_->next_;
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator t = *this;
+            h_ = h_->next_;
+            return t;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept {
+            return a.h_ == b.h_;
+        }
+    };
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /* Constructor */
+    nuo_intrusive_slist() noexcept {
+        init();
+    }
+
+    template<typename It>
+    nuo_intrusive_slist(It first, It last) noexcept {
+        init();
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    /* Destructor: the elements are left unlinked */
+    ~nuo_intrusive_slist() {
+        clear();
+    }
+
+    nuo_intrusive_slist(const nuo_intrusive_slist&) = delete;
+    nuo_intrusive_slist& operator=(const nuo_intrusive_slist&) = delete;
+
+    nuo_intrusive_slist(nuo_intrusive_slist&& o) noexcept {
+        init();
+        adopt(o);
+    }
+
+    nuo_intrusive_slist& operator=(nuo_intrusive_slist&& o) noexcept {
+        if (this != &o) {
+            clear();
+            adopt(o);
+        }
+        return *this;
+    }
+
+    /* Iterators */
+    iterator before_begin() noexcept { return iterator(&head_); }
+    const_iterator before_begin() const noexcept { return const_iterator(&head_); }
+    const_iterator cbefore_begin() const noexcept { return before_begin(); }
+    iterator begin() noexcept { return iterator(head_.next_); }
+    const_iterator begin() const noexcept { return const_iterator(head_.next_); }
+    iterator end() noexcept { return iterator(nullptr); }
+    const_iterator end() const noexcept { return const_iterator(nullptr); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /* Iterator to the last element, before_begin() when empty */
+    iterator before_end() noexcept { return iterator(tail_); }
+    const_iterator before_end() const noexcept { return const_iterator(tail_); }
+
+    iterator iterator_to(T& x) noexcept { return iterator(hook_of(x)); }
+    const_iterator iterator_to(const T& x) const noexcept {
+        return const_iterator(hook_of(const_cast<T&>(x)));
+    }
+
+    /* Capacity */
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+
+    /* Element access */
+    T& front() noexcept { return value_of(head_.next_); }
+    const T& front() const noexcept { return value_of(head_.next_); }
+    T& back() noexcept { return value_of(tail_); }
+    const T& back() const noexcept { return value_of(tail_); }
+
+    /* Modifiers */
+    void push_front(T& x) noexcept {
+        insert_after(before_begin(), x);
+    }
+
+    void push_back(T& x) noexcept {
+        insert_after(before_end(), x);
+    }
+
+    void pop_front() noexcept {
+        erase_after(before_begin());
+    }
+
+    /* x must not be linked into a list through this hook */
+    iterator insert_after(const_iterator pos, T& x) noexcept {
+        hook* h = hook_of(x);
+        h->next_ = pos.h_->next_;
+        h->linked_ = true;
+        pos.h_->next_ = h;
+        if (tail_ == pos.h_)
+            tail_ = h;
+        size_++;
+        return iterator(h);
+    }
+
+    /* Unlinks the element after pos, returns the one after that */
+    iterator erase_after(const_iterator pos) noexcept {
+        return erase_after_and_dispose(pos, [](T&) {});
+    }
+
+    /* Unlinks (first, last) */
+    iterator erase_after(const_iterator first, const_iterator last) noexcept {
+        return erase_after_and_dispose(first, last, [](T&) {});
+    }
+
+    template<typename Dispose>
+    iterator erase_after_and_dispose(const_iterator pos, Dispose&& dispose) {
+        hook* h = pos.h_->next_;
+        pos.h_->next_ = h->next_;
+        if (tail_ == h)
+            tail_ = pos.h_;
+        size_--;
+        h->next_ = nullptr;
+        h->linked_ = false;
+        dispose(value_of(h));
+        return iterator(pos.h_->next_);
+    }
+
+    /* Detaches (first, last) in one relink, then disposes element by element */
+    template<typename Dispose>
+    iterator erase_after_and_dispose(const_iterator first, const_iterator last,
+                                     Dispose&& dispose) {
+        hook* h = first.h_->next_;
+        hook* end = last.h_;
+        if (h == end)
+            return iterator(end);
+        first.h_->next_ = end;
+        if (end == nullptr)
+            tail_ = first.h_;
+        while (h != end) {
+            hook* next = h->next_;
+            h->next_ = nullptr;
+            h->linked_ = false;
+            size_--;
+            dispose(value_of(h));
+            h = next;
+        }
+        return iterator(end);
+    }
+
+    void clear() noexcept {
+        erase_after(before_begin(), end());
+    }
+
+    template<typename Dispose>
+    void clear_and_dispose(Dispose&& dispose) {
+        erase_after_and_dispose(before_begin(), end(), std::forward<Dispose>(dispose));
+    }
+
+    void swap(nuo_intrusive_slist& o) noexcept {
+        nuo_intrusive_slist t(std::move(o));
+        o.adopt(*this);
+        adopt(t);
+    }
+
+    friend void swap(nuo_intrusive_slist& a, nuo_intrusive_slist& b) noexcept {
+        a.swap(b);
+    }
+
+    /* Operations */
+    /* All of o after pos; O(1) */
+    void splice_after(const_iterator pos, nuo_intrusive_slist& o) noexcept {
+        if (o.empty() || &o == this)
+            return;
+        hook* p = pos.h_;
+        o.tail_->next_ = p->next_;
+        p->next_ = o.head_.next_;
+        if (tail_ == p)
+            tail_ = o.tail_;
+        size_ += o.size_;
+        o.init();
+    }
+
+    void splice_after(const_iterator pos, nuo_intrusive_slist&& o) noexcept {
+        splice_after(pos, o);
+    }
+
+    /* The element after it, which may already be in this list */
+    void splice_after(const_iterator pos, nuo_intrusive_slist& o, const_iterator it) noexcept {
+        hook* p = pos.h_;
+        hook* b = it.h_;
+        hook* h = b->next_;
+        if (p == b || p == h)
+            return;
+        b->next_ = h->next_;
+        if (o.tail_ == h)
+            o.tail_ = b;
+        h->next_ = p->next_;
+        p->next_ = h;
+        if (tail_ == p)
+            tail_ = h;
+        o.size_--;
+        size_++;
+    }
+
+    /* The elements after before_first up to and including last, n of them */
+    void splice_after(const_iterator pos, nuo_intrusive_slist& o, const_iterator before_first,
+                      const_iterator last, size_type n) noexcept {
+        hook* p = pos.h_;
+        hook* b = before_first.h_;
+        hook* l = last.h_;
+        if (b == l || p == l)
+            return;
+        hook* first = b->next_;
+        b->next_ = l->next_;
+        if (o.tail_ == l)
+            o.tail_ = b;
+        l->next_ = p->next_;
+        p->next_ = first;
+        if (tail_ == p)
+            tail_ = l;
+        o.size_ -= n;
+        size_ += n;
+    }
+
+    /* Moves o to the end; O(1) */
+    void append(nuo_intrusive_slist& o) noexcept {
+        splice_after(before_end(), o);
+    }
+
+    template<typename Pred>
+    size_type remove_if(Pred pred) {
+        size_type n = 0;
+        for (iterator prev = before_begin(); prev.h_->next_ != nullptr;) {
+            if (pred(value_of(prev.h_->next_))) {
+                erase_after(prev);
+                n++;
+            } else {
+                ++prev;
+            }
+        }
+        return n;
+    }
+
+    void reverse() noexcept {
+        hook* h = head_.next_;
+        hook* prev = nullptr;
+        tail_ = h != nullptr ? h : &head_;
+        while (h != nullptr) {
+            hook* next = h->next_;
+            h->next_ = prev;
+            prev = h;
+            h = next;
+        }
+        head_.next_ = prev;
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,557 @@
+#ifndef NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_LIST_HPP_
+#define NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_LIST_HPP_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <compare>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../allocators/nuo_malloc_allocator.hpp"
+#include "../allocators/nuo_node_pool.hpp"
+#include "./nuo_intrusive_list.hpp"
+
+namespace nuostl {
+
+/*
+ * Doubly linked list, similar to std::list, whose nodes come from a
+ * nuo_node_pool instead of one allocator call each. By default every list
+ * owns its pool; lists constructed from the same external pool_type
+ * share it, and only then splice moves nodes in O(1). Splicing between
+ * lists with different pools moves the elements one by one into the
+ * destination's nodes (iterators to them are invalidated), where
+ * std::list would have undefined behavior for unequal allocators.
+ *
+ * Range insertion reserves all nodes up front, builds the chain off-list
+ * and links it in one step; range erasure unlinks in one step and returns
+ * the nodes to the pool. Erased nodes are reused by later insertions;
+ * memory goes back to Alloc when the pool is destroyed.
+ *
+ * Example: two LRU segments moving entries without allocating
+ *     nuo_list<int>::pool_type pool;
+ *     nuo_list<int> hot(pool), cold(pool);
+ *     hot.splice(hot.begin(), cold, it);
+ */
+template<typename T, typename Alloc = nuo_malloc_allocator<T>>
+class nuo_list {
+private:
+    struct node : nuo_list_hook<> {
+        T value;
+
+        template<typename... Args>
+        explicit node(Args&&... args) : value(std::forward<Args>(args)...) {}
+    };
+
+    using links = nuo_intrusive_list<node>;
+    using node_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<node>;
+public:
+    using pool_type = nuo_node_pool<node, node_alloc>;
+
+private:
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class nuo_list;
+        friend class basic_iterator<!Const>;
+
+        using base = std::conditional_t<Const, typename links::const_iterator,
+                                        typename links::iterator>;
+
+        base it_;
+
+        explicit basic_iterator(base it) noexcept : it_(it) {}
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() noexcept = default;
+
+        template<bool C = Const>
+            requires C
+        basic_iterator(const basic_iterator<false>& o) noexcept : it_(o.it_) {}
+
+        reference operator*() const noexcept { return it_->value; }
+        pointer operator->() const noexcept { return &it_->value; }
+
+        basic_iterator& operator++() noexcept {
+            ++it_;
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator t = *this;
+            ++it_;
+            return t;
+        }
+
+        basic_iterator& operator--() noexcept {
+            --it_;
+            return *this;
+        }
+
+        basic_iterator operator--(int) noexcept {
+            basic_iterator t = *this;
+            --it_;
+            return t;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept {
+            return a.it_ == b.it_;
+        }
+    };
+
+    links links_;
+    pool_type own_;
+    pool_type* pool_;
+
+    bool owns_pool() const noexcept {
+        return pool_ == &own_;
+    }
+
+    template<typename... Args>
+    node* make_node(Args&&... args) {
+        void* p = pool_->allocate();
+        try {
+            return ::new (p) node(std::forward<Args>(args)...);
+        } catch (...) {
+            pool_->deallocate(p);
+            throw;
+        }
+    }
+
+    void drop_node(node& n) noexcept {
+        n.~node();
+        pool_->deallocate(&n);
+    }
+
+    /* Nodes for [first, last) in a detached chain, reserved in one go */
+    template<typename It>
+    links make_chain(It first, It last) {
+        links chain;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                          typename std::iterator_traits<It>::iterator_category>)
+            pool_->reserve(static_cast<size_t>(std::distance(first, last)));
+        try {
+            for (; first != last; ++first)
+                chain.push_back(*make_node(*first));
+        } catch (...) {
+            chain.clear_and_dispose([this](node& n) { drop_node(n); });
+            throw;
+        }
+        return chain;
+    }
+
+    links make_chain(size_t n, const T& value) {
+        links chain;
+        pool_->reserve(n);
+        try {
+            for (; n > 0; n--)
+                chain.push_back(*make_node(value));
+        } catch (...) {
+            chain.clear_and_dispose([this](node& x) { drop_node(x); });
+            throw;
+        }
+        return chain;
+    }
+
+    /* Moves the elements of [first, last) of o into new nodes before pos */
+    void move_elements(typename links::const_iterator pos, nuo_list& o,
+                       typename links::const_iterator first,
+                       typename links::const_iterator last) {
+        links chain;
+        try {
+            for (auto it = first; it != last; ++it)
+                chain.push_back(*make_node(std::move(const_cast<node&>(*it).value)));
+        } catch (...) {
+            chain.clear_and_dispose([this](node& n) { drop_node(n); });
+            throw;
+        }
+        o.links_.erase_and_dispose(first, last, [&o](node& n) { o.drop_node(n); });
+        links_.splice(pos, chain);
+    }
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /* Constructor */
+    nuo_list() noexcept : pool_(&own_) {}
+
+    /* Takes its nodes from pool, which must outlive the list */
+    explicit nuo_list(pool_type& pool) noexcept : pool_(&pool) {}
+
+    explicit nuo_list(size_type n) : pool_(&own_) {
+        resize(n);
+    }
+
+    nuo_list(size_type n, const T& value) : pool_(&own_) {
+        insert(end(), n, value);
+    }
+
+    template<std::input_iterator It>
+    nuo_list(It first, It last) : pool_(&own_) {
+        insert(end(), first, last);
+    }
+
+    nuo_list(std::initializer_list<T> il) : pool_(&own_) {
+        insert(end(), il.begin(), il.end());
+    }
+
+    /* Destructor */
+    ~nuo_list() {
+        clear();
+    }
+
+    /* Copy Constructor: the copy owns its pool */
+    nuo_list(const nuo_list& o) : pool_(&own_) {
+        insert(end(), o.begin(), o.end());
+    }
+
+    /* Keeps sharing o's pool if it had an external one */
+    nuo_list(nuo_list&& o) noexcept : pool_(&own_) {
+        swap(o);
+    }
+
+    /* Operator */
+    /* Group 0 */
+    /* Overwrites existing elements first, the pool stays the same */
+    nuo_list& operator=(const nuo_list& o) {
+        if (this != &o)
+            assign(o.begin(), o.end());
+        return *this;
+    }
+
+    nuo_list& operator=(nuo_list&& o) noexcept {
+        if (this != &o) {
+            nuo_list t(std::move(o));
+            swap(t);
+        }
+        return *this;
+    }
+
+    nuo_list& operator=(std::initializer_list<T> il) {
+        assign(il.begin(), il.end());
+        return *this;
+    }
+
+    /* Group 1 */
+    friend bool operator==(const nuo_list& a, const nuo_list& b)
+        requires std::equality_comparable<T> {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+    }
+
+    friend auto operator<=>(const nuo_list& a, const nuo_list& b)
+        requires std::three_way_comparable<T> {
+        return std::lexicographical_compare_three_way(a.begin(), a.end(),
+                                                      b.begin(), b.end());
+    }
+
+    template<std::input_iterator It>
+    void assign(It first, It last) {
+        iterator it = begin();
+        for (; it != end() && first != last; ++it, ++first)
+            *it = *first;
+        if (first == last)
+            erase(it, end());
+        else
+            insert(end(), first, last);
+    }
+
+    void assign(size_type n, const T& value) {
+        iterator it = begin();
+        for (; it != end() && n > 0; ++it, --n)
+            *it = value;
+        if (n == 0)
+            erase(it, end());
+        else
+            insert(end(), n, value);
+    }
+
+    /* Iterators */
+    iterator begin() noexcept { return iterator(links_.begin()); }
+    const_iterator begin() const noexcept { return const_iterator(links_.begin()); }
+    iterator end() noexcept { return iterator(links_.end()); }
+    const_iterator end() const noexcept { return const_iterator(links_.end()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    /* Capacity */
+    bool empty() const noexcept { return links_.empty(); }
+    size_type size() const noexcept { return links_.size(); }
+
+    /* Makes the next n insertions allocation-free */
+    void reserve(size_type n) {
+        pool_->reserve(n);
+    }
+
+    pool_type& pool() noexcept { return *pool_; }
+
+    /* Element access */
+    T& front() noexcept { return links_.front().value; }
+    const T& front() const noexcept { return links_.front().value; }
+    T& back() noexcept { return links_.back().value; }
+    const T& back() const noexcept { return links_.back().value; }
+
+    /* Modifiers */
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        return iterator(links_.insert(pos.it_, *make_node(std::forward<Args>(args)...)));
+    }
+
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        return *emplace(begin(), std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+
+    void push_front(const T& value) { emplace(begin(), value); }
+    void push_front(T&& value) { emplace(begin(), std::move(value)); }
+    void push_back(const T& value) { emplace(end(), value); }
+    void push_back(T&& value) { emplace(end(), std::move(value)); }
+
+    void pop_front() noexcept {
+        erase(begin());
+    }
+
+    void pop_back() noexcept {
+        erase(std::prev(end()));
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    iterator insert(const_iterator pos, size_type n, const T& value) {
+        links chain = make_chain(n, value);
+        return splice_chain(pos, chain);
+    }
+
+    template<std::input_iterator It>
+    iterator insert(const_iterator pos, It first, It last) {
+        links chain = make_chain(first, last);
+        return splice_chain(pos, chain);
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> il) {
+        return insert(pos, il.begin(), il.end());
+    }
+
+    iterator erase(const_iterator pos) noexcept {
+        return iterator(links_.erase_and_dispose(pos.it_, [this](node& n) { drop_node(n); }));
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        return iterator(links_.erase_and_dispose(first.it_, last.it_,
+                                                 [this](node& n) { drop_node(n); }));
+    }
+
+    void clear() noexcept {
+        links_.clear_and_dispose([this](node& n) { drop_node(n); });
+    }
+
+    void resize(size_type n) {
+        if (n <= size()) {
+            erase(std::next(begin(), static_cast<difference_type>(n)), end());
+            return;
+        }
+        size_type k = n - size();
+        pool_->reserve(k);
+        for (; k > 0; k--)
+            emplace(end());
+    }
+
+    void resize(size_type n, const T& value) {
+        if (n <= size())
+            erase(std::next(begin(), static_cast<difference_type>(n)), end());
+        else
+            insert(end(), n - size(), value);
+    }
+
+    /* Exchanges elements and pools; a list sharing an external pool keeps sharing it */
+    void swap(nuo_list& o) noexcept {
+        bool a = owns_pool();
+        bool b = o.owns_pool();
+        links_.swap(o.links_);
+        std::swap(own_, o.own_);
+        std::swap(pool_, o.pool_);
+        if (b)
+            pool_ = &own_;
+        if (a)
+            o.pool_ = &o.own_;
+    }
+
+    friend void swap(nuo_list& a, nuo_list& b) noexcept {
+        a.swap(b);
+    }
+
+    /* Operations */
+    /* Whether splicing from o relinks nodes instead of moving elements */
+    bool shares_pool(const nuo_list& o) const noexcept {
+        return pool_ == o.pool_;
+    }
+
+    void splice(const_iterator pos, nuo_list& o) {
+        if (shares_pool(o))
+            links_.splice(pos.it_, o.links_);
+        else
+            move_elements(pos.it_, o, o.links_.cbegin(), o.links_.cend());
+    }
+
+    void splice(const_iterator pos, nuo_list&& o) {
+        splice(pos, o);
+    }
+
+    void splice(const_iterator pos, nuo_list& o, const_iterator it) {
+        if (shares_pool(o))
+            links_.splice(pos.it_, o.links_, it.it_);
+        else
+            move_elements(pos.it_, o, it.it_, std::next(it.it_));
+    }
+
+    void splice(const_iterator pos, nuo_list&& o, const_iterator it) {
+        splice(pos, o, it);
+    }
+
+    /* O(1) with n = distance(first, last) given, counts the range otherwise */
+    void splice(const_iterator pos, nuo_list& o, const_iterator first,
+                const_iterator last, size_type n) {
+        if (shares_pool(o))
+            links_.splice(pos.it_, o.links_, first.it_, last.it_, n);
+        else
+            move_elements(pos.it_, o, first.it_, last.it_);
+    }
+
+    void splice(const_iterator pos, nuo_list& o, const_iterator first, const_iterator last) {
+        if (shares_pool(o))
+            links_.splice(pos.it_, o.links_, first.it_, last.it_);
+        else
+            move_elements(pos.it_, o, first.it_, last.it_);
+    }
+
+    template<typename Pred>
+    size_type remove_if(Pred pred) {
+        size_type n = 0;
+        for (iterator it = begin(); it != end();) {
+            if (pred(*it)) {
+                it = erase(it);
+                n++;
+            } else {
+                ++it;
+            }
+        }
+        return n;
+    }
+
+    size_type remove(const T& value) {
+        return remove_if([&value](const T& x) { return x == value; });
+    }
+
+    void reverse() noexcept {
+        links_.reverse();
+    }
+
+    template<typename Less = std::less<>>
+    void merge(nuo_list& o, Less less = Less()) {
+        if (&o == this)
+            return;
+        if (!shares_pool(o)) {
+            nuo_list t(*pool_);
+            t.splice(t.end(), o);
+            merge(t, less);
+            return;
+        }
+        iterator a = begin();
+        while (!o.empty()) {
+            iterator b = o.begin();
+            while (a != end() && !less(*b, *a))
+                ++a;
+            if (a == end()) {
+                links_.splice(a.it_, o.links_);
+                return;
+            }
+            /* the run of o smaller than *a goes in one splice */
+            iterator e = std::next(b);
+            size_type n = 1;
+            while (e != o.end() && less(*e, *a)) {
+                ++e;
+                n++;
+            }
+            links_.splice(a.it_, o.links_, b.it_, e.it_, n);
+        }
+    }
+
+    /* Stable merge sort by relinking, no element is moved or copied */
+    template<typename Less = std::less<>>
+    void sort(Less less = Less()) {
+        if (size() < 2)
+            return;
+        /* bins[i] holds a sorted run of 2^i elements, as in libstdc++ */
+        nuo_list carry(*pool_);
+        nuo_list bins[64];
+        for (nuo_list& b : bins)
+            b.pool_ = pool_;
+        size_t fill = 0;
+        try {
+            while (!empty()) {
+                carry.links_.splice(carry.links_.begin(), links_, links_.begin());
+                size_t i = 0;
+                for (; i < fill && !bins[i].empty(); i++) {
+                    bins[i].merge(carry, less);
+                    carry.links_.swap(bins[i].links_);
+                }
+                carry.links_.swap(bins[i].links_);
+                if (i == fill)
+                    fill++;
+            }
+            for (size_t i = 1; i < fill; i++)
+                bins[i].merge(bins[i - 1], less);
+        } catch (...) {
+            /* a throwing less loses no element, their order is unspecified */
+            links_.splice(links_.end(), carry.links_);
+            for (nuo_list& b : bins)
+                links_.splice(links_.end(), b.links_);
+            throw;
+        }
+        links_.swap(bins[fill - 1].links_);
+    }
+
+private:
+    iterator splice_chain(const_iterator pos, links& chain) noexcept {
+        typename links::iterator first = chain.empty() ? pos.it_.unconst() : chain.begin();
+        links_.splice(pos.it_, chain);
+        return iterator(first);
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
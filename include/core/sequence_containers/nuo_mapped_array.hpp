@@ -0,0 +1,257 @@
+#ifndef NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_MAPPED_ARRAY_HPP_
+#define NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_MAPPED_ARRAY_HPP_
+
+#include <stddef.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace nuostl {
+
+/* madvise() hints for a mapping, combine with | */
+enum class nuo_map_advice : unsigned {
+    none       = 0,
+    sequential = 1u << 0,   /* MADV_SEQUENTIAL: aggressive readahead */
+    random     = 1u << 1,   /* MADV_RANDOM: no readahead */
+    willneed   = 1u << 2,   /* MADV_WILLNEED: start reading the whole file */
+    hugepage   = 1u << 3,   /* MADV_HUGEPAGE: THP, where the fs supports it */
+};
+
+constexpr nuo_map_advice operator|(nuo_map_advice a,
+                                   nuo_map_advice b) noexcept {
+    return static_cast<nuo_map_advice>(static_cast<unsigned>(a) |
+                                       static_cast<unsigned>(b));
+}
+
+constexpr bool nuo_map_has(nuo_map_advice set, nuo_map_advice a) noexcept {
+    return (static_cast<unsigned>(set) & static_cast<unsigned>(a)) != 0;
+}
+
+struct nuo_map_options {
+    nuo_map_advice advice = nuo_map_advice::sequential |
+                            nuo_map_advice::hugepage;
+    /* MAP_POPULATE: fault the whole file in before the constructor returns */
+    bool populate = false;
+    /*
+     * Background thread walking the mapping front to back, one
+     * prefetch_window at a time: MADV_WILLNEED, then one read per page so
+     * the consumer neither waits for I/O nor takes the page faults.
+     */
+    bool prefetch_thread = false;
+    size_t prefetch_window = size_t(16) << 20;
+};
+
+/*
+ * Read-only array of trivially copyable T backed by a memory mapped file,
+ * e.g. a binary column file. The file is size() * sizeof(T) bytes (a
+ * trailing partial element is ignored). Iterators are plain const T*, so
+ * it is a contiguous range and the contiguous iterator overloads (nuo_min,
+ * nuo_max, ...) run their vectorized paths directly on the mapping.
+ *
+ * Errors opening or mapping the file throw std::system_error. madvise
+ * hints are best effort and never fail the construction. As with any
+ * mapping, truncating the file while it is mapped raises SIGBUS on access.
+ */
+template<typename T>
+class nuo_mapped_array {
+    static_assert(std::is_trivially_copyable_v<T>,
+        "nuo_mapped_array: T must be trivially copyable");
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = const T&;
+    using const_reference = const T&;
+    using pointer = const T*;
+    using const_pointer = const T*;
+    using iterator = const T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<const T*>;
+    using const_reverse_iterator = std::reverse_iterator<const T*>;
+
+private:
+    void* map_ = nullptr;
+    size_type bytes_ = 0;       /* length of the mapping */
+    size_type size_ = 0;        /* elements */
+    std::thread prefetcher_;
+    std::atomic<bool> stop_{false};
+
+    [[noreturn]] static void fail(const char* what) {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    void start_prefetch(size_type window) {
+        const long page = sysconf(_SC_PAGESIZE);
+        const size_type step = page > 0 ? static_cast<size_type>(page) : 4096;
+        if (window < step)
+            window = step;
+        prefetcher_ = std::thread([this, window, step] {
+            char* base = static_cast<char*>(map_);
+            for (size_type off = 0; off < bytes_; off += window) {
+                if (stop_.load(std::memory_order_relaxed))
+                    return;
+                size_type len = bytes_ - off < window ? bytes_ - off : window;
+                madvise(base + off, len, MADV_WILLNEED);
+                for (size_type p = off; p < off + len; p += step)
+                    (void)*static_cast<const volatile char*>(base + p);
+            }
+        });
+    }
+
+    void stop_prefetch() noexcept {
+        if (prefetcher_.joinable()) {
+            stop_.store(true, std::memory_order_relaxed);
+            prefetcher_.join();
+        }
+        stop_.store(false, std::memory_order_relaxed);
+    }
+
+    void release() noexcept {
+        stop_prefetch();
+        if (map_ != nullptr)
+            munmap(map_, bytes_);
+        map_ = nullptr;
+        bytes_ = 0;
+        size_ = 0;
+    }
+
+public:
+    /* Constructor */
+    nuo_mapped_array() noexcept = default;
+
+    explicit nuo_mapped_array(const char* path,
+                              const nuo_map_options& opt = {}) {
+        int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            fail("nuo_mapped_array: open");
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            int e = errno;
+            ::close(fd);
+            errno = e;
+            fail("nuo_mapped_array: fstat");
+        }
+        size_type bytes = static_cast<size_type>(st.st_size);
+        size_type n = bytes / sizeof(T);
+        if (n == 0) {
+            /* nothing to map, mmap rejects zero lengths */
+            ::close(fd);
+            return;
+        }
+        int flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+        if (opt.populate)
+            flags |= MAP_POPULATE;
+#endif
+        void* p = mmap(nullptr, bytes, PROT_READ, flags, fd, 0);
+        int e = errno;
+        ::close(fd);    /* the mapping keeps the file referenced */
+        if (p == MAP_FAILED) {
+            errno = e;
+            fail("nuo_mapped_array: mmap");
+        }
+        map_ = p;
+        bytes_ = bytes;
+        size_ = n;
+        advise(opt.advice);
+        if (opt.prefetch_thread)
+            start_prefetch(opt.prefetch_window);
+    }
+
+    nuo_mapped_array(const nuo_mapped_array&) = delete;
+    nuo_mapped_array& operator=(const nuo_mapped_array&) = delete;
+
+    /* the prefetch thread refers to this object, so it is not moved along */
+    nuo_mapped_array(nuo_mapped_array&& other) noexcept {
+        other.stop_prefetch();
+        map_ = std::exchange(other.map_, nullptr);
+        bytes_ = std::exchange(other.bytes_, 0);
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    nuo_mapped_array& operator=(nuo_mapped_array&& other) noexcept {
+        if (this != &other) {
+            release();
+            other.stop_prefetch();
+            map_ = std::exchange(other.map_, nullptr);
+            bytes_ = std::exchange(other.bytes_, 0);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    ~nuo_mapped_array() { release(); }
+
+    /* Apply hints to the whole mapping, failures are ignored */
+    void advise(nuo_map_advice a) const noexcept {
+        if (map_ == nullptr)
+            return;
+        if (nuo_map_has(a, nuo_map_advice::sequential))
+            madvise(map_, bytes_, MADV_SEQUENTIAL);
+        if (nuo_map_has(a, nuo_map_advice::random))
+            madvise(map_, bytes_, MADV_RANDOM);
+        if (nuo_map_has(a, nuo_map_advice::willneed))
+            madvise(map_, bytes_, MADV_WILLNEED);
+#if defined(MADV_HUGEPAGE)
+        if (nuo_map_has(a, nuo_map_advice::hugepage))
+            madvise(map_, bytes_, MADV_HUGEPAGE);
+#endif
+    }
+
+    /* Wait for the prefetch thread, if any, to finish its walk */
+    void wait_prefetch() noexcept {
+        if (prefetcher_.joinable())
+            prefetcher_.join();
+    }
+
+    /* Iterators */
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator end() const noexcept { return data() + size_; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    /* Capacity */
+    size_type size() const noexcept { return size_; }
+    size_type size_bytes() const noexcept { return size_ * sizeof(T); }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /* Element access */
+    const_reference operator[](size_type i) const noexcept {
+        return data()[i];
+    }
+    const_reference at(size_type i) const {
+        if (i >= size_)
+            throw std::out_of_range("nuo_mapped_array: index out of range");
+        return data()[i];
+    }
+    const_reference front() const noexcept { return data()[0]; }
+    const_reference back() const noexcept { return data()[size_ - 1]; }
+    const_pointer data() const noexcept {
+        return static_cast<const T*>(map_);
+    }
+
+    std::span<const T> span() const noexcept {
+        return std::span<const T>(data(), size_);
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,248 @@
+#ifndef NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_PRIORITY_QUEUE_HPP_
+#define NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_PRIORITY_QUEUE_HPP_
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "./nuo_heap.hpp"
+
+namespace nuostl {
+
+/*
+ * Priority queue on a D-ary heap (nuo_heap.hpp), similar to
+ * std::priority_queue: top() is the element no other is less than.
+ *
+ * The buffer is cache-line aligned and the heap starts D - 1 slots in, so
+ * every group of siblings D*i + 1 .. D*i + D begins at a multiple of D
+ * slots from the buffer start; when D * sizeof(T) is 64 (4 children of 16
+ * bytes, e.g. nuo_pair<uint64_t, uint64_t>) each sift step reads exactly
+ * one cache line.
+ *
+ * Constructing from a range or push_range() of many elements builds the
+ * heap with Floyd's O(n) method instead of n pushes.
+ */
+template<typename T, typename Less = std::less<T>, size_t D = 4>
+class nuo_priority_queue {
+private:
+    static_assert(D >= 2, "nuo_priority_queue: arity must be at least 2");
+
+    static constexpr size_t pad = D - 1;
+    static constexpr size_t align = alignof(T) > 64 ? alignof(T) : 64;
+
+    /* Start of the heap, pad slots into the allocation */
+    T* data_ = nullptr;
+    size_t size_ = 0;
+    size_t cap_ = 0;
+    [[no_unique_address]] Less less_;
+
+    void grow(size_t need) {
+        size_t cap = cap_ < 16 ? 16 : cap_ * 2;
+        if (cap < need)
+            cap = need;
+        size_t bytes = (cap + pad) * sizeof(T);
+        bytes = (bytes + align - 1) & ~(align - 1);
+        T* p = static_cast<T*>(aligned_alloc(align, bytes));
+        if (p == nullptr)
+            throw std::bad_alloc();
+        T* dst = p + pad;
+        size_t i = 0;
+        try {
+            for (; i < size_; i++)
+                ::new (static_cast<void*>(dst + i)) T(std::move_if_noexcept(data_[i]));
+        } catch (...) {
+            std::destroy_n(dst, i);
+            free(p);
+            throw;
+        }
+        size_t n = size_;
+        release();
+        data_ = dst;
+        size_ = n;
+        cap_ = cap;
+    }
+
+    void release() noexcept {
+        if (data_ != nullptr) {
+            std::destroy_n(data_, size_);
+            free(data_ - pad);
+        }
+        data_ = nullptr;
+        size_ = cap_ = 0;
+    }
+
+    /* Appends without restoring the heap property */
+    template<typename It>
+    void append(It first, It last) {
+        if constexpr (std::forward_iterator<It>) {
+            size_t n = static_cast<size_t>(std::distance(first, last));
+            if (size_ + n > cap_)
+                grow(size_ + n);
+        }
+        for (; first != last; ++first) {
+            if (size_ == cap_)
+                grow(size_ + 1);
+            ::new (static_cast<void*>(data_ + size_)) T(*first);
+            size_++;
+        }
+    }
+public:
+    using value_type = T;
+    using value_compare = Less;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    static constexpr size_t arity = D;
+
+    /* Constructor */
+    nuo_priority_queue() noexcept(std::is_nothrow_default_constructible_v<Less>) = default;
+
+    explicit nuo_priority_queue(const Less& less) : less_(less) {}
+
+    template<std::input_iterator It>
+    nuo_priority_queue(It first, It last, const Less& less = Less()) : less_(less) {
+        push_range(first, last);
+    }
+
+    nuo_priority_queue(std::initializer_list<T> il, const Less& less = Less()) : less_(less) {
+        push_range(il.begin(), il.end());
+    }
+
+    /* Destructor */
+    ~nuo_priority_queue() {
+        release();
+    }
+
+    /* Copy Constructor */
+    nuo_priority_queue(const nuo_priority_queue& o) : less_(o.less_) {
+        append(o.data_, o.data_ + o.size_);
+    }
+
+    nuo_priority_queue(nuo_priority_queue&& o) noexcept :
+        data_(std::exchange(o.data_, nullptr)), size_(std::exchange(o.size_, 0)),
+        cap_(std::exchange(o.cap_, 0)), less_(std::move(o.less_)) {}
+
+    /* Operator */
+    /* Group 0 */
+    nuo_priority_queue& operator=(const nuo_priority_queue& o) {
+        if (this != &o) {
+            nuo_priority_queue t(o);
+            swap(t);
+        }
+        return *this;
+    }
+
+    nuo_priority_queue& operator=(nuo_priority_queue&& o) noexcept {
+        if (this != &o) {
+            release();
+            data_ = std::exchange(o.data_, nullptr);
+            size_ = std::exchange(o.size_, 0);
+            cap_ = std::exchange(o.cap_, 0);
+            less_ = std::move(o.less_);
+        }
+        return *this;
+    }
+
+    /* Element access */
+    const T& top() const noexcept {
+        return data_[0];
+    }
+
+    /* Capacity */
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return cap_; }
+
+    void reserve(size_type n) {
+        if (n > cap_)
+            grow(n);
+    }
+
+    /* Modifiers */
+    void push(const T& value) {
+        emplace(value);
+    }
+
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        if (size_ == cap_)
+            grow(size_ + 1);
+        ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+        size_++;
+        nuo_push_heap<D>(data_, data_ + size_, less_);
+    }
+
+    /*
+     * Adds [first, last): rebuilds in O(size + n) when that at least
+     * doubles the heap, pushes one by one otherwise (a push of random
+     * data costs O(1) on average, so rebuilding a large heap for a small
+     * range would lose).
+     */
+    template<std::input_iterator It>
+    void push_range(It first, It last) {
+        size_t old = size_;
+        append(first, last);
+        size_t added = size_ - old;
+        if (added >= old) {
+            nuo_make_heap<D>(data_, data_ + size_, less_);
+        } else {
+            for (size_t i = old + 1; i <= size_; i++)
+                nuo_push_heap<D>(data_, data_ + i, less_);
+        }
+    }
+
+    void pop() {
+        size_--;
+        if (size_ > 0) {
+            T v = std::move(data_[size_]);
+            std::destroy_at(data_ + size_);
+            detail::nuo_heap_replace_front<D>(data_, static_cast<ptrdiff_t>(size_),
+                                              std::move(v), less_);
+        } else {
+            std::destroy_at(data_);
+        }
+    }
+
+    /* pop() then push(value) with one sift */
+    void replace_top(T value) {
+        detail::nuo_heap_replace_front<D>(data_, static_cast<ptrdiff_t>(size_),
+                                          std::move(value), less_);
+    }
+
+    void clear() noexcept {
+        std::destroy_n(data_, size_);
+        size_ = 0;
+    }
+
+    void swap(nuo_priority_queue& o) noexcept {
+        using std::swap;
+        swap(data_, o.data_);
+        swap(size_, o.size_);
+        swap(cap_, o.cap_);
+        swap(less_, o.less_);
+    }
+
+    friend void swap(nuo_priority_queue& a, nuo_priority_queue& b) noexcept {
+        a.swap(b);
+    }
+
+    /* The heap array in heap order, for inspection */
+    const T* begin() const noexcept { return data_; }
+    const T* end() const noexcept { return data_ + size_; }
+};
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_RADIX_HEAP_HPP_
+#define NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_RADIX_HEAP_HPP_
+
+#include <stddef.h>
+
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../data_types/nuo_pair.hpp"
+
+namespace nuostl {
+
+/*
+ * Monotone min-priority queue for unsigned integer keys: every key pushed
+ * must be at least the key last popped (event simulation, Dijkstra with
+ * non-negative weights, deadline queues). Elements are kept in one bucket
+ * per bit width of key ^ last, where last is the key last popped; when
+ * bucket 0 runs out, pop() redistributes the lowest non-empty bucket
+ * around its minimum, and since an element only ever moves to a lower
+ * bucket each one is moved at most bits(Key) times. Push is an append,
+ * with no comparisons at all. top() finds that minimum without moving
+ * anything, so peeking never raises the bound on the next push.
+ *
+ * With T = void the elements are the keys themselves, otherwise they are
+ * nuo_pair<Key, T>. top() is one of the elements with the smallest key;
+ * among equal keys the order is unspecified.
+ */
+template<std::unsigned_integral Key, typename T = void>
+class nuo_radix_heap {
+public:
+    using key_type = Key;
+    using value_type = std::conditional_t<std::is_void_v<T>, Key, nuo_pair<Key, T>>;
+    using size_type = size_t;
+private:
+    static constexpr int bits = std::numeric_limits<Key>::digits;
+
+    /*
+     * Bucket 0 holds the elements with key last_, the key last popped;
+     * the refill is deferred to the next pop() so that keys between the
+     * one popped and the next minimum can still be pushed.
+     */
+    std::vector<value_type> buckets_[bits + 1];
+    Key last_ = 0;
+    size_t size_ = 0;
+    /* Where top() found the minimum while bucket 0 is empty, -1 if unknown */
+    mutable int top_bucket_ = -1;
+    mutable size_t top_index_ = 0;
+
+    static Key key_of(const value_type& v) noexcept {
+        if constexpr (std::is_void_v<T>)
+            return v;
+        else
+            return v.first;
+    }
+
+    int bucket(Key k) const noexcept {
+        return std::bit_width(static_cast<Key>(k ^ last_));
+    }
+
+    /* The lowest non-empty bucket and its minimum, bucket 0 being empty */
+    void find_min() const {
+        if (top_bucket_ >= 0)
+            return;
+        int i = 1;
+        while (buckets_[i].empty())
+            i++;
+        const std::vector<value_type>& b = buckets_[i];
+        size_t m = 0;
+        for (size_t j = 1; j < b.size(); j++) {
+            if (key_of(b[j]) < key_of(b[m]))
+                m = j;
+        }
+        top_bucket_ = i;
+        top_index_ = m;
+    }
+
+    /* Refills an empty bucket 0 from the lowest non-empty bucket */
+    void pull() {
+        if (!buckets_[0].empty())
+            return;
+        find_min();
+        std::vector<value_type>& b = buckets_[top_bucket_];
+        last_ = key_of(b[top_index_]);
+        top_bucket_ = -1;
+        for (value_type& v : b)
+            buckets_[bucket(key_of(v))].push_back(std::move(v));
+        b.clear();
+    }
+
+    template<typename... Args>
+    void insert(Key k, Args&&... args) {
+        if (k < last_)
+            throw std::invalid_argument("nuo_radix_heap: key below the last one popped");
+        if constexpr (std::is_void_v<T>)
+            buckets_[bucket(k)].push_back(k);
+        else
+            buckets_[bucket(k)].emplace_back(k, T(std::forward<Args>(args)...));
+        size_++;
+        top_bucket_ = -1;
+    }
+public:
+    /* Constructor */
+    nuo_radix_heap() = default;
+
+    /* Element access */
+    const value_type& top() const {
+        if (!buckets_[0].empty())
+            return buckets_[0].back();
+        find_min();
+        return buckets_[top_bucket_][top_index_];
+    }
+
+    key_type top_key() const {
+        return key_of(top());
+    }
+
+    /* Capacity */
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+
+    /* Modifiers */
+    void push(Key k) requires std::is_void_v<T> {
+        insert(k);
+    }
+
+    template<typename... Args>
+    void push(Key k, Args&&... args) requires (!std::is_void_v<T>) {
+        insert(k, std::forward<Args>(args)...);
+    }
+
+    void push(const value_type& v) requires (!std::is_void_v<T>) {
+        insert(v.first, v.second);
+    }
+
+    void pop() {
+        pull();
+        buckets_[0].pop_back();
+        size_--;
+    }
+
+    void clear() noexcept {
+        for (std::vector<value_type>& b : buckets_)
+            b.clear();
+        last_ = 0;
+        size_ = 0;
+        top_bucket_ = -1;
+    }
+
+    void swap(nuo_radix_heap& o) noexcept {
+        using std::swap;
+        for (int i = 0; i <= bits; i++)
+            buckets_[i].swap(o.buckets_[i]);
+        swap(last_, o.last_);
+        swap(size_, o.size_);
+        swap(top_bucket_, o.top_bucket_);
+        swap(top_index_, o.top_index_);
+    }
+
+    friend void swap(nuo_radix_heap& a, nuo_radix_heap& b) noexcept {
+        a.swap(b);
+    }
+};
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,481 @@
+#ifndef NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_SLIST_HPP_
+#define NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_SLIST_HPP_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <compare>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../allocators/nuo_malloc_allocator.hpp"
+#include "../allocators/nuo_node_pool.hpp"
+#include "./nuo_intrusive_slist.hpp"
+
+namespace nuostl {
+
+/*
+ * Singly linked list with the interface of std::forward_list plus size(),
+ * back(), push_back() and append(): it keeps a tail pointer, so it also
+ * serves as a FIFO queue and whole lists concatenate in O(1). Nodes come
+ * from a nuo_node_pool with the same ownership and splice rules as
+ * nuo_list.
+ */
+template<typename T, typename Alloc = nuo_malloc_allocator<T>>
+class nuo_slist {
+private:
+    struct node : nuo_slist_hook<> {
+        T value;
+
+        template<typename... Args>
+        explicit node(Args&&... args) : value(std::forward<Args>(args)...) {}
+    };
+
+    using links = nuo_intrusive_slist<node>;
+    using node_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<node>;
+public:
+    using pool_type = nuo_node_pool<node, node_alloc>;
+
+private:
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class nuo_slist;
+        friend class basic_iterator<!Const>;
+
+        using base = std::conditional_t<Const, typename links::const_iterator,
+                                        typename links::iterator>;
+
+        base it_;
+
+        explicit basic_iterator(base it) noexcept : it_(it) {}
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() noexcept = default;
+
+        template<bool C = Const>
+            requires C
+        basic_iterator(const basic_iterator<false>& o) noexcept : it_(o.it_) {}
+
+        reference operator*() const noexcept { return it_->value; }
+        pointer operator->() const noexcept { return &it_->value; }
+
+        basic_iterator& operator++() noexcept {
+            ++it_;
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator t = *this;
+            ++it_;
+            return t;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept {
+            return a.it_ == b.it_;
+        }
+    };
+
+    links links_;
+    pool_type own_;
+    pool_type* pool_;
+
+    bool owns_pool() const noexcept {
+        return pool_ == &own_;
+    }
+
+    template<typename... Args>
+    node* make_node(Args&&... args) {
+        void* p = pool_->allocate();
+        try {
+            return ::new (p) node(std::forward<Args>(args)...);
+        } catch (...) {
+            pool_->deallocate(p);
+            throw;
+        }
+    }
+
+    void drop_node(node& n) noexcept {
+        n.~node();
+        pool_->deallocate(&n);
+    }
+
+    /* Nodes for [first, last) in a detached chain, reserved in one go */
+    template<typename It>
+    links make_chain(It first, It last) {
+        links chain;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                          typename std::iterator_traits<It>::iterator_category>)
+            pool_->reserve(static_cast<size_t>(std::distance(first, last)));
+        try {
+            for (; first != last; ++first)
+                chain.push_back(*make_node(*first));
+        } catch (...) {
+            chain.clear_and_dispose([this](node& n) { drop_node(n); });
+            throw;
+        }
+        return chain;
+    }
+
+    links make_chain(size_t n, const T& value) {
+        links chain;
+        pool_->reserve(n);
+        try {
+            for (; n > 0; n--)
+                chain.push_back(*make_node(value));
+        } catch (...) {
+            chain.clear_and_dispose([this](node& x) { drop_node(x); });
+            throw;
+        }
+        return chain;
+    }
+
+    /* Moves the elements after before_first up to last of o into new nodes after pos */
+    void move_elements(typename links::const_iterator pos, nuo_slist& o,
+                       typename links::const_iterator before_first,
+                       typename links::const_iterator last) {
+        links chain;
+        try {
+            for (auto it = std::next(before_first); it != last; ++it)
+                chain.push_back(*make_node(std::move(const_cast<node&>(*it).value)));
+        } catch (...) {
+            chain.clear_and_dispose([this](node& n) { drop_node(n); });
+            throw;
+        }
+        o.links_.erase_after_and_dispose(before_first, last,
+                                         [&o](node& n) { o.drop_node(n); });
+        links_.splice_after(pos, chain);
+    }
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /* Constructor */
+    nuo_slist() noexcept : pool_(&own_) {}
+
+    /* Takes its nodes from pool, which must outlive the list */
+    explicit nuo_slist(pool_type& pool) noexcept : pool_(&pool) {}
+
+    explicit nuo_slist(size_type n) : pool_(&own_) {
+        resize(n);
+    }
+
+    nuo_slist(size_type n, const T& value) : pool_(&own_) {
+        insert_after(before_begin(), n, value);
+    }
+
+    template<std::input_iterator It>
+    nuo_slist(It first, It last) : pool_(&own_) {
+        insert_after(before_begin(), first, last);
+    }
+
+    nuo_slist(std::initializer_list<T> il) : pool_(&own_) {
+        insert_after(before_begin(), il.begin(), il.end());
+    }
+
+    /* Destructor */
+    ~nuo_slist() {
+        clear();
+    }
+
+    /* Copy Constructor: the copy owns its pool */
+    nuo_slist(const nuo_slist& o) : pool_(&own_) {
+        insert_after(before_begin(), o.begin(), o.end());
+    }
+
+    /* Keeps sharing o's pool if it had an external one */
+    nuo_slist(nuo_slist&& o) noexcept : pool_(&own_) {
+        swap(o);
+    }
+
+    /* Operator */
+    /* Group 0 */
+    /* Overwrites existing elements first, the pool stays the same */
+    nuo_slist& operator=(const nuo_slist& o) {
+        if (this != &o)
+            assign(o.begin(), o.end());
+        return *this;
+    }
+
+    nuo_slist& operator=(nuo_slist&& o) noexcept {
+        if (this != &o) {
+            nuo_slist t(std::move(o));
+            swap(t);
+        }
+        return *this;
+    }
+
+    nuo_slist& operator=(std::initializer_list<T> il) {
+        assign(il.begin(), il.end());
+        return *this;
+    }
+
+    /* Group 1 */
+    friend bool operator==(const nuo_slist& a, const nuo_slist& b)
+        requires std::equality_comparable<T> {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+    }
+
+    friend auto operator<=>(const nuo_slist& a, const nuo_slist& b)
+        requires std::three_way_comparable<T> {
+        return std::lexicographical_compare_three_way(a.begin(), a.end(),
+                                                      b.begin(), b.end());
+    }
+
+    template<std::input_iterator It>
+    void assign(It first, It last) {
+        iterator prev = before_begin();
+        iterator it = begin();
+        for (; it != end() && first != last; ++prev, ++it, ++first)
+            *it = *first;
+        if (first == last)
+            erase_after(prev, end());
+        else
+            insert_after(prev, first, last);
+    }
+
+    void assign(size_type n, const T& value) {
+        iterator prev = before_begin();
+        iterator it = begin();
+        for (; it != end() && n > 0; ++prev, ++it, --n)
+            *it = value;
+        if (n == 0)
+            erase_after(prev, end());
+        else
+            insert_after(prev, n, value);
+    }
+
+    /* Iterators */
+    iterator before_begin() noexcept { return iterator(links_.before_begin()); }
+    const_iterator before_begin() const noexcept { return const_iterator(links_.before_begin()); }
+    const_iterator cbefore_begin() const noexcept { return before_begin(); }
+    iterator begin() noexcept { return iterator(links_.begin()); }
+    const_iterator begin() const noexcept { return const_iterator(links_.begin()); }
+    iterator end() noexcept { return iterator(links_.end()); }
+    const_iterator end() const noexcept { return const_iterator(links_.end()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /* Iterator to the last element, before_begin() when empty */
+    iterator before_end() noexcept { return iterator(links_.before_end()); }
+    const_iterator before_end() const noexcept { return const_iterator(links_.before_end()); }
+
+    /* Capacity */
+    bool empty() const noexcept { return links_.empty(); }
+    size_type size() const noexcept { return links_.size(); }
+
+    /* Makes the next n insertions allocation-free */
+    void reserve(size_type n) {
+        pool_->reserve(n);
+    }
+
+    pool_type& pool() noexcept { return *pool_; }
+
+    /* Element access */
+    T& front() noexcept { return links_.front().value; }
+    const T& front() const noexcept { return links_.front().value; }
+    T& back() noexcept { return links_.back().value; }
+    const T& back() const noexcept { return links_.back().value; }
+
+    /* Modifiers */
+    template<typename... Args>
+    iterator emplace_after(const_iterator pos, Args&&... args) {
+        return iterator(links_.insert_after(pos.it_, *make_node(std::forward<Args>(args)...)));
+    }
+
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        return *emplace_after(before_begin(), std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        return *emplace_after(before_end(), std::forward<Args>(args)...);
+    }
+
+    void push_front(const T& value) { emplace_after(before_begin(), value); }
+    void push_front(T&& value) { emplace_after(before_begin(), std::move(value)); }
+    void push_back(const T& value) { emplace_after(before_end(), value); }
+    void push_back(T&& value) { emplace_after(before_end(), std::move(value)); }
+
+    void pop_front() noexcept {
+        erase_after(before_begin());
+    }
+
+    iterator insert_after(const_iterator pos, const T& value) {
+        return emplace_after(pos, value);
+    }
+
+    iterator insert_after(const_iterator pos, T&& value) {
+        return emplace_after(pos, std::move(value));
+    }
+
+    /* Returns the last inserted element, pos if none */
+    iterator insert_after(const_iterator pos, size_type n, const T& value) {
+        links chain = make_chain(n, value);
+        return splice_chain(pos, chain);
+    }
+
+    template<std::input_iterator It>
+    iterator insert_after(const_iterator pos, It first, It last) {
+        links chain = make_chain(first, last);
+        return splice_chain(pos, chain);
+    }
+
+    iterator insert_after(const_iterator pos, std::initializer_list<T> il) {
+        return insert_after(pos, il.begin(), il.end());
+    }
+
+    iterator erase_after(const_iterator pos) noexcept {
+        return iterator(links_.erase_after_and_dispose(pos.it_,
+                                                       [this](node& n) { drop_node(n); }));
+    }
+
+    /* Erases (first, last) */
+    iterator erase_after(const_iterator first, const_iterator last) noexcept {
+        return iterator(links_.erase_after_and_dispose(first.it_, last.it_,
+                                                       [this](node& n) { drop_node(n); }));
+    }
+
+    void clear() noexcept {
+        links_.clear_and_dispose([this](node& n) { drop_node(n); });
+    }
+
+    void resize(size_type n) {
+        if (n <= size()) {
+            erase_after(std::next(before_begin(), static_cast<difference_type>(n)), end());
+            return;
+        }
+        size_type k = n - size();
+        pool_->reserve(k);
+        for (; k > 0; k--)
+            emplace_back();
+    }
+
+    void resize(size_type n, const T& value) {
+        if (n <= size())
+            erase_after(std::next(before_begin(), static_cast<difference_type>(n)), end());
+        else
+            insert_after(before_end(), n - size(), value);
+    }
+
+    /* Exchanges elements and pools; a list sharing an external pool keeps sharing it */
+    void swap(nuo_slist& o) noexcept {
+        bool a = owns_pool();
+        bool b = o.owns_pool();
+        links_.swap(o.links_);
+        std::swap(own_, o.own_);
+        std::swap(pool_, o.pool_);
+        if (b)
+            pool_ = &own_;
+        if (a)
+            o.pool_ = &o.own_;
+    }
+
+    friend void swap(nuo_slist& a, nuo_slist& b) noexcept {
+        a.swap(b);
+    }
+
+    /* Operations */
+    /* Whether splicing from o relinks nodes instead of moving elements */
+    bool shares_pool(const nuo_slist& o) const noexcept {
+        return pool_ == o.pool_;
+    }
+
+    void splice_after(const_iterator pos, nuo_slist& o) {
+        if (shares_pool(o))
+            links_.splice_after(pos.it_, o.links_);
+        else
+            move_elements(pos.it_, o, o.links_.cbefore_begin(), o.links_.cend());
+    }
+
+    void splice_after(const_iterator pos, nuo_slist&& o) {
+        splice_after(pos, o);
+    }
+
+    /* The element after it */
+    void splice_after(const_iterator pos, nuo_slist& o, const_iterator it) {
+        if (shares_pool(o))
+            links_.splice_after(pos.it_, o.links_, it.it_);
+        else
+            move_elements(pos.it_, o, it.it_, std::next(it.it_, 2));
+    }
+
+    /* The elements in (first, last), as std::forward_list */
+    void splice_after(const_iterator pos, nuo_slist& o, const_iterator first,
+                      const_iterator last) {
+        if (first == last || std::next(first) == last)
+            return;
+        if (!shares_pool(o)) {
+            move_elements(pos.it_, o, first.it_, last.it_);
+            return;
+        }
+        typename links::const_iterator tail = first.it_;
+        size_type n = 0;
+        for (auto it = std::next(first.it_); it != last.it_; ++it, ++n)
+            tail = it;
+        links_.splice_after(pos.it_, o.links_, first.it_, tail, n);
+    }
+
+    /* Moves all of o to the end */
+    void append(nuo_slist& o) {
+        splice_after(before_end(), o);
+    }
+
+    void append(nuo_slist&& o) {
+        append(o);
+    }
+
+    template<typename Pred>
+    size_type remove_if(Pred pred) {
+        size_type n = 0;
+        for (iterator prev = before_begin(); std::next(prev) != end();) {
+            if (pred(*std::next(prev))) {
+                erase_after(prev);
+                n++;
+            } else {
+                ++prev;
+            }
+        }
+        return n;
+    }
+
+    size_type remove(const T& value) {
+        return remove_if([&value](const T& x) { return x == value; });
+    }
+
+    void reverse() noexcept {
+        links_.reverse();
+    }
+
+private:
+    iterator splice_chain(const_iterator pos, links& chain) noexcept {
+        typename links::iterator last = chain.empty() ? pos.it_.unconst() : chain.before_end();
+        links_.splice_after(pos.it_, chain);
+        return iterator(last);
+    }
+};
+
+/* std::forward_list interface, with the extras of nuo_slist */
+template<typename T, typename Alloc = nuo_malloc_allocator<T>>
+using nuo_forward_list = nuo_slist<T, Alloc>;
+
+}   /* namespace nuostl */
+
+#endif
@@ -0,0 +1,566 @@
+#ifndef NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_STRING_VIEW_HPP_
+#define NUOSTL_CORE_SEQUENCE_CONTAINERS_NUO_STRING_VIEW_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <compare>
+#include <concepts>
+#include <iterator>
+#include <ostream>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "../data_types/detail/nuo_char_simd.hpp"
+
+namespace nuostl {
+
+namespace detail {
+
+/* Anything exposing a contiguous char buffer: std::string, nuo_string, ... */
+template<typename S>
+concept nuo_char_buffer = requires(const S& s) {
+    { s.data() } -> std::convertible_to<const char*>;
+    { s.size() } -> std::convertible_to<size_t>;
+};
+
+}   /* namespace detail */
+
+/*
+ * Non-owning view of a byte string, similar to std::string_view.
+ *
+ * find, find_first_of and find_first_not_of run on the SIMD kernels of
+ * nuo_char_simd.hpp (selected at runtime by nuo_cpu_dispatch). Substring
+ * search is linear in the worst case. The member functions also work in
+ * constant expressions, where they fall back to plain loops.
+ *
+ * Implicitly converts from and to std::string_view, and from any type
+ * with data() and size() such as nuo_string.
+ */
+class nuo_string_view {
+public:
+    using value_type = char;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = const char&;
+    using const_reference = const char&;
+    using pointer = const char*;
+    using const_pointer = const char*;
+    using iterator = const char*;
+    using const_iterator = const char*;
+    using reverse_iterator = std::reverse_iterator<const char*>;
+    using const_reverse_iterator = std::reverse_iterator<const char*>;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+private:
+    const char* data_ = nullptr;
+    size_type size_ = 0;
+
+    static constexpr size_type ce_find(const char* h, size_type n,
+                                       const char* s, size_type m) noexcept {
+        for (size_type i = 0; i + m <= n; i++) {
+            size_type k = 0;
+            while (k < m && h[i + k] == s[k])
+                k++;
+            if (k == m)
+                return i;
+        }
+        return npos;
+    }
+
+    static constexpr int ce_compare(const char* a, size_type n,
+                                    const char* b, size_type m) noexcept {
+        size_type len = n < m ? n : m;
+        for (size_type i = 0; i < len; i++) {
+            if (a[i] != b[i]) {
+                return static_cast<unsigned char>(a[i]) <
+                       static_cast<unsigned char>(b[i]) ? -1 : 1;
+            }
+        }
+        return n < m ? -1 : (n > m ? 1 : 0);
+    }
+
+    static constexpr bool ce_equal(const char* a, const char* b,
+                                   size_type n) noexcept {
+        if (std::is_constant_evaluated())
+            return ce_compare(a, n, b, n) == 0;
+        return detail::nuo_char_equal(a, b, n);
+    }
+
+    template<bool Member>
+    size_type find_set(nuo_string_view set, size_type pos) const noexcept {
+        if (pos >= size_)
+            return npos;
+        size_type k = detail::nuo_char_find_set<Member>(
+            data_ + pos, size_ - pos,
+            detail::nuo_char_set(set.data(), set.size()));
+        return k == detail::nuo_char_npos ? npos : pos + k;
+    }
+
+    template<bool Member>
+    size_type rfind_set(nuo_string_view set, size_type pos) const noexcept {
+        if (size_ == 0)
+            return npos;
+        size_type len = pos < size_ ? pos + 1 : size_;
+        size_type k = detail::nuo_char_rfind_set<Member>(
+            data_, len, detail::nuo_char_set(set.data(), set.size()));
+        return k == detail::nuo_char_npos ? npos : k;
+    }
+
+public:
+    /* Constructor */
+    constexpr nuo_string_view() noexcept = default;
+    constexpr nuo_string_view(const char* s, size_type n) noexcept :
+        data_(s), size_(n) {}
+    constexpr nuo_string_view(const char* s) noexcept :
+        data_(s), size_(std::char_traits<char>::length(s)) {}
+    nuo_string_view(std::nullptr_t) = delete;
+    constexpr nuo_string_view(const char* first, const char* last) noexcept :
+        data_(first), size_(static_cast<size_type>(last - first)) {}
+
+    template<detail::nuo_char_buffer S>
+        requires (!std::is_same_v<std::remove_cvref_t<S>, nuo_string_view>)
+    constexpr nuo_string_view(const S& s) noexcept :
+        data_(s.data()), size_(static_cast<size_type>(s.size())) {}
+
+    constexpr nuo_string_view(const nuo_string_view&) noexcept = default;
+    constexpr nuo_string_view& operator=(const nuo_string_view&) noexcept =
+        default;
+
+    constexpr operator std::string_view() const noexcept {
+        return std::string_view(data_, size_);
+    }
+
+    /* Iterators */
+    constexpr const_iterator begin() const noexcept { return data_; }
+    constexpr const_iterator end() const noexcept { return data_ + size_; }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
+    constexpr const_iterator cend() const noexcept { return end(); }
+    constexpr const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    constexpr const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    /* Capacity */
+    constexpr size_type size() const noexcept { return size_; }
+    constexpr size_type length() const noexcept { return size_; }
+    constexpr size_type max_size() const noexcept {
+        return static_cast<size_type>(PTRDIFF_MAX);
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+    /* Element access */
+    constexpr const_reference operator[](size_type i) const noexcept {
+        return data_[i];
+    }
+    constexpr const_reference at(size_type i) const {
+        if (i >= size_)
+            throw std::out_of_range("nuo_string_view: index out of range");
+        return data_[i];
+    }
+    constexpr const_reference front() const noexcept { return data_[0]; }
+    constexpr const_reference back() const noexcept {
+        return data_[size_ - 1];
+    }
+    constexpr const_pointer data() const noexcept { return data_; }
+
+    /* Modifiers */
+    constexpr void remove_prefix(size_type n) noexcept {
+        data_ += n;
+        size_ -= n;
+    }
+    constexpr void remove_suffix(size_type n) noexcept { size_ -= n; }
+    constexpr void swap(nuo_string_view& other) noexcept {
+        nuo_string_view t = *this;
+        *this = other;
+        other = t;
+    }
+
+    /* Operations */
+    size_type copy(char* dest, size_type n, size_type pos = 0) const {
+        if (pos > size_)
+            throw std::out_of_range("nuo_string_view: position out of range");
+        if (n > size_ - pos)
+            n = size_ - pos;
+        if (n != 0)
+            memcpy(dest, data_ + pos, n);
+        return n;
+    }
+
+    constexpr nuo_string_view substr(size_type pos = 0,
+                                     size_type n = npos) const {
+        if (pos > size_)
+            throw std::out_of_range("nuo_string_view: position out of range");
+        if (n > size_ - pos)
+            n = size_ - pos;
+        return nuo_string_view(data_ + pos, n);
+    }
+
+    constexpr int compare(nuo_string_view sv) const noexcept {
+        if (std::is_constant_evaluated())
+            return ce_compare(data_, size_, sv.data_, sv.size_);
+        return detail::nuo_char_compare(data_, size_, sv.data_, sv.size_);
+    }
+    constexpr int compare(size_type pos, size_type n,
+                          nuo_string_view sv) const {
+        return substr(pos, n).compare(sv);
+    }
+
+    constexpr bool starts_with(nuo_string_view sv) const noexcept {
+        return size_ >= sv.size_ && ce_equal(data_, sv.data_, sv.size_);
+    }
+    constexpr bool starts_with(char c) const noexcept {
+        return size_ != 0 && data_[0] == c;
+    }
+    constexpr bool ends_with(nuo_string_view sv) const noexcept {
+        return size_ >= sv.size_ &&
+            ce_equal(data_ + size_ - sv.size_, sv.data_, sv.size_);
+    }
+    constexpr bool ends_with(char c) const noexcept {
+        return size_ != 0 && data_[size_ - 1] == c;
+    }
+
+    /* Search */
+    constexpr size_type find(char c, size_type pos = 0) const noexcept {
+        if (pos >= size_)
+            return npos;
+        if (std::is_constant_evaluated()) {
+            size_type k = ce_find(data_ + pos, size_ - pos, &c, 1);
+            return k == npos ? npos : pos + k;
+        }
+        size_type k = detail::nuo_char_find(data_ + pos, size_ - pos, c);
+        return k == detail::nuo_char_npos ? npos : pos + k;
+    }
+    constexpr size_type find(nuo_string_view sv,
+                             size_type pos = 0) const noexcept {
+        if (pos > size_)
+            return npos;
+        size_type k;
+        if (std::is_constant_evaluated()) {
+            k = ce_find(data_ + pos, size_ - pos, sv.data_, sv.size_);
+        } else {
+            k = detail::nuo_char_search(data_ + pos, size_ - pos, sv.data_,
+                                        sv.size_);
+        }
+        return k == detail::nuo_char_npos ? npos : pos + k;
+    }
+    constexpr size_type find(const char* s, size_type pos,
+                             size_type n) const noexcept {
+        return find(nuo_string_view(s, n), pos);
+    }
+
+    constexpr size_type rfind(char c, size_type pos = npos) const noexcept {
+        if (size_ == 0)
+            return npos;
+        if (pos >= size_)
+            pos = size_ - 1;
+        for (size_type i = pos + 1; i-- > 0; ) {
+            if (data_[i] == c)
+                return i;
+        }
+        return npos;
+    }
+    constexpr size_type rfind(nuo_string_view sv,
+                              size_type pos = npos) const noexcept {
+        if (sv.size_ > size_)
+            return npos;
+        size_type i = size_ - sv.size_;
+        if (pos < i)
+            i = pos;
+        for (i++; i-- > 0; ) {
+            if (ce_equal(data_ + i, sv.data_, sv.size_))
+                return i;
+        }
+        return npos;
+    }
+
+    constexpr bool contains(nuo_string_view sv) const noexcept {
+        return find(sv) != npos;
+    }
+    constexpr bool contains(char c) const noexcept {
+        return find(c) != npos;
+    }
+
+    size_type find_first_of(nuo_string_view set,
+                            size_type pos = 0) const noexcept {
+        if (set.size_ == 1)
+            return find(set.data_[0], pos);
+        return find_set<true>(set, pos);
+    }
+    size_type find_first_of(char c, size_type pos = 0) const noexcept {
+        return find(c, pos);
+    }
+    size_type find_first_not_of(nuo_string_view set,
+                                size_type pos = 0) const noexcept {
+        return find_set<false>(set, pos);
+    }
+    size_type find_first_not_of(char c, size_type pos = 0) const noexcept {
+        return find_set<false>(nuo_string_view(&c, 1), pos);
+    }
+    size_type find_last_of(nuo_string_view set,
+                           size_type pos = npos) const noexcept {
+        return rfind_set<true>(set, pos);
+    }
+    size_type find_last_of(char c, size_type pos = npos) const noexcept {
+        return rfind(c, pos);
+    }
+    size_type find_last_not_of(nuo_string_view set,
+                               size_type pos = npos) const noexcept {
+        return rfind_set<false>(set, pos);
+    }
+    size_type find_last_not_of(char c, size_type pos = npos) const noexcept {
+        return rfind_set<false>(nuo_string_view(&c, 1), pos);
+    }
+
+    /* Comparison */
+    friend constexpr bool operator==(nuo_string_view a,
+                                     nuo_string_view b) noexcept {
+        return a.size_ == b.size_ && ce_equal(a.data_, b.data_, a.size_);
+    }
+    friend constexpr std::strong_ordering operator<=>(
+            nuo_string_view a, nuo_string_view b) noexcept {
+        return a.compare(b) <=> 0;
+    }
+
+    /*
+     * Exact matches for string types, otherwise comparing with a type that
+     * converts both ways (nuo_string, std::string_view) is ambiguous.
+     */
+    template<detail::nuo_char_buffer S>
+        requires (!std::is_same_v<S, nuo_string_view>)
+    friend constexpr bool operator==(nuo_string_view a, const S& b) noexcept {
+        return a == nuo_string_view(b);
+    }
+    template<detail::nuo_char_buffer S>
+        requires (!std::is_same_v<S, nuo_string_view>)
+    friend constexpr std::strong_ordering operator<=>(
+            nuo_string_view a, const S& b) noexcept {
+        return a.compare(nuo_string_view(b)) <=> 0;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, nuo_string_view sv) {
+        return os << std::string_view(sv);
+    }
+};
+
+/*
+ * Lazy split of a view on a byte or a substring delimiter. Tokens are views
+ * into the source, n delimiters give n + 1 (possibly empty) tokens and an
+ * empty source gives none. An empty delimiter never matches.
+ */
+template<typename Delim>
+class nuo_split_view :
+    public std::ranges::view_interface<nuo_split_view<Delim>> {
+    static_assert(std::is_same_v<Delim, char> ||
+                  std::is_same_v<Delim, nuo_string_view>,
+        "nuo_split_view: the delimiter is a char or a nuo_string_view");
+
+    nuo_string_view src_;
+    Delim delim_;
+
+    static size_t delim_size(char) noexcept { return 1; }
+    static size_t delim_size(nuo_string_view d) noexcept { return d.size(); }
+
+    /* first delimiter in p[0, n), n when there is none */
+    static size_t next(const char* p, size_t n, char d) noexcept {
+        size_t k = detail::nuo_char_find(p, n, d);
+        return k == detail::nuo_char_npos ? n : k;
+    }
+    static size_t next(const char* p, size_t n, nuo_string_view d) noexcept {
+        if (d.empty())
+            return n;
+        size_t k = detail::nuo_char_search(p, n, d.data(), d.size());
+        return k == detail::nuo_char_npos ? n : k;
+    }
+
+public:
+    class iterator {
+        const nuo_split_view* parent_ = nullptr;
+        size_t pos_ = 0;    /* token begin */
+        size_t end_ = 0;    /* token end */
+        bool done_ = true;
+
+        void locate() noexcept {
+            const nuo_string_view& s = parent_->src_;
+            end_ = pos_ + next(s.data() + pos_, s.size() - pos_,
+                               parent_->delim_);
+        }
+
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = nuo_string_view;
+        using difference_type = ptrdiff_t;
+
+        iterator() noexcept = default;
+        explicit iterator(const nuo_split_view* parent) noexcept :
+            parent_(parent), done_(parent->src_.empty()) {
+            if (!done_)
+                locate();
+        }
+
+        nuo_string_view operator*() const noexcept {
+            return nuo_string_view(parent_->src_.data() + pos_, end_ - pos_);
+        }
+
+        iterator& operator++() noexcept {
+            if (end_ == parent_->src_.size()) {
+                done_ = true;
+                pos_ = end_;
+            } else {
+                pos_ = end_ + delim_size(parent_->delim_);
+                locate();
+            }
+            return *this;
+        }
+        iterator operator++(int) noexcept {
+            iterator t = *this;
+            ++*this;
+            return t;
+        }
+
+        friend bool operator==(const iterator& a, const iterator& b) noexcept {
+            return a.done_ == b.done_ && a.pos_ == b.pos_;
+        }
+        friend bool operator==(const iterator& a,
+                               std::default_sentinel_t) noexcept {
+            return a.done_;
+        }
+    };
+
+    nuo_split_view() noexcept = default;
+    nuo_split_view(nuo_string_view src, Delim delim) noexcept :
+        src_(src), delim_(delim) {}
+
+    iterator begin() const noexcept { return iterator(this); }
+    std::default_sentinel_t end() const noexcept {
+        return std::default_sentinel;
+    }
+};
+
+/*
+ * Lazy strtok-like tokenizer: tokens are the maximal runs of bytes not in
+ * the delimiter set, empty tokens are skipped. The iterator classifies the
+ * source 64 bytes at a time into a delimiter bitmask (SIMD byte set
+ * kernel) and finds token boundaries with bit scans, so short tokens cost
+ * a few instructions instead of two search calls each.
+ */
+class nuo_token_view : public std::ranges::view_interface<nuo_token_view> {
+    nuo_string_view src_;
+    detail::nuo_char_set set_;
+
+public:
+    class iterator {
+        const nuo_token_view* parent_ = nullptr;
+        size_t pos_ = 0;
+        size_t end_ = 0;
+        size_t base_ = 0;       /* first byte of the classified block */
+        uint64_t delim_ = 0;    /* delimiter bits of [base_, base_ + 64) */
+
+        /* first index >= from whose membership is Member, size() if none */
+        template<bool Member>
+        size_t scan(size_t from) noexcept {
+            const char* p = parent_->src_.data();
+            const size_t n = parent_->src_.size();
+            while (from < n) {
+                if (from - base_ >= 64) {
+                    base_ = from;
+                    delim_ = detail::nuo_char_set_block(p + from, n - from,
+                                                        parent_->set_);
+                }
+                uint64_t bits = (Member ? delim_ : ~delim_) >> (from - base_);
+                if (bits != 0) {
+                    size_t k = from + static_cast<size_t>(
+                        __builtin_ctzll(bits));
+                    return k < n ? k : n;
+                }
+                from = base_ + 64;
+            }
+            return n;
+        }
+
+        void locate(size_t from) noexcept {
+            pos_ = scan<false>(from);
+            end_ = pos_ == parent_->src_.size() ? pos_ : scan<true>(pos_);
+        }
+
+        bool at_end() const noexcept {
+            return pos_ == parent_->src_.size();
+        }
+
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = nuo_string_view;
+        using difference_type = ptrdiff_t;
+
+        iterator() noexcept = default;
+        explicit iterator(const nuo_token_view* parent) noexcept :
+            parent_(parent),
+            delim_(detail::nuo_char_set_block(parent->src_.data(),
+                                              parent->src_.size(),
+                                              parent->set_)) {
+            locate(0);
+        }
+
+        nuo_string_view operator*() const noexcept {
+            return nuo_string_view(parent_->src_.data() + pos_, end_ - pos_);
+        }
+
+        iterator& operator++() noexcept {
+            locate(end_);
+            return *this;
+        }
+        iterator operator++(int) noexcept {
+            iterator t = *this;
+            ++*this;
+            return t;
+        }
+
+        friend bool operator==(const iterator& a, const iterator& b) noexcept {
+            return a.pos_ == b.pos_;
+        }
+        friend bool operator==(const iterator& a,
+                               std::default_sentinel_t) noexcept {
+            return a.at_end();
+        }
+    };
+
+    nuo_token_view() noexcept = default;
+    nuo_token_view(nuo_string_view src, nuo_string_view delims) noexcept :
+        src_(src), set_(delims.data(), delims.size()) {}
+
+    iterator begin() const noexcept { return iterator(this); }
+    std::default_sentinel_t end() const noexcept {
+        return std::default_sentinel;
+    }
+};
+
+inline nuo_split_view<char> nuo_split(nuo_string_view s, char delim) noexcept {
+    return nuo_split_view<char>(s, delim);
+}
+
+inline nuo_split_view<nuo_string_view> nuo_split(
+        nuo_string_view s, nuo_string_view delim) noexcept {
+    return nuo_split_view<nuo_string_view>(s, delim);
+}
+
+inline nuo_token_view nuo_tokenize(nuo_string_view s,
+                                   nuo_string_view delims) noexcept {
+    return nuo_token_view(s, delims);
+}
+
+inline void swap(nuo_string_view& a, nuo_string_view& b) noexcept {
+    a.swap(b);
+}
+
+}   /* namespace nuostl */
+
+#endif
@@ -1,12 +1,70 @@
 #ifndef NUOSTL_NUO_TYPEDEFS_HPP_
 #define NUOSTL_NUO_TYPEDEFS_HPP_
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <concepts>
+#include <limits>
+#include <stdexcept>
+
+/*
+ * idx_t is the index type of the index-based containers (handles, slot
+ * tables, links stored as positions). It is 64 bits wide by default;
+ * configuring with -DNUOSTL_IDX_BITS=32 makes it uint32_t, which halves
+ * that metadata and lets twice as much of it share a cache line, for
+ * programs whose containers stay below 2^32 - 1 elements. Containers also
+ * take the index type as a template parameter, so a single container can
+ * be made compact without changing the default.
+ *
+ * The all-ones value of an index type is reserved (nuo_idx_npos), valid
+ * indices go up to nuo_idx_max<Index>. nuo_idx_cast narrows a size_t to
+ * an index and, in debug builds (NDEBUG not defined, or NUOSTL_IDX_CHECKS
+ * defined), throws std::length_error when the value does not fit instead
+ * of wrapping.
+ */
+
+#ifndef NUOSTL_IDX_BITS
+#define NUOSTL_IDX_BITS 64
+#endif
+
+#if NUOSTL_IDX_BITS != 32 && NUOSTL_IDX_BITS != 64
+#error "NUOSTL_IDX_BITS must be 32 or 64"
+#endif
+
+#if !defined(NUOSTL_IDX_CHECKS) && !defined(NDEBUG)
+#define NUOSTL_IDX_CHECKS 1
+#endif
+
 namespace nuostl {
 
+#if NUOSTL_IDX_BITS == 32
+typedef uint32_t idx_t;
+#else
 typedef uint64_t idx_t;
+#endif
+
+template<typename I>
+concept nuo_index_type = std::same_as<I, uint32_t> || std::same_as<I, uint64_t>;
+
+/* The reserved "no element" value of I */
+template<nuo_index_type I>
+inline constexpr I nuo_idx_npos = std::numeric_limits<I>::max();
+
+/* The largest valid index of I */
+template<nuo_index_type I>
+inline constexpr size_t nuo_idx_max = static_cast<size_t>(nuo_idx_npos<I>) - 1;
+
+/* n as an I, checked in debug builds */
+template<nuo_index_type I>
+constexpr I nuo_idx_cast(size_t n) {
+#ifdef NUOSTL_IDX_CHECKS
+    if (n > nuo_idx_max<I>)
+        throw std::length_error("nuostl: index does not fit the index type");
+#endif
+    return static_cast<I>(n);
+}
 
 }   /* namespace nuostl */
 
-#endif
\ No newline at end of file
+#endif
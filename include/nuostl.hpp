@@ -3,11 +3,67 @@
 
 /* 1. C++ STL Core Components */
 
+/* Dispatch */
+#include "./core/dispatch/nuo_cpu_dispatch.hpp"
+
+/* Allocators */
+#include "./core/allocators/nuo_malloc_allocator.hpp"
+#include "./core/allocators/nuo_node_pool.hpp"
+
 /* Data Types */
+#include "./core/data_types/nuo_any.hpp"
+#include "./core/data_types/nuo_optional.hpp"
 #include "./core/data_types/nuo_pair.hpp"
+#include "./core/data_types/nuo_string.hpp"
+#include "./core/data_types/nuo_tuple.hpp"
+#include "./core/data_types/nuo_variant.hpp"
+
+/* Sequence Containers */
+#include "./core/sequence_containers/nuo_addressable_heap.hpp"
+#include "./core/sequence_containers/nuo_heap.hpp"
+#include "./core/sequence_containers/nuo_intrusive_list.hpp"
+#include "./core/sequence_containers/nuo_intrusive_slist.hpp"
+#include "./core/sequence_containers/nuo_list.hpp"
+#include "./core/sequence_containers/nuo_mapped_array.hpp"
+#include "./core/sequence_containers/nuo_priority_queue.hpp"
+#include "./core/sequence_containers/nuo_radix_heap.hpp"
+#include "./core/sequence_containers/nuo_slist.hpp"
+#include "./core/sequence_containers/nuo_string_view.hpp"
+
+/* Associative Containers */
+#include "./core/associative_containers/nuo_concurrent_unordered_map.hpp"
+#include "./core/associative_containers/nuo_flat_map.hpp"
+#include "./core/associative_containers/nuo_flat_set.hpp"
+
+/* Iterators */
+#include "./core/iterators/nuo_iterator_traits.hpp"
+
+/* Function Objects */
+#include "./core/function_objects/nuo_functional.hpp"
+#include "./core/function_objects/nuo_hash.hpp"
+
+/* Execution */
+#include "./core/execution/nuo_execution.hpp"
+#include "./core/execution/nuo_scheduler.hpp"
 
 /* Algorithms */
+#include "./core/algorithms/nuo_accumulate.hpp"
+#include "./core/algorithms/nuo_binary_search.hpp"
+#include "./core/algorithms/nuo_copy.hpp"
 #include "./core/algorithms/nuo_max.hpp"
 #include "./core/algorithms/nuo_min.hpp"
+#include "./core/algorithms/nuo_select.hpp"
+#include "./core/algorithms/nuo_sliding_window.hpp"
+#include "./core/algorithms/nuo_stream_accumulator.hpp"
+
+/* 2. Additional Components */
+
+/* Math */
+#include "./additional/math/nuo_biginteger.hpp"
+#include "./additional/math/nuo_complex.hpp"
+#include "./additional/math/nuo_fraction.hpp"
+#include "./additional/math/nuo_matrix.hpp"
+#include "./additional/math/nuo_modint.hpp"
+#include "./additional/math/nuo_polynomial.hpp"
 
 #endif
\ No newline at end of file
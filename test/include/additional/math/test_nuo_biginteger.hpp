@@ -0,0 +1,24 @@
+#ifndef NUOSTL_TEST_ADDITIONAL_MATH_TEST_NUO_BIGINTEGER_HPP_
+#define NUOSTL_TEST_ADDITIONAL_MATH_TEST_NUO_BIGINTEGER_HPP_
+
+namespace test {
+
+class Test_Nuo_BigInteger {
+private:
+    static void test_small();
+    static void test_constructor();
+    static void test_add_sub();
+    static void test_mul();
+    static void test_divmod();
+    static void test_shift();
+    static void test_string();
+    static void test_compare();
+    static void test_gcd();
+
+public:
+    static void test_nuo_biginteger();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef NUOSTL_TEST_ADDITIONAL_MATH_TEST_NUO_COMPLEX_HPP_
+#define NUOSTL_TEST_ADDITIONAL_MATH_TEST_NUO_COMPLEX_HPP_
+
+namespace test {
+
+class Test_Nuo_Complex {
+private:
+    static void test_scalar();
+    static void test_annex_g();
+    static void test_functions();
+    static void test_array();
+    static void test_kernels();
+
+public:
+    static void test_nuo_complex();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef NUOSTL_TEST_ADDITIONAL_MATH_TEST_NUO_FRACTION_HPP_
+#define NUOSTL_TEST_ADDITIONAL_MATH_TEST_NUO_FRACTION_HPP_
+
+namespace test {
+
+class Test_Nuo_Fraction {
+private:
+    static void test_gcd();
+    static void test_basic();
+    static void test_arithmetic();
+    static void test_promotion();
+    static void test_compare();
+    static void test_chains();
+
+public:
+    static void test_nuo_fraction();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef NUOSTL_TEST_ADDITIONAL_MATH_TEST_NUO_MATRIX_HPP_
+#define NUOSTL_TEST_ADDITIONAL_MATH_TEST_NUO_MATRIX_HPP_
+
+namespace test {
+
+class Test_Nuo_Matrix {
+private:
+    static void test_basic();
+    static void test_gemm();
+    static void test_threads();
+    static void test_expressions();
+    static void test_aliasing();
+
+public:
+    static void test_nuo_matrix();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef NUOSTL_TEST_ADDITIONAL_MATH_TEST_NUO_POLYNOMIAL_HPP_
+#define NUOSTL_TEST_ADDITIONAL_MATH_TEST_NUO_POLYNOMIAL_HPP_
+
+namespace test {
+
+class Test_Nuo_Polynomial {
+private:
+    static void test_modint();
+    static void test_basic();
+    static void test_mul();
+    static void test_divmod();
+    static void test_inverse();
+    static void test_evaluate();
+    static void test_interpolate();
+
+public:
+    static void test_nuo_polynomial();
+};
+
+}   /* namespace test */
+
+#endif
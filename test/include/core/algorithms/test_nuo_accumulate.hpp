@@ -0,0 +1,18 @@
+#ifndef NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_ACCUMULATE_HPP_
+#define NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_ACCUMULATE_HPP_
+
+namespace test {
+
+class Test_Nuo_Accumulate {
+private:
+    static void test_serial();
+    static void test_lanes();
+    static void test_parallel();
+
+public:
+    static void test_nuo_accumulate();
+};
+
+}   /* namespace test */
+
+#endif
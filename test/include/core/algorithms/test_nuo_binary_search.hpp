@@ -0,0 +1,19 @@
+#ifndef NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_BINARY_SEARCH_HPP_
+#define NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_BINARY_SEARCH_HPP_
+
+namespace test {
+
+class Test_Nuo_Binary_Search {
+private:
+    static void test_bounds();
+    static void test_comparator();
+    static void test_forward();
+    static void test_batch();
+
+public:
+    static void test_nuo_binary_search();
+};
+
+}   /* namespace test */
+
+#endif
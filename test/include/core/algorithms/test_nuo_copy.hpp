@@ -0,0 +1,21 @@
+#ifndef NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_COPY_HPP_
+#define NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_COPY_HPP_
+
+namespace test {
+
+class Test_Nuo_Copy {
+private:
+    static void test_iterator_traits();
+    static void test_copy();
+    static void test_move();
+    static void test_fill();
+    static void test_relocate();
+    static void test_stream();
+
+public:
+    static void test_nuo_copy();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_SELECT_HPP_
+#define NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_SELECT_HPP_
+
+namespace test {
+
+class Test_Nuo_Select {
+private:
+    static void test_nth_element();
+    static void test_partial_sort();
+    static void test_top_k();
+    static void test_kernels();
+
+public:
+    static void test_nuo_select();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_SLIDING_WINDOW_HPP_
+#define NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_SLIDING_WINDOW_HPP_
+
+namespace test {
+
+class Test_Nuo_Sliding_Window {
+private:
+    static void test_monotonic_queue();
+    static void test_sliding_min_max();
+    static void test_window_aggregator();
+
+public:
+    static void test_nuo_sliding_window();
+};
+
+}   /* namespace test */
+
+#endif
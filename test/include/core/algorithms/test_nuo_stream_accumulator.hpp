@@ -0,0 +1,18 @@
+#ifndef NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_STREAM_ACCUMULATOR_HPP_
+#define NUOSTL_TEST_CORE_ALGORITHMS_TEST_NUO_STREAM_ACCUMULATOR_HPP_
+
+namespace test {
+
+class Test_Nuo_Stream_Accumulator {
+private:
+    static void test_minmax();
+    static void test_reducer();
+    static void test_merge_parallel();
+
+public:
+    static void test_nuo_stream_accumulator();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef NUOSTL_TEST_CORE_ASSOCIATIVE_CONTAINERS_TEST_NUO_CONCURRENT_UNORDERED_MAP_HPP_
+#define NUOSTL_TEST_CORE_ASSOCIATIVE_CONTAINERS_TEST_NUO_CONCURRENT_UNORDERED_MAP_HPP_
+
+namespace test {
+
+class Test_Nuo_Concurrent_Unordered_Map {
+private:
+    static void test_basic();
+    static void test_update();
+    static void test_growth();
+    static void test_reclamation();
+    static void test_stress();
+
+public:
+    static void test_nuo_concurrent_unordered_map();
+};
+
+}   /* namespace test */
+
+#endif
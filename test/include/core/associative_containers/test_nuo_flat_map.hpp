@@ -0,0 +1,22 @@
+#ifndef NUOSTL_TEST_CORE_ASSOCIATIVE_CONTAINERS_TEST_NUO_FLAT_MAP_HPP_
+#define NUOSTL_TEST_CORE_ASSOCIATIVE_CONTAINERS_TEST_NUO_FLAT_MAP_HPP_
+
+namespace test {
+
+class Test_Nuo_Flat_Map {
+private:
+    static void test_construct();
+    static void test_access();
+    static void test_iterators();
+    static void test_insert_erase();
+    static void test_batch_insert();
+    static void test_move_only();
+    static void test_batch();
+
+public:
+    static void test_nuo_flat_map();
+};
+
+}   /* namespace test */
+
+#endif
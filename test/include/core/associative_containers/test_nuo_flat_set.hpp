@@ -0,0 +1,20 @@
+#ifndef NUOSTL_TEST_CORE_ASSOCIATIVE_CONTAINERS_TEST_NUO_FLAT_SET_HPP_
+#define NUOSTL_TEST_CORE_ASSOCIATIVE_CONTAINERS_TEST_NUO_FLAT_SET_HPP_
+
+namespace test {
+
+class Test_Nuo_Flat_Set {
+private:
+    static void test_construct();
+    static void test_insert_erase();
+    static void test_batch_insert();
+    static void test_transparent();
+    static void test_batch();
+
+public:
+    static void test_nuo_flat_set();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef NUOSTL_TEST_CORE_DATA_TYPES_TEST_NUO_ANY_HPP_
+#define NUOSTL_TEST_CORE_DATA_TYPES_TEST_NUO_ANY_HPP_
+
+namespace test {
+
+class Test_Nuo_Any {
+private:
+    static void test_storage();
+    static void test_constructor();
+    static void test_assign();
+    static void test_cast();
+public:
+    static void test_nuo_any();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef NUOSTL_TEST_CORE_DATA_TYPES_TEST_NUO_OPTIONAL_HPP_
+#define NUOSTL_TEST_CORE_DATA_TYPES_TEST_NUO_OPTIONAL_HPP_
+
+namespace test {
+
+class Test_Nuo_Optional {
+private:
+    static void test_layout();
+    static void test_constructor();
+    static void test_access();
+    static void test_assign();
+    static void test_compare();
+public:
+    static void test_nuo_optional();
+};
+
+}   /* namespace test */
+
+#endif
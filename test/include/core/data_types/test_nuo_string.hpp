@@ -0,0 +1,25 @@
+#ifndef NUOSTL_TEST_CORE_DATA_TYPES_TEST_NUO_STRING_HPP_
+#define NUOSTL_TEST_CORE_DATA_TYPES_TEST_NUO_STRING_HPP_
+
+namespace test {
+
+class Test_Nuo_String {
+private:
+    static void test_compile_time();
+
+    static void test_constructor();
+    static void test_copy_constructor();
+    static void test_sso();
+    static void test_modifiers();
+    static void test_find();
+    static void test_compare();
+    static void test_allocator();
+    static void test_simd_paths();
+
+public:
+    static void test_nuo_string();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef NUOSTL_TEST_CORE_DATA_TYPES_TEST_NUO_TUPLE_HPP_
+#define NUOSTL_TEST_CORE_DATA_TYPES_TEST_NUO_TUPLE_HPP_
+
+namespace test {
+
+class Test_Nuo_Tuple {
+private:
+    static void test_layout();
+    static void test_constructor();
+    static void test_get();
+    static void test_assign();
+    static void test_compare();
+    static void test_large();
+public:
+    static void test_nuo_tuple();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef NUOSTL_TEST_CORE_DATA_TYPES_TEST_NUO_VARIANT_HPP_
+#define NUOSTL_TEST_CORE_DATA_TYPES_TEST_NUO_VARIANT_HPP_
+
+namespace test {
+
+class Test_Nuo_Variant {
+private:
+    static void test_layout();
+    static void test_constructor();
+    static void test_assign();
+    static void test_get();
+    static void test_visit();
+    static void test_valueless();
+    static void test_compare();
+public:
+    static void test_nuo_variant();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef NUOSTL_TEST_CORE_DISPATCH_TEST_NUO_CPU_DISPATCH_HPP_
+#define NUOSTL_TEST_CORE_DISPATCH_TEST_NUO_CPU_DISPATCH_HPP_
+
+namespace test {
+
+class Test_Nuo_Cpu_Dispatch {
+private:
+    static void test_compile_time();
+    static void test_detect();
+    static void test_force_isa();
+    static void test_dispatcher();
+    static void test_minmax_kernels();
+public:
+    static void test_nuo_cpu_dispatch();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef NUOSTL_TEST_CORE_EXECUTION_TEST_NUO_SCHEDULER_HPP_
+#define NUOSTL_TEST_CORE_EXECUTION_TEST_NUO_SCHEDULER_HPP_
+
+namespace test {
+
+class Test_Nuo_Scheduler {
+private:
+    static void test_ws_deque();
+    static void test_invoke();
+    static void test_for_range();
+    static void test_reduce();
+    static void test_exceptions();
+    static void test_concurrent_callers();
+    static void test_options();
+    static void test_algorithms();
+
+public:
+    static void test_nuo_scheduler();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef NUOSTL_TEST_CORE_FUNCTION_OBJECTS_TEST_NUO_FUNCTIONAL_HPP_
+#define NUOSTL_TEST_CORE_FUNCTION_OBJECTS_TEST_NUO_FUNCTIONAL_HPP_
+
+namespace test {
+
+class Test_Nuo_Functional {
+private:
+    static void test_functors();
+    static void test_transparent();
+    static void test_op_traits();
+
+public:
+    static void test_nuo_functional();
+};
+
+}   /* namespace test */
+
+#endif
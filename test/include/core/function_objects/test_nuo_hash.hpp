@@ -0,0 +1,20 @@
+#ifndef NUOSTL_TEST_CORE_FUNCTION_OBJECTS_TEST_NUO_HASH_HPP_
+#define NUOSTL_TEST_CORE_FUNCTION_OBJECTS_TEST_NUO_HASH_HPP_
+
+namespace test {
+
+class Test_Nuo_Hash {
+private:
+    static void test_hasher();
+    static void test_avalanche();
+    static void test_sparse_keys();
+    static void test_distribution();
+    static void test_kernels();
+
+public:
+    static void test_nuo_hash();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef NUOSTL_TEST_CORE_SEQUENCE_CONTAINERS_TEST_NUO_LIST_HPP_
+#define NUOSTL_TEST_CORE_SEQUENCE_CONTAINERS_TEST_NUO_LIST_HPP_
+
+namespace test {
+
+class Test_Nuo_List {
+private:
+    static void test_intrusive();
+    static void test_constructor();
+    static void test_modifiers();
+    static void test_splice();
+    static void test_operations();
+    static void test_pool();
+
+public:
+    static void test_nuo_list();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef NUOSTL_TEST_CORE_SEQUENCE_CONTAINERS_TEST_NUO_MAPPED_ARRAY_HPP_
+#define NUOSTL_TEST_CORE_SEQUENCE_CONTAINERS_TEST_NUO_MAPPED_ARRAY_HPP_
+
+namespace test {
+
+class Test_Nuo_Mapped_Array {
+private:
+    static void test_compile_time();
+
+    static void test_map();
+    static void test_empty_file();
+    static void test_errors();
+    static void test_move();
+    static void test_algorithms();
+    static void test_prefetch();
+
+public:
+    static void test_nuo_mapped_array();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef NUOSTL_TEST_CORE_SEQUENCE_CONTAINERS_TEST_NUO_PRIORITY_QUEUE_HPP_
+#define NUOSTL_TEST_CORE_SEQUENCE_CONTAINERS_TEST_NUO_PRIORITY_QUEUE_HPP_
+
+namespace test {
+
+class Test_Nuo_Priority_Queue {
+private:
+    static void test_heap_algorithms();
+    static void test_priority_queue();
+    static void test_addressable_heap();
+    static void test_compact_index();
+    static void test_radix_heap();
+
+public:
+    static void test_nuo_priority_queue();
+};
+
+}   /* namespace test */
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef NUOSTL_TEST_CORE_SEQUENCE_CONTAINERS_TEST_NUO_SLIST_HPP_
+#define NUOSTL_TEST_CORE_SEQUENCE_CONTAINERS_TEST_NUO_SLIST_HPP_
+
+namespace test {
+
+class Test_Nuo_Slist {
+private:
+    static void test_intrusive();
+    static void test_constructor();
+    static void test_modifiers();
+    static void test_splice();
+
+public:
+    static void test_nuo_slist();
+};
+
+}   /* namespace test */
+
+#endif
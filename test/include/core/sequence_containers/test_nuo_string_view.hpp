@@ -0,0 +1,26 @@
+#ifndef NUOSTL_TEST_CORE_SEQUENCE_CONTAINERS_TEST_NUO_STRING_VIEW_HPP_
+#define NUOSTL_TEST_CORE_SEQUENCE_CONTAINERS_TEST_NUO_STRING_VIEW_HPP_
+
+namespace test {
+
+class Test_Nuo_String_View {
+private:
+    static void test_compile_time();
+
+    static void test_constructor();
+    static void test_element_access();
+    static void test_compare();
+    static void test_find();
+    static void test_find_first_of();
+    static void test_two_way();
+    static void test_split();
+    static void test_tokenize();
+    static void test_simd_paths();
+
+public:
+    static void test_nuo_string_view();
+};
+
+}   /* namespace test */
+
+#endif
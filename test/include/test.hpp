@@ -1,9 +1,76 @@
 #ifndef NUOSTL_TEST_HPP_
 #define NUOSTL_TEST_HPP_
 
+#include "core/dispatch/nuo_cpu_dispatch.hpp"
+
 /* 1. C++ STL Core Components */
 
 /* Data Types */
+#include "./core/data_types/test_nuo_any.hpp"
+#include "./core/data_types/test_nuo_optional.hpp"
 #include "./core/data_types/test_nuo_pair.hpp"
+#include "./core/data_types/test_nuo_string.hpp"
+#include "./core/data_types/test_nuo_tuple.hpp"
+#include "./core/data_types/test_nuo_variant.hpp"
+
+/* Sequence Containers */
+#include "./core/sequence_containers/test_nuo_list.hpp"
+#include "./core/sequence_containers/test_nuo_mapped_array.hpp"
+#include "./core/sequence_containers/test_nuo_priority_queue.hpp"
+#include "./core/sequence_containers/test_nuo_slist.hpp"
+#include "./core/sequence_containers/test_nuo_string_view.hpp"
+
+/* Associative Containers */
+#include "./core/associative_containers/test_nuo_concurrent_unordered_map.hpp"
+#include "./core/associative_containers/test_nuo_flat_map.hpp"
+#include "./core/associative_containers/test_nuo_flat_set.hpp"
+
+/* Function Objects */
+#include "./core/function_objects/test_nuo_functional.hpp"
+#include "./core/function_objects/test_nuo_hash.hpp"
+
+/* Algorithms */
+#include "./core/algorithms/test_nuo_accumulate.hpp"
+#include "./core/algorithms/test_nuo_binary_search.hpp"
+#include "./core/algorithms/test_nuo_copy.hpp"
+#include "./core/algorithms/test_nuo_max.hpp"
+#include "./core/algorithms/test_nuo_min.hpp"
+#include "./core/algorithms/test_nuo_select.hpp"
+#include "./core/algorithms/test_nuo_sliding_window.hpp"
+#include "./core/algorithms/test_nuo_stream_accumulator.hpp"
+
+/* Execution */
+#include "./core/execution/test_nuo_scheduler.hpp"
+
+/* Dispatch */
+#include "./core/dispatch/test_nuo_cpu_dispatch.hpp"
+
+/* 2. Additional Components */
+
+/* Math */
+#include "./additional/math/test_nuo_biginteger.hpp"
+#include "./additional/math/test_nuo_complex.hpp"
+#include "./additional/math/test_nuo_fraction.hpp"
+#include "./additional/math/test_nuo_matrix.hpp"
+#include "./additional/math/test_nuo_polynomial.hpp"
+
+namespace test {
+
+/*
+ * fn(level) with every ISA level the hardware reaches forced in turn,
+ * scalar (level 0) first; the level in force before is restored after.
+ */
+template<typename F>
+void for_each_isa(F&& fn) {
+    const nuostl::nuo_isa saved = nuostl::nuo_cpu_isa();
+    const unsigned hw = static_cast<unsigned>(nuostl::nuo_cpu_detect().isa);
+    for (unsigned level = 0; level <= hw; level++) {
+        nuostl::nuo_cpu_force_isa(static_cast<nuostl::nuo_isa>(level));
+        fn(level);
+    }
+    nuostl::nuo_cpu_force_isa(saved);
+}
+
+}   /* namespace test */
 
 #endif
\ No newline at end of file
@@ -0,0 +1,416 @@
+#include "./additional/math/test_nuo_biginteger.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_biginteger;
+
+namespace {
+    using limb = nuo_biginteger::limb_type;
+
+    /* random value of n limbs with the top limb non-zero */
+    nuo_biginteger random_big(std::mt19937_64& rng, size_t n, bool neg) {
+        std::string hex = neg ? "-0x" : "0x";
+        static constexpr char digits[] = "0123456789abcdef";
+        for (size_t i = 0; i < 16 * n; i++)
+            hex.push_back(digits[i == 0 ? 1 + rng() % 15 : rng() % 16]);
+        return nuo_biginteger(hex);
+    }
+
+    /* |a| * |b| by the schoolbook kernel alone */
+    std::vector<limb> reference_mul(const nuo_biginteger& a,
+                                    const nuo_biginteger& b) {
+        size_t an = a.size_limbs(), bn = b.size_limbs();
+        std::vector<limb> r(an + bn);
+        if (an >= bn)
+            nuostl::detail::nuo_bigint_mul_basecase(r.data(), a.data(), an,
+                                                    b.data(), bn);
+        else
+            nuostl::detail::nuo_bigint_mul_basecase(r.data(), b.data(), bn,
+                                                    a.data(), an);
+        while (!r.empty() && r.back() == 0)
+            r.pop_back();
+        return r;
+    }
+
+    bool same_limbs(const nuo_biginteger& x, const std::vector<limb>& v) {
+        if (x.size_limbs() != v.size())
+            return false;
+        for (size_t i = 0; i < v.size(); i++) {
+            if (x.data()[i] != v[i])
+                return false;
+        }
+        return true;
+    }
+
+    /* gcd by plain Euclid, one full division per step */
+    nuo_biginteger reference_gcd(nuo_biginteger a, nuo_biginteger b) {
+        a = a.abs();
+        b = b.abs();
+        while (!b.is_zero()) {
+            nuo_biginteger r = a % b;
+            a = std::move(b);
+            b = std::move(r);
+        }
+        return a;
+    }
+
+    nuo_biginteger from_i128(__int128 v) {
+        unsigned __int128 m = v < 0 ? -static_cast<unsigned __int128>(v)
+                                    : static_cast<unsigned __int128>(v);
+        nuo_biginteger r = (nuo_biginteger(static_cast<uint64_t>(m >> 64)) << 64) +
+            nuo_biginteger(static_cast<uint64_t>(m));
+        return v < 0 ? -r : r;
+    }
+}
+
+/* ------------------------------------------------- */
+/* Test nuo biginteger */
+void test::Test_Nuo_BigInteger::test_nuo_biginteger() {
+    test_small();
+    test_constructor();
+    test_add_sub();
+    test_mul();
+    test_divmod();
+    test_shift();
+    test_string();
+    test_compare();
+    test_gcd();
+}
+
+/* ------------------------------------------------- */
+/* Test word sized values, inline storage and __int128 agreement */
+void test::Test_Nuo_BigInteger::test_small() {
+    static_assert(sizeof(nuo_biginteger) == 16);
+
+    nuo_biginteger a(-12345), b(678);
+    assert(a.is_inline() && b.is_inline());
+    assert(static_cast<long>(a + b) == -11667);
+    assert(static_cast<long>(a * b) == -8369910);
+    assert(static_cast<long>(a / b) == -18);
+    assert(static_cast<long>(a % b) == -141);
+    assert((a * b).is_inline());
+
+    /* word arithmetic against __int128 */
+    std::mt19937_64 rng(31);
+    for (int it = 0; it < 2000; it++) {
+        __int128 x = static_cast<int64_t>(rng()) >> (rng() % 64);
+        __int128 y = static_cast<int64_t>(rng()) >> (rng() % 64);
+        nuo_biginteger bx = from_i128(x), by = from_i128(y);
+        assert(bx + by == from_i128(x + y));
+        assert(bx - by == from_i128(x - y));
+        assert(bx * by == from_i128(x * y));
+        if (y != 0) {
+            assert(bx / by == from_i128(x / y));
+            assert(bx % by == from_i128(x % y));
+        }
+    }
+
+    /* carries across the word boundary allocate, results that fit do not */
+    nuo_biginteger m(UINT64_MAX);
+    nuo_biginteger big = m + 1;
+    assert(!big.is_inline() && big.size_limbs() == 2);
+    assert(big.to_string() == "18446744073709551616");
+    big -= 1;
+    assert(big == m && big.size_limbs() == 1);
+    assert(nuo_biginteger(INT64_MIN).fits<int64_t>());
+    assert(!(-nuo_biginteger(INT64_MIN)).fits<int64_t>());
+    assert(static_cast<int64_t>(nuo_biginteger(INT64_MIN)) == INT64_MIN);
+    assert(m.fits<uint64_t>() && !m.fits<int64_t>());
+    assert(big.fits<uint64_t>());
+    assert(!(big + 1).fits<uint64_t>());
+
+    nuo_biginteger i(5);
+    assert(i++ == 5 && i == 6);
+    assert(--i == 5);
+    assert(nuo_biginteger(0).sign() == 0 && nuo_biginteger(-3).sign() == -1);
+}
+
+/* ------------------------------------------------- */
+/* Test constructor, copy and move */
+void test::Test_Nuo_BigInteger::test_constructor() {
+    nuo_biginteger z;
+    assert(z.is_zero() && z.sign() == 0 && z.to_string() == "0");
+    assert(!static_cast<bool>(z));
+
+    nuo_biginteger p = pow(nuo_biginteger(3), 200);
+    nuo_biginteger c(p);
+    assert(c == p && !c.is_inline());
+    nuo_biginteger mv(std::move(c));
+    assert(mv == p && c.is_zero());
+
+    nuo_biginteger small(7);
+    small = p;
+    assert(small == p);
+    small = nuo_biginteger(9);
+    assert(small == 9);
+    /* copies of a heap value that fits a word go inline */
+    nuo_biginteger shrunk = p / p;
+    assert(nuo_biginteger(shrunk).is_inline() && shrunk == 1);
+
+    swap(small, mv);
+    assert(small == p && mv == 9);
+    small = small;
+    assert(small == p);
+
+    bool thrown = false;
+    try {
+        nuo_biginteger bad("12a4");
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        nuo_biginteger bad("-");
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+/* ------------------------------------------------- */
+/* Test addition and subtraction with mixed signs and sizes */
+void test::Test_Nuo_BigInteger::test_add_sub() {
+    std::mt19937_64 rng(7);
+    for (int it = 0; it < 300; it++) {
+        nuo_biginteger a = random_big(rng, 1 + rng() % 20, rng() & 1);
+        nuo_biginteger b = random_big(rng, 1 + rng() % 20, rng() & 1);
+        nuo_biginteger s = a + b;
+        assert(s - b == a && s - a == b);
+        assert(a - b == -(b - a));
+        assert(a + (-a) == 0);
+        nuo_biginteger t = a;
+        t += t;
+        assert(t == a * 2);
+        t -= t;
+        assert(t.is_zero());
+    }
+
+    /* borrow through a run of zero limbs */
+    nuo_biginteger x = nuo_biginteger(1) << 640;
+    nuo_biginteger y = x - 1;
+    assert(y.size_limbs() == 10 && y.bit_length() == 640);
+    assert(y + 1 == x);
+    assert((-x) + y == -1);
+}
+
+/* ------------------------------------------------- */
+/* Test multiplication across the basecase, Karatsuba and Toom-3 ranges */
+void test::Test_Nuo_BigInteger::test_mul() {
+    std::mt19937_64 rng(11);
+    const size_t sizes[] = {1, 2, 17, 23, 24, 25, 63, 64, 65, 100, 399,
+                            400, 401, 620, 1300, 1800, 2600};
+    for (size_t an : sizes) {
+        for (size_t bn : sizes) {
+            if (bn > an)
+                continue;
+            nuo_biginteger a = random_big(rng, an, rng() & 1);
+            nuo_biginteger b = random_big(rng, bn, rng() & 1);
+            nuo_biginteger p = a * b;
+            assert(same_limbs(p, reference_mul(a, b)));
+            assert(p.sign() == a.sign() * b.sign());
+            assert(b * a == p);
+        }
+    }
+
+    /* operands with all bits set hit every carry path */
+    for (size_t n : {40, 200, 900, 2000}) {
+        nuo_biginteger m = (nuo_biginteger(1) << (64 * n)) - 1;
+        nuo_biginteger sq = m * m;
+        assert(sq == (nuo_biginteger(1) << (128 * n)) -
+                     (nuo_biginteger(1) << (64 * n + 1)) + 1);
+        nuo_biginteger t = m;
+        t *= t;
+        assert(t == sq);
+    }
+
+    assert(pow(nuo_biginteger(2), 100) == nuo_biginteger(1) << 100);
+    assert(pow(nuo_biginteger(-3), 3) == -27);
+    assert(pow(nuo_biginteger(12), 0) == 1);
+
+    nuo_biginteger f(1);
+    for (int i = 2; i <= 30; i++)
+        f *= i;
+    assert(f.to_string() == "265252859812191058636308480000000");
+}
+
+/* ------------------------------------------------- */
+/* Test division: 1 limb, Knuth D and Newton sized operands */
+void test::Test_Nuo_BigInteger::test_divmod() {
+    std::mt19937_64 rng(13);
+    const std::pair<size_t, size_t> shapes[] = {
+        {3, 1}, {5, 2}, {2, 2}, {40, 20}, {100, 3}, {64, 63},
+        {450, 220}, {700, 210}, {3100, 1550}, {3600, 1510},
+    };
+    for (auto [an, bn] : shapes) {
+        for (int it = 0; it < 3; it++) {
+            nuo_biginteger a = random_big(rng, an, rng() & 1);
+            nuo_biginteger b = random_big(rng, bn, rng() & 1);
+            nuo_biginteger q, r;
+            divmod(a, b, q, r);
+            assert(q * b + r == a);
+            assert(r.abs() < b.abs());
+            assert(r.is_zero() || r.sign() == a.sign());
+            assert(q == a / b && r == a % b);
+            /* exact quotients */
+            assert((a * b) / b == a);
+            assert(((a * b) % b).is_zero());
+        }
+    }
+
+    /* remainders close to the divisor stress the quotient corrections */
+    nuo_biginteger d = random_big(rng, 1600, false);
+    nuo_biginteger qq = random_big(rng, 1600, false);
+    nuo_biginteger a = qq * d + (d - 1);
+    assert(a / d == qq && a % d == d - 1);
+    assert((a + 1) / d == qq + 1 && ((a + 1) % d).is_zero());
+
+    assert(nuo_biginteger(7) / nuo_biginteger(-2) == -3);
+    assert(nuo_biginteger(-7) % nuo_biginteger(2) == -1);
+    assert(nuo_biginteger(5) / (nuo_biginteger(1) << 100) == 0);
+
+    bool thrown = false;
+    try {
+        (void)(a / nuo_biginteger(0));
+    } catch (const std::domain_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+/* ------------------------------------------------- */
+/* Test shifts, >> rounds toward negative infinity */
+void test::Test_Nuo_BigInteger::test_shift() {
+    nuo_biginteger one(1);
+    for (size_t s : {0, 1, 63, 64, 65, 127, 128, 1000}) {
+        nuo_biginteger p = one << s;
+        assert(p.bit_length() == s + 1);
+        assert(p.bit(s) && !p.bit(s + 1));
+        assert((p >> s) == 1);
+        assert(((p - 1) >> s) == 0);
+    }
+    assert((nuo_biginteger(-7) >> 1) == -4);
+    assert((nuo_biginteger(-8) >> 1) == -4);
+    assert((nuo_biginteger(-1) >> 200) == -1);
+    assert(((-(one << 200)) >> 200) == -1);
+    assert(((-(one << 200) - 1) >> 200) == -2);
+    assert((nuo_biginteger(0) << 100).is_zero());
+
+    std::mt19937_64 rng(17);
+    nuo_biginteger a = random_big(rng, 9, false);
+    assert(((a << 77) >> 77) == a);
+    assert((a >> 70) == a / (one << 70));
+}
+
+/* ------------------------------------------------- */
+/* Test decimal and hexadecimal conversion */
+void test::Test_Nuo_BigInteger::test_string() {
+    assert(nuo_biginteger("340282366920938463463374607431768211456") ==
+           nuo_biginteger(1) << 128);
+    assert(nuo_biginteger("-0x1f") == -31);
+    assert(nuo_biginteger("+000123") == 123);
+    assert(nuo_biginteger("-0") == 0);
+    assert((nuo_biginteger(1) << 128).to_string(16) ==
+           "100000000000000000000000000000000");
+    assert(nuo_biginteger(-255).to_string(16) == "-ff");
+
+    /* powers of ten check the zero padding of the divide and conquer */
+    for (unsigned long e : {18ul, 19ul, 20ul, 760ul, 5000ul, 12345ul}) {
+        nuo_biginteger p = pow(nuo_biginteger(10), e);
+        assert(p.to_string() == "1" + std::string(e, '0'));
+        assert((p - 1).to_string() == std::string(e, '9'));
+        assert(nuo_biginteger("1" + std::string(e, '0')) == p);
+        assert(nuo_biginteger(std::string(e, '9')) == p - 1);
+    }
+
+    std::mt19937_64 rng(19);
+    for (size_t n : {1, 5, 39, 40, 41, 200, 1500}) {
+        nuo_biginteger a = random_big(rng, n, rng() & 1);
+        assert(nuo_biginteger(a.to_string()) == a);
+        std::string hex = a.to_string(16);
+        if (hex[0] == '-')
+            hex.insert(1, "0x");
+        else
+            hex.insert(0, "0x");
+        assert(nuo_biginteger(hex) == a);
+    }
+
+    std::ostringstream os;
+    os << nuo_biginteger(-42) << ' ' << std::hex << nuo_biginteger(255);
+    assert(os.str() == "-42 ff");
+}
+
+/* ------------------------------------------------- */
+/* Test ordering, also through nuo_min / nuo_max */
+void test::Test_Nuo_BigInteger::test_compare() {
+    nuo_biginteger big = nuo_biginteger(1) << 100;
+    nuo_biginteger values[] = {big, -big, 0, 5, -5, big + 1, -big - 1};
+    for (const auto& x : values) {
+        for (const auto& y : values) {
+            bool lt = static_cast<double>(x) < static_cast<double>(y) ||
+                (static_cast<double>(x) == static_cast<double>(y) &&
+                 (x - y).sign() < 0);
+            assert((x < y) == lt);
+            assert((x == y) == (x - y).is_zero());
+        }
+    }
+    assert(big > 5 && -big < -5 && nuo_biginteger(3) == 3);
+
+    assert(nuostl::nuo_min(big, -big) == -big);
+    assert(nuostl::nuo_max(big, -big) == big);
+    assert(nuostl::nuo_max({nuo_biginteger(2), big, -big}) == big);
+    std::vector<nuo_biginteger> v(std::begin(values), std::end(values));
+    assert(nuostl::nuo_min(v.begin(), v.end()) == -big - 1);
+    assert(nuostl::nuo_max(v.begin(), v.end()) == big + 1);
+}
+
+/* ------------------------------------------------- */
+/* Test Lehmer's gcd against plain Euclid */
+void test::Test_Nuo_BigInteger::test_gcd() {
+    std::mt19937_64 rng(34);
+    const size_t sizes[] = {1, 2, 3, 5, 17, 60, 200};
+    for (size_t an : sizes) {
+        for (size_t bn : sizes) {
+            for (size_t gn : {size_t(0), size_t(1), size_t(3)}) {
+                nuo_biginteger a = random_big(rng, an, rng() & 1);
+                nuo_biginteger b = random_big(rng, bn, rng() & 1);
+                if (gn != 0) {
+                    nuo_biginteger g = random_big(rng, gn, false);
+                    a *= g;
+                    b *= g;
+                }
+                nuo_biginteger r = gcd(a, b);
+                assert(r == reference_gcd(a, b) && r.sign() > 0);
+                assert((a % r).is_zero() && (b % r).is_zero());
+                assert(gcd(b, a) == r);
+            }
+        }
+    }
+
+    /* consecutive Fibonacci numbers: every quotient is 1 */
+    nuo_biginteger f0 = 0, f1 = 1;
+    for (int i = 0; i < 5000; i++) {
+        f0 += f1;
+        f0.swap(f1);
+    }
+    assert(gcd(f1, f0) == 1 && gcd(f1 * 12345, f0 * 12345) == 12345);
+
+    nuo_biginteger x = random_big(rng, 40, false);
+    nuo_biginteger y = random_big(rng, 7, false);
+    assert(gcd(x, x) == x && gcd(x * y, y) == y && gcd(-x, 0) == x);
+    assert(gcd(nuo_biginteger(), nuo_biginteger()) == 0);
+    assert(gcd(nuo_biginteger(1) << 700, nuo_biginteger(3) << 300) ==
+           nuo_biginteger(1) << 300);
+    nuo_biginteger big = random_big(rng, 2000, false), small = random_big(rng, 1500, false);
+    assert(gcd(big, small) == reference_gcd(big, small));
+}
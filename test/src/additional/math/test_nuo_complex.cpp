@@ -0,0 +1,309 @@
+#include "./additional/math/test_nuo_complex.hpp"
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+
+#include <complex>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "nuostl.hpp"
+#include "test.hpp"
+
+using nuostl::nuo_complex;
+using nuostl::nuo_complex_array;
+
+namespace {
+    using cd = nuo_complex<double>;
+    using cf = nuo_complex<float>;
+
+    const double inf = std::numeric_limits<double>::infinity();
+
+    /* |x - y| within tol relative to scale, or to |y| by default */
+    template<typename T>
+    bool close(T x, T y, T tol, T scale = T(-1)) {
+        if (isnan(x) || isnan(y))
+            return isnan(x) && isnan(y);
+        if (isinf(x) || isinf(y))
+            return x == y;
+        return fabs(x - y) <= tol * (1 + (scale < 0 ? fabs(y) : scale));
+    }
+
+    template<typename T>
+    bool close(const nuo_complex<T>& a, const std::complex<T>& b, T tol,
+               T scale = T(-1)) {
+        return close(a.real(), b.real(), tol, scale) &&
+               close(a.imag(), b.imag(), tol, scale);
+    }
+
+    template<typename T>
+    bool is_inf(const nuo_complex<T>& z) { return isinf(z.real()) || isinf(z.imag()); }
+
+    template<typename T>
+    nuo_complex_array<T> random_array(std::mt19937_64& rng, size_t n) {
+        std::uniform_real_distribution<double> u(-100, 100);
+        nuo_complex_array<T> a(n);
+        for (size_t i = 0; i < n; i++)
+            a.set(i, nuo_complex<T>(static_cast<T>(u(rng)), static_cast<T>(u(rng))));
+        return a;
+    }
+
+    /* Vector kernels against element-wise nuo_complex, specials mixed in */
+    template<typename T>
+    void check_kernels(std::mt19937_64& rng, size_t n) {
+        const T tol = std::is_same_v<T, float> ? T(1e-5) : T(1e-13);
+        const T big = std::sqrt(std::numeric_limits<T>::max()) * 4;
+        const T tiny = std::sqrt(std::numeric_limits<T>::min()) / 4;
+        const T tinf = std::numeric_limits<T>::infinity();
+        nuo_complex_array<T> a = random_array<T>(rng, n);
+        nuo_complex_array<T> b = random_array<T>(rng, n);
+        for (size_t i = 0; i < n; i++) {
+            switch (rng() % 12) {
+                case 0: a.set(i, nuo_complex<T>(tinf, T(1))); break;
+                case 1: b.set(i, nuo_complex<T>(NAN, tinf)); break;
+                case 2: a.set(i, nuo_complex<T>(big, -big)); break;
+                case 3: a.set(i, nuo_complex<T>(tiny, tiny)); break;
+                case 4: a.set(i, nuo_complex<T>(T(0), T(-0.0))); break;
+                default: break;
+            }
+        }
+
+        nuo_complex_array<T> p = a * b, q = conj_mul(a, b);
+        std::vector<T> m = abs(a), s = norm(a);
+        for (size_t i = 0; i < n; i++) {
+            /* parts of a product can cancel, compare against |a| |b| */
+            nuo_complex<T> x = a[i] * b[i], y = a[i] * conj(b[i]);
+            T scale = abs(a[i]) * abs(b[i]);
+            assert(close(p[i], std::complex<T>(x), tol, scale));
+            assert(close(q[i], std::complex<T>(y), tol, scale));
+            assert(close(m[i], abs(a[i]), tol));
+            assert(close(s[i], norm(a[i]), tol));
+        }
+
+        nuo_complex_array<T> c(a);
+        c *= b;
+        assert(c == p);
+        c = a;
+        c.conj_mul_assign(b);
+        assert(c == q);
+    }
+
+    /* Products and norms on the active ISA level, bit for bit */
+    template<typename T>
+    struct Kernel_Results {
+        nuo_complex_array<T> p, q, sq;
+        std::vector<T> s;
+
+        Kernel_Results(const nuo_complex_array<T>& a, const nuo_complex_array<T>& b)
+            : p(a * b), q(conj_mul(a, b)), sq(conj_mul(a, a)), s(norm(a)) {}
+
+        bool operator==(const Kernel_Results& o) const {
+            return p == o.p && q == o.q && sq == o.sq && s == o.s;
+        }
+    };
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Complex::test_nuo_complex() {
+    test_scalar();
+    test_annex_g();
+    test_functions();
+    test_array();
+    test_kernels();
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Complex::test_scalar() {
+    static_assert(sizeof(cd) == sizeof(std::complex<double>));
+    static_assert(sizeof(cf) == 8);
+    constexpr cd k = cd(1, 2) + cd(3, -1) - 1.0;
+    static_assert(k.real() == 3 && k.imag() == 1);
+
+    cd a(1, 2), b(3, -4);
+    assert(a * b == cd(11, 2) && b * a == cd(11, 2));
+    assert(a / b == cd(-0.2, 0.4));
+    assert(a + 1.0 == cd(2, 2) && 1.0 - a == cd(0, -2));
+    assert(a * 2.0 == cd(2, 4) && 2.0 * a == cd(2, 4) && a / 2.0 == cd(0.5, 1));
+    assert(-a == cd(-1, -2) && conj(a) == cd(1, -2) && norm(b) == 25);
+    assert(cd(3) == 3.0 && cd(3, 1) != 3.0);
+    assert(mul_fast(a, b) == a * b && div_fast(a, b) == cd(-0.2, 0.4));
+
+    std::complex<double> sa = a;
+    assert(sa == std::complex<double>(1, 2) && cd(sa) == a);
+    assert(cf(cd(1.5, 2.5)) == cf(1.5f, 2.5f));
+
+    std::mt19937_64 rng(1);
+    std::uniform_real_distribution<double> u(-1e3, 1e3);
+    for (int i = 0; i < 2000; i++) {
+        cd x(u(rng), u(rng)), y(u(rng), u(rng));
+        std::complex<double> sx = x, sy = y;
+        assert(close(x * y, sx * sy, 1e-13));
+        assert(close(x / y, sx / sy, 1e-13));
+        cd z = x;
+        z *= y;
+        z /= y;
+        assert(close(z, sx, 1e-12));
+    }
+
+    /* Smith's division keeps range where the plain formula overflows */
+    cd h(1e300, 1e300);
+    assert(close(h / h, std::complex<double>(1, 0), 1e-15));
+    assert(!is_inf(h / cd(1e300, 0)));
+
+    std::ostringstream os;
+    os << cd(1.5, -2);
+    assert(os.str() == "(1.5,-2)");
+}
+
+/* ------------------------------------------------- */
+/* C11 Annex G: an infinite operand gives an infinite result */
+void test::Test_Nuo_Complex::test_annex_g() {
+    using nuostl::detail::nuo_fp_isinf;
+    using nuostl::detail::nuo_fp_isnan;
+    assert(nuo_fp_isnan(NAN) && nuo_fp_isnan(-NAN) && !nuo_fp_isnan(inf));
+    assert(nuo_fp_isinf(-inf) && !nuo_fp_isinf(1e308) && nuo_fp_isinf(-HUGE_VALF));
+    assert(nuostl::detail::nuo_fp_isfinite(0.0) &&
+           !nuostl::detail::nuo_fp_isfinite(NAN));
+
+    /* (inf + i) (1 + i): the plain formula gives NaN + NaN i */
+    cd x = cd(inf, 1) * cd(1, 1);
+    assert(is_inf(x));
+    assert(is_inf(cd(1, 1) * cd(NAN, inf)));
+    assert(is_inf(cd(1e300, 1e300) * cd(1e300, -1e300)));
+    assert(isnan((cd(NAN, 0) * cd(1, 1)).real()));
+    assert(nuostl::detail::nuo_complex_limited_range ||
+           std::complex<double>(x) == std::complex<double>(inf, 1) *
+                                          std::complex<double>(1, 1));
+
+    /* division */
+    assert(is_inf(cd(1, 2) / cd(0, 0)));
+    assert(is_inf(cd(inf, 1) / cd(2, 3)));
+    cd z = cd(1, 2) / cd(inf, NAN);
+    assert(z.real() == 0 && z.imag() == 0);
+    assert(is_inf(cf(1, 2) / cf(0, 0)));
+
+    /* the plain formulas do not recover */
+    assert(is_inf(cd(inf, NAN) * cd(2, 0)));
+    cd f = mul_fast(cd(inf, NAN), cd(2, 0));
+    assert(isnan(f.real()) && isnan(f.imag()));
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Complex::test_functions() {
+    std::mt19937_64 rng(2);
+    std::uniform_real_distribution<double> u(-10, 10);
+    for (int i = 0; i < 1000; i++) {
+        cd z(u(rng), u(rng));
+        std::complex<double> s = z;
+        assert(close(abs(z), std::abs(s), 1e-15));
+        assert(close(arg(z), std::arg(s), 1e-15));
+        assert(close(exp(z), std::exp(s), 1e-13));
+        assert(close(log(z), std::log(s), 1e-13));
+        assert(close(sqrt(z), std::sqrt(s), 1e-14));
+        assert(close(nuostl::polar(abs(z), arg(z)), s, 1e-13));
+    }
+    assert(sqrt(cd(-4, 0)) == cd(0, 2) && sqrt(cd(-4, -0.0)) == cd(0, -2));
+    assert(sqrt(cd(0, 0)) == cd(0, 0));
+    assert(abs(cd(3e300, 4e300)) == 5e300 && abs(cd(3e-300, 4e-300)) == 5e-300);
+    assert(abs(cd(inf, NAN)) == inf);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Complex::test_array() {
+    nuo_complex_array<double> e;
+    assert(e.empty() && e.size() == 0 && (e * e).empty());
+
+    nuo_complex_array<double> a{{1, 2}, {3, 4}, {5, 6}};
+    assert(a.size() == 3 && a[1] == cd(3, 4) && a.at(2) == cd(5, 6));
+    assert(a.real_data()[2] == 5 && a.imag_data()[0] == 2);
+    assert(reinterpret_cast<uintptr_t>(a.real_data()) % 64 == 0);
+    assert(reinterpret_cast<uintptr_t>(a.imag_data()) % 64 == 0);
+
+    std::ostringstream os;
+    os << a;
+    assert(os.str() == "{(1,2), (3,4), (5,6)}");
+
+    nuo_complex_array<double> b(3, cd(0, 1));
+    assert(a * b == (nuo_complex_array<double>{{-2, 1}, {-4, 3}, {-6, 5}}));
+    assert(conj_mul(a, b) == (nuo_complex_array<double>{{2, -1}, {4, -3}, {6, -5}}));
+    assert(a + b == (nuo_complex_array<double>{{1, 3}, {3, 5}, {5, 7}}));
+    assert(a - a == nuo_complex_array<double>(3));
+    assert(a * 2.0 == a + a && a * cd(0, 1) == a * b);
+    assert(conj(a)[1] == cd(3, -4));
+    assert(abs(a)[1] == 5 && norm(a)[1] == 25);
+
+    std::vector<std::complex<double>> v = {{1, 2}, {3, 4}, {5, 6}};
+    assert(nuo_complex_array<double>(v.begin(), v.end()) == a);
+    double re[] = {1, 3, 5}, im[] = {2, 4, 6};
+    assert(nuo_complex_array<double>(re, im, 3) == a);
+
+    nuo_complex_array<double> c(a), d(std::move(c));
+    assert(d == a && c.empty());
+    c = d;
+    c.set(0, cd(9, 9));
+    assert(c != a && c[0] == cd(9, 9));
+    c.resize(5);
+    assert(c.size() == 5 && c[2] == cd(5, 6) && c[4] == cd(0, 0));
+    c.resize(1);
+    assert(c.size() == 1 && c[0] == cd(9, 9));
+    c.fill(cd(1, -1));
+    assert(c[0] == cd(1, -1));
+
+    bool thrown = false;
+    try {
+        a *= c;
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        a.at(3);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+/* ------------------------------------------------- */
+/* Split-array kernels on every reachable ISA level */
+void test::Test_Nuo_Complex::test_kernels() {
+    for_each_isa([&](unsigned level) {
+        std::mt19937_64 rng(level + 5);
+        for (size_t n : {0, 1, 3, 4, 7, 8, 15, 16, 17, 33, 64, 100, 1001}) {
+            check_kernels<double>(rng, n);
+            check_kernels<float>(rng, n);
+        }
+        check_kernels<long double>(rng, 50);
+
+        /* the product written over an operand */
+        nuo_complex_array<double> a = random_array<double>(rng, 40);
+        nuo_complex_array<double> r = a * a;
+        a *= a;
+        assert(a == r);
+    });
+
+    /* no level fuses: every one matches the scalar kernels exactly */
+    std::mt19937_64 rng(11);
+    nuo_complex_array<double> a = random_array<double>(rng, 64);
+    nuo_complex_array<double> b = random_array<double>(rng, 64);
+    nuo_complex_array<float> af = random_array<float>(rng, 64);
+    nuo_complex_array<float> bf = random_array<float>(rng, 64);
+    std::vector<Kernel_Results<double>> got;
+    std::vector<Kernel_Results<float>> got_f;
+    for_each_isa([&](unsigned) {
+        got.emplace_back(a, b);
+        got_f.emplace_back(af, bf);
+    });
+    /* the scalar level ran first */
+    for (size_t i = 0; i < a.size(); i++) {
+        assert(got[0].sq[i].imag() == 0);
+        assert(got[0].p[i] == a[i] * b[i]);
+    }
+    for (size_t level = 1; level < got.size(); level++)
+        assert(got[level] == got[0] && got_f[level] == got_f[0]);
+}
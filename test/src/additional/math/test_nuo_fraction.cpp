@@ -0,0 +1,303 @@
+#include "./additional/math/test_nuo_fraction.hpp"
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+
+#include <limits>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_biginteger;
+using nuostl::nuo_fraction;
+
+namespace {
+    using frac = nuo_fraction<int64_t>;
+    using bigfrac = nuo_fraction<nuo_biginteger>;
+
+    template<typename F>
+    std::string str(const F& f) {
+        std::ostringstream os;
+        os << f;
+        return os.str();
+    }
+
+    template<typename F>
+    bool throws_domain(F&& f) {
+        try {
+            f();
+        } catch (const std::domain_error&) {
+            return true;
+        }
+        return false;
+    }
+
+    /* Random operations on Int fractions mirrored on the big type */
+    template<typename Int>
+    void check_random_ops(uint64_t seed, int64_t bound, int steps) {
+        std::mt19937_64 rng(seed);
+        auto pick = [&] {
+            int64_t d = static_cast<int64_t>(rng() % bound) + 1;
+            int64_t n = static_cast<int64_t>(rng() % (2 * bound + 1)) - bound;
+            return std::pair<Int, Int>(static_cast<Int>(n), static_cast<Int>(d));
+        };
+        nuo_fraction<Int> acc(1);
+        bigfrac ref(1);
+        for (int i = 0; i < steps; i++) {
+            auto [n, d] = pick();
+            nuo_fraction<Int> x(n, d);
+            bigfrac y{nuo_biginteger(n), nuo_biginteger(d)};
+            switch (rng() % 4) {
+                case 0: acc += x; ref += y; break;
+                case 1: acc -= x; ref -= y; break;
+                case 2: acc *= x; ref *= y; break;
+                default:
+                    if (n != 0) {
+                        acc /= x;
+                        ref /= y;
+                    }
+                    break;
+            }
+            assert(acc.to_big() == ref);
+            /* keep the reference from growing without bound */
+            if (ref.numerator().bit_length() > 400) {
+                acc = nuo_fraction<Int>(1);
+                ref = bigfrac(1);
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Fraction::test_nuo_fraction() {
+    test_gcd();
+    test_basic();
+    test_arithmetic();
+    test_promotion();
+    test_compare();
+    test_chains();
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Fraction::test_gcd() {
+    using nuostl::detail::nuo_gcd_binary;
+
+    static_assert(nuo_gcd_binary<uint32_t>(12, 18) == 6);
+    assert(nuo_gcd_binary<uint64_t>(0, 0) == 0);
+    assert(nuo_gcd_binary<uint64_t>(0, 7) == 7 && nuo_gcd_binary<uint64_t>(7, 0) == 7);
+    assert(nuo_gcd_binary<uint64_t>(uint64_t(1) << 63, uint64_t(3) << 40) ==
+           uint64_t(1) << 40);
+    assert(nuo_gcd_binary<uint8_t>(uint8_t(200), uint8_t(120)) == 40);
+
+    std::mt19937_64 rng(3);
+    for (int i = 0; i < 20000; i++) {
+        uint64_t a = rng() >> (rng() % 64), b = rng() >> (rng() % 64);
+        uint64_t k = (rng() % 1000) + 1;
+        if (a < UINT64_MAX / k && b < UINT64_MAX / k) {
+            a *= k;
+            b *= k;
+        }
+        assert(nuo_gcd_binary(a, b) == std::gcd(a, b));
+        uint32_t x = static_cast<uint32_t>(a), y = static_cast<uint32_t>(b);
+        assert(nuo_gcd_binary(x, y) == std::gcd(x, y));
+    }
+
+    /* multi-limb operands */
+    nuo_biginteger p = nuo_biginteger(1) << 200;
+    nuo_biginteger q = nuo_biginteger(3) * (nuo_biginteger(1) << 150);
+    assert(gcd(p, q) == nuo_biginteger(1) << 150);
+    assert(gcd(-p, q) == nuo_biginteger(1) << 150);
+    assert(gcd(p, nuo_biginteger(0)) == p && gcd(nuo_biginteger(0), -q) == q);
+    nuo_biginteger r("123456789012345678901234567890");
+    assert(gcd(r * 77, r * 91) == r * 7);
+    assert(gcd(nuo_biginteger(-12), nuo_biginteger(18)) == nuo_biginteger(6));
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Fraction::test_basic() {
+    frac a;
+    assert(a.sign() == 0 && a.numerator() == 0 && a.denominator() == 1);
+
+    frac b(6, -4);
+    assert(b.numerator() == -3 && b.denominator() == 2 && b.sign() < 0);
+    assert(str(b) == "-3/2" && str(frac(8, 4)) == "2" && str(frac(0, -5)) == "0");
+    assert(static_cast<double>(b) == -1.5);
+
+    frac c = frac(1, 2) + 1;
+    assert(c == frac(3, 2) && str(c) == "3/2");
+    assert(-c == frac(-3, 2) && -(-c) == c);
+
+    /* denominators stay unreduced until asked */
+    frac d = frac(1, 6) + frac(1, 3);
+    assert(d == frac(1, 2) && d.denominator() == 2);
+    assert(d.normalize().denominator() == 2);
+
+    assert(throws_domain([] { frac(1, 0); }));
+    assert(throws_domain([] { frac(1, 2) / frac(0, 3); }));
+    assert(throws_domain([] { bigfrac(nuo_biginteger(1), nuo_biginteger(0)); }));
+    assert(throws_domain([] { bigfrac(1) / bigfrac(0); }));
+
+    bigfrac e(nuo_biginteger(10), nuo_biginteger(-4));
+    assert(e.numerator() == nuo_biginteger(-5) && e.denominator() == nuo_biginteger(2));
+    assert(str(e) == "-5/2" && static_cast<double>(e) == -2.5);
+
+    /* copies own their promoted value */
+    frac big(INT64_MAX);
+    big *= frac(4, 3);
+    assert(big.promoted());
+    frac copy = big;
+    copy += 1;
+    assert(copy != big && copy - big == frac(1));
+    copy = big;
+    assert(copy == big);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Fraction::test_arithmetic() {
+    check_random_ops<int64_t>(5, 1000, 20000);
+    check_random_ops<int64_t>(6, int64_t(1) << 40, 5000);
+    check_random_ops<int32_t>(7, 100, 20000);
+    check_random_ops<int32_t>(8, 1 << 30, 5000);
+    check_random_ops<int8_t>(9, 20, 5000);
+
+    /* a / a aliases */
+    frac x(7, 9);
+    x /= x;
+    assert(x == frac(1));
+    bigfrac y(nuo_biginteger(7), nuo_biginteger(9));
+    y /= y;
+    assert(y == bigfrac(1));
+    x = frac(2, 3);
+    x *= x;
+    assert(x == frac(4, 9));
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Fraction::test_promotion() {
+    const int64_t mx = INT64_MAX, mn = INT64_MIN;
+
+    /* cross-cancellation keeps this in int64 */
+    frac a(mx, 3);
+    a *= frac(3, mx);
+    assert(!a.promoted() && a == frac(1));
+    frac b(mx - 1, 7);
+    b /= frac(mx - 1, 14);
+    assert(!b.promoted() && b == frac(2));
+
+    /* a sum that needs a multi-limb value, then comes back */
+    frac c(mx);
+    c += frac(mx);
+    assert(c.promoted());
+    assert(c.to_big() == bigfrac(nuo_biginteger(mx) * 2));
+    c -= frac(mx);
+    assert(!c.promoted() && c == frac(mx));
+    bool thrown = false;
+    try {
+        (frac(mx) * frac(mx)).numerator();
+    } catch (const std::overflow_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    /* INT64_MIN has no negation in int64 */
+    frac m(mn);
+    frac n = -m;
+    assert(n.promoted() && n.to_big() == bigfrac(-nuo_biginteger(mn)));
+    assert(-n == m && !(-n).promoted());
+    frac o(1, mn);
+    assert(o.to_big() == bigfrac(nuo_biginteger(-1), -nuo_biginteger(mn)));
+    assert(frac(mn, mn) == frac(1));
+    frac p(3);
+    p /= frac(mn);
+    assert(p.to_big() == bigfrac(nuo_biginteger(-3), -nuo_biginteger(mn)));
+
+    /* large denominators with a big common factor */
+    int64_t g = int64_t(1) << 40;
+    frac q(1, 3 * g);
+    q += frac(1, 5 * g);
+    assert(!q.promoted() && q == frac(8, 15 * g));
+
+    /* int32 promotes too */
+    nuo_fraction<int32_t> r(INT32_MAX);
+    r *= nuo_fraction<int32_t>(INT32_MAX);
+    assert(r.promoted());
+    r /= nuo_fraction<int32_t>(INT32_MAX);
+    assert(!r.promoted() && r == nuo_fraction<int32_t>(INT32_MAX));
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Fraction::test_compare() {
+    assert(frac(1, 3) < frac(1, 2) && frac(-1, 2) < frac(-1, 3));
+    assert(frac(2, 4) == frac(1, 2) && frac(2, 4) <= frac(1, 2));
+    const int64_t mx = INT64_MAX;
+    assert(frac(mx, mx - 1) < frac(mx - 1, mx - 2));
+    assert(frac(mx - 1, mx) > frac(mx - 2, mx - 1));
+    assert(frac(INT64_MIN, INT64_MAX) < frac(-1));
+
+    frac big(INT64_MAX);
+    big += frac(1);
+    assert(big > frac(INT64_MAX) && frac(INT64_MIN) < big);
+    assert(big == big && !(big < big));
+
+    std::mt19937_64 rng(11);
+    for (int i = 0; i < 5000; i++) {
+        int64_t p = static_cast<int64_t>(rng() % 2001) - 1000;
+        int64_t q = static_cast<int64_t>(rng() % 1000) + 1;
+        int64_t r = static_cast<int64_t>(rng() % 2001) - 1000;
+        int64_t s = static_cast<int64_t>(rng() % 1000) + 1;
+        assert((frac(p, q) <=> frac(r, s)) == (p * s <=> r * q));
+        assert((bigfrac(nuo_biginteger(p), nuo_biginteger(q)) <=>
+                bigfrac(nuo_biginteger(r), nuo_biginteger(s))) == (p * s <=> r * q));
+    }
+
+    assert(bigfrac(nuo_biginteger(1), nuo_biginteger(3)) <
+           bigfrac(nuo_biginteger(1), nuo_biginteger(2)));
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Fraction::test_chains() {
+    /* telescoping sum of 1 / (k (k + 1)) */
+    for (int64_t n : {10, 1000, 100000}) {
+        frac s;
+        for (int64_t k = 1; k <= n; k++)
+            s += frac(1, k * (k + 1));
+        assert(!s.promoted());
+        assert(s.numerator() == n && s.denominator() == n + 1);
+    }
+
+    /* harmonic numbers outgrow int64 */
+    frac h;
+    bigfrac hb;
+    for (int64_t k = 1; k <= 100; k++) {
+        h += frac(1, k);
+        hb += bigfrac(nuo_biginteger(1), nuo_biginteger(k));
+        if (k == 30)
+            assert(!h.promoted() && h.numerator() == 9304682830147 &&
+                   h.denominator() == 2329089562800);
+    }
+    assert(h.promoted() && h == frac(hb));
+    assert(str(hb) == "14466636279520351160221518043104131447711/"
+                      "2788815009188499086581352357412492142272");
+    assert(str(h) == str(hb));
+    assert(fabs(static_cast<double>(h) - 5.187377517639621) < 1e-12);
+
+    /* telescoping product, cross-cancelled */
+    frac p(1);
+    for (int64_t k = 1; k <= 100000; k++)
+        p *= frac(k, k + 1);
+    assert(!p.promoted() && p == frac(1, 100001));
+
+    /* the big type alone: sum 1/2^k stays lazy, value exact */
+    bigfrac t;
+    nuo_biginteger pw(1);
+    for (int k = 0; k < 300; k++) {
+        pw *= 2;
+        t += bigfrac(nuo_biginteger(1), pw);
+    }
+    assert(t.denominator() == pw && t.numerator() == pw - 1);
+}
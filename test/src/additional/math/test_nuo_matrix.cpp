@@ -0,0 +1,304 @@
+#include "./additional/math/test_nuo_matrix.hpp"
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+#include "nuostl.hpp"
+#include "test.hpp"
+
+using nuostl::nuo_matrix;
+using nuostl::nuo_modint;
+
+namespace {
+    using mint = nuo_modint<998244353>;
+
+    template<typename T>
+    nuo_matrix<T> random_matrix(std::mt19937_64& rng, size_t r, size_t c) {
+        nuo_matrix<T> m(r, c);
+        for (size_t i = 0; i < r; i++) {
+            for (size_t j = 0; j < c; j++)
+                m(i, j) = T(static_cast<int64_t>(rng() % 19) - 9);
+        }
+        return m;
+    }
+
+    /* alpha a b + beta c by the triple loop */
+    template<typename T>
+    nuo_matrix<T> reference(const nuo_matrix<T>& a, const nuo_matrix<T>& b,
+                            T alpha, T beta, const nuo_matrix<T>& c) {
+        nuo_matrix<T> r(a.rows(), b.cols());
+        for (size_t i = 0; i < a.rows(); i++) {
+            for (size_t j = 0; j < b.cols(); j++) {
+                T s = T(0);
+                for (size_t p = 0; p < a.cols(); p++)
+                    s = s + a(i, p) * b(p, j);
+                r(i, j) = alpha * s + beta * c(i, j);
+            }
+        }
+        return r;
+    }
+
+    /* Small integer inputs keep float and double products exact */
+    template<typename T>
+    void check_gemm(std::mt19937_64& rng, size_t m, size_t n, size_t k) {
+        nuo_matrix<T> a = random_matrix<T>(rng, m, k);
+        nuo_matrix<T> b = random_matrix<T>(rng, k, n);
+        nuo_matrix<T> c = random_matrix<T>(rng, m, n);
+        T alpha = T(static_cast<int64_t>(rng() % 5) - 2);
+        T beta = T(static_cast<int64_t>(rng() % 3) - 1);
+        nuo_matrix<T> expect = reference(a, b, alpha, beta, c);
+        nuostl::detail::nuo_gemm<T>({m, n, k, alpha, a.data(), a.stride(),
+                                     b.data(), b.stride(), beta, c.data(),
+                                     c.stride()});
+        assert(c == expect);
+    }
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Matrix::test_nuo_matrix() {
+    test_basic();
+    test_gemm();
+    test_threads();
+    test_expressions();
+    test_aliasing();
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Matrix::test_basic() {
+    nuo_matrix<double> e;
+    assert(e.empty() && e.rows() == 0 && e.cols() == 0);
+
+    nuo_matrix<double> z(3, 5);
+    assert(z.rows() == 3 && z.cols() == 5);
+    for (size_t i = 0; i < 3; i++) {
+        assert(reinterpret_cast<uintptr_t>(z.row(i)) % 64 == 0);
+        for (size_t j = 0; j < 5; j++)
+            assert(z(i, j) == 0.0);
+    }
+    assert(z.stride() == 8);
+
+    nuo_matrix<float> f(2, 17, 1.5f);
+    assert(f.stride() == 32 && f(1, 16) == 1.5f);
+
+    nuo_matrix<int> m{{1, 2, 3}, {4, 5, 6}};
+    assert(m.rows() == 2 && m.cols() == 3 && m(1, 0) == 4);
+    assert(m.at(0, 2) == 3);
+    bool thrown = false;
+    try {
+        m.at(2, 0);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        nuo_matrix<int> bad{{1, 2}, {3}};
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    nuo_matrix<int> t = m.transpose();
+    assert(t.rows() == 3 && t.cols() == 2);
+    assert((t == nuo_matrix<int>{{1, 4}, {2, 5}, {3, 6}}));
+    assert(t.transpose() == m);
+
+    std::mt19937_64 rng(1);
+    nuo_matrix<int> big = random_matrix<int>(rng, 70, 45);
+    nuo_matrix<int> bt = big.transpose();
+    for (size_t i = 0; i < 70; i++) {
+        for (size_t j = 0; j < 45; j++)
+            assert(bt(j, i) == big(i, j));
+    }
+
+    nuo_matrix<int> copy(m), moved(std::move(copy));
+    assert(moved == m && copy.empty());
+    copy = moved;
+    assert(copy == m);
+    copy(0, 0) = 9;
+    assert(copy != m);
+
+    nuo_matrix<int> id = nuo_matrix<int>::identity(3);
+    assert((id == nuo_matrix<int>{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}));
+
+    std::ostringstream os;
+    os << m;
+    assert(os.str() == "{{1, 2, 3}, {4, 5, 6}}");
+}
+
+/* ------------------------------------------------- */
+/* Packed GEMM against the triple loop on every reachable ISA level */
+void test::Test_Nuo_Matrix::test_gemm() {
+    for_each_isa([&](unsigned level) {
+        std::mt19937_64 rng(level + 3);
+        /* edge tiles of every kernel shape */
+        for (size_t m : {1, 5, 8, 13, 31})
+            for (size_t n : {1, 7, 16, 25, 49})
+                for (size_t k : {1, 3, 40})
+                    check_gemm<double>(rng, m, n, k);
+        for (int it = 0; it < 30; it++) {
+            size_t m = 1 + rng() % 120, n = 1 + rng() % 120;
+            size_t k = 1 + rng() % 120;
+            check_gemm<double>(rng, m, n, k);
+            check_gemm<float>(rng, m, n, k);
+        }
+        /* several KC panels, MC blocks and NR slivers */
+        check_gemm<double>(rng, 203, 130, 600);
+        check_gemm<float>(rng, 97, 301, 530);
+        check_gemm<int64_t>(rng, 150, 70, 300);
+        check_gemm<mint>(rng, 40, 60, 280);
+    });
+
+    /* beta == 0 ignores C, even NaN */
+    nuo_matrix<double> a(20, 30, 1.0), b(30, 40, 2.0);
+    nuo_matrix<double> c(20, 40, NAN);
+    nuostl::detail::nuo_gemm<double>({20, 40, 30, 1.0, a.data(), a.stride(),
+                                      b.data(), b.stride(), 0.0, c.data(),
+                                      c.stride()});
+    assert(c == nuo_matrix<double>(20, 40, 60.0));
+
+    /* k == 0 leaves beta C */
+    nuo_matrix<double> d(3, 3, 2.0);
+    nuostl::detail::nuo_gemm<double>({3, 3, 0, 1.0, nullptr, 0, nullptr, 0,
+                                      3.0, d.data(), d.stride()});
+    assert(d == nuo_matrix<double>(3, 3, 6.0));
+}
+
+/* ------------------------------------------------- */
+/* Split products on a forced team size, whatever the core count */
+void test::Test_Nuo_Matrix::test_threads() {
+    std::mt19937_64 rng(7);
+    nuostl::nuo_matrix_set_threads(4);
+    check_gemm<double>(rng, 300, 260, 250);
+    check_gemm<float>(rng, 40, 900, 300);
+    check_gemm<double>(rng, 700, 30, 400);
+
+    /* a product issued from inside a running job runs inline */
+    nuostl::detail::nuo_thread_team::instance().run(3, [&](size_t t) {
+        std::mt19937_64 r(t);
+        check_gemm<double>(r, 200, 200, 200);
+    });
+    nuostl::nuo_matrix_set_threads(0);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Matrix::test_expressions() {
+    std::mt19937_64 rng(5);
+    nuo_matrix<double> a = random_matrix<double>(rng, 37, 53);
+    nuo_matrix<double> b = random_matrix<double>(rng, 53, 29);
+    nuo_matrix<double> c = random_matrix<double>(rng, 37, 29);
+    nuo_matrix<double> d = random_matrix<double>(rng, 29, 41);
+    nuo_matrix<double> zero(37, 29);
+    nuo_matrix<double> ab = reference(a, b, 1.0, 0.0, zero);
+
+    nuo_matrix<double> r = a * b;
+    assert(r == ab);
+    r = a * b + c;
+    assert(r == reference(a, b, 1.0, 1.0, c));
+    r = c + a * b;
+    assert(r == reference(a, b, 1.0, 1.0, c));
+    r = c - a * b;
+    assert(r == reference(a, b, -1.0, 1.0, c));
+    r = a * b - c;
+    assert(r == reference(a, b, 1.0, -1.0, c));
+    r = 3.0 * (a * b) - 2.0 * c;
+    assert(r == reference(a, b, 3.0, -2.0, c));
+    r = (2.0 * a) * b;
+    assert(r == reference(a, b, 2.0, 0.0, zero));
+    r = a * (b * 0.5) + c;
+    assert(r == reference(a, b, 0.5, 1.0, c));
+
+    /* element-wise, nested products, chains */
+    r = c + c - c * 2.0 + -c;
+    assert(r == -1.0 * c);
+    r = -(a * b) + c;
+    assert(r == reference(a, b, -1.0, 1.0, c));
+    nuo_matrix<double> abd = reference(ab, d, 1.0, 0.0,
+                                       nuo_matrix<double>(37, 41));
+    assert(nuo_matrix<double>(a * b * d) == abd);
+    assert(nuo_matrix<double>(a * (b * d)) == abd);
+    nuo_matrix<double> s = (a + a) * b;
+    assert(s == reference(a, b, 2.0, 0.0, zero));
+    s = (a * b + c) * d - (a * b) * d;
+    assert(s == reference(c, d, 1.0, 0.0, nuo_matrix<double>(37, 41)));
+
+    /* compound assignment */
+    r = c;
+    r += a * b;
+    assert(r == reference(a, b, 1.0, 1.0, c));
+    r -= 2.0 * (a * b);
+    assert(r == reference(a, b, -1.0, 1.0, c));
+    r += c;
+    r -= c;
+    assert(r == reference(a, b, -1.0, 1.0, c));
+    r *= 2.0;
+    assert(r == reference(a, b, -2.0, 2.0, c));
+    nuo_matrix<double> q = a;
+    q *= b;
+    assert(q == ab);
+
+    /* integers and nuo_modint through the same expressions */
+    nuo_matrix<int> ia{{1, 2}, {3, 4}}, ib{{5, 6}, {7, 8}};
+    nuo_matrix<int> ic = ia * ib + ia;
+    assert((ic == nuo_matrix<int>{{20, 24}, {46, 54}}));
+    nuo_matrix<mint> ma{{mint(2), mint(0)}, {mint(0), mint(2)}};
+    nuo_matrix<mint> mp = ma * ma * ma;
+    assert(mp(0, 0) == mint(8) && mp(0, 1) == mint(0));
+
+    /* shape errors surface when the expression is built */
+    bool thrown = false;
+    try {
+        r = a * c;
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        r = a * b + d;
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+/* ------------------------------------------------- */
+/* Destinations that are also operands */
+void test::Test_Nuo_Matrix::test_aliasing() {
+    std::mt19937_64 rng(9);
+    nuo_matrix<double> a = random_matrix<double>(rng, 40, 40);
+    nuo_matrix<double> b = random_matrix<double>(rng, 40, 40);
+    nuo_matrix<double> c = random_matrix<double>(rng, 40, 40);
+    nuo_matrix<double> zero(40, 40);
+
+    nuo_matrix<double> x = a;
+    x = x * b;
+    assert(x == reference(a, b, 1.0, 0.0, zero));
+    x = a;
+    x = b * x + c;
+    assert(x == reference(b, a, 1.0, 1.0, c));
+    x = c;
+    x = a * b + x;
+    assert(x == reference(a, b, 1.0, 1.0, c));
+    x = a;
+    x = x * x;
+    assert(x == reference(a, a, 1.0, 0.0, zero));
+    x = a;
+    x += x * b;
+    assert(x == reference(a, b, 1.0, 1.0, a));
+    x = a;
+    x *= x;
+    assert(x == reference(a, a, 1.0, 0.0, zero));
+
+    /* non-square, the destination changes shape */
+    nuo_matrix<double> w = random_matrix<double>(rng, 40, 7);
+    nuo_matrix<double> y = a;
+    y = y * w;
+    assert(y.rows() == 40 && y.cols() == 7);
+    assert(y == reference(a, w, 1.0, 0.0, nuo_matrix<double>(40, 7)));
+}
@@ -0,0 +1,318 @@
+#include "./additional/math/test_nuo_polynomial.hpp"
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_modint;
+using nuostl::nuo_polynomial;
+
+namespace {
+    using mint = nuo_modint<998244353>;
+    using mint7 = nuo_modint<1000000007>;
+
+    /* a * b by the schoolbook kernel alone, high zeros trimmed */
+    template<typename T>
+    std::vector<T> reference_mul(const std::vector<T>& a,
+                                 const std::vector<T>& b) {
+        std::vector<T> r(a.size() + b.size() - 1);
+        nuostl::detail::nuo_poly_mul_schoolbook(a.data(), a.size(), b.data(),
+                                                b.size(), r.data());
+        while (!r.empty() && r.back() == T(0))
+            r.pop_back();
+        return r;
+    }
+
+    template<typename T>
+    std::vector<T> random_coefs(std::mt19937_64& rng, size_t n, int64_t bound) {
+        std::vector<T> v(n);
+        for (auto& x : v)
+            x = T(static_cast<int64_t>(rng() % (2 * bound + 1)) - bound);
+        if (v.back() == T(0))
+            v.back() = T(1);
+        return v;
+    }
+
+    template<uint32_t M>
+    std::vector<nuo_modint<M>> random_mod(std::mt19937_64& rng, size_t n) {
+        std::vector<nuo_modint<M>> v(n);
+        for (auto& x : v)
+            x = nuo_modint<M>(rng());
+        if (v.back() == nuo_modint<M>(0))
+            v.back() = 1;
+        return v;
+    }
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Polynomial::test_nuo_polynomial() {
+    test_modint();
+    test_basic();
+    test_mul();
+    test_divmod();
+    test_inverse();
+    test_evaluate();
+    test_interpolate();
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Polynomial::test_modint() {
+    static_assert(sizeof(mint) == 4);
+    static_assert(mint::modulus() == 998244353);
+
+    mint a(-1), b(998244354ull), c(5);
+    assert(a.value() == 998244352 && b.value() == 1);
+    assert(a + b == mint(0) && b - c == mint(-4));
+    assert((c * c).value() == 25 && -c == mint(998244348));
+    assert(c * c.inv() == mint(1) && c / c == mint(1));
+    assert(mint(3).pow(0) == mint(1) && mint(3).pow(5) == mint(243));
+    assert(mint(2).pow(998244352) == mint(1));
+
+    constexpr mint k = mint(7) * mint(3);
+    static_assert(k.value() == 21);
+
+    std::ostringstream os;
+    os << mint7(-2);
+    assert(os.str() == "1000000005");
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Polynomial::test_basic() {
+    nuo_polynomial<int64_t> zero, p{1, 2, 3, 0, 0};
+    assert(zero.is_zero() && zero.degree() == -1 && zero.size() == 0);
+    assert(p.degree() == 2 && p.size() == 3 && p.leading() == 3);
+    assert(p[0] == 1 && p[2] == 3 && p[10] == 0);
+    assert(nuo_polynomial<int64_t>({0, 0}).is_zero());
+
+    nuo_polynomial<int64_t> q{-1, 0, -3};
+    assert(p + q == nuo_polynomial<int64_t>({0, 2}));
+    assert(p - p == zero && -p + p == zero);
+    assert(p * int64_t(2) == nuo_polynomial<int64_t>({2, 4, 6}));
+    assert(int64_t(0) * p == zero);
+    assert(p * q == nuo_polynomial<int64_t>({-1, -2, -6, -6, -9}));
+    assert(p * zero == zero);
+
+    assert(p(0) == 1 && p(2) == 17 && p(-1) == 2);
+    assert(p.derivative() == nuo_polynomial<int64_t>({2, 6}));
+    assert(nuo_polynomial<int64_t>{7}.derivative().is_zero());
+
+    std::ostringstream os;
+    os << p << zero;
+    assert(os.str() == "{1, 2, 3}{}");
+
+    /* signed coefficients wrap modulo 2^32 */
+    nuo_polynomial<int32_t> w{INT32_MAX, INT32_MIN, 3};
+    assert(w + w == nuo_polynomial<int32_t>({-2, 0, 6}));
+    assert(-w == nuo_polynomial<int32_t>({-INT32_MAX, INT32_MIN, -3}));
+    assert(w - -w == w + w && w * int32_t(2) == w + w);
+    assert(w.derivative() == nuo_polynomial<int32_t>({INT32_MIN, 6}));
+    assert(nuo_polynomial<int32_t>({0, INT32_MAX, INT32_MAX}).derivative() ==
+           nuo_polynomial<int32_t>({INT32_MAX, -2}));
+    assert(w(2) == INT32_MIN + 11);
+
+    nuo_polynomial<double> d{0.5, -1.0};
+    assert(d(2.0) == -1.5);
+    assert((nuo_polynomial<mint>{1, 2} * mint(3))(mint(1)) == mint(9));
+}
+
+/* ------------------------------------------------- */
+/* Every transform path against schoolbook, around the thresholds */
+void test::Test_Nuo_Polynomial::test_mul() {
+    std::mt19937_64 rng(7);
+    const size_t sizes[] = {1, 5, 64, 127, 128, 199, 200, 201, 300, 2000};
+    for (size_t na : sizes) {
+        for (size_t nb : sizes) {
+            if (nb > na || (na == 2000 && nb > 300))
+                continue;
+            /* one, two and three NTT primes */
+            for (int64_t bound : {int64_t(1000), int64_t(1) << 24,
+                                  int64_t(1) << 40}) {
+                auto a = random_coefs<int64_t>(rng, na, bound);
+                auto b = random_coefs<int64_t>(rng, nb, bound / 256 + 1);
+                nuo_polynomial<int64_t> pa(a), pb(b);
+                assert((pa * pb).coefficients() == reference_mul(a, b));
+            }
+            auto ua = random_coefs<uint32_t>(rng, na, 1 << 30);
+            auto ub = random_coefs<uint32_t>(rng, nb, 1 << 30);
+            assert((nuo_polynomial<uint32_t>(ua) * nuo_polynomial<uint32_t>(ub))
+                   .coefficients() == reference_mul(ua, ub));
+
+            auto ma = random_mod<998244353>(rng, na);
+            auto mb = random_mod<998244353>(rng, nb);
+            assert((nuo_polynomial<mint>(ma) * nuo_polynomial<mint>(mb))
+                   .coefficients() == reference_mul(ma, mb));
+            auto sa = random_mod<1000000007>(rng, na);
+            auto sb = random_mod<1000000007>(rng, nb);
+            assert((nuo_polynomial<mint7>(sa) * nuo_polynomial<mint7>(sb))
+                   .coefficients() == reference_mul(sa, sb));
+
+            auto da = random_coefs<double>(rng, na, 1000);
+            auto db = random_coefs<double>(rng, nb, 1000);
+            auto dc = (nuo_polynomial<double>(da) * nuo_polynomial<double>(db));
+            auto dr = reference_mul(da, db);
+            for (size_t i = 0; i < dr.size(); i++)
+                assert(fabs(dc[i] - dr[i]) < 1e-6 * static_cast<double>(na));
+        }
+    }
+
+    /* squaring transforms once */
+    auto a = random_coefs<int64_t>(rng, 1000, int64_t(1) << 40);
+    nuo_polynomial<int64_t> pa(a);
+    assert((pa * pa).coefficients() == reference_mul(a, a));
+    nuo_polynomial<int64_t> t = pa;
+    t *= t;
+    assert(t == pa * pa);
+
+    /* exact cancellation leaves no high zeros */
+    nuo_polynomial<int64_t> x1{1, 1}, xm{-1, 1};
+    nuo_polynomial<int64_t> big(std::vector<int64_t>(400, 1));
+    assert((big * x1 - big * xm).degree() == 399);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Polynomial::test_divmod() {
+    std::mt19937_64 rng(9);
+    /* long division and Newton, modular */
+    const size_t shapes[][2] = {{10, 3}, {300, 300}, {300, 299}, {900, 100},
+                                {1400, 700}, {4000, 1600}, {5000, 10}};
+    for (const auto& s : shapes) {
+        nuo_polynomial<mint> a(random_mod<998244353>(rng, s[0]));
+        nuo_polynomial<mint> b(random_mod<998244353>(rng, s[1]));
+        nuo_polynomial<mint> q, r;
+        divmod(a, b, q, r);
+        assert(r.degree() < b.degree());
+        assert(q * b + r == a);
+        assert(a / b == q && a % b == r);
+        nuo_polynomial<mint> c = a;
+        c /= b;
+        assert(c == q);
+    }
+
+    /* integers: a = q b + r built exactly, b with a unit leading term */
+    for (const auto& s : shapes) {
+        auto b = random_coefs<int64_t>(rng, s[1], 5);
+        b.back() = rng() & 1 ? 1 : -1;
+        nuo_polynomial<int64_t> pb(b);
+        nuo_polynomial<int64_t> q(
+            random_coefs<int64_t>(rng, s[0] - s[1] + 1, 1000));
+        nuo_polynomial<int64_t> r(random_coefs<int64_t>(rng, s[1] - 1, 1000));
+        nuo_polynomial<int64_t> a = q * pb + r;
+        nuo_polynomial<int64_t> q2, r2;
+        divmod(a, pb, q2, r2);
+        assert(q2 == q && r2 == r);
+    }
+
+    /* a shorter dividend is its own remainder */
+    nuo_polynomial<mint> small{1, 2}, larger{1, 2, 3};
+    assert((small / larger).is_zero() && small % larger == small);
+
+    bool thrown = false;
+    try {
+        nuo_polynomial<int64_t>{1, 2, 3} / nuo_polynomial<int64_t>{1, 2};
+    } catch (const std::domain_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        nuo_polynomial<mint>{1, 2} % nuo_polynomial<mint>{};
+    } catch (const std::domain_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    nuo_polynomial<double> dq, dr;
+    divmod(nuo_polynomial<double>{-1, 0, 1}, nuo_polynomial<double>{-1, 2},
+           dq, dr);
+    assert(dq == nuo_polynomial<double>({0.25, 0.5}) &&
+           dr == nuo_polynomial<double>({-0.75}));
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Polynomial::test_inverse() {
+    std::mt19937_64 rng(13);
+    for (size_t n : {1, 2, 100, 1000, 4000}) {
+        nuo_polynomial<mint> f(random_mod<998244353>(rng, 700));
+        if (f[0] == mint(0))
+            f += nuo_polynomial<mint>{1};
+        nuo_polynomial<mint> g = f.inverse(n);
+        assert(g.degree() < static_cast<ptrdiff_t>(n));
+        auto fg = (f * g).coefficients();
+        assert(fg[0] == mint(1));
+        for (size_t i = 1; i < n; i++)
+            assert(fg[i] == mint(0));
+    }
+
+    /* 1 / (1 - x) = 1 + x + x^2 + ..., exactly over the integers */
+    nuo_polynomial<int64_t> geo = nuo_polynomial<int64_t>{1, -1}.inverse(50);
+    assert(geo == nuo_polynomial<int64_t>(std::vector<int64_t>(50, 1)));
+
+    bool thrown = false;
+    try {
+        nuo_polynomial<int64_t>{0, 1}.inverse(4);
+    } catch (const std::domain_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(nuo_polynomial<mint>{3}.inverse(0).is_zero());
+}
+
+/* ------------------------------------------------- */
+/* The subproduct tree against Horner at every point */
+void test::Test_Nuo_Polynomial::test_evaluate() {
+    std::mt19937_64 rng(17);
+    for (size_t n : {10, 64, 200, 1500}) {
+        nuo_polynomial<mint> p(random_mod<998244353>(rng, n));
+        std::vector<mint> xs = random_mod<998244353>(rng, n + 37);
+        std::vector<mint> ys = p.evaluate(xs);
+        assert(ys.size() == xs.size());
+        for (size_t i = 0; i < xs.size(); i++)
+            assert(ys[i] == p(xs[i]));
+    }
+
+    nuo_polynomial<int64_t> p(random_coefs<int64_t>(rng, 300, 3));
+    std::vector<int64_t> xs(300);
+    for (size_t i = 0; i < xs.size(); i++)
+        xs[i] = static_cast<int64_t>(i % 3) - 1;
+    std::vector<int64_t> ys = p.evaluate(xs);
+    for (size_t i = 0; i < xs.size(); i++)
+        assert(ys[i] == p(xs[i]));
+
+    assert(p.evaluate({}).empty());
+    assert(nuo_polynomial<mint>().evaluate({1, 2}) ==
+           std::vector<mint>({0, 0}));
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Polynomial::test_interpolate() {
+    std::mt19937_64 rng(19);
+    for (size_t n : {1, 3, 33, 100, 700}) {
+        nuo_polynomial<mint> p(random_mod<998244353>(rng, n));
+        std::vector<mint> xs(n);
+        for (size_t i = 0; i < n; i++)
+            xs[i] = mint(3 * i + 1);
+        std::vector<mint> ys = p.evaluate(xs);
+        assert(nuo_polynomial<mint>::interpolate(xs, ys) == p);
+    }
+
+    /* x^2 through three points */
+    nuo_polynomial<double> sq = nuo_polynomial<double>::interpolate(
+        {-1.0, 0.0, 2.0}, {1.0, 0.0, 4.0});
+    assert(sq.size() == 3 && fabs(sq[2] - 1) < 1e-12 && fabs(sq[1]) < 1e-12);
+
+    assert(nuo_polynomial<mint>::interpolate({}, {}).is_zero());
+    bool thrown = false;
+    try {
+        nuo_polynomial<mint>::interpolate({1, 2}, {1});
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
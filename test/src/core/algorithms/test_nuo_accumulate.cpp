@@ -0,0 +1,128 @@
+#include "./core/algorithms/test_nuo_accumulate.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <array>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_accumulate;
+
+namespace {
+    constexpr int constexpr_sum() {
+        std::array<int, 5> a{1, 2, 3, 4, 5};
+        return nuo_accumulate(a.begin(), a.end(), 10);
+    }
+
+    /* deterministic values with every bit pattern */
+    std::vector<uint64_t> values(size_t n) {
+        std::vector<uint64_t> v(n);
+        uint64_t x = 0x9e3779b97f4a7c15ull;
+        for (uint64_t& y : v) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            y = x;
+        }
+        return v;
+    }
+}
+
+void test::Test_Nuo_Accumulate::test_serial() {
+    static_assert(constexpr_sum() == 25);
+
+    /* unknown or non-associative ops run in order */
+    std::vector<int> v{1, 2, 3, 4};
+    assert(nuo_accumulate(v.begin(), v.end(), 100, nuostl::nuo_minus<>()) == 90);
+    assert(nuo_accumulate(v.begin(), v.end(), 0, [](int a, int b) { return a * 10 + b; }) == 1234);
+    std::vector<std::string> s{"a", "b", "c"};
+    assert(nuo_accumulate(s.begin(), s.end(), std::string(">")) == ">abc");
+
+    /* floating point sums keep the serial rounding */
+    std::vector<double> d{1e16, 1.0, -1e16, 1.0};
+    assert(nuo_accumulate(d.begin(), d.end(), 0.0) == std::accumulate(d.begin(), d.end(), 0.0));
+
+    /* other iterators */
+    std::list<int> l{5, 6, 7};
+    assert(nuo_accumulate(l.begin(), l.end(), 1, nuostl::nuo_multiplies<>()) == 210);
+    assert(nuo_accumulate(v.begin(), v.begin(), 42) == 42);
+}
+
+void test::Test_Nuo_Accumulate::test_lanes() {
+    /* every length around the four lanes, against std::accumulate */
+    const std::vector<uint64_t> raw = values(1000);
+    for (size_t n : {1, 2, 3, 4, 5, 7, 8, 9, 63, 1000}) {
+        std::vector<int32_t> v(n);
+        for (size_t i = 0; i < n; i++)
+            v[i] = static_cast<int32_t>(raw[i] % 2001) - 1000;
+        assert(nuo_accumulate(v.begin(), v.end(), 7) == std::accumulate(v.begin(), v.end(), 7));
+        assert(nuo_accumulate(v.begin(), v.end(), int64_t(-3), std::plus<>()) ==
+               std::accumulate(v.begin(), v.end(), int64_t(-3)));
+
+        std::vector<uint64_t> u(raw.begin(), raw.begin() + static_cast<ptrdiff_t>(n));
+        assert(nuo_accumulate(u.begin(), u.end(), uint64_t(3), nuostl::nuo_multiplies<>()) ==
+               std::accumulate(u.begin(), u.end(), uint64_t(3), std::multiplies<>()));
+        assert(nuo_accumulate(u.begin(), u.end(), ~uint64_t(0), nuostl::nuo_bit_and<>()) ==
+               std::accumulate(u.begin(), u.end(), ~uint64_t(0), std::bit_and<>()));
+        assert(nuo_accumulate(u.begin(), u.end(), uint64_t(0), nuostl::nuo_bit_xor<uint64_t>()) ==
+               std::accumulate(u.begin(), u.end(), uint64_t(0), std::bit_xor<>()));
+        assert(nuo_accumulate(u.begin(), u.end(), uint64_t(0), std::bit_or<>()) ==
+               std::accumulate(u.begin(), u.end(), uint64_t(0), std::bit_or<>()));
+    }
+
+    /* narrow accumulators wrap like the serial loop */
+    std::vector<uint8_t> b(300, 200);
+    assert(nuo_accumulate(b.begin(), b.end(), uint8_t(1)) ==
+           std::accumulate(b.begin(), b.end(), uint8_t(1)));
+    std::vector<uint16_t> h(9, 65535);
+    /* (-1)^9 mod 2^16; std::multiplies<> would overflow the promoted int */
+    assert(nuo_accumulate(h.begin(), h.end(), uint16_t(1), nuostl::nuo_multiplies<>()) ==
+           65535);
+    /* elements wider than the accumulator convert per element */
+    std::vector<int64_t> w{int64_t(1) << 40, 5, -(int64_t(1) << 40)};
+    assert(nuo_accumulate(w.begin(), w.end(), 0) == 5);
+
+    /* logical ops on integers yield 0 or 1 */
+    std::vector<int> t{3, 4, 5, 6, 7};
+    assert(nuo_accumulate(t.begin(), t.end(), 9, nuostl::nuo_logical_and<>()) == 1);
+    t[3] = 0;
+    assert(nuo_accumulate(t.begin(), t.end(), 9, nuostl::nuo_logical_and<>()) == 0);
+    assert(nuo_accumulate(t.begin(), t.end(), 0, std::logical_or<>()) == 1);
+    /* truth of the element, not of the element narrowed to int */
+    std::vector<long long> big(9, 1LL << 32);
+    assert(nuo_accumulate(big.begin(), big.end(), 1, nuostl::nuo_logical_and<>()) == 1);
+    assert(nuo_accumulate(big.begin(), big.end(), 0, nuostl::nuo_logical_or<>()) == 1);
+    assert(nuo_accumulate(nuostl::nuo_par, big.begin(), big.end(), 1,
+                          nuostl::nuo_logical_and<>()) == 1);
+}
+
+void test::Test_Nuo_Accumulate::test_parallel() {
+    const std::vector<uint64_t> raw = values(300001);
+    const auto par = nuostl::nuo_par.with_grain(1000);
+    assert(nuo_accumulate(par, raw.begin(), raw.end(), uint64_t(11)) ==
+           std::accumulate(raw.begin(), raw.end(), uint64_t(11)));
+    assert(nuo_accumulate(par, raw.begin(), raw.end(), uint64_t(1), nuostl::nuo_multiplies<>()) ==
+           std::accumulate(raw.begin(), raw.end(), uint64_t(1), std::multiplies<>()));
+    assert(nuo_accumulate(nuostl::nuo_par, raw.begin(), raw.end(), uint64_t(0), std::bit_xor<>()) ==
+           std::accumulate(raw.begin(), raw.end(), uint64_t(0), std::bit_xor<>()));
+    assert(nuo_accumulate(nuostl::nuo_par, raw.begin(), raw.begin(), 5) == 5);
+
+    /* non-associative ops stay in order */
+    std::vector<int> v(5000, 1);
+    assert(nuo_accumulate(par, v.begin(), v.end(), 0, nuostl::nuo_minus<>()) == -5000);
+    std::vector<std::string> s(3000, "x");
+    assert(nuo_accumulate(par, s.begin(), s.end(), std::string()).size() == 3000);
+    assert(nuo_accumulate(nuostl::nuo_seq, v.begin(), v.end(), 1) == 5001);
+}
+
+void test::Test_Nuo_Accumulate::test_nuo_accumulate() {
+    test_serial();
+    test_lanes();
+    test_parallel();
+}
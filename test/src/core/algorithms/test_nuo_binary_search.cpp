@@ -0,0 +1,108 @@
+#include "./core/algorithms/test_nuo_binary_search.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_binary_search;
+using nuostl::nuo_lower_bound;
+using nuostl::nuo_lower_bound_batch;
+using nuostl::nuo_upper_bound;
+
+/* Every size up to 70 and a few past the prefetch threshold, against std:: */
+void test::Test_Nuo_Binary_Search::test_bounds() {
+    std::mt19937 rng(48);
+    std::vector<size_t> sizes;
+    for (size_t n = 0; n <= 70; n++)
+        sizes.push_back(n);
+    sizes.push_back(10000);
+    sizes.push_back(100003);
+    for (size_t n : sizes) {
+        std::vector<int> v(n);
+        for (int& x : v)
+            x = static_cast<int>(rng() % (2 * n + 1));
+        std::sort(v.begin(), v.end());
+        for (int q = -1; q <= static_cast<int>(2 * n + 1); q += (n > 100 ? 97 : 1)) {
+            assert(nuo_lower_bound(v.begin(), v.end(), q) == std::lower_bound(v.begin(), v.end(), q));
+            assert(nuo_upper_bound(v.begin(), v.end(), q) == std::upper_bound(v.begin(), v.end(), q));
+            assert(nuo_binary_search(v.begin(), v.end(), q) ==
+                   std::binary_search(v.begin(), v.end(), q));
+        }
+    }
+
+    const int a[] = {1, 3, 3, 3, 7};
+    assert(nuo_lower_bound(a, a + 5, 3) == a + 1);
+    assert(nuo_upper_bound(a, a + 5, 3) == a + 4);
+    assert(nuo_lower_bound(a, a + 5, 0) == a);
+    assert(nuo_lower_bound(a, a + 5, 8) == a + 5);
+    assert(!nuo_binary_search(a, a + 5, 4));
+}
+
+void test::Test_Nuo_Binary_Search::test_comparator() {
+    std::vector<int> v = {9, 7, 7, 4, 1};
+    auto it = nuo_lower_bound(v.begin(), v.end(), 7, std::greater<int>());
+    assert(it == v.begin() + 1);
+    it = nuo_upper_bound(v.begin(), v.end(), 7, std::greater<int>());
+    assert(it == v.begin() + 3);
+
+    /* heterogeneous lookup through the transparent default */
+    std::vector<std::string> s = {"apple", "kiwi", "pear"};
+    assert(nuo_lower_bound(s.begin(), s.end(), "kiwi") == s.begin() + 1);
+    assert(nuo_binary_search(s.begin(), s.end(), "pear"));
+    assert(!nuo_binary_search(s.begin(), s.end(), "fig"));
+}
+
+void test::Test_Nuo_Binary_Search::test_forward() {
+    std::forward_list<int> l = {1, 2, 2, 5};
+    auto it = nuo_lower_bound(l.begin(), l.end(), 2);
+    assert(it != l.end() && *it == 2);
+    it = nuo_upper_bound(l.begin(), l.end(), 2);
+    assert(it != l.end() && *it == 5);
+    assert(nuo_binary_search(l.begin(), l.end(), 5));
+}
+
+/* Batches of every length around the group size, past the prefetch threshold too */
+void test::Test_Nuo_Binary_Search::test_batch() {
+    std::mt19937 rng(49);
+    for (size_t n : {size_t(0), size_t(1), size_t(2), size_t(17), size_t(1000), size_t(50000)}) {
+        std::vector<uint32_t> v(n);
+        for (uint32_t& x : v)
+            x = rng() % (3 * n + 1);
+        std::sort(v.begin(), v.end());
+        for (size_t m : {size_t(0), size_t(1), size_t(15), size_t(16), size_t(17), size_t(100)}) {
+            std::vector<uint32_t> q(m);
+            for (uint32_t& x : q)
+                x = rng() % (3 * n + 2);
+            std::vector<std::vector<uint32_t>::iterator> out(m + 1);
+            auto end = nuo_lower_bound_batch(v.begin(), v.end(), q.begin(), q.end(), out.begin());
+            assert(end == out.begin() + static_cast<ptrdiff_t>(m));
+            for (size_t j = 0; j < m; j++)
+                assert(out[j] == std::lower_bound(v.begin(), v.end(), q[j]));
+        }
+    }
+
+    std::vector<int> d = {9, 7, 7, 4, 1};
+    std::vector<int> q = {7, 10, 0, 4};
+    std::vector<std::vector<int>::iterator> out;
+    nuo_lower_bound_batch(d.begin(), d.end(), q.begin(), q.end(), std::back_inserter(out),
+                          std::greater<int>());
+    assert(out.size() == 4);
+    assert(out[0] == d.begin() + 1 && out[1] == d.begin() && out[2] == d.end() &&
+           out[3] == d.begin() + 3);
+}
+
+void test::Test_Nuo_Binary_Search::test_nuo_binary_search() {
+    test_bounds();
+    test_comparator();
+    test_forward();
+    test_batch();
+}
@@ -0,0 +1,251 @@
+#include "./core/algorithms/test_nuo_copy.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "nuostl.hpp"
+#include "test.hpp"
+
+using nuostl::nuo_copy;
+using nuostl::nuo_copy_backward;
+using nuostl::nuo_copy_n;
+using nuostl::nuo_fill;
+using nuostl::nuo_fill_n;
+using nuostl::nuo_iterator_traits;
+using nuostl::nuo_move;
+using nuostl::nuo_move_backward;
+using nuostl::nuo_uninitialized_relocate;
+
+namespace {
+    struct Pod {
+        int a;
+        double b;
+
+        bool operator==(const Pod&) const = default;
+    };
+
+    /* Not trivially copyable, opted in below */
+    struct Handle {
+        int* p;
+
+        explicit Handle(int* q) : p(q) {}
+        Handle(Handle&& o) noexcept : p(o.p) { o.p = nullptr; }
+        ~Handle() { p = nullptr; }
+    };
+
+    /* Counts its moves and destructions, for the element-wise relocation */
+    struct Tracked {
+        static inline int moves = 0;
+        static inline int destroyed = 0;
+        int v;
+
+        explicit Tracked(int x) : v(x) {}
+        Tracked(Tracked&& o) noexcept : v(o.v) { moves++; }
+        ~Tracked() { destroyed++; }
+    };
+
+    constexpr int constexpr_copy() {
+        std::array<int, 4> a{1, 2, 3, 4};
+        std::array<int, 4> b{};
+        nuo_copy(a.begin(), a.end(), b.begin());
+        nuo_fill(a.begin(), a.begin() + 2, 7);
+        return b[3] * 10 + a[1];
+    }
+}
+
+namespace nuostl {
+    template<>
+    inline constexpr bool nuo_enable_trivially_relocatable<Handle> = true;
+}
+
+void test::Test_Nuo_Copy::test_iterator_traits() {
+    using nuostl::nuo_contiguous_iterator_tag;
+    using nuostl::nuo_random_access_iterator_tag;
+    using nuostl::nuo_bidirectional_iterator_tag;
+    using nuostl::nuo_forward_iterator_tag;
+
+    static_assert(std::is_same_v<nuo_iterator_traits<int*>::iterator_concept,
+                                 nuo_contiguous_iterator_tag>);
+    static_assert(std::is_same_v<nuo_iterator_traits<std::vector<int>::iterator>::iterator_concept,
+                                 nuo_contiguous_iterator_tag>);
+    static_assert(std::is_same_v<nuo_iterator_traits<std::vector<int>::iterator>::iterator_category,
+                                 nuo_random_access_iterator_tag>);
+    static_assert(std::is_same_v<nuo_iterator_traits<std::deque<int>::iterator>::iterator_concept,
+                                 nuo_random_access_iterator_tag>);
+    static_assert(std::is_same_v<nuo_iterator_traits<std::list<int>::iterator>::iterator_concept,
+                                 nuo_bidirectional_iterator_tag>);
+    static_assert(std::is_same_v<nuo_iterator_traits<nuostl::nuo_slist<int>::iterator>::iterator_concept,
+                                 nuo_forward_iterator_tag>);
+    static_assert(nuo_iterator_traits<const char*>::is_contiguous);
+    static_assert(!nuo_iterator_traits<std::deque<int>::iterator>::is_contiguous);
+
+    static_assert(nuostl::nuo_memcpyable_iterators<const int*, int*>);
+    static_assert(nuostl::nuo_memcpyable_iterators<std::vector<Pod>::const_iterator, Pod*>);
+    static_assert(!nuostl::nuo_memcpyable_iterators<int*, const int*>);
+    static_assert(!nuostl::nuo_memcpyable_iterators<int*, long*>);
+    static_assert(!nuostl::nuo_memcpyable_iterators<std::deque<int>::iterator, int*>);
+    static_assert(!nuostl::nuo_memcpyable_iterators<std::string*, std::string*>);
+
+    static_assert(nuostl::nuo_is_trivially_relocatable_v<Pod>);
+    static_assert(nuostl::nuo_is_trivially_relocatable_v<Handle>);
+    static_assert(nuostl::nuo_is_trivially_relocatable_v<std::unique_ptr<int>>);
+    static_assert(!nuostl::nuo_is_trivially_relocatable_v<Tracked>);
+    static_assert(!nuostl::nuo_is_trivially_relocatable<std::string>::value);
+}
+
+void test::Test_Nuo_Copy::test_copy() {
+    static_assert(constexpr_copy() == 47);
+
+    std::vector<int> a{1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<int> b(8, 0);
+    assert(nuo_copy(a.begin(), a.end(), b.begin()) == b.end() && a == b);
+    assert(nuo_copy_n(a.cbegin(), 0, b.begin()) == b.begin());
+
+    /* overlapping ranges, each in its valid direction */
+    nuo_copy(a.begin() + 2, a.end(), a.begin());
+    assert((a == std::vector<int>{3, 4, 5, 6, 7, 8, 7, 8}));
+    a = b;
+    assert(nuo_copy_backward(a.begin(), a.begin() + 6, a.end()) == a.begin() + 2);
+    assert((a == std::vector<int>{1, 2, 1, 2, 3, 4, 5, 6}));
+
+    /* element loop for other iterators and types */
+    std::list<int> l(a.begin(), a.end());
+    std::deque<int> d(8);
+    nuo_copy(l.begin(), l.end(), d.begin());
+    assert(std::equal(d.begin(), d.end(), a.begin()));
+    std::vector<long> w(3);
+    nuo_copy_n(a.begin(), 3, w.begin());
+    assert((w == std::vector<long>{1, 2, 1}));
+    std::vector<std::string> s{"x", std::string(40, 'y'), "z"};
+    std::vector<std::string> t(3);
+    nuo_copy_backward(s.begin(), s.end(), t.end());
+    assert(s == t);
+
+    std::vector<Pod> p{{1, 0.5}, {2, 1.5}};
+    Pod q[2];
+    nuo_copy(p.cbegin(), p.cend(), q);
+    assert(q[1] == p[1]);
+}
+
+void test::Test_Nuo_Copy::test_move() {
+    std::vector<std::string> s{"a", std::string(40, 'b'), "c"};
+    std::vector<std::string> t(4);
+    nuo_move(s.begin(), s.end(), t.begin());
+    assert(t[1].size() == 40 && t[3].empty());
+    nuo_move_backward(t.begin(), t.begin() + 3, t.end());
+    assert(t[3] == "c" && t[2].size() == 40);
+
+    std::vector<int> v{1, 2, 3, 4, 5};
+    nuo_move(v.begin() + 1, v.end(), v.begin());
+    assert((v == std::vector<int>{2, 3, 4, 5, 5}));
+    nuo_move_backward(v.begin(), v.begin() + 3, v.end());
+    assert((v == std::vector<int>{2, 3, 2, 3, 4}));
+
+    std::vector<std::unique_ptr<int>> u;
+    u.push_back(std::make_unique<int>(9));
+    std::vector<std::unique_ptr<int>> u2(1);
+    nuo_move(u.begin(), u.end(), u2.begin());
+    assert(u[0] == nullptr && *u2[0] == 9);
+}
+
+void test::Test_Nuo_Copy::test_fill() {
+    std::vector<int> v(37, 5);
+    nuo_fill(v.begin(), v.end(), 0);
+    assert(std::count(v.begin(), v.end(), 0) == 37);
+    nuo_fill(v.begin() + 1, v.end(), -1);
+    assert(v[0] == 0 && v[1] == -1 && v[36] == -1);
+    /* bytes differ, element loop */
+    nuo_fill_n(v.begin(), 3, 0x01020304);
+    assert(v[2] == 0x01020304 && v[3] == -1);
+    assert(nuo_fill_n(v.begin(), -2, 7) == v.begin());
+
+    std::vector<double> d(9, 1.0);
+    nuo_fill(d.begin(), d.end(), 0);
+    assert(d[8] == 0.0);
+    nuo_fill(d.begin(), d.end(), 2.5);
+    assert(d[4] == 2.5);
+
+    char c[5];
+    nuo_fill_n(c, 5, 'q');
+    assert(memcmp(c, "qqqqq", 5) == 0);
+    std::list<std::string> l(3);
+    nuo_fill(l.begin(), l.end(), std::string("w"));
+    assert(l.back() == "w");
+    std::vector<Pod> p(4);
+    nuo_fill(p.begin(), p.end(), Pod{0, 0.0});
+    assert(p[3] == (Pod{0, 0.0}));
+}
+
+void test::Test_Nuo_Copy::test_relocate() {
+    int x = 1, y = 2;
+    alignas(Handle) unsigned char src[2 * sizeof(Handle)];
+    alignas(Handle) unsigned char dst[2 * sizeof(Handle)];
+    Handle* hs = reinterpret_cast<Handle*>(src);
+    Handle* hd = reinterpret_cast<Handle*>(dst);
+    ::new (static_cast<void*>(hs)) Handle(&x);
+    ::new (static_cast<void*>(hs + 1)) Handle(&y);
+    assert(nuo_uninitialized_relocate(hs, hs + 2, hd) == hd + 2);
+    assert(hd[0].p == &x && hd[1].p == &y);
+    std::destroy_n(hd, 2);
+
+    alignas(Tracked) unsigned char ts[3 * sizeof(Tracked)];
+    alignas(Tracked) unsigned char td[3 * sizeof(Tracked)];
+    Tracked* a = reinterpret_cast<Tracked*>(ts);
+    Tracked* b = reinterpret_cast<Tracked*>(td);
+    for (int i = 0; i < 3; i++)
+        ::new (static_cast<void*>(a + i)) Tracked(i);
+    Tracked::moves = Tracked::destroyed = 0;
+    nuo_uninitialized_relocate(a, a + 3, b);
+    assert(Tracked::moves == 3 && Tracked::destroyed == 3 && b[2].v == 2);
+    std::destroy_n(b, 3);
+}
+
+void test::Test_Nuo_Copy::test_stream() {
+    const size_t saved = nuostl::nuo_copy_stream_threshold();
+    nuostl::nuo_set_copy_stream_threshold(256);
+
+    std::mt19937 rng(41);
+    std::vector<uint8_t> src(70000);
+    for (uint8_t& c : src)
+        c = static_cast<uint8_t>(rng());
+    for_each_isa([&](unsigned) {
+        /* every head and tail length around the 64 byte alignment */
+        for (size_t off : {0, 1, 7, 63}) {
+            for (size_t n : {256, 257, 300, 1000, 4096, 65599}) {
+                std::vector<uint8_t> dst(n + 130, 0xee);
+                nuo_copy(src.begin() + static_cast<ptrdiff_t>(off),
+                         src.begin() + static_cast<ptrdiff_t>(off + n),
+                         dst.begin() + static_cast<ptrdiff_t>(off));
+                assert(memcmp(dst.data() + off, src.data() + off, n) == 0);
+                assert(dst[off + n] == 0xee && (off == 0 || dst[off - 1] == 0xee));
+            }
+        }
+        /* overlap falls back to memmove */
+        std::vector<uint32_t> v(1000);
+        for (size_t i = 0; i < v.size(); i++)
+            v[i] = static_cast<uint32_t>(i);
+        nuo_copy(v.begin() + 100, v.end(), v.begin());
+        assert(v[0] == 100 && v[899] == 999 && v[900] == 900);
+    });
+    nuostl::nuo_set_copy_stream_threshold(saved);
+}
+
+void test::Test_Nuo_Copy::test_nuo_copy() {
+    test_iterator_traits();
+    test_copy();
+    test_move();
+    test_fill();
+    test_relocate();
+    test_stream();
+}
@@ -4,7 +4,6 @@
 #include <math.h>
 
 #include <array>
-#include <execution>
 #include <forward_list>
 #include <functional>
 #include <limits>
@@ -126,6 +125,17 @@ void test::Test_Nuo_Max::test_compile_time() {
     constexpr long double lda = 1.25L, ldb = 1.24L;
     static_assert(nuostl::nuo_max(lda, ldb) == 1.25L,
                   "long double constexpr max");
+
+    /* two iterators are a range, never two values to compare */
+    int arr[3] = {5, 1, 3};
+    int* first = arr;
+    int* last = arr + 3;
+    static_assert(std::is_same_v<decltype(nuostl::nuo_max(first, last)), int>);
+    assert(nuostl::nuo_max(first, last) == 5);
+    std::vector<int> iv(arr, arr + 3);
+    auto ib = iv.begin(), ie = iv.end();
+    static_assert(std::is_same_v<decltype(nuostl::nuo_max(ib, ie)), int>);
+    assert(nuostl::nuo_max(ib, ie) == 5 && nuostl::nuo_max(ie, ie) == 0);
 }
 
 void test::Test_Nuo_Max::test_nuo_max_basic() {
@@ -252,18 +262,49 @@ void test::Test_Nuo_Max::test_nuo_max_basic() {
     assert(ru == ub);
     assert(&ru == &ub);
 
-    /* NaN behavior: comparisons are false, returns second argument */
+    /* NaN behavior: comparisons are false, returns first argument */
     double nan = std::numeric_limits<double>::quiet_NaN();
     double d0 = 0.0;
     const double& rnan1 = nuostl::nuo_max(nan, d0);
-    assert(&rnan1 == &d0);
+    assert(&rnan1 == &nan);
     const double& rnan2 = nuostl::nuo_max(d0, nan);
-    assert(&rnan2 == &nan);
+    assert(&rnan2 == &d0);
 }
 
-void test::Test_Nuo_Max::test_nuo_max_custom_compare() {}
+void test::Test_Nuo_Max::test_nuo_max_custom_compare() {
+    /* values: the second only when the first is less under comp */
+    int a = 3, b = 7, c = 3;
+    assert(&nuostl::nuo_max(a, b, nuostl::nuo_greater<>()) == &a);
+    assert(&nuostl::nuo_max(a, c, nuostl::nuo_less<>()) == &a);
+    static_assert(nuostl::nuo_max({4, 9, 2}, std::greater<int>()) == 2);
+    auto by_length = [](const std::string& x, const std::string& y) { return x.size() < y.size(); };
+    assert(nuostl::nuo_max(std::string("ccc"), std::string("a"), by_length) == "ccc");
+
+    /* ranges: known comparisons take the SIMD kernels, others the loop */
+    std::vector<int64_t> v{5, -2, 9, 4, -20, 8, 1, 0, 3};
+    assert(nuostl::nuo_max(v.begin(), v.end(), nuostl::nuo_less<>()) == 9);
+    assert(nuostl::nuo_max(v.begin(), v.end(), std::greater<int64_t>()) == -20);
+    assert(nuostl::nuo_max(v.begin(), v.end(), [](int64_t x, int64_t y) { return x % 7 < y % 7; }) == 5);
+    std::forward_list<std::string> l{"bb", "a", "ccc"};
+    assert(nuostl::nuo_max(l.begin(), l.end(), by_length) == "ccc");
+    assert(nuostl::nuo_max(v.begin(), v.begin(), nuostl::nuo_less<>()) == 0);
+}
 
-void test::Test_Nuo_Max::test_nuo_max_execution_policy() {}
+void test::Test_Nuo_Max::test_nuo_max_execution_policy() {
+    std::vector<double> v(200003);
+    for (size_t i = 0; i < v.size(); i++)
+        v[i] = static_cast<double>((i * 7919) % 100000) * 0.5;
+    v[3] = 1e9;
+    assert(nuostl::nuo_max(nuostl::nuo_seq, v.begin(), v.end()) == 1e9);
+    assert(nuostl::nuo_max(nuostl::nuo_par, v.begin(), v.end()) == 1e9);
+    assert(nuostl::nuo_max(nuostl::nuo_par.with_grain(100), v.cbegin(), v.cend()) == 1e9);
+
+    /* empty range, and a type outside the SIMD kernels */
+    assert(nuostl::nuo_max(nuostl::nuo_par, v.begin(), v.begin()) == 0.0);
+    std::vector<std::string> s(49999, "m");
+    s.emplace_back("z");
+    assert(nuostl::nuo_max(nuostl::nuo_par.with_grain(64), s.begin(), s.end()) == "z");
+}
 
 void test::Test_Nuo_Max::test_nuo_max_pair() {
     /* std::pair */
@@ -4,6 +4,7 @@
 
 #include <array>
 #include <forward_list>
+#include <functional>
 #include <limits>
 #include <list>
 #include <initializer_list>
@@ -113,6 +114,17 @@ void test::Test_Nuo_Min::test_compile_time() {
 		nuostl::nuo_min(ba, bb) == false,
 		"bool constexpr min"
 	);
+
+	/* two iterators are a range, never two values to compare */
+	int arr[3] = {5, 1, 3};
+	int* first = arr;
+	int* last = arr + 3;
+	static_assert(std::is_same_v<decltype(nuostl::nuo_min(first, last)), int>);
+	assert(nuostl::nuo_min(first, last) == 1);
+	std::vector<int> iv(arr, arr + 3);
+	auto ib = iv.begin(), ie = iv.end();
+	static_assert(std::is_same_v<decltype(nuostl::nuo_min(ib, ie)), int>);
+	assert(nuostl::nuo_min(ib, ie) == 1 && nuostl::nuo_min(ie, ie) == 0);
 }
 
 void test::Test_Nuo_Min::test_nuo_min_basic() {
@@ -209,9 +221,40 @@ void test::Test_Nuo_Min::test_nuo_min_basic() {
 	assert(&rl == &la);
 }
 
-void test::Test_Nuo_Min::test_nuo_min_custom_compare() {}
+void test::Test_Nuo_Min::test_nuo_min_custom_compare() {
+	/* values: the second only when strictly smaller under comp */
+	int a = 3, b = 7, c = 3;
+	assert(&nuostl::nuo_min(a, b, nuostl::nuo_greater<>()) == &b);
+	assert(&nuostl::nuo_min(a, c, nuostl::nuo_less<>()) == &a);
+	static_assert(nuostl::nuo_min({4, 9, 2}, std::greater<int>()) == 9);
+	auto by_length = [](const std::string& x, const std::string& y) { return x.size() < y.size(); };
+	assert(nuostl::nuo_min(std::string("ccc"), std::string("a"), by_length) == "a");
+
+	/* ranges: known comparisons take the SIMD kernels, others the loop */
+	std::vector<int> v{5, -2, 9, 4, -2, 8, 1, 0, 3};
+	assert(nuostl::nuo_min(v.begin(), v.end(), nuostl::nuo_less<>()) == -2);
+	assert(nuostl::nuo_min(v.begin(), v.end(), std::greater<int>()) == 9);
+	assert(nuostl::nuo_min(v.begin(), v.end(), [](int x, int y) { return x * x < y * y; }) == 0);
+	std::list<std::string> l{"bb", "a", "ccc"};
+	assert(nuostl::nuo_min(l.begin(), l.end(), by_length) == "a");
+	assert(nuostl::nuo_min(v.begin(), v.begin(), nuostl::nuo_less<>()) == 0);
+}
 
-void test::Test_Nuo_Min::test_nuo_min_execution_policy() {}
+void test::Test_Nuo_Min::test_nuo_min_execution_policy() {
+	std::vector<int> v(200003);
+	for (size_t i = 0; i < v.size(); i++)
+		v[i] = static_cast<int>((i * 7919) % 100000) + 5;
+	v[123457] = -3;
+	assert(nuostl::nuo_min(nuostl::nuo_seq, v.begin(), v.end()) == -3);
+	assert(nuostl::nuo_min(nuostl::nuo_par, v.begin(), v.end()) == -3);
+	assert(nuostl::nuo_min(nuostl::nuo_par.with_grain(100), v.cbegin(), v.cend()) == -3);
+
+	/* empty range, and a type outside the SIMD kernels */
+	assert(nuostl::nuo_min(nuostl::nuo_par, v.begin(), v.begin()) == 0);
+	std::vector<std::string> s(50000, "m");
+	s[777] = std::string(1, 'a');
+	assert(nuostl::nuo_min(nuostl::nuo_par.with_grain(64), s.begin(), s.end()) == "a");
+}
 
 void test::Test_Nuo_Min::test_nuo_min_pair() {
 	/* std::pair */
@@ -0,0 +1,246 @@
+#include "./core/algorithms/test_nuo_select.hpp"
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nuostl.hpp"
+#include "test.hpp"
+
+using nuostl::nuo_nth_element;
+using nuostl::nuo_partial_sort;
+using nuostl::nuo_top_k;
+
+namespace {
+    /* Ordered through operator> only */
+    struct Rank {
+        int v;
+    };
+
+    bool operator>(const Rank& a, const Rank& b) { return a.v > b.v; }
+
+    /* inputs that trip up naive pivots */
+    std::vector<std::vector<int>> shapes(size_t n, std::mt19937& rng) {
+        std::vector<std::vector<int>> r;
+        std::vector<int> v(n);
+        for (int& x : v)
+            x = static_cast<int>(rng() % 1000000);
+        r.push_back(v);
+        for (int& x : v)
+            x = static_cast<int>(rng() % 4);
+        r.push_back(v);
+        for (size_t i = 0; i < n; i++)
+            v[i] = static_cast<int>(i);
+        r.push_back(v);
+        std::reverse(v.begin(), v.end());
+        r.push_back(v);
+        for (size_t i = 0; i < n; i++)
+            v[i] = static_cast<int>(std::min(i, n - i));
+        r.push_back(v);
+        std::fill(v.begin(), v.end(), 7);
+        r.push_back(v);
+        return r;
+    }
+
+    template<typename T>
+    std::vector<T> random_values(size_t n, std::mt19937_64& rng) {
+        std::vector<T> v(n);
+        for (T& x : v) {
+            if constexpr (std::is_floating_point_v<T>)
+                x = static_cast<T>(static_cast<int64_t>(rng() % 2000001) - 1000000) / T(8);
+            else
+                x = static_cast<T>(rng());
+        }
+        return v;
+    }
+
+    /* chunks through the SIMD scan, against the reference order */
+    template<typename T>
+    void check_top_k(std::mt19937_64& rng) {
+        for (size_t n : {0u, 5u, 31u, 100u, 1000u, 20000u}) {
+            std::vector<T> v = random_values<T>(n, rng);
+            for (size_t k : {0u, 1u, 7u, 64u, 2000u}) {
+                nuo_top_k<T> top(k);
+                top.push(v.begin(), v.end());
+                std::vector<T> ref = v;
+                std::sort(ref.begin(), ref.end(), std::greater<T>());
+                ref.resize(std::min(k, n));
+                assert(top.sorted() == ref && top.size() == ref.size());
+
+                nuo_top_k<T, std::greater<>> bottom(k);
+                bottom.push(v.data(), v.data() + n);
+                ref = v;
+                std::sort(ref.begin(), ref.end());
+                ref.resize(std::min(k, n));
+                assert(bottom.sorted() == ref);
+
+                std::vector<T> w = v;
+                size_t m = std::min(k, n);
+                nuo_partial_sort(w.begin(), w.begin() + static_cast<ptrdiff_t>(m), w.end());
+                assert(std::equal(ref.begin(), ref.end(), w.begin()));
+            }
+        }
+    }
+}
+
+void test::Test_Nuo_Select::test_nth_element() {
+    std::mt19937 rng(21);
+    for (size_t n : {1u, 2u, 5u, 16u, 17u, 100u, 129u, 1000u, 20000u}) {
+        for (const std::vector<int>& shape : shapes(n, rng)) {
+            std::vector<int> sorted = shape;
+            std::sort(sorted.begin(), sorted.end());
+            for (size_t nth : {size_t(0), n / 3, n / 2, n - 1, n}) {
+                std::vector<int> v = shape;
+                nuo_nth_element(v.begin(), v.begin() + static_cast<ptrdiff_t>(nth), v.end());
+                if (nth == n) {
+                    assert(v == shape);
+                    continue;
+                }
+                assert(v[nth] == sorted[nth]);
+                for (size_t i = 0; i < nth; i++)
+                    assert(v[i] <= v[nth]);
+                for (size_t i = nth; i < n; i++)
+                    assert(v[i] >= v[nth]);
+                std::sort(v.begin(), v.end());
+                assert(v == sorted);
+            }
+        }
+    }
+
+    /* comparators, operator> only types, non-contiguous iterators */
+    std::vector<int> v(500);
+    for (int& x : v)
+        x = static_cast<int>(rng() % 1000);
+    std::vector<int> ref = v;
+    std::sort(ref.begin(), ref.end(), std::greater<int>());
+    std::deque<int> d(v.begin(), v.end());
+    nuo_nth_element(d.begin(), d.begin() + 10, d.end(), [](int a, int b) { return a > b; });
+    assert(d[10] == ref[10]);
+    std::vector<Rank> r(v.size());
+    for (size_t i = 0; i < v.size(); i++)
+        r[i].v = v[i];
+    nuo_nth_element(r.begin(), r.begin() + 250, r.end());
+    assert(r[250].v == ref[v.size() - 1 - 250]);
+
+    /* the fallback pivot has 3/10 of the range on each side */
+    for (const std::vector<int>& shape : shapes(1000, rng)) {
+        std::vector<int> w = shape;
+        auto comp = nuostl::nuo_less<>();
+        auto m = nuostl::detail::nuo_median_of_medians(w.begin(), w.end(), comp);
+        const int p = *m;
+        size_t below = 0, above = 0;
+        for (int x : w) {
+            below += x <= p;
+            above += x >= p;
+        }
+        assert(below >= 300 && above >= 300);
+    }
+}
+
+void test::Test_Nuo_Select::test_partial_sort() {
+    std::mt19937 rng(22);
+    for (size_t n : {0u, 1u, 9u, 100u, 5000u}) {
+        for (const std::vector<int>& shape : shapes(n, rng)) {
+            for (size_t k : {size_t(0), std::min<size_t>(1, n), n / 10, n / 2, n}) {
+                std::vector<int> v = shape;
+                std::vector<int> ref = shape;
+                std::sort(ref.begin(), ref.end());
+                nuo_partial_sort(v.begin(), v.begin() + static_cast<ptrdiff_t>(k), v.end());
+                assert(std::equal(v.begin(), v.begin() + static_cast<ptrdiff_t>(k), ref.begin()));
+                std::sort(v.begin(), v.end());
+                assert(v == ref);
+            }
+        }
+    }
+
+    std::vector<std::string> s{"kiwi", "fig", "apple", "date", "plum", "lime", "pear", "banana",
+                               "cherry", "grape", "melon", "mango", "peach", "lemon", "olive",
+                               "quince", "apricot"};
+    nuo_partial_sort(s.begin(), s.begin() + 2, s.end(), std::greater<>());
+    assert(s[0] == "quince" && s[1] == "plum");
+    std::deque<int> d{5, 3, 9, 1, 7, 2, 8, 6, 4, 0, 11, 10, 13, 12, 15, 14, 17, 16};
+    nuo_partial_sort(d.begin(), d.begin() + 2, d.end());
+    assert(d[0] == 0 && d[1] == 1);
+}
+
+void test::Test_Nuo_Select::test_top_k() {
+    std::mt19937_64 rng(23);
+    check_top_k<int32_t>(rng);
+    check_top_k<uint32_t>(rng);
+    check_top_k<int64_t>(rng);
+    check_top_k<uint64_t>(rng);
+    check_top_k<float>(rng);
+    check_top_k<double>(rng);
+    check_top_k<int16_t>(rng);
+
+    /* one value at a time, strings, merged states */
+    nuo_top_k<std::string> a(2), b(2);
+    for (const char* w : {"fig", "kiwi", "apple"})
+        a.push(w);
+    for (const char* w : {"plum", "date"})
+        b.push(w);
+    assert(a.full() && a.threshold() == "fig");
+    a.merge(b);
+    assert((a.sorted() == std::vector<std::string>{"plum", "kiwi"}));
+    a.clear();
+    assert(a.empty() && a.k() == 2);
+
+    /* NaN is never admitted past a full heap, as with operator< */
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> f(300, 1.0f);
+    for (size_t i = 0; i < f.size(); i += 7)
+        f[i] = nan;
+    f[299] = 5.0f;
+    f[150] = 3.0f;
+    nuo_top_k<float> t(2);
+    t.push(f.begin() + 1, f.end());
+    assert((t.sorted() == std::vector<float>{5.0f, 3.0f}));
+
+    /* operator> only */
+    std::vector<Rank> r{{3}, {9}, {1}, {7}};
+    nuo_top_k<Rank> rt(2);
+    rt.push(r.begin(), r.end());
+    assert(rt.sorted()[0].v == 9 && rt.sorted()[1].v == 7);
+}
+
+void test::Test_Nuo_Select::test_kernels() {
+    for_each_isa([&](unsigned level) {
+        std::mt19937_64 rng(level + 24);
+        std::vector<uint32_t> u(257, 10);
+        std::vector<int64_t> s(257, -10);
+        std::vector<double> d(257, 0.5);
+        for (size_t at : {size_t(0), size_t(3), size_t(31), size_t(64), size_t(200), size_t(256)}) {
+            u[at] = 0x80000000u;
+            s[at] = -11;
+            d[at] = 2.0;
+            /* the unsigned compare, not a signed one */
+            assert(nuostl::detail::nuo_find_beyond<true>(u.data(), u.size(), 10u) == at);
+            assert(nuostl::detail::nuo_find_beyond<false>(s.data(), s.size(), int64_t(-10)) == at);
+            assert(nuostl::detail::nuo_find_beyond<true>(d.data(), d.size(), 1.0) == at);
+            assert(nuostl::detail::nuo_find_beyond<true>(u.data(), at, 10u) == at);
+            u[at] = 10;
+            s[at] = -10;
+            d[at] = 0.5;
+        }
+        assert(nuostl::detail::nuo_find_beyond<true>(u.data(), u.size(), 10u) == u.size());
+        d[100] = std::numeric_limits<double>::quiet_NaN();
+        assert(nuostl::detail::nuo_find_beyond<true>(d.data(), d.size(), 0.0) == 0);
+        assert(nuostl::detail::nuo_find_beyond<true>(d.data() + 1, 200, 0.5) == 200);
+        check_top_k<float>(rng);
+    });
+}
+
+void test::Test_Nuo_Select::test_nuo_select() {
+    test_nth_element();
+    test_partial_sort();
+    test_top_k();
+    test_kernels();
+}
@@ -0,0 +1,218 @@
+#include "./core/algorithms/test_nuo_sliding_window.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_monotonic_queue;
+using nuostl::nuo_sliding_max;
+using nuostl::nuo_sliding_min;
+using nuostl::nuo_window_aggregator;
+
+namespace {
+    /* every window rescanned */
+    template<typename T, typename Compare = std::less<T>>
+    std::vector<T> rescan(const std::vector<T>& v, size_t w, Compare comp = Compare()) {
+        std::vector<T> r;
+        for (size_t i = 0; i + w <= v.size(); i++)
+            r.push_back(*std::min_element(v.begin() + static_cast<ptrdiff_t>(i),
+                                          v.begin() + static_cast<ptrdiff_t>(i + w), comp));
+        return r;
+    }
+
+    struct Concat {
+        std::string operator()(const std::string& a, const std::string& b) const { return a + b; }
+    };
+}
+
+void test::Test_Nuo_Sliding_Window::test_monotonic_queue() {
+    std::mt19937 rng(3);
+    nuo_monotonic_queue<int> q;
+    nuo_monotonic_queue<int, std::greater<int>> g;
+    std::deque<int> ref;
+    for (int step = 0; step < 20000; step++) {
+        /* drifts between nearly empty and a few hundred values */
+        bool grow = (step / 2000) % 2 == 0;
+        if (ref.empty() || rng() % 8 < (grow ? 5u : 3u)) {
+            int x = static_cast<int>(rng() % 100);
+            q.push(x);
+            g.push(x);
+            ref.push_back(x);
+        } else {
+            q.pop();
+            g.pop();
+            ref.pop_front();
+        }
+        assert(q.size() == ref.size() && g.size() == ref.size());
+        if (!ref.empty()) {
+            assert(q.top() == *std::min_element(ref.begin(), ref.end()));
+            assert(g.top() == *std::max_element(ref.begin(), ref.end()));
+        }
+    }
+    q.clear();
+    assert(q.empty());
+
+    /* among equal values the oldest is the top, also through a window */
+    auto by_key = [](const std::pair<int, char>& a, const std::pair<int, char>& b) {
+        return a.first < b.first;
+    };
+    nuo_monotonic_queue<std::pair<int, char>, decltype(by_key)> e(by_key);
+    e.push({1, 'a'});
+    e.push({1, 'b'});
+    e.push({2, 'c'});
+    assert(e.top().second == 'a');
+    e.pop();
+    assert(e.top().second == 'b');
+    e.push({0, 'd'});
+    assert(e.top().second == 'd' && e.size() == 3);
+    nuostl::nuo_sliding_window<std::pair<int, char>, decltype(by_key)> ew(2, by_key);
+    ew.push({5, 'a'});
+    ew.push({5, 'b'});
+    assert(ew.top().second == 'a');
+    ew.push({5, 'c'});
+    assert(ew.top().second == 'b');
+
+    nuostl::nuo_window_min<std::string> s(2);
+    s.push("pear");
+    s.push("apple");
+    s.push("plum");
+    assert(s.full() && s.top() == "apple");
+    s.push("quince");
+    assert(s.size() == 2 && s.top() == "plum");
+
+    nuostl::nuo_window_max<double> m(3);
+    for (double x : {1.0, 5.0, 2.0, 3.0, 4.0})
+        m.push(x);
+    assert(m.top() == 4.0 && m.window() == 3);
+
+    bool threw = false;
+    try {
+        nuostl::nuo_window_min<int> bad(0);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+}
+
+void test::Test_Nuo_Sliding_Window::test_sliding_min_max() {
+    std::mt19937 rng(5);
+    for (size_t n : {0u, 1u, 2u, 7u, 64u, 1000u}) {
+        std::vector<int> v(n);
+        for (int& x : v)
+            x = static_cast<int>(rng() % 2001) - 1000;
+        std::vector<double> d(v.begin(), v.end());
+        std::list<int> l(v.begin(), v.end());
+        for (size_t w : {1u, 2u, 3u, 5u, 8u, 63u, 64u, 999u, 1000u, 1001u}) {
+            const std::vector<int> lo = rescan(v, w);
+            const std::vector<int> hi = rescan(v, w, std::greater<int>());
+
+            /* blocks on random access arithmetic ranges */
+            std::vector<int> out(n + 1, 12345);
+            auto end = nuo_sliding_min(v.begin(), v.end(), w, out.begin());
+            assert(std::equal(lo.begin(), lo.end(), out.begin(), end));
+            end = nuo_sliding_max(v.begin(), v.end(), w, out.begin());
+            assert(std::equal(hi.begin(), hi.end(), out.begin(), end));
+            std::vector<double> dout;
+            nuo_sliding_min(d.data(), d.data() + n, w, std::back_inserter(dout));
+            assert(std::equal(lo.begin(), lo.end(), dout.begin(), dout.end()));
+
+            /* the monotonic queue on other iterators and comparators */
+            std::vector<int> lout;
+            nuo_sliding_max(l.begin(), l.end(), w, std::back_inserter(lout));
+            assert(lout == hi);
+            std::vector<int> pout;
+            nuo_sliding_min(v.begin(), v.end(), w, std::back_inserter(pout),
+                            [](int a, int b) { return a < b; });
+            assert(pout == lo);
+        }
+    }
+
+    std::vector<std::string> s{"d", "b", "c", "a", "e"};
+    std::vector<std::string> r;
+    nuo_sliding_min(s.begin(), s.end(), 2, std::back_inserter(r));
+    assert((r == std::vector<std::string>{"b", "b", "a", "a"}));
+
+    bool threw = false;
+    try {
+        nuo_sliding_min(s.begin(), s.end(), 0, r.begin());
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+}
+
+void test::Test_Nuo_Sliding_Window::test_window_aggregator() {
+    static_assert(nuo_window_aggregator<int>::invertible);
+    static_assert(nuo_window_aggregator<uint64_t, std::bit_xor<>>::invertible);
+    static_assert(!nuo_window_aggregator<double>::invertible);
+    static_assert(!nuo_window_aggregator<int, std::multiplies<>>::invertible);
+    static_assert(!nuo_window_aggregator<std::string, Concat>::invertible);
+
+    std::mt19937 rng(9);
+    auto min_op = [](int a, int b) { return std::min(a, b); };
+    nuo_window_aggregator<int> sum;
+    nuo_window_aggregator<uint64_t, std::bit_xor<>> x;
+    nuo_window_aggregator<double> dsum;
+    nuo_window_aggregator<int, decltype(min_op)> lo(min_op);
+    nuo_window_aggregator<std::string, Concat> cat;
+    std::deque<int> ref;
+    assert(sum.value() == 0 && x.value() == 0);
+    for (int step = 0; step < 20000; step++) {
+        bool grow = (step / 1500) % 2 == 0;
+        if (ref.empty() || rng() % 8 < (grow ? 5u : 3u)) {
+            /* large enough that int sums wrap */
+            int v = static_cast<int>(rng());
+            sum.push(v);
+            x.push(static_cast<uint64_t>(v));
+            dsum.push(v % 1000);
+            lo.push(v);
+            cat.push(std::string(1, static_cast<char>('a' + (v & 15))));
+            ref.push_back(v);
+        } else {
+            sum.pop();
+            x.pop();
+            dsum.pop();
+            lo.pop();
+            cat.pop();
+            ref.pop_front();
+        }
+        assert(sum.size() == ref.size() && cat.size() == ref.size());
+        uint32_t s = 0;
+        uint64_t xs = 0;
+        double ds = 0;
+        std::string c;
+        for (int v : ref) {
+            s += static_cast<uint32_t>(v);
+            xs ^= static_cast<uint64_t>(v);
+            ds += v % 1000;
+            c += static_cast<char>('a' + (v & 15));
+        }
+        assert(sum.value() == static_cast<int>(s) && x.value() == xs);
+        if (!ref.empty()) {
+            assert(dsum.value() == ds);
+            assert(lo.value() == *std::min_element(ref.begin(), ref.end()));
+            assert(cat.value() == c);
+        }
+    }
+    cat.clear();
+    sum.clear();
+    assert(cat.empty() && sum.empty() && sum.value() == 0);
+}
+
+void test::Test_Nuo_Sliding_Window::test_nuo_sliding_window() {
+    test_monotonic_queue();
+    test_sliding_min_max();
+    test_window_aggregator();
+}
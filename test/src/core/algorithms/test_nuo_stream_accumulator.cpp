@@ -0,0 +1,141 @@
+#include "./core/algorithms/test_nuo_stream_accumulator.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_stream_minmax;
+using nuostl::nuo_stream_reducer;
+
+namespace {
+    std::vector<int64_t> values(size_t n) {
+        std::vector<int64_t> v(n);
+        uint64_t x = 0x9e3779b97f4a7c15ull;
+        for (int64_t& y : v) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            y = static_cast<int64_t>(x >> 20) - (int64_t(1) << 43);
+        }
+        return v;
+    }
+
+    struct Concat {
+        std::string operator()(const std::string& a, const std::string& b) const { return a + b; }
+    };
+}
+
+void test::Test_Nuo_Stream_Accumulator::test_minmax() {
+    const std::vector<int64_t> v = values(1000);
+    nuo_stream_minmax<int64_t> a;
+    assert(a.empty() && a.count() == 0);
+    for (int64_t x : v)
+        a.push(x);
+    assert(a.count() == 1000);
+    assert(a.min() == *std::min_element(v.begin(), v.end()));
+    assert(a.max() == *std::max_element(v.begin(), v.end()));
+
+    /* chunks and single values mix */
+    nuo_stream_minmax<int64_t> b;
+    b.push(v.begin(), v.begin() + 10);
+    b.push(v[10]);
+    b.push(v.begin() + 11, v.end());
+    b.push(v.end(), v.end());
+    assert(b.count() == a.count() && b.min() == a.min() && b.max() == a.max());
+
+    /* the order is the comparator's */
+    nuo_stream_minmax<int64_t, std::greater<>> g;
+    g.push(v.begin(), v.end());
+    assert(g.min() == a.max() && g.max() == a.min());
+
+    std::istringstream in("kiwi fig apple date");
+    nuo_stream_minmax<std::string> s;
+    s.push(std::istream_iterator<std::string>(in), std::istream_iterator<std::string>());
+    assert(s.count() == 4 && s.min() == "apple" && s.max() == "kiwi");
+    s.clear();
+    assert(s.empty());
+}
+
+void test::Test_Nuo_Stream_Accumulator::test_reducer() {
+    const std::vector<int64_t> v = values(1000);
+    nuo_stream_reducer<int64_t> sum;
+    sum.push(v.begin(), v.begin() + 500);
+    sum.push(v[500]);
+    sum.push(v.begin() + 501, v.end());
+    assert(sum.count() == 1000 && sum.value() == std::accumulate(v.begin(), v.end(), int64_t(0)));
+
+    auto max_op = [](int64_t a, int64_t b) { return std::max(a, b); };
+    nuo_stream_reducer<int64_t, decltype(max_op)> hi(max_op);
+    std::list<int64_t> l(v.begin(), v.end());
+    hi.push(l.begin(), l.end());
+    assert(hi.value() == *std::max_element(v.begin(), v.end()));
+
+    /* not commutative, so order matters */
+    nuo_stream_reducer<std::string, Concat> c;
+    c.push("a");
+    std::vector<std::string> w{"b", "c"};
+    c.push(w.begin(), w.end());
+    nuo_stream_reducer<std::string, Concat> d;
+    d.push("d");
+    c.merge(d);
+    assert(c.value() == "abcd" && c.count() == 4);
+    nuo_stream_reducer<std::string, Concat> e;
+    e.merge(c);
+    e.merge(nuo_stream_reducer<std::string, Concat>());
+    assert(e.value() == "abcd" && e.count() == 4);
+}
+
+void test::Test_Nuo_Stream_Accumulator::test_merge_parallel() {
+    const std::vector<int64_t> v = values(200001);
+    using Stats = nuo_stream_minmax<int64_t>;
+    Stats all = nuostl::nuo_parallel_reduce(size_t(0), v.size(), Stats(),
+        [&](size_t b, size_t e) {
+            Stats s;
+            s.push(v.begin() + static_cast<ptrdiff_t>(b), v.begin() + static_cast<ptrdiff_t>(e));
+            return s;
+        },
+        [](Stats a, const Stats& b) {
+            a.merge(b);
+            return a;
+        },
+        1000);
+    assert(all.count() == v.size());
+    assert(all.min() == *std::min_element(v.begin(), v.end()));
+    assert(all.max() == *std::max_element(v.begin(), v.end()));
+
+    /* the merges keep the input order */
+    std::vector<std::string> words(3000);
+    for (size_t i = 0; i < words.size(); i++)
+        words[i] = std::string(1, static_cast<char>('a' + i % 26));
+    using Text = nuo_stream_reducer<std::string, Concat>;
+    Text t = nuostl::nuo_parallel_reduce(size_t(0), words.size(), Text(),
+        [&](size_t b, size_t e) {
+            Text s;
+            s.push(words.begin() + static_cast<ptrdiff_t>(b),
+                   words.begin() + static_cast<ptrdiff_t>(e));
+            return s;
+        },
+        [](Text a, const Text& b) {
+            a.merge(b);
+            return a;
+        },
+        100);
+    assert(t.count() == words.size());
+    assert(t.value() == std::accumulate(words.begin(), words.end(), std::string()));
+}
+
+void test::Test_Nuo_Stream_Accumulator::test_nuo_stream_accumulator() {
+    test_minmax();
+    test_reducer();
+    test_merge_parallel();
+}
@@ -0,0 +1,273 @@
+#include "./core/associative_containers/test_nuo_concurrent_unordered_map.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_concurrent_unordered_map;
+using nuostl::nuo_optional;
+using nuostl::detail::nuo_epoch_domain;
+
+namespace {
+    /* Counts live instances, to see retired values being freed */
+    struct Tracked {
+        static inline std::atomic<long> live{0};
+        int v;
+
+        Tracked(int x) : v(x) { live.fetch_add(1, std::memory_order_relaxed); }
+        Tracked(const Tracked& o) : v(o.v) { live.fetch_add(1, std::memory_order_relaxed); }
+        ~Tracked() { live.fetch_sub(1, std::memory_order_relaxed); }
+    };
+
+    /* Two halves that must always agree; a torn read would break that */
+    struct Twin {
+        uint64_t a;
+        uint64_t b;
+
+        explicit Twin(uint64_t x = 0) : a(x), b(~x) {}
+        bool whole() const { return b == ~a; }
+    };
+
+    /* Every hash in one shard and one bucket chain */
+    struct Flat_Hash {
+        size_t operator()(int) const { return 0; }
+    };
+}   /* namespace */
+
+void test::Test_Nuo_Concurrent_Unordered_Map::test_basic() {
+    nuo_concurrent_unordered_map<std::string, int> m;
+    assert(m.empty() && m.shard_count() == 64);
+    assert(m.insert("a", 1));
+    assert(!m.insert("a", 2));
+    assert(m.try_emplace("b", 2));
+    assert(m.size() == 2 && m.contains("a") && m.count("b") == 1 && !m.contains("c"));
+    assert(*m.find("a") == 1 && !m.find("c").has_value());
+
+    int seen = 0;
+    assert(m.visit("b", [&](const int& v) { seen = v; }) && seen == 2);
+    assert(!m.visit("c", [&](const int&) { seen = -1; }) && seen == 2);
+
+    assert(!m.insert_or_assign("a", 10));
+    assert(m.insert_or_assign("c", 3));
+    assert(*m.find("a") == 10 && m.size() == 3);
+
+    assert(m.erase("a") && !m.erase("a"));
+    assert(m.size() == 2 && !m.contains("a"));
+
+    std::map<std::string, int> all;
+    m.for_each([&](const std::string& k, const int& v) { all[k] = v; });
+    assert((all == std::map<std::string, int>{{"b", 2}, {"c", 3}}));
+
+    m.clear();
+    assert(m.empty() && !m.contains("b"));
+    assert(m.insert("b", 5) && *m.find("b") == 5);
+
+    nuo_concurrent_unordered_map<int, int> one(0);
+    assert(one.shard_count() == 1);
+    nuo_concurrent_unordered_map<int, int> odd(5);
+    assert(odd.shard_count() == 8);
+}
+
+void test::Test_Nuo_Concurrent_Unordered_Map::test_update() {
+    nuo_concurrent_unordered_map<int, int> m;
+    assert(m.upsert(1, 100, [](int& v) { v++; }));
+    assert(!m.upsert(1, 100, [](int& v) { v++; }));
+    assert(*m.find(1) == 101);
+
+    /* compute: insert, update, erase, leave absent */
+    assert(m.compute(2, [](nuo_optional<int>& v) {
+        assert(!v.has_value());
+        v = 7;
+    }));
+    assert(m.compute(2, [](nuo_optional<int>& v) { *v *= 2; }));
+    assert(*m.find(2) == 14);
+    assert(!m.compute(2, [](nuo_optional<int>& v) { v.reset(); }));
+    assert(!m.contains(2) && m.size() == 1);
+    assert(!m.compute(3, [](nuo_optional<int>&) {}));
+    assert(!m.contains(3));
+
+    /* a throwing update leaves the old value */
+    bool threw = false;
+    try {
+        m.upsert(1, 0, [](int& v) {
+            v = -1;
+            throw 1;
+        });
+    } catch (int) {
+        threw = true;
+    }
+    assert(threw && *m.find(1) == 101);
+}
+
+void test::Test_Nuo_Concurrent_Unordered_Map::test_growth() {
+    nuo_concurrent_unordered_map<int, int> m(4);
+    for (int i = 0; i < 20000; i++)
+        assert(m.insert(i, i * 3));
+    assert(m.size() == 20000);
+    for (int i = 0; i < 20000; i++)
+        assert(*m.find(i) == i * 3);
+    for (int i = 0; i < 20000; i += 2)
+        assert(m.erase(i));
+    assert(m.size() == 10000);
+    for (int i = 0; i < 20000; i++)
+        assert(m.contains(i) == (i % 2 == 1));
+
+    /* one long chain: every key collides */
+    nuo_concurrent_unordered_map<int, int, Flat_Hash> c;
+    for (int i = 0; i < 300; i++)
+        c.insert(i, i);
+    for (int i = 0; i < 300; i += 3)
+        c.erase(i);
+    for (int i = 0; i < 300; i++)
+        assert(c.contains(i) == (i % 3 != 0));
+    assert(!c.insert_or_assign(299, -1) && *c.find(299) == -1);
+}
+
+/* Erased and replaced values are freed once the epoch moves past them */
+void test::Test_Nuo_Concurrent_Unordered_Map::test_reclamation() {
+    nuo_epoch_domain& d = nuo_epoch_domain::instance();
+    for (int i = 0; i < 3; i++)
+        d.collect();
+    const long base = Tracked::live.load();
+    {
+        nuo_concurrent_unordered_map<int, Tracked> m;
+        for (int i = 0; i < 500; i++)
+            m.insert(i, Tracked(i));
+        for (int i = 0; i < 500; i++)
+            m.insert_or_assign(i, Tracked(-i));
+        for (int i = 0; i < 250; i++)
+            m.erase(i);
+        assert(d.pending() > 0);
+        for (int i = 0; i < 3; i++)
+            d.collect();
+        assert(d.pending() == 0);
+        assert(Tracked::live.load() - base == 250);
+        m.for_each([](const int& k, const Tracked& v) { assert(v.v == -k); });
+
+        /* nothing a pinned reader can reach goes away */
+        {
+            nuostl::detail::nuo_epoch_guard g;
+            m.erase(499);
+            for (int i = 0; i < 3; i++)
+                d.collect();
+            assert(d.pending() == 1);
+        }
+        for (int i = 0; i < 3; i++)
+            d.collect();
+        assert(d.pending() == 0 && Tracked::live.load() - base == 249);
+    }
+    assert(Tracked::live.load() == base);
+}
+
+/*
+ * Writers upsert, compute and erase over a small key range while readers
+ * visit, find and walk it, checking every value they see is whole. Keys
+ * from 10000 on are only ever incremented, so their totals must add up
+ * to what the writers did. Built with -DNUOSTL_SANITIZE=thread this is
+ * the ThreadSanitizer stress test.
+ */
+void test::Test_Nuo_Concurrent_Unordered_Map::test_stress() {
+    const unsigned writers = 3;
+    const unsigned readers = 3;
+    const int ops = 20000;
+    const uint64_t counters = 16;
+    nuo_concurrent_unordered_map<uint64_t, Twin> m(8);
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> bad{0};
+    std::vector<uint64_t> added(writers, 0);
+
+    std::vector<std::thread> ts;
+    for (unsigned w = 0; w < writers; w++) {
+        ts.emplace_back([&, w] {
+            std::mt19937_64 rng(500 + w);
+            for (int i = 0; i < ops; i++) {
+                uint64_t k = rng() % 300;
+                switch (rng() % 6) {
+                case 0:
+                    m.erase(k);
+                    break;
+                case 1:
+                    m.insert_or_assign(k, Twin(rng()));
+                    break;
+                case 2:
+                    m.compute(k, [&](nuo_optional<Twin>& v) {
+                        if (v.has_value() && v->a % 2 == 0)
+                            v.reset();
+                        else
+                            v = Twin(rng());
+                    });
+                    break;
+                case 3: {
+                    uint64_t c = 10000 + rng() % counters;
+                    m.upsert(c, Twin(1), [](Twin& t) { t = Twin(t.a + 1); });
+                    added[w]++;
+                    break;
+                }
+                default:
+                    m.upsert(k, Twin(k), [](Twin& t) { t = Twin(t.a * 3 + 1); });
+                    break;
+                }
+            }
+        });
+    }
+    for (unsigned r = 0; r < readers; r++) {
+        ts.emplace_back([&, r] {
+            std::mt19937_64 rng(600 + r);
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int i = 0; i < 200; i++) {
+                    uint64_t k = rng() % 300;
+                    m.visit(k, [&](const Twin& t) {
+                        if (!t.whole())
+                            bad.fetch_add(1);
+                    });
+                    nuo_optional<Twin> v = m.find(10000 + k % counters);
+                    if (v.has_value() && !v->whole())
+                        bad.fetch_add(1);
+                }
+                if (r == 0) {
+                    m.for_each([&](const uint64_t&, const Twin& t) {
+                        if (!t.whole())
+                            bad.fetch_add(1);
+                    });
+                }
+            }
+        });
+    }
+    for (unsigned w = 0; w < writers; w++)
+        ts[w].join();
+    stop.store(true);
+    for (unsigned r = 0; r < readers; r++)
+        ts[writers + r].join();
+
+    assert(bad.load() == 0);
+    uint64_t total = 0;
+    for (uint64_t c = 0; c < counters; c++) {
+        nuo_optional<Twin> v = m.find(10000 + c);
+        if (v.has_value())
+            total += v->a;
+    }
+    uint64_t want = 0;
+    for (uint64_t a : added)
+        want += a;
+    assert(total == want);
+
+    size_t n = 0;
+    m.for_each([&](const uint64_t&, const Twin&) { n++; });
+    assert(n == m.size());
+}
+
+void test::Test_Nuo_Concurrent_Unordered_Map::test_nuo_concurrent_unordered_map() {
+    test_basic();
+    test_update();
+    test_growth();
+    test_reclamation();
+    test_stress();
+}
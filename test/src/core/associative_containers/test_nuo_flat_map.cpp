@@ -0,0 +1,259 @@
+#include "./core/associative_containers/test_nuo_flat_map.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_flat_map;
+using nuostl::nuo_pair;
+using nuostl::nuo_sorted_unique;
+
+namespace {
+    template<typename Map, typename Ref>
+    bool same(const Map& m, const Ref& r) {
+        if (m.size() != r.size())
+            return false;
+        auto it = r.begin();
+        for (auto e : m) {
+            if (!(e.first == it->first) || !(e.second == it->second))
+                return false;
+            ++it;
+        }
+        return true;
+    }
+}   /* namespace */
+
+void test::Test_Nuo_Flat_Map::test_construct() {
+    nuo_flat_map<int, std::string> e;
+    assert(e.empty() && e.begin() == e.end() && e.find(3) == e.end());
+
+    nuo_flat_map<int, std::string> m = {{3, "c"}, {1, "a"}, {2, "b"}, {1, "z"}};
+    assert((m.keys() == std::vector<int>{1, 2, 3}));
+    /* the first of repeated keys stays */
+    assert((m.values() == std::vector<std::string>{"a", "b", "c"}));
+
+    std::vector<nuo_pair<int, int>> raw;
+    for (int i = 0; i < 100; i++)
+        raw.push_back(nuo_pair<int, int>((i * 37) % 100, i));
+    nuo_flat_map<int, int> a(raw.begin(), raw.end());
+    assert(a.size() == 100);
+    for (int i = 0; i < 100; i++)
+        assert(a.at((i * 37) % 100) == i);
+
+    nuo_flat_map<int, int> b(nuo_sorted_unique, a.keys(), a.values());
+    assert(b == a);
+
+    bool threw = false;
+    try {
+        nuo_flat_map<int, int> c(nuo_sorted_unique, std::vector<int>{1, 2}, std::vector<int>{1});
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+}
+
+void test::Test_Nuo_Flat_Map::test_access() {
+    nuo_flat_map<std::string, int> m;
+    m["b"] = 2;
+    m["a"] = 1;
+    m["b"] += 10;
+    assert(m.size() == 2 && m.at("b") == 12 && m["a"] == 1);
+    assert(m.begin().key() == "a");
+
+    bool threw = false;
+    try {
+        m.at("c");
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    const auto& cm = m;
+    assert(cm.at("a") == 1 && cm.find("c") == cm.end());
+    assert(cm.contains("b") && cm.count("b") == 1 && !cm.contains("c"));
+
+    /* transparent lookups */
+    nuo_flat_map<std::string, int, nuostl::nuo_less<>> t = {{"kiwi", 1}, {"pear", 2}};
+    assert(t.contains(std::string_view("kiwi")));
+    assert(t.find("pear")->second == 2);
+    assert(t.count("fig") == 0);
+    assert(t.lower_bound("l") == t.begin() + 1);
+    assert(t.erase("kiwi") == 1 && t.size() == 1);
+}
+
+void test::Test_Nuo_Flat_Map::test_iterators() {
+    nuo_flat_map<int, int> m = {{1, 10}, {2, 20}, {3, 30}, {4, 40}};
+    for (auto e : m)
+        e.second += e.first;
+    assert((m.values() == std::vector<int>{11, 22, 33, 44}));
+
+    auto it = m.begin();
+    it->second = 0;
+    assert(m.at(1) == 0);
+    assert((it + 2)->first == 3 && it[3].second == 44);
+    assert(m.end() - m.begin() == 4);
+    it += 3;
+    assert(it->first == 4 && (it--)->first == 4 && it->first == 3);
+    assert(m.begin() < it && it <= m.end() - 1);
+
+    nuo_flat_map<int, int>::const_iterator c = it;
+    assert(c == it && c->first == 3);
+
+    std::vector<int> rev;
+    for (auto r = m.rbegin(); r != m.rend(); ++r)
+        rev.push_back((*r).first);
+    assert((rev == std::vector<int>{4, 3, 2, 1}));
+
+    auto range = m.equal_range(2);
+    assert(range.second - range.first == 1 && range.first->first == 2);
+    assert(m.upper_bound(4) == m.end() && m.lower_bound(0) == m.begin());
+}
+
+void test::Test_Nuo_Flat_Map::test_insert_erase() {
+    nuo_flat_map<int, int> m;
+    std::map<int, int> r;
+    std::mt19937 rng(483);
+    for (int i = 0; i < 3000; i++) {
+        int k = static_cast<int>(rng() % 400);
+        int v = static_cast<int>(rng());
+        switch (rng() % 4) {
+        case 0:
+            assert(m.erase(k) == r.erase(k));
+            break;
+        case 1: {
+            auto res = m.insert(nuo_pair<int, int>(k, v));
+            assert(res.second == r.insert({k, v}).second);
+            assert(res.first->first == k && res.first->second == r[k]);
+            break;
+        }
+        case 2: {
+            auto res = m.insert_or_assign(k, v);
+            assert(res.second == r.insert_or_assign(k, v).second && res.first->second == v);
+            break;
+        }
+        default: {
+            auto res = m.try_emplace(k, v);
+            assert(res.second == r.try_emplace(k, v).second && res.first->second == r[k]);
+            break;
+        }
+        }
+    }
+    assert(same(m, r));
+
+    auto it = m.erase(m.begin() + 1);
+    r.erase(std::next(r.begin()));
+    assert(it == m.begin() + 1);
+    m.erase(m.begin() + 2, m.begin() + 12);
+    r.erase(std::next(r.begin(), 2), std::next(r.begin(), 12));
+    assert(same(m, r));
+
+    auto res = m.emplace(1000, 7);
+    assert(res.second && res.first->second == 7 && res.first + 1 == m.end());
+
+    m.clear();
+    assert(m.empty() && m.values().empty());
+}
+
+/* Batches against std::map: present keys keep their value, as in std::map::insert */
+void test::Test_Nuo_Flat_Map::test_batch_insert() {
+    std::mt19937 rng(484);
+    for (int round = 0; round < 50; round++) {
+        nuo_flat_map<uint32_t, std::string> m;
+        std::map<uint32_t, std::string> r;
+        const uint32_t range = 1 + rng() % 2000;
+        for (int b = 0; b < 6; b++) {
+            std::vector<nuo_pair<uint32_t, std::string>> batch(rng() % 500);
+            for (auto& p : batch) {
+                p.first = rng() % range;
+                p.second = std::to_string(rng());
+            }
+            m.insert(batch.begin(), batch.end());
+            /* std::map keeps the first of repeats in a range as well */
+            for (auto& p : batch)
+                r.insert({p.first, p.second});
+            assert(same(m, r));
+        }
+    }
+
+    nuo_flat_map<int, int> m = {{1, 1}, {5, 5}};
+    m.insert({{3, 3}, {5, 50}, {9, 9}});
+    assert((m.keys() == std::vector<int>{1, 3, 5, 9}));
+    assert((m.values() == std::vector<int>{1, 3, 5, 9}));
+
+    std::vector<nuo_pair<int, int>> sorted = {{0, 0}, {4, 4}};
+    m.insert(nuo_sorted_unique, sorted.begin(), sorted.end());
+    assert((m.keys() == std::vector<int>{0, 1, 3, 4, 5, 9}));
+    assert((m.values() == std::vector<int>{0, 1, 3, 4, 5, 9}));
+}
+
+void test::Test_Nuo_Flat_Map::test_move_only() {
+    nuo_flat_map<int, std::unique_ptr<int>> m;
+    m.try_emplace(2, std::make_unique<int>(2));
+    m[1] = std::make_unique<int>(1);
+    m.insert_or_assign(3, std::make_unique<int>(3));
+
+    const int keys[] = {6, 0, 4, 2};
+    std::vector<nuo_pair<int, std::unique_ptr<int>>> batch(4);
+    for (size_t i = 0; i < batch.size(); i++) {
+        batch[i].first = keys[i];
+        batch[i].second = std::make_unique<int>(keys[i] * 10);
+    }
+    m.insert(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+    assert((m.keys() == std::vector<int>{0, 1, 2, 3, 4, 6}));
+    assert(*m.at(0) == 0 && *m.at(1) == 1 && *m.at(2) == 2 && *m.at(4) == 40 && *m.at(6) == 60);
+    m.erase(2);
+    assert(*m.find(3)->second == 3 && m.size() == 5);
+}
+
+void test::Test_Nuo_Flat_Map::test_batch() {
+    nuo_flat_map<int, int> m;
+    for (int i = 0; i < 5000; i++)
+        m[i * 3] = i;
+    std::vector<int> q;
+    for (int k = -5; k < 200; k++)
+        q.push_back(k * 7);
+
+    std::vector<nuo_pair<size_t, nuo_flat_map<int, int>::iterator>> out(q.size());
+    auto hits = m.find_batch(q, out);
+    size_t h = 0;
+    for (size_t j = 0; j < q.size(); j++) {
+        if (q[j] < 0 || q[j] % 3 != 0 || q[j] >= 15000)
+            continue;
+        assert(hits[h].first == j && hits[h].second->first == q[j]);
+        hits[h].second->second = -1;
+        h++;
+    }
+    assert(h == hits.size());
+    assert(m.at(21) == -1 && m.at(3) == 1);
+
+    const auto& cm = m;
+    std::vector<nuo_pair<size_t, nuo_flat_map<int, int>::const_iterator>> cout(q.size());
+    assert(cm.find_batch(q, cout).size() == h);
+
+    std::unique_ptr<bool[]> f(new bool[q.size()]);
+    assert(cm.contains_batch(q, std::span<bool>(f.get(), q.size())) == h);
+    for (size_t j = 0; j < q.size(); j++)
+        assert(f[j] == cm.contains(q[j]));
+}
+
+void test::Test_Nuo_Flat_Map::test_nuo_flat_map() {
+    test_construct();
+    test_access();
+    test_iterators();
+    test_insert_erase();
+    test_batch_insert();
+    test_move_only();
+    test_batch();
+}
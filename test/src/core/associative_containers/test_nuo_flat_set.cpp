@@ -0,0 +1,185 @@
+#include "./core/associative_containers/test_nuo_flat_set.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_flat_set;
+using nuostl::nuo_sorted_unique;
+
+namespace {
+    template<typename Set, typename Ref>
+    bool same(const Set& s, const Ref& r) {
+        return s.size() == r.size() && std::equal(s.begin(), s.end(), r.begin());
+    }
+}   /* namespace */
+
+void test::Test_Nuo_Flat_Set::test_construct() {
+    nuo_flat_set<int> e;
+    assert(e.empty() && e.begin() == e.end());
+    assert(e.find(1) == e.end());
+
+    nuo_flat_set<int> s = {5, 1, 4, 1, 5, 9, 2, 6};
+    const std::vector<int> want = {1, 2, 4, 5, 6, 9};
+    assert(s.keys() == want);
+
+    std::vector<int> raw = {3, 3, 2, 1};
+    nuo_flat_set<int> a(raw.begin(), raw.end());
+    assert((a.keys() == std::vector<int>{1, 2, 3}));
+
+    nuo_flat_set<int> b(nuo_sorted_unique, want);
+    assert(b == s);
+
+    nuo_flat_set<int, std::greater<int>> d = {1, 3, 2};
+    assert((d.keys() == std::vector<int>{3, 2, 1}));
+    assert(d.lower_bound(2) == d.begin() + 1);
+
+    /* repeats keep the first of equal keys */
+    struct Lt {
+        bool operator()(const std::string& x, const std::string& y) const {
+            return x.size() < y.size();
+        }
+    };
+    nuo_flat_set<std::string, Lt> l = {"bb", "a", "cc", "b"};
+    assert(l.size() == 2 && *l.begin() == "a" && *(l.begin() + 1) == "bb");
+}
+
+void test::Test_Nuo_Flat_Set::test_insert_erase() {
+    nuo_flat_set<int> s;
+    std::set<int> r;
+    std::mt19937 rng(481);
+    for (int i = 0; i < 2000; i++) {
+        int x = static_cast<int>(rng() % 500);
+        if (rng() % 3 == 0) {
+            assert(s.erase(x) == r.erase(x));
+        } else {
+            auto res = s.insert(x);
+            assert(res.second == r.insert(x).second);
+            assert(*res.first == x);
+        }
+    }
+    assert(same(s, r));
+    for (int x = -1; x <= 500; x++) {
+        assert(s.contains(x) == (r.count(x) == 1));
+        assert(s.lower_bound(x) - s.begin() == std::distance(r.begin(), r.lower_bound(x)));
+        assert(s.upper_bound(x) - s.begin() == std::distance(r.begin(), r.upper_bound(x)));
+    }
+
+    auto it = s.erase(s.begin());
+    assert(it == s.begin());
+    r.erase(r.begin());
+    s.erase(s.begin(), s.begin() + 10);
+    for (int i = 0; i < 10; i++)
+        r.erase(r.begin());
+    assert(same(s, r));
+
+    auto res = s.emplace(1000);
+    assert(res.second && *res.first == 1000 && res.first + 1 == s.end());
+
+    std::vector<int> out = std::move(s).extract();
+    assert(s.empty() && out.size() == r.size() + 1);
+}
+
+/* Batches of every shape against std::set */
+void test::Test_Nuo_Flat_Set::test_batch_insert() {
+    std::mt19937 rng(482);
+    for (int round = 0; round < 60; round++) {
+        nuo_flat_set<uint32_t> s;
+        std::set<uint32_t> r;
+        const uint32_t range = 1 + rng() % 3000;
+        for (int b = 0; b < 6; b++) {
+            std::vector<uint32_t> batch(rng() % (b == 0 ? 4 : 700));
+            const uint32_t base = (round % 3 == 0) ? r.size() * 2 : 0;
+            for (uint32_t& x : batch)
+                x = base + rng() % range;
+            s.insert(batch.begin(), batch.end());
+            r.insert(batch.begin(), batch.end());
+            assert(same(s, r));
+        }
+    }
+
+    /* above the current maximum: an append */
+    nuo_flat_set<int> s = {1, 2, 3};
+    std::vector<int> hi = {7, 5, 6};
+    s.insert(hi.begin(), hi.end());
+    assert((s.keys() == std::vector<int>{1, 2, 3, 5, 6, 7}));
+
+    std::vector<int> sorted = {0, 4, 8};
+    s.insert(nuo_sorted_unique, sorted.begin(), sorted.end());
+    assert((s.keys() == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8}));
+
+    s.insert({8, 8, 9});
+    assert(s.size() == 10 && *s.rbegin() == 9);
+}
+
+void test::Test_Nuo_Flat_Set::test_transparent() {
+    nuo_flat_set<std::string, nuostl::nuo_less<>> s = {"pear", "apple", "kiwi"};
+    std::string_view k = "kiwi";
+    assert(s.contains(k) && s.count(k) == 1);
+    assert(s.find("apple") == s.begin());
+    assert(s.lower_bound("b") == s.begin() + 1);
+    assert(s.upper_bound("kiwi") == s.begin() + 2);
+    auto range = s.equal_range("kiwi");
+    assert(range.second - range.first == 1);
+    assert(s.erase("kiwi") == 1 && !s.contains("kiwi"));
+    assert(s.erase(std::string_view("fig")) == 0);
+}
+
+void test::Test_Nuo_Flat_Set::test_batch() {
+    using It = nuo_flat_set<uint64_t>::iterator;
+    std::mt19937_64 rng(491);
+    std::vector<uint64_t> keys(20000);
+    for (uint64_t& k : keys)
+        k = rng() % 100000;
+    const nuo_flat_set<uint64_t> s(keys.begin(), keys.end());
+
+    std::vector<uint64_t> q(250);
+    for (uint64_t& k : q)
+        k = rng() % 100000;
+    std::vector<nuostl::nuo_pair<size_t, It>> out(q.size());
+    auto hits = s.find_batch(q, out);
+    size_t h = 0;
+    for (size_t j = 0; j < q.size(); j++) {
+        if (s.find(q[j]) == s.end())
+            continue;
+        assert(hits[h].first == j && *hits[h].second == q[j]);
+        h++;
+    }
+    assert(h == hits.size() && h > 0 && h < q.size());
+
+    bool found[250];
+    assert(s.contains_batch(q, found) == h);
+    for (size_t j = 0; j < q.size(); j++)
+        assert(found[j] == s.contains(q[j]));
+
+    bool threw = false;
+    try {
+        s.contains_batch(q, std::span<bool>(found, 10));
+    } catch (const std::length_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    const nuo_flat_set<uint64_t> e;
+    assert(e.find_batch(q, out).empty() && e.contains_batch(q, found) == 0);
+}
+
+void test::Test_Nuo_Flat_Set::test_nuo_flat_set() {
+    test_construct();
+    test_insert_erase();
+    test_batch_insert();
+    test_transparent();
+    test_batch();
+}
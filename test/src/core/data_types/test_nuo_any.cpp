@@ -0,0 +1,180 @@
+#include "./core/data_types/test_nuo_any.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <any>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_any;
+using nuostl::nuo_any_cast;
+using nuostl::nuo_basic_any;
+using nuostl::nuo_make_any;
+
+namespace {
+    struct Pod24 {
+        int64_t a, b, c;
+    };
+
+    struct Pod32 {
+        int64_t a, b, c, d;
+    };
+
+    /* Counts live instances to catch leaks and double destruction */
+    struct Counted {
+        static inline int live = 0;
+        int v;
+
+        explicit Counted(int x) : v(x) { live++; }
+        Counted(const Counted& o) : v(o.v) { live++; }
+        Counted(Counted&& o) noexcept : v(o.v) { live++; }
+        ~Counted() { live--; }
+    };
+
+    struct Big_Counted {
+        Counted c;
+        char pad[64];
+
+        explicit Big_Counted(int x) : c(x), pad() {}
+    };
+
+    /* Fits the buffer but moving may throw, so it goes to the heap */
+    struct Throwing_Move {
+        int v;
+
+        explicit Throwing_Move(int x) : v(x) {}
+        Throwing_Move(const Throwing_Move&) = default;
+        Throwing_Move(Throwing_Move&& o) noexcept(false) : v(o.v) {}
+    };
+
+    template<typename F>
+    bool throws_cast(F&& f) {
+        try {
+            f();
+        } catch (const std::bad_any_cast&) {
+            return true;
+        }
+        return false;
+    }
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Any::test_nuo_any() {
+    test_storage();
+    test_constructor();
+    test_assign();
+    test_cast();
+}
+
+/* ------------------------------------------------- */
+/* what stays in the buffer */
+void test::Test_Nuo_Any::test_storage() {
+    static_assert(nuo_any::capacity == 3 * sizeof(void*));
+    static_assert(sizeof(nuo_any) == 32);
+    static_assert(nuo_basic_any<64>::capacity == 64);
+
+    assert(nuo_any(1).is_inline());
+    assert(nuo_any(Pod24{1, 2, 3}).is_inline());
+    assert(!nuo_any(Pod32{1, 2, 3, 4}).is_inline());
+    assert(nuo_basic_any<32>(Pod32{1, 2, 3, 4}).is_inline());
+    assert(nuo_any(std::make_shared<int>(1)).is_inline());
+    assert(!nuo_any(Throwing_Move(1)).is_inline());
+    assert(!nuo_any().is_inline());
+
+    std::string small = "short";
+    nuo_basic_any<sizeof(std::string)> s(small);
+    assert(s.is_inline() && nuo_any_cast<std::string&>(s) == "short");
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Any::test_constructor() {
+    nuo_any e;
+    assert(!e.has_value() && e.type() == typeid(void));
+
+    nuo_any i = 42;
+    assert(i.has_value() && i.type() == typeid(int));
+    nuo_any s(std::in_place_type<std::string>, 3, 'z');
+    assert(nuo_any_cast<std::string>(s) == "zzz");
+    nuo_any m = nuo_make_any<std::vector<int>>(4, 1);
+    assert(nuo_any_cast<const std::vector<int>&>(m).size() == 4);
+
+    /* copies are independent, for inline and heap payloads */
+    nuo_any a = Pod24{1, 2, 3};
+    nuo_any b = a;
+    nuo_any_cast<Pod24&>(a).a = 10;
+    assert(nuo_any_cast<Pod24>(b).a == 1);
+    nuo_any c = Pod32{1, 2, 3, 4};
+    nuo_any d = c;
+    nuo_any_cast<Pod32&>(c).d = 40;
+    assert(nuo_any_cast<Pod32>(d).d == 4);
+
+    /* moves leave the source empty */
+    nuo_any f = std::move(d);
+    assert(!d.has_value() && nuo_any_cast<Pod32>(f).c == 3);
+    nuo_any g = std::move(a);
+    assert(!a.has_value() && nuo_any_cast<Pod24>(g).a == 10);
+
+    {
+        nuo_any x = Counted(1);
+        nuo_any y = x;
+        nuo_any z = std::move(x);
+        nuo_any h(std::in_place_type<Big_Counted>, 2);
+        nuo_any k = h;
+        assert(!h.is_inline() && Counted::live == 4);
+    }
+    assert(Counted::live == 0);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Any::test_assign() {
+    {
+        nuo_any a = 1;
+        a = std::string(100, 'x');
+        assert(nuo_any_cast<std::string&>(a).size() == 100);
+        a = Counted(5);
+        a = a;
+        assert(nuo_any_cast<Counted&>(a).v == 5 && Counted::live == 1);
+        nuo_any b = Pod32{};
+        a = b;
+        assert(Counted::live == 0 && a.type() == typeid(Pod32));
+        a.emplace<Counted>(6);
+        b = std::move(a);
+        assert(!a.has_value() && nuo_any_cast<Counted&>(b).v == 6);
+
+        nuo_any c = 2.5;
+        swap(b, c);
+        assert(nuo_any_cast<double>(b) == 2.5 && nuo_any_cast<Counted&>(c).v == 6);
+        c.reset();
+        assert(!c.has_value() && Counted::live == 0);
+    }
+    assert(Counted::live == 0);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Any::test_cast() {
+    nuo_any a = 7;
+    assert(nuo_any_cast<int>(&a) && *nuo_any_cast<int>(&a) == 7);
+    assert(!nuo_any_cast<long>(&a));
+    assert(!nuo_any_cast<int>(static_cast<nuo_any*>(nullptr)));
+    assert(throws_cast([&] { nuo_any_cast<double>(a); }));
+    assert(throws_cast([] { nuo_any_cast<int>(nuo_any()); }));
+
+    const nuo_any& ca = a;
+    assert(*nuo_any_cast<const int>(&ca) == 7);
+    nuo_any_cast<int&>(a) = 8;
+    assert(nuo_any_cast<int>(ca) == 8);
+
+    nuo_any s = std::string("moved out");
+    std::string out = nuo_any_cast<std::string>(std::move(s));
+    assert(out == "moved out");
+
+    /* const char arrays decay */
+    nuo_any p = "literal";
+    assert(p.type() == typeid(const char*));
+}
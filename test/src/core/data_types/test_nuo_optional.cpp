@@ -0,0 +1,227 @@
+#include "./core/data_types/test_nuo_optional.hpp"
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "nuostl.hpp"
+
+using nuostl::idx_t;
+using nuostl::nuo_idx_niche;
+using nuostl::nuo_make_optional;
+using nuostl::nuo_nan_niche;
+using nuostl::nuo_optional;
+using nuostl::nuo_ptr_niche;
+using nuostl::nuo_sentinel_niche;
+
+namespace {
+    /* A handle type whose zero value means "no handle" */
+    struct Handle {
+        uint32_t id;
+        bool operator==(const Handle&) const = default;
+    };
+
+    struct Handle_Niche : nuostl::nuo_niche_bits<Handle, uint32_t, 0> {};
+
+    template<typename F>
+    bool throws_access(F&& f) {
+        try {
+            f();
+        } catch (const std::bad_optional_access&) {
+            return true;
+        }
+        return false;
+    }
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Optional::test_nuo_optional() {
+    test_layout();
+    test_constructor();
+    test_access();
+    test_assign();
+    test_compare();
+}
+
+/* ------------------------------------------------- */
+/* niche types take no room for the flag */
+void test::Test_Nuo_Optional::test_layout() {
+    static_assert(sizeof(std::optional<double>) == 16);
+    static_assert(sizeof(nuo_optional<double, nuo_nan_niche<double>>) == sizeof(double));
+    static_assert(sizeof(nuo_optional<float, nuo_nan_niche<float>>) == sizeof(float));
+    static_assert(sizeof(nuo_optional<int*, nuo_ptr_niche<int*>>) == sizeof(int*));
+    static_assert(sizeof(nuo_optional<const char*, nuo_ptr_niche<const char*>>) == sizeof(char*));
+    static_assert(sizeof(nuo_optional<bool>) == 1);
+    static_assert(sizeof(nuo_optional<idx_t, nuo_idx_niche>) == sizeof(idx_t));
+    static_assert(sizeof(nuo_optional<int16_t, nuo_sentinel_niche<int16_t, INT16_MIN>>) == 2);
+    static_assert(sizeof(nuo_optional<Handle, Handle_Niche>) == sizeof(Handle));
+
+    /* without a niche the flag follows the value */
+    static_assert(sizeof(nuo_optional<int>) == 8);
+    static_assert(sizeof(nuo_optional<idx_t>) == 2 * sizeof(idx_t));
+    static_assert(sizeof(nuo_optional<char>) == 2);
+    static_assert(sizeof(nuo_optional<double>) == 2 * sizeof(double));
+    static_assert(sizeof(nuo_optional<float>) == 2 * sizeof(float));
+    static_assert(sizeof(nuo_optional<int*>) == 2 * sizeof(int*));
+
+    static_assert(std::is_trivially_copyable_v<nuo_optional<double>>);
+    static_assert(std::is_trivially_copyable_v<nuo_optional<int>>);
+    static_assert(!std::is_trivially_copyable_v<nuo_optional<std::string>>);
+
+    /* ordinary NaNs, null and false are values, not the empty state */
+    nuo_optional<double> d = std::numeric_limits<double>::quiet_NaN();
+    assert(d.has_value() && isnan(*d));
+    nuo_optional<float> f = -std::numeric_limits<float>::quiet_NaN();
+    assert(f.has_value());
+    nuo_optional<double> inf = -std::numeric_limits<double>::infinity();
+    assert(inf.has_value() && isinf(*inf));
+    nuo_optional<int*> p = nullptr;
+    assert(p.has_value() && *p == nullptr);
+    nuo_optional<bool> b = false;
+    assert(b.has_value() && !*b);
+    nuo_optional<idx_t, nuo_idx_niche> i = idx_t(0);
+    assert(i.has_value() && *i == 0);
+    i = std::numeric_limits<idx_t>::max() - 1;
+    assert(i.has_value());
+    nuo_optional<double, nuo_nan_niche<double>> nd = std::numeric_limits<double>::quiet_NaN();
+    assert(nd.has_value());
+    nd.reset();
+    assert(!nd);
+    nuo_optional<int*, nuo_ptr_niche<int*>> np = nullptr;
+    assert(np.has_value());
+
+    /* by default every bit pattern of a pointer or a double is a value */
+    nuo_optional<void*> all_ones = reinterpret_cast<void*>(-1);
+    assert(all_ones.has_value() && *all_ones == reinterpret_cast<void*>(-1));
+    double bits;
+    uint64_t pattern = 0xfff4deadbeefbad1ull;
+    memcpy(&bits, &pattern, sizeof(bits));
+    nuo_optional<double> payload = bits;
+    assert(payload.has_value() && memcmp(&*payload, &pattern, sizeof(bits)) == 0);
+    float fbits;
+    uint32_t fpattern = 0xffbadbadu;
+    memcpy(&fbits, &fpattern, sizeof(fbits));
+    assert(nuo_optional<float>(fbits).has_value());
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Optional::test_constructor() {
+    nuo_optional<double> a;
+    nuo_optional<double> b = std::nullopt;
+    assert(!a && !b.has_value() && a == std::nullopt);
+
+    nuo_optional<std::string> s("text");
+    assert(s && *s == "text" && s->size() == 4);
+    nuo_optional<std::string> t(std::in_place, 3, 'x');
+    assert(*t == "xxx");
+
+    nuo_optional o(2.5);
+    static_assert(std::is_same_v<decltype(o), nuo_optional<double>>);
+    auto m = nuo_make_optional(std::string("m"));
+    assert(*m == "m");
+
+    /* copies carry the empty state too */
+    nuo_optional<double> c = a;
+    assert(!c);
+    nuo_optional<std::string> u = s;
+    assert(*u == "text" && *s == "text");
+    nuo_optional<std::string> v = std::move(u);
+    assert(*v == "text");
+
+    nuo_optional<std::unique_ptr<int>> w(std::make_unique<int>(3));
+    nuo_optional<std::unique_ptr<int>> x(std::move(w));
+    assert(**x == 3);
+    static_assert(!std::is_copy_constructible_v<nuo_optional<std::unique_ptr<int>>>);
+
+    nuo_optional<Handle, Handle_Niche> h;
+    assert(!h);
+    h = Handle{7};
+    assert(h && h->id == 7);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Optional::test_access() {
+    nuo_optional<int*> p;
+    assert(throws_access([&] { p.value(); }));
+    int x = 4;
+    p = &x;
+    assert(p.value() == &x && **p == 4);
+
+    nuo_optional<double> d;
+    assert(d.value_or(1.5) == 1.5);
+    d = 2.0;
+    assert(d.value_or(1.5) == 2.0);
+
+    nuo_optional<std::string> s("abc");
+    std::string moved = std::move(s).value();
+    assert(moved == "abc");
+
+    auto len = nuo_optional<std::string>("four").transform([](const std::string& v) {
+        return v.size();
+    });
+    assert(len && *len == 4);
+    auto none = nuo_optional<std::string>().transform([](const std::string& v) {
+        return v.size();
+    });
+    assert(!none);
+    auto half = nuo_optional<int>(8).and_then([](int v) {
+        return v % 2 ? nuo_optional<int>() : nuo_optional<int>(v / 2);
+    });
+    assert(half == 4);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Optional::test_assign() {
+    nuo_optional<std::string> s;
+    s = "first";
+    assert(*s == "first");
+    s = std::string("second");
+    assert(*s == "second");
+    s = std::nullopt;
+    assert(!s);
+    s.emplace(2, 'y');
+    assert(*s == "yy");
+    s.reset();
+    assert(!s);
+
+    nuo_optional<std::string> a("a"), b;
+    swap(a, b);
+    assert(!a && *b == "a");
+    a = b;
+    assert(*a == "a");
+    b.reset();
+    a = b;
+    assert(!a);
+
+    nuo_optional<double> x(1.0), y;
+    x.swap(y);
+    assert(!x && *y == 1.0);
+    x = y;
+    assert(*x == 1.0);
+    x.reset();
+    assert(!x.has_value());
+    x.emplace(3.0);
+    assert(*x == 3.0);
+}
+
+/* ------------------------------------------------- */
+/* empty orders before every value */
+void test::Test_Nuo_Optional::test_compare() {
+    nuo_optional<int> e, one(1), two(2);
+    assert(e < one && one < two && !(two < one));
+    assert(e == e && one == one && one != two && e != one);
+    assert(one == 1 && two != 1 && e != 1);
+    assert((e <=> std::nullopt) == 0 && (one <=> std::nullopt) > 0);
+
+    nuo_optional<double> d(1.0), n;
+    assert(n < d && d == 1.0);
+    assert((nuo_optional<double>(std::nan("")) <=> d) == std::partial_ordering::unordered);
+}
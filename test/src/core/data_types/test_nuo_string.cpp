@@ -0,0 +1,415 @@
+#include "./core/data_types/test_nuo_string.hpp"
+
+#include <assert.h>
+#include <string.h>
+
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "nuostl.hpp"
+#include "test.hpp"
+
+using nuostl::nuo_string;
+
+namespace {
+    /* std::allocator wrapper counting live allocations */
+    template<typename T>
+    struct CountingAlloc {
+        using value_type = T;
+        static inline int live = 0;
+
+        CountingAlloc() = default;
+        template<typename U>
+        CountingAlloc(const CountingAlloc<U>&) {}
+
+        T* allocate(size_t n) {
+            live++;
+            return std::allocator<T>().allocate(n);
+        }
+        void deallocate(T* p, size_t n) {
+            live--;
+            std::allocator<T>().deallocate(p, n);
+        }
+        friend bool operator==(const CountingAlloc&, const CountingAlloc&) {
+            return true;
+        }
+    };
+
+    /* stateful allocator propagated on copy assignment, live buffers per id */
+    template<typename T>
+    struct TaggedAlloc {
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        static inline int live[3] = {};
+        int id = 0;
+
+        explicit TaggedAlloc(int i) : id(i) {}
+        template<typename U>
+        TaggedAlloc(const TaggedAlloc<U>& o) : id(o.id) {}
+
+        T* allocate(size_t n) {
+            live[id]++;
+            return std::allocator<T>().allocate(n);
+        }
+        void deallocate(T* p, size_t n) {
+            live[id]--;
+            std::allocator<T>().deallocate(p, n);
+        }
+        friend bool operator==(const TaggedAlloc& a, const TaggedAlloc& b) {
+            return a.id == b.id;
+        }
+    };
+
+    std::string random_text(std::mt19937_64& rng, size_t n) {
+        std::string s(n, 'a');
+        for (auto& c : s)
+            c = static_cast<char>('a' + rng() % 4);
+        return s;
+    }
+}
+
+/* ------------------------------------------------- */
+/* Test nuo string */
+void test::Test_Nuo_String::test_nuo_string() {
+    test_compile_time();
+
+    test_constructor();
+    test_copy_constructor();
+    test_sso();
+    test_modifiers();
+    test_find();
+    test_compare();
+    test_allocator();
+    test_simd_paths();
+}
+
+/* ------------------------------------------------- */
+/* Test compile time */
+void test::Test_Nuo_String::test_compile_time() {
+    static_assert(sizeof(nuo_string) == 3 * sizeof(void*),
+                  "nuo_string is three words");
+    static_assert(nuo_string::sso_capacity == 23,
+                  "23 characters fit inline on 64-bit");
+    static_assert(std::is_nothrow_move_constructible_v<nuo_string>,
+                  "move must not throw");
+    static_assert(std::is_nothrow_move_assignable_v<nuo_string>,
+                  "move assignment must not throw");
+    static_assert(!std::is_constructible_v<nuo_string, std::nullptr_t>,
+                  "construction from nullptr is rejected");
+}
+
+/* ------------------------------------------------- */
+/* Test constructors */
+void test::Test_Nuo_String::test_constructor() {
+    nuo_string s0;
+    assert(s0.empty() && s0.size() == 0);
+    assert(strcmp(s0.c_str(), "") == 0);
+
+    nuo_string s1("hello");
+    assert(s1.size() == 5 && s1 == "hello");
+
+    nuo_string s2("hello world", 5);
+    assert(s2 == "hello");
+
+    nuo_string s3(4, 'x');
+    assert(s3 == "xxxx");
+
+    nuo_string s4(std::string_view("view"));
+    assert(s4 == "view");
+
+    nuo_string s5{'a', 'b', 'c'};
+    assert(s5 == "abc");
+
+    /* long construction */
+    std::string big(1000, 'q');
+    nuo_string s6(big.c_str());
+    assert(s6.size() == 1000 && !s6.is_inline());
+    assert(std::string_view(s6) == big);
+    assert(s6.c_str()[1000] == '\0');
+}
+
+/* ------------------------------------------------- */
+/* Test copy and move constructors */
+void test::Test_Nuo_String::test_copy_constructor() {
+    nuo_string a("short");
+    nuo_string b(a);
+    assert(b == a && b.data() != a.data());
+
+    nuo_string la(std::string(100, 'z').c_str());
+    nuo_string lb(la);
+    assert(lb == la && lb.data() != la.data());
+
+    /* move steals the heap buffer */
+    const char* p = la.data();
+    nuo_string lc(std::move(la));
+    assert(lc.data() == p);
+    assert(la.empty() && la.is_inline());
+
+    /* assignment between representations */
+    nuo_string x("tiny");
+    x = lc;
+    assert(x == lc);
+    x = "again tiny";
+    assert(x == "again tiny");
+    x = std::move(lc);
+    assert(x.size() == 100 && lc.empty());
+
+    /* self assignment */
+    nuo_string& xr = x;
+    x = xr;
+    assert(x.size() == 100);
+}
+
+/* ------------------------------------------------- */
+/* Test small string optimization boundaries */
+void test::Test_Nuo_String::test_sso() {
+    for (size_t n = 0; n <= 30; n++) {
+        nuo_string s(n, 'k');
+        assert(s.size() == n);
+        assert(s.is_inline() == (n <= nuo_string::sso_capacity));
+        assert(s.c_str()[n] == '\0');
+        assert(strlen(s.c_str()) == n);
+    }
+
+    /* exactly 23 chars: the size byte doubles as '\0' */
+    nuo_string full("0123456789abcdefghijklm");
+    assert(full.size() == 23 && full.is_inline());
+    assert(full.capacity() == 23);
+    full.push_back('n');
+    assert(full.size() == 24 && !full.is_inline());
+    assert(full == "0123456789abcdefghijklmn");
+
+    /* shrink back to inline */
+    full.resize(3);
+    full.shrink_to_fit();
+    assert(full.is_inline() && full == "012");
+}
+
+/* ------------------------------------------------- */
+/* Test modifiers */
+void test::Test_Nuo_String::test_modifiers() {
+    nuo_string s;
+    std::string ref;
+    for (int i = 0; i < 500; i++) {
+        char c = static_cast<char>('a' + i % 26);
+        s.push_back(c);
+        ref.push_back(c);
+        assert(s.size() == ref.size());
+    }
+    assert(std::string_view(s) == ref);
+    /* geometric growth */
+    assert(s.capacity() >= s.size() && s.capacity() < 2 * s.size());
+
+    s.clear();
+    assert(s.empty() && s.c_str()[0] == '\0');
+
+    nuo_string a("abc");
+    a.append("def").append(3, '!');
+    a += 'x';
+    a += std::string_view("yz");
+    assert(a == "abcdef!!!xyz");
+
+    /* append from itself, across a reallocation */
+    nuo_string self("0123456789");
+    for (int i = 0; i < 5; i++)
+        self.append(self.data(), self.size());
+    assert(self.size() == 320);
+    assert(self.substr(310) == "0123456789");
+
+    nuo_string ins("hello world");
+    ins.insert(5, ",");
+    assert(ins == "hello, world");
+    ins.insert(0, 2, '>');
+    assert(ins == ">>hello, world");
+    ins.insert(ins.size(), std::string_view("!"));
+    assert(ins == ">>hello, world!");
+    ins.insert(0, ins.data() + 2, 5);
+    assert(ins == "hello>>hello, world!");
+
+    ins.erase(5, 2);
+    assert(ins == "hellohello, world!");
+    ins.erase(10);
+    assert(ins == "hellohello");
+
+    ins.resize(12, '?');
+    assert(ins == "hellohello??");
+    ins.pop_back();
+    assert(ins.back() == '?' && ins.size() == 11);
+    assert(ins.front() == 'h');
+
+    bool thrown = false;
+    try {
+        ins.at(100);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    nuo_string sw1("one"), sw2(std::string(50, 't').c_str());
+    sw1.swap(sw2);
+    assert(sw1.size() == 50 && sw2 == "one");
+
+    /* concatenation */
+    nuo_string c1 = nuo_string("ab") + "cd";
+    assert(c1 == "abcd");
+    nuo_string c2 = "x" + c1 + 'y';
+    assert(c2 == "xabcdy");
+    nuo_string c3 = c1 + c2;
+    assert(c3 == "abcdxabcdy");
+
+    std::ostringstream os;
+    os << c3;
+    assert(os.str() == "abcdxabcdy");
+}
+
+/* ------------------------------------------------- */
+/* Test find */
+void test::Test_Nuo_String::test_find() {
+    nuo_string s("the quick brown fox jumps over the lazy dog");
+    std::string ref(s.data(), s.size());
+
+    assert(s.find('q') == ref.find('q'));
+    assert(s.find('z') == ref.find('z'));
+    assert(s.find('!') == nuo_string::npos);
+    assert(s.find('o', 13) == ref.find('o', 13));
+    assert(s.find("the") == 0);
+    assert(s.find("the", 1) == ref.find("the", 1));
+    assert(s.find("dog") == ref.find("dog"));
+    assert(s.find("cat") == nuo_string::npos);
+    assert(s.find("") == 0);
+    assert(s.find("", s.size()) == s.size());
+    assert(s.find("", s.size() + 1) == nuo_string::npos);
+    assert(s.rfind('o') == ref.rfind('o'));
+    assert(s.rfind('t', 10) == ref.rfind('t', 10));
+    assert(s.contains("brown") && !s.contains("purple"));
+    assert(s.starts_with("the quick") && s.ends_with("lazy dog"));
+    assert(!s.starts_with("quick") && !s.ends_with("cat"));
+
+    /* random haystacks against std::string */
+    std::mt19937_64 rng(7);
+    for (int it = 0; it < 300; it++) {
+        std::string h = random_text(rng, rng() % 300);
+        std::string n = random_text(rng, 1 + rng() % 6);
+        nuo_string nh(h.c_str(), h.size());
+        size_t pos = h.empty() ? 0 : rng() % h.size();
+        assert(nh.find(n.c_str(), pos, n.size()) == h.find(n, pos));
+        assert(nh.find(n[0], pos) == h.find(n[0], pos));
+    }
+}
+
+/* ------------------------------------------------- */
+/* Test compare */
+void test::Test_Nuo_String::test_compare() {
+    nuo_string a("apple"), b("banana"), a2("apple");
+    assert(a == a2 && a != b);
+    assert(a < b && b > a && a <= a2 && a >= a2);
+    assert(a.compare(b) < 0 && b.compare(a) > 0 && a.compare(a2) == 0);
+    assert(a == std::string_view("apple"));
+    assert("apple" == a);
+
+    /* prefix orders first */
+    assert(nuo_string("app") < a);
+
+    /* bytes compare unsigned, like memcmp */
+    nuo_string hi("\xff"), lo("\x01");
+    assert(lo < hi);
+
+    /* works with nuo_min / nuo_max through operator< */
+    const nuo_string& mn = nuostl::nuo_min(a, b);
+    assert(&mn == &a);
+    const nuo_string& mx = nuostl::nuo_max(a, b);
+    assert(&mx == &b);
+
+    /* long strings differing at the very end */
+    std::string l1(200, 'm'), l2(200, 'm');
+    l2[199] = 'n';
+    nuo_string n1(l1.c_str()), n2(l2.c_str());
+    assert(n1 != n2 && n1 < n2);
+    assert(n1.compare(n2) < 0);
+}
+
+/* ------------------------------------------------- */
+/* Test pluggable allocator */
+void test::Test_Nuo_String::test_allocator() {
+    using counted = nuostl::nuo_basic_string<CountingAlloc<char>>;
+    static_assert(sizeof(counted) == sizeof(nuo_string),
+                  "stateless allocators take no space");
+    {
+        counted s("short keys never allocate");
+        assert(CountingAlloc<char>::live == 1);
+        counted t("tiny");
+        assert(CountingAlloc<char>::live == 1);
+        for (int i = 0; i < 100; i++)
+            t.push_back('x');
+        assert(CountingAlloc<char>::live == 2);
+        counted u(std::move(t));
+        assert(CountingAlloc<char>::live == 2);
+    }
+    assert(CountingAlloc<char>::live == 0);
+
+    /* copy assignment frees with the old allocator, then takes the source's */
+    using tagged = nuostl::nuo_basic_string<TaggedAlloc<char>>;
+    {
+        tagged a("a long string on the first allocator", TaggedAlloc<char>(1));
+        tagged b("another long string, on the second one", TaggedAlloc<char>(2));
+        tagged c("short", TaggedAlloc<char>(2));
+        assert(TaggedAlloc<char>::live[1] == 1 && TaggedAlloc<char>::live[2] == 1);
+        a = b;
+        assert(a == b && a.get_allocator().id == 2);
+        assert(TaggedAlloc<char>::live[1] == 0 && TaggedAlloc<char>::live[2] == 2);
+        c = a;
+        assert(c == b && TaggedAlloc<char>::live[2] == 3);
+        tagged d("", TaggedAlloc<char>(1));
+        d = c;
+        assert(d == c && d.get_allocator().id == 2 && TaggedAlloc<char>::live[1] == 0);
+        assert(TaggedAlloc<char>::live[2] == 4);
+    }
+    assert(TaggedAlloc<char>::live[1] == 0 && TaggedAlloc<char>::live[2] == 0);
+
+    nuostl::nuo_malloc_allocator<char> ma;
+    char* p = ma.allocate(16);
+    memcpy(p, "0123456789", 11);
+    p = ma.reallocate(p, 16, 4096);
+    assert(strcmp(p, "0123456789") == 0);
+    ma.deallocate(p, 4096);
+}
+
+/* ------------------------------------------------- */
+/* Test vectorized find / compare on every reachable ISA level */
+void test::Test_Nuo_String::test_simd_paths() {
+    for_each_isa([&](unsigned level) {
+        std::mt19937_64 rng(level + 11);
+        for (int it = 0; it < 200; it++) {
+            std::string h = random_text(rng, rng() % 700);
+            std::string n = random_text(rng, 1 + rng() % 12);
+            nuo_string nh(h.c_str(), h.size());
+            nuo_string nn(n.c_str(), n.size());
+            assert(nh.find(nn) == h.find(n));
+            assert(nh.find(n.back()) == h.find(n.back()));
+
+            /* equality and ordering with a single flipped byte */
+            nuo_string other(nh);
+            assert(other == nh);
+            if (!h.empty()) {
+                size_t k = rng() % h.size();
+                other[k] = 'z';
+                assert(other != nh);
+                assert(nh < other);
+            }
+        }
+        /* match straddling the vector boundaries */
+        for (size_t at = 0; at < 140; at++) {
+            std::string h(160, 'a');
+            h.replace(at, 3, "xyz");
+            nuo_string nh(h.c_str(), h.size());
+            assert(nh.find("xyz") == at);
+            assert(nh.find('x') == at);
+        }
+    });
+}
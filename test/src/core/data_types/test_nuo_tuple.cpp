@@ -0,0 +1,198 @@
+#include "./core/data_types/test_nuo_tuple.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_make_tuple;
+using nuostl::nuo_tie;
+using nuostl::nuo_tuple;
+
+namespace {
+    struct Empty {};
+    struct Other_Empty {};
+
+    /* Address of element I relative to the tuple */
+    template<size_t I, typename Tuple>
+    size_t offset(const Tuple& t) {
+        return static_cast<size_t>(reinterpret_cast<const char*>(&t.template get<I>()) -
+                                   reinterpret_cast<const char*>(&t));
+    }
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Tuple::test_nuo_tuple() {
+    test_layout();
+    test_constructor();
+    test_get();
+    test_assign();
+    test_compare();
+    test_large();
+}
+
+/* ------------------------------------------------- */
+/* sizeof against std::tuple, which keeps declaration order */
+void test::Test_Nuo_Tuple::test_layout() {
+    static_assert(sizeof(std::tuple<char, double, char>) == 24);
+    static_assert(sizeof(nuo_tuple<char, double, char>) == 16);
+    static_assert(sizeof(nuo_tuple<char, int, short, double, char, bool>) == 24);
+    static_assert(sizeof(std::tuple<char, int, short, double, char, bool>) == 32);
+    static_assert(sizeof(nuo_tuple<bool, int64_t, bool, int32_t, bool, int16_t>) == 24);
+    static_assert(sizeof(nuo_tuple<int>) == sizeof(int));
+    static_assert(alignof(nuo_tuple<char, double>) == alignof(double));
+
+    /* empty members take no space */
+    static_assert(sizeof(nuo_tuple<Empty, int>) == sizeof(int));
+    static_assert(sizeof(nuo_tuple<Empty, int, Other_Empty>) == sizeof(int));
+    static_assert(sizeof(nuo_tuple<Empty, char, double, Other_Empty, char>) == 16);
+    static_assert(std::is_empty_v<nuo_tuple<Empty, Other_Empty>>);
+    static_assert(std::is_empty_v<nuo_tuple<>>);
+
+    static_assert(std::is_trivially_copyable_v<nuo_tuple<char, double, char>>);
+    static_assert(!std::is_trivially_copyable_v<nuo_tuple<int, std::string>>);
+
+    /* the double is moved to the front, the chars keep their relative order */
+    nuo_tuple<char, double, char> t('a', 1.5, 'b');
+    assert(offset<1>(t) == 0 && offset<0>(t) == 8 && offset<2>(t) == 9);
+    nuo_tuple<int16_t, int64_t, int32_t, int8_t> u;
+    assert(offset<1>(u) == 0 && offset<2>(u) == 8 && offset<0>(u) == 12 && offset<3>(u) == 14);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Tuple::test_constructor() {
+    /* default constructor value-initializes */
+    constexpr nuo_tuple<int, double, char> d;
+    static_assert(d.get<0>() == 0 && d.get<1>() == 0.0 && d.get<2>() == '\0');
+
+    constexpr nuo_tuple<char, int64_t> c('x', 42);
+    static_assert(c.get<0>() == 'x' && c.get<1>() == 42);
+
+    /* deduction guide and make */
+    nuo_tuple a(1, 2.5, std::string("s"));
+    static_assert(std::is_same_v<decltype(a), nuo_tuple<int, double, std::string>>);
+    auto m = nuo_make_tuple(1, 'c', std::string("str"));
+    static_assert(std::is_same_v<decltype(m), nuo_tuple<int, char, std::string>>);
+    assert(m.get<2>() == "str");
+
+    /* converting constructors */
+    nuo_tuple<std::string, long> s("hello", 3);
+    assert(s.get<0>() == "hello" && s.get<1>() == 3);
+    nuo_tuple<double, int64_t> w = nuo_tuple<float, int>(0.5f, 7);
+    assert(w.get<0>() == 0.5 && w.get<1>() == 7);
+    static_assert(!std::is_convertible_v<nuo_tuple<int, int>, nuo_tuple<std::unique_ptr<int>, int>>);
+
+    /* move-only members */
+    nuo_tuple<std::unique_ptr<int>, char> p(std::make_unique<int>(5), 'p');
+    nuo_tuple<std::unique_ptr<int>, char> q(std::move(p));
+    assert(!p.get<0>() && *q.get<0>() == 5 && q.get<1>() == 'p');
+    static_assert(!std::is_copy_constructible_v<nuo_tuple<std::unique_ptr<int>, char>>);
+
+    /* single-element tuples copy rather than wrap */
+    nuo_tuple<std::string> one("one");
+    nuo_tuple<std::string> copy(one);
+    assert(copy.get<0>() == "one" && one.get<0>() == "one");
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Tuple::test_get() {
+    static_assert(std::tuple_size<nuo_tuple<char, double, char>>::value == 3);
+    static_assert(std::is_same_v<std::tuple_element_t<1, nuo_tuple<char, double, char>>, double>);
+    static_assert(std::is_same_v<std::tuple_element_t<0, nuo_tuple<int&>>, int&>);
+
+    nuo_tuple<char, double, std::string> t('a', 2.0, "text");
+    assert(std::get<0>(t) == 'a' && std::get<1>(t) == 2.0 && std::get<2>(t) == "text");
+    assert(std::get<double>(t) == 2.0 && std::get<std::string>(t) == "text");
+    std::get<1>(t) = 3.0;
+    t.get<0>() = 'b';
+    assert(t.get<1>() == 3.0 && t.get<0>() == 'b');
+
+    static_assert(std::is_same_v<decltype(std::get<2>(std::move(t))), std::string&&>);
+    std::string moved = std::get<2>(std::move(t));
+    assert(moved == "text");
+
+    /* structured bindings go through the member get */
+    nuo_tuple<short, int64_t, char> b(1, 2, '3');
+    auto& [x, y, z] = b;
+    y = 20;
+    assert(x == 1 && b.get<1>() == 20 && z == '3');
+
+    /* reference elements */
+    int i = 1;
+    double f = 2.0;
+    nuo_tuple<int&, double&> r = nuo_tie(i, f);
+    const auto& cr = r;
+    cr.get<0>() = 10;
+    static_assert(std::is_same_v<decltype(std::get<0>(cr)), int&>);
+    assert(i == 10);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Tuple::test_assign() {
+    int i = 0;
+    std::string s;
+    nuo_tie(i, s) = nuo_make_tuple(4, std::string("four"));
+    assert(i == 4 && s == "four");
+
+    /* same-type assignment through references writes the referents */
+    int j = 7;
+    std::string u = "seven";
+    nuo_tuple<int&, std::string&> a(i, s), b(j, u);
+    a = b;
+    assert(i == 7 && s == "seven" && &a.get<0>() == &i);
+
+    nuo_tuple<long, std::string> c;
+    c = nuo_tuple<int, const char*>(5, "five");
+    assert(c.get<0>() == 5 && c.get<1>() == "five");
+
+    nuo_tuple<char, double, char> x('a', 1.0, 'b'), y('c', 2.0, 'd');
+    swap(x, y);
+    assert(x.get<0>() == 'c' && x.get<1>() == 2.0 && y.get<2>() == 'b');
+    x = y;
+    assert(x == y);
+}
+
+/* ------------------------------------------------- */
+/* ordering follows declaration order, not the physical one */
+void test::Test_Nuo_Tuple::test_compare() {
+    using t = nuo_tuple<char, double, char>;
+    static_assert(t('a', 9.0, 'z') < t('b', 0.0, 'a'));
+    static_assert(t('a', 1.0, 'z') < t('a', 2.0, 'a'));
+    static_assert(t('a', 1.0, 'a') < t('a', 1.0, 'b'));
+    static_assert(t('a', 1.0, 'a') == t('a', 1.0, 'a'));
+    static_assert(std::is_same_v<decltype(t() <=> t()), std::partial_ordering>);
+    static_assert(std::is_same_v<decltype(nuo_tuple<int, char>() <=> nuo_tuple<int, char>()),
+                                 std::strong_ordering>);
+
+    nuo_tuple<std::string, int> p("abc", 1), q("abd", 0);
+    assert(p < q && p != q && q >= p);
+    assert((nuo_tuple<int, double>(1, 2.0) <=> nuo_tuple<int, double>(1, 2.0)) == 0);
+}
+
+/* ------------------------------------------------- */
+/* enough elements to notice recursive instantiation */
+void test::Test_Nuo_Tuple::test_large() {
+    using big = nuo_tuple<
+        char, int64_t, char, int32_t, char, int16_t, char, double, char, float,
+        char, int64_t, char, int32_t, char, int16_t, char, double, char, float,
+        char, int64_t, char, int32_t, char, int16_t, char, double, char, float,
+        char, int64_t, char, int32_t, char, int16_t, char, double, char, float>;
+    static_assert(std::tuple_size_v<big> == 40);
+    static_assert(sizeof(big) == 4 * (8 + 8 + 4 + 4 + 2 + 5) + 4);
+
+    big b;
+    b.get<7>() = 7.5;
+    b.get<38>() = 'x';
+    b.get<21>() = 21;
+    assert(b.get<7>() == 7.5 && b.get<38>() == 'x' && b.get<21>() == 21);
+    big c = b;
+    assert(c == b);
+    c.get<39>() = 1.0f;
+    assert(b < c);
+}
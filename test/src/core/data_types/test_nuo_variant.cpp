@@ -0,0 +1,304 @@
+#include "./core/data_types/test_nuo_variant.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_get_if;
+using nuostl::nuo_holds_alternative;
+using nuostl::nuo_variant;
+using nuostl::nuo_visit;
+
+namespace {
+    /* Copying throws on request, moving may be declared throwing */
+    template<bool NothrowMove>
+    struct Fragile {
+        static inline bool fail = false;
+        int v;
+
+        explicit Fragile(int x) : v(x) {
+            if (fail)
+                throw std::runtime_error("Fragile");
+        }
+        Fragile(const Fragile& o) : v(o.v) {
+            if (fail)
+                throw std::runtime_error("Fragile");
+        }
+        Fragile(Fragile&& o) noexcept(NothrowMove) : v(o.v) {
+            if constexpr (!NothrowMove) {
+                if (fail)
+                    throw std::runtime_error("Fragile");
+            }
+        }
+        Fragile& operator=(const Fragile&) = default;
+        Fragile& operator=(Fragile&&) = default;
+        auto operator<=>(const Fragile&) const = default;
+    };
+
+    template<typename F>
+    bool throws_access(F&& f) {
+        try {
+            f();
+        } catch (const std::bad_variant_access&) {
+            return true;
+        }
+        return false;
+    }
+
+    template<size_t I>
+    using tag = std::integral_constant<size_t, I>;
+
+    template<size_t... I>
+    nuo_variant<tag<I>...> many(std::index_sequence<I...>);
+
+    /* Visitor returning which alternative it saw */
+    struct Which {
+        int operator()(int) const { return 0; }
+        int operator()(double) const { return 1; }
+        int operator()(const std::string&) const { return 2; }
+    };
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Variant::test_nuo_variant() {
+    test_layout();
+    test_constructor();
+    test_assign();
+    test_get();
+    test_visit();
+    test_valueless();
+    test_compare();
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Variant::test_layout() {
+    static_assert(sizeof(nuo_variant<char>) == 2);
+    static_assert(sizeof(nuo_variant<char, int16_t>) == 4);
+    static_assert(sizeof(nuo_variant<int, float>) == 8);
+    static_assert(sizeof(nuo_variant<double, int64_t, char>) == 16);
+
+    /* index grows to 16 bits past 254 alternatives */
+    using v254 = decltype(many(std::make_index_sequence<254>{}));
+    using v300 = decltype(many(std::make_index_sequence<300>{}));
+    static_assert(sizeof(v254) == 2 && sizeof(v300) == 4);
+
+    static_assert(std::is_trivially_copyable_v<nuo_variant<int, double, char>>);
+    static_assert(std::is_trivially_destructible_v<nuo_variant<int, double, char>>);
+    static_assert(!std::is_trivially_copyable_v<nuo_variant<int, std::string>>);
+
+    static_assert(nuo_variant<int, std::string, std::vector<int>>::never_valueless);
+    static_assert(!nuo_variant<int, Fragile<false>>::never_valueless);
+    static_assert(std::variant_size_v<nuo_variant<int, char>> == 2);
+    static_assert(std::is_same_v<std::variant_alternative_t<1, nuo_variant<int, char>>, char>);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Variant::test_constructor() {
+    nuo_variant<int, std::string> d;
+    assert(d.index() == 0 && std::get<0>(d) == 0);
+
+    /* the converting constructor picks the best non-narrowing match */
+    nuo_variant<int, double, std::string> a = 2.5;
+    assert(a.index() == 1);
+    nuo_variant<int, double, std::string> b = "text";
+    assert(b.index() == 2 && std::get<2>(b) == "text");
+    nuo_variant<float, long> c = 0;
+    assert(c.index() == 1);
+    nuo_variant<std::string, bool> e = "no bool from a pointer";
+    assert(e.index() == 0);
+    nuo_variant<std::string, bool> f = true;
+    assert(f.index() == 1);
+    static_assert(!std::is_constructible_v<nuo_variant<int, int>, int>);
+
+    nuo_variant<int, std::string> g(std::in_place_index<1>, 3, 'x');
+    assert(std::get<1>(g) == "xxx");
+    nuo_variant<int, std::string, int16_t> h(std::in_place_type<int16_t>, 7);
+    assert(h.index() == 2 && std::get<int16_t>(h) == 7);
+
+    nuo_variant<int, std::string> copy = g;
+    assert(copy.index() == 1 && std::get<1>(copy) == "xxx");
+    nuo_variant<int, std::string> moved = std::move(g);
+    assert(std::get<1>(moved) == "xxx");
+
+    nuo_variant<std::unique_ptr<int>, int> u(std::make_unique<int>(4));
+    nuo_variant<std::unique_ptr<int>, int> w(std::move(u));
+    assert(*std::get<0>(w) == 4 && !std::get<0>(u));
+    static_assert(!std::is_copy_constructible_v<nuo_variant<std::unique_ptr<int>, int>>);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Variant::test_assign() {
+    nuo_variant<int, std::string> v;
+    v = std::string("long enough to leave the small buffer");
+    assert(v.index() == 1);
+    v = 5;
+    assert(v.index() == 0 && std::get<0>(v) == 5);
+    v.emplace<std::string>(2, 'z');
+    assert(std::get<1>(v) == "zz");
+    v.emplace<0>(9);
+    assert(std::get<int>(v) == 9);
+
+    nuo_variant<int, std::string> o(std::in_place_index<1>, "other");
+    v = o;
+    assert(std::get<1>(v) == "other" && std::get<1>(o) == "other");
+    v = nuo_variant<int, std::string>(1);
+    assert(v.index() == 0);
+    v = std::move(o);
+    assert(std::get<1>(v) == "other");
+
+    /* same-alternative swap and cross-alternative swap */
+    nuo_variant<int, std::string> p(1), q(std::in_place_index<1>, "q");
+    swap(p, q);
+    assert(std::get<1>(p) == "q" && std::get<0>(q) == 1);
+    nuo_variant<int, std::string> r(std::in_place_index<1>, "r");
+    p.swap(r);
+    assert(std::get<1>(p) == "r" && std::get<1>(r) == "q");
+
+    /* trivially copyable variants copy like their bytes */
+    nuo_variant<int, double> t1(1.5), t2(3);
+    t2 = t1;
+    assert(t2.index() == 1 && std::get<1>(t2) == 1.5);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Variant::test_get() {
+    nuo_variant<int, double, std::string> v = 1.0;
+    assert(std::get<double>(v) == 1.0);
+    assert(throws_access([&] { std::get<0>(v); }));
+    assert(throws_access([&] { std::get<std::string>(v); }));
+    assert(nuo_holds_alternative<double>(v) && !nuo_holds_alternative<int>(v));
+    assert(nuo_get_if<1>(&v) && *nuo_get_if<1>(&v) == 1.0);
+    assert(!nuo_get_if<0>(&v));
+    decltype(v)* null = nullptr;
+    assert(!nuo_get_if<0>(null));
+
+    std::get<1>(v) = 2.0;
+    assert(v.get<1>() == 2.0);
+    static_assert(std::is_same_v<decltype(std::get<2>(std::move(v))), std::string&&>);
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Variant::test_visit() {
+    nuo_variant<int, double, std::string> v = 3;
+    assert(nuo_visit(Which{}, v) == 0);
+    v = 1.0;
+    assert(v.visit(Which{}) == 1);
+    v = "s";
+    assert(nuo_visit(Which{}, std::as_const(v)) == 2);
+
+    /* the visitor sees the variant's value category */
+    std::string out = nuo_visit([](auto&& x) -> std::string {
+        if constexpr (std::is_same_v<decltype(x), std::string&&>)
+            return std::move(x);
+        else
+            return "";
+    }, std::move(v));
+    assert(out == "s");
+
+    /* mutation through visitation */
+    nuo_variant<int, double> n = 2;
+    nuo_visit([](auto& x) { x *= 3; }, n);
+    assert(std::get<0>(n) == 6);
+
+    /* explicit result type */
+    double half = nuo_visit<double>([](auto x) { return x / 2; }, n);
+    assert(half == 3.0);
+
+    /* two variants through one flattened switch: 3 * 3 cases */
+    using w = nuo_variant<int, double, std::string>;
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            w a = i == 0 ? w(1) : i == 1 ? w(1.0) : w("1");
+            w b = j == 0 ? w(1) : j == 1 ? w(1.0) : w("1");
+            int r = nuo_visit([](const auto& x, const auto& y) {
+                return Which{}(x) * 3 + Which{}(y);
+            }, a, b);
+            assert(r == static_cast<int>(i * 3 + j));
+        }
+    }
+
+    /* more combinations than one switch holds: 10 * 10 * 10 through the table */
+    using big = decltype(many(std::make_index_sequence<10>{}));
+    for (size_t i = 0; i < 10; i += 3) {
+        for (size_t j = 0; j < 10; j += 4) {
+            for (size_t k = 0; k < 10; k += 5) {
+                big x, y, z;
+                [&]<size_t... I>(std::index_sequence<I...>) {
+                    ((i == I ? (x.emplace<I>(), 0) : 0), ...);
+                    ((j == I ? (y.emplace<I>(), 0) : 0), ...);
+                    ((k == I ? (z.emplace<I>(), 0) : 0), ...);
+                }(std::make_index_sequence<10>{});
+                size_t r = nuo_visit([](auto p, auto q, auto s) {
+                    return decltype(p)::value * 100 + decltype(q)::value * 10 + decltype(s)::value;
+                }, x, y, z);
+                assert(r == i * 100 + j * 10 + k);
+            }
+        }
+    }
+
+    /* a single variant past the switch size goes through a table */
+    using huge = decltype(many(std::make_index_sequence<300>{}));
+    huge hv;
+    for (size_t i : {0, 63, 64, 65, 254, 255, 299}) {
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            ((i == I ? (hv.emplace<I>(), 0) : 0), ...);
+        }(std::make_index_sequence<300>{});
+        assert(hv.index() == i);
+        assert(nuo_visit([](auto t) { return decltype(t)::value; }, hv) == i);
+    }
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Variant::test_valueless() {
+    /* nothrow-movable alternatives: a throwing emplace keeps the old value */
+    using safe = nuo_variant<std::string, Fragile<true>>;
+    safe s(std::in_place_index<0>, "kept");
+    Fragile<true>::fail = true;
+    bool thrown = false;
+    try {
+        s.emplace<1>(1);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    Fragile<true>::fail = false;
+    assert(thrown && s.index() == 0 && std::get<0>(s) == "kept");
+    assert(!s.valueless_by_exception());
+
+    /* otherwise the variant can lose its value */
+    using unsafe = nuo_variant<std::string, Fragile<false>>;
+    unsafe u(std::in_place_index<0>, "lost");
+    Fragile<false>::fail = true;
+    thrown = false;
+    try {
+        u.emplace<1>(1);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    Fragile<false>::fail = false;
+    assert(thrown && u.valueless_by_exception() && u.index() == std::variant_npos);
+    assert(throws_access([&] { nuo_visit([](const auto&) {}, u); }));
+    unsafe copy = u;
+    assert(copy.valueless_by_exception() && copy == u);
+    assert(u < unsafe(std::in_place_index<0>, ""));
+    u = std::string("back");
+    assert(u.index() == 0 && std::get<0>(u) == "back");
+}
+
+/* ------------------------------------------------- */
+void test::Test_Nuo_Variant::test_compare() {
+    using v = nuo_variant<int, double, std::string>;
+    assert(v(1) == v(1) && v(1) != v(2) && v(1) != v(1.0));
+    assert(v(5) < v(0.5) && v(0.5) < v("a"));
+    assert(v("a") < v("b") && v(3) > v(2));
+    assert((v(2.0) <=> v(1.0)) > 0);
+    static_assert(std::is_same_v<decltype(v() <=> v()), std::partial_ordering>);
+}
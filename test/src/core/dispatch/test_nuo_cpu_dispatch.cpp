@@ -0,0 +1,183 @@
+#include "./core/dispatch/test_nuo_cpu_dispatch.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "nuostl.hpp"
+#include "test.hpp"
+
+using nuostl::nuo_isa;
+using nuostl::nuo_dispatcher;
+
+namespace {
+    int impl_scalar(int x) { return x; }
+    int impl_sse42(int x) { return x + 1; }
+    int impl_avx2(int x) { return x + 2; }
+
+    template<typename T>
+    void check_minmax(std::mt19937_64& rng) {
+        const size_t sizes[] = {1, 2, 3, 15, 16, 17, 31, 63, 64, 65,
+                                127, 255, 256, 257, 1000, 4099};
+        for (size_t n : sizes) {
+            std::vector<T> v(n);
+            for (auto& x : v)
+                x = static_cast<T>(rng());
+
+            T lo = v[0], hi = v[0];
+            for (T x : v) {
+                if (x < lo) lo = x;
+                if (hi < x) hi = x;
+            }
+            assert(nuostl::nuo_min(v.begin(), v.end()) == lo);
+            assert(nuostl::nuo_max(v.begin(), v.end()) == hi);
+
+            /* extremes at the very end land in the scalar tail */
+            v[n - 1] = std::numeric_limits<T>::min();
+            assert(nuostl::nuo_min(v.begin(), v.end()) ==
+                   std::numeric_limits<T>::min());
+            v[0] = std::numeric_limits<T>::max();
+            assert(nuostl::nuo_max(v.begin(), v.end()) ==
+                   std::numeric_limits<T>::max());
+        }
+    }
+}
+
+/* ------------------------------------------------- */
+/* Test nuo cpu dispatch */
+void test::Test_Nuo_Cpu_Dispatch::test_nuo_cpu_dispatch() {
+    test_compile_time();
+
+    test_detect();
+    test_force_isa();
+    test_dispatcher();
+    test_minmax_kernels();
+}
+
+/* ------------------------------------------------- */
+/* Test compile time */
+void test::Test_Nuo_Cpu_Dispatch::test_compile_time() {
+    constexpr auto d = nuo_dispatcher<int(int)>(&impl_scalar)
+        .add(nuo_isa::avx2, &impl_avx2)
+        .add(nuo_isa::sse42, &impl_sse42);
+    static_assert(d.resolve(nuo_isa::scalar) == &impl_scalar,
+                  "scalar slot keeps the fallback");
+    static_assert(d.resolve(nuo_isa::sse42) == &impl_sse42,
+                  "registration order does not matter");
+    static_assert(d.resolve(nuo_isa::avx2) == &impl_avx2,
+                  "exact registration");
+    static_assert(d.resolve(nuo_isa::avx512) == &impl_avx2,
+                  "higher levels inherit the best lower implementation");
+
+    static_assert(nuostl::nuo_isa_count == 4, "four ISA levels");
+}
+
+/* ------------------------------------------------- */
+/* Test feature detection */
+void test::Test_Nuo_Cpu_Dispatch::test_detect() {
+    const nuostl::nuo_cpu_features& f = nuostl::nuo_cpu_detect();
+
+    assert(strcmp(nuostl::nuo_isa_name(nuo_isa::scalar), "scalar") == 0);
+    assert(strcmp(nuostl::nuo_isa_name(nuo_isa::sse42), "sse4.2") == 0);
+    assert(strcmp(nuostl::nuo_isa_name(nuo_isa::avx512), "avx512") == 0);
+
+    /* cached: same object on every call */
+    assert(&f == &nuostl::nuo_cpu_detect());
+
+    /* a level implies its features */
+    if (f.isa >= nuo_isa::sse42)
+        assert(f.sse42 && f.popcnt);
+    if (f.isa >= nuo_isa::avx2)
+        assert(f.avx2 && f.fma && f.bmi2);
+    if (f.isa >= nuo_isa::avx512)
+        assert(f.avx512f && f.avx512bw && f.avx512vl);
+
+    /* the active level never exceeds the hardware */
+    assert(nuostl::nuo_cpu_isa() <= f.isa);
+}
+
+/* ------------------------------------------------- */
+/* Test runtime override */
+void test::Test_Nuo_Cpu_Dispatch::test_force_isa() {
+    const nuo_isa saved = nuostl::nuo_cpu_isa();
+    const nuo_isa hw = nuostl::nuo_cpu_detect().isa;
+
+    assert(nuostl::nuo_cpu_force_isa(nuo_isa::scalar) == nuo_isa::scalar);
+    assert(nuostl::nuo_cpu_isa() == nuo_isa::scalar);
+
+    /* cannot go above the hardware */
+    assert(nuostl::nuo_cpu_force_isa(nuo_isa::avx512) == hw);
+    assert(nuostl::nuo_cpu_isa() == hw);
+
+    nuostl::nuo_cpu_force_isa(saved);
+    assert(nuostl::nuo_cpu_isa() == saved);
+}
+
+/* ------------------------------------------------- */
+/* Test dispatcher resolution at runtime */
+void test::Test_Nuo_Cpu_Dispatch::test_dispatcher() {
+    const nuo_isa saved = nuostl::nuo_cpu_isa();
+    const nuo_isa hw = nuostl::nuo_cpu_detect().isa;
+
+    static const auto d = nuo_dispatcher<int(int)>(&impl_scalar)
+        .add(nuo_isa::sse42, &impl_sse42)
+        .add(nuo_isa::avx2, &impl_avx2);
+
+    nuostl::nuo_cpu_force_isa(nuo_isa::scalar);
+    assert(d(10) == 10);
+    assert(d.resolve() == &impl_scalar);
+
+    if (hw >= nuo_isa::sse42) {
+        nuostl::nuo_cpu_force_isa(nuo_isa::sse42);
+        assert(d(10) == 11);
+    }
+    if (hw >= nuo_isa::avx2) {
+        nuostl::nuo_cpu_force_isa(nuo_isa::avx2);
+        assert(d(10) == 12);
+    }
+    nuostl::nuo_cpu_force_isa(nuo_isa::avx512);
+    assert(d(10) == (hw >= nuo_isa::avx2 ? 12 : hw >= nuo_isa::sse42 ? 11 : 10));
+
+    nuostl::nuo_cpu_force_isa(saved);
+}
+
+/* ------------------------------------------------- */
+/* Test nuo_min / nuo_max kernels on every reachable ISA level */
+void test::Test_Nuo_Cpu_Dispatch::test_minmax_kernels() {
+    for_each_isa([&](unsigned level) {
+        std::mt19937_64 rng(level + 1);
+
+        check_minmax<int8_t>(rng);
+        check_minmax<uint8_t>(rng);
+        check_minmax<int16_t>(rng);
+        check_minmax<uint16_t>(rng);
+        check_minmax<int32_t>(rng);
+        check_minmax<uint32_t>(rng);
+        check_minmax<int64_t>(rng);
+        check_minmax<uint64_t>(rng);
+        check_minmax<long long>(rng);
+        check_minmax<char>(rng);
+
+        /* signed/unsigned ordering of the sign bit */
+        std::vector<uint64_t> u(100, 1);
+        u[50] = UINT64_C(1) << 63;
+        assert(nuostl::nuo_max(u.begin(), u.end()) == (UINT64_C(1) << 63));
+        assert(nuostl::nuo_min(u.begin(), u.end()) == 1);
+
+        std::vector<int64_t> s(100, 1);
+        s[50] = INT64_MIN;
+        assert(nuostl::nuo_min(s.begin(), s.end()) == INT64_MIN);
+        assert(nuostl::nuo_max(s.begin(), s.end()) == 1);
+
+        /* raw pointers are contiguous iterators too */
+        int arr[40];
+        for (int i = 0; i < 40; i++)
+            arr[i] = 20 - i;
+        assert(nuostl::nuo_min(arr, arr + 40) == -19);
+        assert(nuostl::nuo_max(arr, arr + 40) == 20);
+    });
+}
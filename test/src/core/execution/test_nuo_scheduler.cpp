@@ -0,0 +1,330 @@
+#include "./core/execution/test_nuo_scheduler.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_affinity;
+using nuostl::nuo_scheduler;
+using nuostl::nuo_scheduler_options;
+
+namespace {
+    nuo_scheduler_options threads(size_t n) {
+        nuo_scheduler_options o;
+        o.threads = n;
+        return o;
+    }
+
+    uint64_t fib(nuo_scheduler& s, unsigned n) {
+        if (n < 2)
+            return n;
+        uint64_t a = 0, b = 0;
+        s.invoke([&] { a = fib(s, n - 1); }, [&] { b = fib(s, n - 2); });
+        return a + b;
+    }
+
+    /* Every index of [0, n) visited exactly once */
+    void check_cover(nuo_scheduler& s, size_t n, size_t grain) {
+        std::vector<std::atomic<int>> hits(n);
+        s.for_range(0, n, grain, [&](size_t b, size_t e) {
+            assert(b < e && e <= n);
+            assert(grain == 0 || e - b <= grain || b == 0);
+            for (size_t i = b; i < e; i++)
+                hits[i].fetch_add(1, std::memory_order_relaxed);
+        });
+        for (size_t i = 0; i < n; i++)
+            assert(hits[i].load() == 1);
+    }
+}
+
+void test::Test_Nuo_Scheduler::test_ws_deque() {
+    using Deque = nuostl::detail::nuo_ws_deque<int>;
+    int v[1000];
+
+    /* owner end is LIFO, thief end FIFO, through two ring growths */
+    Deque d(4);
+    assert(d.empty() && d.pop() == nullptr && d.steal() == nullptr);
+    for (int i = 0; i < 1000; i++)
+        d.push(&v[i]);
+    assert(!d.empty());
+    assert(d.pop() == &v[999] && d.steal() == &v[0]);
+    for (int i = 998; i >= 500; i--)
+        assert(d.pop() == &v[i]);
+    for (int i = 1; i < 500; i++)
+        assert(d.steal() == &v[i]);
+    assert(d.empty() && d.pop() == nullptr);
+
+    /* thieves racing the owner take every element exactly once */
+    const int n = 200000;
+    std::vector<int> items(n);
+    std::vector<std::atomic<int>> taken(n);
+    Deque q;
+    std::atomic<bool> done{false};
+    auto take = [&](int* p) { taken[p - items.data()].fetch_add(1, std::memory_order_relaxed); };
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; t++) {
+        thieves.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire) || !q.empty()) {
+                int* p = q.steal();
+                if (p != nullptr && p != Deque::lost_race)
+                    take(p);
+            }
+        });
+    }
+    for (int i = 0; i < n; i++) {
+        q.push(&items[i]);
+        if (i % 3 == 0) {
+            if (int* p = q.pop())
+                take(p);
+        }
+    }
+    while (int* p = q.pop())
+        take(p);
+    done.store(true, std::memory_order_release);
+    for (std::thread& t : thieves)
+        t.join();
+    for (int i = 0; i < n; i++)
+        assert(taken[i].load() == 1);
+}
+
+void test::Test_Nuo_Scheduler::test_invoke() {
+    nuo_scheduler s(threads(4));
+    assert(s.concurrency() == 4);
+    assert(fib(s, 22) == 17711);
+
+    /* the global scheduler, variadic */
+    int a = 0, b = 0, c = 0, d = 0;
+    nuostl::nuo_parallel_invoke([&] { a = 1; }, [&] { b = 2; }, [&] { c = 3; }, [&] { d = 4; });
+    assert(a == 1 && b == 2 && c == 3 && d == 4);
+    nuostl::nuo_parallel_invoke([&] { a = 5; });
+    assert(a == 5);
+
+    /* a single thread runs both inline */
+    nuo_scheduler one(threads(1));
+    assert(fib(one, 15) == 610);
+}
+
+void test::Test_Nuo_Scheduler::test_for_range() {
+    nuo_scheduler s(threads(4));
+    for (size_t n : {1, 2, 3, 100, 4097, 100000}) {
+        for (size_t grain : {0, 1, 7, 1000})
+            check_cover(s, n, grain);
+    }
+    s.for_range(5, 5, 0, [](size_t, size_t) { assert(false); });
+
+    /* nested loops share the workers */
+    std::vector<std::atomic<int>> cell(64 * 64);
+    s.for_range(0, 64, 1, [&](size_t b, size_t e) {
+        for (size_t i = b; i < e; i++) {
+            s.for_range(0, 64, 4, [&](size_t c, size_t f) {
+                for (size_t j = c; j < f; j++)
+                    cell[i * 64 + j].fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+    });
+    for (std::atomic<int>& x : cell)
+        assert(x.load() == 1);
+
+    /* index form over signed and unsigned ranges */
+    std::vector<std::atomic<int>> hit(200);
+    nuostl::nuo_parallel_for(-100, 100, [&](int i) { hit[static_cast<size_t>(i + 100)]++; });
+    nuostl::nuo_parallel_for(50u, 60u, [&](unsigned i) { hit[i]++; }, 3);
+    nuostl::nuo_parallel_for(10, 10, [&](int) { assert(false); });
+    for (size_t i = 0; i < 200; i++)
+        assert(hit[i].load() == ((i >= 50 && i < 60) ? 2 : 1));
+
+    /* a signed range wider than the type's maximum */
+    std::vector<std::atomic<int>> wide(255);
+    nuostl::nuo_parallel_for(int8_t(-128), int8_t(127),
+        [&](int8_t i) { wide[static_cast<size_t>(i + 128)]++; }, 7);
+    for (auto& w : wide)
+        assert(w.load() == 1);
+}
+
+void test::Test_Nuo_Scheduler::test_reduce() {
+    nuo_scheduler s(threads(4));
+    const size_t n = 1000003;
+    auto sum = [](size_t b, size_t e) {
+        uint64_t x = 0;
+        for (size_t i = b; i < e; i++)
+            x += i;
+        return x;
+    };
+    auto plus = [](uint64_t a, uint64_t b) { return a + b; };
+    assert(s.reduce(0, n, uint64_t(0), sum, plus) == uint64_t(n) * (n - 1) / 2);
+    assert(s.reduce(0, n, uint64_t(0), sum, plus, 1000) == uint64_t(n) * (n - 1) / 2);
+    assert(s.reduce(7, 7, uint64_t(42), sum, plus) == 42);
+
+    /* associative but not commutative: the chunk order is kept */
+    std::string digits = s.reduce(0, 2000, std::string(),
+        [](size_t b, size_t e) {
+            std::string r;
+            for (size_t i = b; i < e; i++)
+                r += static_cast<char>('0' + i % 10);
+            return r;
+        },
+        [](std::string a, const std::string& b) { return a + b; }, 13);
+    assert(digits.size() == 2000);
+    for (size_t i = 0; i < 2000; i++)
+        assert(digits[i] == static_cast<char>('0' + i % 10));
+
+    assert(nuostl::nuo_parallel_reduce(0, 100, 0, [](size_t b, size_t e) {
+        return static_cast<int>(e - b);
+    }, [](int a, int b) { return a + b; }) == 100);
+}
+
+void test::Test_Nuo_Scheduler::test_exceptions() {
+    nuo_scheduler s(threads(4));
+    bool caught = false;
+    try {
+        s.invoke([] {}, [] { throw std::runtime_error("b"); });
+    } catch (const std::runtime_error& e) {
+        caught = std::string(e.what()) == "b";
+    }
+    assert(caught);
+
+    /* both throw: the first one wins, the second is joined anyway */
+    caught = false;
+    try {
+        s.invoke([] { throw std::logic_error("a"); }, [] { throw std::runtime_error("b"); });
+    } catch (const std::logic_error&) {
+        caught = true;
+    }
+    assert(caught);
+
+    std::atomic<size_t> ran{0};
+    caught = false;
+    try {
+        s.for_range(0, 100000, 100, [&](size_t b, size_t e) {
+            ran += e - b;
+            if (b <= 50000 && 50000 < e)
+                throw std::out_of_range("chunk");
+        });
+    } catch (const std::out_of_range&) {
+        caught = true;
+    }
+    assert(caught && ran.load() <= 100000);
+
+    /* still usable */
+    assert(fib(s, 12) == 144);
+}
+
+void test::Test_Nuo_Scheduler::test_concurrent_callers() {
+    /* one caller enters, the others run inline, all get their result */
+    nuo_scheduler s(threads(3));
+    std::vector<uint64_t> result(4, 0);
+    std::vector<std::thread> callers;
+    for (size_t t = 0; t < 4; t++) {
+        callers.emplace_back([&, t] {
+            for (int round = 0; round < 20; round++) {
+                std::atomic<uint64_t> x{0};
+                s.for_range(0, 10000, 0, [&](size_t b, size_t e) {
+                    uint64_t local = 0;
+                    for (size_t i = b; i < e; i++)
+                        local += i * (t + 1);
+                    x += local;
+                });
+                result[t] = x.load();
+            }
+        });
+    }
+    for (std::thread& c : callers)
+        c.join();
+    for (size_t t = 0; t < 4; t++)
+        assert(result[t] == uint64_t(10000) * 9999 / 2 * (t + 1));
+}
+
+void test::Test_Nuo_Scheduler::test_options() {
+    using nuostl::detail::nuo_parse_cpu_list;
+    assert((nuo_parse_cpu_list("0-3,8,10-11\n") == std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    assert(nuo_parse_cpu_list("").empty());
+
+    const std::vector<int> allowed = nuostl::detail::nuo_allowed_cpus();
+    assert(!allowed.empty());
+    for (bool scatter : {false, true}) {
+        std::vector<int> order = nuostl::detail::nuo_cpu_order(scatter);
+        assert(order.size() == allowed.size());
+    }
+
+    for (nuo_affinity a : {nuo_affinity::compact, nuo_affinity::scatter}) {
+        nuo_scheduler_options o;
+        o.threads = 3;
+        o.affinity = a;
+        nuo_scheduler s(o);
+        assert(fib(s, 16) == 987);
+    }
+    nuo_scheduler_options o;
+    o.threads = 2;
+    o.cpus = {allowed[0]};
+    nuo_scheduler pinned(o);
+    check_cover(pinned, 5000, 0);
+
+    /* the global one, restored afterwards */
+    const nuo_scheduler_options saved = nuo_scheduler::global().options();
+    nuostl::nuo_set_num_threads(3);
+    assert(nuostl::nuo_num_threads() == 3);
+    assert(nuo_scheduler::global().options().affinity == saved.affinity);
+    nuostl::nuo_set_scheduler_options(saved);
+    assert(nuostl::nuo_num_threads() == saved.threads);
+}
+
+void test::Test_Nuo_Scheduler::test_algorithms() {
+    const nuo_scheduler_options saved = nuo_scheduler::global().options();
+    nuostl::nuo_set_num_threads(4);
+    const auto par = nuostl::nuo_par.with_grain(1000);
+
+    std::vector<int> a(100003);
+    std::iota(a.begin(), a.end(), 0);
+    std::vector<int> b(a.size(), -1);
+    assert(nuostl::nuo_copy(par, a.begin(), a.end(), b.begin()) == b.end() && a == b);
+    nuostl::nuo_fill(nuostl::nuo_par, b.begin(), b.end(), 7);
+    assert(b.front() == 7 && b.back() == 7 && b[50000] == 7);
+    nuostl::nuo_fill(nuostl::nuo_seq, b.begin(), b.begin() + 3, 1);
+    assert(b[2] == 1 && b[3] == 7);
+
+    /* streamed chunks */
+    const size_t threshold = nuostl::nuo_copy_stream_threshold();
+    nuostl::nuo_set_copy_stream_threshold(256);
+    std::vector<int> c(a.size(), 0);
+    nuostl::nuo_copy(par, a.begin() + 1, a.end(), c.begin());
+    assert(c[0] == 1 && c[100001] == 100002 && c[100002] == 0);
+    nuostl::nuo_set_copy_stream_threshold(threshold);
+
+    /* element loop for other iterators and types */
+    std::deque<std::string> s(5000, "x");
+    std::vector<std::string> t(5000);
+    nuostl::nuo_fill(par, s.begin() + 10, s.end(), std::string("y"));
+    nuostl::nuo_copy(par, s.begin(), s.end(), t.begin());
+    assert(t[9] == "x" && t[10] == "y" && t[4999] == "y");
+    assert(nuostl::nuo_copy(nuostl::nuo_seq, s.begin(), s.begin(), t.begin()) == t.begin());
+
+    /* reductions, also covered by the nuo_min / nuo_max tests */
+    a[77777] = -1;
+    a[3] = 1 << 30;
+    assert(nuostl::nuo_min(par, a.begin(), a.end()) == -1);
+    assert(nuostl::nuo_max(par, a.begin(), a.end()) == 1 << 30);
+    assert(nuostl::nuo_min(nuostl::nuo_par, a.begin(), a.begin()) == 0);
+    assert(nuostl::nuo_max(par.with_grain(7), s.begin(), s.end()) == "y");
+
+    nuostl::nuo_set_scheduler_options(saved);
+}
+
+void test::Test_Nuo_Scheduler::test_nuo_scheduler() {
+    test_ws_deque();
+    test_invoke();
+    test_for_range();
+    test_reduce();
+    test_exceptions();
+    test_concurrent_callers();
+    test_options();
+    test_algorithms();
+}
@@ -0,0 +1,121 @@
+#include "./core/function_objects/test_nuo_functional.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_op_kind;
+using nuostl::nuo_op_kind_v;
+
+namespace {
+    /* A user functor declaring what it computes */
+    struct Wrapping_Add {
+        uint32_t operator()(uint32_t a, uint32_t b) const { return a + b; }
+    };
+
+    struct Opaque {
+        bool operator()(int a, int b) const { return a < b; }
+    };
+
+    /* Comparable with int without converting */
+    struct Key {
+        int v;
+    };
+
+    constexpr bool operator<(const Key& a, int b) { return a.v < b; }
+    constexpr bool operator<(int a, const Key& b) { return a < b.v; }
+}
+
+template<>
+struct nuostl::nuo_op_traits<Wrapping_Add> {
+    static constexpr nuostl::nuo_op_kind kind = nuostl::nuo_op_kind::plus;
+};
+
+void test::Test_Nuo_Functional::test_functors() {
+    static_assert(nuostl::nuo_plus<int>()(2, 3) == 5);
+    static_assert(nuostl::nuo_minus<int>()(2, 3) == -1);
+    static_assert(nuostl::nuo_multiplies<int>()(4, 3) == 12);
+    static_assert(nuostl::nuo_divides<int>()(7, 2) == 3);
+    static_assert(nuostl::nuo_modulus<int>()(7, 2) == 1);
+    static_assert(nuostl::nuo_negate<int>()(7) == -7);
+    static_assert(nuostl::nuo_equal_to<int>()(7, 7) && nuostl::nuo_not_equal_to<int>()(7, 8));
+    static_assert(nuostl::nuo_less<int>()(1, 2) && !nuostl::nuo_greater<int>()(1, 2));
+    static_assert(nuostl::nuo_less_equal<int>()(2, 2) && nuostl::nuo_greater_equal<int>()(2, 2));
+    static_assert(!nuostl::nuo_logical_and<bool>()(true, false));
+    static_assert(nuostl::nuo_logical_or<bool>()(true, false));
+    static_assert(nuostl::nuo_logical_not<bool>()(false));
+    static_assert(nuostl::nuo_bit_and<unsigned>()(6u, 3u) == 2u);
+    static_assert(nuostl::nuo_bit_or<unsigned>()(6u, 3u) == 7u);
+    static_assert(nuostl::nuo_bit_xor<unsigned>()(6u, 3u) == 5u);
+    static_assert(nuostl::nuo_bit_not<uint8_t>()(uint8_t(0x0f)) == 0xf0);
+
+    /* empty, so free to store in containers and algorithms */
+    static_assert(std::is_empty_v<nuostl::nuo_less<>> && std::is_empty_v<nuostl::nuo_plus<int>>);
+
+    /* typed forms convert, transparent ones keep the operand types */
+    static_assert(std::is_same_v<decltype(nuostl::nuo_plus<int>()(1, 2)), int>);
+    static_assert(std::is_same_v<decltype(nuostl::nuo_plus<>()(1, 2.5)), double>);
+    static_assert(nuostl::nuo_plus<>()(1, 2.5) == 3.5);
+    std::string a = "ab";
+    assert(nuostl::nuo_plus<>()(a, std::string("cd")) == "abcd");
+    assert(nuostl::nuo_plus<std::string>()(a, "x") == "abx");
+    assert(nuostl::nuo_less<>()(std::string_view("a"), std::string("b")));
+}
+
+void test::Test_Nuo_Functional::test_transparent() {
+    static_assert(nuostl::nuo_transparent<nuostl::nuo_less<>>);
+    static_assert(nuostl::nuo_transparent<const nuostl::nuo_greater<void>&>);
+    static_assert(nuostl::nuo_transparent<std::less<>>);
+    static_assert(!nuostl::nuo_transparent<nuostl::nuo_less<int>>);
+    static_assert(!nuostl::nuo_transparent<Opaque>);
+
+    /* compares mixed operands without building a temporary Key or int */
+    static_assert(nuostl::nuo_less<>()(Key{1}, 2) && nuostl::nuo_less<>()(1, Key{2}));
+}
+
+void test::Test_Nuo_Functional::test_op_traits() {
+    static_assert(nuo_op_kind_v<nuostl::nuo_less<>> == nuo_op_kind::less);
+    static_assert(nuo_op_kind_v<const nuostl::nuo_plus<int>&> == nuo_op_kind::plus);
+    static_assert(nuo_op_kind_v<std::greater<long>> == nuo_op_kind::greater);
+    static_assert(nuo_op_kind_v<std::bit_xor<>> == nuo_op_kind::bit_xor);
+    static_assert(nuo_op_kind_v<Opaque> == nuo_op_kind::none);
+    static_assert(nuo_op_kind_v<Wrapping_Add> == nuo_op_kind::plus);
+    static_assert(nuostl::nuo_known_op<std::multiplies<>> && !nuostl::nuo_known_op<Opaque>);
+
+    /* comparisons that are the built-in ones */
+    static_assert(nuostl::nuo_is_less_v<nuostl::nuo_less<>, int>);
+    static_assert(nuostl::nuo_is_less_v<std::less<double>, double>);
+    static_assert(nuostl::nuo_is_greater_v<nuostl::nuo_greater<>, uint8_t>);
+    static_assert(!nuostl::nuo_is_less_v<nuostl::nuo_greater<>, int>);
+    static_assert(!nuostl::nuo_is_less_v<nuostl::nuo_less<long>, int>);
+    static_assert(!nuostl::nuo_is_less_v<nuostl::nuo_less<>, std::string>);
+    static_assert(!nuostl::nuo_is_less_v<Opaque, int>);
+
+    /* exact reassociation only on integers */
+    static_assert(nuostl::nuo_is_associative_v<nuostl::nuo_plus<>, int>);
+    static_assert(nuostl::nuo_is_commutative_v<std::multiplies<uint64_t>, uint64_t>);
+    static_assert(nuostl::nuo_is_associative_v<nuostl::nuo_bit_and<>, uint16_t>);
+    static_assert(nuostl::nuo_is_associative_v<Wrapping_Add, uint32_t>);
+    static_assert(!nuostl::nuo_is_associative_v<nuostl::nuo_plus<>, double>);
+    static_assert(!nuostl::nuo_is_associative_v<nuostl::nuo_minus<>, int>);
+    static_assert(!nuostl::nuo_is_associative_v<nuostl::nuo_plus<>, std::string>);
+
+    static_assert(nuostl::nuo_op_identity<nuostl::nuo_plus<>, int>() == 0);
+    static_assert(nuostl::nuo_op_identity<nuostl::nuo_multiplies<>, long>() == 1);
+    static_assert(nuostl::nuo_op_identity<nuostl::nuo_bit_and<>, uint8_t>() == 0xff);
+    static_assert(nuostl::nuo_op_identity<nuostl::nuo_bit_and<>, int>() == -1);
+    static_assert(nuostl::nuo_op_identity<nuostl::nuo_bit_or<>, int>() == 0);
+    static_assert(nuostl::nuo_op_identity<nuostl::nuo_logical_and<>, bool>());
+}
+
+void test::Test_Nuo_Functional::test_nuo_functional() {
+    test_functors();
+    test_transparent();
+    test_op_traits();
+}
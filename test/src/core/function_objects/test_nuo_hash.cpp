@@ -0,0 +1,316 @@
+#include "./core/function_objects/test_nuo_hash.hpp"
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "nuostl.hpp"
+#include "test.hpp"
+
+using nuostl::nuo_hash;
+using nuostl::nuo_hash_bytes;
+using nuostl::nuo_hash_mix;
+
+namespace {
+    struct Id {
+        int v;
+    };
+
+    struct No_Hash {};
+
+    enum class Color : uint8_t { red, green };
+
+    const size_t lengths[] = {1,   2,   3,   4,   5,   7,   8,    9,    12,   15,  16,
+                              17,  24,  31,  32,  33,  47,  48,   49,   64,   96,  100,
+                              128, 200, 255, 256, 257, 300, 511, 1024, 1025, 3000};
+
+    /*
+     * Strict avalanche: flipping any one of the given input bits flips
+     * each output bit with probability 1/2. The bound is 6 standard
+     * deviations of the sampled rate, loose enough for the thousands of
+     * cells checked and still far from a bit that never or always flips.
+     */
+    template<typename F>
+    void check_avalanche(F hash, size_t bytes, const std::vector<size_t>& bits, size_t samples,
+                         uint64_t seed) {
+        std::mt19937_64 rng(seed);
+        std::vector<uint32_t> flips(bits.size() * 64, 0);
+        std::vector<unsigned char> key(bytes);
+        for (size_t s = 0; s < samples; s++) {
+            for (unsigned char& c : key)
+                c = static_cast<unsigned char>(rng());
+            const uint64_t h = hash(key.data(), bytes);
+            for (size_t b = 0; b < bits.size(); b++) {
+                key[bits[b] / 8] ^= static_cast<unsigned char>(1u << (bits[b] % 8));
+                uint64_t d = h ^ hash(key.data(), bytes);
+                key[bits[b] / 8] ^= static_cast<unsigned char>(1u << (bits[b] % 8));
+                for (size_t j = 0; j < 64; j++)
+                    flips[b * 64 + j] += static_cast<uint32_t>((d >> j) & 1);
+            }
+        }
+        /* short keys repeat, the spread is that of the distinct ones */
+        const size_t distinct = bytes < 3 ? std::min(samples, size_t(1) << (8 * bytes)) : samples;
+        const double bound = 6 * 0.5 / sqrt(static_cast<double>(distinct));
+        for (uint32_t f : flips)
+            assert(fabs(static_cast<double>(f) / static_cast<double>(samples) - 0.5) < bound);
+    }
+
+    /* Every bit up to 128, else 64 spread out plus the first and last bytes */
+    std::vector<size_t> bits_of(size_t bytes) {
+        std::vector<size_t> r;
+        const size_t n = bytes * 8;
+        if (n <= 128) {
+            for (size_t i = 0; i < n; i++)
+                r.push_back(i);
+            return r;
+        }
+        for (size_t i = 0; i < 8; i++) {
+            r.push_back(i);
+            r.push_back(n - 1 - i);
+        }
+        for (size_t i = 0; i < 64; i++)
+            r.push_back(8 + i * (n - 16) / 64);
+        return r;
+    }
+
+    uint64_t read64(const unsigned char* p) {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        return v;
+    }
+
+    /* Pairs colliding on (h >> shift) & mask, over distinct 64-bit hashes */
+    size_t collisions(std::vector<uint64_t> h, unsigned shift, uint64_t mask) {
+        std::sort(h.begin(), h.end());
+        assert(std::adjacent_find(h.begin(), h.end()) == h.end());
+        for (uint64_t& x : h)
+            x = (x >> shift) & mask;
+        std::sort(h.begin(), h.end());
+        size_t c = 0;
+        for (size_t i = 1; i < h.size(); i++)
+            c += h[i] == h[i - 1];
+        return c;
+    }
+
+    /* Chi-square of h's 10-bit buckets, low and high bits, below mean + 6 sd */
+    void check_buckets(const std::vector<uint64_t>& h) {
+        for (unsigned shift : {0u, 27u, 54u}) {
+            std::vector<double> count(1024, 0);
+            for (uint64_t x : h)
+                count[(x >> shift) & 1023]++;
+            const double expect = static_cast<double>(h.size()) / 1024;
+            double chi2 = 0;
+            for (double c : count)
+                chi2 += (c - expect) * (c - expect) / expect;
+            assert(chi2 < 1023 + 6 * sqrt(2 * 1023.0));
+        }
+    }
+}
+
+template<>
+struct std::hash<Id> {
+    size_t operator()(const Id& id) const noexcept { return static_cast<size_t>(id.v); }
+};
+
+void test::Test_Nuo_Hash::test_hasher() {
+    /* integers, enums, pointers, floating point */
+    static_assert(nuo_hash<uint64_t>()(1) != nuo_hash<uint64_t>()(2));
+    assert(nuo_hash<int>()(7) == nuo_hash_mix(7));
+    assert(nuo_hash<int64_t>()(-1) == nuo_hash_mix(~uint64_t(0)));
+    assert(nuo_hash<Color>()(Color::green) == nuo_hash<uint8_t>()(1));
+    int a = 0, b = 0;
+    assert(nuo_hash<int*>()(&a) != nuo_hash<int*>()(&b));
+    assert(nuo_hash<double>()(0.0) == nuo_hash<double>()(-0.0));
+    assert(nuo_hash<float>()(1.0f) != nuo_hash<float>()(2.0f));
+
+    /* the string types agree and are transparent */
+    const size_t h = nuo_hash<nuostl::nuo_string>()(nuostl::nuo_string("hello"));
+    assert(h == nuo_hash<std::string>()(std::string("hello")));
+    assert(h == nuo_hash<std::string_view>()(std::string_view("hello")));
+    assert(h == nuo_hash<nuostl::nuo_string_view>()("hello"));
+    assert(h == nuo_hash<nuostl::nuo_string>()("hello"));
+    assert(h == nuo_hash_bytes("hello", 5));
+    static_assert(nuostl::nuo_transparent<nuo_hash<nuostl::nuo_string>>);
+    static_assert(nuostl::nuo_transparent<nuo_hash<std::string>>);
+
+    /* pairs and tuples, in order */
+    using P = nuostl::nuo_pair<int, int>;
+    assert(nuo_hash<P>()(P(1, 2)) != nuo_hash<P>()(P(2, 1)));
+    assert((nuo_hash<P>()(P(1, 2)) == nuo_hash<nuostl::nuo_tuple<int, int>>()({1, 2})));
+    nuostl::nuo_tuple<int, std::string, double> t(1, "x", 2.5);
+    nuostl::nuo_tuple<int, std::string, double> u(1, "y", 2.5);
+    using Tuple = nuo_hash<nuostl::nuo_tuple<int, std::string, double>>;
+    assert(Tuple()(t) != Tuple()(u) && Tuple()(t) == Tuple()(t));
+    assert(nuo_hash<nuostl::nuo_tuple<>>()({}) == 0);
+    assert(nuo_hash<nuostl::nuo_tuple<int>>()({7}) == nuo_hash<int>()(7));
+
+    /* the fold depends on the seed for every h, including the mum key */
+    for (uint64_t h : {uint64_t(0), uint64_t(1), nuostl::detail::nuo_wy_s1, ~uint64_t(0)}) {
+        assert(nuostl::nuo_hash_combine(1, h) != nuostl::nuo_hash_combine(2, h));
+        assert(nuostl::nuo_hash_combine(0, h) != nuostl::nuo_hash_combine(~uint64_t(0), h));
+    }
+
+    /* std::hash mixed, none when there is no std::hash either */
+    assert(nuo_hash<Id>()(Id{3}) == nuo_hash_mix(3));
+    static_assert(!std::is_invocable_v<nuo_hash<No_Hash>, No_Hash>);
+    static_assert(nuostl::nuo_avalanching_hash<nuo_hash<int>>);
+    static_assert(nuostl::nuo_avalanching_hash<nuo_hash<P>>);
+    static_assert(!nuostl::nuo_avalanching_hash<std::hash<int>>);
+
+    /* seeds, alignment, and pinned values: hashes do not change across builds */
+    std::vector<unsigned char> buf(4200);
+    for (size_t i = 0; i < buf.size(); i++)
+        buf[i] = static_cast<unsigned char>(i * 131 + 7);
+    for (size_t n : {0u, 3u, 16u, 40u, 100u, 256u, 257u, 4000u}) {
+        assert(nuo_hash_bytes(buf.data(), n, 1) != nuo_hash_bytes(buf.data(), n, 2));
+        for (size_t off = 1; off < 8; off++) {
+            std::vector<unsigned char> copy(buf.begin() + static_cast<ptrdiff_t>(off),
+                                            buf.begin() + static_cast<ptrdiff_t>(off + n));
+            assert(nuo_hash_bytes(buf.data() + off, n) == nuo_hash_bytes(copy.data(), n));
+        }
+    }
+    assert(nuo_hash_bytes("", 0) == 0x93228a4de0eec5a2ull);
+    assert(nuo_hash_bytes("abc", 3) == 0x989b4a209c1011c9ull);
+    assert(nuo_hash_bytes(buf.data(), 100) == 0x89f5224768f6f3a2ull);
+    assert(nuo_hash_bytes(buf.data(), 4000) == 0x0e1e0cc8adbfc082ull);
+}
+
+void test::Test_Nuo_Hash::test_avalanche() {
+    check_avalanche([](const unsigned char* p, size_t) { return nuo_hash_mix(read64(p)); },
+                    8, bits_of(8), 4000, 1);
+    check_avalanche(
+        [](const unsigned char* p, size_t) {
+            using P = nuostl::nuo_pair<uint64_t, uint64_t>;
+            return uint64_t(nuo_hash<P>()(P(read64(p), read64(p + 8))));
+        },
+        16, bits_of(16), 2000, 2);
+    check_avalanche(
+        [](const unsigned char* p, size_t) {
+            double d;
+            memcpy(&d, p, 8);
+            return uint64_t(nuo_hash<double>()(d));
+        },
+        8, bits_of(8), 2000, 3);
+    for (size_t n : lengths)
+        check_avalanche([](const unsigned char* p, size_t len) { return nuo_hash_bytes(p, len); },
+                        n, bits_of(n), 1000, 4 + n);
+}
+
+/*
+ * Keys differing in one to three bits, where weak hashes collide: none
+ * of them share a 64-bit hash and the 32-bit halves collide about as
+ * often as random values would (n^2 / 2^33, below 1 here).
+ */
+void test::Test_Nuo_Hash::test_sparse_keys() {
+    std::vector<uint64_t> h;
+    h.push_back(nuo_hash<uint64_t>()(0));
+    for (unsigned i = 0; i < 64; i++) {
+        h.push_back(nuo_hash<uint64_t>()(uint64_t(1) << i));
+        for (unsigned j = i + 1; j < 64; j++) {
+            h.push_back(nuo_hash<uint64_t>()(uint64_t(1) << i | uint64_t(1) << j));
+            for (unsigned k = j + 1; k < 64; k++)
+                h.push_back(nuo_hash<uint64_t>()(uint64_t(1) << i | uint64_t(1) << j |
+                                                 uint64_t(1) << k));
+        }
+    }
+    assert(collisions(h, 0, 0xffffffffu) <= 5 && collisions(h, 32, 0xffffffffu) <= 5);
+
+    /* up to two bits of 32 bytes, and of the ends of 300 bytes (the long path) */
+    for (size_t n : {32u, 300u}) {
+        std::vector<size_t> pos;
+        for (size_t i = 0; i < 128; i++) {
+            pos.push_back(i);
+            pos.push_back(n * 8 - 1 - i);
+        }
+        std::vector<unsigned char> key(n, 0);
+        h.assign(1, nuo_hash_bytes(key.data(), n));
+        for (size_t i = 0; i < pos.size(); i++) {
+            key[pos[i] / 8] ^= static_cast<unsigned char>(1u << (pos[i] % 8));
+            h.push_back(nuo_hash_bytes(key.data(), n));
+            for (size_t j = i + 1; j < pos.size(); j++) {
+                key[pos[j] / 8] ^= static_cast<unsigned char>(1u << (pos[j] % 8));
+                h.push_back(nuo_hash_bytes(key.data(), n));
+                key[pos[j] / 8] ^= static_cast<unsigned char>(1u << (pos[j] % 8));
+            }
+            key[pos[i] / 8] ^= static_cast<unsigned char>(1u << (pos[i] % 8));
+        }
+        assert(collisions(h, 0, 0xffffffffu) <= 5 && collisions(h, 32, 0xffffffffu) <= 5);
+    }
+
+    /* any one bit of 2000 bytes, zero runs of every length, seeds */
+    std::vector<unsigned char> key(2100, 0);
+    h.clear();
+    for (size_t i = 0; i < 2000 * 8; i++) {
+        key[i / 8] ^= static_cast<unsigned char>(1u << (i % 8));
+        h.push_back(nuo_hash_bytes(key.data(), 2000));
+        key[i / 8] ^= static_cast<unsigned char>(1u << (i % 8));
+    }
+    for (size_t n = 0; n <= key.size(); n++)
+        h.push_back(nuo_hash_bytes(key.data(), n));
+    for (uint64_t seed = 1; seed < 1000; seed++)
+        h.push_back(nuo_hash_bytes(key.data(), 16, seed));
+    collisions(h, 0, 0);
+}
+
+/* Sequential and structured keys spread over the buckets */
+void test::Test_Nuo_Hash::test_distribution() {
+    std::vector<uint64_t> h;
+    for (uint64_t i = 0; i < 65536; i++)
+        h.push_back(nuo_hash<uint64_t>()(i));
+    check_buckets(h);
+    h.clear();
+    for (uint64_t i = 0; i < 65536; i++)
+        h.push_back(nuo_hash<uint64_t>()(i << 32));
+    check_buckets(h);
+    h.clear();
+    using P = nuostl::nuo_pair<uint32_t, uint32_t>;
+    for (uint32_t i = 0; i < 256; i++)
+        for (uint32_t j = 0; j < 256; j++)
+            h.push_back(nuo_hash<P>()(P(i, j)));
+    check_buckets(h);
+    h.clear();
+    for (int i = 0; i < 65536; i++)
+        h.push_back(nuo_hash<std::string>()("key" + std::to_string(i)));
+    check_buckets(h);
+    h.clear();
+    for (int i = 0; i < 65536; i++)
+        h.push_back(nuo_hash<double>()(i * 0.5));
+    check_buckets(h);
+}
+
+/* The vector kernels give the scalar hash */
+void test::Test_Nuo_Hash::test_kernels() {
+    std::mt19937_64 rng(5);
+    std::vector<unsigned char> buf(100000);
+    for (unsigned char& c : buf)
+        c = static_cast<unsigned char>(rng());
+    const size_t sizes[] = {257, 300, 1023, 1024, 1025, 1089, 2048, 4096, 5000, 99999};
+    /* the scalar level runs first and sets the reference */
+    std::vector<uint64_t> ref;
+    for_each_isa([&](unsigned level) {
+        for (size_t i = 0; i < std::size(sizes); i++) {
+            const uint64_t h = nuo_hash_bytes(buf.data() + 1, sizes[i], sizes[i]);
+            if (level == 0)
+                ref.push_back(h);
+            else
+                assert(h == ref[i]);
+        }
+    });
+}
+
+void test::Test_Nuo_Hash::test_nuo_hash() {
+    test_hasher();
+    test_avalanche();
+    test_sparse_keys();
+    test_distribution();
+    test_kernels();
+}
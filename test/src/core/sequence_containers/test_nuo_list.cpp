@@ -0,0 +1,408 @@
+#include "./core/sequence_containers/test_nuo_list.hpp"
+
+#include <assert.h>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_intrusive_list;
+using nuostl::nuo_list;
+using nuostl::nuo_list_hook;
+
+namespace {
+    struct Hot {};
+    struct Cold {};
+
+    /* In two lists at once through two hooks */
+    struct Item : nuo_list_hook<Hot>, nuo_list_hook<Cold> {
+        int key;
+
+        explicit Item(int k) : key(k) {}
+    };
+
+    template<typename L>
+    std::vector<int> keys(const L& l) {
+        std::vector<int> out;
+        for (const auto& x : l)
+            out.push_back(x.key);
+        return out;
+    }
+
+    template<typename L>
+    std::vector<typename L::value_type> items(const L& l) {
+        return std::vector<typename L::value_type>(l.begin(), l.end());
+    }
+
+    /* Counts live instances, throws on the copy that makes it reach limit */
+    struct Counted {
+        static int live;
+        static int limit;
+        int v;
+
+        Counted(int x = 0) : v(x) { live++; }
+        Counted(const Counted& o) : v(o.v) {
+            if (live + 1 == limit)
+                throw std::runtime_error("limit");
+            live++;
+        }
+        Counted& operator=(const Counted&) = default;
+        ~Counted() { live--; }
+
+        bool operator==(const Counted& o) const { return v == o.v; }
+    };
+
+    int Counted::live = 0;
+    int Counted::limit = -1;
+}
+
+void test::Test_Nuo_List::test_intrusive() {
+    std::vector<Item> pool;
+    for (int i = 0; i < 8; i++)
+        pool.emplace_back(i);
+
+    nuo_intrusive_list<Item, Hot> hot;
+    nuo_intrusive_list<Item, Cold> cold;
+    for (Item& x : pool) {
+        hot.push_back(x);
+        if (x.key % 2 == 0)
+            cold.push_front(x);
+    }
+    assert(hot.size() == 8 && cold.size() == 4);
+    assert((keys(hot) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+    assert((keys(cold) == std::vector<int>{6, 4, 2, 0}));
+    assert(static_cast<nuo_list_hook<Hot>&>(pool[3]).is_linked());
+    assert(!static_cast<nuo_list_hook<Cold>&>(pool[3]).is_linked());
+
+    /* move to front through iterator_to, the LRU touch */
+    hot.splice(hot.begin(), hot, hot.iterator_to(pool[5]));
+    assert((keys(hot) == std::vector<int>{5, 0, 1, 2, 3, 4, 6, 7}));
+    hot.splice(hot.end(), hot, hot.iterator_to(pool[7]));
+    assert((keys(hot) == std::vector<int>{5, 0, 1, 2, 3, 4, 6, 7}));
+    assert(hot.size() == 8);
+
+    hot.erase(hot.iterator_to(pool[2]));
+    assert(!static_cast<nuo_list_hook<Hot>&>(pool[2]).is_linked());
+    assert(hot.size() == 7 && cold.size() == 4);
+
+    /* splice a counted range into another list */
+    nuo_intrusive_list<Item, Hot> other;
+    auto first = std::next(hot.begin());
+    auto last = std::next(first, 3);
+    other.splice(other.end(), hot, first, last, 3);
+    assert((keys(other) == std::vector<int>{0, 1, 3}));
+    assert((keys(hot) == std::vector<int>{5, 4, 6, 7}));
+    assert(hot.size() == 4 && other.size() == 3);
+    other.splice(other.begin(), hot, hot.begin(), std::next(hot.begin(), 2));
+    assert((keys(other) == std::vector<int>{5, 4, 0, 1, 3}) && other.size() == 5);
+    hot.splice(hot.end(), other);
+    assert(other.empty() && hot.size() == 7);
+    assert((keys(hot) == std::vector<int>{6, 7, 5, 4, 0, 1, 3}));
+
+    /* an empty range moves nothing */
+    other.splice(other.end(), hot, hot.begin(), hot.begin());
+    other.splice(other.end(), hot, std::next(hot.begin()), std::next(hot.begin()), 0);
+    assert(other.empty() && hot.size() == 7);
+    assert((keys(hot) == std::vector<int>{6, 7, 5, 4, 0, 1, 3}));
+
+    hot.reverse();
+    assert((keys(hot) == std::vector<int>{3, 1, 0, 4, 5, 7, 6}));
+    std::vector<int> back;
+    for (auto it = hot.rbegin(); it != hot.rend(); ++it)
+        back.push_back(it->key);
+    assert((back == std::vector<int>{6, 7, 5, 4, 0, 1, 3}));
+
+    assert(hot.remove_if([](const Item& x) { return x.key > 4; }) == 3);
+    assert((keys(hot) == std::vector<int>{3, 1, 0, 4}));
+
+    /* dispose sees each element once, after it is unlinked */
+    std::vector<int> disposed;
+    hot.erase_and_dispose(hot.begin(), std::next(hot.begin(), 2), [&](Item& x) {
+        assert(!static_cast<nuo_list_hook<Hot>&>(x).is_linked());
+        disposed.push_back(x.key);
+    });
+    assert((disposed == std::vector<int>{3, 1}) && hot.size() == 2);
+
+    nuo_intrusive_list<Item, Hot> moved(std::move(hot));
+    assert(hot.empty() && moved.size() == 2 && moved.front().key == 0);
+    swap(moved, hot);
+    assert(moved.empty() && hot.back().key == 4);
+    hot.clear();
+    cold.clear();
+    for (Item& x : pool) {
+        assert(!static_cast<nuo_list_hook<Hot>&>(x).is_linked());
+        assert(!static_cast<nuo_list_hook<Cold>&>(x).is_linked());
+    }
+}
+
+void test::Test_Nuo_List::test_constructor() {
+    nuo_list<int> a;
+    assert(a.empty() && a.size() == 0 && a.begin() == a.end());
+
+    nuo_list<int> b(3);
+    assert((items(b) == std::vector<int>{0, 0, 0}));
+    nuo_list<int> c(4, 7);
+    assert((items(c) == std::vector<int>{7, 7, 7, 7}));
+    nuo_list<int> d{1, 2, 3};
+    assert((items(d) == std::vector<int>{1, 2, 3}));
+    std::vector<int> v{5, 6};
+    nuo_list<int> e(v.begin(), v.end());
+    assert((items(e) == v));
+
+    nuo_list<std::string> s{"a", std::string(40, 'b')};
+    nuo_list<std::string> t(s);
+    assert(t == s && t.back().size() == 40);
+    nuo_list<std::string> u(std::move(s));
+    assert(u == t && s.empty());
+
+    /* copy assignment reuses nodes and keeps the pool */
+    nuo_list<int>::pool_type pool;
+    nuo_list<int> f(pool);
+    f = d;
+    assert(f == d && &f.pool() == &pool);
+    f = {9};
+    assert((items(f) == std::vector<int>{9}) && &f.pool() == &pool);
+    f = nuo_list<int>{4, 5, 6, 7};
+    assert((items(f) == std::vector<int>{4, 5, 6, 7}));
+
+    assert(d < c && c > e && d != c);
+    assert((nuo_list<int>{1, 2} < nuo_list<int>{1, 2, 0}));
+}
+
+void test::Test_Nuo_List::test_modifiers() {
+    std::mt19937 rng(39);
+    nuo_list<int> l;
+    std::list<int> ref;
+    for (int step = 0; step < 4000; step++) {
+        int op = static_cast<int>(rng() % 8);
+        int x = static_cast<int>(rng() % 1000);
+        size_t at = ref.empty() ? 0 : rng() % (ref.size() + 1);
+        auto li = std::next(l.begin(), static_cast<ptrdiff_t>(at));
+        auto ri = std::next(ref.begin(), static_cast<ptrdiff_t>(at));
+        switch (op) {
+        case 0: l.push_back(x); ref.push_back(x); break;
+        case 1: l.push_front(x); ref.push_front(x); break;
+        case 2:
+            assert(*l.insert(li, x) == x);
+            ref.insert(ri, x);
+            break;
+        case 3: {
+            size_t n = rng() % 5;
+            auto r = l.insert(li, n, x);
+            ref.insert(ri, n, x);
+            assert(std::distance(l.begin(), r) == static_cast<ptrdiff_t>(at));
+            break;
+        }
+        case 4:
+            if (li != l.end()) {
+                l.erase(li);
+                ref.erase(ri);
+            }
+            break;
+        case 5: {
+            size_t n = rng() % 4;
+            size_t k = n < ref.size() - at ? n : ref.size() - at;
+            auto r = l.erase(li, std::next(li, static_cast<ptrdiff_t>(k)));
+            ref.erase(ri, std::next(ri, static_cast<ptrdiff_t>(k)));
+            assert(std::distance(l.begin(), r) == static_cast<ptrdiff_t>(at));
+            break;
+        }
+        case 6:
+            if (!ref.empty()) {
+                l.pop_back();
+                ref.pop_back();
+            }
+            break;
+        case 7:
+            if (!ref.empty()) {
+                l.pop_front();
+                ref.pop_front();
+            }
+            break;
+        }
+        assert(l.size() == ref.size());
+    }
+    assert(std::equal(l.begin(), l.end(), ref.begin(), ref.end()));
+    assert(std::equal(l.rbegin(), l.rend(), ref.rbegin(), ref.rend()));
+
+    l.resize(3);
+    assert(l.size() == 3);
+    l.resize(5, -1);
+    assert(l.back() == -1 && l.size() == 5);
+    l.emplace_front(100);
+    l.emplace_back(200);
+    assert(l.front() == 100 && l.back() == 200);
+    l.clear();
+    assert(l.empty());
+}
+
+void test::Test_Nuo_List::test_splice() {
+    /* shared pool: nodes move, iterators stay valid */
+    nuo_list<int>::pool_type pool;
+    nuo_list<int> a(pool), b(pool);
+    a = {1, 2, 3, 4};
+    b = {10, 20};
+    assert(a.shares_pool(b));
+    auto it = std::next(a.begin());
+    const int* addr = &*it;
+    b.splice(b.begin(), a, it);
+    assert((items(a) == std::vector<int>{1, 3, 4}));
+    assert((items(b) == std::vector<int>{2, 10, 20}));
+    assert(&b.front() == addr && *it == 2);
+
+    b.splice(b.end(), a, a.begin(), a.end(), 3);
+    assert(a.empty() && (items(b) == std::vector<int>{2, 10, 20, 1, 3, 4}));
+    a.splice(a.end(), b, std::next(b.begin()), std::prev(b.end()));
+    assert((items(a) == std::vector<int>{10, 20, 1, 3}) && a.size() == 4);
+    assert((items(b) == std::vector<int>{2, 4}) && b.size() == 2);
+    b.splice(b.begin(), a);
+    assert(a.empty() && b.size() == 6);
+    a.splice(a.end(), b, b.begin(), b.begin());
+    assert(a.empty() && b.size() == 6 && items(b).size() == 6);
+    assert(pool.capacity() == 16);
+
+    /* separate pools: elements move into the destination's nodes */
+    nuo_list<std::string> c{"x", "y"}, d{std::string(30, 'z')};
+    assert(!c.shares_pool(d));
+    c.splice(std::next(c.begin()), d);
+    assert(d.empty() && c.size() == 3 && *std::next(c.begin()) == std::string(30, 'z'));
+    d.splice(d.end(), c, c.begin());
+    assert((items(d) == std::vector<std::string>{"x"}) && c.size() == 2);
+
+    /* a moved list keeps using the external pool */
+    nuo_list<int> e(std::move(b));
+    assert(&e.pool() == &pool && e.size() == 6);
+    nuo_list<int> f(pool);
+    f.splice(f.end(), e, e.begin());
+    assert(f.size() == 1 && e.size() == 5);
+    swap(e, f);
+    assert(e.size() == 1 && f.size() == 5 && e.shares_pool(f));
+
+    /* swapping an owning list with a pooled one */
+    nuo_list<int> g{7, 8};
+    swap(g, e);
+    assert(&g.pool() == &pool && &e.pool() != &pool);
+    assert((items(e) == std::vector<int>{7, 8}));
+    e.push_back(9);
+    assert(e.size() == 3);
+}
+
+void test::Test_Nuo_List::test_operations() {
+    nuo_list<int> a{1, 2, 3, 2, 4, 2};
+    assert(a.remove(2) == 3);
+    assert((items(a) == std::vector<int>{1, 3, 4}));
+    a.reverse();
+    assert((items(a) == std::vector<int>{4, 3, 1}));
+
+    nuo_list<int>::pool_type pool;
+    nuo_list<int> b(pool), c(pool);
+    b = {1, 4, 6, 9};
+    c = {2, 3, 5, 9, 10};
+    b.merge(c);
+    assert(c.empty() && (items(b) == std::vector<int>{1, 2, 3, 4, 5, 6, 9, 9, 10}));
+    nuo_list<int> d{0, 7};
+    b.merge(d);
+    assert(d.empty() && b.size() == 11 && b.front() == 0);
+
+    std::mt19937 rng(7);
+    for (int n : {0, 1, 2, 3, 17, 1000}) {
+        /* stability: sort by the high part, the low part records order */
+        nuo_list<int> l;
+        std::vector<int> v;
+        for (int i = 0; i < n; i++) {
+            int x = static_cast<int>(rng() % 16) * 10000 + i;
+            l.push_back(x);
+            v.push_back(x);
+        }
+        const int* first = n ? &l.front() : nullptr;
+        auto by_high = [](int x, int y) { return x / 10000 < y / 10000; };
+        l.sort(by_high);
+        std::stable_sort(v.begin(), v.end(), by_high);
+        assert(items(l) == v && l.size() == static_cast<size_t>(n));
+        bool found = n == 0;
+        for (const int& x : l)
+            found = found || &x == first;
+        assert(found);
+        l.sort(std::greater<>());
+        assert(std::is_sorted(l.begin(), l.end(), std::greater<>()));
+    }
+
+    /* a throwing comparison keeps every element, in some order */
+    for (int limit : {1, 40, 150, 400}) {
+        nuo_list<int> l;
+        std::vector<int> v;
+        for (int i = 0; i < 100; i++) {
+            l.push_back(static_cast<int>(rng() % 1000));
+            v.push_back(l.back());
+        }
+        int calls = 0;
+        bool threw = false;
+        try {
+            l.sort([&](int x, int y) {
+                if (++calls == limit)
+                    throw std::runtime_error("less");
+                return x < y;
+            });
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw && l.size() == 100);
+        std::vector<int> after = items(l);
+        std::sort(after.begin(), after.end());
+        std::sort(v.begin(), v.end());
+        assert(after == v);
+    }
+}
+
+void test::Test_Nuo_List::test_pool() {
+    nuo_list<int> l;
+    l.reserve(100);
+    size_t cap = l.pool().capacity();
+    assert(cap >= 100 && l.pool().available() >= 100);
+    for (int i = 0; i < 100; i++)
+        l.push_back(i);
+    assert(l.pool().capacity() == cap);
+    /* erased nodes are reused */
+    l.erase(l.begin(), std::next(l.begin(), 50));
+    l.insert(l.end(), 50, 1);
+    assert(l.pool().capacity() == cap);
+
+    /* a throwing copy leaves the list unchanged and leaks nothing */
+    Counted::live = 0;
+    {
+        nuo_list<Counted> src, dst;
+        for (int i = 0; i < 10; i++)
+            src.emplace_back(i);
+        dst.emplace_back(-1);
+        Counted::limit = Counted::live + 5;
+        bool threw = false;
+        try {
+            dst.insert(dst.begin(), src.begin(), src.end());
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        Counted::limit = -1;
+        assert(threw && dst.size() == 1 && dst.front().v == -1);
+        assert(Counted::live == 11);
+        dst.insert(dst.begin(), src.begin(), src.end());
+        assert(dst.size() == 11 && Counted::live == 21);
+        dst.erase(dst.begin(), std::prev(dst.end()));
+        assert(Counted::live == 11);
+    }
+    assert(Counted::live == 0);
+}
+
+void test::Test_Nuo_List::test_nuo_list() {
+    test_intrusive();
+    test_constructor();
+    test_modifiers();
+    test_splice();
+    test_operations();
+    test_pool();
+}
@@ -0,0 +1,221 @@
+#include "./core/sequence_containers/test_nuo_mapped_array.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "nuostl.hpp"
+#include "test.hpp"
+
+using nuostl::nuo_map_advice;
+using nuostl::nuo_map_options;
+using nuostl::nuo_mapped_array;
+
+namespace {
+    /* temporary file holding the given bytes, removed on destruction */
+    struct TempFile {
+        std::string path;
+
+        TempFile(const void* data, size_t bytes) {
+            const char* dir = getenv("TMPDIR");
+            path = std::string(dir ? dir : "/tmp") + "/nuostl_mapXXXXXX";
+            int fd = mkstemp(path.data());
+            assert(fd >= 0);
+            const char* p = static_cast<const char*>(data);
+            while (bytes > 0) {
+                ssize_t w = write(fd, p, bytes);
+                assert(w > 0);
+                p += w;
+                bytes -= static_cast<size_t>(w);
+            }
+            close(fd);
+        }
+        ~TempFile() { unlink(path.c_str()); }
+    };
+
+    template<typename T>
+    std::vector<T> random_column(size_t n, uint64_t seed) {
+        std::mt19937_64 rng(seed);
+        std::vector<T> v(n);
+        for (auto& x : v)
+            x = static_cast<T>(rng());
+        return v;
+    }
+}
+
+/* ------------------------------------------------- */
+/* Test nuo mapped array */
+void test::Test_Nuo_Mapped_Array::test_nuo_mapped_array() {
+    test_compile_time();
+
+    test_map();
+    test_empty_file();
+    test_errors();
+    test_move();
+    test_algorithms();
+    test_prefetch();
+}
+
+/* ------------------------------------------------- */
+/* Test compile time */
+void test::Test_Nuo_Mapped_Array::test_compile_time() {
+    static_assert(std::ranges::contiguous_range<nuo_mapped_array<int>>);
+    static_assert(std::ranges::sized_range<nuo_mapped_array<double>>);
+    static_assert(std::is_same_v<nuo_mapped_array<int>::iterator, const int*>,
+                  "iterators are raw pointers into the mapping");
+    static_assert(!std::is_copy_constructible_v<nuo_mapped_array<int>>);
+    static_assert(std::is_nothrow_move_constructible_v<nuo_mapped_array<int>>);
+}
+
+/* ------------------------------------------------- */
+/* Test map */
+void test::Test_Nuo_Mapped_Array::test_map() {
+    std::vector<int32_t> col = random_column<int32_t>(100003, 1);
+    TempFile f(col.data(), col.size() * sizeof(int32_t));
+
+    nuo_mapped_array<int32_t> m(f.path.c_str());
+    assert(m.size() == col.size());
+    assert(m.size_bytes() == col.size() * sizeof(int32_t));
+    assert(!m.empty());
+    assert(std::equal(m.begin(), m.end(), col.begin(), col.end()));
+    assert(m[77] == col[77] && m.at(100002) == col[100002]);
+    assert(m.front() == col.front() && m.back() == col.back());
+    assert(m.span().size() == col.size());
+    assert(*m.rbegin() == col.back());
+
+    bool thrown = false;
+    try {
+        (void)m.at(col.size());
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    /* a trailing partial element is not visible */
+    std::vector<char> raw(8 * 5 + 3, 'x');
+    TempFile g(raw.data(), raw.size());
+    nuo_mapped_array<uint64_t> m64(g.path.c_str());
+    assert(m64.size() == 5);
+
+    /* every hint combination is accepted */
+    nuo_map_options opt;
+    opt.advice = nuo_map_advice::random | nuo_map_advice::willneed;
+    opt.populate = true;
+    nuo_mapped_array<int32_t> m2(f.path.c_str(), opt);
+    assert(std::equal(m2.begin(), m2.end(), col.begin(), col.end()));
+    m2.advise(nuo_map_advice::none);
+    m2.advise(nuo_map_advice::sequential | nuo_map_advice::hugepage);
+}
+
+/* ------------------------------------------------- */
+/* Test empty file */
+void test::Test_Nuo_Mapped_Array::test_empty_file() {
+    TempFile f("", 0);
+    nuo_mapped_array<double> m(f.path.c_str());
+    assert(m.empty() && m.size() == 0 && m.begin() == m.end());
+
+    /* smaller than one element */
+    TempFile g("abc", 3);
+    nuo_mapped_array<uint64_t> m2(g.path.c_str());
+    assert(m2.empty());
+
+    nuo_mapped_array<int> d;
+    assert(d.empty() && d.data() == nullptr);
+}
+
+/* ------------------------------------------------- */
+/* Test errors */
+void test::Test_Nuo_Mapped_Array::test_errors() {
+    bool thrown = false;
+    try {
+        nuo_mapped_array<int> m("/nonexistent/nuostl/column.bin");
+    } catch (const std::system_error& e) {
+        thrown = e.code() == std::errc::no_such_file_or_directory;
+    }
+    assert(thrown);
+}
+
+/* ------------------------------------------------- */
+/* Test move */
+void test::Test_Nuo_Mapped_Array::test_move() {
+    std::vector<int64_t> col = random_column<int64_t>(5000, 2);
+    TempFile f(col.data(), col.size() * sizeof(int64_t));
+
+    nuo_map_options opt;
+    opt.prefetch_thread = true;
+    opt.prefetch_window = 4096;
+    nuo_mapped_array<int64_t> a(f.path.c_str(), opt);
+    const int64_t* p = a.data();
+
+    nuo_mapped_array<int64_t> b(std::move(a));
+    assert(a.empty() && a.data() == nullptr);
+    assert(b.data() == p && b.size() == col.size());
+
+    nuo_mapped_array<int64_t> c;
+    c = std::move(b);
+    assert(b.empty() && c.data() == p);
+    assert(std::equal(c.begin(), c.end(), col.begin(), col.end()));
+
+    c = nuo_mapped_array<int64_t>(f.path.c_str());
+    assert(std::equal(c.begin(), c.end(), col.begin(), col.end()));
+}
+
+/* ------------------------------------------------- */
+/* Test the contiguous range overloads running on the mapping */
+void test::Test_Nuo_Mapped_Array::test_algorithms() {
+    std::vector<int32_t> i32 = random_column<int32_t>((1 << 18) + 13, 3);
+    std::vector<uint8_t> u8 = random_column<uint8_t>((1 << 16) + 5, 4);
+    TempFile f32(i32.data(), i32.size() * sizeof(int32_t));
+    TempFile f8(u8.data(), u8.size());
+    nuo_mapped_array<int32_t> m32(f32.path.c_str());
+    nuo_mapped_array<uint8_t> m8(f8.path.c_str());
+
+    for_each_isa([&](unsigned) {
+        assert(nuostl::nuo_min(m32.begin(), m32.end()) ==
+               *std::min_element(i32.begin(), i32.end()));
+        assert(nuostl::nuo_max(m32.begin(), m32.end()) ==
+               *std::max_element(i32.begin(), i32.end()));
+        assert(nuostl::nuo_min(m8.begin(), m8.end()) ==
+               *std::min_element(u8.begin(), u8.end()));
+        assert(nuostl::nuo_max(m8.begin(), m8.end()) ==
+               *std::max_element(u8.begin(), u8.end()));
+    });
+
+    int64_t sum = std::accumulate(m32.begin(), m32.end(), int64_t(0));
+    assert(sum == std::accumulate(i32.begin(), i32.end(), int64_t(0)));
+}
+
+/* ------------------------------------------------- */
+/* Test prefetch thread */
+void test::Test_Nuo_Mapped_Array::test_prefetch() {
+    std::vector<uint32_t> col = random_column<uint32_t>(1 << 20, 5);
+    TempFile f(col.data(), col.size() * sizeof(uint32_t));
+
+    nuo_map_options opt;
+    opt.prefetch_thread = true;
+    opt.prefetch_window = 64 << 10;
+    {
+        /* reading while the thread walks ahead */
+        nuo_mapped_array<uint32_t> m(f.path.c_str(), opt);
+        assert(nuostl::nuo_max(m.begin(), m.end()) ==
+               *std::max_element(col.begin(), col.end()));
+        m.wait_prefetch();
+        m.wait_prefetch();
+    }
+    {
+        /* destroyed while the thread may still be running */
+        nuo_mapped_array<uint32_t> m(f.path.c_str(), opt);
+        assert(m.size() == col.size());
+    }
+}
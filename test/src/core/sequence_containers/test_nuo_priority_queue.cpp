@@ -0,0 +1,337 @@
+#include "./core/sequence_containers/test_nuo_priority_queue.hpp"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::idx_t;
+using nuostl::nuo_addressable_heap;
+using nuostl::nuo_is_heap;
+using nuostl::nuo_is_heap_until;
+using nuostl::nuo_make_heap;
+using nuostl::nuo_pair;
+using nuostl::nuo_pop_heap;
+using nuostl::nuo_priority_queue;
+using nuostl::nuo_push_heap;
+using nuostl::nuo_radix_heap;
+using nuostl::nuo_sort_heap;
+
+namespace {
+    template<size_t D>
+    void check_arity(std::mt19937& rng) {
+        for (size_t n : {0u, 1u, 2u, 5u, 17u, 100u, 1000u}) {
+            std::vector<int> v(n);
+            for (int& x : v)
+                x = static_cast<int>(rng() % 50);
+            std::vector<int> sorted = v;
+            std::sort(sorted.begin(), sorted.end());
+
+            std::vector<int> h = v;
+            nuo_make_heap<D>(h.begin(), h.end());
+            assert(nuo_is_heap<D>(h.begin(), h.end()));
+            nuo_sort_heap<D>(h.begin(), h.end());
+            assert(h == sorted);
+
+            /* one push at a time, then pops against the std ordering */
+            h.clear();
+            for (int x : v) {
+                h.push_back(x);
+                nuo_push_heap<D>(h.begin(), h.end());
+                assert(nuo_is_heap<D>(h.begin(), h.end()));
+            }
+            for (size_t i = n; i > 0; i--) {
+                nuo_pop_heap<D>(h.begin(), h.begin() + static_cast<ptrdiff_t>(i));
+                assert(h[i - 1] == sorted[i - 1]);
+                assert(nuo_is_heap<D>(h.begin(), h.begin() + static_cast<ptrdiff_t>(i - 1)));
+            }
+
+            /* min-heap through the comparator */
+            h = v;
+            nuo_make_heap<D>(h.begin(), h.end(), std::greater<>());
+            nuo_sort_heap<D>(h.begin(), h.end(), std::greater<>());
+            assert(std::equal(h.begin(), h.end(), sorted.rbegin()));
+        }
+    }
+}
+
+void test::Test_Nuo_Priority_Queue::test_heap_algorithms() {
+    std::mt19937 rng(3);
+    check_arity<2>(rng);
+    check_arity<3>(rng);
+    check_arity<4>(rng);
+    check_arity<8>(rng);
+
+    std::vector<int> v{9, 5, 4, 3, 6, 1};
+    assert(nuo_is_heap_until<4>(v.begin(), v.end()) == v.end());
+    assert(nuo_is_heap_until<2>(v.begin(), v.end()) == v.begin() + 4);
+    assert(nuo_is_heap<8>(v.begin(), v.end()));
+}
+
+void test::Test_Nuo_Priority_Queue::test_priority_queue() {
+    using Event = nuo_pair<uint64_t, uint64_t>;
+    std::mt19937_64 rng(5);
+    nuo_priority_queue<Event, std::greater<Event>> q;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> ref;
+    assert(q.empty() && q.size() == 0);
+    for (int step = 0; step < 20000; step++) {
+        int op = static_cast<int>(rng() % 4);
+        Event e(rng() % 1000, static_cast<uint64_t>(step));
+        if (op < 2 || ref.empty()) {
+            q.push(e);
+            ref.push(e);
+        } else if (op == 2) {
+            q.pop();
+            ref.pop();
+        } else {
+            q.replace_top(e);
+            ref.pop();
+            ref.push(e);
+        }
+        assert(q.size() == ref.size());
+        if (!ref.empty())
+            assert(q.top() == ref.top());
+    }
+    assert(nuo_is_heap<4>(q.begin(), q.end(), std::greater<Event>()));
+
+    /* the sibling groups start on a 64 byte boundary */
+    q.reserve(q.size() + 1);
+    assert(reinterpret_cast<uintptr_t>(q.begin() + 1) % 64 == 0);
+
+    /* bulk build, then a small range pushed into a large heap */
+    std::vector<int> v(500);
+    for (int& x : v)
+        x = static_cast<int>(rng() % 10000);
+    nuo_priority_queue<int> p(v.begin(), v.end());
+    assert(p.size() == 500 && nuo_is_heap<4>(p.begin(), p.end()));
+    p.push_range(v.begin(), v.begin() + 10);
+    assert(p.size() == 510 && nuo_is_heap<4>(p.begin(), p.end()));
+    std::sort(v.begin(), v.end());
+    assert(p.top() == v.back());
+
+    nuo_priority_queue<int, std::less<int>, 2> b{3, 1, 4, 1, 5};
+    assert(b.top() == 5);
+    b.emplace(9);
+    assert(b.top() == 9 && b.size() == 6);
+    nuo_priority_queue<int, std::less<int>, 2> c(b);
+    b.pop();
+    assert(b.top() == 5 && c.top() == 9);
+    c = b;
+    assert(c.size() == 5 && c.top() == 5);
+    nuo_priority_queue<int, std::less<int>, 2> d(std::move(c));
+    assert(c.empty() && d.size() == 5);
+    d.swap(c);
+    assert(d.empty() && c.top() == 5);
+    c.clear();
+    assert(c.empty());
+
+    nuo_priority_queue<std::string> s;
+    for (int i = 0; i < 100; i++)
+        s.push(std::string(static_cast<size_t>(i % 37), 'a'));
+    assert(s.top().size() == 36);
+    while (s.size() > 1)
+        s.pop();
+    assert(s.top().empty());
+}
+
+void test::Test_Nuo_Priority_Queue::test_addressable_heap() {
+    std::mt19937 rng(7);
+    nuo_addressable_heap<int, std::greater<int>> h;
+    std::map<size_t, int> live;
+    for (int step = 0; step < 10000; step++) {
+        int op = static_cast<int>(rng() % 5);
+        if (op < 2 || live.empty()) {
+            int x = static_cast<int>(rng() % 1000);
+            size_t id = h.push(x);
+            assert(!live.count(id));
+            live[id] = x;
+        } else {
+            auto it = std::next(live.begin(), static_cast<ptrdiff_t>(rng() % live.size()));
+            if (op == 2) {
+                /* both decrease and increase of the key */
+                int x = static_cast<int>(rng() % 1000);
+                h.update(it->first, x);
+                it->second = x;
+            } else if (op == 3) {
+                h.erase(it->first);
+                live.erase(it);
+            } else {
+                size_t id = h.top_handle();
+                assert(live.count(id) && live[id] == h.top());
+                h.pop();
+                live.erase(id);
+            }
+        }
+        assert(h.size() == live.size());
+        if (!live.empty()) {
+            int m = live.begin()->second;
+            for (const auto& kv : live)
+                m = std::min(m, kv.second);
+            assert(h.top() == m);
+        }
+    }
+    for (const auto& kv : live)
+        assert(h.contains(kv.first) && h.get(kv.first) == kv.second);
+
+    nuo_addressable_heap<std::string> s;
+    size_t a = s.push("m");
+    size_t b = s.push("b");
+    s.update(b, "z");
+    assert(s.top() == "z" && s.top_handle() == b);
+    s.erase(b);
+    assert(!s.contains(b) && s.top() == "m");
+    bool threw = false;
+    try {
+        s.update(b, "x");
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(s.push("c") == b);
+    s.pop();
+    assert(s.size() == 1 && !s.contains(a) && s.top() == "c");
+}
+
+void test::Test_Nuo_Priority_Queue::test_compact_index() {
+    static_assert(std::is_same_v<nuo_addressable_heap<int>::handle_type, idx_t>);
+    static_assert(std::is_same_v<nuo_addressable_heap<int, std::less<int>, 4, uint32_t>::handle_type,
+                                 uint32_t>);
+    static_assert(nuostl::nuo_index_type<idx_t> && !nuostl::nuo_index_type<int>);
+    static_assert(nuostl::nuo_idx_npos<uint32_t> == UINT32_MAX);
+    static_assert(nuostl::nuo_idx_max<uint32_t> == UINT32_MAX - 1);
+    static_assert(nuostl::nuo_idx_cast<uint32_t>(size_t(12)) == 12);
+
+    /* the tests keep NDEBUG undefined, so narrowing is checked */
+    assert(nuostl::nuo_idx_cast<uint32_t>(size_t(UINT32_MAX) - 1) == UINT32_MAX - 1);
+    bool threw = false;
+    try {
+        nuostl::nuo_idx_cast<uint32_t>(size_t(UINT32_MAX));
+    } catch (const std::length_error&) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        nuostl::nuo_idx_cast<uint64_t>(std::numeric_limits<size_t>::max());
+    } catch (const std::length_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    /* same handles and order as with the default index */
+    std::mt19937 rng(11);
+    nuo_addressable_heap<uint32_t, std::less<uint32_t>, 4, uint32_t> c;
+    nuo_addressable_heap<uint32_t> w;
+    std::vector<uint32_t> handles;
+    assert(c.max_size() == UINT32_MAX && w.max_size() == nuostl::nuo_idx_max<idx_t> + 1);
+    for (int step = 0; step < 20000; step++) {
+        uint32_t op = rng() % 4;
+        uint32_t x = rng();
+        if (op < 2 || handles.empty()) {
+            uint32_t h = c.push(x);
+            assert(h == w.push(x));
+            handles.push_back(h);
+        } else if (op == 2) {
+            uint32_t h = handles[rng() % handles.size()];
+            c.update(h, x);
+            w.update(h, x);
+        } else {
+            uint32_t h = c.top_handle();
+            assert(h == w.top_handle() && c.top() == w.top());
+            c.pop();
+            w.pop();
+            handles.erase(std::find(handles.begin(), handles.end(), h));
+        }
+        assert(c.size() == w.size());
+    }
+    for (uint32_t h : handles)
+        assert(c.contains(h) && c.get(h) == w.get(h));
+}
+
+void test::Test_Nuo_Priority_Queue::test_radix_heap() {
+    std::mt19937 rng(9);
+    nuo_radix_heap<uint32_t> h;
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> ref;
+    uint32_t now = 0;
+    for (int step = 0; step < 20000; step++) {
+        if (rng() % 3 != 0 || ref.empty()) {
+            /* deadlines ahead of the current time, a few far ahead */
+            uint64_t d = rng() % 8 == 0 ? rng() : rng() % 64;
+            uint32_t k = static_cast<uint32_t>(std::min<uint64_t>(now + d, UINT32_MAX));
+            h.push(k);
+            ref.push(k);
+        } else {
+            assert(h.top() == ref.top() && h.top_key() == ref.top());
+            now = h.top();
+            h.pop();
+            ref.pop();
+        }
+        assert(h.size() == ref.size());
+    }
+    while (!ref.empty()) {
+        assert(h.top() == ref.top());
+        h.pop();
+        ref.pop();
+    }
+    assert(h.empty());
+
+    /* the bound is the key last popped, not the smallest pushed */
+    nuo_radix_heap<uint32_t> g;
+    g.push(100);
+    g.push(7);
+    assert(g.top() == 7);
+    g.pop();
+    g.pop();
+    bool threw = false;
+    try {
+        g.push(99);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    /* peeking does not raise the bound, clearing resets it */
+    nuo_radix_heap<uint32_t> p;
+    p.push(5);
+    p.pop();
+    p.push(10);
+    assert(p.top() == 10);
+    p.push(7);
+    assert(p.top() == 7 && p.size() == 2);
+    p.pop();
+    assert(p.top() == 10);
+    g.clear();
+    g.push(1);
+    assert(g.top() == 1 && g.size() == 1);
+
+    nuo_radix_heap<uint64_t, std::string> t;
+    t.push(nuo_pair<uint64_t, std::string>(3, "three"));
+    t.push(5, "five");
+    t.push(~uint64_t(0), 4, 'x');
+    assert(t.top().second == "three");
+    t.pop();
+    assert(t.top().first == 5 && t.top().second == "five");
+    t.pop();
+    assert(t.top().second == "xxxx" && t.size() == 1);
+    t.clear();
+    assert(t.empty());
+}
+
+void test::Test_Nuo_Priority_Queue::test_nuo_priority_queue() {
+    test_heap_algorithms();
+    test_priority_queue();
+    test_addressable_heap();
+    test_compact_index();
+    test_radix_heap();
+}
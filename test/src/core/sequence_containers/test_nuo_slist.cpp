@@ -0,0 +1,225 @@
+#include "./core/sequence_containers/test_nuo_slist.hpp"
+
+#include <assert.h>
+
+#include <forward_list>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nuostl.hpp"
+
+using nuostl::nuo_forward_list;
+using nuostl::nuo_intrusive_slist;
+using nuostl::nuo_slist;
+using nuostl::nuo_slist_hook;
+
+namespace {
+    struct Job : nuo_slist_hook<> {
+        int id;
+
+        explicit Job(int i) : id(i) {}
+    };
+
+    template<typename L>
+    std::vector<int> ids(const L& l) {
+        std::vector<int> out;
+        for (const Job& j : l)
+            out.push_back(j.id);
+        return out;
+    }
+
+    template<typename L>
+    std::vector<typename L::value_type> items(const L& l) {
+        return std::vector<typename L::value_type>(l.begin(), l.end());
+    }
+}
+
+void test::Test_Nuo_Slist::test_intrusive() {
+    std::vector<Job> jobs;
+    for (int i = 0; i < 6; i++)
+        jobs.emplace_back(i);
+
+    nuo_intrusive_slist<Job> q;
+    assert(q.empty() && q.before_end() == q.before_begin());
+    for (Job& j : jobs)
+        q.push_back(j);
+    assert(q.size() == 6 && q.front().id == 0 && q.back().id == 5);
+    q.pop_front();
+    q.push_front(jobs[0]);
+    assert((ids(q) == std::vector<int>{0, 1, 2, 3, 4, 5}));
+
+    /* erasing the last element moves the tail back */
+    q.erase_after(q.iterator_to(jobs[4]));
+    assert(q.back().id == 4 && !jobs[5].is_linked());
+    q.push_back(jobs[5]);
+    assert(q.back().id == 5);
+
+    /* O(1) append of a whole queue */
+    nuo_intrusive_slist<Job> r;
+    q.erase_after(q.iterator_to(jobs[2]), q.end());
+    assert((ids(q) == std::vector<int>{0, 1, 2}) && q.back().id == 2);
+    r.push_back(jobs[3]);
+    r.push_back(jobs[4]);
+    q.append(r);
+    assert(r.empty() && r.before_end() == r.before_begin());
+    assert((ids(q) == std::vector<int>{0, 1, 2, 3, 4}) && q.back().id == 4);
+
+    /* single element and counted range splices update both tails */
+    r.splice_after(r.before_begin(), q, q.iterator_to(jobs[3]));
+    assert((ids(r) == std::vector<int>{4}) && q.back().id == 3 && r.back().id == 4);
+    r.splice_after(r.before_begin(), q, q.before_begin(), q.iterator_to(jobs[1]), 2);
+    assert((ids(r) == std::vector<int>{0, 1, 4}) && (ids(q) == std::vector<int>{2, 3}));
+    assert(q.size() == 2 && r.size() == 3 && r.back().id == 4);
+
+    r.reverse();
+    assert((ids(r) == std::vector<int>{4, 1, 0}) && r.back().id == 0);
+    r.push_back(jobs[5]);
+    assert(r.back().id == 5);
+    assert(r.remove_if([](const Job& j) { return j.id < 2; }) == 2);
+    assert((ids(r) == std::vector<int>{4, 5}) && r.back().id == 5);
+
+    nuo_intrusive_slist<Job> moved(std::move(r));
+    assert(r.empty() && moved.size() == 2);
+    moved.push_back(jobs[0]);
+    assert(moved.back().id == 0);
+    q.swap(moved);
+    assert((ids(q) == std::vector<int>{4, 5, 0}) && (ids(moved) == std::vector<int>{2, 3}));
+    q.clear();
+    moved.clear();
+    for (const Job& j : jobs)
+        assert(!j.is_linked());
+}
+
+void test::Test_Nuo_Slist::test_constructor() {
+    nuo_slist<int> a;
+    assert(a.empty() && a.begin() == a.end());
+    nuo_slist<int> b(3);
+    assert((items(b) == std::vector<int>{0, 0, 0}));
+    nuo_slist<int> c(2, 5);
+    assert((items(c) == std::vector<int>{5, 5}) && c.back() == 5);
+    nuo_slist<int> d{1, 2, 3};
+    assert(d.size() == 3 && d.front() == 1 && d.back() == 3);
+
+    nuo_slist<std::string> s{"p", std::string(50, 'q')};
+    nuo_slist<std::string> t(s);
+    assert(t == s);
+    nuo_slist<std::string> u(std::move(t));
+    assert(u == s && t.empty());
+    t = u;
+    assert(t == u);
+    t = {"z"};
+    assert(t.size() == 1 && t.back() == "z");
+
+    nuo_forward_list<int> f{3, 1};
+    f = d;
+    assert(f == d && f.back() == 3);
+    assert((c > d && d < nuo_slist<int>{1, 2, 4}));
+}
+
+void test::Test_Nuo_Slist::test_modifiers() {
+    std::mt19937 rng(11);
+    nuo_slist<int> l;
+    std::forward_list<int> ref;
+    size_t n = 0;
+    for (int step = 0; step < 3000; step++) {
+        int op = static_cast<int>(rng() % 6);
+        int x = static_cast<int>(rng() % 1000);
+        size_t at = rng() % (n + 1);
+        auto li = std::next(l.before_begin(), static_cast<ptrdiff_t>(at));
+        auto ri = std::next(ref.before_begin(), static_cast<ptrdiff_t>(at));
+        switch (op) {
+        case 0:
+            l.push_front(x);
+            ref.push_front(x);
+            n++;
+            break;
+        case 1:
+            assert(*l.insert_after(li, x) == x);
+            ref.insert_after(ri, x);
+            n++;
+            break;
+        case 2: {
+            size_t k = rng() % 4;
+            auto r = l.insert_after(li, k, x);
+            ref.insert_after(ri, k, x);
+            n += k;
+            assert(std::distance(l.before_begin(), r) == static_cast<ptrdiff_t>(at + k));
+            break;
+        }
+        case 3:
+            if (at < n) {
+                l.erase_after(li);
+                ref.erase_after(ri);
+                n--;
+            }
+            break;
+        case 4: {
+            size_t k = rng() % 4;
+            if (k > n - at)
+                k = n - at;
+            l.erase_after(li, std::next(li, static_cast<ptrdiff_t>(k + 1)));
+            ref.erase_after(ri, std::next(ri, static_cast<ptrdiff_t>(k + 1)));
+            n -= k;
+            break;
+        }
+        case 5:
+            l.push_back(x);
+            ref.insert_after(std::next(ref.before_begin(), static_cast<ptrdiff_t>(n)), x);
+            n++;
+            break;
+        }
+        assert(l.size() == n);
+        if (n > 0)
+            assert(&l.back() == &*std::next(l.begin(), static_cast<ptrdiff_t>(n - 1)));
+    }
+    assert(std::equal(l.begin(), l.end(), ref.begin(), ref.end()));
+
+    l.resize(2);
+    l.resize(4, 9);
+    assert(l.size() == 4 && l.back() == 9);
+    l.assign(3, 1);
+    assert((items(l) == std::vector<int>{1, 1, 1}) && l.back() == 1);
+    l.emplace_back(2);
+    l.emplace_front(0);
+    assert((items(l) == std::vector<int>{0, 1, 1, 1, 2}));
+    assert(l.remove(1) == 3 && l.back() == 2);
+    l.reverse();
+    assert((items(l) == std::vector<int>{2, 0}) && l.back() == 0);
+    l.clear();
+    assert(l.empty() && l.before_end() == l.before_begin());
+}
+
+void test::Test_Nuo_Slist::test_splice() {
+    nuo_slist<int>::pool_type pool;
+    nuo_slist<int> a(pool), b(pool);
+    a = {1, 2, 3};
+    b = {7, 8, 9};
+    const int* addr = &b.front();
+    a.append(b);
+    assert(b.empty() && (items(a) == std::vector<int>{1, 2, 3, 7, 8, 9}));
+    assert(&*std::next(a.begin(), 3) == addr && a.back() == 9);
+
+    b.splice_after(b.before_begin(), a, a.begin());
+    assert((items(b) == std::vector<int>{2}) && a.size() == 5);
+    b.splice_after(b.before_end(), a, a.begin(), std::next(a.begin(), 3));
+    assert((items(b) == std::vector<int>{2, 3, 7}) && b.back() == 7);
+    assert((items(a) == std::vector<int>{1, 8, 9}) && a.size() == 3);
+    a.splice_after(a.before_begin(), b);
+    assert((items(a) == std::vector<int>{2, 3, 7, 1, 8, 9}) && a.back() == 9);
+
+    /* separate pools move the values */
+    nuo_slist<std::string> c{"a"}, d{"b", std::string(40, 'c')};
+    c.append(d);
+    assert(d.empty() && c.size() == 3 && c.back().size() == 40);
+    d.splice_after(d.before_begin(), c, c.before_begin());
+    assert((items(d) == std::vector<std::string>{"a"}) && c.front() == "b");
+}
+
+void test::Test_Nuo_Slist::test_nuo_slist() {
+    test_intrusive();
+    test_constructor();
+    test_modifiers();
+    test_splice();
+}
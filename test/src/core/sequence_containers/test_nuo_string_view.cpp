@@ -0,0 +1,430 @@
+#include "./core/sequence_containers/test_nuo_string_view.hpp"
+
+#include <assert.h>
+#include <string.h>
+
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "nuostl.hpp"
+#include "test.hpp"
+
+using nuostl::nuo_string;
+using nuostl::nuo_string_view;
+
+namespace {
+    std::string random_text(std::mt19937_64& rng, size_t n,
+                            unsigned alphabet = 4) {
+        std::string s(n, 'a');
+        for (auto& c : s)
+            c = static_cast<char>('a' + rng() % alphabet);
+        return s;
+    }
+
+    /* every position, the slow way */
+    size_t naive_find(std::string_view h, std::string_view s) {
+        for (size_t i = 0; i + s.size() <= h.size(); i++) {
+            if (h.substr(i, s.size()) == s)
+                return i;
+        }
+        return std::string_view::npos;
+    }
+
+    template<typename R>
+    std::vector<std::string> collect(const R& r) {
+        std::vector<std::string> out;
+        for (nuo_string_view t : r)
+            out.emplace_back(t.data(), t.size());
+        return out;
+    }
+
+    std::vector<std::string> std_split(std::string_view s,
+                                       std::string_view delim) {
+        std::vector<std::string> out;
+        if (s.empty())
+            return out;
+        size_t pos = 0;
+        for (;;) {
+            size_t k = s.find(delim, pos);
+            if (k == std::string_view::npos) {
+                out.emplace_back(s.substr(pos));
+                return out;
+            }
+            out.emplace_back(s.substr(pos, k - pos));
+            pos = k + delim.size();
+        }
+    }
+
+    std::vector<std::string> std_tokenize(std::string_view s,
+                                          std::string_view delims) {
+        std::vector<std::string> out;
+        size_t pos = s.find_first_not_of(delims);
+        while (pos != std::string_view::npos) {
+            size_t end = s.find_first_of(delims, pos);
+            if (end == std::string_view::npos)
+                end = s.size();
+            out.emplace_back(s.substr(pos, end - pos));
+            pos = s.find_first_not_of(delims, end);
+        }
+        return out;
+    }
+}
+
+/* ------------------------------------------------- */
+/* Test nuo string view */
+void test::Test_Nuo_String_View::test_nuo_string_view() {
+    test_compile_time();
+
+    test_constructor();
+    test_element_access();
+    test_compare();
+    test_find();
+    test_find_first_of();
+    test_two_way();
+    test_split();
+    test_tokenize();
+    test_simd_paths();
+}
+
+/* ------------------------------------------------- */
+/* Test compile time */
+void test::Test_Nuo_String_View::test_compile_time() {
+    static_assert(sizeof(nuo_string_view) == 2 * sizeof(void*),
+                  "nuo_string_view is a pointer and a length");
+    static_assert(std::is_trivially_copyable_v<nuo_string_view>,
+                  "views are passed in registers");
+    static_assert(!std::is_constructible_v<nuo_string_view, std::nullptr_t>,
+                  "construction from nullptr is rejected");
+    static_assert(std::ranges::contiguous_range<nuo_string_view>);
+    static_assert(std::ranges::forward_range<nuostl::nuo_split_view<char>>);
+    static_assert(std::ranges::view<nuostl::nuo_token_view>);
+
+    constexpr nuo_string_view sv("key=value");
+    static_assert(sv.size() == 9);
+    static_assert(sv.find('=') == 3);
+    static_assert(sv.find("value") == 4);
+    static_assert(sv.substr(4) == "value");
+    static_assert(sv.starts_with("key") && sv.ends_with('e'));
+    static_assert(sv < nuo_string_view("key=w"));
+}
+
+/* ------------------------------------------------- */
+/* Test constructor */
+void test::Test_Nuo_String_View::test_constructor() {
+    nuo_string_view a;
+    assert(a.empty() && a.size() == 0);
+
+    const char* text = "hello world";
+    nuo_string_view b(text);
+    assert(b.size() == 11 && b.data() == text);
+
+    nuo_string_view c(text, 5);
+    assert(c == "hello");
+
+    nuo_string_view d(text + 6, text + 11);
+    assert(d == "world");
+
+    /* zero-copy from owning strings */
+    std::string s = "std string";
+    nuo_string ns("a nuo_string longer than the inline buffer");
+    nuo_string_view e = s;
+    nuo_string_view f = ns;
+    assert(e.data() == s.data() && e.size() == s.size());
+    assert(f.data() == ns.data() && f.size() == ns.size());
+
+    /* and back to std::string_view */
+    std::string_view g = f;
+    assert(g.data() == ns.data() && g.size() == ns.size());
+    assert(nuo_string(g) == ns);
+
+    nuo_string_view h = std::string_view("view");
+    assert(h == "view");
+}
+
+/* ------------------------------------------------- */
+/* Test element access */
+void test::Test_Nuo_String_View::test_element_access() {
+    nuo_string_view sv("abcdef");
+    assert(sv[0] == 'a' && sv.front() == 'a' && sv.back() == 'f');
+    assert(sv.at(5) == 'f');
+
+    bool thrown = false;
+    try {
+        (void)sv.at(6);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    thrown = false;
+    try {
+        (void)sv.substr(7);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    assert(std::string(sv.rbegin(), sv.rend()) == "fedcba");
+
+    nuo_string_view t = sv;
+    t.remove_prefix(2);
+    t.remove_suffix(1);
+    assert(t == "cde");
+    assert(sv.substr(1, 3) == "bcd");
+    assert(sv.substr(4, 100) == "ef");
+
+    char buf[8] = {};
+    assert(sv.copy(buf, 3, 2) == 3);
+    assert(strcmp(buf, "cde") == 0);
+
+    swap(sv, t);
+    assert(sv == "cde" && t == "abcdef");
+
+    std::ostringstream os;
+    os << t;
+    assert(os.str() == "abcdef");
+}
+
+/* ------------------------------------------------- */
+/* Test compare */
+void test::Test_Nuo_String_View::test_compare() {
+    nuo_string_view a("apple");
+    nuo_string_view b("apricot");
+    assert(a < b && b > a && a != b);
+    assert(a.compare(b) < 0 && b.compare(a) > 0 && a.compare(a) == 0);
+    assert(nuo_string_view("app") < a);
+    assert(a.compare(0, 2, "ap") == 0);
+
+    /* bytes compare unsigned */
+    assert(nuo_string_view("\x7f") < nuo_string_view("\x80"));
+
+    /* mixed with the owning and the std types, both argument orders */
+    nuo_string ns("apple");
+    std::string s("apple");
+    std::string_view v("apple");
+    assert(a == ns && ns == a);
+    assert(a == s && s == a);
+    assert(a == v && v == a);
+    assert(b > ns && ns < b);
+    assert(a == "apple" && "apple" == a);
+
+    /* long keys take the vector compare */
+    std::string x(100, 'q'), y(100, 'q');
+    y[77] = 'r';
+    assert(nuo_string_view(x) < nuo_string_view(y));
+    assert(nuo_string_view(x).compare(y) < 0);
+}
+
+/* ------------------------------------------------- */
+/* Test find */
+void test::Test_Nuo_String_View::test_find() {
+    nuo_string_view sv("GET /index.html HTTP/1.1");
+    assert(sv.find(' ') == 3);
+    assert(sv.find(' ', 4) == 15);
+    assert(sv.find('#') == nuo_string_view::npos);
+    assert(sv.find("HTTP") == 16);
+    assert(sv.find("") == 0);
+    assert(sv.find("", 24) == 24);
+    assert(sv.find("", 25) == nuo_string_view::npos);
+    assert(sv.rfind('/') == 20);
+    assert(sv.rfind('/', 19) == 4);
+    assert(sv.rfind("1") == 23);
+    assert(sv.rfind("GET") == 0);
+    assert(sv.contains("index") && !sv.contains("indexes"));
+
+    std::mt19937_64 rng(29);
+    for (int it = 0; it < 500; it++) {
+        std::string h = random_text(rng, rng() % 300);
+        std::string n = random_text(rng, rng() % 6);
+        size_t pos = rng() % (h.size() + 2);
+        nuo_string_view nh(h);
+        assert(nh.find(n, pos) == std::string_view(h).find(n, pos));
+        assert(nh.rfind(n, pos) == std::string_view(h).rfind(n, pos));
+        if (!n.empty()) {
+            assert(nh.find(n[0], pos) == h.find(n[0], pos));
+            assert(nh.rfind(n[0], pos) == h.rfind(n[0], pos));
+        }
+    }
+}
+
+/* ------------------------------------------------- */
+/* Test find_first_of / find_first_not_of and the last_ variants */
+void test::Test_Nuo_String_View::test_find_first_of() {
+    nuo_string_view sv("  key = value ; # comment");
+    assert(sv.find_first_of("=;#") == 6);
+    assert(sv.find_first_of("#", 10) == 16);
+    assert(sv.find_first_of("xz") == nuo_string_view::npos);
+    assert(sv.find_first_of("") == nuo_string_view::npos);
+    assert(sv.find_first_not_of(' ') == 2);
+    assert(sv.find_first_not_of(" \t") == 2);
+    assert(sv.find_first_not_of("") == 0);
+    assert(sv.find_last_of(" ") == 17);
+    assert(sv.find_last_not_of("tnemo") == 18);
+    assert(sv.find_last_of('=', 5) == nuo_string_view::npos);
+
+    /* high bytes use the second nibble table */
+    std::string bin(300, '\x01');
+    bin[250] = '\xff';
+    bin[280] = '\x80';
+    assert(nuo_string_view(bin).find_first_of("\x80\xff") == 250);
+    assert(nuo_string_view(bin).find_first_of("\x80") == 280);
+    assert(nuo_string_view(bin).find_first_not_of("\x01") == 250);
+    assert(nuo_string_view(bin).find_last_of("\x80\xff") == 280);
+
+    /* every byte value as a singleton set, at every offset of a vector */
+    for (unsigned c = 0; c < 256; c++) {
+        std::string h(96, static_cast<char>(c ^ 0x55));
+        size_t at = (c * 7) % 96;
+        h[at] = static_cast<char>(c);
+        const char set[2] = {static_cast<char>(c), 'Z'};
+        std::string_view sset(set, c == 'Z' ? 1 : 2);
+        assert(nuo_string_view(h).find_first_of(sset) ==
+               std::string_view(h).find_first_of(sset));
+        assert(nuo_string_view(h).find_first_not_of(
+                   std::string(1, static_cast<char>(c ^ 0x55))) == at);
+    }
+
+    std::mt19937_64 rng(30);
+    for (int it = 0; it < 500; it++) {
+        std::string h = random_text(rng, rng() % 400, 26);
+        std::string set = random_text(rng, rng() % 5, 26);
+        size_t pos = rng() % (h.size() + 2);
+        nuo_string_view nh(h);
+        std::string_view sh(h);
+        assert(nh.find_first_of(set, pos) == sh.find_first_of(set, pos));
+        assert(nh.find_first_not_of(set, pos) ==
+               sh.find_first_not_of(set, pos));
+        assert(nh.find_last_of(set, pos) == sh.find_last_of(set, pos));
+        assert(nh.find_last_not_of(set, pos) ==
+               sh.find_last_not_of(set, pos));
+    }
+}
+
+/* ------------------------------------------------- */
+/* Test Two-Way and the filter's switch to it */
+void test::Test_Nuo_String_View::test_two_way() {
+    using nuostl::detail::nuo_char_search_two_way;
+
+    /* periodic and aperiodic needles over tiny alphabets */
+    std::mt19937_64 rng(31);
+    for (int it = 0; it < 3000; it++) {
+        std::string h = random_text(rng, rng() % 200, 2 + it % 2);
+        std::string n = random_text(rng, 1 + rng() % 9, 2 + it % 2);
+        if (it % 3 == 0) {
+            /* plant a match */
+            if (h.size() >= n.size())
+                h.replace(rng() % (h.size() - n.size() + 1), n.size(), n);
+        }
+        assert(nuo_char_search_two_way(h.data(), h.size(), n.data(),
+                                       n.size()) == naive_find(h, n));
+    }
+    const char* periodic[] = {"abab", "aaaa", "abaabaab", "aab", "abcabcabd"};
+    for (const char* n : periodic) {
+        for (int it = 0; it < 200; it++) {
+            std::string h = random_text(rng, rng() % 100, 4);
+            size_t m = strlen(n);
+            assert(nuo_char_search_two_way(h.data(), h.size(), n, m) ==
+                   naive_find(h, n));
+        }
+    }
+
+    /* the filter's worst case: long needle, almost every candidate fails */
+    std::string hay(1 << 20, 'a');
+    std::string needle(100, 'a');
+    needle[50] = 'b';
+    assert(nuo_string_view(hay).find(needle) == nuo_string_view::npos);
+    hay.replace(hay.size() - 200, needle.size(), needle);
+    assert(nuo_string_view(hay).find(needle) == hay.size() - 200);
+
+    std::string needle2 = std::string(60, 'a') + "b" + std::string(60, 'a');
+    std::string hay2 = std::string(500000, 'a') + needle2;
+    assert(nuo_string_view(hay2).find(needle2) == 500000);
+}
+
+/* ------------------------------------------------- */
+/* Test split */
+void test::Test_Nuo_String_View::test_split() {
+    using V = std::vector<std::string>;
+    assert(collect(nuostl::nuo_split("a,b,,c", ',')) ==
+           (V{"a", "b", "", "c"}));
+    assert(collect(nuostl::nuo_split("a,", ',')) == (V{"a", ""}));
+    assert(collect(nuostl::nuo_split(",", ',')) == (V{"", ""}));
+    assert(collect(nuostl::nuo_split("abc", ',')) == (V{"abc"}));
+    assert(collect(nuostl::nuo_split("", ',')).empty());
+    assert(collect(nuostl::nuo_split("a\r\nb\r\n", "\r\n")) ==
+           (V{"a", "b", ""}));
+    assert(collect(nuostl::nuo_split("abc", "")) == (V{"abc"}));
+
+    /* tokens are views into the source */
+    std::string lines = "first line\nsecond line\nthird";
+    auto r = nuostl::nuo_split(lines, '\n');
+    auto it = r.begin();
+    assert((*it).data() == lines.data());
+    ++it;
+    assert((*it).data() == lines.data() + 11);
+    assert(std::ranges::distance(r) == 3);
+    assert(r.front() == "first line");
+
+    std::mt19937_64 rng(32);
+    for (int it2 = 0; it2 < 300; it2++) {
+        std::string s = random_text(rng, rng() % 200, 5);
+        assert(collect(nuostl::nuo_split(s, 'c')) == std_split(s, "c"));
+        assert(collect(nuostl::nuo_split(s, "ab")) == std_split(s, "ab"));
+    }
+}
+
+/* ------------------------------------------------- */
+/* Test tokenize */
+void test::Test_Nuo_String_View::test_tokenize() {
+    using V = std::vector<std::string>;
+    assert(collect(nuostl::nuo_tokenize("  the quick\tbrown  fox ", " \t")) ==
+           (V{"the", "quick", "brown", "fox"}));
+    assert(collect(nuostl::nuo_tokenize("", " ")).empty());
+    assert(collect(nuostl::nuo_tokenize("    ", " ")).empty());
+    assert(collect(nuostl::nuo_tokenize("word", "")) == (V{"word"}));
+
+    std::mt19937_64 rng(33);
+    for (int it = 0; it < 300; it++) {
+        std::string s = random_text(rng, rng() % 500, 6);
+        std::string delims = random_text(rng, 1 + rng() % 3, 6);
+        assert(collect(nuostl::nuo_tokenize(s, delims)) ==
+               std_tokenize(s, delims));
+    }
+}
+
+/* ------------------------------------------------- */
+/* Test vectorized searches on every reachable ISA level */
+void test::Test_Nuo_String_View::test_simd_paths() {
+    for_each_isa([&](unsigned level) {
+        std::mt19937_64 rng(level + 41);
+        for (int it = 0; it < 200; it++) {
+            std::string h = random_text(rng, rng() % 1000, 8);
+            std::string set = random_text(rng, 1 + rng() % 4, 8);
+            nuo_string_view nh(h);
+            std::string_view sh(h);
+            assert(nh.find_first_of(set) == sh.find_first_of(set));
+            assert(nh.find_first_not_of(set) == sh.find_first_not_of(set));
+            assert(collect(nuostl::nuo_tokenize(h, set)) ==
+                   std_tokenize(h, set));
+        }
+        /* match at every position around the vector and unroll edges */
+        for (size_t at = 0; at < 300; at++) {
+            std::string h(320, '.');
+            h[at] = ';';
+            assert(nuo_string_view(h).find_first_of(",;") == at);
+            assert(nuo_string_view(h).find_first_not_of(".") == at);
+        }
+        /* degenerate input switches to Two-Way at every level */
+        std::string hay(200000, 'a');
+        std::string needle = std::string(40, 'a') + "b";
+        hay += needle;
+        assert(nuo_string_view(hay).find(needle) == 200000);
+    });
+}
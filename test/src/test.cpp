@@ -3,6 +3,50 @@
 using namespace test;
 
 int main() {
+    Test_Nuo_Any::test_nuo_any();
+    Test_Nuo_Optional::test_nuo_optional();
     // Test_Nuo_Pair::test_nuo_pair();
+    Test_Nuo_String::test_nuo_string();
+    Test_Nuo_Tuple::test_nuo_tuple();
+    Test_Nuo_Variant::test_nuo_variant();
+
+    /* Sequence Containers */
+    Test_Nuo_List::test_nuo_list();
+    Test_Nuo_Mapped_Array::test_nuo_mapped_array();
+    Test_Nuo_Priority_Queue::test_nuo_priority_queue();
+    Test_Nuo_Slist::test_nuo_slist();
+    Test_Nuo_String_View::test_nuo_string_view();
+
+    /* Associative Containers */
+    Test_Nuo_Concurrent_Unordered_Map::test_nuo_concurrent_unordered_map();
+    Test_Nuo_Flat_Map::test_nuo_flat_map();
+    Test_Nuo_Flat_Set::test_nuo_flat_set();
+
+    /* Function Objects */
+    Test_Nuo_Functional::test_nuo_functional();
+    Test_Nuo_Hash::test_nuo_hash();
+
+    /* Algorithms */
+    Test_Nuo_Accumulate::test_nuo_accumulate();
+    Test_Nuo_Binary_Search::test_nuo_binary_search();
+    Test_Nuo_Copy::test_nuo_copy();
+    Test_Nuo_Max::test_nuo_max();
+    Test_Nuo_Min::test_nuo_min();
+    Test_Nuo_Select::test_nuo_select();
+    Test_Nuo_Sliding_Window::test_nuo_sliding_window();
+    Test_Nuo_Stream_Accumulator::test_nuo_stream_accumulator();
+
+    /* Execution */
+    Test_Nuo_Scheduler::test_nuo_scheduler();
+
+    /* Dispatch */
+    Test_Nuo_Cpu_Dispatch::test_nuo_cpu_dispatch();
+
+    /* Math */
+    Test_Nuo_BigInteger::test_nuo_biginteger();
+    Test_Nuo_Complex::test_nuo_complex();
+    Test_Nuo_Fraction::test_nuo_fraction();
+    Test_Nuo_Matrix::test_nuo_matrix();
+    Test_Nuo_Polynomial::test_nuo_polynomial();
     return 0;
 }
\ No newline at end of file